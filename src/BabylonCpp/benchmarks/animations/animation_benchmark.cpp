@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <iostream>
+
+#include "../benchmark_utils.h"
+
+#include <babylon/animations/_ianimation_state.h>
+#include <babylon/animations/animation.h>
+#include <babylon/animations/animation_track.h>
+#include <babylon/animations/ianimation_key.h>
+
+TEST(BenchmarkAnimations, AnimationTracks)
+{
+  using namespace BABYLON;
+
+  // The rotations of 2000 bones, 120 keys each
+  const size_t nbBones = 2000;
+  const size_t nbKeys  = 120;
+  std::vector<AnimationPtr> animations;
+  for (size_t bone = 0; bone < nbBones; ++bone) {
+    std::vector<IAnimationKey> keys;
+    for (size_t key = 0; key < nbKeys; ++key) {
+      const auto angle = static_cast<float>(bone + key) * 0.1f;
+      const auto rotation = Quaternion::RotationYawPitchRoll(angle, std::sin(angle), 0.f);
+      keys.emplace_back(static_cast<float>(key), AnimationValue(rotation));
+    }
+    auto animation = Animation::CreateAnimation("rotationQuaternion",
+                                                Animation::ANIMATIONTYPE_QUATERNION, 30);
+    animation->setKeys(keys);
+    animations.emplace_back(animation);
+  }
+
+  // One second of animation at 60 frames per second
+  const size_t nbFrames = 60;
+  std::vector<_IAnimationState> states(nbBones, _IAnimationState{});
+  for (auto& state : states) {
+    state.key         = 0;
+    state.repeatCount = 0;
+    state.loopMode    = Animation::ANIMATIONLOOPMODE_CYCLE;
+  }
+  float checksum         = 0.f;
+  const auto variantMs   = MeasureMs(1, [&]() {
+    for (size_t frame = 0; frame < nbFrames; ++frame) {
+      for (size_t bone = 0; bone < nbBones; ++bone) {
+        const auto value = animations[bone]->_interpolate(static_cast<float>(frame) * 0.5f,
+                                                          states[bone]);
+        checksum += value.get<Quaternion>().w;
+      }
+    }
+  });
+
+  std::vector<int> cursors(nbBones, 0);
+  std::array<float, AnimationTrack::MaxComponentCount> value{};
+  const auto sampleTracks = [&]() {
+    for (size_t frame = 0; frame < nbFrames; ++frame) {
+      for (size_t bone = 0; bone < nbBones; ++bone) {
+        animations[bone]->_getTrack()->sample(static_cast<float>(frame) * 0.5f, cursors[bone],
+                                              nullptr, value.data());
+        checksum += value[3];
+      }
+    }
+  };
+  const auto trackMs = MeasureMs(1, sampleTracks);
+
+  for (const auto& animation : animations) {
+    animation->bake(1.f);
+    animation->_getTrack();
+  }
+  const auto bakedMs = MeasureMs(1, sampleTracks);
+
+  EXPECT_TRUE(std::isfinite(checksum));
+
+  std::cout << "Sampling of " << nbBones << " quaternion animations of " << nbKeys
+            << " keys during " << nbFrames << " frames:" << std::endl;
+  std::cout << "\tAnimationValue interpolation: " << variantMs << " ms" << std::endl;
+  std::cout << "\tTyped tracks: " << trackMs << " ms" << std::endl;
+  std::cout << "\tBaked tracks: " << bakedMs << " ms" << std::endl;
+}
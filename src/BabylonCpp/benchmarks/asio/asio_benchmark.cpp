@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../benchmark_utils.h"
+
+#include <babylon/asio/asio.h>
+#include <babylon/babylon_common.h>
+
+namespace {
+
+const std::vector<std::string> benchmarkAssets = {
+  "textures/360photo.jpg",      "textures/amiga.jpg",    "textures/cannedJam.jpg",
+  "textures/earth.jpg",         "textures/fur.jpg",      "textures/glassbuilding.jpg",
+  "textures/environment.dds",   "textures/grass.jpg",    "textures/ground.jpg",
+  "textures/equirectangular.jpg", "textures/normalMap.jpg", "textures/playingCard.jpg",
+};
+
+struct LoadStats {
+  size_t nbSuccess   = 0;
+  size_t nbError     = 0;
+  size_t loadedBytes = 0;
+  double durationMs  = 0.;
+};
+
+LoadStats LoadConcurrently(size_t nbFiles, size_t nbWorkerThreads)
+{
+  BABYLON::asio::Service_SetNbWorkerThreads(nbWorkerThreads);
+
+  LoadStats stats;
+  auto onSuccess = [&stats](const BABYLON::ArrayBuffer& data) {
+    ++stats.nbSuccess;
+    stats.loadedBytes += data.size();
+  };
+  auto onError = [&stats](const std::string& /*message*/) { ++stats.nbError; };
+
+  stats.durationMs = BABYLON::MeasureMs(1, [&]() {
+    for (size_t i = 0; i < nbFiles; ++i) {
+      const auto& assetPath = benchmarkAssets[i % benchmarkAssets.size()];
+      BABYLON::asio::LoadAssetAsync_Binary(assetPath, onSuccess, onError);
+    }
+    while (BABYLON::asio::HasRemainingTasks())
+      BABYLON::asio::HeartBeat_Sync();
+  });
+  return stats;
+}
+
+} // end of anonymous namespace
+
+TEST(BenchmarkAsio, LoadAssetsConcurrently)
+{
+  const size_t nbFiles = 256;
+  for (size_t nbWorkerThreads : {1, 2, 4, 8}) {
+    auto stats = LoadConcurrently(nbFiles, nbWorkerThreads);
+    EXPECT_EQ(stats.nbSuccess + stats.nbError, nbFiles);
+
+    const double seconds = stats.durationMs / 1000.;
+    std::cout << "asio: " << nbFiles << " files with " << nbWorkerThreads
+              << " worker thread(s):" << std::endl;
+    std::cout << "\tDuration: " << stats.durationMs << " ms" << std::endl;
+    std::cout << "\tThroughput: " << stats.nbSuccess / seconds << " files/s, "
+              << stats.loadedBytes / (1024. * 1024.) / seconds << " MB/s" << std::endl;
+  }
+  BABYLON::asio::Service_Stop();
+}
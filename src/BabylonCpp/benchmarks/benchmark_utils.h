@@ -0,0 +1,34 @@
+#ifndef BABYLON_BENCHMARK_UTILS_H
+#define BABYLON_BENCHMARK_UTILS_H
+
+#include <chrono>
+#include <cstddef>
+
+namespace BABYLON {
+
+/**
+ * @brief Returns the average duration in milliseconds of a function.
+ * @param nbRuns number of timed runs of the function
+ * @param function function to measure
+ * @param warmUp whether the function is run once more before the timed runs
+ */
+template <typename Function>
+double MeasureMs(size_t nbRuns, Function&& function, bool warmUp = false)
+{
+  if (warmUp) {
+    function();
+  }
+
+  const auto start = std::chrono::high_resolution_clock::now();
+  for (size_t run = 0; run < nbRuns; ++run) {
+    function();
+  }
+  const auto end = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration<double, std::milli>(end - start).count()
+         / static_cast<double>(nbRuns);
+}
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_BENCHMARK_UTILS_H
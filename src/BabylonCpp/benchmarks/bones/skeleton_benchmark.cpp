@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <babylon/bones/bone.h>
+#include <babylon/bones/skeleton.h>
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/null_engine_options.h>
+#include <babylon/engines/scene.h>
+#include <babylon/instrumentation/scene_instrumentation.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/misc/job_pool.h>
+
+namespace {
+
+BABYLON::SkeletonPtr CreateSkeleton(const std::string& name, size_t nbBones, BABYLON::Scene* scene)
+{
+  using namespace BABYLON;
+
+  // Five limbs of chained bones attached to a root bone
+  auto skeleton = Skeleton::New(name, name, scene);
+  auto root     = Bone::New("root", skeleton.get(), nullptr, Matrix::Identity());
+  std::vector<Bone*> limbs(5, root.get());
+  for (size_t index = 1; index < nbBones; ++index) {
+    auto& parent = limbs[index % limbs.size()];
+    auto bone    = Bone::New("bone" + std::to_string(index), skeleton.get(), parent,
+                          Matrix::RotationYawPitchRoll(0.1f, 0.05f, 0.f)
+                            .multiply(Matrix::Translation(0.f, 0.2f, 0.f)));
+    parent       = bone.get();
+  }
+  return skeleton;
+}
+
+double MeasureSkeletonsEvaluationMs(BABYLON::Scene& scene,
+                                    const std::vector<BABYLON::SkeletonPtr>& skeletons,
+                                    size_t nbFrames, size_t& nbActiveBones)
+{
+  using namespace BABYLON;
+
+  SceneInstrumentation instrumentation(&scene);
+  instrumentation.captureSkeletonsEvaluationTime = true;
+
+  double totalMs = 0.0;
+  for (size_t frame = 0; frame < nbFrames; ++frame) {
+    // Invalidate the bone matrices
+    for (const auto& skeleton : skeletons) {
+      skeleton->bones.front()->markAsDirty();
+    }
+    scene.render();
+    totalMs += instrumentation.skeletonsEvaluationTimeCounter().current();
+  }
+  nbActiveBones = instrumentation.activeBonesCounter().current();
+
+  instrumentation.dispose();
+
+  return totalMs / static_cast<double>(nbFrames);
+}
+
+} // end of anonymous namespace
+
+TEST(BenchmarkBones, SkeletonsEvaluation)
+{
+  using namespace BABYLON;
+
+  NullEngineOptions options;
+  options.renderHeight = 256;
+  options.renderWidth  = 256;
+  options.textureSize  = 256;
+  auto engine          = NullEngine::New(options);
+  auto scene           = Scene::New(engine.get());
+  auto camera          = FreeCamera::New("camera", Vector3(0.f, 0.f, -150.f), scene.get());
+
+  // A crowd of characters with their own skeleton
+  const size_t nbCharacters = 1000, nbBones = 64;
+  std::vector<SkeletonPtr> skeletons;
+  std::vector<MeshPtr> meshes;
+  for (size_t index = 0; index < nbCharacters; ++index) {
+    const auto name = std::to_string(index);
+    skeletons.emplace_back(CreateSkeleton("skeleton" + name, nbBones, scene.get()));
+    auto box      = Mesh::CreateBox("box" + name, 0.5f, scene.get());
+    box->position = Vector3(static_cast<float>(index % 40) - 20.f,
+                            static_cast<float>(index / 40) - 12.f, 0.f);
+    box->skeleton = skeletons.back();
+    meshes.emplace_back(box);
+  }
+
+  // Character parts sharing a skeleton and a pose matrix compute the bone matrices once
+  auto sharedSkeleton                   = CreateSkeleton("shared", nbBones, scene.get());
+  sharedSkeleton->needInitialSkinMatrix = true;
+  for (size_t index = 0; index < 8; ++index) {
+    auto part      = Mesh::CreateBox("part" + std::to_string(index), 0.5f, scene.get());
+    part->skeleton = sharedSkeleton;
+    meshes.emplace_back(part);
+  }
+  skeletons.emplace_back(sharedSkeleton);
+
+  const size_t nbFrames = 20;
+  size_t nbActiveBones = 0, nbParallelActiveBones = 0;
+
+  scene->parallelSkeletonsEvaluation = false;
+  const auto serialMs = MeasureSkeletonsEvaluationMs(*scene, skeletons, nbFrames, nbActiveBones);
+  const auto serialMatrices = skeletons.front()->getTransformMatrices(meshes.front().get());
+
+  scene->parallelSkeletonsEvaluation = true;
+  const auto parallelMs
+    = MeasureSkeletonsEvaluationMs(*scene, skeletons, nbFrames, nbParallelActiveBones);
+
+  const auto& parallelMatrices = skeletons.front()->getTransformMatrices(meshes.front().get());
+  ASSERT_EQ(serialMatrices.size(), parallelMatrices.size());
+  for (size_t index = 0; index < serialMatrices.size(); ++index) {
+    EXPECT_NEAR(serialMatrices[index], parallelMatrices[index], 1e-4f);
+  }
+  EXPECT_EQ(nbActiveBones, nbParallelActiveBones);
+
+  std::cout << "Skeletons evaluation: " << skeletons.size() << " skeletons, " << nbActiveBones
+            << " active bones, " << JobPool::Default().concurrency() << " threads:" << std::endl;
+  std::cout << "\tSerial: " << serialMs << " ms/frame" << std::endl;
+  std::cout << "\tParallel: " << parallelMs << " ms/frame" << std::endl;
+  std::cout << "\tShared skeleton: " << sharedSkeleton->evaluationTimeCounter().current() << " us"
+            << std::endl;
+}
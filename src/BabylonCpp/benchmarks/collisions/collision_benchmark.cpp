@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../benchmark_utils.h"
+
+#include <babylon/collisions/collider.h>
+#include <babylon/collisions/icollision_coordinator.h>
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/null_engine_options.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/mesh.h>
+
+TEST(BenchmarkCollisions, CollisionCoordinator)
+{
+  using namespace BABYLON;
+
+  NullEngineOptions options;
+  options.renderHeight = 256;
+  options.renderWidth  = 256;
+  options.textureSize  = 256;
+  auto engine          = NullEngine::New(options);
+  auto scene           = Scene::New(engine.get());
+
+  // A dense level: a subdivided ground and 10k boxes on it
+  auto ground             = Mesh::CreateGround("ground", 200, 200, 128, scene.get());
+  ground->checkCollisions = true;
+  ground->computeWorldMatrix(true);
+  const auto gridSize = 100;
+  for (int x = 0; x < gridSize; ++x) {
+    for (int z = 0; z < gridSize; ++z) {
+      auto box = Mesh::CreateBox("box" + std::to_string(x * gridSize + z), 0.5f, scene.get());
+      box->position        = Vector3(static_cast<float>(x * 2 - gridSize), 0.25f,
+                                     static_cast<float>(z * 2 - gridSize));
+      box->checkCollisions = true;
+      box->computeWorldMatrix(true);
+    }
+  }
+
+  // Characters walking and falling across the level
+  auto& coordinator = scene->collisionCoordinator();
+  std::vector<ColliderMove> moves;
+  for (size_t i = 0; i < 500; ++i) {
+    ColliderMove move;
+    move.position          = Vector3(static_cast<float>(i % 25) * 7.f - 87.f, 1.2f,
+                                     static_cast<float>(i / 25) * 9.f - 85.f);
+    move.displacement      = Vector3(0.8f, -0.5f, 0.3f);
+    move.collider          = coordinator->createCollider();
+    move.collider->_radius = Vector3(0.5f, 1.f, 0.5f);
+    moves.emplace_back(move);
+  }
+
+  const auto moveOneByOne = [&]() {
+    for (auto& move : moves) {
+      auto position     = move.position;
+      auto displacement = move.displacement;
+      coordinator->getNewPosition(
+        position, displacement, move.collider, move.maximumRetry, nullptr,
+        [&move](size_t /*collisionIndex*/, Vector3& newPosition,
+                const AbstractMeshPtr& /*collidedMesh*/) { move.newPosition = newPosition; },
+        0);
+    }
+  };
+
+  scene->collisionsBroadphaseEnabled = false;
+  const auto bruteForceMs            = MeasureMs(1, moveOneByOne);
+  std::vector<Vector3> expected;
+  for (const auto& move : moves) {
+    expected.emplace_back(move.newPosition);
+  }
+
+  scene->collisionsBroadphaseEnabled = true;
+  const auto broadphaseMs            = MeasureMs(10, moveOneByOne);
+
+  const auto batchedMs = MeasureMs(10, [&]() { coordinator->getNewPositions(moves); });
+
+  size_t nbCollisions = 0;
+  for (size_t i = 0; i < moves.size(); ++i) {
+    EXPECT_FLOAT_EQ(moves[i].newPosition.y, expected[i].y);
+    nbCollisions += moves[i].collider->collidedMesh ? 1 : 0;
+  }
+
+  std::cout << "Collisions of " << moves.size() << " colliders with " << scene->meshes.size()
+            << " meshes, " << nbCollisions << " collisions:" << std::endl;
+  std::cout << "\tAll meshes and triangles: " << bruteForceMs << " ms" << std::endl;
+  std::cout << "\tBroadphase: " << broadphaseMs << " ms" << std::endl;
+  std::cout << "\tBatched: " << batchedMs << " ms" << std::endl;
+}
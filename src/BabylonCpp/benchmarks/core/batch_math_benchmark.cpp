@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <vector>
+
+#include "../benchmark_utils.h"
+
+#include <babylon/maths/batch_math.h>
+#include <babylon/maths/matrix.h>
+#include <babylon/maths/quaternion.h>
+#include <babylon/maths/vector3.h>
+
+namespace {
+
+// Nanoseconds per element
+double MeasureNs(size_t count, size_t nbRuns, const std::function<void()>& run)
+{
+  return BABYLON::MeasureMs(nbRuns, run, true) * 1e6 / static_cast<double>(count);
+}
+
+} // end of anonymous namespace
+
+TEST(BenchmarkCore, BatchMath)
+{
+  using namespace BABYLON;
+
+  const size_t nbMatrices = 10000, nbPoints = 1000000, nbRuns = 20;
+
+  // Matrices
+  std::vector<Matrix> matrixObjects;
+  std::vector<float> scalings, rotations, translations;
+  for (size_t index = 0; index < nbMatrices; ++index) {
+    const auto v        = static_cast<float>(index) * 0.001f;
+    const auto rotation = Quaternion::RotationYawPitchRoll(v, 0.5f * v, 0.f);
+    matrixObjects.emplace_back(
+      Matrix::Compose(Vector3(1.f + v, 1.f, 1.f - v), rotation, Vector3(v, -v, 0.f)));
+    for (const auto value : {1.f + v, 1.f, 1.f - v}) {
+      scalings.emplace_back(value);
+    }
+    for (const auto value : {rotation.x, rotation.y, rotation.z, rotation.w}) {
+      rotations.emplace_back(value);
+    }
+    for (const auto value : {v, -v, 0.f}) {
+      translations.emplace_back(value);
+    }
+  }
+  std::vector<float> matrices(nbMatrices * 16), results(nbMatrices * 16);
+  BatchMath::ComposeMatrices(scalings.data(), rotations.data(), translations.data(),
+                             matrices.data(), nbMatrices);
+  auto eye = Vector3(0.f, 5.f, -10.f), target = Vector3::Zero(), up = Vector3::Up();
+  const auto viewProjection = Matrix::LookAtLH(eye, target, up).multiply(
+    Matrix::PerspectiveFovLH(0.8f, 1.f, 0.1f, 100.f));
+
+  // Points and bounding boxes
+  std::vector<float> points(nbPoints * 3), pointResults(nbPoints * 3);
+  for (size_t index = 0; index < points.size(); ++index) {
+    points[index] = std::sin(static_cast<float>(index));
+  }
+  std::vector<float> boxes, boxResults(nbMatrices * 6);
+  for (size_t index = 0; index < nbMatrices; ++index) {
+    for (const auto value : {-1.f, -1.f, -1.f, 1.f, 1.f, 1.f}) {
+      boxes.emplace_back(value);
+    }
+  }
+
+  std::cout << "Batch math (ns/element):" << std::endl;
+
+  // Reference: one Matrix or Vector3 at a time
+  {
+    std::vector<Matrix> products(nbMatrices);
+    const auto multiplyNs = MeasureNs(nbMatrices, nbRuns, [&]() {
+      for (size_t index = 0; index < nbMatrices; ++index) {
+        matrixObjects[index].multiplyToRef(viewProjection, products[index]);
+      }
+    });
+    auto transformed       = Vector3::Zero();
+    const auto transformNs = MeasureNs(nbPoints, nbRuns, [&]() {
+      for (size_t index = 0; index < nbPoints * 3; index += 3) {
+        Vector3::TransformCoordinatesFromFloatsToRef(points[index], points[index + 1],
+                                                     points[index + 2], viewProjection,
+                                                     transformed);
+        transformed.toArray(pointResults, static_cast<unsigned int>(index));
+      }
+    });
+    const auto invertNs = MeasureNs(nbMatrices, nbRuns, [&]() {
+      for (size_t index = 0; index < nbMatrices; ++index) {
+        matrixObjects[index].invertToRef(products[index]);
+      }
+    });
+    std::cout << "\tMatrix/Vector3: multiply " << multiplyNs << ", transform points "
+              << transformNs << ", invert " << invertNs << std::endl;
+  }
+
+  const auto defaultBackend = BatchMath::Backend();
+  for (const auto backend : {BatchMathBackend::Scalar, BatchMathBackend::SSE,
+                             BatchMathBackend::AVX2, BatchMathBackend::NEON}) {
+    if (!BatchMath::SetBackend(backend)) {
+      continue;
+    }
+    const auto multiplyNs = MeasureNs(nbMatrices, nbRuns, [&]() {
+      BatchMath::MultiplyMatricesByMatrix(matrices.data(), viewProjection.m().data(),
+                                          results.data(), nbMatrices);
+    });
+    const auto transformNs = MeasureNs(nbPoints, nbRuns, [&]() {
+      BatchMath::TransformCoordinates(points.data(), viewProjection.m().data(),
+                                      pointResults.data(), nbPoints);
+    });
+    const auto normalsNs = MeasureNs(nbPoints, nbRuns, [&]() {
+      BatchMath::TransformNormals(points.data(), viewProjection.m().data(), pointResults.data(),
+                                  nbPoints);
+    });
+    const auto composeNs = MeasureNs(nbMatrices, nbRuns, [&]() {
+      BatchMath::ComposeMatrices(scalings.data(), rotations.data(), translations.data(),
+                                 results.data(), nbMatrices);
+    });
+    const auto invertNs = MeasureNs(nbMatrices, nbRuns, [&]() {
+      BatchMath::InvertAffineMatrices(matrices.data(), results.data(), nbMatrices);
+    });
+    const auto boxesNs = MeasureNs(nbMatrices, nbRuns, [&]() {
+      BatchMath::TransformBoundingBoxes(boxes.data(), matrices.data(), boxResults.data(),
+                                        nbMatrices);
+    });
+    std::cout << "\t" << BatchMath::BackendName(backend) << ": multiply " << multiplyNs
+              << ", transform points " << transformNs << ", transform normals " << normalsNs
+              << ", compose " << composeNs << ", invert affine " << invertNs
+              << ", transform boxes " << boxesNs << std::endl;
+  }
+  BatchMath::SetBackend(defaultBackend);
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include <iostream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "../benchmark_utils.h"
+
+#include <babylon/cameras/free_camera.h>
+#include <babylon/culling/octrees/octree.h>
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/null_engine_options.h>
+#include <babylon/engines/scene.h>
+#include <babylon/maths/frustum.h>
+#include <babylon/meshes/mesh.h>
+
+TEST(BenchmarkCulling, OctreeSelection)
+{
+  using namespace BABYLON;
+
+  NullEngineOptions options;
+  options.renderHeight = 256;
+  options.renderWidth  = 256;
+  options.textureSize  = 256;
+  auto engine          = NullEngine::New(options);
+  auto scene           = Scene::New(engine.get());
+  auto camera          = FreeCamera::New("camera", Vector3(0.f, 0.f, -80.f), scene.get());
+  camera->setTarget(Vector3::Zero());
+
+  // A static world of 50k boxes
+  const size_t gridSize = 50, gridDepth = 20;
+  std::vector<MeshPtr> meshes;
+  meshes.reserve(gridSize * gridSize * gridDepth);
+  for (size_t x = 0; x < gridSize; ++x) {
+    for (size_t y = 0; y < gridSize; ++y) {
+      for (size_t z = 0; z < gridDepth; ++z) {
+        auto box = Mesh::CreateBox("box" + std::to_string(meshes.size()), 0.5f, scene.get());
+        box->position = Vector3(static_cast<float>(x) * 2.f - static_cast<float>(gridSize),
+                                static_cast<float>(y) * 2.f - static_cast<float>(gridSize),
+                                static_cast<float>(z) * 2.f);
+        box->computeWorldMatrix(true);
+        meshes.emplace_back(box);
+      }
+    }
+  }
+
+  const auto rebuildMs = MeasureMs(1, [&]() { scene->createOrUpdateSelectionOctree(64, 4); });
+  auto octree          = scene->selectionOctree();
+
+  const auto frustumPlanes
+    = Frustum::GetPlanes(camera->getViewMatrix().multiply(camera->getProjectionMatrix()));
+
+  const size_t nbSelections = 100;
+  size_t nbSelected = 0, nbSelectedWithDuplicates = 0;
+  const auto selectMs = MeasureMs(nbSelections, [&]() {
+    nbSelected = octree->select(frustumPlanes, false).size();
+  });
+  const auto selectWithDuplicatesMs = MeasureMs(nbSelections, [&]() {
+    nbSelectedWithDuplicates = octree->select(frustumPlanes, true).size();
+  });
+
+  const auto& selection = octree->select(frustumPlanes, false);
+  const std::unordered_set<AbstractMesh*> uniqueSelection(selection.begin(), selection.end());
+  EXPECT_EQ(uniqueSelection.size(), nbSelected);
+  EXPECT_LE(nbSelected, nbSelectedWithDuplicates);
+
+  // Moving meshes are reinserted one by one
+  const size_t nbMovingMeshes = 1000;
+  const auto updateMs         = MeasureMs(1, [&]() {
+    for (size_t i = 0; i < nbMovingMeshes; ++i) {
+      AbstractMesh* mesh = meshes[i * 7].get();
+      mesh->position().x += 1.f;
+      mesh->computeWorldMatrix(true);
+      octree->updateMesh(mesh);
+    }
+  });
+
+  std::cout << "Octree of " << meshes.size() << " meshes:" << std::endl;
+  std::cout << "\tBuild: " << rebuildMs << " ms" << std::endl;
+  std::cout << "\tFrustum selection: " << selectMs << " ms, " << nbSelected << " meshes"
+            << std::endl;
+  std::cout << "\tFrustum selection with duplicates: " << selectWithDuplicatesMs << " ms, "
+            << nbSelectedWithDuplicates << " meshes" << std::endl;
+  std::cout << "\tIncremental update of " << nbMovingMeshes << " meshes: " << updateMs << " ms"
+            << std::endl;
+}
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../benchmark_utils.h"
+
+#include <babylon/collisions/picking_info.h>
+#include <babylon/culling/ray.h>
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/null_engine_options.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/mesh.h>
+
+TEST(BenchmarkCulling, PickingBVH)
+{
+  using namespace BABYLON;
+
+  NullEngineOptions options;
+  options.renderHeight = 256;
+  options.renderWidth  = 256;
+  options.textureSize  = 256;
+  auto engine          = NullEngine::New(options);
+  auto scene           = Scene::New(engine.get());
+
+  // A static world of 30k boxes and a few high poly spheres
+  const size_t gridSize = 50, gridDepth = 12;
+  std::vector<MeshPtr> meshes;
+  meshes.reserve(gridSize * gridSize * gridDepth);
+  for (size_t x = 0; x < gridSize; ++x) {
+    for (size_t y = 0; y < gridSize; ++y) {
+      for (size_t z = 0; z < gridDepth; ++z) {
+        auto box = Mesh::CreateBox("box" + std::to_string(meshes.size()), 0.5f, scene.get());
+        box->position = Vector3(static_cast<float>(x) * 2.f - static_cast<float>(gridSize),
+                                static_cast<float>(y) * 2.f - static_cast<float>(gridSize),
+                                static_cast<float>(z) * 2.f);
+        box->computeWorldMatrix(true);
+        meshes.emplace_back(box);
+      }
+    }
+  }
+  for (size_t i = 0; i < 8; ++i) {
+    auto sphere      = Mesh::CreateSphere("sphere" + std::to_string(i), 128, 6.f, scene.get());
+    sphere->position = Vector3(static_cast<float>(i) * 10.f - 40.f, 1.f, -10.f);
+    sphere->computeWorldMatrix(true);
+  }
+
+  // Rays from the front of the world, in a fan
+  std::vector<Ray> rays;
+  for (size_t x = 0; x < 32; ++x) {
+    for (size_t y = 0; y < 32; ++y) {
+      const auto direction = Vector3(static_cast<float>(x) * 0.05f - 0.8f,
+                                     static_cast<float>(y) * 0.05f - 0.8f, 1.f);
+      rays.emplace_back(Ray(Vector3(0.f, 0.f, -30.f), direction.normalizeToNew()));
+    }
+  }
+
+  scene->pickingBVHEnabled = false;
+  std::vector<std::optional<PickingInfo>> expected;
+  const auto linearMs = MeasureMs(1, [&]() { expected = scene->pickBatch(rays); });
+
+  scene->pickingBVHEnabled = true;
+  const auto buildMs       = MeasureMs(1, [&]() { scene->pickWithRay(rays.front()); });
+  std::vector<std::optional<PickingInfo>> results;
+  const auto bvhMs = MeasureMs(10, [&]() { results = scene->pickBatch(rays); });
+
+  size_t nbHits = 0;
+  for (size_t i = 0; i < rays.size(); ++i) {
+    EXPECT_EQ(results[i]->pickedMesh, expected[i]->pickedMesh);
+    nbHits += results[i]->hit ? 1 : 0;
+  }
+
+  // Moving meshes are refitted at the next pick
+  const size_t nbMovingMeshes = 1000;
+  const auto refitMs          = MeasureMs(1, [&]() {
+    for (size_t i = 0; i < nbMovingMeshes; ++i) {
+      auto& mesh = meshes[i * 7];
+      mesh->position().x += 1.f;
+      mesh->computeWorldMatrix(true);
+    }
+    scene->pickWithRay(rays.front());
+  });
+
+  std::cout << "Picking of " << rays.size() << " rays in " << scene->meshes.size()
+            << " meshes, " << nbHits << " hits:" << std::endl;
+  std::cout << "\tWithout BVH: " << linearMs << " ms" << std::endl;
+  std::cout << "\tBVH build: " << buildMs << " ms" << std::endl;
+  std::cout << "\tWith BVH: " << bvhMs << " ms" << std::endl;
+  std::cout << "\tRefit of " << nbMovingMeshes << " meshes: " << refitMs << " ms" << std::endl;
+}
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/null_engine_options.h>
+#include <babylon/engines/scene.h>
+#include <babylon/instrumentation/scene_instrumentation.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/misc/job_pool.h>
+
+namespace {
+
+double MeasureActiveMeshesEvaluationMs(BABYLON::Scene& scene,
+                                       const std::vector<BABYLON::MeshPtr>& meshes,
+                                       size_t nbFrames, size_t& nbActiveMeshes)
+{
+  using namespace BABYLON;
+
+  SceneInstrumentation instrumentation(&scene);
+  instrumentation.captureActiveMeshesEvaluationTime = true;
+
+  double totalMs = 0.0;
+  for (size_t frame = 0; frame < nbFrames; ++frame) {
+    // Invalidate the world matrices
+    for (const auto& mesh : meshes) {
+      mesh->rotation().y += 0.01f;
+    }
+    scene.render();
+    totalMs += instrumentation.activeMeshesEvaluationTimeCounter().current();
+  }
+  nbActiveMeshes = scene.getActiveMeshes().size();
+
+  instrumentation.dispose();
+
+  return totalMs / static_cast<double>(nbFrames);
+}
+
+} // end of anonymous namespace
+
+TEST(BenchmarkEngines, ActiveMeshesEvaluation)
+{
+  using namespace BABYLON;
+
+  NullEngineOptions options;
+  options.renderHeight = 256;
+  options.renderWidth  = 256;
+  options.textureSize  = 256;
+  auto engine          = NullEngine::New(options);
+  auto scene           = Scene::New(engine.get());
+  auto camera          = FreeCamera::New("camera", Vector3(0.f, 0.f, -150.f), scene.get());
+
+  // A grid of boxes, about half of them outside of the camera frustum
+  const size_t gridSize = 150;
+  std::vector<MeshPtr> meshes;
+  meshes.reserve(gridSize * gridSize);
+  for (size_t x = 0; x < gridSize; ++x) {
+    for (size_t y = 0; y < gridSize; ++y) {
+      auto box = Mesh::CreateBox("box" + std::to_string(meshes.size()), 0.5f, scene.get());
+      box->position = Vector3(static_cast<float>(x) - static_cast<float>(gridSize) / 2.f,
+                              static_cast<float>(y) - static_cast<float>(gridSize) / 2.f, 0.f);
+      meshes.emplace_back(box);
+    }
+  }
+
+  const size_t nbFrames = 20;
+  size_t nbActiveMeshes = 0, nbParallelActiveMeshes = 0;
+
+  scene->parallelActiveMeshesEvaluation = false;
+  const auto serialMs = MeasureActiveMeshesEvaluationMs(*scene, meshes, nbFrames, nbActiveMeshes);
+
+  scene->parallelActiveMeshesEvaluation = true;
+  const auto parallelMs
+    = MeasureActiveMeshesEvaluationMs(*scene, meshes, nbFrames, nbParallelActiveMeshes);
+
+  EXPECT_EQ(nbActiveMeshes, nbParallelActiveMeshes);
+
+  std::cout << "Active meshes evaluation: " << meshes.size() << " meshes, " << nbActiveMeshes
+            << " active, " << JobPool::Default().concurrency() << " threads:" << std::endl;
+  std::cout << "\tSerial: " << serialMs << " ms/frame" << std::endl;
+  std::cout << "\tParallel: " << parallelMs << " ms/frame" << std::endl;
+}
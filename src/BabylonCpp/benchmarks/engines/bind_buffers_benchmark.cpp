@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../benchmark_utils.h"
+
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/null_engine_options.h>
+#include <babylon/materials/effect.h>
+#include <babylon/materials/ieffect_creation_options.h>
+#include <babylon/meshes/vertex_buffer.h>
+
+namespace {
+
+using VertexBuffersMap = std::unordered_map<std::string, BABYLON::VertexBufferPtr>;
+
+const std::vector<std::string> benchmarkKinds = {
+  BABYLON::VertexBuffer::PositionKind,        BABYLON::VertexBuffer::NormalKind,
+  BABYLON::VertexBuffer::UVKind,              BABYLON::VertexBuffer::TangentKind,
+  BABYLON::VertexBuffer::ColorKind,           BABYLON::VertexBuffer::MatricesIndicesKind,
+  BABYLON::VertexBuffer::MatricesWeightsKind,
+};
+
+struct BenchmarkMesh {
+  VertexBuffersMap vertexBuffers;
+  std::vector<BABYLON::VertexBufferPtr> vertexBuffersBySlot;
+  BABYLON::EffectPtr effect;
+};
+
+/**
+ * @brief Binding cache check performed by ThinEngine::bindBuffers before kind slots were
+ * introduced: the whole vertex buffers map is compared and copied on every change.
+ */
+struct MapComparisonCache {
+  VertexBuffersMap cachedVertexBuffersMap;
+  BABYLON::EffectPtr cachedEffect = nullptr;
+
+  bool bind(const VertexBuffersMap& vertexBuffers, const BABYLON::EffectPtr& effect)
+  {
+    if (cachedVertexBuffersMap != vertexBuffers || cachedEffect != effect) {
+      cachedVertexBuffersMap = vertexBuffers;
+      cachedEffect           = effect;
+      return true;
+    }
+    return false;
+  }
+};
+
+std::vector<BenchmarkMesh> CreateMeshes(BABYLON::Engine* engine, size_t nbMeshes,
+                                        size_t nbEffects)
+{
+  using namespace BABYLON;
+
+  std::vector<EffectPtr> effects;
+  for (size_t i = 0; i < nbEffects; ++i) {
+    IEffectCreationOptions options;
+    options.attributes = benchmarkKinds;
+    options.defines    = "#define EFFECT" + std::to_string(i);
+    effects.emplace_back(engine->createEffect(
+      std::unordered_map<std::string, std::string>{{"vertexSource", "void main(void) {}"},
+                                                   {"fragmentSource", "void main(void) {}"}},
+      options, engine));
+  }
+
+  std::vector<BenchmarkMesh> meshes(nbMeshes);
+  for (size_t i = 0; i < nbMeshes; ++i) {
+    auto& mesh = meshes[i];
+    for (const auto& kind : benchmarkKinds) {
+      auto vertexBuffer = std::make_shared<VertexBuffer>(
+        engine, Float32Array(4 * 3, 0.f), kind, false, std::nullopt, 4);
+      mesh.vertexBuffers[kind] = vertexBuffer;
+      const auto slot          = vertexBuffer->getKindSlot();
+      if (slot >= mesh.vertexBuffersBySlot.size()) {
+        mesh.vertexBuffersBySlot.resize(slot + 1);
+      }
+      mesh.vertexBuffersBySlot[slot] = vertexBuffer;
+    }
+    mesh.effect = effects[i % effects.size()];
+  }
+
+  return meshes;
+}
+
+template <typename DrawFunction>
+double MeasureNsPerDraw(const std::vector<BenchmarkMesh>& meshes, size_t nbFrames,
+                        size_t nbDrawsPerMesh, const DrawFunction& draw)
+{
+  const auto drawFrame = [&meshes, nbDrawsPerMesh, &draw]() {
+    for (const auto& mesh : meshes) {
+      for (size_t i = 0; i < nbDrawsPerMesh; ++i) {
+        draw(mesh);
+      }
+    }
+  };
+
+  const auto nbDrawsPerFrame = static_cast<double>(meshes.size() * nbDrawsPerMesh);
+  return BABYLON::MeasureMs(nbFrames, drawFrame) * 1e6 / nbDrawsPerFrame;
+}
+
+} // end of anonymous namespace
+
+TEST(BenchmarkEngines, BindBuffers)
+{
+  using namespace BABYLON;
+
+  NullEngineOptions options;
+  options.renderHeight = 256;
+  options.renderWidth  = 256;
+  options.textureSize  = 256;
+  auto engine          = NullEngine::New(options);
+
+  const size_t nbMeshes = 1024;
+  const size_t nbFrames = 100;
+  auto meshes           = CreateMeshes(engine.get(), nbMeshes, 8);
+
+  // 1 draw per mesh: every draw changes the binding, 4 draws per mesh: sub-meshes hit the cache
+  for (size_t nbDrawsPerMesh : {1, 4}) {
+    MapComparisonCache mapComparisonCache;
+    size_t nbMapComparisonBinds = 0;
+    const auto mapComparisonNs
+      = MeasureNsPerDraw(meshes, nbFrames, nbDrawsPerMesh, [&](const BenchmarkMesh& mesh) {
+          nbMapComparisonBinds += mapComparisonCache.bind(mesh.vertexBuffers, mesh.effect);
+        });
+
+    const auto mapNs
+      = MeasureNsPerDraw(meshes, nbFrames, nbDrawsPerMesh, [&](const BenchmarkMesh& mesh) {
+          engine->bindBuffers(mesh.vertexBuffers, nullptr, mesh.effect);
+        });
+
+    const auto slotsNs
+      = MeasureNsPerDraw(meshes, nbFrames, nbDrawsPerMesh, [&](const BenchmarkMesh& mesh) {
+          engine->bindBuffers(mesh.vertexBuffersBySlot, nullptr, mesh.effect);
+        });
+
+    EXPECT_EQ(nbMapComparisonBinds, nbFrames * nbMeshes);
+
+    std::cout << "bindBuffers: " << nbMeshes << " meshes, " << nbDrawsPerMesh
+              << " draw(s) per mesh:" << std::endl;
+    std::cout << "\tMap comparison (previous cache): " << mapComparisonNs << " ns/draw"
+              << std::endl;
+    std::cout << "\tMap lookup + pointer comparison: " << mapNs << " ns/draw" << std::endl;
+    std::cout << "\tKind slots + pointer comparison: " << slotsNs << " ns/draw" << std::endl;
+  }
+}
@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <random>
+
+#include "../benchmark_utils.h"
+
+#include <babylon/rendering/render_queue.h>
+
+namespace {
+
+struct Item {
+  size_t effectId;
+  size_t materialId;
+  size_t geometryId;
+  float depth;
+};
+
+} // end of anonymous namespace
+
+TEST(BenchmarkEngines, RenderQueue)
+{
+  using namespace BABYLON;
+
+  // 100k submeshes sharing 50 effects, 400 materials and 2000 geometries
+  const size_t nbSubMeshes = 100000;
+  const size_t nbRuns      = 20;
+  std::mt19937 generator(7);
+  std::vector<Item> items(nbSubMeshes);
+  std::vector<int> storage(nbSubMeshes);
+  for (auto& item : items) {
+    item = {generator() % 50, generator() % 400, generator() % 2000,
+            std::uniform_real_distribution<float>(0.f, 1.f)(generator)};
+  }
+
+  // Comparator based sort, as done by RenderingGroup::renderSorted
+  const std::function<bool(const Item*, const Item*)> compareFn
+    = [](const Item* a, const Item* b) { return a->depth < b->depth; };
+  std::vector<const Item*> sorted(nbSubMeshes);
+  const auto comparatorSort = [&]() {
+    for (size_t i = 0; i < nbSubMeshes; ++i) {
+      sorted[i] = &items[i];
+    }
+    std::stable_sort(sorted.begin(), sorted.end(), compareFn);
+  };
+  const auto comparatorMs = MeasureMs(nbRuns, comparatorSort, true);
+
+  RenderQueue queue;
+  const auto radixSort = [&]() {
+    queue.clear();
+    for (size_t i = 0; i < nbSubMeshes; ++i) {
+      const auto& item = items[i];
+      queue.add(RenderQueue::OpaqueSortKey(0, item.effectId, item.materialId, item.geometryId,
+                                           item.depth),
+                reinterpret_cast<SubMesh*>(&storage[i]));
+    }
+    queue.sort();
+  };
+  const auto radixMs = MeasureMs(nbRuns, radixSort, true);
+
+  std::vector<uint64_t> unsortedKeys;
+  for (const auto& item : items) {
+    unsortedKeys.emplace_back(RenderQueue::OpaqueSortKey(0, item.effectId, item.materialId,
+                                                         item.geometryId, item.depth));
+  }
+
+  std::cout << "Render queue: " << nbSubMeshes << " submeshes:" << std::endl;
+  std::cout << "\tComparator sort: " << comparatorMs << " ms" << std::endl;
+  std::cout << "\tSort key radix sort: " << radixMs << " ms" << std::endl;
+  std::cout << "\tState changes: "
+            << RenderQueue::CountStateChanges(unsortedKeys.data(), unsortedKeys.size())
+            << " unsorted, " << RenderQueue::CountStateChanges(queue.keys().data(), queue.size())
+            << " sorted" << std::endl;
+}
@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../benchmark_utils.h"
+
+#include <babylon/engines/processors/processing_options.h>
+#include <babylon/engines/processors/shader_processor.h>
+#include <babylon/engines/webgl/webgl2_shader_processor.h>
+#include <babylon/materials/effect_includes_shaders_store.h>
+#include <babylon/materials/effect_shaders_store.h>
+#include <babylon/misc/string_tools.h>
+
+TEST(BenchmarkEngines, ShaderProcessorStartup)
+{
+  using namespace BABYLON;
+
+  // Defines and index parameters of a lit, skinned and morphed material
+  ProcessingOptions options;
+  options.defines = {"#define NORMAL",      "#define UV1",
+                     "#define DIFFUSE",     "#define LIGHT0",
+                     "#define POINTLIGHT0", "#define SHADOW0",
+                     "#define FOG",         "#define INSTANCES",
+                     "#define BONES",       "#define NUM_BONE_INFLUENCERS 4",
+                     "#define MORPHTARGETS", "#define NUM_MORPH_INFLUENCERS 2"};
+  options.indexParameters = {
+    {"maxSimultaneousLights", 4},
+    {"maxSimultaneousMorphTargets", 2},
+    {"varyingCount", 3},
+    {"depCount", 2},
+  };
+  options.processor            = std::make_shared<WebGL2ShaderProcessor>();
+  options.includesShadersStore = EffectIncludesShadersStore().shaders();
+  options.version              = "200";
+  options.platformName         = "WEBGL2";
+
+  const auto& shaders = EffectShadersStore().shaders();
+  size_t nbShaders = 0, nbProcessedShaders = 0;
+  const auto processAll = [&]() {
+    for (const auto& [name, sourceCode] : shaders) {
+      options.isFragment = StringTools::endsWith(name, "PixelShader");
+      ShaderProcessor::Process(sourceCode, options, [&](const std::string& processedCode) {
+        nbProcessedShaders += processedCode.empty() ? 0 : 1;
+      });
+      ++nbShaders;
+    }
+  };
+
+  // Cold start, every shader is preprocessed
+  ShaderProcessor::ClearCache();
+  const auto coldMs = MeasureMs(1, processAll);
+  EXPECT_EQ(ShaderProcessor::CacheSize(), shaders.size());
+
+  // Effects recompiled with the same defines are served from the cache
+  const auto cachedMs = MeasureMs(1, processAll);
+  EXPECT_EQ(ShaderProcessor::CacheSize(), shaders.size());
+  EXPECT_EQ(nbProcessedShaders, nbShaders);
+
+  ShaderProcessor::ClearCache();
+
+  std::cout << "Preprocessing of " << shaders.size() << " shaders:" << std::endl;
+  std::cout << "\tCold: " << coldMs << " ms" << std::endl;
+  std::cout << "\tCached: " << cachedMs << " ms" << std::endl;
+}
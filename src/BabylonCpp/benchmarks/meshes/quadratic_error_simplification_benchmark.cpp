@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "../benchmark_utils.h"
+
+#include <babylon/asio/asio.h>
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/null_engine_options.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/mesh_lod_level.h>
+#include <babylon/meshes/simplification/simplification_queue.h>
+
+namespace {
+
+double MeasureSimplificationSeconds(BABYLON::Scene& scene, BABYLON::Mesh& mesh,
+                                    const std::vector<BABYLON::ISimplificationSettings>& settings,
+                                    bool parallelProcessing)
+{
+  using namespace BABYLON;
+
+  const auto simplify = [&]() {
+    auto done = false;
+    mesh.simplify(settings, parallelProcessing, SimplificationType::QUADRATIC,
+                  [&done]() { done = true; });
+    scene.simplificationQueue()->executeNext();
+    // The levels of detail are added to the mesh by the main thread callbacks
+    while (!done) {
+      asio::HeartBeat_Sync();
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  };
+  return MeasureMs(1, simplify) / 1000.;
+}
+
+} // end of anonymous namespace
+
+TEST(BenchmarkMeshes, QuadraticErrorSimplification)
+{
+  using namespace BABYLON;
+
+  NullEngineOptions options;
+  options.renderHeight = 256;
+  options.renderWidth  = 256;
+  options.textureSize  = 256;
+  auto engine          = NullEngine::New(options);
+  auto scene           = Scene::New(engine.get());
+
+  // About 2 million triangles
+  auto sphere            = Mesh::CreateSphere("sphere", 720, 10.f, scene.get());
+  const auto nbTriangles = static_cast<double>(sphere->getTotalIndices() / 3);
+
+  // Single level of detail
+  const auto singleSeconds = MeasureSimplificationSeconds(*scene, *sphere, {{0.5f, 10.f, false}},
+                                                          false);
+  ASSERT_EQ(sphere->getLODLevels().size(), 1u);
+
+  // Three levels of detail, one after the other and in parallel
+  const std::vector<ISimplificationSettings> sequentialSettings{
+    {0.5f, 20.f, false}, {0.25f, 30.f, false}, {0.1f, 40.f, false}};
+  const std::vector<ISimplificationSettings> parallelSettings{
+    {0.5f, 50.f, false}, {0.25f, 60.f, false}, {0.1f, 70.f, false}};
+  const auto sequentialSeconds
+    = MeasureSimplificationSeconds(*scene, *sphere, sequentialSettings, false);
+  const auto parallelSeconds = MeasureSimplificationSeconds(*scene, *sphere, parallelSettings, true);
+  ASSERT_EQ(sphere->getLODLevels().size(), 7u);
+
+  // The levels of detail are decimated
+  for (const auto& level : sphere->getLODLevels()) {
+    ASSERT_TRUE(level->mesh);
+    EXPECT_LT(static_cast<double>(level->mesh->getTotalIndices() / 3), nbTriangles * 0.6);
+  }
+
+  std::cout << "Quadratic error simplification of " << nbTriangles << " triangles:" << std::endl;
+  std::cout << "\tSingle level: " << nbTriangles / singleSeconds << " triangles/s" << std::endl;
+  std::cout << "\tThree levels, sequential: " << 3.0 * nbTriangles / sequentialSeconds
+            << " triangles/s" << std::endl;
+  std::cout << "\tThree levels, parallel: " << 3.0 * nbTriangles / parallelSeconds
+            << " triangles/s" << std::endl;
+}
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <functional>
+#include <iostream>
+
+#include "../benchmark_utils.h"
+
+#include <babylon/maths/matrix.h>
+#include <babylon/maths/vector3.h>
+#include <babylon/meshes/software_skinning.h>
+#include <babylon/misc/job_pool.h>
+
+namespace {
+
+double MeasureVerticesPerSecond(size_t nbVertices, size_t nbRuns, const std::function<void()>& run)
+{
+  return static_cast<double>(nbVertices) * 1000.0 / BABYLON::MeasureMs(nbRuns, run, true);
+}
+
+} // end of anonymous namespace
+
+TEST(BenchmarkMeshes, SoftwareSkinning)
+{
+  using namespace BABYLON;
+
+  const size_t nbVertices = 1000000, nbBones = 64, nbTargets = 4, nbRuns = 5;
+
+  Float32Array boneMatrices;
+  for (size_t bone = 0; bone < nbBones; ++bone) {
+    const auto angle  = static_cast<float>(bone) * 0.1f;
+    const auto matrix = Matrix::RotationYawPitchRoll(angle, angle, 0.f)
+                          .multiply(Matrix::Translation(0.f, angle, 0.f));
+    for (const auto value : matrix.m()) {
+      boneMatrices.emplace_back(value);
+    }
+  }
+
+  Float32Array sourcePositions(nbVertices * 3), sourceNormals(nbVertices * 3);
+  Float32Array indices(nbVertices * 4), weights(nbVertices * 4);
+  Float32Array indicesExtra(nbVertices * 4), weightsExtra(nbVertices * 4);
+  for (size_t index = 0; index < nbVertices * 3; ++index) {
+    sourcePositions[index] = std::sin(static_cast<float>(index));
+    sourceNormals[index]   = std::cos(static_cast<float>(index));
+  }
+  for (size_t index = 0; index < nbVertices * 4; ++index) {
+    indices[index]      = static_cast<float>(index % nbBones);
+    weights[index]      = 0.125f;
+    indicesExtra[index] = static_cast<float>((index * 7) % nbBones);
+    weightsExtra[index] = 0.125f;
+  }
+
+  Float32Array positions(nbVertices * 3), normals(nbVertices * 3);
+  SkinnedVertexData data;
+  data.vertexCount     = nbVertices;
+  data.sourcePositions = sourcePositions.data();
+  data.sourceNormals   = sourceNormals.data();
+  data.positions       = positions.data();
+  data.normals         = normals.data();
+
+  // Per vertex Matrix and Vector3 temporaries, as Mesh::applySkeleton used to do
+  const auto matrixSkinning = [&]() {
+    auto tempVector3 = Vector3::Zero();
+    Matrix finalMatrix;
+    Matrix tempMatrix;
+    for (size_t vertex = 0; vertex < nbVertices; ++vertex) {
+      finalMatrix.reset();
+      for (size_t inf = 0; inf < 4; ++inf) {
+        Matrix::FromFloat32ArrayToRefScaled(
+          boneMatrices, static_cast<unsigned int>(indices[vertex * 4 + inf] * 16),
+          weights[vertex * 4 + inf], tempMatrix);
+        finalMatrix.addToSelf(tempMatrix);
+      }
+      Vector3::TransformCoordinatesFromFloatsToRef(
+        sourcePositions[vertex * 3], sourcePositions[vertex * 3 + 1],
+        sourcePositions[vertex * 3 + 2], finalMatrix, tempVector3);
+      tempVector3.toArray(positions, static_cast<unsigned int>(vertex * 3));
+      Vector3::TransformNormalFromFloatsToRef(sourceNormals[vertex * 3],
+                                              sourceNormals[vertex * 3 + 1],
+                                              sourceNormals[vertex * 3 + 2], finalMatrix,
+                                              tempVector3);
+      tempVector3.toArray(normals, static_cast<unsigned int>(vertex * 3));
+    }
+  };
+
+  auto& jobPool = JobPool::Default();
+  const auto matrixRate = MeasureVerticesPerSecond(nbVertices, nbRuns, matrixSkinning);
+  const auto skin4Rate  = MeasureVerticesPerSecond(nbVertices, nbRuns, [&]() {
+    SoftwareSkinning::Skin4(data, boneMatrices, indices.data(), weights.data());
+  });
+  const auto parallelSkin4Rate = MeasureVerticesPerSecond(nbVertices, nbRuns, [&]() {
+    SoftwareSkinning::Skin4(data, boneMatrices, indices.data(), weights.data(), &jobPool);
+  });
+  const auto parallelSkin8Rate = MeasureVerticesPerSecond(nbVertices, nbRuns, [&]() {
+    SoftwareSkinning::Skin8(data, boneMatrices, indices.data(), weights.data(),
+                            indicesExtra.data(), weightsExtra.data(), &jobPool);
+  });
+
+  // Morph targets blended into the positions
+  std::vector<Float32Array> targetPositions(nbTargets, sourcePositions);
+  std::vector<const float*> targets;
+  Float32Array influences;
+  for (size_t target = 0; target < nbTargets; ++target) {
+    for (auto& value : targetPositions[target]) {
+      value += 0.1f * static_cast<float>(target + 1);
+    }
+    targets.emplace_back(targetPositions[target].data());
+    influences.emplace_back(0.2f);
+  }
+  const auto parallelMorphRate = MeasureVerticesPerSecond(nbVertices, nbRuns, [&]() {
+    SoftwareSkinning::Morph(sourcePositions.data(), targets, influences.data(), positions.data(),
+                            nbVertices * 3, &jobPool);
+  });
+
+  std::cout << "Software skinning: " << nbVertices << " vertices, " << nbBones << " bones, "
+            << jobPool.concurrency() << " threads (Mvertices/s):" << std::endl;
+  std::cout << "\tMatrix/Vector3, 4 influences: " << matrixRate / 1e6 << std::endl;
+  std::cout << "\tKernel, 4 influences: " << skin4Rate / 1e6 << std::endl;
+  std::cout << "\tParallel kernel, 4 influences: " << parallelSkin4Rate / 1e6 << std::endl;
+  std::cout << "\tParallel kernel, 8 influences: " << parallelSkin8Rate / 1e6 << std::endl;
+  std::cout << "\tParallel morph, " << nbTargets << " targets: " << parallelMorphRate / 1e6
+            << std::endl;
+}
@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <iostream>
+
+#include "../benchmark_utils.h"
+
+#include <babylon/meshes/facet_parameters.h>
+#include <babylon/meshes/tangent_space_generator.h>
+#include <babylon/meshes/vertex_data.h>
+#include <babylon/misc/job_pool.h>
+
+TEST(BenchmarkMeshes, TangentSpace)
+{
+  using namespace BABYLON;
+
+  // A terrain of 2M vertices
+  const uint32_t subdivisions = 1413;
+  const size_t nbRuns         = 5;
+  Float32Array positions, uvs;
+  Uint32Array indices;
+  for (uint32_t row = 0; row <= subdivisions; ++row) {
+    for (uint32_t col = 0; col <= subdivisions; ++col) {
+      const auto x = static_cast<float>(col), z = static_cast<float>(row);
+      positions.insert(positions.end(), {x, std::sin(x * 0.05f) * std::cos(z * 0.03f) * 10.f, z});
+      uvs.insert(uvs.end(), {x / subdivisions, z / subdivisions});
+    }
+  }
+  for (uint32_t row = 0; row < subdivisions; ++row) {
+    for (uint32_t col = 0; col < subdivisions; ++col) {
+      const auto i = row * (subdivisions + 1) + col;
+      indices.insert(indices.end(), {i, i + 1, i + subdivisions + 1});
+      indices.insert(indices.end(), {i + 1, i + subdivisions + 2, i + subdivisions + 1});
+    }
+  }
+  const auto nbVertices = positions.size() / 3;
+
+  Float32Array normals, tangents;
+  // The facet parameters select the serial face loop
+  const auto serialMs = MeasureMs(
+    nbRuns, [&]() { VertexData::ComputeNormals(positions, indices, normals, FacetParameters()); },
+    true);
+
+  auto& jobPool = JobPool::Default();
+  TangentSpaceGenerator generator(&jobPool);
+  const auto parallelMs = MeasureMs(
+    nbRuns, [&]() { generator.computeNormals(positions, indices, normals); }, true);
+
+  // A brush editing 16 rows of the terrain
+  const size_t dirtyStart  = (subdivisions + 1) * 700, dirtyCount = (subdivisions + 1) * 16;
+  const auto updateNormals = [&]() {
+    for (auto vertex = dirtyStart; vertex < dirtyStart + dirtyCount; ++vertex) {
+      positions[vertex * 3 + 1] += 0.01f;
+    }
+    generator.updateNormals(positions, indices, normals, dirtyStart, dirtyCount);
+  };
+  const auto incrementalMs = MeasureMs(nbRuns, updateNormals, true);
+
+  const auto tangentsMs = MeasureMs(
+    nbRuns, [&]() { generator.computeTangents(positions, normals, uvs, indices, tangents); },
+    true);
+
+  std::cout << "Tangent space: " << nbVertices << " vertices, " << indices.size() / 3
+            << " faces, " << jobPool.concurrency() << " threads:" << std::endl;
+  std::cout << "\tSerial normals: " << serialMs << " ms" << std::endl;
+  std::cout << "\tParallel normals: " << parallelMs << " ms" << std::endl;
+  std::cout << "\tIncremental normals (" << dirtyCount << " vertices): " << incrementalMs << " ms"
+            << std::endl;
+  std::cout << "\tParallel tangents: " << tangentsMs << " ms" << std::endl;
+}
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include <iostream>
+#include <string>
+
+#include "../benchmark_utils.h"
+
+#include <babylon/cameras/free_camera.h>
+#include <babylon/culling/bounding_info.h>
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/null_engine_options.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/instanced_mesh.h>
+#include <babylon/meshes/mesh.h>
+
+namespace {
+
+double MeasureMsPerFrame(BABYLON::Scene& scene, size_t nbFrames)
+{
+  // Warm up (effects compilation, first world matrices computation)
+  const auto render = [&scene]() { scene.render(); };
+  return BABYLON::MeasureMs(nbFrames, render, true);
+}
+
+} // end of anonymous namespace
+
+TEST(BenchmarkMeshes, ThinInstances)
+{
+  using namespace BABYLON;
+
+  NullEngineOptions options;
+  options.renderHeight = 256;
+  options.renderWidth  = 256;
+  options.textureSize  = 256;
+  auto engine          = NullEngine::New(options);
+
+  // A grid of foliage like boxes
+  const size_t gridSize    = 200;
+  const size_t nbInstances = gridSize * gridSize;
+  const size_t nbFrames    = 10;
+
+  const auto positionInGrid = [gridSize](size_t index) {
+    return Vector3(static_cast<float>(index % gridSize) - static_cast<float>(gridSize) / 2.f, 0.f,
+                   static_cast<float>(index / gridSize) - static_cast<float>(gridSize) / 2.f);
+  };
+
+  // InstancedMesh: one scene graph node per instance
+  double instancedMeshMs = 0.0;
+  {
+    auto scene  = Scene::New(engine.get());
+    auto camera = FreeCamera::New("camera", Vector3(0.f, 150.f, -150.f), scene.get());
+    camera->setTarget(Vector3::Zero());
+    auto box = Mesh::CreateBox("box", 0.5f, scene.get());
+    for (size_t i = 0; i < nbInstances; ++i) {
+      auto instance      = box->createInstance("box" + std::to_string(i));
+      instance->position = positionInGrid(i);
+    }
+    instancedMeshMs = MeasureMsPerFrame(*scene, nbFrames);
+  }
+
+  // Thin instances: a single mesh and a buffer of matrices
+  double thinInstancesMs = 0.0;
+  {
+    auto scene  = Scene::New(engine.get());
+    auto camera = FreeCamera::New("camera", Vector3(0.f, 150.f, -150.f), scene.get());
+    camera->setTarget(Vector3::Zero());
+    auto box = Mesh::CreateBox("box", 0.5f, scene.get());
+    Float32Array matrices(nbInstances * 16);
+    for (size_t i = 0; i < nbInstances; ++i) {
+      const auto position = positionInGrid(i);
+      Matrix::Translation(position.x, position.y, position.z)
+        .copyToArray(matrices, static_cast<unsigned int>(i * 16));
+    }
+    box->thinInstanceSetBuffer("matrix", std::move(matrices), 16);
+
+    // The bounding info covers all the thin instances
+    EXPECT_EQ(box->thinInstanceCount(), nbInstances);
+    const auto& boundingBox = box->getBoundingInfo()->boundingBox;
+    EXPECT_FLOAT_EQ(boundingBox.minimum.x, -static_cast<float>(gridSize) / 2.f - 0.25f);
+    EXPECT_FLOAT_EQ(boundingBox.maximum.z, static_cast<float>(gridSize) / 2.f - 1.f + 0.25f);
+
+    thinInstancesMs = MeasureMsPerFrame(*scene, nbFrames);
+
+    // Partial update of the matrix of the last thin instance
+    Float32Array lastMatrix(16);
+    Matrix::Translation(0.f, 10.f, 0.f).copyToArray(lastMatrix);
+    box->thinInstancePartialBufferUpdate("matrix", lastMatrix, (nbInstances - 1) * 16);
+    EXPECT_FLOAT_EQ((*box->thinInstanceGetBuffer("matrix"))[nbInstances * 16 - 3], 10.f);
+  }
+
+  std::cout << "Rendering " << nbInstances << " boxes:" << std::endl;
+  std::cout << "\tInstancedMesh: " << instancedMeshMs << " ms/frame" << std::endl;
+  std::cout << "\tThin instances: " << thinInstancesMs << " ms/frame" << std::endl;
+}
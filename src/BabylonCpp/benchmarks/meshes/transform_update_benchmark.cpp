@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/null_engine_options.h>
+#include <babylon/engines/scene.h>
+#include <babylon/instrumentation/scene_instrumentation.h>
+#include <babylon/meshes/mesh.h>
+
+namespace {
+
+double MeasureActiveMeshesEvaluationMs(BABYLON::Scene& scene,
+                                       const std::vector<BABYLON::TransformNodePtr>& roots,
+                                       size_t nbFrames)
+{
+  using namespace BABYLON;
+
+  SceneInstrumentation instrumentation(&scene);
+  instrumentation.captureActiveMeshesEvaluationTime = true;
+
+  double totalMs = 0.0;
+  for (size_t frame = 0; frame < nbFrames; ++frame) {
+    // Move every hierarchy
+    for (const auto& root : roots) {
+      root->rotation().y += 0.01f;
+    }
+    scene.render();
+    totalMs += instrumentation.activeMeshesEvaluationTimeCounter().current();
+  }
+
+  instrumentation.dispose();
+
+  return totalMs / static_cast<double>(nbFrames);
+}
+
+} // end of anonymous namespace
+
+TEST(BenchmarkMeshes, TransformUpdatePass)
+{
+  using namespace BABYLON;
+
+  NullEngineOptions options;
+  options.renderHeight = 256;
+  options.renderWidth  = 256;
+  options.textureSize  = 256;
+  auto engine          = NullEngine::New(options);
+  auto scene           = Scene::New(engine.get());
+  auto camera          = FreeCamera::New("camera", Vector3(0.f, 0.f, -100.f), scene.get());
+
+  // Chains of transform nodes with a box on every level
+  const size_t nbHierarchies = 500;
+  const size_t depth         = 8;
+  std::vector<TransformNodePtr> roots;
+  std::vector<MeshPtr> meshes;
+  for (size_t i = 0; i < nbHierarchies; ++i) {
+    auto root      = TransformNode::New("root" + std::to_string(i), scene.get());
+    root->position = Vector3(static_cast<float>(i % 25) - 12.f, static_cast<float>(i / 25) - 10.f,
+                             0.f);
+    roots.emplace_back(root);
+
+    Node* parent = root.get();
+    for (size_t level = 0; level < depth; ++level) {
+      const auto name = "box" + std::to_string(i) + "_" + std::to_string(level);
+      auto box        = Mesh::CreateBox(name, 0.1f, scene.get());
+      box->position   = Vector3(0.f, 0.f, 0.5f);
+      box->parent     = parent;
+      parent          = box.get();
+      meshes.emplace_back(box);
+    }
+  }
+
+  const size_t nbFrames = 20;
+
+  scene->transformUpdatePassEnabled = false;
+  const auto lazyMs                 = MeasureActiveMeshesEvaluationMs(*scene, roots, nbFrames);
+
+  scene->transformUpdatePassEnabled = true;
+  const auto passMs                 = MeasureActiveMeshesEvaluationMs(*scene, roots, nbFrames);
+
+  EXPECT_EQ(scene->getWorldMatrixUpdates(), nbHierarchies * (depth + 1));
+
+  std::cout << "Active meshes evaluation: " << nbHierarchies << " hierarchies of depth " << depth
+            << ":" << std::endl;
+  std::cout << "\tLazy world matrices: " << lazyMs << " ms/frame" << std::endl;
+  std::cout << "\tTransform update pass: " << passMs << " ms/frame, "
+            << scene->getWorldMatrixUpdates() << " world matrices updated" << std::endl;
+}
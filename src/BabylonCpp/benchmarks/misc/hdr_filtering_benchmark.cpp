@@ -0,0 +1,44 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+
+#include "../benchmark_utils.h"
+
+#include <babylon/misc/highdynamicrange/panorama_to_cube_map_tools.h>
+#include <babylon/misc/highdynamicrange/pmrem_generator.h>
+#include <babylon/misc/job_pool.h>
+
+TEST(BenchmarkMisc, HdrFiltering)
+{
+  using namespace BABYLON;
+
+  // 1024 x 512 panorama projected on 128 x 128 faces
+  const size_t width = 1024, height = 512, size = 128;
+  Float32Array panorama(width * height * 3);
+  for (size_t i = 0; i < panorama.size(); ++i) {
+    panorama[i] = 1.f + std::sin(static_cast<float>(i) * 0.001f);
+  }
+
+  JobPool serialJobPool(0);
+  std::cout << "HDR filtering (ms):" << std::endl;
+  for (auto* jobPool : {&serialJobPool, &JobPool::Default()}) {
+    std::vector<Float32Array> faces;
+    const auto panoramaMs = MeasureMs(1, [&]() {
+      auto cubeMap = PanoramaToCubeMapTools::ConvertPanoramaToCubemap(panorama, width, height,
+                                                                      size, jobPool);
+      for (const auto* face : {"right", "left", "up", "down", "front", "back"}) {
+        faces.emplace_back(cubeMap[face].float32Array());
+      }
+    });
+    const auto pmremMs = MeasureMs(1, [&]() {
+      PMREMGenerator<Float32Array> generator(faces, size, size, 0, 3, true, 2048.f, 0.25f, false,
+                                             true, jobPool);
+      generator.filterCubeMap();
+    });
+    std::cout << "  " << jobPool->concurrency() << " thread(s)" << std::fixed
+              << std::setprecision(1) << "  panorama to cube map " << std::left << std::setw(10)
+              << panoramaMs << "PMREM " << pmremMs << std::endl;
+  }
+}
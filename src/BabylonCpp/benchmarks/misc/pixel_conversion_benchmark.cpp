@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "../benchmark_utils.h"
+
+#include <babylon/misc/pixel_conversion.h>
+
+namespace {
+
+// Megabytes of source pixels per second
+double MeasureMBs(size_t nbBytes, size_t nbRuns, const std::function<void()>& run)
+{
+  return static_cast<double>(nbBytes) / (1024.0 * 1024.0) * 1000.0
+         / BABYLON::MeasureMs(nbRuns, run, true);
+}
+
+// Previous DDS half float conversion, one value at a time with std::pow
+float HalfToFloatPow(uint16_t value)
+{
+  const auto s = (value & 0x8000) >> 15;
+  const auto e = (value & 0x7C00) >> 10;
+  const auto f = value & 0x03FF;
+  if (e == 0) {
+    return static_cast<float>((s ? -1 : 1) * std::pow(2, -14) * (f / std::pow(2, 10)));
+  }
+  else if (e == 0x1F) {
+    return f ? 0.f : ((s ? -1.f : 1.f) * std::numeric_limits<float>::infinity());
+  }
+  return static_cast<float>((s ? -1 : 1) * std::pow(2, e - 15) * (1 + (f / std::pow(2, 10))));
+}
+
+} // end of anonymous namespace
+
+TEST(BenchmarkMisc, PixelConversion)
+{
+  using namespace BABYLON;
+
+  // 1024 x 1024 RGBA image
+  const size_t nbPixels = 1024 * 1024, nbValues = nbPixels * 4, nbRuns = 20;
+
+  std::vector<uint16_t> halves(nbValues);
+  std::vector<float> floats(nbValues), results(nbValues);
+  std::vector<uint16_t> halfResults(nbValues);
+  std::vector<uint8_t> bytes(nbValues), byteResults(nbValues);
+  for (size_t i = 0; i < nbValues; ++i) {
+    floats[i] = std::sin(static_cast<float>(i)) * 4.f;
+    halves[i] = PixelConversion::FloatToHalf(floats[i]);
+    bytes[i]  = static_cast<uint8_t>(i * 7);
+  }
+  const auto* red       = bytes.data();
+  const auto* green     = red + nbPixels;
+  const auto* blue      = green + nbPixels;
+  const auto* exponents = blue + nbPixels;
+
+  const std::vector<std::pair<const char*, std::pair<size_t, std::function<void()>>>>
+    conversions{
+      {"half to float", {nbValues * 2,
+                         [&]() {
+                           PixelConversion::HalfToFloat(halves.data(), results.data(), nbValues);
+                         }}},
+      {"float to half", {nbValues * 4,
+                         [&]() {
+                           PixelConversion::FloatToHalf(floats.data(), halfResults.data(),
+                                                        nbValues);
+                         }}},
+      {"half to [0, 255]", {nbValues * 2,
+                            [&]() {
+                              PixelConversion::HalfToByteRange(halves.data(), results.data(),
+                                                               nbValues);
+                            }}},
+      {"float to [0, 255]", {nbValues * 4,
+                             [&]() {
+                               PixelConversion::FloatToByteRange(floats.data(), results.data(),
+                                                                 nbValues);
+                             }}},
+      {"RGBE to float", {nbPixels * 4,
+                         [&]() {
+                           PixelConversion::RGBEToFloat(red, green, blue, exponents,
+                                                        results.data(), nbPixels);
+                         }}},
+      {"BGRA to RGBA", {nbPixels * 4,
+                        [&]() {
+                          PixelConversion::SwizzleRGBA(bytes.data(), byteResults.data(),
+                                                       nbPixels, 2, 1, 0, 3);
+                        }}},
+      {"BGR to RGB", {nbPixels * 3,
+                      [&]() {
+                        PixelConversion::SwizzleRGB(bytes.data(), byteResults.data(), nbPixels,
+                                                    2, 1, 0);
+                      }}},
+      {"BGR to RGBA", {nbPixels * 3,
+                       [&]() {
+                         PixelConversion::RGBToRGBA(bytes.data(), byteResults.data(), nbPixels,
+                                                    2, 1, 0);
+                       }}},
+      {"luminance to RGBA", {nbPixels,
+                             [&]() {
+                               PixelConversion::LuminanceToRGBA(bytes.data(),
+                                                                byteResults.data(), nbPixels);
+                             }}},
+      {"luminance alpha to RGBA", {nbPixels * 2,
+                                   [&]() {
+                                     PixelConversion::LuminanceAlphaToRGBA(
+                                       bytes.data(), byteResults.data(), nbPixels);
+                                   }}},
+    };
+
+  std::cout << "Pixel conversion (MB/s of source pixels):" << std::endl;
+
+  // Reference: the previous DDS conversion
+  {
+    const auto mbs = MeasureMBs(nbValues * 2, nbRuns, [&]() {
+      for (size_t i = 0; i < nbValues; ++i) {
+        results[i] = HalfToFloatPow(halves[i]);
+      }
+    });
+    std::cout << "  " << std::left << std::setw(26) << "half to float (std::pow)"
+              << std::fixed << std::setprecision(1) << mbs << std::endl;
+  }
+
+  for (const auto& [name, conversion] : conversions) {
+    PixelConversion::SetSIMDEnabled(false);
+    const auto scalar = MeasureMBs(conversion.first, nbRuns, conversion.second);
+    PixelConversion::SetSIMDEnabled(true);
+    const auto simd = MeasureMBs(conversion.first, nbRuns, conversion.second);
+    std::cout << "  " << std::left << std::setw(26) << name << std::fixed
+              << std::setprecision(1) << "scalar " << std::setw(10) << scalar
+              << PixelConversion::InstructionSets() << " " << simd << std::endl;
+  }
+}
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#include <iostream>
+
+#include "../benchmark_utils.h"
+
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/null_engine_options.h>
+#include <babylon/engines/scene.h>
+#include <babylon/maths/color4.h>
+#include <babylon/particles/particle_system.h>
+
+namespace {
+
+BABYLON::ParticleSystem* CreateParticleSystem(BABYLON::Scene* scene, size_t capacity,
+                                              bool useStructureOfArrays)
+{
+  using namespace BABYLON;
+
+  // The particle system is owned by the scene
+  auto particleSystem         = new ParticleSystem("particles", capacity, scene);
+  particleSystem->emitter     = Vector3(0.f, 0.f, 0.f);
+  particleSystem->updateSpeed = 1.f;
+  particleSystem->minLifeTime = 40.f;
+  particleSystem->maxLifeTime = 40.f;
+  particleSystem->gravity     = Vector3(0.f, -0.01f, 0.f);
+  particleSystem->addColorGradient(0.f, Color4(1.f, 1.f, 1.f, 1.f));
+  particleSystem->addColorGradient(1.f, Color4(1.f, 0.f, 0.f, 0.f));
+  particleSystem->addSizeGradient(0.f, 1.f);
+  particleSystem->addSizeGradient(1.f, 0.1f);
+  particleSystem->addDragGradient(0.f, 0.f);
+  particleSystem->addDragGradient(1.f, 0.5f);
+  particleSystem->useStructureOfArrays = useStructureOfArrays;
+
+  return particleSystem;
+}
+
+double MeasureMsPerFrame(BABYLON::ParticleSystem& particleSystem, size_t capacity,
+                         size_t nbFrames)
+{
+  particleSystem.start();
+  // Fill the system, then keep it full by emitting as many particles as the dying ones
+  particleSystem.manualEmitCount = static_cast<int>(capacity);
+  particleSystem.animate(true);
+
+  return BABYLON::MeasureMs(nbFrames, [&particleSystem, capacity]() {
+    particleSystem.manualEmitCount = static_cast<int>(capacity / 40);
+    particleSystem.animate(true);
+  });
+}
+
+} // end of anonymous namespace
+
+TEST(BenchmarkParticles, ParticleSystemUpdate)
+{
+  using namespace BABYLON;
+
+  NullEngineOptions options;
+  options.renderHeight = 256;
+  options.renderWidth  = 256;
+  options.textureSize  = 256;
+  auto engine          = NullEngine::New(options);
+  auto scene           = Scene::New(engine.get());
+
+  const size_t capacity = 50000;
+  const size_t nbFrames = 200;
+
+  auto particles         = CreateParticleSystem(scene.get(), capacity, false);
+  const auto particlesMs = MeasureMsPerFrame(*particles, capacity, nbFrames);
+
+  auto soaParticles         = CreateParticleSystem(scene.get(), capacity, true);
+  const auto soaParticlesMs = MeasureMsPerFrame(*soaParticles, capacity, nbFrames);
+
+  EXPECT_TRUE(soaParticles->useStructureOfArrays());
+
+  std::cout << "ParticleSystem update: " << capacity << " particles:" << std::endl;
+  std::cout << "\tParticle objects: " << particlesMs << " ms/frame" << std::endl;
+  std::cout << "\tStructure of arrays: " << soaParticlesMs << " ms/frame" << std::endl;
+}
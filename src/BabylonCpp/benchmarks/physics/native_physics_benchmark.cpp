@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+
+#include <iostream>
+
+#include "../benchmark_utils.h"
+
+#include <babylon/maths/vector3.h>
+#include <babylon/misc/job_pool.h>
+#include <babylon/physics/plugins/native_physics_world.h>
+
+namespace {
+
+// A static ground and 10k boxes, in columns of 4 boxes
+void CreateColumns(BABYLON::NativePhysicsWorld& world)
+{
+  using namespace BABYLON;
+
+  world.createBody(NativePhysicsShape::CreateBox(Vector3(100.f, 0.5f, 100.f)), 0.f,
+                   Vector3(0.f, -0.5f, 0.f));
+  const auto box      = NativePhysicsShape::CreateBox(Vector3(0.5f, 0.5f, 0.5f));
+  const auto gridSize = 50;
+  const auto offset   = gridSize * 3 / 2;
+  for (int x = 0; x < gridSize; ++x) {
+    for (int z = 0; z < gridSize; ++z) {
+      for (int y = 0; y < 4; ++y) {
+        world.createBody(box, 1.f,
+                         Vector3(static_cast<float>(x * 3 - offset), 0.5f + static_cast<float>(y),
+                                 static_cast<float>(z * 3 - offset)));
+      }
+    }
+  }
+}
+
+} // end of anonymous namespace
+
+TEST(BenchmarkPhysics, NativePhysicsWorld)
+{
+  using namespace BABYLON;
+
+  const size_t nbSteps = 60;
+
+  // The columns are kept awake, each step solving all the bodies
+  JobPool serialPool(0);
+  NativePhysicsWorld serialWorld(&serialPool);
+  serialWorld.sleepingEnabled = false;
+  CreateColumns(serialWorld);
+  const auto serialMs = MeasureMs(nbSteps, [&]() { serialWorld.step(1.f / 60.f); });
+
+  NativePhysicsWorld world(&JobPool::Default());
+  world.sleepingEnabled = false;
+  CreateColumns(world);
+  const auto parallelMs = MeasureMs(nbSteps, [&]() { world.step(1.f / 60.f); });
+
+  EXPECT_EQ(serialWorld.contactCount(), world.contactCount());
+
+  std::cout << "Physics step of " << world.bodies().size() << " bodies, "
+            << world.contactCount() << " contacts, " << world.islandCount()
+            << " islands:" << std::endl;
+  std::cout << "\tSerial: " << serialMs << " ms" << std::endl;
+  std::cout << "\tParallel (" << JobPool::Default().concurrency()
+            << " workers): " << parallelMs << " ms" << std::endl;
+}
@@ -17,6 +17,7 @@ namespace BABYLON {
 struct _IAnimationState;
 class Animatable;
 class Animation;
+class AnimationTrack;
 class IAnimatable;
 struct IAnimationKey;
 struct IEasingFunction;
@@ -25,6 +26,7 @@ class RuntimeAnimation;
 class Scene;
 using AnimatablePtr       = std::shared_ptr<Animatable>;
 using AnimationPtr        = std::shared_ptr<Animation>;
+using AnimationTrackPtr   = std::shared_ptr<AnimationTrack>;
 using IEasingFunctionPtr  = std::shared_ptr<IEasingFunction>;
 using NodePtr             = std::shared_ptr<Node>;
 using RuntimeAnimationPtr = std::shared_ptr<RuntimeAnimation>;
@@ -313,6 +315,15 @@ public:
    * @returns The key frames of the animation
    */
   std::vector<IAnimationKey>& getKeys();
+  [[nodiscard]] const std::vector<IAnimationKey>& getKeys() const;
+
+  /**
+   * @brief Samples the key frames at a fixed rate. The runtime animations then interpolate
+   * linearly between the samples instead of evaluating the keys, their tangents and the easing
+   * function. Only applies to the float, vector, quaternion, color and matrix animations.
+   * @param samplesPerFrame defines the number of samples per frame, 0 to evaluate the keys
+   */
+  void bake(float samplesPerFrame = 1.f);
 
   /**
    * @brief Gets the highest frame rate of the animation.
@@ -471,6 +482,12 @@ public:
    */
   AnimationValue _interpolate(float currentFrame, _IAnimationState& state);
 
+  /**
+   * @brief Hidden Internal use only. Returns the typed keys of the animation, nullptr if its data
+   * type has no typed track.
+   */
+  AnimationTrackPtr& _getTrack();
+
   /**
    * @brief Defines the function to use to interpolate matrices.
    * @param startValue defines the start matrix
@@ -620,6 +637,13 @@ private:
    */
   IEasingFunctionPtr _easingFunction;
 
+  /**
+   * Typed keys of the animation, built on demand and reset when the keys change
+   */
+  AnimationTrackPtr _track;
+  bool _trackIsDirty;
+  float _bakedSamplesPerFrame;
+
   /**
    * The set of event that will be linked to this animation
    */
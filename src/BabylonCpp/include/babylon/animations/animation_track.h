@@ -0,0 +1,128 @@
+#ifndef BABYLON_ANIMATIONS_ANIMATION_TRACK_H
+#define BABYLON_ANIMATIONS_ANIMATION_TRACK_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+
+class AnimationTrack;
+class AnimationValue;
+struct IAnimationKey;
+struct IEasingFunction;
+using AnimationTrackPtr = std::shared_ptr<AnimationTrack>;
+
+/**
+ * @brief Typed key frames of an animation, stored as arrays of floats instead of AnimationValue.
+ *
+ * The frames, the values and the tangents of the keys are stored in separate arrays (the values of
+ * a key being the float components of the animation type), sampling a track does not allocate nor
+ * copy any AnimationValue. A track can also be baked: the keys are then sampled at a fixed rate
+ * and the track linearly interpolates between the samples (normalized linear interpolation for
+ * the quaternions).
+ */
+class BABYLON_SHARED_EXPORT AnimationTrack {
+
+public:
+  /**
+   * Maximum number of components of a value (a matrix)
+   */
+  static constexpr size_t MaxComponentCount = 16;
+
+public:
+  /**
+   * @brief Returns whether a key uses the step interpolation, its value being kept until the next
+   * key.
+   */
+  static bool IsStepKey(const IAnimationKey& key);
+
+  /**
+   * @brief Returns the number of float components of an animation type, 0 if the type has no
+   * typed track (booleans, integers, strings, sizes...).
+   * @param dataType defines the animation type
+   */
+  static size_t ComponentCount(unsigned int dataType);
+
+  /**
+   * @brief Creates the typed track of a list of key frames.
+   * @param dataType defines the animation type of the keys
+   * @param keys defines the key frames, sorted by frame
+   * @returns the track, or nullptr if the type has no typed track or there is no key
+   */
+  static AnimationTrackPtr New(unsigned int dataType, const std::vector<IAnimationKey>& keys);
+  ~AnimationTrack(); // = default
+
+  [[nodiscard]] unsigned int dataType() const
+  {
+    return _dataType;
+  }
+
+  /**
+   * @brief Returns the number of floats of a value of the track.
+   */
+  [[nodiscard]] size_t componentCount() const
+  {
+    return _componentCount;
+  }
+
+  [[nodiscard]] size_t keyCount() const
+  {
+    return _frames.size();
+  }
+
+  [[nodiscard]] bool isBaked() const
+  {
+    return !_bakedValues.empty();
+  }
+
+  /**
+   * @brief Samples the keys at a fixed rate. The following samples interpolate linearly between
+   * these samples and are clamped to the frame range of the keys.
+   * @param samplesPerFrame defines the number of samples per frame
+   * @param easingFunction defines the easing function applied to the keys
+   */
+  void bake(float samplesPerFrame, IEasingFunction* easingFunction);
+
+  /**
+   * @brief Computes the value of the track at a frame.
+   * @param frame defines the frame to sample
+   * @param cursor defines the key of the previous sample, updated with the key of this sample
+   * @param easingFunction defines the easing function applied to the gradient between the keys
+   * @param result defines the componentCount() floats receiving the value
+   */
+  void sample(float frame, int& cursor, IEasingFunction* easingFunction, float* result) const;
+
+  /**
+   * @brief Converts the floats of a value of the track to an AnimationValue.
+   */
+  [[nodiscard]] AnimationValue toAnimationValue(const float* value) const;
+
+protected:
+  AnimationTrack(unsigned int dataType, size_t componentCount);
+
+private:
+  void _interpolateKeys(size_t key, float gradient, float* result) const;
+  void _sampleBaked(float frame, float* result) const;
+
+private:
+  unsigned int _dataType;
+  size_t _componentCount;
+  // Keys
+  Float32Array _frames;
+  Float32Array _values;
+  Float32Array _inTangents;
+  Float32Array _outTangents;
+  std::vector<uint8_t> _keyFlags;
+  // Fixed rate samples
+  float _bakedSamplesPerFrame;
+  Float32Array _bakedValues;
+
+}; // end of class AnimationTrack
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_ANIMATIONS_ANIMATION_TRACK_H
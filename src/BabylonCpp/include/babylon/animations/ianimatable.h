@@ -1,6 +1,8 @@
 #ifndef BABYLON_ANIMATIONS_IANIMATABLE_H
 #define BABYLON_ANIMATIONS_IANIMATABLE_H
 
+#include <functional>
+
 #include <babylon/animations/animation_value.h>
 #include <babylon/babylon_api.h>
 #include <babylon/babylon_enums.h>
@@ -17,6 +19,12 @@ using AnimationPropertiesOverridePtr = std::shared_ptr<AnimationPropertiesOverri
 using AnimationRangePtr              = std::shared_ptr<AnimationRange>;
 using IAnimatablePtr                 = std::shared_ptr<IAnimatable>;
 
+/**
+ * Writes an animated value in a property, the value being given as the float components of its
+ * animation type (x, y, z, w for a quaternion, the 16 values for a matrix)
+ */
+using AnimatedPropertySetter = std::function<void(const float* value)>;
+
 class BABYLON_SHARED_EXPORT IAnimatable {
 
 public:
@@ -37,6 +45,17 @@ public:
   virtual void setProperty(const std::vector<std::string>& targetPropertyPath,
                            const AnimationValue& value);
 
+  /**
+   * @brief Hidden Returns a function writing the animated values directly in a property, without
+   * going through AnimationValue.
+   * @param targetPropertyPath defines the path of the property
+   * @param animationType defines the animation type of the values
+   * @returns the setter, nullptr if the property is only animated through setProperty
+   */
+  virtual AnimatedPropertySetter
+  _getAnimatedPropertySetter(const std::vector<std::string>& targetPropertyPath,
+                             unsigned int animationType);
+
   static AnimationValue getProperty(const std::string& key, const Color3& color);
   static AnimationValue getProperty(const std::string& key, const Color4& color);
   static AnimationValue getProperty(const std::string& key, const Vector2& vector);
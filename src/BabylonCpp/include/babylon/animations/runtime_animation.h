@@ -1,11 +1,14 @@
 #ifndef BABYLON_ANIMATIONS_RUNTIME_ANIMATION_H
 #define BABYLON_ANIMATIONS_RUNTIME_ANIMATION_H
 
+#include <array>
 #include <functional>
 #include <unordered_map>
 
 #include <babylon/animations/_ianimation_state.h>
+#include <babylon/animations/animation_track.h>
 #include <babylon/animations/animation_value.h>
+#include <babylon/animations/ianimatable.h>
 #include <babylon/babylon_api.h>
 
 namespace BABYLON {
@@ -13,8 +16,6 @@ namespace BABYLON {
 class Animatable;
 class Animation;
 class AnimationEvent;
-class IAnimatable;
-struct IAnimationKey;
 class RuntimeAnimation;
 class Scene;
 using AnimationPtr        = std::shared_ptr<Animation>;
@@ -277,7 +278,14 @@ private:
 
   bool _enableBlending;
 
-  std::vector<IAnimationKey> _keys;
+  /**
+   * Setter of the target property, the values sampled in the typed track of the animation being
+   * written directly in the property when they are neither weighted nor offset
+   */
+  AnimatedPropertySetter _propertySetter;
+  std::array<float, AnimationTrack::MaxComponentCount> _trackValue;
+  bool _currentValueIsTrackValue;
+
   float _minFrame;
   float _maxFrame;
   float _minValue;
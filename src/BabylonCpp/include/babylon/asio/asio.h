@@ -4,6 +4,7 @@
 #include <babylon/babylon_api.h>
 #include <babylon/babylon_common.h>
 #include <babylon/asio/callback_types.h>
+#include <babylon/core/mapped_array_buffer.h>
 #include <variant>
 #include <functional>
 #include <string>
@@ -11,7 +12,16 @@
 namespace BABYLON {
 namespace asio {
 
+/**
+ * @brief Identifier of an asynchronous request (can be used to cancel it)
+ */
+using RequestId = uint64_t;
 
+/**
+ * @brief Priority of an asynchronous request: pending requests with a higher
+ * priority are handed to the io worker threads first
+ */
+enum class RequestPriority : int { Low = 0, Normal = 1, High = 2 };
 
 /**
  * @brief LoadAssetAsync_Text will load a text resource *asynchronously*
@@ -33,6 +43,55 @@ BABYLON_SHARED_EXPORT void LoadAssetAsync_Binary(
   const OnErrorFunction& onErrorFunction,
   const OnProgressFunction& onProgressFunction = nullptr);
 
+/**
+ * @brief LoadAssetAsync_Mapped will memory map a binary resource
+ * *asynchronously* and raise the given callbacks *synchronously*.
+ * The resulting buffer is read-only and can be sliced without copies.
+ */
+BABYLON_SHARED_EXPORT void LoadAssetAsync_Mapped(
+  const std::string& assetPath,
+  const OnSuccessFunction<MappedArrayBuffer>& onSuccessFunction,
+  const OnErrorFunction& onErrorFunction,
+  const OnProgressFunction& onProgressFunction = nullptr);
+
+/**
+ * @brief LoadAssetAsync_Text_Prioritized will load a text resource
+ * *asynchronously* with the given priority and raise the given callbacks
+ * *synchronously*
+ * @returns the id of the request, which can be passed to CancelRequest()
+ */
+BABYLON_SHARED_EXPORT RequestId LoadAssetAsync_Text_Prioritized(
+  const std::string& assetPath, RequestPriority priority,
+  const OnSuccessFunction<std::string>& onSuccessFunction,
+  const OnErrorFunction& onErrorFunction,
+  const OnProgressFunction& onProgressFunction = nullptr);
+
+/**
+ * @brief LoadAssetAsync_Binary_Prioritized will load a binary resource
+ * *asynchronously* with the given priority and raise the given callbacks
+ * *synchronously*
+ * @returns the id of the request, which can be passed to CancelRequest()
+ */
+BABYLON_SHARED_EXPORT RequestId LoadAssetAsync_Binary_Prioritized(
+  const std::string& assetPath, RequestPriority priority,
+  const OnSuccessFunction<ArrayBuffer>& onSuccessFunction,
+  const OnErrorFunction& onErrorFunction,
+  const OnProgressFunction& onProgressFunction = nullptr);
+
+/**
+ * @brief CancelRequest: cancels a pending or running request, or a completed
+ * one whose callback was not raised yet. None of its callbacks (success, error)
+ * will be raised after this call.
+ * @returns true if the request was still alive and is now cancelled
+ */
+BABYLON_SHARED_EXPORT bool CancelRequest(RequestId requestId);
+
+/**
+ * @brief Service_SetNbWorkerThreads: sets the size of the io worker pool
+ * (default: hardware concurrency, clamped to [2, 8])
+ */
+BABYLON_SHARED_EXPORT void Service_SetNbWorkerThreads(size_t nbWorkerThreads);
+
 /**
  * @brief HeartBeat_Sync: call this in the app's main loop:
  * it will run the first available callback *synchronously*
@@ -55,6 +114,10 @@ BABYLON_SHARED_EXPORT bool HasRemainingTasks();
  */
 BABYLON_SHARED_EXPORT void Service_WaitAll_Sync();
 
+/**
+ * @brief Service_Stop: stops the io worker threads. The requests that were
+ * still pending are failed: their error callback is raised by HeartBeat_Sync()
+ */
 BABYLON_SHARED_EXPORT void Service_Stop();
 
 /**
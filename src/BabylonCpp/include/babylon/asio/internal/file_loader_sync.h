@@ -16,7 +16,8 @@ namespace sync_io_impl
 {
 ArrayBufferOrErrorMessage LoadFileSync_Binary(
   const std::string& filename,
-  const OnProgressFunction& onProgressFunction
+  const OnProgressFunction& onProgressFunction,
+  const std::atomic<bool>* cancelRequested = nullptr
   );
 
 
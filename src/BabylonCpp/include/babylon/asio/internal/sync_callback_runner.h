@@ -13,6 +13,7 @@ namespace sync_callback_runner {
 
 
 void PushCallback(const VoidCallback & function);
+void PushCallback(VoidCallback && function);
 void HeartBeat();
 bool HasRemainingCallbacks();
 
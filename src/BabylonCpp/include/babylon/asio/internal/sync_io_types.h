@@ -2,6 +2,7 @@
 #define BABYLONCPP_SYNC_IO_TYPES_H
 
 #include <babylon/babylon_common.h>
+#include <atomic>
 #include <string>
 #include <variant>
 #include <functional>
@@ -11,7 +12,10 @@ namespace asio {
 namespace sync_io_impl
 {
 using ArrayBufferOrErrorMessage = std::variant<ArrayBuffer, ErrorMessage>;
-using SyncLoaderFunction = std::function<ArrayBufferOrErrorMessage()>;
+// A sync loader is run on an io worker thread; it should regularly check
+// cancelRequested and give up early when it is set
+using SyncLoaderFunction
+  = std::function<ArrayBufferOrErrorMessage(const std::atomic<bool>& cancelRequested)>;
 
 } // namespace internal
 } // namespace asio
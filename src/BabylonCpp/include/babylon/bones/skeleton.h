@@ -1,6 +1,7 @@
 #ifndef BABYLON_BONES_SKELETON_H
 #define BABYLON_BONES_SKELETON_H
 
+#include <array>
 #include <nlohmann/json_fwd.hpp>
 #include <unordered_map>
 
@@ -11,6 +12,7 @@
 #include <babylon/maths/matrix.h>
 #include <babylon/misc/iinspectable.h>
 #include <babylon/misc/observable.h>
+#include <babylon/misc/perf_counter.h>
 
 using json = nlohmann::json;
 
@@ -168,6 +170,25 @@ public:
    */
   void prepare();
 
+  /**
+   * @brief Hidden Serial part of prepare(): updates the bones linked to transform nodes and
+   * allocates the bone matrices and their textures.
+   * @returns whether the bone matrices have to be computed
+   */
+  bool _beginPrepare();
+
+  /**
+   * @brief Hidden Computes the bone matrices. Only the bones of the skeleton and the bone matrices
+   * of its meshes are written, so different skeletons can be computed on different threads as
+   * long as they have no onBeforeComputeObservable observer.
+   */
+  void _computeMatrices();
+
+  /**
+   * @brief Hidden Serial part of prepare(): uploads the bone matrices to their textures.
+   */
+  void _endPrepare();
+
   /**
    * @brief Gets the list of animatables currently running for this skeleton.
    * @returns an array of animatables
@@ -278,10 +299,17 @@ protected:
    */
   [[nodiscard]] size_t get_uniqueId() const;
 
+  /**
+   * @brief Gets the perf counter used for the time spent computing the bone matrices (in
+   * microseconds).
+   */
+  PerfCounter& get_evaluationTimeCounter();
+
 private:
   float _getHighestAnimationFrame();
+  void _updateFlatHierarchy();
   void _computeTransformMatrices(Float32Array& targetMatrix,
-                                 const std::optional<Matrix>& initialSkinMatrix = std::nullopt);
+                                 const Matrix* initialSkinMatrix = nullptr);
   void _sortBones(unsigned int index, std::vector<BonePtr>& bones, std::vector<bool>& visited);
 
 public:
@@ -320,6 +348,9 @@ public:
   /** Hidden */
   std::optional<bool> _hasWaitingData;
 
+  /** Hidden (active skeletons evaluation of the scene which last activated the skeleton) */
+  size_t _activeEvaluationId;
+
   /**
    * Specifies if the skeleton should be serialized
    */
@@ -355,6 +386,22 @@ public:
    */
   ReadOnlyProperty<Skeleton, size_t> uniqueId;
 
+  /**
+   * Perf counter used for the time spent computing the bone matrices of this skeleton, in
+   * microseconds.
+   */
+  ReadOnlyProperty<Skeleton, PerfCounter> evaluationTimeCounter;
+
+private:
+  struct PoseMatrixHash {
+    size_t operator()(const std::array<float, 16>& poseMatrix) const;
+  }; // end of struct PoseMatrixHash
+
+  /**
+   * @brief Returns the mesh whose bone matrices are used by a mesh with a pose matrix.
+   */
+  AbstractMesh* _getPaletteMesh(AbstractMesh* mesh) const;
+
 private:
   Scene* _scene;
   bool _isDirty;
@@ -364,6 +411,15 @@ private:
   std::vector<IAnimatablePtr> _animatables;
   Matrix _identity;
   AbstractMesh* _synchronizedWithMesh;
+  // Bones in evaluation order with the index of their parent (-1 for the roots, -2 for a parent
+  // which is not a bone of the skeleton)
+  std::vector<Bone*> _flatBones;
+  std::vector<int> _parentIndices;
+  // Meshes with a pose matrix whose bone matrices were computed by the last evaluation, by pose
+  // matrix, and the meshes using the bone matrices of a previous mesh with the same pose matrix
+  std::unordered_map<std::array<float, 16>, AbstractMesh*, PoseMatrixHash> _poseMatrixMeshes;
+  std::unordered_map<AbstractMesh*, AbstractMesh*> _sharedPaletteMeshes;
+  PerfCounter _evaluationTime;
   std::unordered_map<std::string, AnimationRangePtr> _ranges;
   int _lastAbsoluteTransformsUpdateId;
   bool _canUseTextureForBones;
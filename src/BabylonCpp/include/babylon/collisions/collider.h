@@ -3,6 +3,7 @@
 
 #include <babylon/babylon_api.h>
 #include <babylon/core/structs.h>
+#include <babylon/maths/plane.h>
 #include <babylon/maths/vector3.h>
 
 namespace BABYLON {
@@ -39,15 +40,10 @@ public:
   /** Hidden */
   [[nodiscard]] bool _canDoCollision(const Vector3& sphereCenter, float sphereRadius,
                                      const Vector3& vecMin, const Vector3& vecMax) const;
-  /** Hidden */
-  void _testTriangle(size_t faceIndex, std::vector<Plane>& trianglePlaneArray, const Vector3& p1,
-                     const Vector3& p2, const Vector3& p3, bool hasMaterial,
+  /** Hidden (the triangle is given in the space of the collider ellipsoid) */
+  void _testTriangle(const Vector3& p1, const Vector3& p2, const Vector3& p3, bool hasMaterial,
                      const AbstractMeshPtr& hostMesh);
   /** Hidden */
-  void _collide(std::vector<Plane>& trianglePlaneArray, const std::vector<Vector3>& pts,
-                const IndicesArray& indices, size_t indexStart, size_t indexEnd, unsigned int decal,
-                bool hasMaterial, const AbstractMeshPtr& hostMesh);
-  /** Hidden */
   void _getResponse(Vector3& pos, Vector3& vel);
 
 protected:
@@ -88,6 +84,7 @@ public:
   Property<Collider, int> collisionMask;
 
 private:
+  Plane _trianglePlane;
   Vector3 _collisionPoint;
   Vector3 _planeIntersectionPoint;
   Vector3 _tempVector;
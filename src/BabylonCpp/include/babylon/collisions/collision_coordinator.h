@@ -10,6 +10,8 @@
 
 namespace BABYLON {
 
+class PickingBVH;
+
 /**
  * @brief Hidden
  */
@@ -24,13 +26,25 @@ public:
                       const std::function<void(size_t collisionIndex, Vector3& newPosition,
                                                const AbstractMeshPtr& collidedMesh)>& onNewPosition,
                       size_t collisionIndex) override;
+  /**
+   * @brief Resolves the moves of several colliders in one pass spread over the
+   * JobPool::Default() workers. The new positions are the ones getNewPosition would return, the
+   * last collided mesh is stored in the collider of each move and no callback is called.
+   * @param moves defines the moves to resolve, their colliders must be distinct
+   */
+  void getNewPositions(std::vector<ColliderMove>& moves) override;
   ColliderPtr createCollider() override;
   void init(Scene* scene) override;
 
 private:
+  /**
+   * The meshes are tested through the given BVH when set, and their submeshes are selected by the
+   * scene candidate providers when useSubMeshCandidates is set, which is not thread safe
+   */
   void _collideWithWorld(Vector3& position, Vector3& velocity, const ColliderPtr& collider,
                          unsigned int maximumRetry, Vector3& finalPosition,
-                         const AbstractMeshPtr& excludedMesh = nullptr);
+                         const AbstractMeshPtr& excludedMesh, const PickingBVH* meshesBVH,
+                         bool useSubMeshCandidates) const;
 
 private:
   Scene* _scene;
@@ -3,18 +3,49 @@
 
 #include <functional>
 #include <memory>
+#include <vector>
 
 #include <babylon/babylon_api.h>
+#include <babylon/maths/vector3.h>
 
 namespace BABYLON {
 
 class AbstractMesh;
 class Collider;
 class Scene;
-class Vector3;
 using AbstractMeshPtr = std::shared_ptr<AbstractMesh>;
 using ColliderPtr     = std::shared_ptr<Collider>;
 
+/**
+ * @brief Move of a collider resolved by ICollisionCoordinator::getNewPositions.
+ */
+struct BABYLON_SHARED_EXPORT ColliderMove {
+  /**
+   * Position of the collider (center of its ellipsoid)
+   */
+  Vector3 position;
+  /**
+   * Requested displacement
+   */
+  Vector3 displacement;
+  /**
+   * Collider to move, its radius must be set and it must not be used by another move of the batch
+   */
+  ColliderPtr collider = nullptr;
+  /**
+   * Maximum number of sliding responses
+   */
+  unsigned int maximumRetry = 3;
+  /**
+   * Mesh moved by the collider if any, it is never collided
+   */
+  AbstractMeshPtr excludedMesh = nullptr;
+  /**
+   * Resolved position, written by getNewPositions
+   */
+  Vector3 newPosition;
+}; // end of struct ColliderMove
+
 /**
  * @brief Hidden
  */
@@ -29,6 +60,7 @@ struct BABYLON_SHARED_EXPORT ICollisionCoordinator {
       onNewPosition,
     size_t collisionIndex)
     = 0;
+  virtual void getNewPositions(std::vector<ColliderMove>& moves) = 0;
   virtual void init(Scene* scene) = 0;
 }; // end of struct ICollisionCoordinator
 
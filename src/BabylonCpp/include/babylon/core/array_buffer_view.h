@@ -3,6 +3,7 @@
 
 #include <babylon/babylon_api.h>
 #include <babylon/babylon_common.h>
+#include <babylon/core/mapped_array_buffer.h>
 
 namespace BABYLON {
 
@@ -16,6 +17,9 @@ namespace BABYLON {
  *  - Int32Array,
  *  - Uint32Array,
  *  - Float32Array,
+ *
+ * A view can also reference a slice of a MappedArrayBuffer, in which case no
+ * copy of the data is made until a mutable Uint8Array is requested.
  */
 class BABYLON_SHARED_EXPORT ArrayBufferView {
 
@@ -26,6 +30,7 @@ public:
   ArrayBufferView(const Uint16Array& buffer);
   ArrayBufferView(const Uint32Array& buffer);
   ArrayBufferView(const Float32Array& buffer);
+  ArrayBufferView(const MappedArrayBuffer& mappedArrayBuffer);
   ArrayBufferView(const ArrayBufferView& other);
   ArrayBufferView(ArrayBufferView&& other);
   ArrayBufferView& operator=(const ArrayBufferView& other);
@@ -35,6 +40,43 @@ public:
   [[nodiscard]] size_t byteLength() const;
   operator bool() const;
 
+  /**
+   * @brief Returns a pointer to the first byte of the view.
+   */
+  [[nodiscard]] const uint8_t* data() const;
+
+  /**
+   * @brief Returns whether the view references a MappedArrayBuffer slice.
+   */
+  [[nodiscard]] bool isMapped() const;
+
+  /**
+   * @brief Returns a view on a sub-range of this view. When this view
+   * references a MappedArrayBuffer, the returned view shares its storage,
+   * otherwise the bytes are copied.
+   * @param subByteOffset offset of the sub-range, in bytes
+   * @param subByteLength length of the sub-range, in bytes
+   * @returns the sub view
+   */
+  [[nodiscard]] ArrayBufferView subView(size_t subByteOffset, size_t subByteLength) const;
+
+  /**
+   * @brief Copies length elements of type T, starting at elementByteOffset,
+   * into a newly allocated typed array (without converting the whole view).
+   */
+  template <typename T>
+  std::vector<T> typedArray(size_t elementByteOffset, size_t length) const
+  {
+    if (elementByteOffset + length * sizeof(T) > byteLength()) {
+      throw std::out_of_range("ArrayBufferView: typed array out of range");
+    }
+    std::vector<T> result(length);
+    if (length > 0) {
+      std::memcpy(result.data(), data() + elementByteOffset, length * sizeof(T));
+    }
+    return result;
+  }
+
   Uint8Array& uint8Array();
   const Uint8Array& uint8Array() const;
   Int8Array int8Array() const;
@@ -47,14 +89,19 @@ public:
 public:
   size_t byteOffset = 0;
 
+private:
+  template <typename T>
+  std::vector<T> _toTypedArray() const;
+
 private:
   Int8Array _int8Array;
-  Uint8Array _uint8Array;
+  mutable Uint8Array _uint8Array;
   Int16Array _int16Array;
   Uint16Array _uint16Array;
   Int32Array _int32Array;
   Uint32Array _uint32Array;
   Float32Array _float32Array;
+  MappedArrayBuffer _mappedArrayBuffer;
 
 }; // end of class ArrayBufferView
 
@@ -201,6 +201,24 @@ inline bool writeFileContents(const char* filename, const std::string& contents)
   return writtentoFile;
 }
 
+/**
+ * @brief Writes the given byte array to a file.
+ * @param filename The path of the file to write to.
+ * @param contents The contents to write to the file.
+ * @return Whether or not the content was written to the file.
+ */
+inline bool writeBinaryFile(const char* filename, const ArrayBuffer& contents)
+{
+  std::ofstream out(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!out) {
+    return false;
+  }
+  out.write(reinterpret_cast<const char*>(contents.data()),
+            static_cast<std::streamsize>(contents.size()));
+  out.close();
+  return !out.fail();
+}
+
 /**
  * @brief Writes the given vector of strings to a file.
  * @param filename The path of the file to read from.
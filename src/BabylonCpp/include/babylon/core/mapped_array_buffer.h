@@ -0,0 +1,104 @@
+#ifndef BABYLON_CORE_MAPPED_ARRAY_BUFFER_H
+#define BABYLON_CORE_MAPPED_ARRAY_BUFFER_H
+
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Read-only, reference-counted byte buffer.
+ *
+ * The bytes are either memory mapped from a file or owned on the heap. Slices
+ * share the storage of the buffer they were taken from, so that large binary
+ * assets (.glb, .bin) can be split into buffer views without any copy. The
+ * storage is released when the last slice referencing it is destroyed.
+ */
+class BABYLON_SHARED_EXPORT MappedArrayBuffer {
+
+private:
+  struct Storage;
+
+public:
+  /**
+   * @brief Maps the given file in memory (falls back to reading it on the heap
+   * when memory mapping is not available).
+   * @param filename path of the file to map
+   * @returns the mapped buffer, or an empty buffer if the file cannot be opened
+   */
+  static MappedArrayBuffer FromFile(const std::string& filename);
+
+  MappedArrayBuffer();
+
+  /**
+   * @brief Constructor, takes ownership of the given heap buffer.
+   * @param buffer the buffer to wrap
+   */
+  MappedArrayBuffer(ArrayBuffer&& buffer);
+
+  MappedArrayBuffer(const MappedArrayBuffer& other);
+  MappedArrayBuffer(MappedArrayBuffer&& other);
+  MappedArrayBuffer& operator=(const MappedArrayBuffer& other);
+  MappedArrayBuffer& operator=(MappedArrayBuffer&& other);
+  ~MappedArrayBuffer(); // = default
+
+  /**
+   * @brief Returns a view on a sub-range of this buffer, sharing its storage.
+   * @param byteOffset offset of the slice, relative to this buffer
+   * @param byteLength length of the slice in bytes
+   * @returns the slice
+   */
+  [[nodiscard]] MappedArrayBuffer slice(size_t byteOffset, size_t byteLength) const;
+
+  [[nodiscard]] const uint8_t* data() const;
+  [[nodiscard]] size_t byteLength() const;
+  [[nodiscard]] bool isMemoryMapped() const;
+  explicit operator bool() const;
+
+  /**
+   * @brief Copies the content of this buffer into a newly allocated ArrayBuffer.
+   */
+  [[nodiscard]] ArrayBuffer toArrayBuffer() const;
+
+  /**
+   * @brief Copies length elements of type T, starting at byteOffset, into a
+   * newly allocated typed array.
+   */
+  template <typename T>
+  std::vector<T> toTypedArray(size_t byteOffset, size_t length) const
+  {
+    if (byteOffset + length * sizeof(T) > _byteLength) {
+      throw std::out_of_range("MappedArrayBuffer: typed array out of range");
+    }
+    std::vector<T> typedArray(length);
+    if (length > 0) {
+      std::memcpy(typedArray.data(), data() + byteOffset, length * sizeof(T));
+    }
+    return typedArray;
+  }
+
+  template <typename T>
+  std::vector<T> toTypedArray() const
+  {
+    return toTypedArray<T>(0, _byteLength / sizeof(T));
+  }
+
+private:
+  static std::shared_ptr<Storage> _MapFile(const std::string& filename);
+  MappedArrayBuffer(const std::shared_ptr<const Storage>& storage, size_t byteOffset,
+                    size_t byteLength);
+
+private:
+  std::shared_ptr<const Storage> _storage;
+  size_t _byteOffset;
+  size_t _byteLength;
+
+}; // end of class MappedArrayBuffer
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CORE_MAPPED_ARRAY_BUFFER_H
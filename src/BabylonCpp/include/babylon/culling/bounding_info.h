@@ -148,7 +148,6 @@ public:
 
 private:
   bool _isLocked;
-  static std::array<Vector3, 2> TmpVector3;
 
 }; // end of class BoundingInfo
 
@@ -0,0 +1,282 @@
+#ifndef BABYLON_CULLING_BVH_BVH_H
+#define BABYLON_CULLING_BVH_BVH_H
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/culling/ray.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Axis aligned bounds of a BVH node or primitive.
+ */
+struct BABYLON_SHARED_EXPORT BVHBounds {
+  /**
+   * @brief Returns bounds containing nothing, never hit by a ray.
+   */
+  static BVHBounds Empty();
+
+  /**
+   * @brief Returns the bounds of a box defined by its minimum and maximum.
+   */
+  static BVHBounds FromMinMax(const Vector3& minimum, const Vector3& maximum);
+
+  /**
+   * @brief Grows the bounds to contain the given bounds.
+   */
+  void extend(const BVHBounds& other);
+
+  /**
+   * @brief Returns whether the bounds contain nothing.
+   */
+  [[nodiscard]] bool isEmpty() const;
+
+  bool operator==(const BVHBounds& other) const;
+  bool operator!=(const BVHBounds& other) const;
+
+  std::array<float, 3> minimum;
+  std::array<float, 3> maximum;
+}; // end of struct BVHBounds
+
+/**
+ * @brief Node of a BVH, stored in a flat array.
+ */
+struct BABYLON_SHARED_EXPORT BVHNode {
+  BVHBounds bounds;
+  /**
+   * Index of the first child of an inner node (the second child follows it), or index of the
+   * first primitive of a leaf in the primitives array
+   */
+  uint32_t first;
+  /**
+   * Number of primitives of a leaf, 0 for an inner node
+   */
+  uint32_t count;
+}; // end of struct BVHNode
+
+/**
+ * @brief Bounding volume hierarchy over a set of primitives given by their bounds.
+ *
+ * The nodes are stored in a flat array and the primitives of a leaf are contiguous in the
+ * primitives array. The tree is split at the median of the primitive centers along the longest
+ * axis, so its depth is logarithmic even for degenerated inputs. Moved primitives are refitted
+ * without rebuilding the tree.
+ */
+class BABYLON_SHARED_EXPORT BVH {
+
+public:
+  static constexpr size_t MaxDepth = 64;
+
+public:
+  BVH();
+  ~BVH(); // = default
+
+  /**
+   * @brief Builds the hierarchy.
+   * @param primitiveBounds defines the bounds of each primitive
+   * @param maxLeafSize defines the maximum number of primitives of a leaf
+   */
+  void build(const std::vector<BVHBounds>& primitiveBounds, size_t maxLeafSize = 4);
+
+  /**
+   * @brief Removes all the nodes and primitives.
+   */
+  void clear();
+
+  /**
+   * @brief Updates the bounds of a primitive and of the nodes containing it.
+   * @param primitive defines the index of the primitive
+   * @param bounds defines the new bounds of the primitive
+   */
+  void refit(size_t primitive, const BVHBounds& bounds);
+
+  /**
+   * @brief Returns the number of primitives of the hierarchy.
+   */
+  [[nodiscard]] size_t size() const;
+
+  /**
+   * @brief Returns the bounds of a primitive.
+   */
+  [[nodiscard]] const BVHBounds& primitiveBounds(size_t primitive) const;
+
+  /**
+   * @brief Returns the nodes of the hierarchy, the root node first.
+   */
+  [[nodiscard]] const std::vector<BVHNode>& nodes() const;
+
+  /**
+   * @brief Visits the primitives whose leaf is hit by a ray, the nearest leaves first.
+   * @param ray defines the ray to test with
+   * @param maxDistance defines the maximum distance along the ray direction, the visitor can
+   * lower it when it finds a hit so that the farther nodes are skipped
+   * @param visitor defines the function called with the index of each primitive, returning true
+   * to stop the traversal
+   * @returns whether the traversal was stopped by the visitor
+   */
+  template <typename Visitor>
+  bool intersectsRay(const Ray& ray, float& maxDistance, Visitor&& visitor) const
+  {
+    if (_nodes.empty()) {
+      return false;
+    }
+
+    const auto rayData = _PrepareRay(ray);
+    auto distance      = 0.f;
+    if (!_IntersectsBounds(rayData, _nodes[0].bounds, maxDistance, distance)) {
+      return false;
+    }
+
+    // Depth first traversal with an explicit stack, the nearest child is visited first
+    std::array<std::pair<uint32_t, float>, MaxDepth> stack;
+    size_t stackSize   = 0;
+    stack[stackSize++] = {0u, distance};
+    while (stackSize > 0) {
+      const auto [nodeIndex, nodeDistance] = stack[--stackSize];
+      if (nodeDistance > maxDistance) {
+        continue;
+      }
+
+      const auto& node = _nodes[nodeIndex];
+      if (node.count > 0) {
+        for (uint32_t i = node.first; i < node.first + node.count; ++i) {
+          if (visitor(_primitives[i])) {
+            return true;
+          }
+        }
+        continue;
+      }
+
+      auto distance0 = 0.f, distance1 = 0.f;
+      const auto& bounds0 = _nodes[node.first].bounds;
+      const auto& bounds1 = _nodes[node.first + 1].bounds;
+      const auto hit0     = _IntersectsBounds(rayData, bounds0, maxDistance, distance0);
+      const auto hit1     = _IntersectsBounds(rayData, bounds1, maxDistance, distance1);
+      if (hit0 && hit1) {
+        if (distance0 <= distance1) {
+          stack[stackSize++] = {node.first + 1, distance1};
+          stack[stackSize++] = {node.first, distance0};
+        }
+        else {
+          stack[stackSize++] = {node.first, distance0};
+          stack[stackSize++] = {node.first + 1, distance1};
+        }
+      }
+      else if (hit0) {
+        stack[stackSize++] = {node.first, distance0};
+      }
+      else if (hit1) {
+        stack[stackSize++] = {node.first + 1, distance1};
+      }
+    }
+
+    return false;
+  }
+
+  /**
+   * @brief Visits the primitives whose bounds overlap the given bounds.
+   * @param bounds defines the bounds to test with
+   * @param visitor defines the function called with the index of each primitive, returning true
+   * to stop the traversal
+   * @returns whether the traversal was stopped by the visitor
+   */
+  template <typename Visitor>
+  bool intersectsBounds(const BVHBounds& bounds, Visitor&& visitor) const
+  {
+    if (_nodes.empty() || !_Overlaps(_nodes[0].bounds, bounds)) {
+      return false;
+    }
+
+    std::array<uint32_t, MaxDepth> stack;
+    size_t stackSize   = 0;
+    stack[stackSize++] = 0u;
+    while (stackSize > 0) {
+      const auto& node = _nodes[stack[--stackSize]];
+      if (node.count > 0) {
+        for (uint32_t i = node.first; i < node.first + node.count; ++i) {
+          const auto primitive = _primitives[i];
+          if (_Overlaps(_primitiveBounds[primitive], bounds) && visitor(primitive)) {
+            return true;
+          }
+        }
+        continue;
+      }
+
+      if (_Overlaps(_nodes[node.first + 1].bounds, bounds)) {
+        stack[stackSize++] = node.first + 1;
+      }
+      if (_Overlaps(_nodes[node.first].bounds, bounds)) {
+        stack[stackSize++] = node.first;
+      }
+    }
+
+    return false;
+  }
+
+private:
+  struct RayData {
+    std::array<float, 3> origin;
+    std::array<float, 3> inverseDirection;
+    std::array<bool, 3> parallel;
+  }; // end of struct RayData
+
+  static RayData _PrepareRay(const Ray& ray);
+
+  /**
+   * Slab test of the bounds, the far distance is slightly enlarged so that the rounding errors
+   * never reject the bounds of a primitive hit at their boundary
+   */
+  static bool _IntersectsBounds(const RayData& ray, const BVHBounds& bounds, float maxDistance,
+                                float& distance)
+  {
+    auto nearDistance = 0.f, farDistance = maxDistance;
+    for (unsigned int axis = 0; axis < 3; ++axis) {
+      if (ray.parallel[axis]) {
+        if (ray.origin[axis] < bounds.minimum[axis] || ray.origin[axis] > bounds.maximum[axis]) {
+          return false;
+        }
+        continue;
+      }
+      const auto inverseDirection = ray.inverseDirection[axis];
+      const auto& nearPlane       = inverseDirection >= 0.f ? bounds.minimum : bounds.maximum;
+      const auto& farPlane        = inverseDirection >= 0.f ? bounds.maximum : bounds.minimum;
+
+      const auto t0 = (nearPlane[axis] - ray.origin[axis]) * inverseDirection;
+      const auto t1 = (farPlane[axis] - ray.origin[axis]) * inverseDirection * 1.0000004f;
+      nearDistance  = std::max(nearDistance, t0);
+      farDistance   = std::min(farDistance, t1);
+      if (nearDistance > farDistance) {
+        return false;
+      }
+    }
+    distance = nearDistance;
+    return true;
+  }
+
+  /**
+   * Overlap test of two bounds, touching bounds overlap and empty bounds never do
+   */
+  static bool _Overlaps(const BVHBounds& a, const BVHBounds& b)
+  {
+    return a.minimum[0] <= b.maximum[0] && b.minimum[0] <= a.maximum[0]
+           && a.minimum[1] <= b.maximum[1] && b.minimum[1] <= a.maximum[1]
+           && a.minimum[2] <= b.maximum[2] && b.minimum[2] <= a.maximum[2];
+  }
+
+private:
+  std::vector<BVHNode> _nodes;
+  std::vector<uint32_t> _parents;
+  std::vector<uint32_t> _primitives;
+  std::vector<uint32_t> _primitiveLeaves;
+  std::vector<BVHBounds> _primitiveBounds;
+
+}; // end of class BVH
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CULLING_BVH_BVH_H
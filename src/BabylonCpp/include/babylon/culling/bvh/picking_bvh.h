@@ -0,0 +1,116 @@
+#ifndef BABYLON_CULLING_BVH_PICKING_BVH_H
+#define BABYLON_CULLING_BVH_PICKING_BVH_H
+
+#include <memory>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/culling/bvh/bvh.h>
+
+namespace BABYLON {
+
+class AbstractMesh;
+class PickingBVH;
+using AbstractMeshPtr = std::shared_ptr<AbstractMesh>;
+using PickingBVHPtr   = std::unique_ptr<PickingBVH>;
+
+/**
+ * @brief Top level BVH of a scene, over the world bounding boxes of its meshes.
+ *
+ * The primitives are the indices of the meshes in Scene::meshes. It is shared by the picking and
+ * the collisions broadphase. A mesh whose bounding info is updated marks itself dirty and is
+ * refitted at the next query. The meshes added since the last build are tested one by one, a
+ * removal or too many additions rebuild the hierarchy.
+ */
+class BABYLON_SHARED_EXPORT PickingBVH {
+
+public:
+  PickingBVH();
+  ~PickingBVH(); // = default
+
+  /**
+   * @brief Synchronizes the hierarchy with the meshes of the scene.
+   * @param meshes defines the meshes of the scene
+   */
+  void update(const std::vector<AbstractMeshPtr>& meshes);
+
+  /**
+   * @brief Flags a mesh whose world bounding box changed. Distinct meshes can be flagged from
+   * different threads.
+   * @param mesh defines the mesh to refit
+   */
+  void markDirty(AbstractMesh* mesh);
+
+  /**
+   * @brief Rebuilds the hierarchy at the next update, used when a mesh is removed from the scene.
+   */
+  void markForRebuild();
+
+  /**
+   * @brief Returns the number of builds of the hierarchy.
+   */
+  [[nodiscard]] size_t buildCount() const;
+
+  /**
+   * @brief Visits the meshes whose world bounding box is hit by a ray (in world space), the
+   * nearest ones first, then the meshes added since the last build.
+   * @param ray defines the ray to test with
+   * @param maxDistance defines the maximum distance along the ray direction, the visitor can
+   * lower it when it finds a hit
+   * @param visitor defines the function called with the index of each mesh in the meshes of the
+   * scene, returning true to stop the traversal
+   */
+  template <typename Visitor>
+  void intersectsRay(const Ray& ray, float& maxDistance, Visitor&& visitor) const
+  {
+    if (_bvh.intersectsRay(ray, maxDistance, visitor)) {
+      return;
+    }
+    for (auto index = _meshes.size(); index < _meshCount; ++index) {
+      if (visitor(static_cast<uint32_t>(index))) {
+        return;
+      }
+    }
+  }
+
+  /**
+   * @brief Visits the meshes whose world bounding box overlaps the given bounds (in world space),
+   * then the meshes added since the last build.
+   * @param bounds defines the bounds to test with
+   * @param visitor defines the function called with the index of each mesh in the meshes of the
+   * scene, returning true to stop the traversal
+   */
+  template <typename Visitor>
+  void intersectsBounds(const BVHBounds& bounds, Visitor&& visitor) const
+  {
+    if (_bvh.intersectsBounds(bounds, visitor)) {
+      return;
+    }
+    for (auto index = _meshes.size(); index < _meshCount; ++index) {
+      if (visitor(static_cast<uint32_t>(index))) {
+        return;
+      }
+    }
+  }
+
+private:
+  void _build(const std::vector<AbstractMeshPtr>& meshes);
+  static BVHBounds _GetBounds(AbstractMesh* mesh);
+
+private:
+  BVH _bvh;
+  // Meshes of the hierarchy, in the order of the meshes of the scene
+  std::vector<AbstractMesh*> _meshes;
+  // One flag per mesh of the hierarchy, written by markDirty
+  std::vector<uint8_t> _dirtyFlags;
+  // Number of meshes of the scene at the last update
+  size_t _meshCount;
+  size_t _refitCount;
+  size_t _buildCount;
+  bool _needsRebuild;
+
+}; // end of class PickingBVH
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CULLING_BVH_PICKING_BVH_H
@@ -0,0 +1,93 @@
+#ifndef BABYLON_CULLING_BVH_TRIANGLE_BVH_H
+#define BABYLON_CULLING_BVH_TRIANGLE_BVH_H
+
+#include <functional>
+#include <memory>
+#include <optional>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/culling/bvh/bvh.h>
+
+namespace BABYLON {
+
+class IntersectionInfo;
+class TriangleBVH;
+using TriangleBVHPtr = std::unique_ptr<TriangleBVH>;
+
+/**
+ * @brief BVH over the triangles of a geometry, used to pick its submeshes and to collide with them.
+ *
+ * The hierarchy is built in the local space of the geometry from its points array and indices, it
+ * is shared by all the meshes and instances using the geometry and discarded when its positions or
+ * indices change.
+ */
+class BABYLON_SHARED_EXPORT TriangleBVH {
+
+public:
+  using TrianglePickingPredicate
+    = std::function<bool(const Vector3& p0, const Vector3& p1, const Vector3& p2, const Ray& ray)>;
+
+  /**
+   * Geometries with less triangles are picked by testing all their triangles
+   */
+  static constexpr size_t MinTriangleCount = 64;
+
+public:
+  /**
+   * @brief Builds the BVH of an indexed triangle list.
+   * @param positions defines the points array of the geometry
+   * @param indices defines the indices of the geometry, 3 per triangle
+   */
+  TriangleBVH(const std::vector<Vector3>& positions, const IndicesArray& indices);
+  ~TriangleBVH(); // = default
+
+  /**
+   * @brief Returns the number of triangles of the BVH.
+   */
+  [[nodiscard]] size_t triangleCount() const;
+
+  /**
+   * @brief Returns the indices the BVH was built from.
+   */
+  [[nodiscard]] const IndicesArray& indices() const;
+
+  /**
+   * @brief Tests the triangles of a submesh against a ray (in the local space of the geometry).
+   * The closest hit is the same as the one of a test of all the triangles in the index order,
+   * the fast check returns the first hit found in the hierarchy.
+   * @param ray defines the ray to test with
+   * @param positions defines the points array the BVH was built from
+   * @param indexStart defines the first index of the submesh
+   * @param indexCount defines the number of indices of the submesh
+   * @param fastCheck defines if the first hit can be returned instead of the closest one
+   * @param trianglePredicate defines an optional predicate used to select the triangles
+   * @returns the intersection info of the hit triangle if any
+   */
+  std::optional<IntersectionInfo>
+  intersects(Ray& ray, const std::vector<Vector3>& positions, size_t indexStart,
+             size_t indexCount, bool fastCheck,
+             const TrianglePickingPredicate& trianglePredicate = nullptr) const;
+
+  /**
+   * @brief Visits the triangles whose bounds overlap the given bounds (in the local space of the
+   * geometry), used as the broadphase of the collisions.
+   * @param bounds defines the bounds to test with
+   * @param visitor defines the function called with the index of each triangle, returning true to
+   * stop the traversal
+   */
+  template <typename Visitor>
+  void intersectsBounds(const BVHBounds& bounds, Visitor&& visitor) const
+  {
+    _bvh.intersectsBounds(bounds, visitor);
+  }
+
+private:
+  BVH _bvh;
+  IndicesArray _indices;
+
+}; // end of class TriangleBVH
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CULLING_BVH_TRIANGLE_BVH_H
@@ -16,14 +16,13 @@ class OctreeBlock;
 template <class T>
 struct BABYLON_SHARED_EXPORT IOctreeContainer {
   /**
-   * Blocks within the octree
+   * Blocks within the octree, stored in a flat array: the 8 first blocks are
+   * the top level blocks and the inner blocks of a block are stored as 8
+   * contiguous blocks
    */
-  static std::vector<OctreeBlock<T>> blocks;
+  std::vector<OctreeBlock<T>> blocks;
 }; // end of struct IOctreeContainer<T>
 
-template <class T>
-std::vector<OctreeBlock<T>> IOctreeContainer<T>::blocks;
-
 } // end of namespace BABYLON
 
 #endif // end of BABYLON_CULLING_OCTREES_IOCTREE_CONTAINER_H
@@ -1,7 +1,9 @@
 #ifndef BABYLON_CULLING_OCTREES_OCTREE_H
 #define BABYLON_CULLING_OCTREES_OCTREE_H
 
+#include <array>
 #include <functional>
+#include <unordered_map>
 
 #include <babylon/babylon_api.h>
 #include <babylon/culling/octrees/ioctree_container.h>
@@ -34,9 +36,8 @@ public:
    * precedence over capacity.)
    */
   Octree();
-  Octree(
-    const std::function<void(T& entry, OctreeBlock<T>& block)>& creationFunc,
-    std::size_t maxBlockCapacity = 64, std::size_t maxDepth = 2);
+  Octree(const std::function<void(T& entry, OctreeBlock<T>& block)>& creationFunc,
+         std::size_t maxBlockCapacity = 64, std::size_t maxDepth = 2);
   ~Octree(); // = default
 
   /** Methods **/
@@ -67,12 +68,18 @@ public:
    */
   void removeMesh(T& entry);
 
+  /**
+   * @brief Reinserts an element which moved, without rebuilding the octree.
+   * @param entry defines the element to update
+   */
+  void updateMesh(T& entry);
+
   /**
    * @brief Selects an array of meshes within the frustum.
    * @param frustumPlanes The frustum planes to use which will select all meshes
    * within it
    * @param allowDuplicate If duplicate objects are allowed in the resulting
-   * object array
+   * object array (duplicates are removed without sorting the selection)
    * @returns array of meshes within the frustum
    */
   std::vector<T>& select(const std::array<Plane, 6>& frustumPlanes,
@@ -125,11 +132,37 @@ public:
    */
   std::size_t maxDepth;
 
+private:
+  /**
+   * Bounding boxes of 8 sibling blocks, stored as arrays of components so that
+   * the 8 blocks are tested at once
+   */
+  struct alignas(32) BlocksBounds {
+    std::array<float, 8> centerX, centerY, centerZ;
+    std::array<float, 8> extendX, extendY, extendZ;
+  }; // end of struct BlocksBounds
+
+  size_t _createBlocks(const Vector3& worldMin, const Vector3& worldMax, size_t depth);
+  void _createInnerBlocks(size_t blockIndex);
+  void _addEntry(size_t blockIndex, T& entry);
+  void _appendEntries(const std::vector<T>& entries, size_t selectionId);
+  static void _IntersectsFrustum(const BlocksBounds& bounds,
+                                 const std::array<Plane, 6>& frustumPlanes,
+                                 std::array<float, 8>& result);
+  static void _IntersectsSphere(const BlocksBounds& bounds, const Vector3& sphereCenter,
+                                float sphereRadius, std::array<float, 8>& result);
+
 private:
   std::size_t _maxBlockCapacity;
 
   std::vector<T> _selectionContent;
   std::function<void(T&, OctreeBlock<T>&)> _creationFunc;
+  // Bounds of the blocks, one entry per group of 8 sibling blocks
+  std::vector<BlocksBounds> _blocksBounds;
+  // Leaf blocks containing each entry
+  std::unordered_map<T, std::vector<size_t>> _entryBlocks;
+  // Traversal stack, first block of the groups to visit
+  std::vector<size_t> _blocksToVisit;
 
 }; // end of class Octree
 
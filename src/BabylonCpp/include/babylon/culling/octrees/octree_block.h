@@ -1,23 +1,33 @@
 #ifndef BABYLON_CULLING_OCTREES_OCTREE_BLOCK_H
 #define BABYLON_CULLING_OCTREES_OCTREE_BLOCK_H
 
-#include <functional>
+#include <limits>
+#include <vector>
 
 #include <babylon/babylon_api.h>
-#include <babylon/culling/octrees/ioctree_container.h>
 #include <babylon/maths/vector3.h>
 
 namespace BABYLON {
 
-class Plane;
-class Ray;
+template <class T>
+class Octree;
 
 /**
  * @brief Class used to store a cell in an octree.
+ * The blocks are stored in the flat blocks array of their octree, which
+ * subdivides and traverses them.
  * @see http://doc.babylonjs.com/how_to/optimizing_your_scene_with_octrees
  */
 template <class T>
-class BABYLON_SHARED_EXPORT OctreeBlock : public IOctreeContainer<T> {
+class BABYLON_SHARED_EXPORT OctreeBlock {
+
+  friend class Octree<T>;
+
+public:
+  /**
+   * Value of innerBlocksStart() when the block is not subdivided
+   */
+  static constexpr size_t NoInnerBlocks = std::numeric_limits<size_t>::max();
 
 public:
   /**
@@ -31,11 +41,9 @@ public:
    * @param depth defines the current depth of this block in the octree
    * @param maxDepth defines the maximal depth allowed (beyond this value, the
    * capacity is ignored)
-   * @param creationFunc defines a callback to call when an element is added to
-   * the block
    */
   OctreeBlock(const Vector3& minPoint, const Vector3& maxPoint, size_t capacity, size_t depth,
-              size_t maxDepth, const std::function<void(T&, OctreeBlock<T>&)>& creationFunc);
+              size_t maxDepth);
   ~OctreeBlock(); // = default
 
   /** Properties **/
@@ -57,73 +65,28 @@ public:
    */
   Vector3& maxPoint();
 
-  /** Methods **/
-
-  /**
-   * @brief Add a new element to this block.
-   * @param entry defines the element to add
-   */
-  void addEntry(T& entry);
-
-  /**
-   * @brief Remove an element from this block.
-   * @param entry defines the element to remove
-   */
-  void removeEntry(T& entry);
-
-  /**
-   * @brief Add an array of elements to this block.
-   * @param entries defines the array of elements to add
-   */
-  void addEntries(std::vector<T>& entries);
-
-  /**
-   * @brief Test if the current block intersects the furstum planes and if yes,
-   * then add its content to the selection array.
-   * @param frustumPlanes defines the frustum planes to test
-   * @param selection defines the array to store current content if selection is
-   * positive
-   * @param allowDuplicate defines if the selection array can contains
-   * duplicated entries
-   */
-  void select(const std::array<Plane, 6>& frustumPlanes, std::vector<T>& selection,
-              bool allowDuplicate = true);
-
   /**
-   * @brief Test if the current block intersect with the given bounding sphere
-   * and if yes, then add its content to the selection array.
-   * @param sphereCenter defines the bounding sphere center
-   * @param sphereRadius defines the bounding sphere radius
-   * @param selection defines the array to store current content if selection is
-   * positive
-   * @param allowDuplicate defines if the selection array can contains
-   * duplicated entries
+   * @brief Gets the depth of this block in the octree (the top level blocks
+   * have a depth of 1).
    */
-  void intersects(const Vector3& sphereCenter, float sphereRadius, std::vector<T>& selection,
-                  bool allowDuplicate = true);
+  [[nodiscard]] size_t depth() const;
 
   /**
-   * @brief Test if the current block intersect with the given ray and if yes,
-   * then add its content to the selection array.
-   * @param ray defines the ray to test with
-   * @param selection defines the array to store current content if selection is
-   * positive
+   * @brief Gets the index in the octree blocks of the first of the 8 inner
+   * blocks of this block, or NoInnerBlocks if the block is a leaf.
    */
-  void intersectsRay(const Ray& ray, std::vector<T>& selection);
+  [[nodiscard]] size_t innerBlocksStart() const;
 
   /**
-   * @brief Subdivide the content into child blocks (this block will then be
-   * empty).
+   * @brief Returns whether the content was subdivided into inner blocks.
    */
-  void createInnerBlocks();
+  [[nodiscard]] bool hasInnerBlocks() const;
 
   /**
-   * @brief Hidden
+   * @brief Returns whether the block exceeds its capacity and can still be
+   * subdivided.
    */
-  static void _CreateBlocks(const Vector3& worldMin, const Vector3& worldMax,
-                            std::vector<T>& entries, size_t maxBlockCapacity, size_t currentDepth,
-                            size_t maxDepth, IOctreeContainer<T>& target,
-                            const std::function<void(T&, OctreeBlock<T>&)>& creationFunc);
+  [[nodiscard]] bool mustBeSubdivided() const;
 
 public:
   /**
@@ -137,8 +100,7 @@ private:
   size_t _capacity;
   Vector3 _minPoint;
   Vector3 _maxPoint;
-  std::array<Vector3, 8> _boundingVectors;
-  std::function<void(T&, OctreeBlock<T>&)> _creationFunc;
+  size_t _innerBlocksStart;
 
 }; // end of class OctreeBlock
 
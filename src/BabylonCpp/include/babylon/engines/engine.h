@@ -19,6 +19,7 @@ class OcclusionQueryExtension;
 class PostProcess;
 class RawTextureExtension;
 class RenderTargetTexture;
+struct TextureLoadTiming;
 class TransformFeedbackExtension;
 using ArrayBufferViewArray      = std::vector<ArrayBufferView>;
 using WebGLQuery                = GL::IGLQuery;
@@ -921,7 +922,8 @@ public:
   // Loading screen
 
   /**
-   * @brief Display the loading screen.
+   * @brief Display the loading screen. The timings of the images uploaded by the texture pipeline
+   * are reported to the loading screen until it is hidden.
    * @see http://doc.babylonjs.com/how_to/creating_a_custom_loading_screen
    */
   virtual void displayLoadingUI();
@@ -1460,6 +1462,10 @@ private:
   WebGLFramebufferPtr _dummyFramebuffer = nullptr;
   PostProcessPtr _rescalePostProcess;
 
+  // Texture timings reported to the loading screen
+  TexturePipelinePtr _loadingScreenTexturePipeline                     = nullptr;
+  Observer<TextureLoadTiming>::Ptr _loadingScreenTextureTimingObserver = nullptr;
+
   // Deterministic lockstepMaxSteps
   bool _deterministicLockstep    = false;
   unsigned int _lockstepMaxSteps = 4;
@@ -213,6 +213,13 @@ public:
    */
   bool isSynchronized();
 
+  /**
+   * @brief Hidden
+   * Returns whether the world matrix was validated by the transform update pass of the current
+   * active meshes evaluation (see Scene::transformUpdatePassEnabled).
+   */
+  [[nodiscard]] bool _isValidatedByTransformUpdate() const;
+
   /**
    * @brief Is this node ready to be used/rendered.
    * @param completeCheck defines if a complete check (including materials and lights) has to be
@@ -505,6 +512,8 @@ public:
   int _currentRenderId;
   std::string parentId;
   int _childUpdateId;
+  /** Hidden */
+  int _transformUpdateId;
   std::string _waitingParentId;
 
   /** Hidden */
@@ -51,6 +51,7 @@ public:
    * @returns the new WebGL static buffer
    */
   WebGLDataBufferPtr createVertexBuffer(const Float32Array& vertices) override;
+  WebGLDataBufferPtr createVertexBuffer(const ArrayBufferView& vertices) override;
 
   /**
    * @brief Creates a new index buffer.
@@ -239,6 +240,14 @@ public:
    */
   void setMatrices(const WebGLUniformLocationPtr& uniform, const Float32Array& matrices) override;
 
+  /**
+   * @brief Set the value of an uniform to a matrix (4x4).
+   * @param uniform defines the webGL uniform location where to store the value
+   * @param matrix defines the 16 floats of the matrix to store
+   */
+  void setMatrix4x4(const WebGLUniformLocationPtr& uniform,
+                    const std::array<float, 16>& matrix) override;
+
   /**
    * @brief Set the value of an uniform to a matrix (3x3).
    * @param uniform defines the webGL uniform location where to store the value
@@ -315,6 +324,16 @@ public:
   void bindBuffers(const std::unordered_map<std::string, VertexBufferPtr>& vertexBuffers,
                    const WebGLDataBufferPtr& indexBuffer, const EffectPtr& effect) override;
 
+  /**
+   * @brief Bind a list of vertex buffers indexed by kind slot.
+   * @param vertexBuffersBySlot defines the vertex buffers to bind, indexed by
+   * VertexBuffer::KindSlot
+   * @param indexBuffer defines the index buffer to bind
+   * @param effect defines the effect associated with the vertex buffers
+   */
+  void bindBuffers(const std::vector<VertexBufferPtr>& vertexBuffersBySlot,
+                   const WebGLDataBufferPtr& indexBuffer, const EffectPtr& effect) override;
+
   /**
    * @brief Force the entire cache to be cleared.
    * You should not have to use this function unless your engine needs to share the webGL context
@@ -565,10 +584,17 @@ public:
   void _uploadImageToTexture(const InternalTexturePtr& texture, const Image& image,
                              unsigned int faceIndex = 0, int lod = 0) override;
 
+  /**
+   * Hidden
+   * Number of times bindBuffers found the binding cache out of date, i.e. the number of times the
+   * vertex buffers would have been bound to a context
+   */
+  size_t _vertexBuffersBindingCount = 0;
+
 protected:
   NullEngine(const NullEngineOptions& options = NullEngineOptions{});
 
-  void _deleteBuffer(GL::IGLBuffer* buffer);
+  void _deleteBuffer(const WebGLDataBufferPtr& buffer) override;
 
 private:
   NullEngineOptions _options;
@@ -1,8 +1,11 @@
 #ifndef BABYLON_ENGINES_PROCESSORS_SHADER_PROCESSOR_H
 #define BABYLON_ENGINES_PROCESSORS_SHADER_PROCESSOR_H
 
+#include <deque>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <variant>
@@ -33,9 +36,33 @@ using ShaderDefineExpressionPtr         = std::shared_ptr<ShaderDefineExpression
 class BABYLON_SHARED_EXPORT ShaderProcessor {
 
 public:
+  /**
+   * Maximum number of processed codes kept in the cache, the oldest ones are evicted first
+   */
+  static constexpr size_t MaxCacheSize = 1024;
+
+  /**
+   * @brief Processes the includes and the preprocessor directives of a shader source code.
+   * The processed code is cached, keyed by the source code with its includes resolved and by the
+   * processing options, so that effects sharing a shader and a set of defines are only processed
+   * once, and a modified include is never served from the cache.
+   * @param sourceCode defines the source code to process
+   * @param options defines the processing options
+   * @param callback defines the callback called with the processed code
+   */
   static void Process(const std::string& sourceCode, ProcessingOptions& options,
                       const std::function<void(const std::string& migratedCode)>& callback);
 
+  /**
+   * @brief Removes all the processed codes from the cache.
+   */
+  static void ClearCache();
+
+  /**
+   * @brief Returns the number of processed codes in the cache.
+   */
+  static size_t CacheSize();
+
   /**
    * @brief Loads a file from a url.
    * @param url url to load
@@ -57,6 +84,16 @@ public:
     = nullptr);
 
 private:
+  /**
+   * Processed code, with the uniform buffer state it leaves in the processing options
+   */
+  struct _ProcessedCode {
+    std::string code;
+    std::optional<bool> lookForClosingBracketForUniformBuffer;
+  };
+
+  static std::string _GetProcessedCodeCacheKey(const std::string& codeWithIncludes,
+                                               const ProcessingOptions& options);
   static std::string _ProcessPrecision(std::string source, const ProcessingOptions& options);
   static ShaderDefineExpressionPtr _ExtractOperation(const std::string& expression);
   static ShaderDefineExpressionPtr _BuildSubExpression(const std::string& expression);
@@ -78,6 +115,12 @@ private:
   static void _ProcessIncludes(const std::string& sourceCode, ProcessingOptions& options,
                                const std::function<void(const std::string& data)>& callback);
 
+private:
+  static std::unordered_map<std::string, _ProcessedCode> _ProcessedCodeCache;
+  // Keys of the cache, in insertion order
+  static std::deque<std::string> _ProcessedCodeCacheKeys;
+  static std::mutex _ProcessedCodeCacheMutex;
+
 }; // end of class ShaderProcessor
 
 } // end of namespace BABYLON
@@ -58,6 +58,7 @@ class KeyboardInfoPre;
 class Mesh;
 class Node;
 class OutlineRenderer;
+class PickingBVH;
 class PostProcess;
 class PostProcessManager;
 class PostProcessRenderPipelineManager;
@@ -206,6 +207,12 @@ public:
    */
   std::vector<SubMesh*> _getDefaultSubMeshCandidates(AbstractMesh* mesh);
 
+  /**
+   * @brief Hidden (Creates the BVH of the meshes if needed and synchronizes it with the meshes,
+   * used by the picking and the collisions broadphase)
+   */
+  PickingBVH& _getPickingBVH();
+
   /**
    * @brief Sets the default candidate providers for the scene.
    * This sets the getActiveMeshCandidates, getActiveSubMeshCandidates,
@@ -284,6 +291,19 @@ public:
    */
   size_t getActiveBones() const;
 
+  /**
+   * @brief Gets the number of world matrices recomputed by the transform update pass per frame.
+   * @returns the number of recomputed world matrices
+   */
+  size_t getWorldMatrixUpdates() const;
+
+  /**
+   * @brief Gets the number of effect, material and geometry changes avoided per frame by the sort
+   * key render queue.
+   * @returns the number of avoided state changes
+   */
+  size_t getAvoidedStateChanges() const;
+
   /** Stats **/
 
   /**
@@ -1505,6 +1525,20 @@ public:
   std::vector<std::optional<PickingInfo>>
   multiPickWithRay(const Ray& ray, const std::function<bool(AbstractMesh* mesh)>& predicate);
 
+  /**
+   * @brief Use the given rays to pick a mesh in the scene for each of them.
+   * @param rays The rays (in world space) to use to pick meshes
+   * @param predicate Predicate function used to determine eligible meshes. Can
+   * be set to null. In this case, a mesh must have isPickable set to true
+   * @param fastCheck Launch a fast check only using the bounding boxes. Can be
+   * set to null
+   * @returns a PickingInfo per ray
+   */
+  std::vector<std::optional<PickingInfo>>
+  pickBatch(const std::vector<Ray>& rays,
+            const std::function<bool(const AbstractMeshPtr& mesh)>& predicate = nullptr,
+            bool fastCheck                                                    = false);
+
   /**
    * @brief Force the value of meshUnderPointer.
    * @param mesh defines the mesh to use
@@ -1800,6 +1834,11 @@ private:
   void _processLateAnimationBindings();
   void _evaluateSubMesh(SubMesh* subMesh, AbstractMesh* mesh, AbstractMesh* initialMesh);
   void _evaluateActiveMeshes();
+  void _updateTransforms();
+  void _evaluateActiveMeshCandidatesInParallel(const std::vector<AbstractMesh*>& meshCandidates);
+  void _evaluateActiveMeshCandidate(AbstractMesh* mesh, const std::optional<bool>& isVisible);
+  void _evaluateActiveSkeletons();
+  [[nodiscard]] bool _isActiveMeshCandidateVisible(AbstractMesh* mesh, bool boundingInfoOnly) const;
   void _activeMesh(AbstractMesh* sourceMesh, AbstractMesh* mesh);
   void _renderForCamera(const CameraPtr& camera, const CameraPtr& rigParent = nullptr);
   void _bindFrameBuffer();
@@ -2183,6 +2222,18 @@ protected:
    */
   PerfCounter& get_activeBonesPerfCounter();
 
+  /**
+   * @brief Gets the performance counter for the world matrices recomputed by the transform update
+   * pass.
+   */
+  PerfCounter& get_worldMatrixUpdatesPerfCounter();
+
+  /**
+   * @brief Gets the performance counter for the state changes avoided by the sort key render
+   * queue.
+   */
+  PerfCounter& get_avoidedStateChangesPerfCounter();
+
   /**
    * @brief Returns a boolean indicating if the scene is still loading data.
    */
@@ -2396,6 +2447,27 @@ public:
    */
   Observable<Scene> onAfterActiveMeshesEvaluationObservable;
 
+  /**
+   * An event triggered when the parallel part of the active meshes evaluation is about to start
+   * (only when parallelActiveMeshesEvaluation is enabled)
+   */
+  Observable<Scene> onBeforeActiveMeshesParallelEvaluationObservable;
+
+  /**
+   * An event triggered when the parallel part of the active meshes evaluation is done
+   */
+  Observable<Scene> onAfterActiveMeshesParallelEvaluationObservable;
+
+  /**
+   * An event triggered when the bone matrices of the active skeletons are about to be computed
+   */
+  Observable<Scene> onBeforeSkeletonsEvaluationObservable;
+
+  /**
+   * An event triggered when the bone matrices of the active skeletons are computed
+   */
+  Observable<Scene> onAfterSkeletonsEvaluationObservable;
+
   /**
    * An event triggered when particles rendering is about to start
    * Note: This event can be trigger more than once per frame (because particles
@@ -2602,6 +2674,63 @@ public:
    */
   Property<Scene, bool> skipFrustumClipping;
 
+  /**
+   * Gets or sets a boolean indicating if the world matrices and the frustum tests of the active
+   * mesh candidates are computed in parallel on the JobPool::Default() workers.
+   * The candidates are still activated and dispatched to the rendering manager serially, in their
+   * original order, so the rendered frame is the same as with the serial evaluation. Meshes using
+   * billboarding, infinite distance, delayed loading or observing their world matrix updates are
+   * always evaluated on the calling thread.
+   */
+  bool parallelActiveMeshesEvaluation;
+
+  /**
+   * Gets or sets a boolean indicating if the bone matrices of the active skeletons are computed in
+   * parallel on the JobPool::Default() workers, one skeleton per job.
+   * The bones linked to transform nodes and the textures of the bone matrices are still updated
+   * on the calling thread. Skeletons observed by their onBeforeComputeObservable are always
+   * evaluated on the calling thread.
+   */
+  bool parallelSkeletonsEvaluation;
+
+  /**
+   * Gets or sets a boolean indicating if the world matrices of the enabled transform nodes and
+   * meshes are updated by a single pass at the beginning of the active meshes evaluation.
+   * The nodes are ordered by depth in the hierarchy so that each world matrix is computed once,
+   * after the one of its parent. Until the end of the evaluation, computeWorldMatrix() calls on
+   * the updated nodes are then cache hits and do not walk up the hierarchy anymore.
+   */
+  bool transformUpdatePassEnabled;
+
+  /**
+   * Gets or sets a boolean indicating if the rendering groups order their submeshes with 64-bit
+   * sort keys (see RenderQueue) instead of the default orders. The opaque and alpha tested
+   * submeshes are grouped by effect, material and geometry, then rendered front to back, to
+   * avoid redundant state changes. The transparent submeshes are rendered by increasing alpha
+   * index, then back to front. The custom sort functions of setRenderingOrder are kept.
+   */
+  bool sortKeyRenderQueueEnabled;
+
+  /**
+   * Hidden
+   * Render id of the running transform update pass, -1 outside of the active meshes evaluation
+   */
+  int _transformUpdateId;
+
+  /**
+   * Gets or sets a boolean indicating if the mesh picking goes through a BVH over the world
+   * bounding boxes of the meshes, refitted when they move.
+   * Only the meshes whose bounding box is hit by the ray are tested, from the nearest to the
+   * farthest. The picked mesh is the same as without the BVH, except with a fast check which
+   * returns the first hit found.
+   */
+  bool pickingBVHEnabled;
+
+  /**
+   * Hidden (Built on the first pick)
+   */
+  std::unique_ptr<PickingBVH> _pickingBVH;
+
   /**
    * Gets a boolean indicating if all rendering must be done in point cloud
    */
@@ -2931,6 +3060,13 @@ public:
    */
   bool collisionsEnabled;
 
+  /**
+   * Gets or sets a boolean indicating if the collisions go through a BVH over the world bounding
+   * boxes of the meshes (shared with the picking) instead of testing all the meshes.
+   * The collisions found are the same.
+   */
+  bool collisionsBroadphaseEnabled;
+
   /** Hidden */
   ReadOnlyProperty<Scene, std::unique_ptr<ICollisionCoordinator>> collisionCoordinator;
 
@@ -3067,6 +3203,10 @@ public:
   PerfCounter _activeParticles;
   /** Hidden */
   PerfCounter _activeBones;
+  /** Hidden */
+  PerfCounter _worldMatrixUpdates;
+  /** Hidden */
+  PerfCounter _avoidedStateChanges;
 
   /**
    * Gets or sets a general scale for animation speed
@@ -3199,6 +3339,16 @@ public:
    */
   ReadOnlyProperty<Scene, PerfCounter> activeBonesPerfCounter;
 
+  /**
+   * Gets the performance counter for the world matrices recomputed by the transform update pass
+   */
+  ReadOnlyProperty<Scene, PerfCounter> worldMatrixUpdatesPerfCounter;
+
+  /**
+   * Gets the performance counter for the state changes avoided by the sort key render queue
+   */
+  ReadOnlyProperty<Scene, PerfCounter> avoidedStateChangesPerfCounter;
+
   /**
    * Returns a boolean indicating if the scene is still loading data
    */
@@ -3545,6 +3695,7 @@ private:
   std::vector<MaterialPtr> _processedMaterials;
   std::vector<RenderTargetTexturePtr> _renderTargets;
   std::vector<SkeletonPtr> _activeSkeletons;
+  size_t _activeSkeletonsEvaluationId;
   std::vector<Mesh*> _softwareSkinnedMeshes;
   std::unique_ptr<RenderingManager> _renderingManager;
   Matrix _transformMatrix;
@@ -28,6 +28,7 @@ struct DepthTextureCreationOptions;
 class DynamicTextureExtension;
 class Color4;
 class Effect;
+struct EffectWarmUpEntry;
 class ICanvasRenderingContext2D;
 struct IEffectCreationOptions;
 struct IFileRequest;
@@ -41,12 +42,14 @@ struct IRenderTargetOptions;
 struct IShaderProcessor;
 struct ISize;
 class MultiRenderExtension;
+class ProgramBinaryCache;
 class ProgressEvent;
 class RenderTargetCubeExtension;
 class RenderTargetExtension;
 class Scene;
 class StencilState;
 class Texture;
+class TexturePipeline;
 class UniformBuffer;
 class UniformBufferExtension;
 class VertexBuffer;
@@ -58,6 +61,8 @@ using IInternalTextureLoaderPtr = std::shared_ptr<IInternalTextureLoader>;
 using InternalTexturePtr        = std::shared_ptr<InternalTexture>;
 using IPipelineContextPtr       = std::shared_ptr<IPipelineContext>;
 using IShaderProcessorPtr       = std::shared_ptr<IShaderProcessor>;
+using ProgramBinaryCachePtr     = std::shared_ptr<ProgramBinaryCache>;
+using TexturePipelinePtr        = std::shared_ptr<TexturePipeline>;
 using VertexBufferPtr           = std::shared_ptr<VertexBuffer>;
 using WebGLBufferPtr            = std::shared_ptr<GL::IGLBuffer>;
 using WebGLDataBufferPtr        = std::shared_ptr<WebGLDataBuffer>;
@@ -332,6 +337,14 @@ public:
    */
   virtual WebGLDataBufferPtr createVertexBuffer(const Float32Array& data);
 
+  /**
+   * @brief Creates a vertex buffer directly from raw bytes (e.g. a memory
+   * mapped buffer view), without creating an intermediate Float32Array.
+   * @param data the data for the vertex buffer
+   * @returns the new WebGL static buffer
+   */
+  virtual WebGLDataBufferPtr createVertexBuffer(const ArrayBufferView& data);
+
   /**
    * @brief Creates a dynamic vertex buffer.
    * @param data the data for the dynamic vertex buffer
@@ -371,6 +384,18 @@ public:
   recordVertexArrayObject(const std::unordered_map<std::string, VertexBufferPtr>& vertexBuffers,
                           const WebGLDataBufferPtr& indexBuffer, const EffectPtr& effect);
 
+  /**
+   * @brief Records a vertex array object from vertex buffers indexed by kind slot.
+   * @param vertexBuffersBySlot defines the vertex buffers to store, indexed by
+   * VertexBuffer::KindSlot
+   * @param indexBuffer defines the index buffer to store
+   * @param effect defines the effect to store
+   * @returns the new vertex array object
+   */
+  WebGLVertexArrayObjectPtr
+  recordVertexArrayObject(const std::vector<VertexBufferPtr>& vertexBuffersBySlot,
+                          const WebGLDataBufferPtr& indexBuffer, const EffectPtr& effect);
+
   /**
    * @brief Bind a specific vertex array object.
    * @see http://doc.babylonjs.com/features/webgl2#vertex-array-objects
@@ -402,6 +427,18 @@ public:
   virtual void bindBuffers(const std::unordered_map<std::string, VertexBufferPtr>& vertexBuffers,
                            const WebGLDataBufferPtr& indexBuffer, const EffectPtr& effect);
 
+  /**
+   * @brief Bind a list of vertex buffers indexed by kind slot to the webGL context.
+   * The effect attributes are resolved through their kind slots so checking the binding cache
+   * only costs one pointer comparison per attribute.
+   * @param vertexBuffersBySlot defines the vertex buffers to bind, indexed by
+   * VertexBuffer::KindSlot
+   * @param indexBuffer defines the index buffer to bind
+   * @param effect defines the effect associated with the vertex buffers
+   */
+  virtual void bindBuffers(const std::vector<VertexBufferPtr>& vertexBuffersBySlot,
+                           const WebGLDataBufferPtr& indexBuffer, const EffectPtr& effect);
+
   /**
    * @brief Unbind all instance attributes.
    */
@@ -539,6 +576,49 @@ public:
     IEffectCreationOptions& options, ThinEngine* engine,
     const std::function<void(const EffectPtr& effect)>& onCompiled = nullptr);
 
+  /**
+   * @brief Sets the persistent cache of the linked programs. Programs are then
+   * loaded from their binary when the cache holds a binary accepted by the
+   * driver, and compiled from source otherwise.
+   * @param programBinaryCache defines the cache to use, null to disable it
+   * @returns whether the cache is used, program binaries are not supported by all drivers
+   */
+  bool setProgramBinaryCache(const ProgramBinaryCachePtr& programBinaryCache);
+
+  /**
+   * @brief Gets the persistent cache of the linked programs.
+   */
+  [[nodiscard]] ProgramBinaryCachePtr programBinaryCache() const;
+
+  /**
+   * @brief Sets the pipeline decoding the images of the textures on worker threads. The decoded
+   * images are then uploaded at the beginning of the next frames, within the upload budget of the
+   * pipeline.
+   * @param texturePipeline defines the pipeline to use, null to decode the images synchronously
+   */
+  void setTexturePipeline(const TexturePipelinePtr& texturePipeline);
+
+  /**
+   * @brief Gets the pipeline decoding the images of the textures.
+   */
+  [[nodiscard]] TexturePipelinePtr texturePipeline() const;
+
+  /**
+   * @brief Gets the effects compiled so far, to be stored and given to warmUpEffects at the next
+   * start.
+   * @returns the list of compiled effects
+   */
+  [[nodiscard]] std::vector<EffectWarmUpEntry> getEffectWarmUpEntries() const;
+
+  /**
+   * @brief Precompiles the programs of a list of effects, typically collected with
+   * getEffectWarmUpEntries during a previous run. A precompiled program is given to the first
+   * effect created with the same final sources, the effects created later compile their own
+   * program.
+   * @param entries defines the effects to precompile
+   */
+  void warmUpEffects(const std::vector<EffectWarmUpEntry>& entries);
+
   /**
    * @brief Directly creates a webGL program.
    * @param pipelineContext  defines the pipeline context to attach to
@@ -692,6 +772,14 @@ public:
    */
   virtual void setMatrices(const WebGLUniformLocationPtr& uniform, const Float32Array& matrices);
 
+  /**
+   * @brief Set the value of an uniform to a matrix (4x4) without copying it to a Float32Array.
+   * @param uniform defines the webGL uniform location where to store the value
+   * @param matrix defines the 16 floats of the matrix to store
+   */
+  virtual void setMatrix4x4(const WebGLUniformLocationPtr& uniform,
+                            const std::array<float, 16>& matrix);
+
   /**
    * @brief Set the value of an uniform to a matrix (3x3).
    * @param uniform defines the webGL uniform location where to store the value
@@ -1586,11 +1674,21 @@ protected:
   /** VBOs **/
   /** @hidden */
   void _resetVertexBufferBinding();
+  /** @hidden */
+  void _resolveVertexBuffers(const std::unordered_map<std::string, VertexBufferPtr>& vertexBuffers,
+                             const EffectPtr& effect);
+  /** @hidden */
+  void _resolveVertexBuffers(const std::vector<VertexBufferPtr>& vertexBuffersBySlot,
+                             const EffectPtr& effect);
+  /** @hidden */
+  bool _updateVertexBuffersCache(const EffectPtr& effect);
+  /** @hidden */
+  void _clearVertexBuffersCache();
   void _resetIndexBufferBinding();
   void _normalizeIndexData(const IndicesArray& indices, Uint16Array& uint16ArrayResult,
                            Uint32Array& uint32ArrayResult);
   void bindIndexBuffer(const WebGLDataBufferPtr& buffer);
-  void _deleteBuffer(const WebGLDataBufferPtr& buffer);
+  virtual void _deleteBuffer(const WebGLDataBufferPtr& buffer);
   /** @hidden */
   virtual void _reportDrawCall();
   static std::string _ConcatenateShader(const std::string& source, const std::string& defines,
@@ -1601,9 +1699,16 @@ protected:
                        WebGLRenderingContext* context,
                        const std::vector<std::string>& transformFeedbackVaryings = {});
   void _finalizePipelineContext(WebGLPipelineContext* pipelineContext);
+  WebGLProgramPtr _getCachedShaderProgram(const WebGLPipelineContextPtr& pipelineContext,
+                                          const std::string& vertexCode,
+                                          const std::string& fragmentCode,
+                                          WebGLRenderingContext* context);
+  WebGLProgramPtr _useLinkedShaderProgram(const WebGLPipelineContextPtr& pipelineContext,
+                                          const WebGLProgramPtr& program,
+                                          WebGLRenderingContext* context);
   void _prepareWebGLTextureContinuation(const InternalTexturePtr& texture, Scene* scene,
                                         bool noMipmap, bool isCompressed,
-                                        unsigned int samplingMode);
+                                        unsigned int samplingMode, bool mipMapsUploaded = false);
   void _deleteTexture(const WebGLTexturePtr& texture);
   void _setProgram(const WebGLProgramPtr& program);
   bool _setTexture(int channel, const BaseTexturePtr& texture, bool isPartOfTextureArray = false,
@@ -1619,20 +1724,28 @@ private:
   void _vertexAttribPointer(const WebGLDataBufferPtr& buffer, unsigned int indx, int size,
                             unsigned int type, bool normalized, int stride, int offset);
   void _bindIndexBufferWithCache(const WebGLDataBufferPtr& indexBuffer);
-  void _bindVertexBuffersAttributes(
-    const std::unordered_map<std::string, VertexBufferPtr>& vertexBuffers, const EffectPtr& effect);
+  void _bindVertexBuffersAttributes(const EffectPtr& effect);
+  WebGLVertexArrayObjectPtr _recordVertexArrayObject(const WebGLDataBufferPtr& indexBuffer,
+                                                     const EffectPtr& effect);
   void _unbindVertexArrayObject();
   unsigned int _drawMode(unsigned int fillMode) const;
   WebGLShaderPtr _compileShader(const std::string& source, const std::string& type,
                                 const std::string& defines, const std::string& shaderVersion);
   WebGLShaderPtr _compileRawShader(const std::string& source, const std::string& type);
   unsigned int _getTextureTarget(const InternalTexturePtr& texture) const;
+  /**
+   * @brief Hidden
+   * @param mipMapsUploaded defines whether the process function uploads the mip levels, in which
+   * case they are not generated (the process function generates them on the branches which cannot
+   * upload them)
+   */
   void _prepareWebGLTexture(
     const InternalTexturePtr& texture, Scene* scene, int width, int height,
     std::optional<bool> invertY, bool noMipmap, bool isCompressed,
     const std::function<bool(int width, int height,
                              const std::function<void()>& continuationCallback)>& processFunction,
-    unsigned int samplingMode = Constants::TEXTURE_TRILINEAR_SAMPLINGMODE);
+    unsigned int samplingMode = Constants::TEXTURE_TRILINEAR_SAMPLINGMODE,
+    bool mipMapsUploaded      = false);
   WebGLRenderbufferPtr _getDepthStencilBuffer(int width, int height, int samples,
                                               unsigned int internalFormat,
                                               unsigned int msInternalFormat,
@@ -1911,7 +2024,9 @@ protected:
   /** @hidden */
   WebGLDataBufferPtr _cachedVertexBuffers = nullptr;
   /** @hidden */
-  std::unordered_map<std::string, VertexBufferPtr> _cachedVertexBuffersMap;
+  std::vector<VertexBufferPtr> _cachedAttributeVertexBuffers;
+  /** @hidden */
+  std::vector<const VertexBufferPtr*> _resolvedAttributeVertexBuffers;
   /** @hidden */
   WebGLDataBufferPtr _cachedIndexBuffer = nullptr;
   /** @hidden */
@@ -1942,6 +2057,11 @@ private:
   int _currentTextureChannel = -1;
 
   std::unordered_map<std::string, EffectPtr> _compiledEffects;
+  std::unordered_map<uint64_t, EffectPtr> _compiledEffectsByDefinesKey;
+  ProgramBinaryCachePtr _programBinaryCache = nullptr;
+  // Effects compiled by warmUpEffects, by program binary cache key
+  std::unordered_map<std::string, EffectPtr> _warmedUpEffects;
+  TexturePipelinePtr _texturePipeline = nullptr;
   std::unordered_map<unsigned int, bool> _vertexAttribArraysEnabled;
   WebGLVertexArrayObjectPtr _cachedVertexArrayObject = nullptr;
   bool _uintIndicesCurrentlySet                      = false;
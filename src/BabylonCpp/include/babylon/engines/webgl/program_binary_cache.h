@@ -0,0 +1,112 @@
+#ifndef BABYLON_ENGINES_WEBGL_PROGRAM_BINARY_CACHE_H
+#define BABYLON_ENGINES_WEBGL_PROGRAM_BINARY_CACHE_H
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+
+class ProgramBinaryCache;
+using ProgramBinaryCachePtr = std::shared_ptr<ProgramBinaryCache>;
+
+/**
+ * @brief Effect compiled during a previous run, used to warm up the engine.
+ */
+struct BABYLON_SHARED_EXPORT EffectWarmUpEntry {
+  /**
+   * Key of the effect, "vertexName+fragmentName@defines"
+   */
+  std::string key;
+  /**
+   * Index parameters used to unroll the includes of the effect
+   */
+  std::unordered_map<std::string, unsigned int> indexParameters;
+}; // end of struct EffectWarmUpEntry
+
+/**
+ * @brief Persistent cache of the linked shader programs.
+ *
+ * Each program binary is stored in its own file, named after a hash of the
+ * driver identity and of the final vertex and fragment sources. A driver
+ * update therefore never reuses a binary of the previous driver, and a binary
+ * rejected by the driver is removed so that the program is compiled from
+ * source again.
+ */
+class BABYLON_SHARED_EXPORT ProgramBinaryCache {
+
+public:
+  /**
+   * @brief Creates a program binary cache storing its files in the given directory.
+   * @param directory defines the directory of the cache, created when it does not exist
+   */
+  ProgramBinaryCache(const std::string& directory);
+  ~ProgramBinaryCache(); // = default
+
+  /**
+   * @brief Returns the cache key of a program.
+   * @param driverIdentity defines the vendor, renderer and version of the driver
+   * @param vertexCode defines the final vertex source code
+   * @param fragmentCode defines the final fragment source code
+   * @returns the cache key of the program
+   */
+  static std::string GetKey(const std::string& driverIdentity, const std::string& vertexCode,
+                            const std::string& fragmentCode);
+
+  /**
+   * @brief Returns the directory of the cache.
+   */
+  [[nodiscard]] const std::string& directory() const;
+
+  /**
+   * @brief Loads the binary of a program.
+   * @param key defines the cache key of the program
+   * @param binaryFormat defines the driver specific format of the binary
+   * @param binary defines the binary of the program
+   * @returns whether a valid binary was found
+   */
+  bool load(const std::string& key, unsigned int& binaryFormat, Uint8Array& binary) const;
+
+  /**
+   * @brief Stores the binary of a program.
+   * @param key defines the cache key of the program
+   * @param binaryFormat defines the driver specific format of the binary
+   * @param binary defines the binary of the program
+   * @returns whether the binary was written
+   */
+  bool save(const std::string& key, unsigned int binaryFormat, const Uint8Array& binary) const;
+
+  /**
+   * @brief Removes the binary of a program, used when it is rejected by the driver.
+   * @param key defines the cache key of the program
+   */
+  void remove(const std::string& key) const;
+
+  /**
+   * @brief Loads the list of effects stored by saveEffectWarmUpEntries.
+   * @returns the list of effects to warm up
+   */
+  [[nodiscard]] std::vector<EffectWarmUpEntry> loadEffectWarmUpEntries() const;
+
+  /**
+   * @brief Stores the list of effects compiled during this run.
+   * @param entries defines the effects to warm up at the next start
+   * @returns whether the list was written
+   */
+  bool saveEffectWarmUpEntries(const std::vector<EffectWarmUpEntry>& entries) const;
+
+private:
+  [[nodiscard]] std::string _getPath(const std::string& key) const;
+
+private:
+  std::string _directory;
+
+}; // end of class ProgramBinaryCache
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_ENGINES_WEBGL_PROGRAM_BINARY_CACHE_H
@@ -58,6 +58,7 @@ public:
   std::string fragmentCompilationError;
   std::string programLinkError;
   std::string programValidationError;
+  std::string programBinaryCacheKey;
 
 }; // end of class WebGLPipelineContext
 
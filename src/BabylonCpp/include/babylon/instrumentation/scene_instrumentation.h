@@ -50,6 +50,36 @@ protected:
    */
   void set_captureActiveMeshesEvaluationTime(bool value);
 
+  /**
+   * @brief Gets the perf counter used for the parallel part of the active meshes evaluation time.
+   */
+  PerfCounter& get_activeMeshesParallelEvaluationTimeCounter();
+
+  /**
+   * @brief Gets the parallel active meshes evaluation time capture status.
+   */
+  [[nodiscard]] bool get_captureActiveMeshesParallelEvaluationTime() const;
+
+  /**
+   * @brief Enable or disable the parallel active meshes evaluation time capture.
+   */
+  void set_captureActiveMeshesParallelEvaluationTime(bool value);
+
+  /**
+   * @brief Gets the perf counter used for the skeletons evaluation time.
+   */
+  PerfCounter& get_skeletonsEvaluationTimeCounter();
+
+  /**
+   * @brief Gets the skeletons evaluation time capture status.
+   */
+  [[nodiscard]] bool get_captureSkeletonsEvaluationTime() const;
+
+  /**
+   * @brief Enable or disable the skeletons evaluation time capture.
+   */
+  void set_captureSkeletonsEvaluationTime(bool value);
+
   /**
    * @brief Gets the perf counter used for render targets render time.
    */
@@ -190,6 +220,22 @@ protected:
    */
   PerfCounter& get_drawCallsCounter();
 
+  /**
+   * @brief Gets the perf counter used for the world matrices recomputed by the transform update
+   * pass.
+   */
+  PerfCounter& get_worldMatrixUpdatesCounter();
+
+  /**
+   * @brief Gets the perf counter used for the state changes avoided by the sort key render queue.
+   */
+  PerfCounter& get_avoidedStateChangesCounter();
+
+  /**
+   * @brief Gets the perf counter used for the bones of the evaluated skeletons.
+   */
+  PerfCounter& get_activeBonesCounter();
+
 public:
   // Properties
 
@@ -208,6 +254,29 @@ public:
    */
   Property<SceneInstrumentation, bool> captureActiveMeshesEvaluationTime;
 
+  /**
+   * Perf counter used for the time spent computing the world matrices and the frustum tests of the
+   * active mesh candidates on the worker threads (only when
+   * Scene::parallelActiveMeshesEvaluation is enabled).
+   */
+  ReadOnlyProperty<SceneInstrumentation, PerfCounter> activeMeshesParallelEvaluationTimeCounter;
+
+  /**
+   * Parallel active meshes evaluation time capture status.
+   */
+  Property<SceneInstrumentation, bool> captureActiveMeshesParallelEvaluationTime;
+
+  /**
+   * Perf counter used for the time spent computing the bone matrices of the active skeletons (the
+   * time spent by each skeleton is reported by Skeleton::evaluationTimeCounter).
+   */
+  ReadOnlyProperty<SceneInstrumentation, PerfCounter> skeletonsEvaluationTimeCounter;
+
+  /**
+   * Skeletons evaluation time capture status.
+   */
+  Property<SceneInstrumentation, bool> captureSkeletonsEvaluationTime;
+
   /**
    * Perf counter used for render targets render time.
    */
@@ -303,10 +372,33 @@ public:
    */
   ReadOnlyProperty<SceneInstrumentation, PerfCounter> drawCallsCounter;
 
+  /**
+   * Perf counter used for the world matrices recomputed per frame by the transform update pass
+   * (only when Scene::transformUpdatePassEnabled is enabled).
+   */
+  ReadOnlyProperty<SceneInstrumentation, PerfCounter> worldMatrixUpdatesCounter;
+
+  /**
+   * Perf counter used for the effect, material and geometry changes avoided per frame by sorting
+   * the opaque and alpha tested submeshes (only when Scene::sortKeyRenderQueueEnabled is enabled).
+   */
+  ReadOnlyProperty<SceneInstrumentation, PerfCounter> avoidedStateChangesCounter;
+
+  /**
+   * Perf counter used for the bones of the skeletons evaluated per frame.
+   */
+  ReadOnlyProperty<SceneInstrumentation, PerfCounter> activeBonesCounter;
+
 private:
   bool _captureActiveMeshesEvaluationTime;
   PerfCounter _activeMeshesEvaluationTime;
 
+  bool _captureActiveMeshesParallelEvaluationTime;
+  PerfCounter _activeMeshesParallelEvaluationTime;
+
+  bool _captureSkeletonsEvaluationTime;
+  PerfCounter _skeletonsEvaluationTime;
+
   bool _captureRenderTargetsRenderTime;
   PerfCounter _renderTargetsRenderTime;
 
@@ -337,6 +429,10 @@ private:
   // Observers
   Observer<Scene>::Ptr _onBeforeActiveMeshesEvaluationObserver;
   Observer<Scene>::Ptr _onAfterActiveMeshesEvaluationObserver;
+  Observer<Scene>::Ptr _onBeforeActiveMeshesParallelEvaluationObserver;
+  Observer<Scene>::Ptr _onAfterActiveMeshesParallelEvaluationObserver;
+  Observer<Scene>::Ptr _onBeforeSkeletonsEvaluationObserver;
+  Observer<Scene>::Ptr _onAfterSkeletonsEvaluationObserver;
   Observer<Scene>::Ptr _onBeforeRenderTargetsRenderObserver;
   Observer<Scene>::Ptr _onAfterRenderTargetsRenderObserver;
 
@@ -9,6 +9,7 @@
 
 namespace BABYLON {
 
+class ArrayBufferView;
 class ICanvas;
 
 namespace GL {
@@ -506,6 +507,11 @@ enum GLEnums : GLenum {
   BROWSER_DEFAULT_WEBGL              = 0x9244,
   /* KHR_parallel_shader_compile */
   COMPLETION_STATUS_KHR = 0x91B1,
+  /* ARB_get_program_binary */
+  PROGRAM_BINARY_RETRIEVABLE_HINT = 0x8257,
+  PROGRAM_BINARY_LENGTH           = 0x8741,
+  NUM_PROGRAM_BINARY_FORMATS      = 0x87FE,
+  PROGRAM_BINARY_FORMATS          = 0x87FF,
   // IGL_EXT_texture_filter_anisotropic
   TEXTURE_MAX_ANISOTROPY_EXT     = 0x84FE,
   MAX_TEXTURE_MAX_ANISOTROPY_EXT = 0x84FF,
@@ -957,6 +963,15 @@ public:
    */
   virtual void bufferData(GLenum target, const Uint32Array& data, GLenum usage) = 0;
 
+  /**
+   * @brief Initializes and creates the buffer object's data store.
+   * @param target A GLenum specifying the binding point (target).
+   * @param data An ArrayBufferView whose bytes will be copied into the data
+   * store (no intermediate typed array is created).
+   * @param usage A GLenum specifying the usage pattern of the data store.
+   */
+  virtual void bufferData(GLenum target, const ArrayBufferView& data, GLenum usage) = 0;
+
   /**
    * @brief Updates a subset of a buffer object's data store.
    * @param target A GLenum specifying the binding point (target).
@@ -1632,6 +1647,16 @@ public:
    */
   virtual std::string getProgramInfoLog(IGLProgram* program) = 0;
 
+  /**
+   * @brief Returns the binary representation of a linked IGLProgram object.
+   * @param program A linked IGLProgram to query.
+   * @param binaryFormat A GLenum receiving the driver specific format of the
+   * binary.
+   * @return The binary of the program or an empty array when program binaries
+   * are not supported.
+   */
+  virtual Uint8Array getProgramBinary(IGLProgram* program, GLenum& binaryFormat) = 0;
+
   /**
    * @brief Returns information about the renderbuffer.
    * @param target A Glenum specifying the target renderbuffer object.
@@ -1786,6 +1811,26 @@ public:
    */
   virtual void polygonOffset(GLfloat factor, GLfloat units) = 0;
 
+  /**
+   * @brief Loads a program binary previously returned by getProgramBinary.
+   * @param program An IGLProgram to load the binary into.
+   * @param binaryFormat A GLenum specifying the format of the binary.
+   * @param binary The binary of the program.
+   * @return Whether or not the program is linked, the binary is rejected by the
+   * driver when it was created by another driver or driver version.
+   */
+  virtual bool programBinary(IGLProgram* program, GLenum binaryFormat, const Uint8Array& binary)
+    = 0;
+
+  /**
+   * @brief Sets a parameter of an IGLProgram object.
+   * @param program An IGLProgram to modify.
+   * @param pname A GLenum specifying the parameter, such as
+   * PROGRAM_BINARY_RETRIEVABLE_HINT.
+   * @param value A GLint specifying the value of the parameter.
+   */
+  virtual void programParameteri(IGLProgram* program, GLenum pname, GLint value) = 0;
+
   /**
    * @brief Selects a color buffer as the source for pixels for subsequent calls
    * to copyTexImage2D, copyTexSubImage2D, copyTexSubImage3D or readPixels.
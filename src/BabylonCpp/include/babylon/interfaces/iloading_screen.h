@@ -7,12 +7,18 @@
 
 namespace BABYLON {
 
+struct TextureLoadTiming;
+
 class BABYLON_SHARED_EXPORT ILoadingScreen {
 
 public:
   virtual ~ILoadingScreen() = default;
   virtual void displayLoadingUI() = 0;
   virtual void hideLoadingUI()    = 0;
+  // Called for the images uploaded by the texture pipeline while the loading UI is displayed
+  virtual void reportTextureLoadTiming(const TextureLoadTiming& /*timing*/)
+  {
+  }
 
 public:
   std::string loadingUIBackgroundColor;
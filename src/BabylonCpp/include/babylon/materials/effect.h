@@ -1,6 +1,7 @@
 #ifndef BABYLON_MATERIALS_EFFECT_H
 #define BABYLON_MATERIALS_EFFECT_H
 
+#include <array>
 #include <unordered_map>
 #include <variant>
 
@@ -51,6 +52,7 @@ using WebGLUniformLocationPtr = std::shared_ptr<GL::IGLUniformLocation>;
 class BABYLON_SHARED_EXPORT Effect : public IDisposable {
 
   friend class Engine;
+  friend class ThinEngine;
 
 public:
   /**
@@ -114,6 +116,13 @@ public:
    */
   int getAttributeLocation(unsigned int index);
 
+  /**
+   * @brief Returns the vertex buffer kind slots of the attributes, in the same order as the
+   * attribute names (see VertexBuffer::KindSlot). Resolved once per effect.
+   * @returns An array of kind slots.
+   */
+  const std::vector<size_t>& getAttributeKindSlots();
+
   /**
    * @brief Returns the attribute based on the name of the variable.
    * @param name of the attribute to look up.
@@ -141,6 +150,13 @@ public:
    */
   WebGLUniformLocationPtr getUniform(const std::string& uniformName);
 
+  /**
+   * @brief Returns the location of a uniform from its handle.
+   * @param uniformHandle handle of the uniform (see Effect::UniformHandle).
+   * @returns the location of the uniform.
+   */
+  WebGLUniformLocationPtr getUniform(size_t uniformHandle);
+
   /**
    * @brief Returns an array of sampler variable names
    * @returns The array of sampler variable neames.
@@ -248,10 +264,11 @@ public:
   void setTextureFromPostProcessOutput(const std::string& channel,
                                        const PostProcessPtr& postProcess);
 
-  bool _cacheMatrix(const std::string& uniformName, const Matrix& matrix);
-  bool _cacheFloat2(const std::string& uniformName, float x, float y);
-  bool _cacheFloat3(const std::string& uniformName, float x, float y, float z);
-  bool _cacheFloat4(const std::string& uniformName, float x, float y, float z, float w);
+  bool _cacheMatrix(size_t slot, const Matrix& matrix);
+  bool _cacheFloat(size_t slot, float x);
+  bool _cacheFloat2(size_t slot, float x, float y);
+  bool _cacheFloat3(size_t slot, float x, float y, float z);
+  bool _cacheFloat4(size_t slot, float x, float y, float z, float w);
 
   /**
    * @brief Binds a buffer to a uniform.
@@ -275,6 +292,14 @@ public:
    */
   Effect& setInt(const std::string& uniformName, int value);
 
+  /**
+   * @brief Sets an interger value on a uniform variable.
+   * @param uniformHandle Handle of the variable (see Effect::UniformHandle).
+   * @param value Value to be set.
+   * @returns this effect.
+   */
+  Effect& setInt(size_t uniformHandle, int value);
+
   /**
    * @brief Sets an int array on a uniform variable.
    * @param uniformName Name of the variable.
@@ -388,6 +413,14 @@ public:
    */
   Effect& setMatrices(const std::string& uniformName, Float32Array matrices);
 
+  /**
+   * @brief Sets an array of matrices on a uniform variable.
+   * @param uniformHandle Handle of the variable (see Effect::UniformHandle).
+   * @param matrices matrices to be set.
+   * @returns this effect.
+   */
+  Effect& setMatrices(size_t uniformHandle, const Float32Array& matrices);
+
   /**
    * @brief Sets matrix on a uniform variable.
    * @param uniformName Name of the variable.
@@ -396,6 +429,14 @@ public:
    */
   Effect& setMatrix(const std::string& uniformName, const Matrix& matrix);
 
+  /**
+   * @brief Sets matrix on a uniform variable.
+   * @param uniformHandle Handle of the variable (see Effect::UniformHandle).
+   * @param matrix matrix to be set.
+   * @returns this effect.
+   */
+  Effect& setMatrix(size_t uniformHandle, const Matrix& matrix);
+
   /**
    * @brief Sets a 3x3 matrix on a uniform variable. (Speicified as [1,2,3,4,5,6,7,8,9] will result
    * in [1,2,3][4,5,6][7,8,9] matrix)
@@ -422,6 +463,14 @@ public:
    */
   Effect& setFloat(const std::string& uniformName, float value);
 
+  /**
+   * @brief Sets a float on a uniform variable.
+   * @param uniformHandle Handle of the variable (see Effect::UniformHandle).
+   * @param value value to be set.
+   * @returns this effect.
+   */
+  Effect& setFloat(size_t uniformHandle, float value);
+
   /**
    * @brief Sets a boolean on a uniform variable.
    * @param uniformName Name of the variable.
@@ -430,6 +479,14 @@ public:
    */
   Effect& setBool(const std::string& uniformName, bool _bool);
 
+  /**
+   * @brief Sets a boolean on a uniform variable.
+   * @param uniformHandle Handle of the variable (see Effect::UniformHandle).
+   * @param bool value to be set.
+   * @returns this effect.
+   */
+  Effect& setBool(size_t uniformHandle, bool _bool);
+
   /**
    * @brief Sets a Vector2 on a uniform variable.
    * @param uniformName Name of the variable.
@@ -438,6 +495,14 @@ public:
    */
   Effect& setVector2(const std::string& uniformName, const Vector2& vector2);
 
+  /**
+   * @brief Sets a Vector2 on a uniform variable.
+   * @param uniformHandle Handle of the variable (see Effect::UniformHandle).
+   * @param vector2 vector2 to be set.
+   * @returns this effect.
+   */
+  Effect& setVector2(size_t uniformHandle, const Vector2& vector2);
+
   /**
    * @brief Sets a float2 on a uniform variable.
    * @param uniformName Name of the variable.
@@ -447,6 +512,15 @@ public:
    */
   Effect& setFloat2(const std::string& uniformName, float x, float y);
 
+  /**
+   * @brief Sets a float2 on a uniform variable.
+   * @param uniformHandle Handle of the variable (see Effect::UniformHandle).
+   * @param x First float in float2.
+   * @param y Second float in float2.
+   * @returns this effect.
+   */
+  Effect& setFloat2(size_t uniformHandle, float x, float y);
+
   /**
    * @brief Sets a Vector3 on a uniform variable.
    * @param uniformName Name of the variable.
@@ -455,6 +529,14 @@ public:
    */
   Effect& setVector3(const std::string& uniformName, const Vector3& vector3);
 
+  /**
+   * @brief Sets a Vector3 on a uniform variable.
+   * @param uniformHandle Handle of the variable (see Effect::UniformHandle).
+   * @param vector3 Value to be set.
+   * @returns this effect.
+   */
+  Effect& setVector3(size_t uniformHandle, const Vector3& vector3);
+
   /**
    * @brief Sets a float3 on a uniform variable.
    * @param uniformName Name of the variable.
@@ -465,6 +547,16 @@ public:
    */
   Effect& setFloat3(const std::string& uniformName, float x, float y, float z);
 
+  /**
+   * @brief Sets a float3 on a uniform variable.
+   * @param uniformHandle Handle of the variable (see Effect::UniformHandle).
+   * @param x First float in float3.
+   * @param y Second float in float3.
+   * @param z Third float in float3.
+   * @returns this effect.
+   */
+  Effect& setFloat3(size_t uniformHandle, float x, float y, float z);
+
   /**
    * @brief Sets a Vector4 on a uniform variable.
    * @param uniformName Name of the variable.
@@ -473,6 +565,14 @@ public:
    */
   Effect& setVector4(const std::string& uniformName, const Vector4& vector4);
 
+  /**
+   * @brief Sets a Vector4 on a uniform variable.
+   * @param uniformHandle Handle of the variable (see Effect::UniformHandle).
+   * @param vector4 Value to be set.
+   * @returns this effect.
+   */
+  Effect& setVector4(size_t uniformHandle, const Vector4& vector4);
+
   /**
    * @brief Sets a float4 on a uniform variable.
    * @param uniformName Name of the variable.
@@ -484,6 +584,17 @@ public:
    */
   Effect& setFloat4(const std::string& uniformName, float x, float y, float z, float w);
 
+  /**
+   * @brief Sets a float4 on a uniform variable.
+   * @param uniformHandle Handle of the variable (see Effect::UniformHandle).
+   * @param x First float in float4.
+   * @param y Second float in float4.
+   * @param z Third float in float4.
+   * @param w Fourth float in float4.
+   * @returns this effect.
+   */
+  Effect& setFloat4(size_t uniformHandle, float x, float y, float z, float w);
+
   /**
    * @brief Sets a Color3 on a uniform variable.
    * @param uniformName Name of the variable.
@@ -492,6 +603,14 @@ public:
    */
   Effect& setColor3(const std::string& uniformName, const Color3& color3);
 
+  /**
+   * @brief Sets a Color3 on a uniform variable.
+   * @param uniformHandle Handle of the variable (see Effect::UniformHandle).
+   * @param color3 Value to be set.
+   * @returns this effect.
+   */
+  Effect& setColor3(size_t uniformHandle, const Color3& color3);
+
   /**
    * @brief Sets a Color4 on a uniform variable.
    * @param uniformName Name of the variable.
@@ -501,6 +620,15 @@ public:
    */
   Effect& setColor4(const std::string& uniformName, const Color3& color3, float alpha);
 
+  /**
+   * @brief Sets a Color4 on a uniform variable.
+   * @param uniformHandle Handle of the variable (see Effect::UniformHandle).
+   * @param color3 Value to be set.
+   * @param alpha Alpha value to be set.
+   * @returns this effect.
+   */
+  Effect& setColor4(size_t uniformHandle, const Color3& color3, float alpha);
+
   /**
    * @brief Sets a Color4 on a uniform variable.
    * @param uniformName defines the name of the variable
@@ -509,11 +637,29 @@ public:
    */
   Effect& setDirectColor4(const std::string& uniformName, const Color4& color4);
 
+  /**
+   * @brief Sets a Color4 on a uniform variable.
+   * @param uniformHandle Handle of the variable (see Effect::UniformHandle).
+   * @param color4 defines the value to be set
+   * @returns this effect.
+   */
+  Effect& setDirectColor4(size_t uniformHandle, const Color4& color4);
+
   /**
    * @brief Release all associated resources.
    */
   void dispose(bool doNotRecurse = false, bool disposeMaterialAndTextures = false) override;
 
+  /**
+   * @brief Returns the integer handle of a uniform name.
+   * Handles are allocated once per name for the lifetime of the process and are dense: each
+   * effect resolves its uniform names to handles when created, so the setters taking a handle
+   * index flat arrays instead of hashing the name on every call.
+   * @param uniformName The name of the uniform
+   * @returns The handle of the uniform
+   */
+  static size_t UniformHandle(const std::string& uniformName);
+
   // Statics
 
   /**
@@ -558,6 +704,18 @@ protected:
   Observable<Effect>& get_onBindObservable();
 
 private:
+  /**
+   * Last value set on a uniform, used to skip the redundant engine calls
+   */
+  struct UniformValue {
+    std::array<float, 4> values{};
+    size_t size    = 0; // Number of floats set, 16 for a matrix
+    int updateFlag = 0;
+  }; // end of struct UniformValue
+
+  void _resolveUniformSlots();
+  size_t _getUniformHandle(const std::string& uniformName) const;
+  int _getUniformSlot(size_t uniformHandle) const;
   void _useFinalCode(
     const std::string& migratedVertexCode, const std::string& migratedFragmentCode,
     const std::variant<std::string, std::unordered_map<std::string, std::string>>& baseName);
@@ -638,8 +796,12 @@ private:
   bool _allFallbacksProcessed;
   std::vector<std::string> _attributesNames;
   Int32Array _attributes;
+  std::vector<size_t> _attributeKindSlots;
   std::unordered_map<std::string, int> _attributeLocationByName;
-  std::unordered_map<std::string, WebGLUniformLocationPtr> _uniforms;
+  // Uniform handles by name and slots (index in _uniformsNames) by handle, -1 if not used
+  std::unordered_map<std::string, size_t> _uniformHandlesByName;
+  std::vector<int> _uniformSlotsByHandle;
+  std::vector<WebGLUniformLocationPtr> _uniformLocations;
   std::unordered_map<std::string, unsigned int> _indexParameters;
   std::unique_ptr<IEffectFallbacks> _fallbacks;
   std::string _vertexSourceCode;
@@ -647,7 +809,7 @@ private:
   std::string _vertexSourceCodeOverride;
   std::string _fragmentSourceCodeOverride;
   std::vector<std::string> _transformFeedbackVaryings;
-  std::unordered_map<std::string, Float32Array> _valueCache;
+  std::vector<UniformValue> _valueCache;
   static std::unordered_map<unsigned int, WebGLDataBufferPtr> _baseCache;
 
 }; // end of class Effect
@@ -0,0 +1,413 @@
+#ifndef BABYLON_MATERIALS_MATERIAL_DEFINE_SET_H
+#define BABYLON_MATERIALS_MATERIAL_DEFINE_SET_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Process wide schema of the material define names.
+ * Every define name is registered once and gets a small dense index, so that the define sets can
+ * be stored as packed bits / small arrays and compared or hashed without touching strings.
+ */
+struct BABYLON_SHARED_EXPORT MaterialDefinesSchema {
+
+  /**
+   * @brief Returns the index of a define name, registering it if needed.
+   * @param name defines the name of the define
+   * @returns the index of the define
+   */
+  static size_t IndexOf(const std::string& name);
+
+  /**
+   * @brief Returns the name of a registered define.
+   * @param index defines the index of the define
+   * @returns the name of the define
+   */
+  static std::string NameOf(size_t index);
+
+  /**
+   * @brief Combines a value into a 64-bit FNV-1a hash.
+   */
+  static constexpr uint64_t HashCombine(uint64_t hash, uint64_t value)
+  {
+    for (unsigned int i = 0; i < 8; ++i) {
+      hash ^= (value >> (i * 8)) & 0xff;
+      hash *= 1099511628211ull;
+    }
+    return hash;
+  }
+
+  /**
+   * Offset basis of the 64-bit FNV-1a hash.
+   */
+  static constexpr uint64_t HashSeed = 14695981039346656037ull;
+
+}; // end of struct MaterialDefinesSchema
+
+/**
+ * @brief Set of boolean material defines stored as packed bits.
+ * A define is either absent or declared with a value, like an entry of a map.
+ */
+class BABYLON_SHARED_EXPORT MaterialBoolDefineSet {
+
+public:
+  /**
+   * @brief Proxy to a single boolean define.
+   */
+  class Reference {
+  public:
+    Reference(MaterialBoolDefineSet& owner, size_t index) : _owner{owner}, _index{index}
+    {
+    }
+    Reference(const Reference& other) = default;
+    operator bool() const
+    {
+      return _owner.get(_index);
+    }
+    Reference& operator=(bool value)
+    {
+      _owner.set(_index, value);
+      return *this;
+    }
+    Reference& operator=(const Reference& other)
+    {
+      return operator=(static_cast<bool>(other));
+    }
+
+  private:
+    MaterialBoolDefineSet& _owner;
+    size_t _index;
+  }; // end of class Reference
+
+public:
+  MaterialBoolDefineSet() = default;
+  MaterialBoolDefineSet(const MaterialBoolDefineSet& other) = default;
+  MaterialBoolDefineSet(MaterialBoolDefineSet&& other)      = default;
+  MaterialBoolDefineSet(std::initializer_list<std::pair<const std::string, bool>> defines);
+  MaterialBoolDefineSet& operator=(const MaterialBoolDefineSet& other);
+  MaterialBoolDefineSet& operator=(MaterialBoolDefineSet&& other);
+  MaterialBoolDefineSet& operator=(std::initializer_list<std::pair<const std::string, bool>> defines);
+
+  /**
+   * @brief Returns the define with the given name, declaring it (false) if needed.
+   */
+  Reference operator[](const std::string& name);
+
+  /**
+   * @brief Returns the define with the given schema index, declaring it (false) if needed.
+   */
+  Reference operator[](size_t index);
+
+  /**
+   * @brief Returns the value of a define (false when absent).
+   */
+  [[nodiscard]] bool get(const std::string& name) const;
+  [[nodiscard]] bool get(size_t index) const
+  {
+    const auto word = index >> 6;
+    return word < _values.size() && ((_values[word] >> (index & 63)) & 1ull);
+  }
+
+  /**
+   * @brief Declares a define and sets its value.
+   */
+  void set(size_t index, bool value);
+
+  /**
+   * @brief Returns whether a define is declared in the set.
+   */
+  [[nodiscard]] bool contains(const std::string& name) const;
+  [[nodiscard]] bool contains(size_t index) const
+  {
+    const auto word = index >> 6;
+    return word < _declared.size() && ((_declared[word] >> (index & 63)) & 1ull);
+  }
+
+  /**
+   * @brief Removes a define from the set.
+   * @returns the number of removed defines
+   */
+  size_t erase(const std::string& name);
+  size_t erase(size_t index);
+
+  /**
+   * @brief Returns the number of declared defines.
+   */
+  [[nodiscard]] size_t size() const
+  {
+    return _size;
+  }
+
+  /**
+   * @brief Returns a counter incremented each time the set changes.
+   */
+  [[nodiscard]] uint64_t version() const
+  {
+    return _version;
+  }
+
+  /**
+   * @brief Returns the 64-bit hash of the set.
+   */
+  [[nodiscard]] uint64_t hash() const;
+
+  /**
+   * @brief Calls the given function for each declared define in schema order.
+   */
+  void forEach(const std::function<void(size_t index, bool value)>& callback) const;
+
+  bool operator==(const MaterialBoolDefineSet& other) const;
+  bool operator!=(const MaterialBoolDefineSet& other) const
+  {
+    return !operator==(other);
+  }
+
+private:
+  std::vector<uint64_t> _declared;
+  std::vector<uint64_t> _values;
+  size_t _size      = 0;
+  uint64_t _version = 0;
+
+}; // end of class MaterialBoolDefineSet
+
+/**
+ * @brief Set of valued material defines (int, float or string), stored as a small array sorted by
+ * schema index.
+ */
+template <typename T>
+class MaterialValueDefineSet {
+
+public:
+  /**
+   * @brief Proxy to a single valued define.
+   */
+  class Reference {
+  public:
+    Reference(MaterialValueDefineSet& owner, size_t index) : _owner{owner}, _index{index}
+    {
+    }
+    Reference(const Reference& other) = default;
+    operator T() const
+    {
+      return _owner.get(_index);
+    }
+    Reference& operator=(const T& value)
+    {
+      _owner.set(_index, value);
+      return *this;
+    }
+    Reference& operator=(const Reference& other)
+    {
+      return operator=(static_cast<T>(other));
+    }
+
+  private:
+    MaterialValueDefineSet& _owner;
+    size_t _index;
+  }; // end of class Reference
+
+  using Entry = std::pair<size_t, T>;
+
+public:
+  MaterialValueDefineSet() = default;
+  MaterialValueDefineSet(const MaterialValueDefineSet& other) = default;
+  MaterialValueDefineSet(MaterialValueDefineSet&& other)      = default;
+  MaterialValueDefineSet(std::initializer_list<std::pair<const std::string, T>> defines)
+  {
+    operator=(defines);
+  }
+  // The version never goes backward, so that caches keyed by version stay valid after assignment
+  MaterialValueDefineSet& operator=(const MaterialValueDefineSet& other)
+  {
+    if (&other != this) {
+      _entries = other._entries;
+      _version = std::max(_version, other._version) + 1;
+    }
+    return *this;
+  }
+  MaterialValueDefineSet& operator=(MaterialValueDefineSet&& other)
+  {
+    if (&other != this) {
+      _entries = std::move(other._entries);
+      _version = std::max(_version, other._version) + 1;
+    }
+    return *this;
+  }
+  MaterialValueDefineSet& operator=(std::initializer_list<std::pair<const std::string, T>> defines)
+  {
+    _entries.clear();
+    for (const auto& define : defines) {
+      set(MaterialDefinesSchema::IndexOf(define.first), define.second);
+    }
+    ++_version;
+    return *this;
+  }
+
+  /**
+   * @brief Returns the define with the given name, declaring it (default value) if needed.
+   */
+  Reference operator[](const std::string& name)
+  {
+    return operator[](MaterialDefinesSchema::IndexOf(name));
+  }
+
+  /**
+   * @brief Returns the define with the given schema index, declaring it (default value) if needed.
+   */
+  Reference operator[](size_t index)
+  {
+    auto it = _lowerBound(index);
+    if (it == _entries.end() || it->first != index) {
+      _entries.insert(it, Entry{index, T{}});
+      ++_version;
+    }
+    return Reference(*this, index);
+  }
+
+  /**
+   * @brief Returns the value of a define (default value when absent).
+   */
+  [[nodiscard]] T get(size_t index) const
+  {
+    auto it = _lowerBound(index);
+    return (it != _entries.end() && it->first == index) ? it->second : T{};
+  }
+
+  /**
+   * @brief Declares a define and sets its value.
+   */
+  void set(size_t index, const T& value)
+  {
+    auto it = _lowerBound(index);
+    if (it == _entries.end() || it->first != index) {
+      _entries.insert(it, Entry{index, value});
+      ++_version;
+    }
+    else if (!(it->second == value)) {
+      it->second = value;
+      ++_version;
+    }
+  }
+
+  /**
+   * @brief Returns whether a define is declared in the set.
+   */
+  [[nodiscard]] bool contains(const std::string& name) const
+  {
+    return contains(MaterialDefinesSchema::IndexOf(name));
+  }
+  [[nodiscard]] bool contains(size_t index) const
+  {
+    auto it = _lowerBound(index);
+    return it != _entries.end() && it->first == index;
+  }
+
+  /**
+   * @brief Removes a define from the set.
+   * @returns the number of removed defines
+   */
+  size_t erase(const std::string& name)
+  {
+    const auto index = MaterialDefinesSchema::IndexOf(name);
+    auto it          = _lowerBound(index);
+    if (it == _entries.end() || it->first != index) {
+      return 0;
+    }
+    _entries.erase(it);
+    ++_version;
+    return 1;
+  }
+
+  /**
+   * @brief Returns the number of declared defines.
+   */
+  [[nodiscard]] size_t size() const
+  {
+    return _entries.size();
+  }
+
+  /**
+   * @brief Returns a counter incremented each time the set changes.
+   */
+  [[nodiscard]] uint64_t version() const
+  {
+    return _version;
+  }
+
+  /**
+   * @brief Returns the 64-bit hash of the set.
+   */
+  [[nodiscard]] uint64_t hash() const
+  {
+    auto hash = MaterialDefinesSchema::HashSeed;
+    for (const auto& [index, value] : _entries) {
+      hash = MaterialDefinesSchema::HashCombine(hash, index);
+      hash = MaterialDefinesSchema::HashCombine(hash, _hashValue(value));
+    }
+    return hash;
+  }
+
+  /**
+   * @brief Declared defines in schema order.
+   */
+  [[nodiscard]] const std::vector<Entry>& entries() const
+  {
+    return _entries;
+  }
+
+  bool operator==(const MaterialValueDefineSet& other) const
+  {
+    return _entries == other._entries;
+  }
+  bool operator!=(const MaterialValueDefineSet& other) const
+  {
+    return !operator==(other);
+  }
+
+private:
+  typename std::vector<Entry>::iterator _lowerBound(size_t index)
+  {
+    return std::lower_bound(_entries.begin(), _entries.end(), index,
+                            [](const Entry& entry, size_t i) { return entry.first < i; });
+  }
+  typename std::vector<Entry>::const_iterator _lowerBound(size_t index) const
+  {
+    return std::lower_bound(_entries.begin(), _entries.end(), index,
+                            [](const Entry& entry, size_t i) { return entry.first < i; });
+  }
+
+  static uint64_t _hashValue(const T& value)
+  {
+    if constexpr (std::is_same_v<T, float>) {
+      uint32_t bits = 0;
+      std::memcpy(&bits, &value, sizeof(bits));
+      return bits;
+    }
+    else if constexpr (std::is_integral_v<T>) {
+      return static_cast<uint64_t>(value);
+    }
+    else {
+      return std::hash<T>{}(value);
+    }
+  }
+
+private:
+  std::vector<Entry> _entries;
+  uint64_t _version = 0;
+
+}; // end of class MaterialValueDefineSet
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MATERIALS_MATERIAL_DEFINE_SET_H
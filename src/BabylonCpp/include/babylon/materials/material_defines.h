@@ -1,10 +1,11 @@
 #ifndef BABYLON_MATERIALS_MATERIAL_DEFINES_H
 #define BABYLON_MATERIALS_MATERIAL_DEFINES_H
 
-#include <unordered_map>
+#include <limits>
 
 #include <babylon/babylon_api.h>
 #include <babylon/materials/imaterial_defines.h>
+#include <babylon/materials/material_define_set.h>
 
 namespace BABYLON {
 
@@ -21,6 +22,7 @@ struct BABYLON_SHARED_EXPORT MaterialDefines : public IMaterialDefines {
   ~MaterialDefines() override; // = default
 
   bool operator[](const std::string& define) const;
+  bool operator[](size_t index) const;
   bool operator==(const MaterialDefines& rhs) const;
   bool operator!=(const MaterialDefines& rhs) const;
   friend std::ostream& operator<<(std::ostream& os, const MaterialDefines& materialDefines);
@@ -108,11 +110,18 @@ struct BABYLON_SHARED_EXPORT MaterialDefines : public IMaterialDefines {
    */
   [[nodiscard]] std::string toString() const override;
 
+  /**
+   * @brief Returns the 64-bit hash of the define values.
+   * The hash is cached and only recomputed after a define value changed.
+   * @returns the hash of the defines
+   */
+  [[nodiscard]] uint64_t getHash() const;
+
   // Properties
-  std::unordered_map<std::string, bool> boolDef;
-  std::unordered_map<std::string, unsigned int> intDef;
-  std::unordered_map<std::string, float> floatDef;
-  std::unordered_map<std::string, std::string> stringDef;
+  MaterialBoolDefineSet boolDef;
+  MaterialValueDefineSet<unsigned int> intDef;
+  MaterialValueDefineSet<float> floatDef;
+  MaterialValueDefineSet<std::string> stringDef;
 
   bool _isDirty;
   /** Hidden */
@@ -143,6 +152,15 @@ struct BABYLON_SHARED_EXPORT MaterialDefines : public IMaterialDefines {
   /** Hidden */
   bool _needUVs;
 
+private:
+  [[nodiscard]] uint64_t _getDefinesVersion() const;
+
+private:
+  mutable uint64_t _cachedHash          = 0;
+  mutable uint64_t _cachedHashVersion   = std::numeric_limits<uint64_t>::max();
+  mutable std::string _cachedString     = "";
+  mutable uint64_t _cachedStringVersion = std::numeric_limits<uint64_t>::max();
+
 }; // end of struct MaterialDefines
 
 } // end of namespace BABYLON
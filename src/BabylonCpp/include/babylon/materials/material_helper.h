@@ -103,10 +103,12 @@ struct BABYLON_SHARED_EXPORT MaterialHelper {
    * @param defines specifies the list of active defines
    * @param useInstances defines if instances have to be turned on
    * @param useClipPlane defines if clip plane have to be turned on
+   * @param useThinInstances defines if thin instances have to be turned on
    */
   static void PrepareDefinesForFrameBoundValues(Scene* scene, Engine* engine,
                                                 MaterialDefines& defines, bool useInstances,
-                                                std::optional<bool> useClipPlane = std::nullopt);
+                                                std::optional<bool> useClipPlane = std::nullopt,
+                                                bool useThinInstances            = false);
 
   /**
    * @brief Prepares the defines for bones.
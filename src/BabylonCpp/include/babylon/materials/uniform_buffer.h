@@ -216,6 +216,11 @@ private:
    */
   void _fillAlignment(size_t size);
 
+  void _updateUniform(const std::string& uniformName, const float* data, size_t size);
+
+  // Name of an uniform of the effect, with the suffix appended in a reused string
+  const std::string& _getEffectUniformName(const std::string& name, const std::string& suffix);
+
   // Matrix cache
   bool _cacheMatrix(const std::string& name, const Matrix& matrix);
 
@@ -350,6 +355,7 @@ private:
   bool _needSync;
   bool _noUBO;
   Effect* _currentEffect;
+  std::string _suffixedName;
 
   // Matrix cache
   std::unordered_map<std::string, int> _valueCache;
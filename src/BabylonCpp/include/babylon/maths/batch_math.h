@@ -0,0 +1,137 @@
+#ifndef BABYLON_MATHS_BATCH_MATH_H
+#define BABYLON_MATHS_BATCH_MATH_H
+
+#include <cstddef>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Instruction sets used by the BatchMath kernels.
+ */
+enum class BatchMathBackend {
+  /** Plain C++ */
+  Scalar,
+  /** 4 floats per instruction (x86) */
+  SSE,
+  /** 8 floats per instruction with fused multiply-add (x86) */
+  AVX2,
+  /** 4 floats per instruction (ARM) */
+  NEON,
+}; // end of enum class BatchMathBackend
+
+/**
+ * @brief Math kernels working on arrays of matrices and vectors instead of one Matrix or Vector3
+ * at a time.
+ *
+ * The matrices have the layout of Matrix::m() (16 floats, row vectors, translation in the 13th to
+ * 15th floats), the points and the normals are 3 floats, the quaternions are 4 floats (x, y, z, w)
+ * and the bounding boxes are 6 floats (minimum then maximum). Unless stated otherwise the result
+ * can be one of the operands.
+ *
+ * The backend is selected once at runtime from the instruction sets supported by the CPU. The
+ * SIMD backends are only compiled in when OPTION_ENABLE_SIMD is defined.
+ */
+class BABYLON_SHARED_EXPORT BatchMath {
+
+public:
+  /**
+   * @brief Returns the backend running the kernels.
+   */
+  static BatchMathBackend Backend();
+
+  /**
+   * @brief Returns the name of a backend.
+   */
+  static const char* BackendName(BatchMathBackend backend);
+
+  /**
+   * @brief Returns whether a backend is compiled in and supported by the CPU.
+   */
+  static bool IsSupported(BatchMathBackend backend);
+
+  /**
+   * @brief Selects the backend running the kernels, for instance to compare the backends.
+   * @param backend defines the backend to use
+   * @returns false if the backend is not supported, the current one being kept
+   */
+  static bool SetBackend(BatchMathBackend backend);
+
+  /**
+   * @brief Multiplies matrices two by two: result[i] = matrices[i] * others[i].
+   * @param matrices defines count matrices
+   * @param others defines count matrices
+   * @param result defines the count matrices receiving the products
+   * @param count defines the number of matrices
+   */
+  static void MultiplyMatrices(const float* matrices, const float* others, float* result,
+                               size_t count);
+
+  /**
+   * @brief Multiplies matrices by the same matrix: result[i] = matrices[i] * other.
+   * @param matrices defines count matrices
+   * @param other defines the matrix to multiply with (not one of the results)
+   * @param result defines the count matrices receiving the products
+   * @param count defines the number of matrices
+   */
+  static void MultiplyMatricesByMatrix(const float* matrices, const float* other, float* result,
+                                       size_t count);
+
+  /**
+   * @brief Transforms points by a matrix, including the projection (see
+   * Vector3::TransformCoordinates).
+   * @param points defines count points
+   * @param matrix defines the transformation matrix
+   * @param result defines the count points receiving the transformed points
+   * @param count defines the number of points
+   */
+  static void TransformCoordinates(const float* points, const float* matrix, float* result,
+                                   size_t count);
+
+  /**
+   * @brief Transforms directions by a matrix, without the translation (see
+   * Vector3::TransformNormal).
+   * @param normals defines count directions
+   * @param matrix defines the transformation matrix
+   * @param result defines the count directions receiving the transformed directions
+   * @param count defines the number of directions
+   */
+  static void TransformNormals(const float* normals, const float* matrix, float* result,
+                               size_t count);
+
+  /**
+   * @brief Composes scaling, rotation and translation matrices (see Matrix::Compose).
+   * @param scalings defines count scalings
+   * @param rotations defines count rotation quaternions
+   * @param translations defines count translations
+   * @param result defines the count matrices receiving the compositions (not an operand)
+   * @param count defines the number of matrices
+   */
+  static void ComposeMatrices(const float* scalings, const float* rotations,
+                              const float* translations, float* result, size_t count);
+
+  /**
+   * @brief Inverts affine matrices (last column 0, 0, 0, 1), for instance world matrices.
+   * Non-invertible matrices are copied as Matrix::invertToRef does.
+   * @param matrices defines count affine matrices
+   * @param result defines the count matrices receiving the inverses
+   * @param count defines the number of matrices
+   */
+  static void InvertAffineMatrices(const float* matrices, float* result, size_t count);
+
+  /**
+   * @brief Computes the axis aligned bounding boxes of transformed axis aligned bounding boxes.
+   * @param boxes defines count bounding boxes
+   * @param matrices defines the count affine matrices transforming the boxes
+   * @param result defines the count bounding boxes receiving the transformed boxes
+   * @param count defines the number of boxes
+   */
+  static void TransformBoundingBoxes(const float* boxes, const float* matrices, float* result,
+                                     size_t count);
+
+}; // end of class BatchMath
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MATHS_BATCH_MATH_H
@@ -14,11 +14,12 @@ class Vector3;
 /**
  * @brief Same as Tmp but not exported to keep it only for math functions to
  * avoid conflicts.
+ * The objects are thread local, like the TmpVectors ones.
  */
-struct BABYLON_SHARED_EXPORT MathTmp {
-  static std::array<Vector3, 6> Vector3Array;
-  static std::array<Matrix, 2> MatrixArray;
-  static std::array<Quaternion, 3> QuaternionArray;
+struct MathTmp {
+  static thread_local std::array<Vector3, 6> Vector3Array;
+  static thread_local std::array<Matrix, 2> MatrixArray;
+  static thread_local std::array<Quaternion, 3> QuaternionArray;
 }; // end of class MathTmp
 
 } // end of namespace BABYLON
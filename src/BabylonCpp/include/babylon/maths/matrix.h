@@ -2,6 +2,7 @@
 #define BABYLON_MATHS_MATRIX_H
 
 #include <array>
+#include <atomic>
 #include <memory>
 #include <optional>
 
@@ -1038,7 +1039,8 @@ public:
   int updateFlag;
 
 private:
-  static int _updateFlagSeed;
+  // Atomic as world matrices can be computed from worker threads
+  static std::atomic<int> _updateFlagSeed;
   static Matrix _identityReadOnly;
   bool _isIdentity;
   bool _isIdentityDirty;
@@ -0,0 +1,42 @@
+#ifndef BABYLON_MESHES_THIN_INSTANCE_DATA_STORAGE_H
+#define BABYLON_MESHES_THIN_INSTANCE_DATA_STORAGE_H
+
+#include <optional>
+#include <unordered_map>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/maths/vector3.h>
+
+namespace BABYLON {
+
+class Buffer;
+using BufferPtr = std::shared_ptr<Buffer>;
+
+/**
+ * @brief Hidden
+ */
+struct BABYLON_SHARED_EXPORT _ThinInstanceDataStorage {
+  size_t instancesCount = 0;
+  BufferPtr matrixBuffer = nullptr;
+  // let's start with a maximum of 32 thin instances (size in floats)
+  size_t matrixBufferSize = 32 * 16;
+  Float32Array matrixData;
+  // Bounding box of the mesh geometry, the thin instances bounds are computed from it
+  std::optional<Vector3> boundingMinimum = std::nullopt;
+  std::optional<Vector3> boundingMaximum = std::nullopt;
+}; // end of struct _ThinInstanceDataStorage
+
+/**
+ * @brief Hidden
+ */
+struct BABYLON_SHARED_EXPORT _UserThinInstanceBuffersStorage {
+  std::unordered_map<std::string, Float32Array> data;
+  std::unordered_map<std::string, size_t> sizes;
+  std::unordered_map<std::string, BufferPtr> buffers;
+  std::unordered_map<std::string, size_t> strides;
+}; // end of struct _UserThinInstanceBuffersStorage
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MESHES_THIN_INSTANCE_DATA_STORAGE_H
@@ -41,6 +41,7 @@ class RawTexture;
 class RenderingGroup;
 class Skeleton;
 class SolidParticle;
+class TriangleBVH;
 class VertexBuffer;
 using _OcclusionDataStoragePtr = std::shared_ptr<_OcclusionDataStorage>;
 using BoundingInfoPtr          = std::shared_ptr<BoundingInfo>;
@@ -662,7 +663,8 @@ public:
   /** Collisions **/
 
   /**
-   * @brief Hidden
+   * @brief Hidden (Only the triangles close to the collider are tested when the geometry has a
+   * triangle BVH)
    */
   AbstractMesh& _collideForSubMesh(SubMesh* subMesh, const Matrix& transformMatrix,
                                    Collider& collider);
@@ -670,12 +672,18 @@ public:
   /**
    * @brief Hidden
    */
-  AbstractMesh& _processCollisionsForSubMeshes(Collider& collider, const Matrix& transformMatrix);
+  AbstractMesh& _processCollisionsForSubMeshes(Collider& collider, const Matrix& transformMatrix,
+                                               bool useSubMeshCandidates = true);
 
   /**
    * @brief Hidden
+   * @param collider defines the collider to test
+   * @param useSubMeshCandidates defines if the submeshes are selected by
+   * Scene::getCollidingSubMeshCandidates, which cannot be called from several threads. Otherwise
+   * the mesh can be tested against distinct colliders concurrently once its points array, its
+   * triangle BVH and its materials are created
    */
-  AbstractMesh& _checkCollision(Collider& collider);
+  AbstractMesh& _checkCollision(Collider& collider, bool useSubMeshCandidates = true);
 
   /** Picking **/
 
@@ -684,6 +692,22 @@ public:
    */
   virtual bool _generatePointsArray();
 
+  /**
+   * @brief Hidden (Returns the margin of the ray intersections, used by the line meshes)
+   */
+  [[nodiscard]] virtual float _getIntersectionThreshold() const;
+
+  /**
+   * @brief Hidden (Returns the BVH of the triangles of the mesh, nullptr when the picking tests
+   * all the triangles)
+   */
+  virtual TriangleBVH* _getTriangleBVH();
+
+  /**
+   * @brief Hidden (Discards the BVH of the triangles after an update of the points array)
+   */
+  virtual void _resetTriangleBVH();
+
   /**
    * @brief Checks if the passed Ray intersects with the mesh.
    * @param ray defines the ray to use
@@ -1310,6 +1334,11 @@ protected:
    */
   virtual bool get_hasInstances() const;
 
+  /**
+   * @brief Gets a boolean indicating if this mesh has thin instances.
+   */
+  virtual bool get_hasThinInstances() const;
+
   /** Collisions **/
 
   /**
@@ -1779,6 +1808,12 @@ public:
   /** Hidden */
   int _renderId;
 
+  /** Hidden (Id of the last octree selection containing this mesh) */
+  size_t _octreeSelectionId;
+
+  /** Hidden (Index of the mesh in the picking BVH of the scene) */
+  size_t _pickingBVHIndex;
+
   /**
    * Gets or sets the list of subMeshes
    * @see http://doc.babylonjs.com/how_to/multi_materials
@@ -1794,6 +1829,9 @@ public:
   /** Hidden */
   bool _unIndexed;
 
+  /** Hidden (Whether the mesh is made of lines: LinesMesh and InstancedLinesMesh) */
+  bool _isLinesMesh;
+
   /** Hidden */
   std::vector<LightPtr> _lightSources;
 
@@ -1860,6 +1898,11 @@ public:
    */
   ReadOnlyProperty<AbstractMesh, bool> hasInstances;
 
+  /**
+   * Gets a boolean indicating if this mesh has thin instances
+   */
+  ReadOnlyProperty<AbstractMesh, bool> hasThinInstances;
+
   /** Collisions **/
 
   /**
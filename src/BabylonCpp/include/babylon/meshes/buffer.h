@@ -5,6 +5,7 @@
 
 #include <babylon/babylon_api.h>
 #include <babylon/babylon_common.h>
+#include <babylon/core/array_buffer_view.h>
 
 namespace BABYLON {
 
@@ -54,6 +55,26 @@ public:
          bool instanced = false, bool useBytes = false,
          const std::optional<unsigned int>& divisor = std::nullopt);
 
+  /**
+   * @brief Constructor for a static buffer referencing raw bytes, e.g. a
+   * slice of a memory mapped file. The bytes are uploaded as is and are only
+   * converted to a Float32Array if getData() is called.
+   * @param engine the engine
+   * @param data the bytes to use for this buffer
+   * @param updatable whether the buffer should be updatable, in which case the bytes are converted
+   * to a Float32Array right away
+   * @param stride the stride (optional)
+   * @param postponeInternalCreation whether to postpone creating the internal WebGL buffer
+   * (optional)
+   * @param instanced whether the buffer is instanced (optional)
+   * @param useBytes set to true if the stride in in bytes (optional)
+   * @param divisor sets an optional divisor for instances (1 by default)
+   */
+  Buffer(Engine* engine, const ArrayBufferView& data, bool updatable,
+         std::optional<size_t> stride = std::nullopt, bool postponeInternalCreation = false,
+         bool instanced = false, bool useBytes = false,
+         const std::optional<unsigned int>& divisor = std::nullopt);
+
   virtual ~Buffer(); // = default
 
   /**
@@ -152,6 +173,7 @@ public:
 private:
   Engine* _engine;
   WebGLDataBufferPtr _buffer;
+  ArrayBufferView _bytes;
   bool _updatable;
   bool _instanced;
   unsigned int _divisor;
@@ -23,6 +23,7 @@ class Engine;
 class Geometry;
 class Mesh;
 class Scene;
+class TriangleBVH;
 class VertexBuffer;
 class VertexData;
 class WebGLDataBuffer;
@@ -285,6 +286,16 @@ public:
    */
   bool _generatePointsArray();
 
+  /**
+   * @brief Hidden (Returns the BVH of the triangles, built on demand for the large geometries)
+   */
+  TriangleBVH* _getTriangleBVH();
+
+  /**
+   * @brief Hidden
+   */
+  void _resetTriangleBVH();
+
   /**
    * @brief Gets a value indicating if the geometry is disposed.
    * @returns true if the geometry was disposed
@@ -431,6 +442,8 @@ public:
   /** Hidden */
   std::unordered_map<std::string, VertexBufferPtr> _vertexBuffers;
   /** Hidden */
+  std::vector<VertexBufferPtr> _vertexBuffersBySlot;
+  /** Hidden */
   std::vector<std::string> _delayInfo;
   /** Hidden */
   std::vector<std::string> _delayInfoKinds;
@@ -443,6 +456,8 @@ public:
   // Cache
   /** Hidden */
   std::vector<Vector3> _positions;
+  /** Hidden */
+  std::unique_ptr<TriangleBVH> _triangleBVH;
 
   /**
    *  Gets or sets the Bias Vector to apply on the bounding elements
@@ -451,7 +466,8 @@ public:
    */
   Property<Geometry, std::optional<Vector2>> boundingBias;
 
-  std::unordered_map<std::string, WebGLVertexArrayObjectPtr> _vertexArrayObjects;
+  /** Hidden (vertex array objects indexed by effect unique id) */
+  std::unordered_map<size_t, WebGLVertexArrayObjectPtr> _vertexArrayObjects;
   bool _updatable;
   std::vector<Vector3> centroids;
 
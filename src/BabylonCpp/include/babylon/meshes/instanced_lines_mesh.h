@@ -33,6 +33,11 @@ public:
    */
   std::string getClassName() const override;
 
+  /**
+   * @brief Hidden
+   */
+  [[nodiscard]] float _getIntersectionThreshold() const override;
+
   /**
    * @brief Enables the edge rendering mode on the mesh.
    * This mode makes the mesh edges visible
@@ -49,6 +54,14 @@ public:
 protected:
   InstancedLinesMesh(const std::string& name, const LinesMeshPtr& source);
 
+public:
+  /**
+   * The intersection Threshold is the margin applied when intersection a segment of the LinesMesh
+   * with a Ray. This margin is expressed in world space coordinates, so its value may vary.
+   * Initialization is done with the source LinesMesh's value.
+   */
+  float intersectionThreshold;
+
 }; // end of class InstancedLinesMesh
 
 } // end of namespace BABYLON
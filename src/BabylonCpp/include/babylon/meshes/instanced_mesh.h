@@ -214,6 +214,16 @@ public:
    */
   bool _generatePointsArray() override;
 
+  /**
+   * @brief Hidden
+   */
+  TriangleBVH* _getTriangleBVH() override;
+
+  /**
+   * @brief Hidden
+   */
+  void _resetTriangleBVH() override;
+
   /**
    * @brief Creates a new InstancedMesh from the current mesh.
    * @param name (string) : the cloned mesh name
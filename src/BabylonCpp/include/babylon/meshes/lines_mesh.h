@@ -44,6 +44,11 @@ public:
    */
   Type type() const override;
 
+  /**
+   * @brief Hidden
+   */
+  [[nodiscard]] float _getIntersectionThreshold() const override;
+
   /**
    * @brief Hidden
    */
@@ -2,6 +2,7 @@
 #define BABYLON_MESHES_MESH_H
 
 #include <babylon/babylon_api.h>
+#include <babylon/babylon_enums.h>
 #include <babylon/maths/isize.h>
 #include <babylon/maths/path3d.h>
 #include <babylon/meshes/abstract_mesh.h>
@@ -14,7 +15,10 @@ struct _CreationDataStorage;
 struct _InstancesBatch;
 struct _InstanceDataStorage;
 struct _InternalMeshDataInfo;
+struct _ThinInstanceDataStorage;
+struct _UserThinInstanceBuffersStorage;
 struct _VisibleInstances;
+struct ISimplificationSettings;
 class Buffer;
 class Effect;
 class Geometry;
@@ -711,6 +715,122 @@ public:
       onBeforeDraw,
     Material* effectiveMaterial = nullptr);
 
+  /** Thin instances **/
+
+  /**
+   * @brief Creates a new thin instance.
+   * @param matrix the matrix of the thin instance to add, in the local space of the mesh
+   * @param refresh true to refresh the underlying gpu buffer (default: true). If you do multiple
+   * calls to this method in a row, set refresh to true only for the last call to save performance
+   * @returns the thin instance index number
+   */
+  size_t thinInstanceAdd(const Matrix& matrix, bool refresh = true);
+
+  /**
+   * @brief Creates new thin instances.
+   * @param matrices the matrices of the thin instances to add, in the local space of the mesh
+   * @param refresh true to refresh the underlying gpu buffer (default: true)
+   * @returns the index number of the first thin instance added
+   */
+  size_t thinInstanceAdd(const std::vector<Matrix>& matrices, bool refresh = true);
+
+  /**
+   * @brief Adds the mesh itself (identity matrix) as a thin instance.
+   * @param refresh true to refresh the underlying gpu buffer (default: true)
+   * @returns the thin instance index number
+   */
+  size_t thinInstanceAddSelf(bool refresh = true);
+
+  /**
+   * @brief Registers a custom attribute to be used with thin instances.
+   * @param kind name of the attribute
+   * @param stride size in floats of the attribute
+   */
+  void thinInstanceRegisterAttribute(const std::string& kind, size_t stride);
+
+  /**
+   * @brief Sets the matrix of a thin instance.
+   * @param index index of the thin instance
+   * @param matrix matrix to set, in the local space of the mesh
+   * @param refresh true to refresh the underlying gpu buffer (default: true)
+   * @returns true if the matrix was set
+   */
+  bool thinInstanceSetMatrixAt(size_t index, const Matrix& matrix, bool refresh = true);
+
+  /**
+   * @brief Sets the value of a custom attribute for a thin instance.
+   * @param kind name of the attribute
+   * @param index index of the thin instance
+   * @param value value to set (stride floats)
+   * @param refresh true to refresh the underlying gpu buffer (default: true)
+   * @returns true if the value was set
+   */
+  bool thinInstanceSetAttributeAt(const std::string& kind, size_t index, const Float32Array& value,
+                                  bool refresh = true);
+
+  /**
+   * @brief Sets a buffer to be used with thin instances. This method is a faster way to setup
+   * multiple instances than calling thinInstanceAdd repeatedly: the buffer is uploaded as is.
+   * @param kind name of the attribute. Use "matrix" to setup the buffer of matrices
+   * @param buffer buffer to set (an empty buffer removes the thin instances / the attribute)
+   * @param stride size in floats of each value of the buffer (16 when kind is "matrix")
+   * @param staticBuffer indicates that the buffer is static, so that you won't change it after it
+   * is set (better performances, false by default)
+   */
+  void thinInstanceSetBuffer(const std::string& kind, Float32Array buffer, size_t stride = 0,
+                             bool staticBuffer = false);
+
+  /**
+   * @brief Gets the buffer used by thin instances for an attribute. The values can be modified in
+   * place, thinInstanceBufferUpdated must then be called to upload them.
+   * @param kind name of the attribute ("matrix" for the buffer of matrices)
+   * @returns the buffer or nullptr if no buffer is set for this attribute
+   */
+  Float32Array* thinInstanceGetBuffer(const std::string& kind);
+
+  /**
+   * @brief Synchronizes the gpu buffer of an attribute with the thin instances buffer. Call this
+   * method if you update the buffer directly.
+   * @param kind name of the attribute to update. Use "matrix" to update the buffer of matrices
+   */
+  void thinInstanceBufferUpdated(const std::string& kind);
+
+  /**
+   * @brief Applies a partial update to a buffer directly on the GPU. Only the data of the range
+   * [offset, offset + data.size()) of the buffer is uploaded.
+   * @param kind name of the attribute to update. Use "matrix" to update the buffer of matrices
+   * @param data the data to set in the buffer
+   * @param offset the offset in floats in the buffer where to set the data
+   */
+  void thinInstancePartialBufferUpdate(const std::string& kind, const Float32Array& data,
+                                       size_t offset);
+
+  /**
+   * @brief Refreshes the bounding info, taking into account all the thin instances defined.
+   * @param forceRefreshParentInfo true to force recomputing the mesh bounding info from the
+   * geometry first
+   */
+  void thinInstanceRefreshBoundingInfo(bool forceRefreshParentInfo = false);
+
+  /**
+   * @brief Hidden
+   */
+  Mesh& _renderWithThinInstances(
+    SubMesh* subMesh, unsigned int fillMode, const EffectPtr& effect, Engine* engine,
+    const std::function<void(bool isInstance, const Matrix& world, Material* effectiveMaterial)>&
+      onBeforeDraw,
+    Material* effectiveMaterial);
+
+  /**
+   * @brief Hidden
+   */
+  void _thinInstanceUpdateBufferSize(const std::string& kind, size_t numInstances = 1);
+
+  /**
+   * @brief Hidden
+   */
+  void _disposeThinInstanceSpecificData();
+
   /**
    * @brief Hidden
    */
@@ -839,6 +959,16 @@ public:
    */
   bool _generatePointsArray() override;
 
+  /**
+   * @brief Hidden
+   */
+  TriangleBVH* _getTriangleBVH() override;
+
+  /**
+   * @brief Hidden
+   */
+  void _resetTriangleBVH() override;
+
   /** Clone **/
 
   /**
@@ -976,6 +1106,24 @@ public:
    */
   void forceSharedVertices();
 
+  /**
+   * @brief Simplify the mesh according to the given array of settings.
+   * Function will return immediately and will simplify async. The levels of
+   * detail are decimated on background threads and added to the mesh on the
+   * main thread (see asio::HeartBeat_Sync()).
+   * @param settings a collection of simplification settings
+   * @param parallelProcessing should all levels calculate parallel or one after
+   * the other
+   * @param simplificationType the type of simplification to run
+   * @param successCallback optional success callback to be called after the
+   * simplification finished processing all settings
+   * @returns the current mesh
+   */
+  Mesh& simplify(const std::vector<ISimplificationSettings>& settings,
+                 bool parallelProcessing                      = true,
+                 SimplificationType simplificationType        = SimplificationType::QUADRATIC,
+                 const std::function<void()>& successCallback = nullptr);
+
   /** Instances **/
 
   /**
@@ -1751,6 +1899,22 @@ protected:
    */
   bool get_hasInstances() const override;
 
+  /**
+   * @brief Gets a boolean indicating if this mesh has thin instances.
+   */
+  bool get_hasThinInstances() const override;
+
+  /**
+   * @brief Gets the number of thin instances to display.
+   */
+  size_t get_thinInstanceCount() const;
+
+  /**
+   * @brief Sets the number of thin instances to display. Note that you can't set a number higher
+   * than what the underlying buffer can handle.
+   */
+  void set_thinInstanceCount(size_t value);
+
   /**
    * @brief Gets the morph target manager.
    * @see http://doc.babylonjs.com/how_to/how_to_use_morphtargets
@@ -1841,6 +2005,9 @@ private:
   // influences)
   void normalizeSkinWeightsAndExtra();
   Mesh& _queueLoad(Scene* scene);
+  void _thinInstanceUpdateAttributeBufferSizes(size_t numInstances);
+  void _thinInstanceCreateMatrixBuffer(bool staticBuffer = false);
+  void _thinInstanceCreateAttributeBuffer(const std::string& kind, bool staticBuffer = false);
 
 public:
   /** Events **/
@@ -1993,6 +2160,11 @@ public:
    */
   WriteOnlyProperty<Mesh, size_t> overridenInstanceCount;
 
+  /**
+   * Gets or sets the number of thin instances to display
+   */
+  Property<Mesh, size_t> thinInstanceCount;
+
 private:
   // Internal data
   std::unique_ptr<_InternalMeshDataInfo> _internalMeshDataInfo;
@@ -2005,6 +2177,9 @@ private:
   // Instances
   /** @hidden */
   UserInstancedBuffersStorage _userInstancedBuffersStorage;
+  // Thin instances
+  std::unique_ptr<_ThinInstanceDataStorage> _thinInstanceDataStorage;
+  std::unique_ptr<_UserThinInstanceBuffersStorage> _userThinInstanceBuffersStorage;
   // For extrusion and tube
   Path3D _path3D;
   std::vector<std::vector<Vector3>> _pathArray;
@@ -1,6 +1,8 @@
 #ifndef BABYLON_MESHES_SIMPLIFICATION_DECIMATION_TRIANGLE_H
 #define BABYLON_MESHES_SIMPLIFICATION_DECIMATION_TRIANGLE_H
 
+#include <array>
+
 #include <babylon/babylon_api.h>
 #include <babylon/maths/vector3.h>
 #include <babylon/meshes/simplification/decimation_vertex.h>
@@ -8,23 +10,24 @@
 namespace BABYLON {
 
 /**
- * @brief
+ * @brief Triangle of the mesh being decimated by the quadratic error simplification.
  */
 class BABYLON_SHARED_EXPORT DecimationTriangle {
 
 public:
-  DecimationTriangle(const std::vector<DecimationVertex>& vertices);
+  DecimationTriangle(const std::array<DecimationVertex*, 3>& vertices);
   ~DecimationTriangle(); // = default
 
 public:
   Vector3 normal;
-  std::array<int, 4> error;
+  std::array<float, 4> error;
   bool deleted;
   bool isDirty;
   float borderFactor;
   bool deletePending;
-  float originalOffset;
-  std::vector<DecimationVertex> vertices;
+  size_t originalOffset;
+  /** The vertices are owned by the simplifier */
+  std::array<DecimationVertex*, 3> vertices;
 
 }; // end of class DecimationTriangle
 
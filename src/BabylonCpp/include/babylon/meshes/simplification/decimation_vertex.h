@@ -1,6 +1,8 @@
 #ifndef BABYLON_MESHES_SIMPLIFICATION_DECIMATION_VERTEX_H
 #define BABYLON_MESHES_SIMPLIFICATION_DECIMATION_VERTEX_H
 
+#include <vector>
+
 #include <babylon/babylon_api.h>
 #include <babylon/maths/vector3.h>
 #include <babylon/meshes/simplification/quadratic_matrix.h>
@@ -8,7 +10,7 @@
 namespace BABYLON {
 
 /**
- * @brief
+ * @brief Vertex of the mesh being decimated by the quadratic error simplification.
  */
 class BABYLON_SHARED_EXPORT DecimationVertex {
 
@@ -25,7 +27,8 @@ public:
   bool isBorder;
   int triangleStart;
   int triangleCount;
-  Float32Array originalOffsets;
+  /** Offsets of the original vertices merged into this vertex */
+  std::vector<size_t> originalOffsets;
 
 }; // end of class DecimationVertex
 
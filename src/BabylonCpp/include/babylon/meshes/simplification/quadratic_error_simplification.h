@@ -1,8 +1,16 @@
 #ifndef BABYLON_MESHES_SIMPLIFICATION_QUADRATIC_ERROR_SIMPLIFICATION_H
 #define BABYLON_MESHES_SIMPLIFICATION_QUADRATIC_ERROR_SIMPLIFICATION_H
 
+#include <future>
+#include <vector>
+
 #include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/meshes/simplification/decimation_triangle.h>
+#include <babylon/meshes/simplification/decimation_vertex.h>
+#include <babylon/meshes/simplification/isimplification_settings.h>
 #include <babylon/meshes/simplification/isimplifier.h>
+#include <babylon/meshes/simplification/reference.h>
 
 namespace BABYLON {
 
@@ -17,9 +25,110 @@ namespace BABYLON {
  */
 class BABYLON_SHARED_EXPORT QuadraticErrorSimplification : public ISimplifier {
 
+private:
+  /**
+   * Range of the vertices and indices of a sub mesh
+   */
+  struct SubMeshRange {
+    unsigned int materialIndex;
+    unsigned int verticesStart;
+    size_t verticesCount;
+    unsigned int indexStart;
+    size_t indexCount;
+  }; // end of struct SubMeshRange
+
 public:
-  QuadraticErrorSimplification();
-  virtual ~QuadraticErrorSimplification();
+  /**
+   * @brief Creates a new QuadraticErrorSimplification.
+   * @param mesh defines the mesh to simplify
+   */
+  QuadraticErrorSimplification(Mesh* mesh);
+  ~QuadraticErrorSimplification() override; // = default
+
+  /**
+   * @brief Simplification of a given mesh according to the given settings.
+   * The vertex data of the mesh is copied on the calling thread, the
+   * decimation runs on a background thread and the simplified mesh is created
+   * on the main thread, in the asio callback runner (see
+   * asio::HeartBeat_Sync()). The simplifier must be kept alive until the
+   * success callback is called.
+   * @param settings The settings of the simplification, including quality and
+   * distance
+   * @param successCallback A callback that will be called after the mesh was
+   * simplified.
+   */
+  void simplify(const ISimplificationSettings& settings,
+                const std::function<void(const MeshPtr& simplifiedMesh)>& successCallback) override;
+
+  /**
+   * @brief Hidden
+   * Decimates the copied vertex data, can be called from any thread.
+   */
+  void _decimate(const ISimplificationSettings& settings);
+
+  /**
+   * @brief Hidden
+   * Creates the simplified mesh from the decimated data, must be called from
+   * the main thread.
+   */
+  MeshPtr _createSimplifiedMesh();
+
+private:
+  void _copyMeshData();
+  void runDecimation(const ISimplificationSettings& settings, size_t submeshIndex);
+  void initWithMesh(size_t submeshIndex, bool optimizeMesh);
+  void init();
+  void reconstructMesh(size_t submeshIndex);
+  bool isFlipped(const DecimationVertex& vertex1, const DecimationVertex& vertex2,
+                 const Vector3& point, std::vector<bool>& deletedArray,
+                 std::vector<DecimationTriangle*>& delTr);
+  size_t updateTriangles(DecimationVertex* origVertex, const DecimationVertex& vertex,
+                         const std::vector<bool>& deletedArray, size_t deletedTriangles);
+  void identifyBorder();
+  void updateMesh(bool identifyBorders = false);
+  [[nodiscard]] float vertexError(const QuadraticMatrix& q, const Vector3& point) const;
+  float calculateError(const DecimationVertex& vertex1, const DecimationVertex& vertex2,
+                       Vector3* pointResult = nullptr) const;
+
+public:
+  /**
+   * Aggressiveness of the decimation, higher values collapse more edges on
+   * each iteration
+   */
+  float aggressiveness;
+
+  /**
+   * Maximum number of decimation iterations per sub mesh
+   */
+  size_t decimationIterations;
+
+  /**
+   * Epsilon used to merge the vertices sharing the same position when the
+   * mesh is optimized
+   */
+  float vertexMergeEpsilon;
+
+private:
+  Mesh* _mesh;
+  std::future<void> _decimation;
+  // Decimation state of the current sub mesh
+  std::vector<DecimationTriangle> _triangles;
+  std::vector<DecimationVertex> _vertices;
+  std::vector<Reference> _references;
+  // Copy of the data of the mesh to simplify
+  Float32Array _positionData;
+  Float32Array _normalData;
+  Float32Array _uvs;
+  Float32Array _colorsData;
+  IndicesArray _indices;
+  std::vector<SubMeshRange> _subMeshes;
+  // Decimated data
+  Float32Array _newPositionData;
+  Float32Array _newNormalData;
+  Float32Array _newUVsData;
+  Float32Array _newColorsData;
+  IndicesArray _newIndices;
+  std::vector<SubMeshRange> _newSubMeshes;
 
 }; // end of class QuadraticErrorSimplification
 
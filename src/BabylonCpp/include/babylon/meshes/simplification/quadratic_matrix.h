@@ -21,19 +21,19 @@ public:
   QuadraticMatrix& operator=(QuadraticMatrix&& other);
   ~QuadraticMatrix(); // = default
 
-  float det(unsigned int a11, unsigned int a12, unsigned int a13, //
-            unsigned int a21, unsigned int a22, int unsigned a23, //
-            int unsigned a31, int unsigned a32, int unsigned a33  //
-  );
+  [[nodiscard]] float det(unsigned int a11, unsigned int a12, unsigned int a13, //
+                          unsigned int a21, unsigned int a22, unsigned int a23, //
+                          unsigned int a31, unsigned int a32, unsigned int a33  //
+  ) const;
   void addInPlace(const QuadraticMatrix& matrix);
   void addArrayInPlace(const std::array<float, 10>& data);
-  QuadraticMatrix add(const QuadraticMatrix& matrix);
+  [[nodiscard]] QuadraticMatrix add(const QuadraticMatrix& matrix) const;
 
   static QuadraticMatrix FromData(float a, float b, float c, float d);
   static std::array<float, 10> DataFromNumbers(float a, float b, float c,
                                                float d);
 
-private:
+public:
   std::array<float, 10> data;
 
 }; // end of class QuadraticMatrix
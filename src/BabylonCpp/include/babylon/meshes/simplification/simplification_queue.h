@@ -1,6 +1,7 @@
 #ifndef BABYLON_MESHES_SIMPLIFICATION_SIMPLIFICATION_QUEUE_H
 #define BABYLON_MESHES_SIMPLIFICATION_SIMPLIFICATION_QUEUE_H
 
+#include <memory>
 #include <queue>
 
 #include <babylon/babylon_api.h>
@@ -9,6 +10,7 @@
 namespace BABYLON {
 
 class ISimplifier;
+using ISimplifierPtr = std::shared_ptr<ISimplifier>;
 
 /**
  * @brief Queue used to order the simplification tasks.
@@ -36,12 +38,18 @@ public:
 
   /**
    * @brief Execute a simplification task.
+   * With parallel processing, every level of detail is decimated by its own
+   * simplifier on a background thread, otherwise the levels of detail are
+   * decimated one after the other. The levels are added to the mesh on the
+   * main thread, by the asio callback runner (see asio::HeartBeat_Sync()).
    * @param task defines the task to run
    */
   void runSimplification(const ISimplificationTask& task);
 
 private:
-  ISimplifier* getSimplifier(const ISimplificationTask& task);
+  void runDecimation(const ISimplifierPtr& simplifier, const ISimplificationTask& task,
+                     size_t settingIndex);
+  ISimplifierPtr getSimplifier(const ISimplificationTask& task);
 
 public:
   /**
@@ -0,0 +1,91 @@
+#ifndef BABYLON_MESHES_SOFTWARE_SKINNING_H
+#define BABYLON_MESHES_SOFTWARE_SKINNING_H
+
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+
+class JobPool;
+
+/**
+ * @brief Vertex data read and written by the software skinning kernels. Positions and normals
+ * have 3 floats per vertex, tangents have 4 (the w component is copied). Normals and tangents are
+ * optional, nullptr skips them.
+ */
+struct BABYLON_SHARED_EXPORT SkinnedVertexData {
+  size_t vertexCount           = 0;
+  const float* sourcePositions = nullptr;
+  const float* sourceNormals   = nullptr;
+  const float* sourceTangents  = nullptr;
+  float* positions             = nullptr;
+  float* normals               = nullptr;
+  float* tangents              = nullptr;
+}; // end of struct SkinnedVertexData
+
+/**
+ * @brief CPU kernels skinning and morphing raw vertex buffers, used when the bones or the morph
+ * targets cannot be applied by the vertex shader, or to bake the current pose of a mesh.
+ *
+ * The kernels work on the float arrays of the vertex buffers without any per vertex Vector3 or
+ * Matrix temporary: the weighted bone matrices are accumulated row by row (4 floats at a time with
+ * SSE when OPTION_ENABLE_SIMD is defined), and the vertices are split in chunks over a JobPool.
+ */
+class BABYLON_SHARED_EXPORT SoftwareSkinning {
+
+public:
+  /**
+   * Number of vertices processed by a single job
+   */
+  static constexpr size_t GrainSize = 4096;
+
+public:
+  /**
+   * @brief Skins vertices influenced by up to 4 bones.
+   * @param data defines the source and the skinned vertex data
+   * @param boneMatrices defines the bone matrices, 16 floats per bone (see
+   * Skeleton::getTransformMatrices)
+   * @param matricesIndices defines the 4 bone indices of each vertex
+   * @param matricesWeights defines the 4 bone weights of each vertex
+   * @param jobPool defines the pool splitting the vertices, nullptr to skin on the calling thread
+   */
+  static void Skin4(const SkinnedVertexData& data, const Float32Array& boneMatrices,
+                    const float* matricesIndices, const float* matricesWeights,
+                    JobPool* jobPool = nullptr);
+
+  /**
+   * @brief Skins vertices influenced by up to 8 bones.
+   * @param data defines the source and the skinned vertex data
+   * @param boneMatrices defines the bone matrices, 16 floats per bone
+   * @param matricesIndices defines the first 4 bone indices of each vertex
+   * @param matricesWeights defines the first 4 bone weights of each vertex
+   * @param matricesIndicesExtra defines the last 4 bone indices of each vertex
+   * @param matricesWeightsExtra defines the last 4 bone weights of each vertex
+   * @param jobPool defines the pool splitting the vertices, nullptr to skin on the calling thread
+   */
+  static void Skin8(const SkinnedVertexData& data, const Float32Array& boneMatrices,
+                    const float* matricesIndices, const float* matricesWeights,
+                    const float* matricesIndicesExtra, const float* matricesWeightsExtra,
+                    JobPool* jobPool = nullptr);
+
+  /**
+   * @brief Blends morph targets into a vertex attribute:
+   * result = source + sum(influences[i] * (targets[i] - source)).
+   * @param source defines the attribute data of the mesh
+   * @param targets defines the attribute data of the targets, with the layout of the source
+   * @param influences defines the influence of each target
+   * @param result defines the floatCount floats receiving the morphed data (not the source)
+   * @param floatCount defines the number of floats of the attribute data
+   * @param jobPool defines the pool splitting the data, nullptr to morph on the calling thread
+   */
+  static void Morph(const float* source, const std::vector<const float*>& targets,
+                    const float* influences, float* result, size_t floatCount,
+                    JobPool* jobPool = nullptr);
+
+}; // end of class SoftwareSkinning
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MESHES_SOFTWARE_SKINNING_H
@@ -215,13 +215,9 @@ public:
   bool createBoundingBox;
   size_t _linesIndexCount;
   /** Hidden */
-  std::vector<Vector3> _lastColliderWorldVertices;
-  /** Hidden */
-  std::vector<Plane> _trianglePlanes;
-  /** Hidden */
-  std::unique_ptr<Matrix> _lastColliderTransformMatrix;
-  /** Hidden */
   int _renderId;
+  /** Hidden (Id of the last octree selection containing this submesh) */
+  size_t _octreeSelectionId;
   /** Hidden */
   int _alphaIndex;
   /** Hidden */
@@ -0,0 +1,118 @@
+#ifndef BABYLON_MESHES_TANGENT_SPACE_GENERATOR_H
+#define BABYLON_MESHES_TANGENT_SPACE_GENERATOR_H
+
+#include <functional>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+
+class JobPool;
+
+/**
+ * @brief Computes the normals and the tangents of an indexed triangle mesh from its raw position,
+ * index and uv arrays, spreading the faces and the vertices over a JobPool.
+ *
+ * The generator keeps the faces around each vertex and the face normals of the last computation,
+ * so that updateNormals only recomputes the faces touching a dirty vertex range (for instance the
+ * part of a terrain being edited). The topology is rebuilt when the index array, its size or the
+ * number of vertices change; call markTopologyAsDirty after editing the indices in place.
+ *
+ * The normals are the same as the ones of VertexData::ComputeNormals (normalized sum of the
+ * normalized face normals, accumulated in the same order).
+ */
+class BABYLON_SHARED_EXPORT TangentSpaceGenerator {
+
+public:
+  /**
+   * Number of faces or vertices processed by a single job
+   */
+  static constexpr size_t GrainSize = 4096;
+
+public:
+  /**
+   * @brief Creates a new generator.
+   * @param jobPool defines the pool splitting the work, nullptr to run on the calling thread
+   */
+  explicit TangentSpaceGenerator(JobPool* jobPool = nullptr);
+  ~TangentSpaceGenerator(); // = default
+
+  /**
+   * @brief Computes the normals of all the vertices.
+   * @param positions defines the vertex positions, [...., x, y, z, ......]
+   * @param indices defines the indices in groups of three for each triangular facet
+   * @param normals defines the array receiving the vertex normals, resized to the positions
+   * @param useRightHandedSystem defines whether the faces are wound for a right handed system
+   */
+  void computeNormals(const Float32Array& positions, const Uint32Array& indices,
+                      Float32Array& normals, bool useRightHandedSystem = false);
+
+  /**
+   * @brief Updates the normals after moving a range of vertices: only the faces touching one of
+   * these vertices and the normals of their vertices are recomputed. Falls back to computeNormals
+   * when no computation with the same topology precedes.
+   * @param positions defines the vertex positions
+   * @param indices defines the indices in groups of three for each triangular facet
+   * @param normals defines the normals of the previous computation, updated in place
+   * @param dirtyStart defines the first moved vertex
+   * @param dirtyCount defines the number of moved vertices
+   * @param useRightHandedSystem defines whether the faces are wound for a right handed system
+   */
+  void updateNormals(const Float32Array& positions, const Uint32Array& indices,
+                     Float32Array& normals, size_t dirtyStart, size_t dirtyCount,
+                     bool useRightHandedSystem = false);
+
+  /**
+   * @brief Computes MikkTSpace compatible tangents: the uv tangent of each face is projected on
+   * the plane of the vertex normal and weighted by the angle of the face at the vertex, and the w
+   * component is the orientation of the uvs (bitangent = w * cross(normal, tangent) for the
+   * normals of a right handed system, as in glTF). Vertices on uv seams are expected to be split,
+   * as done by the exporters.
+   * @param positions defines the vertex positions
+   * @param normals defines the vertex normals
+   * @param uvs defines the vertex uvs, [...., u, v, ......]
+   * @param indices defines the indices in groups of three for each triangular facet
+   * @param tangents defines the array receiving the tangents, 4 floats per vertex
+   */
+  void computeTangents(const Float32Array& positions, const Float32Array& normals,
+                       const Float32Array& uvs, const Uint32Array& indices,
+                       Float32Array& tangents);
+
+  /**
+   * @brief Forces the topology to be rebuilt by the next computation.
+   */
+  void markTopologyAsDirty();
+
+private:
+  void _updateTopology(const Uint32Array& indices, size_t nbVertices);
+  void _computeFaceNormal(const Float32Array& positions, const Uint32Array& indices,
+                          size_t face);
+  void _gatherNormal(Float32Array& normals, size_t vertex) const;
+  void _parallelFor(size_t count, const std::function<void(size_t begin, size_t end)>& job) const;
+
+private:
+  JobPool* _jobPool;
+  // Topology: faces around each vertex (compressed rows, in increasing face order)
+  const uint32_t* _indicesData;
+  size_t _nbIndices;
+  size_t _nbVertices;
+  bool _topologyDirty;
+  Uint32Array _vertexFaceOffsets;
+  Uint32Array _vertexFaces;
+  // Face normals of the last computation
+  Float32Array _faceNormals;
+  float _faceNormalSign;
+  bool _faceNormalsValid;
+  // Incremental updates
+  uint32_t _updateId;
+  Uint32Array _faceUpdateIds;
+  Uint32Array _vertexUpdateIds;
+  Uint32Array _dirtyFaces;
+  Uint32Array _dirtyVertices;
+
+}; // end of class TangentSpaceGenerator
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MESHES_TANGENT_SPACE_GENERATOR_H
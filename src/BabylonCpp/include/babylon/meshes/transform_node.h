@@ -95,6 +95,13 @@ public:
   void setProperty(const std::vector<std::string>& targetPropertyPath,
                    const AnimationValue& value) override;
 
+  /**
+   * @brief Hidden Returns a function writing the animated values directly in a property.
+   */
+  AnimatedPropertySetter
+  _getAnimatedPropertySetter(const std::vector<std::string>& targetPropertyPath,
+                             unsigned int animationType) override;
+
   /**
    * @brief Gets a string identifying the name of the class.
    * @returns "TransformNode" string
@@ -433,6 +440,12 @@ public:
   TransformNode& unregisterAfterWorldMatrixUpdate(
     const std::function<void(TransformNode* mesh, EventState& es)>& func);
 
+  /**
+   * @brief Returns whether callback functions are registered to be called after the world matrix
+   * update.
+   */
+  [[nodiscard]] bool hasAfterWorldMatrixUpdateObservers() const;
+
   /**
    * @brief Gets the position of the current mesh in camera space.
    * @param camera defines the camera to use
@@ -176,6 +176,15 @@ public:
    */
   static size_t DeduceStride(const std::string& kind);
 
+  /**
+   * @brief Returns the small integer slot associated to a vertex buffer kind.
+   * Slots are allocated once per kind for the lifetime of the process and are dense, so they can
+   * be used to index flat arrays instead of hashing kind strings on every draw call.
+   * @param kind The kind string to resolve
+   * @returns The slot of the kind
+   */
+  static size_t KindSlot(const std::string& kind);
+
   /**
    * @brief Hidden
    */
@@ -189,6 +198,12 @@ public:
    */
   [[nodiscard]] const std::string& getKind() const;
 
+  /**
+   * @brief Returns the slot of the VertexBuffer kind.
+   * @returns the slot (see VertexBuffer::KindSlot)
+   */
+  [[nodiscard]] size_t getKindSlot() const;
+
   /**
    * @brief Gets a boolean indicating if the VertexBuffer is updatable?
    * @returns true if the buffer is updatable
@@ -377,6 +392,7 @@ public:
 
 private:
   std::string _kind;
+  size_t _kindSlot;
   size_t _size;
   bool _ownsBuffer;
   bool _instanced;
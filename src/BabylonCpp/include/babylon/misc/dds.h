@@ -127,28 +127,21 @@ enum PixelFormat {
 class BABYLON_SHARED_EXPORT DDSTools {
 
 private:
-  static float _ToHalfFloat(float value);
-  static float _FromHalfFloat(uint16_t value);
-  static Float32Array _GetHalfFloatAsFloatRGBAArrayBuffer(float width, float height, int dataOffset,
-                                                          size_t dataLength,
+  static Float32Array _GetHalfFloatAsFloatRGBAArrayBuffer(int dataOffset, size_t dataLength,
                                                           const Uint8Array& arrayBuffer, int lod);
-  static Uint16Array _GetHalfFloatRGBAArrayBuffer(float width, float height, int dataOffset,
-                                                  size_t dataLength, const Uint8Array& arrayBuffer,
-                                                  int lod);
-  static Float32Array _GetFloatRGBAArrayBuffer(float width, float height, int dataOffset,
-                                               size_t dataLength, const Uint8Array& arrayBuffer,
-                                               int lod);
-  static Float32Array _GetFloatAsUIntRGBAArrayBuffer(float width, float height, int dataOffset,
-                                                     size_t dataLength,
+  static Uint16Array _GetHalfFloatRGBAArrayBuffer(int dataOffset, size_t dataLength,
+                                                  const Uint8Array& arrayBuffer, int lod);
+  static Float32Array _GetFloatRGBAArrayBuffer(int dataOffset, size_t dataLength,
+                                               const Uint8Array& arrayBuffer, int lod);
+  static Float32Array _GetFloatAsUIntRGBAArrayBuffer(int dataOffset, size_t dataLength,
                                                      const Uint8Array& arrayBuffer, int lod);
-  static Float32Array _GetHalfFloatAsUIntRGBAArrayBuffer(float width, float height, int dataOffset,
-                                                         size_t dataLength,
+  static Float32Array _GetHalfFloatAsUIntRGBAArrayBuffer(int dataOffset, size_t dataLength,
                                                          const Uint8Array& arrayBuffer, int lod);
-  static Uint8Array _GetRGBAArrayBuffer(float width, float height, int dataOffset,
-                                        size_t dataLength, const Uint8Array& arrayBuffer,
-                                        int rOffset, int gOffset, int bOffset, int aOffset);
+  static Uint8Array _GetRGBAArrayBuffer(int dataOffset, size_t dataLength,
+                                        const Uint8Array& arrayBuffer, int rOffset, int gOffset,
+                                        int bOffset, int aOffset);
   static int _ExtractLongWordOrder(int value);
-  static Uint8Array _GetRGBArrayBuffer(float width, float height, int dataOffset, size_t dataLength,
+  static Uint8Array _GetRGBArrayBuffer(int dataOffset, size_t dataLength,
                                        const Uint8Array& arrayBuffer, int rOffset, int gOffset,
                                        int bOffset);
   static Uint8Array _GetLuminanceArrayBuffer(float width, float height, int dataOffset,
@@ -179,9 +172,6 @@ public:
    */
   static bool StoreLODInAlphaChannel;
 
-  static Float32Array _FloatView;
-  static Int32Array _Int32View;
-
 }; // end of class DDSTools
 
 } // end of namespace BABYLON
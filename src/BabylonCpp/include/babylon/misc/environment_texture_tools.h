@@ -12,6 +12,7 @@ namespace BABYLON {
 class ArrayBufferView;
 class EnvironmentTextureInfo;
 class InternalTexture;
+class SphericalPolynomial;
 using EnvironmentTextureInfoPtr = std::shared_ptr<EnvironmentTextureInfo>;
 using InternalTexturePtr        = std::shared_ptr<InternalTexture>;
 
@@ -50,6 +51,22 @@ public:
   CreateImageDataArrayBufferViews(const ArrayBuffer& arrayBuffer,
                                   const EnvironmentTextureInfo& info);
 
+  /**
+   * @brief Creates the content of an env file from images already encoded on the CPU, for
+   * instance by an offline converter (the reverse of GetEnvInfo and
+   * CreateImageDataArrayBufferViews).
+   * @param imageData defines the RGBD encoded PNG images [mipmap][face], the faces being in the
+   * X+ X- Y+ Y- Z+ Z- order
+   * @param width defines the size of the faces of the first mipmap
+   * @param sphericalPolynomial defines the irradiance stored in the file (none if null)
+   * @param lodGenerationScale defines the scale used to pick the mipmap from the roughness
+   * @returns the env file bytes
+   */
+  static ArrayBuffer CreateEnvArrayBuffer(const std::vector<std::vector<ArrayBuffer>>& imageData,
+                                          int width,
+                                          const SphericalPolynomial* sphericalPolynomial,
+                                          float lodGenerationScale = 0.8f);
+
   /**
    * @brief Uploads the texture info contained in the env file to the GPU.
    * @param texture defines the internal texture to upload to
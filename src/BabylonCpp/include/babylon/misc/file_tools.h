@@ -66,12 +66,23 @@ public:
   /** Helper functions */
 
   /**
-   * @brief Converts an ArrayBuffer to an image.
+   * @brief Converts an ArrayBuffer to an image. Can be called from any thread.
    * @param buffer the arraybuffer holding the image data
    * @return the decoded image
    */
   static Image ArrayBufferToImage(const ArrayBuffer& buffer, bool flipVertically = false);
 
+  /**
+   * @brief Converts an ArrayBuffer to an image, storing the pixels in the given buffer. Can be
+   * called from any thread.
+   * @param buffer the arraybuffer holding the image data
+   * @param flipVertically whether or not to flip the image vertically
+   * @param storage buffer receiving the pixels, so that its allocation can be reused
+   * @return the decoded image
+   */
+  static Image ArrayBufferToImage(const ArrayBuffer& buffer, bool flipVertically,
+                                  ArrayBuffer&& storage);
+
   /**
    * @brief Converts an string to an image.
    * @param buffer the string holding the image data
@@ -2,19 +2,25 @@
 #define BABYLON_MISC_HIGH_DYNAMIC_RANGE_PANORAMA_TO_CUBE_MAP_TOOLS_H
 
 #include <babylon/babylon_api.h>
-#include <babylon/maths/color3.h>
 #include <babylon/maths/vector3.h>
 #include <babylon/misc/highdynamicrange/cube_map_info.h>
 
 namespace BABYLON {
 
+class JobPool;
+
 /**
  * @brief Helper class useful to convert panorama picture to their cubemap
  * representation in 6 faces.
+ *
+ * The rows of the 6 faces are independent and are spread over a JobPool.
  */
 class BABYLON_SHARED_EXPORT PanoramaToCubeMapTools {
 
 private:
+  // Number of face rows processed by a single job
+  static constexpr size_t RowGrainSize = 4;
+
   static std::array<Vector3, 4> FACE_FRONT;
   static std::array<Vector3, 4> FACE_BACK;
   static std::array<Vector3, 4> FACE_RIGHT;
@@ -32,20 +38,26 @@ public:
    * @param inputHeight The height of the input panorama.
    * @param size The willing size of the generated cubemap (each faces will be
    * size * size pixels)
+   * @param jobPool The pool processing the rows of the faces (the default pool
+   * if null)
    * @return The cubemap data
    */
   static CubeMapInfo ConvertPanoramaToCubemap(const Float32Array& float32Array,
                                               size_t inputWidth,
-                                              size_t inputHeight, size_t size);
+                                              size_t inputHeight, size_t size,
+                                              JobPool* jobPool = nullptr);
 
 private:
-  static Float32Array
-  CreateCubemapTexture(size_t texSize, const std::array<Vector3, 4>& faceData,
-                       const Float32Array& float32Array, size_t inputWidth,
-                       size_t inputHeight);
-  static Color3 CalcProjectionSpherical(const Vector3& vDir,
-                                        const Float32Array& float32Array,
-                                        size_t inputWidth, size_t inputHeight);
+  /**
+   * @brief Computes a row of a face: the directions of the texels are
+   * interpolated and normalized one axis at a time in directions (3 * texSize
+   * floats), then projected on the panorama.
+   */
+  static void CreateCubemapRow(size_t texSize, size_t y,
+                               const std::array<Vector3, 4>& faceData,
+                               const Float32Array& float32Array,
+                               size_t inputWidth, size_t inputHeight,
+                               float* directions, float* rgb);
 
 }; // end of struct PanoramaToCubeMapTools
 
@@ -15,6 +15,8 @@
 
 namespace BABYLON {
 
+class JobPool;
+
 /**
  * Helper class to PreProcess a cubemap in order to generate mipmap according
  * to the level of blur required by the glossinees of a material.
@@ -112,6 +114,10 @@ private:
   //  the order is upper left, upper right, lower left, lower right
   static const std::vector<Uint32Array> _sgCubeCornerList;
 
+  // Number of output rows filtered by a single job, the rows of the smallest
+  // mips are the most expensive ones since their filter covers most of the cube
+  static constexpr size_t RowGrainSize = 1;
+
 public:
   /**
    * Constructor of the generator.
@@ -131,10 +137,13 @@ public:
    * @param excludeBase Specifies wether to process the level 0 (original level)
    * or not
    * @param fixup Specifies wether to apply the edge fixup algorythm or not
+   * @param jobPool The pool filtering the rows of the faces (the default pool
+   * if null)
    */
   PMREMGenerator(const std::vector<ArrayBufferView>& input, int inputSize, int outputSize,
                  size_t maxNumMipLevels, size_t numChannels, bool isFloat, float specularPower,
-                 float cosinePowerDropPerMip, bool excludeBase, bool fixup);
+                 float cosinePowerDropPerMip, bool excludeBase, bool fixup,
+                 JobPool* jobPool = nullptr);
   ~PMREMGenerator(); // = default
 
   /**
@@ -182,9 +191,10 @@ private:
   [[nodiscard]] float getBaseFilterAngle(float cosinePower) const;
 
   //----------------------------------------------------------------------------
-  // Builds the following lookup tables prior to filtering:
+  // Builds the following lookup tables prior to filtering, they only depend on
+  // the source size and are shared by every mip level:
   //  -normalizer cube map
-  //  -tap weight lookup table
+  //  -texel solid angles
   //
   //----------------------------------------------------------------------------
   void precomputeFilterLookupTables(size_t srcCubeMapWidth);
@@ -198,8 +208,9 @@ private:
   //
   // Note that this normalizer cube map stores the vectors in unbiased -1 to 1
   // range.
-  // if _bx2 style scaled and biased vectors are needed, uncomment the SCALE and
-  // BIAS below
+  // Each face stores 4 planes of size * size floats: the x, y and z components
+  // of the vectors and the solid angles, so that a row of taps can be tested
+  // against the filter cone with a loop the compiler vectorizes.
   //----------------------------------------------------------------------------
   void buildNormalizerSolidAngleCubemap(size_t size);
 
@@ -305,12 +316,13 @@ private:
   //----------------------------------------------------------------------------
   // ProcessFilterExtents
   //  Process bounding box in each cube face
+  //  tapDotProducts is a scratch buffer of srcSize floats
   //
   //----------------------------------------------------------------------------
   Vector4 processFilterExtents(const Vector4& centerTapDir, float dotProdThresh,
                                const std::array<CMGBoundinBox, 6>& filterExtents,
                                const std::vector<ArrayBufferView>& srcCubeMap, size_t srcSize,
-                               size_t specularPower) const;
+                               float specularPower, Float32Array& tapDotProducts) const;
 
   //----------------------------------------------------------------------------
   // Fixup cube edges
@@ -333,10 +345,10 @@ public:
   bool fixup;
 
 private:
+  JobPool* _jobPool;
   std::vector<std::vector<ArrayBufferView>> _outputSurface;
   std::vector<ArrayBufferView> _normCubeMap;
-  std::vector<std::vector<ArrayBufferView>> _filterLUT;
-  int _numMipLevels;
+  size_t _numMipLevels;
 
 }; // end of class PMREMGenerator
 
@@ -0,0 +1,94 @@
+#ifndef BABYLON_MISC_JOB_POOL_H
+#define BABYLON_MISC_JOB_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Fixed pool of worker threads used to split data parallel work (such as the per mesh
+ * part of the active meshes evaluation) across the available cores.
+ *
+ * The range given to parallelFor is cut in chunks of grainSize items which are claimed by the
+ * workers and by the calling thread until none is left, parallelFor returns once every chunk is
+ * processed. A parallelFor issued from inside a job runs serially on the calling thread.
+ */
+class BABYLON_SHARED_EXPORT JobPool {
+
+public:
+  /**
+   * Signature of a job: processes the items in [begin, end)
+   */
+  using Job = std::function<void(size_t begin, size_t end)>;
+
+public:
+  /**
+   * @brief Returns the default pool, using one worker per hardware thread besides the calling
+   * one.
+   */
+  static JobPool& Default();
+
+  /**
+   * @brief Creates a new pool.
+   * @param nbWorkers defines the number of worker threads (0 to always run on the calling thread)
+   */
+  explicit JobPool(size_t nbWorkers);
+  JobPool(const JobPool& other) = delete;
+  JobPool& operator=(const JobPool& other) = delete;
+  ~JobPool(); // = default
+
+  /**
+   * @brief Returns the number of threads processing the jobs (workers and calling thread).
+   */
+  [[nodiscard]] size_t concurrency() const
+  {
+    return _workers.size() + 1;
+  }
+
+  /**
+   * @brief Processes the items in [0, count) in chunks of grainSize items spread over the pool.
+   * The first exception thrown by the job is rethrown once every chunk is done.
+   * @param count defines the number of items to process
+   * @param grainSize defines the number of items processed by a single job call
+   * @param job defines the function called for each chunk
+   */
+  void parallelFor(size_t count, size_t grainSize, const Job& job);
+
+private:
+  void _workerLoop();
+  void _runChunks();
+
+private:
+  std::vector<std::thread> _workers;
+  // Serializes parallelFor calls issued from different threads
+  std::mutex _dispatchMutex;
+  // Protects the state below and the conditions
+  std::mutex _mutex;
+  std::condition_variable _wakeCondition;
+  std::condition_variable _doneCondition;
+  bool _stopping;
+  uint64_t _generation;
+  size_t _activeWorkers;
+  std::exception_ptr _exception;
+  // Current job, only written when no worker is active
+  const Job* _job;
+  size_t _count;
+  size_t _grainSize;
+  size_t _nbChunks;
+  std::atomic<size_t> _nextChunk;
+  std::atomic<size_t> _remainingChunks;
+
+}; // end of class JobPool
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MISC_JOB_POOL_H
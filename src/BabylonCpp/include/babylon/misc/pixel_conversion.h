@@ -0,0 +1,168 @@
+#ifndef BABYLON_MISC_PIXEL_CONVERSION_H
+#define BABYLON_MISC_PIXEL_CONVERSION_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Pixel format conversions used by the texture loaders (DDS, HDR, TGA, ...).
+ *
+ * The kernels convert arrays of pixels into buffers provided by the caller, which must not overlap
+ * the source unless stated otherwise. The channel offsets give the position of a channel in a
+ * source pixel (0 for the first byte).
+ *
+ * When OPTION_ENABLE_SIMD is defined the kernels use SSE2 (x86) or NEON (ARM), and on x86 the
+ * half float conversions use F16C and the byte shuffles use SSSE3 when the CPU supports them. The
+ * results are identical to the scalar ones, the half floats being rounded to the nearest even.
+ */
+class BABYLON_SHARED_EXPORT PixelConversion {
+
+public:
+  /**
+   * @brief Returns the instruction sets used by the kernels, for instance "SSE2 SSSE3 F16C".
+   */
+  static const char* InstructionSets();
+
+  /**
+   * @brief Enables or disables the SIMD kernels, for instance to compare them with the scalar
+   * ones. They are enabled by default.
+   */
+  static void SetSIMDEnabled(bool enabled);
+
+  /**
+   * @brief Converts a half float to a float.
+   */
+  static float HalfToFloat(uint16_t value);
+
+  /**
+   * @brief Converts a float to a half float (overflows become infinities).
+   */
+  static uint16_t FloatToHalf(float value);
+
+  /**
+   * @brief Converts half floats to floats.
+   * @param source defines count half floats
+   * @param destination defines the count floats receiving the values
+   * @param count defines the number of values
+   */
+  static void HalfToFloat(const uint16_t* source, float* destination, size_t count);
+
+  /**
+   * @brief Converts floats to half floats.
+   * @param source defines count floats
+   * @param destination defines the count half floats receiving the values
+   * @param count defines the number of values
+   */
+  static void FloatToHalf(const float* source, uint16_t* destination, size_t count);
+
+  /**
+   * @brief Clamps floats between 0 and 1 and scales them to [0, 255] (NaN becomes 0).
+   * @param source defines count floats
+   * @param destination defines the count floats receiving the values, can be the source
+   * @param count defines the number of values
+   */
+  static void FloatToByteRange(const float* source, float* destination, size_t count);
+
+  /**
+   * @brief Converts half floats to floats clamped between 0 and 1 and scaled to [0, 255].
+   * @param source defines count half floats
+   * @param destination defines the count floats receiving the values
+   * @param count defines the number of values
+   */
+  static void HalfToByteRange(const uint16_t* source, float* destination, size_t count);
+
+  /**
+   * @brief Sets the alpha channel of RGBA pixels.
+   * @param rgba defines the pixels to update
+   * @param nbPixels defines the number of pixels
+   * @param alpha defines the alpha value
+   */
+  static void FillAlpha(float* rgba, size_t nbPixels, float alpha);
+  static void FillAlpha(uint16_t* rgba, size_t nbPixels, uint16_t alpha);
+
+  /**
+   * @brief Converts RGBE pixels stored as planes (as in the run length encoded scanlines of the
+   * Radiance HDR files) to RGB floats.
+   * @param red defines the count red mantissas
+   * @param green defines the count green mantissas
+   * @param blue defines the count blue mantissas
+   * @param exponents defines the count shared exponents
+   * @param rgb defines the 3 * count floats receiving the pixels
+   * @param count defines the number of pixels
+   */
+  static void RGBEToFloat(const uint8_t* red, const uint8_t* green, const uint8_t* blue,
+                          const uint8_t* exponents, float* rgb, size_t count);
+
+  /**
+   * @brief Encodes RGB floats to RGBD bytes as the rgbdEncode shader does (used by the .env
+   * files): the color is scaled by D to fit in [0, 1] and stored in gamma space. This kernel is
+   * scalar.
+   * @param rgb defines the 3 * nbPixels floats
+   * @param rgbd defines the 4 * nbPixels bytes receiving the pixels
+   * @param nbPixels defines the number of pixels
+   */
+  static void FloatToRGBD(const float* rgb, uint8_t* rgbd, size_t nbPixels);
+
+  /**
+   * @brief Reorders the channels of 4 bytes pixels, for instance BGRA to RGBA.
+   * @param source defines the nbPixels source pixels
+   * @param destination defines the nbPixels RGBA pixels receiving the channels
+   * @param nbPixels defines the number of pixels
+   * @param rOffset defines the offset of the red channel in a source pixel
+   * @param gOffset defines the offset of the green channel in a source pixel
+   * @param bOffset defines the offset of the blue channel in a source pixel
+   * @param aOffset defines the offset of the alpha channel in a source pixel
+   */
+  static void SwizzleRGBA(const uint8_t* source, uint8_t* destination, size_t nbPixels,
+                          int rOffset, int gOffset, int bOffset, int aOffset);
+
+  /**
+   * @brief Reorders the channels of 3 bytes pixels, for instance BGR to RGB.
+   * @param source defines the nbPixels source pixels
+   * @param destination defines the nbPixels RGB pixels receiving the channels
+   * @param nbPixels defines the number of pixels
+   * @param rOffset defines the offset of the red channel in a source pixel
+   * @param gOffset defines the offset of the green channel in a source pixel
+   * @param bOffset defines the offset of the blue channel in a source pixel
+   */
+  static void SwizzleRGB(const uint8_t* source, uint8_t* destination, size_t nbPixels,
+                         int rOffset, int gOffset, int bOffset);
+
+  /**
+   * @brief Converts 3 bytes pixels, for instance BGR, to opaque RGBA pixels.
+   * @param source defines the nbPixels source pixels
+   * @param destination defines the nbPixels RGBA pixels receiving the channels
+   * @param nbPixels defines the number of pixels
+   * @param rOffset defines the offset of the red channel in a source pixel
+   * @param gOffset defines the offset of the green channel in a source pixel
+   * @param bOffset defines the offset of the blue channel in a source pixel
+   */
+  static void RGBToRGBA(const uint8_t* source, uint8_t* destination, size_t nbPixels,
+                        int rOffset, int gOffset, int bOffset);
+
+  /**
+   * @brief Expands luminance pixels to opaque RGBA pixels.
+   * @param source defines the nbPixels luminance bytes
+   * @param destination defines the nbPixels RGBA pixels
+   * @param nbPixels defines the number of pixels
+   */
+  static void LuminanceToRGBA(const uint8_t* source, uint8_t* destination, size_t nbPixels);
+
+  /**
+   * @brief Expands luminance alpha pixels to RGBA pixels.
+   * @param source defines the nbPixels luminance alpha pairs
+   * @param destination defines the nbPixels RGBA pixels
+   * @param nbPixels defines the number of pixels
+   */
+  static void LuminanceAlphaToRGBA(const uint8_t* source, uint8_t* destination,
+                                   size_t nbPixels);
+
+}; // end of class PixelConversion
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MISC_PIXEL_CONVERSION_H
@@ -0,0 +1,206 @@
+#ifndef BABYLON_MISC_TEXTURE_PIPELINE_H
+#define BABYLON_MISC_TEXTURE_PIPELINE_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/core/structs.h>
+#include <babylon/misc/observable.h>
+
+namespace BABYLON {
+
+class TexturePipeline;
+using TexturePipelinePtr = std::shared_ptr<TexturePipeline>;
+
+/**
+ * @brief Timings of an image loaded through the texture pipeline.
+ */
+struct BABYLON_SHARED_EXPORT TextureLoadTiming {
+  /**
+   * Url of the image
+   */
+  std::string url;
+  /**
+   * Size of the decoded image
+   */
+  int width  = 0;
+  int height = 0;
+  /**
+   * Time spent decoding the image (and generating its mip levels) on a worker, in milliseconds
+   */
+  double decodeMs = 0.0;
+  /**
+   * Time spent uploading the image on the rendering thread, in milliseconds
+   */
+  double uploadMs = 0.0;
+}; // end of struct TextureLoadTiming
+
+/**
+ * @brief Texture loading stage decoding the images (PNG, JPEG, TGA, BMP, HDR, ...) on worker
+ * threads instead of the thread raising the io callbacks.
+ *
+ * The decoded pixels, and optionally their premultiplied alpha and their mip levels computed on
+ * the CPU, are stored in staging buffers recycled between images. They are handed to the upload
+ * callbacks by uploadDecodedImages, which the engine calls at the beginning of each frame and
+ * which stops once the upload budget of the frame is spent.
+ */
+class BABYLON_SHARED_EXPORT TexturePipeline {
+
+public:
+  /**
+   * Called on the rendering thread with the decoded image and its mip levels (empty unless
+   * generateMipMaps is set)
+   */
+  using OnLoadFunction
+    = std::function<void(const Image& image, const std::vector<Image>& mipMaps)>;
+  using OnErrorFunction
+    = std::function<void(const std::string& message, const std::string& exception)>;
+
+public:
+  /**
+   * @brief Creates a new texture pipeline.
+   * @param nbWorkers defines the number of decoding threads (0 to use one per hardware thread
+   * besides the calling one, at most 8)
+   */
+  explicit TexturePipeline(size_t nbWorkers = 0);
+  TexturePipeline(const TexturePipeline& other) = delete;
+  TexturePipeline& operator=(const TexturePipeline& other) = delete;
+  ~TexturePipeline(); // = default
+
+  /**
+   * @brief Multiplies the color channels of a RGBA image by its alpha channel.
+   * @param image defines the image to update
+   */
+  static void PremultiplyAlpha(Image& image);
+
+  /**
+   * @brief Computes the next mip level of a RGBA image with a 2x2 box filter.
+   * @param image defines the source level
+   * @param storage defines a buffer which can be reused to store the level
+   * @returns the next mip level
+   */
+  static Image DownsampleImage(const Image& image, ArrayBuffer&& storage = ArrayBuffer());
+
+  /**
+   * @brief Loads an image from an url and queues it for decoding.
+   * @param url defines the url of the image
+   * @param flipVertically defines whether to flip the image vertically
+   * @param onLoad defines the callback receiving the decoded image
+   * @param onError defines the callback called when the image fails to load or decode
+   */
+  void loadImageFromUrl(const std::string& url, bool flipVertically,
+                        const OnLoadFunction& onLoad, const OnErrorFunction& onError);
+
+  /**
+   * @brief Queues an encoded image for decoding.
+   * @param url defines the url of the image, used to report the timings
+   * @param buffer defines the encoded image
+   * @param flipVertically defines whether to flip the image vertically
+   * @param onLoad defines the callback receiving the decoded image
+   * @param onError defines the callback called when the image fails to decode
+   */
+  void decodeAsync(const std::string& url, ArrayBuffer buffer, bool flipVertically,
+                   const OnLoadFunction& onLoad, const OnErrorFunction& onError);
+
+  /**
+   * @brief Calls the upload callbacks of the decoded images, at least one and until the upload
+   * budget is spent. Must be called on the rendering thread.
+   * @returns the number of images uploaded
+   */
+  size_t uploadDecodedImages();
+
+  /**
+   * @brief Returns the number of images being decoded or waiting to be uploaded.
+   */
+  [[nodiscard]] size_t pendingImages() const;
+
+  /**
+   * @brief Blocks until every queued image is decoded (should be used only in testing code).
+   */
+  void waitDecoding();
+
+  /**
+   * @brief Drops the queued and decoded images without calling their callbacks.
+   */
+  void clear();
+
+private:
+  struct DecodeRequest {
+    std::string url;
+    ArrayBuffer buffer;
+    bool flipVertically;
+    bool premultiplyAlpha;
+    bool generateMipMaps;
+    OnLoadFunction onLoad;
+    OnErrorFunction onError;
+  }; // end of struct DecodeRequest
+
+  struct DecodedImage {
+    std::string url;
+    Image image;
+    std::vector<Image> mipMaps;
+    double decodeMs = 0.0;
+    OnLoadFunction onLoad;
+    OnErrorFunction onError;
+  }; // end of struct DecodedImage
+
+  void _workerLoop();
+  DecodedImage _decode(DecodeRequest& request);
+  ArrayBuffer _acquireStagingBuffer();
+  void _releaseStagingBuffer(ArrayBuffer&& buffer);
+
+public:
+  /**
+   * Defines whether the color channels are multiplied by the alpha channel on the CPU
+   */
+  bool premultiplyAlpha;
+
+  /**
+   * Defines whether the mip levels are generated on the CPU (instead of by the driver)
+   */
+  bool generateMipMaps;
+
+  /**
+   * Time that uploadDecodedImages may spend per frame, in milliseconds
+   */
+  double uploadBudget;
+
+  /**
+   * Maximum number of staging buffers kept for the next images
+   */
+  size_t maxStagingBuffers;
+
+  /**
+   * Observable raised on the rendering thread after an image is uploaded
+   */
+  Observable<TextureLoadTiming> onImageUploadedObservable;
+
+private:
+  std::vector<std::thread> _workers;
+  // Protects the queues, the counters and the conditions
+  mutable std::mutex _mutex;
+  std::condition_variable _wakeCondition;
+  std::condition_variable _idleCondition;
+  bool _stopping;
+  std::deque<DecodeRequest> _decodeQueue;
+  std::deque<DecodedImage> _decodedImages;
+  size_t _decodingImages;
+  // Incremented by clear, the images decoded for a previous generation are dropped
+  uint64_t _generation;
+  // Staging buffers, guarded by their own mutex
+  std::mutex _stagingMutex;
+  std::vector<ArrayBuffer> _stagingBuffers;
+
+}; // end of class TexturePipeline
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MISC_TEXTURE_PIPELINE_H
@@ -46,6 +46,13 @@ public:
   void setProperty(const std::vector<std::string>& targetPropertyPath,
                    const AnimationValue& value) override;
 
+  /**
+   * @brief Hidden Returns a function writing the animated values directly in a property.
+   */
+  AnimatedPropertySetter
+  _getAnimatedPropertySetter(const std::vector<std::string>& targetPropertyPath,
+                             unsigned int animationType) override;
+
   /**
    * @brief Gets the animations.
    */
@@ -7,6 +7,7 @@
 
 namespace BABYLON {
 
+class JobPool;
 class MorphTargetManager;
 using MorphTargetManagerPtr = std::shared_ptr<MorphTargetManager>;
 
@@ -74,6 +75,18 @@ public:
    */
   void synchronize();
 
+  /**
+   * @brief Blends the active targets into vertex data on the CPU, for engines which cannot morph
+   * the vertices in the vertex shader or to bake the current shape of a mesh.
+   * @param kind defines the kind of the data (VertexBuffer::PositionKind, NormalKind or UVKind)
+   * @param source defines the vertex data of the mesh
+   * @param result defines the array receiving the morphed data, resized to the size of the source
+   * @param jobPool defines the pool splitting the work, nullptr to morph on the calling thread
+   * @returns false if an active target has no data of this kind, or data of a different size
+   */
+  bool blendVertexData(const std::string& kind, const Float32Array& source, Float32Array& result,
+                       JobPool* jobPool = nullptr) const;
+
   // Statics
   static MorphTargetManagerPtr Parse(const json& serializationObject, Scene* scene);
 
@@ -0,0 +1,213 @@
+#ifndef BABYLON_PARTICLES_PARTICLE_SOA_STORAGE_H
+#define BABYLON_PARTICLES_PARTICLE_SOA_STORAGE_H
+
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/maths/vector3.h>
+
+namespace BABYLON {
+
+class ColorGradient;
+class FactorGradient;
+class Particle;
+
+/**
+ * @brief Layout of the particle vertex buffer written by ParticleSoAStorage::writeVertices.
+ */
+struct BABYLON_SHARED_EXPORT ParticleSoAVertexLayout {
+  /**
+   * Direction written after the size
+   */
+  enum class DirectionMode {
+    /** No direction is written (billboard) */
+    None,
+    /** The direction is written (stretched billboard) */
+    Direction,
+    /** The initial direction is written when set, otherwise the direction (no billboard) */
+    InitialDirection,
+  };
+
+  /**
+   * Number of floats per vertex
+   */
+  unsigned int vertexBufferSize = 0;
+  /**
+   * Whether a single instanced vertex is written per particle instead of 4 corners
+   */
+  bool useInstancing = false;
+  /**
+   * Direction written after the size
+   */
+  DirectionMode directionMode = DirectionMode::None;
+  /**
+   * Offset added to every position
+   */
+  Vector3 worldOffset;
+}; // end of struct ParticleSoAVertexLayout
+
+/**
+ * @brief Structure of arrays storage of the particles data updated every frame.
+ * Each attribute lives in its own contiguous array, so that the update kernels stream over the
+ * particles with unit stride loops the compiler can vectorize, instead of chasing one heap object
+ * per particle.
+ */
+class BABYLON_SHARED_EXPORT ParticleSoAStorage {
+
+public:
+  ParticleSoAStorage();
+  ~ParticleSoAStorage(); // = default
+
+  /**
+   * @brief Returns the number of stored particles.
+   */
+  [[nodiscard]] size_t size() const
+  {
+    return _count;
+  }
+
+  /**
+   * @brief Sets the number of stored particles.
+   */
+  void resize(size_t count);
+
+  /**
+   * @brief Copies the per frame data of a particle into the given slot.
+   */
+  void load(size_t index, const Particle& particle);
+
+  /**
+   * @brief Copies the given slot back into a particle.
+   */
+  void store(size_t index, Particle& particle) const;
+
+  /**
+   * @brief Copies the data of a slot into another one.
+   */
+  void copy(size_t from, size_t to);
+
+  /**
+   * @brief Ages the particles.
+   * Fills the step (update speed clamped to the remaining life time) and the age ratio of each
+   * particle used by the other kernels.
+   * @param scaledUpdateSpeed defines the update speed of the frame
+   */
+  void integrateAge(float scaledUpdateSpeed);
+
+  /**
+   * @brief Moves the colors along their color step.
+   */
+  void integrateColor();
+
+  /**
+   * @brief Samples the color gradients at the age ratio of the particles.
+   */
+  void sampleColor(const std::vector<ColorGradient>& colorGradients);
+
+  /**
+   * @brief Samples the angular speed gradients at the age ratio of the particles.
+   */
+  void sampleAngularSpeed(const std::vector<FactorGradient>& angularSpeedGradients);
+
+  /**
+   * @brief Rotates the particles with their angular speed.
+   */
+  void integrateAngle();
+
+  /**
+   * @brief Moves the particles along their direction and updates the direction.
+   * @param velocityGradients defines the velocity gradients (can be empty)
+   * @param dragGradients defines the drag gradients (can be empty)
+   * @param limitVelocityGradients defines the limit velocity gradients (can be empty)
+   * @param limitVelocityDamping defines the damping applied when the velocity is over the limit
+   * @param gravity defines the gravity to apply
+   */
+  void integratePosition(const std::vector<FactorGradient>& velocityGradients,
+                         const std::vector<FactorGradient>& dragGradients,
+                         const std::vector<FactorGradient>& limitVelocityGradients,
+                         float limitVelocityDamping, const Vector3& gravity);
+
+  /**
+   * @brief Samples the size gradients at the age ratio of the particles.
+   */
+  void sampleSize(const std::vector<FactorGradient>& sizeGradients);
+
+  /**
+   * @brief Returns whether a particle reached its life time.
+   */
+  [[nodiscard]] bool isDead(size_t index) const
+  {
+    return _age[index] >= _lifeTime[index];
+  }
+
+  /**
+   * @brief Writes the particles into the vertex data.
+   * @param vertexData defines the vertex data to fill (must be large enough)
+   * @param layout defines the vertex layout
+   */
+  void writeVertices(Float32Array& vertexData, const ParticleSoAVertexLayout& layout) const;
+
+  /**
+   * @brief Returns whether every gradient of the list has a single factor, which is required to
+   * sample it without per particle state.
+   */
+  static bool IsDeterministic(const std::vector<FactorGradient>& gradients);
+
+  /**
+   * @brief Returns whether every gradient of the list has a single color, which is required to
+   * sample it without per particle state.
+   */
+  static bool IsDeterministic(const std::vector<ColorGradient>& gradients);
+
+private:
+  /**
+   * @brief Samples factor gradients at the age ratio of the particles, the same way
+   * GradientHelper::GetCurrentGradient does for a single particle.
+   */
+  void _sampleFactorGradients(const std::vector<FactorGradient>& gradients, float* result) const;
+
+private:
+  size_t _count;
+  // Position
+  Float32Array _positionX;
+  Float32Array _positionY;
+  Float32Array _positionZ;
+  // Direction
+  Float32Array _directionX;
+  Float32Array _directionY;
+  Float32Array _directionZ;
+  // Initial direction (_hasInitialDirection is 1 when set, 0 otherwise)
+  Float32Array _initialDirectionX;
+  Float32Array _initialDirectionY;
+  Float32Array _initialDirectionZ;
+  Float32Array _hasInitialDirection;
+  // Color
+  Float32Array _colorR;
+  Float32Array _colorG;
+  Float32Array _colorB;
+  Float32Array _colorA;
+  Float32Array _colorStepR;
+  Float32Array _colorStepG;
+  Float32Array _colorStepB;
+  Float32Array _colorStepA;
+  // Life
+  Float32Array _age;
+  Float32Array _lifeTime;
+  // Size and rotation
+  Float32Array _size;
+  Float32Array _scaleX;
+  Float32Array _scaleY;
+  Float32Array _angle;
+  Float32Array _angularSpeed;
+  // Per frame scratch arrays
+  Float32Array _step;
+  Float32Array _ratio;
+  Float32Array _directionScale;
+  Float32Array _scratch;
+
+}; // end of class ParticleSoAStorage
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PARTICLES_PARTICLE_SOA_STORAGE_H
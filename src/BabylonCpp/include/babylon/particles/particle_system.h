@@ -8,6 +8,7 @@
 #include <babylon/misc/observer.h>
 #include <babylon/particles/base_particle_system.h>
 #include <babylon/particles/iparticle_system.h>
+#include <typeinfo>
 #include <unordered_map>
 
 namespace BABYLON {
@@ -16,6 +17,7 @@ class Buffer;
 class Effect;
 class Mesh;
 class Particle;
+class ParticleSoAStorage;
 class Scene;
 class VertexBuffer;
 class WebGLDataBuffer;
@@ -477,6 +479,16 @@ protected:
 
   void _reset() override;
 
+  /**
+   * @brief Gets whether the particles are stored as a structure of arrays.
+   */
+  [[nodiscard]] bool get_useStructureOfArrays() const;
+
+  /**
+   * @brief Sets whether the particles are stored as a structure of arrays.
+   */
+  void set_useStructureOfArrays(bool value);
+
 private:
   float _fetchR(float u, float v, float width, float height, const Uint8Array& pixels);
   void _addFactorGradient(std::vector<FactorGradient>& factorGradients, float gradient,
@@ -494,6 +506,8 @@ private:
   void _emitFromParticle(Particle* particle);
   // End of sub system methods
   void _update(int newParticles);
+  bool _canUseStructureOfArraysKernels();
+  void _updateStructureOfArrays();
   EffectPtr _getEffect(unsigned int blendMode);
   void _appendParticleVertices(unsigned int offset, Particle* particle);
   size_t _render(unsigned int blendMode);
@@ -513,6 +527,17 @@ public:
    */
   std::function<void(std::vector<Particle*>& particles)> updateFunction;
 
+  /**
+   * Gets or sets whether the per frame data of the particles (position, direction, color, age,
+   * size, angle) is stored as a structure of arrays updated by vectorizable kernels which write
+   * straight into the vertex buffer. This is the layout to use for systems with many particles.
+   * A custom updateFunction, a noise texture, an animation sheet, ramp gradients, sub-emitters or
+   * gradients with random ranges are still supported: the particles are then copied back to
+   * Particle objects, updated by updateFunction and copied again into the arrays.
+   * (Default: false)
+   */
+  Property<ParticleSystem, bool> useStructureOfArrays;
+
   /**
    * This function can be defined to specify initial direction for every new
    * particle. It by default use the emitterType defined function
@@ -620,6 +645,9 @@ private:
 
   Matrix _emitterWorldMatrix;
 
+  std::unique_ptr<ParticleSoAStorage> _soaStorage;
+  const std::type_info* _defaultUpdateFunctionType;
+
 }; // end of class ParticleSystem
 
 } // end of namespace BABYLON
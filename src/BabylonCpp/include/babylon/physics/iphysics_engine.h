@@ -6,13 +6,14 @@
 
 namespace BABYLON {
 
+class AbstractMesh;
 struct IPhysicsBody;
-struct IPhysicsEnabledObject;
 struct IPhysicsEnginePlugin;
 class PhysicsImpostor;
 class PhysicsJoint;
 class PhysicsRaycastResult;
-using PhysicsImpostorPtr = std::shared_ptr<PhysicsImpostor>;
+using IPhysicsEnabledObject = AbstractMesh;
+using PhysicsImpostorPtr    = std::shared_ptr<PhysicsImpostor>;
 
 /**
  * @brief Interface used to define a physics engine.
@@ -118,7 +119,7 @@ struct BABYLON_SHARED_EXPORT IPhysicsEngine {
    * @brief Gets the list of physic impostors
    * @returns an array of PhysicsImpostor
    */
-  virtual std::vector<PhysicsImpostorPtr>& getImpostors() = 0;
+  virtual std::vector<PhysicsImpostor*>& getImpostors() = 0;
 
   /**
    * @brief Gets the impostor for a physics enabled object
@@ -132,7 +132,7 @@ public:
    * @brief Gets the list of physic impostors.
    * @returns an array of PhysicsImpostor
    */
-  std::vector<PhysicsImpostorPtr>& getImpostors() final;
+  std::vector<PhysicsImpostor*>& getImpostors() final;
 
   /**
    * @brief Gets the impostor for a physics enabled object.
@@ -173,7 +173,7 @@ protected:
 private:
   bool _initialized;
   IPhysicsEnginePlugin* _physicsPlugin;
-  std::vector<PhysicsImpostorPtr> _impostors;
+  std::vector<PhysicsImpostor*> _impostors;
   std::vector<PhysicsImpostorJointPtr> _joints;
   float _subTimeStep;
 
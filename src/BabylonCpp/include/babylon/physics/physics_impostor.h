@@ -13,7 +13,6 @@ namespace BABYLON {
 class AbstractMesh;
 class Bone;
 struct IPhysicsBody;
-struct IPhysicsEnabledObject;
 struct IPhysicsEngine;
 class Mesh;
 class PhysicsEngine;
@@ -21,8 +20,9 @@ class PhysicsImpostor;
 class PhysicsJoint;
 struct PhysicsJointData;
 class Scene;
-using IPhysicsEnginePtr  = std::shared_ptr<IPhysicsEngine>;
-using PhysicsImpostorPtr = std::shared_ptr<PhysicsImpostor>;
+using IPhysicsEnabledObject = AbstractMesh;
+using IPhysicsEnginePtr     = std::shared_ptr<IPhysicsEngine>;
+using PhysicsImpostorPtr    = std::shared_ptr<PhysicsImpostor>;
 
 struct Joint {
   std::shared_ptr<PhysicsJoint> joint;
@@ -0,0 +1,138 @@
+#ifndef BABYLON_PHYSICS_PLUGINS_NATIVE_PHYSICS_BODY_H
+#define BABYLON_PHYSICS_PLUGINS_NATIVE_PHYSICS_BODY_H
+
+#include <cstdint>
+
+#include <babylon/babylon_api.h>
+#include <babylon/maths/quaternion.h>
+#include <babylon/maths/vector3.h>
+#include <babylon/physics/iphysics_body.h>
+#include <babylon/physics/plugins/native_physics_shape.h>
+
+namespace BABYLON {
+
+class NativePhysicsBody;
+class NativePhysicsWorld;
+using NativePhysicsBodyPtr = std::unique_ptr<NativePhysicsBody>;
+
+/**
+ * @brief Rigid body of the native physics plugin.
+ *
+ * The position of the body is its center of mass and the origin of its shape. A body without
+ * mass (or using a triangle mesh shape) is static. The bodies are created and owned by a
+ * NativePhysicsWorld.
+ */
+class BABYLON_SHARED_EXPORT NativePhysicsBody : public IPhysicsBody {
+
+  friend class NativePhysicsWorld;
+
+public:
+  /**
+   * Body types of setupMass
+   */
+  static constexpr int DynamicBody = 1;
+  static constexpr int StaticBody  = 2;
+
+public:
+  NativePhysicsBody(const NativePhysicsShapePtr& shape, float mass);
+  virtual ~NativePhysicsBody(); // = default
+
+  void setPosition(const Vector3& newPosition) override;
+  void setOrientation(const Quaternion& newRotation) override;
+
+  /**
+   * @brief Sets the mass of the body from the density of its shape.
+   */
+  void setShapesDensity(float density) override;
+
+  /**
+   * @brief Recomputes the mass properties of the body, a static body type makes it static.
+   */
+  void setupMass(int type) override;
+
+  float mass() override;
+
+  /**
+   * @brief Sets the mass of the body, 0 making it static.
+   */
+  void setMass(float mass);
+
+  /**
+   * @brief Applies an impulse at a world position.
+   */
+  void applyImpulse(const Vector3& position, const Vector3& force) override;
+
+  /**
+   * @brief Applies a force at a world position during the next step.
+   */
+  void applyForce(const Vector3& position, const Vector3& force);
+
+  Vector3 angularVelocity() override;
+  void setAngularVelocity(const Vector3& velocity) override;
+  Vector3 linearVelocity() override;
+  void setLinearVelocity(const Vector3& velocity) override;
+  void sleep() override;
+  bool sleeping() override;
+  void awake() override;
+  void syncShapes() override;
+
+  [[nodiscard]] bool isStatic() const
+  {
+    return _inverseMass == 0.f;
+  }
+
+  [[nodiscard]] const NativePhysicsShapePtr& shape() const
+  {
+    return _shape;
+  }
+
+  [[nodiscard]] const Vector3& position() const
+  {
+    return _position;
+  }
+
+  [[nodiscard]] const Quaternion& orientation() const
+  {
+    return _orientation;
+  }
+
+  /**
+   * @brief Returns the world bounds of the shape at the start of the last step.
+   */
+  [[nodiscard]] const BVHBounds& bounds() const
+  {
+    return _bounds;
+  }
+
+public:
+  float friction;
+  float restitution;
+  float linearDamping;
+  float angularDamping;
+
+private:
+  void _updateMassProperties();
+
+private:
+  NativePhysicsShapePtr _shape;
+  float _mass;
+  float _inverseMass;
+  Vector3 _inverseInertia;
+  Vector3 _position;
+  Quaternion _orientation;
+  Vector3 _linearVelocity;
+  Vector3 _angularVelocity;
+  Vector3 _force;
+  Vector3 _torque;
+  bool _sleeping;
+  float _sleepTime;
+  BVHBounds _bounds;
+  // Set by the world: index in its bodies and identifier of the body in the contact cache
+  size_t _index;
+  uint32_t _uniqueId;
+
+}; // end of class NativePhysicsBody
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PHYSICS_PLUGINS_NATIVE_PHYSICS_BODY_H
@@ -0,0 +1,109 @@
+#ifndef BABYLON_PHYSICS_PLUGINS_NATIVE_PHYSICS_PLUGIN_H
+#define BABYLON_PHYSICS_PLUGINS_NATIVE_PHYSICS_PLUGIN_H
+
+#include <unordered_map>
+
+#include <babylon/babylon_api.h>
+#include <babylon/physics/iphysics_engine_plugin.h>
+#include <babylon/physics/plugins/native_physics_world.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Physics plugin running the simulation in a NativePhysicsWorld, without any external
+ * physics library.
+ *
+ * Supports the sphere, box, plane, capsule, cylinder, particle, convex hull, mesh and heightmap
+ * impostors (the mesh and heightmap impostors are static). Joints and soft bodies are not
+ * supported. The engine sub-steps the simulation (see PhysicsEngine::setSubTimeStep), each call of
+ * executeStep advancing the world by the given delta.
+ */
+class BABYLON_SHARED_EXPORT NativePhysicsPlugin : public IPhysicsEnginePlugin {
+
+public:
+  /**
+   * @brief Creates a new plugin.
+   * @param iterations defines the number of velocity iterations of the solver
+   * @param jobPool defines the pool used to spread the steps, the default pool if not set
+   */
+  NativePhysicsPlugin(size_t iterations = 10, JobPool* jobPool = nullptr);
+  ~NativePhysicsPlugin() override; // = default
+
+  /**
+   * @brief Returns the world running the simulation.
+   */
+  NativePhysicsWorld& physicsWorld()
+  {
+    return _world;
+  }
+
+  void setGravity(const Vector3& gravity) override;
+  void setTimeStep(float timeStep) override;
+  [[nodiscard]] float getTimeStep() const override;
+  void executeStep(float delta, const std::vector<PhysicsImpostor*>& impostors) override;
+  void applyImpulse(const PhysicsImpostor& impostor, const Vector3& force,
+                    const Vector3& contactPoint) override;
+  void applyForce(const PhysicsImpostor& impostor, const Vector3& force,
+                  const Vector3& contactPoint) override;
+  void generatePhysicsBody(const PhysicsImpostor& impostor) override;
+  void removePhysicsBody(const PhysicsImpostor& impostor) override;
+  void generateJoint(PhysicsImpostorJoint* joint) override;
+  void removeJoint(PhysicsImpostorJoint* joint) override;
+  bool isSupported() override;
+  void setTransformationFromPhysicsBody(const PhysicsImpostor& impostor) override;
+  void setPhysicsBodyTransformation(const PhysicsImpostor& impostor, const Vector3& newPosition,
+                                    const Quaternion& newRotation) override;
+  void setLinearVelocity(const PhysicsImpostor& impostor,
+                         const std::optional<Vector3>& velocity) override;
+  void setAngularVelocity(const PhysicsImpostor& impostor,
+                          const std::optional<Vector3>& velocity) override;
+  Vector3 getLinearVelocity(const PhysicsImpostor& impostor) override;
+  Vector3 getAngularVelocity(const PhysicsImpostor& impostor) override;
+  void setBodyMass(const PhysicsImpostor& impostor, float mass) override;
+  float getBodyMass(const PhysicsImpostor& impostor) override;
+  float getBodyFriction(const PhysicsImpostor& impostor) override;
+  void setBodyFriction(const PhysicsImpostor& impostor, float friction) override;
+  float getBodyRestitution(const PhysicsImpostor& impostor) override;
+  void setBodyRestitution(const PhysicsImpostor& impostor, float restitution) override;
+  float getBodyPressure(const PhysicsImpostor& impostor) override;
+  void setBodyPressure(const PhysicsImpostor& impostor, float pressure) override;
+  float getBodyStiffness(const PhysicsImpostor& impostor) override;
+  void setBodyStiffness(const PhysicsImpostor& impostor, float stiffness) override;
+  size_t getBodyVelocityIterations(const PhysicsImpostor& impostor) override;
+  void setBodyVelocityIterations(const PhysicsImpostor& impostor,
+                                 size_t velocityIterations) override;
+  size_t getBodyPositionIterations(const PhysicsImpostor& impostor) override;
+  void setBodyPositionIterations(const PhysicsImpostor& impostor,
+                                 size_t positionIterations) override;
+  void appendAnchor(const PhysicsImpostor& impostor, const PhysicsImpostorPtr& otherImpostor,
+                    int width, int height, float influence,
+                    bool noCollisionBetweenLinkedBodies) override;
+  void appendHook(const PhysicsImpostor& impostor, const PhysicsImpostorPtr& otherImpostor,
+                  float length, float influence, bool noCollisionBetweenLinkedBodies) override;
+  void sleepBody(const PhysicsImpostor& impostor) override;
+  void wakeUpBody(const PhysicsImpostor& impostor) override;
+  PhysicsRaycastResult raycast(const Vector3& from, const Vector3& to) override;
+  void updateDistanceJoint(DistanceJoint* joint, float maxDistance, float minDistance) override;
+  void setMotor(IMotorEnabledJoint* joint, float speed, float maxForce,
+                unsigned int motorIndex = 0) override;
+  void setLimit(IMotorEnabledJoint* joint, float upperLimit, float lowerLimit,
+                unsigned int motorIndex = 0) override;
+  float getRadius(const PhysicsImpostor& impostor) override;
+  void getBoxSizeToRef(const PhysicsImpostor& impostor, Vector3& result) override;
+  void syncMeshWithImpostor(AbstractMesh* mesh, const PhysicsImpostor& impostor) override;
+  void dispose() override;
+
+private:
+  NativePhysicsBody* _getBody(const PhysicsImpostor& impostor) const;
+  NativePhysicsShapePtr _createShape(PhysicsImpostor& impostor) const;
+
+private:
+  NativePhysicsWorld _world;
+  float _timeStep;
+  std::unordered_map<const PhysicsImpostor*, NativePhysicsBody*> _bodies;
+
+}; // end of class NativePhysicsPlugin
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PHYSICS_PLUGINS_NATIVE_PHYSICS_PLUGIN_H
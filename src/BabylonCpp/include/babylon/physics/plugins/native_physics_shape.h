@@ -0,0 +1,206 @@
+#ifndef BABYLON_PHYSICS_PLUGINS_NATIVE_PHYSICS_SHAPE_H
+#define BABYLON_PHYSICS_PLUGINS_NATIVE_PHYSICS_SHAPE_H
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/culling/bvh/bvh.h>
+#include <babylon/maths/vector3.h>
+
+namespace BABYLON {
+
+class NativePhysicsShape;
+class TriangleBVH;
+using NativePhysicsShapePtr = std::shared_ptr<NativePhysicsShape>;
+
+/**
+ * @brief Collision shape of a body of the native physics plugin, in the local space of the body.
+ *
+ * Boxes and convex hulls are stored as polyhedra (vertices, faces and edges) which are collided
+ * with the separating axis test, capsules are aligned with the local y axis and triangle meshes
+ * can only be used by static bodies. The shapes are immutable and can be shared by several
+ * bodies.
+ */
+class BABYLON_SHARED_EXPORT NativePhysicsShape {
+
+public:
+  enum class Type {
+    Sphere,
+    Capsule,
+    Box,
+    ConvexHull,
+    Mesh,
+  }; // end of enum class Type
+
+  using Point = std::array<float, 3>;
+
+  /**
+   * Face of a polyhedron: its outward plane and its vertices, counter clockwise around the
+   * normal, stored in faceVertices() from firstVertex
+   */
+  struct Face {
+    Point normal;
+    float distance;
+    uint32_t firstVertex;
+    uint32_t vertexCount;
+  }; // end of struct Face
+
+  /**
+   * Edge of a polyhedron and the two faces sharing it
+   */
+  struct Edge {
+    uint32_t vertex0;
+    uint32_t vertex1;
+    uint32_t face0;
+    uint32_t face1;
+  }; // end of struct Edge
+
+  /**
+   * Convex hulls with more points are simplified to this number of vertices
+   */
+  static constexpr size_t MaxConvexHullVertices = 64;
+
+public:
+  static NativePhysicsShapePtr CreateSphere(float radius);
+
+  /**
+   * @brief Creates a box centered on the origin of the body.
+   * @param halfExtents defines the half sizes of the box along the local axes
+   */
+  static NativePhysicsShapePtr CreateBox(const Vector3& halfExtents);
+
+  /**
+   * @brief Creates a capsule centered on the origin of the body and aligned with its y axis.
+   * @param radius defines the radius of the capsule
+   * @param halfHeight defines the half length of the segment between the centers of the caps
+   */
+  static NativePhysicsShapePtr CreateCapsule(float radius, float halfHeight);
+
+  /**
+   * @brief Creates the convex hull of a set of points, a box of their bounds is created when
+   * they are all aligned.
+   */
+  static NativePhysicsShapePtr CreateConvexHull(const std::vector<Vector3>& points);
+
+  /**
+   * @brief Creates a triangle mesh, its triangles are collided through a triangle BVH.
+   */
+  static NativePhysicsShapePtr CreateMesh(const std::vector<Vector3>& positions,
+                                          const IndicesArray& indices);
+
+  ~NativePhysicsShape(); // = default
+
+  [[nodiscard]] Type type() const
+  {
+    return _type;
+  }
+
+  [[nodiscard]] bool isPolyhedron() const
+  {
+    return _type == Type::Box || _type == Type::ConvexHull;
+  }
+
+  /**
+   * @brief Returns the radius of a sphere or a capsule.
+   */
+  [[nodiscard]] float radius() const
+  {
+    return _radius;
+  }
+
+  /**
+   * @brief Returns the half length of the segment of a capsule.
+   */
+  [[nodiscard]] float halfHeight() const
+  {
+    return _halfHeight;
+  }
+
+  /**
+   * @brief Returns the half sizes of a box, or of the local bounds of the other shapes.
+   */
+  [[nodiscard]] const Point& halfExtents() const
+  {
+    return _halfExtents;
+  }
+
+  [[nodiscard]] const BVHBounds& localBounds() const
+  {
+    return _localBounds;
+  }
+
+  [[nodiscard]] const std::vector<Point>& vertices() const
+  {
+    return _vertices;
+  }
+
+  [[nodiscard]] const std::vector<Face>& faces() const
+  {
+    return _faces;
+  }
+
+  [[nodiscard]] const std::vector<uint32_t>& faceVertices() const
+  {
+    return _faceVertices;
+  }
+
+  [[nodiscard]] const std::vector<Edge>& edges() const
+  {
+    return _edges;
+  }
+
+  /**
+   * @brief Returns the points of a triangle mesh.
+   */
+  [[nodiscard]] const std::vector<Vector3>& meshPositions() const
+  {
+    return _meshPositions;
+  }
+
+  /**
+   * @brief Returns the triangle BVH of a triangle mesh.
+   */
+  [[nodiscard]] const TriangleBVH* triangleBVH() const
+  {
+    return _triangleBVH.get();
+  }
+
+  /**
+   * @brief Returns the volume of the shape (the one of its bounds for a convex hull).
+   */
+  [[nodiscard]] float volume() const;
+
+  /**
+   * @brief Returns the diagonal of the inertia tensor of the shape for a unit mass, around the
+   * origin of the body (the one of its bounds for a convex hull).
+   */
+  [[nodiscard]] Vector3 unitInertia() const;
+
+private:
+  explicit NativePhysicsShape(Type type);
+
+  void _buildPolyhedron(const std::vector<Vector3>& points);
+  void _computeLocalBounds();
+
+private:
+  Type _type;
+  float _radius;
+  float _halfHeight;
+  Point _halfExtents;
+  BVHBounds _localBounds;
+  std::vector<Point> _vertices;
+  std::vector<Face> _faces;
+  std::vector<uint32_t> _faceVertices;
+  std::vector<Edge> _edges;
+  std::vector<Vector3> _meshPositions;
+  std::unique_ptr<TriangleBVH> _triangleBVH;
+
+}; // end of class NativePhysicsShape
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PHYSICS_PLUGINS_NATIVE_PHYSICS_SHAPE_H
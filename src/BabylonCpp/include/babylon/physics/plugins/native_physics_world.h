@@ -0,0 +1,178 @@
+#ifndef BABYLON_PHYSICS_PLUGINS_NATIVE_PHYSICS_WORLD_H
+#define BABYLON_PHYSICS_PLUGINS_NATIVE_PHYSICS_WORLD_H
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/physics/plugins/native_physics_body.h>
+
+namespace BABYLON {
+
+class JobPool;
+
+/**
+ * @brief Closest hit of a ray cast in a NativePhysicsWorld.
+ */
+struct BABYLON_SHARED_EXPORT NativePhysicsRaycastHit {
+  NativePhysicsBody* body;
+  Vector3 point;
+  Vector3 normal;
+  float distance;
+}; // end of struct NativePhysicsRaycastHit
+
+/**
+ * @brief Rigid body world of the native physics plugin.
+ *
+ * A step finds the pairs of overlapping bodies with a sweep and prune of their world bounds,
+ * computes their contacts (separating axis test and clipping for the polyhedra), groups the awake
+ * bodies in islands of touching bodies and solves each island with a sequential impulse solver,
+ * warm started with the impulses of the previous step. The narrowphase and the islands are spread
+ * over a JobPool. An island whose bodies stay still long enough falls asleep until an awake body
+ * touches it or one of its bodies is moved.
+ */
+class BABYLON_SHARED_EXPORT NativePhysicsWorld {
+
+public:
+  /**
+   * Maximum number of contact points between two bodies
+   */
+  static constexpr size_t MaxManifoldPoints = 4;
+
+  /**
+   * Distance below which the contacts are created, letting the solver stop the bodies before they
+   * touch
+   */
+  static constexpr float ContactMargin = 0.02f;
+
+  /**
+   * Allowed penetration of the bodies, and fraction of the remaining penetration fixed at each
+   * step
+   */
+  static constexpr float LinearSlop          = 0.005f;
+  static constexpr float PenetrationRecovery = 0.2f;
+
+  /**
+   * Relative normal velocity below which the contacts do not bounce
+   */
+  static constexpr float RestitutionThreshold = 1.f;
+
+  /**
+   * An island falls asleep once all its bodies moved slower than these velocities for
+   * TimeToSleep seconds
+   */
+  static constexpr float SleepLinearVelocity  = 0.05f;
+  static constexpr float SleepAngularVelocity = 0.05f;
+  static constexpr float TimeToSleep          = 0.5f;
+
+public:
+  /**
+   * @brief Creates a new world.
+   * @param jobPool defines the pool used to spread the steps, the default pool if not set
+   */
+  explicit NativePhysicsWorld(JobPool* jobPool = nullptr);
+  NativePhysicsWorld(const NativePhysicsWorld& other) = delete;
+  NativePhysicsWorld& operator=(const NativePhysicsWorld& other) = delete;
+  ~NativePhysicsWorld(); // = default
+
+  /**
+   * @brief Creates a body owned by the world.
+   * @param shape defines the shape of the body
+   * @param mass defines the mass of the body, 0 for a static body
+   * @param position defines the initial position of the body
+   * @param orientation defines the initial orientation of the body
+   * @returns the body, valid until it is removed or the world is cleared
+   */
+  NativePhysicsBody* createBody(const NativePhysicsShapePtr& shape, float mass,
+                                const Vector3& position       = Vector3::Zero(),
+                                const Quaternion& orientation = Quaternion::Identity());
+
+  /**
+   * @brief Removes and destroys a body of the world.
+   */
+  void removeBody(NativePhysicsBody* body);
+
+  /**
+   * @brief Removes and destroys all the bodies.
+   */
+  void clear();
+
+  [[nodiscard]] const std::vector<NativePhysicsBodyPtr>& bodies() const
+  {
+    return _bodies;
+  }
+
+  /**
+   * @brief Advances the world by the given time.
+   * @param delta defines the time step, in seconds
+   */
+  void step(float delta);
+
+  /**
+   * @brief Finds the closest body hit by a segment.
+   * @param from defines the start of the segment
+   * @param to defines the end of the segment
+   * @returns the closest hit if any
+   */
+  [[nodiscard]] std::optional<NativePhysicsRaycastHit> raycast(const Vector3& from,
+                                                               const Vector3& to) const;
+
+  /**
+   * @brief Returns the number of touching pairs of bodies found by the last step.
+   */
+  [[nodiscard]] size_t contactCount() const;
+
+  /**
+   * @brief Returns the number of islands solved by the last step.
+   */
+  [[nodiscard]] size_t islandCount() const;
+
+  /**
+   * @brief Returns the number of dynamic bodies which are not sleeping.
+   */
+  [[nodiscard]] size_t awakeBodyCount() const;
+
+public:
+  Vector3 gravity;
+  size_t velocityIterations;
+  bool sleepingEnabled;
+
+private:
+  struct ContactPoint;
+  struct ContactManifold;
+  struct Island;
+  struct SolverBody;
+
+  void _prepareBodies(float delta);
+  static void _setSolverBodyMass(const NativePhysicsBody& body, SolverBody& solverBody);
+  void _findPairs();
+  void _collide();
+  void _buildIslands();
+  void _solveIsland(const Island& island, float delta);
+
+private:
+  JobPool* _jobPool;
+  std::vector<NativePhysicsBodyPtr> _bodies;
+  uint32_t _nextUniqueId;
+  // Sweep and prune: bodies sorted along the axis of the largest spread of their bounds, kept
+  // from a step to the next one to be nearly sorted
+  unsigned int _sweepAxis;
+  std::vector<uint32_t> _sweepOrder;
+  std::vector<std::pair<uint32_t, uint32_t>> _pairs;
+  // Contacts of the touching pairs sorted by key, the ones of the previous step warm starting the
+  // solver
+  std::vector<ContactManifold> _manifolds;
+  std::vector<ContactManifold> _previousManifolds;
+  // Islands, as ranges of the body and contact indices below
+  std::vector<SolverBody> _solverBodies;
+  std::vector<uint32_t> _islandParents;
+  std::vector<Island> _islands;
+  std::vector<uint32_t> _islandBodies;
+  std::vector<uint32_t> _islandManifolds;
+
+}; // end of class NativePhysicsWorld
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PHYSICS_PLUGINS_NATIVE_PHYSICS_WORLD_H
@@ -0,0 +1,120 @@
+#ifndef BABYLON_RENDERING_RENDER_QUEUE_H
+#define BABYLON_RENDERING_RENDER_QUEUE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+class SubMesh;
+
+/**
+ * @brief Queue of submeshes ordered by a 64-bit sort key.
+ *
+ * The key of an opaque (or alpha tested) submesh packs, from the most to the least significant
+ * bits: the layer (8 bits), the effect id (16 bits), the material id (16 bits), the geometry id
+ * (12 bits) and the quantized depth (12 bits). Sorting the keys groups the submeshes sharing the
+ * same effect, material and vertex buffers, and renders each group front to back.
+ * The key of a transparent submesh packs the layer (8 bits), the inverted quantized depth (24 bits,
+ * back to front), the effect id (16 bits) and the material id (16 bits).
+ *
+ * The ids are truncated to their field: two ids colliding only make the grouping less effective.
+ * The keys are sorted with a stable least significant digit radix sort, and the buffers are kept
+ * between frames.
+ */
+class BABYLON_SHARED_EXPORT RenderQueue {
+
+public:
+  /**
+   * Masks of the state fields of the opaque sort key
+   */
+  static constexpr uint64_t EffectMask   = 0x00FFFF0000000000ull;
+  static constexpr uint64_t MaterialMask = 0x000000FFFF000000ull;
+  static constexpr uint64_t GeometryMask = 0x0000000000FFF000ull;
+
+public:
+  RenderQueue();
+  ~RenderQueue(); // = default
+
+  /**
+   * @brief Builds the sort key of an opaque or alpha tested submesh.
+   * @param layer defines the layer, lower layers are rendered first
+   * @param effectId defines the id of the effect of the submesh
+   * @param materialId defines the id of the material of the submesh
+   * @param geometryId defines the id of the geometry of the submesh
+   * @param depth defines the distance to the camera, normalized between 0 and 1
+   * @returns the sort key
+   */
+  static uint64_t OpaqueSortKey(uint8_t layer, size_t effectId, size_t materialId,
+                                size_t geometryId, float depth);
+
+  /**
+   * @brief Builds the sort key of a transparent submesh (back to front in each layer).
+   * @param layer defines the layer, lower layers are rendered first
+   * @param depth defines the distance to the camera, normalized between 0 and 1
+   * @param effectId defines the id of the effect of the submesh
+   * @param materialId defines the id of the material of the submesh
+   * @returns the sort key
+   */
+  static uint64_t TransparentSortKey(uint8_t layer, float depth, size_t effectId,
+                                     size_t materialId);
+
+  /**
+   * @brief Counts the changes of effect, material and geometry between consecutive opaque keys.
+   * @param keys defines the opaque sort keys, in rendering order
+   * @param count defines the number of keys
+   * @returns the number of state changes
+   */
+  static size_t CountStateChanges(const uint64_t* keys, size_t count);
+
+  /**
+   * @brief Removes the submeshes of the queue, keeping the allocated buffers.
+   */
+  void clear();
+
+  /**
+   * @brief Adds a submesh to the queue.
+   * @param key defines the sort key of the submesh
+   * @param subMesh defines the submesh
+   */
+  void add(uint64_t key, SubMesh* subMesh);
+
+  /**
+   * @brief Sorts the submeshes by increasing key. Submeshes with the same key keep their order.
+   */
+  void sort();
+
+  /**
+   * @brief Gets the number of submeshes in the queue.
+   */
+  [[nodiscard]] size_t size() const;
+
+  /**
+   * @brief Gets the sort keys, in insertion order before sort() and in rendering order after.
+   */
+  [[nodiscard]] const std::vector<uint64_t>& keys() const;
+
+  /**
+   * @brief Gets the submeshes, in insertion order before sort() and in rendering order after.
+   */
+  [[nodiscard]] const std::vector<SubMesh*>& subMeshes() const;
+
+private:
+  struct Entry {
+    uint64_t key;
+    SubMesh* subMesh;
+  }; // end of struct Entry
+
+  std::vector<Entry> _entries;
+  std::vector<Entry> _sortBuffer;
+  std::vector<uint64_t> _keys;
+  std::vector<SubMesh*> _subMeshes;
+
+}; // end of class RenderQueue
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_RENDERING_RENDER_QUEUE_H
@@ -7,6 +7,7 @@
 #include <babylon/babylon_api.h>
 #include <babylon/babylon_common.h>
 #include <babylon/maths/vector3.h>
+#include <babylon/rendering/render_queue.h>
 
 namespace BABYLON {
 
@@ -172,6 +173,18 @@ private:
    */
   static void renderUnsorted(const std::vector<SubMesh*>& subMeshes);
 
+  /**
+   * @brief Renders the submeshes in the order of their sort keys (see
+   * RenderQueue), when Scene::sortKeyRenderQueueEnabled is set.
+   * @param subMeshes The submeshes to sort before render
+   * @param queue The queue used to sort the submeshes
+   * @param transparent Specifies to activate blending if true
+   */
+  void _renderQueued(const std::vector<SubMesh*>& subMeshes, RenderQueue& queue,
+                     bool transparent);
+
+  static void _renderSubMesh(SubMesh* subMesh, bool transparent);
+
 protected:
   /**
    * @brief Set the opaque sort comparison function.
@@ -245,6 +258,12 @@ private:
   std::function<void(const std::vector<SubMesh*>& subMeshes)> _renderAlphaTest;
   std::function<void(const std::vector<SubMesh*>& subMeshes)>
     _renderTransparent;
+  bool _defaultTransparentSort;
+
+  // Sort key queues, kept between frames
+  RenderQueue _opaqueQueue;
+  RenderQueue _alphaTestQueue;
+  RenderQueue _transparentQueue;
 
 }; // end of class RenderingGroup
 
@@ -13,6 +13,9 @@ const char* instances300Declaration
     in vec4 world1;
     in vec4 world2;
     in vec4 world3;
+    #ifdef THIN_INSTANCES
+        uniform mat4 world;
+    #endif
 #else
     uniform mat4 world;
 #endif
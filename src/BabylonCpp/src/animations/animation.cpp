@@ -2,6 +2,7 @@
 
 #include <babylon/animations/_ianimation_state.h>
 #include <babylon/animations/animatable.h>
+#include <babylon/animations/animation_track.h>
 #include <babylon/animations/easing/ieasing_function.h>
 #include <babylon/animations/ianimation_key.h>
 #include <babylon/animations/runtime_animation.h>
@@ -167,6 +168,9 @@ Animation::Animation(const std::string& iName, const std::string& iTargetPropert
     , blendingSpeed{0.01f}
     , hasRunningRuntimeAnimations{this, &Animation::get_hasRunningRuntimeAnimations}
     , _easingFunction{nullptr}
+    , _track{nullptr}
+    , _trackIsDirty{true}
+    , _bakedSamplesPerFrame{0.f}
 {
   framePerSecond = iFramePerSecond;
   dataType       = iDataType;
@@ -238,6 +242,7 @@ void Animation::deleteRange(const std::string& iName, bool deleteFrames)
       stl_util::erase_remove_if(_keys, [from, to](const IAnimationKey& key) {
         return key.frame >= from && key.frame <= to;
       });
+      _trackIsDirty = true;
     }
     _ranges.erase(iName);
   }
@@ -250,9 +255,35 @@ AnimationRange& Animation::getRange(const std::string& iName)
 
 std::vector<IAnimationKey>& Animation::getKeys()
 {
+  // The keys may be modified
+  _trackIsDirty = true;
   return _keys;
 }
 
+const std::vector<IAnimationKey>& Animation::getKeys() const
+{
+  return _keys;
+}
+
+void Animation::bake(float samplesPerFrame)
+{
+  _bakedSamplesPerFrame = samplesPerFrame;
+  _trackIsDirty         = true;
+}
+
+AnimationTrackPtr& Animation::_getTrack()
+{
+  if (_trackIsDirty) {
+    _track = AnimationTrack::New(static_cast<unsigned int>(dataType), _keys);
+    if (_track && _bakedSamplesPerFrame > 0.f) {
+      _track->bake(_bakedSamplesPerFrame, _easingFunction.get());
+    }
+    _trackIsDirty = false;
+  }
+
+  return _track;
+}
+
 float Animation::getHighestFrame() const
 {
   float ret = 0;
@@ -272,6 +303,10 @@ IEasingFunctionPtr& Animation::getEasingFunction()
 void Animation::setEasingFunction(const IEasingFunctionPtr& easingFunction)
 {
   _easingFunction = easingFunction;
+  // The baked samples are eased
+  if (_bakedSamplesPerFrame > 0.f) {
+    _trackIsDirty = true;
+  }
 }
 
 float Animation::floatInterpolateFunction(float startValue, float endValue, float gradient) const
@@ -366,39 +401,25 @@ AnimationValue Animation::_interpolate(float currentFrame, _IAnimationState& sta
     return _getKeyValue(keys[0].value);
   }
 
-#if 1
-  // Try to get a hash to find the right key
-  int _keysLength = static_cast<int>(keys.size());
-  int startKeyIndex
-    = std::max(0, std::min(_keysLength - 1,
-                           static_cast<int>(std::floor(_keysLength * (currentFrame - keys[0].frame)
-                                                       / (keys.back().frame - keys[0].frame))
-                                            - 1)));
-#else
-  auto startKeyIndex = state.key;
-#endif
-
-  if (keys[static_cast<unsigned int>(startKeyIndex)].frame >= currentFrame) {
-    while (startKeyIndex - 1 >= 0
-           && keys[static_cast<unsigned int>(startKeyIndex)].frame >= currentFrame) {
-      --startKeyIndex;
-    }
+  // Start from the key of the previous frame
+  auto startKeyIndex = std::clamp(state.key, 0, static_cast<int>(keys.size()) - 2);
+  while (startKeyIndex > 0
+         && keys[static_cast<unsigned int>(startKeyIndex)].frame >= currentFrame) {
+    --startKeyIndex;
   }
 
-  for (auto key = static_cast<size_t>(startKeyIndex); key < keys.size(); ++key) {
+  for (auto key = static_cast<size_t>(startKeyIndex); key + 1 < keys.size(); ++key) {
     const auto& endKey = keys[key + 1];
 
     if (endKey.frame >= currentFrame) {
 
-      state.key            = static_cast<int>(key);
-      const auto& startKey = keys[key];
-      auto startValue      = _getKeyValue(startKey.value);
-      if ((*startKey.interpolation).animationType().has_value()
-          && (*startKey.interpolation).animationType().value()
-               == static_cast<unsigned>(AnimationKeyInterpolation::STEP)) {
+      state.key              = static_cast<int>(key);
+      const auto& startKey   = keys[key];
+      const auto& startValue = startKey.value;
+      if (AnimationTrack::IsStepKey(startKey)) {
         return startValue;
       }
-      auto endValue = _getKeyValue(endKey.value);
+      const auto& endValue = endKey.value;
 
       bool useTangent  = startKey.outTangent && endKey.inTangent;
       float frameDelta = endKey.frame - startKey.frame;
@@ -407,12 +428,11 @@ AnimationValue Animation::_interpolate(float currentFrame, _IAnimationState& sta
       float gradient = (currentFrame - startKey.frame) / frameDelta;
 
       // check for easingFunction and correction of gradient
-      auto easingFunction = getEasingFunction();
-      if (easingFunction != nullptr) {
-        gradient = easingFunction->ease(gradient);
+      if (_easingFunction != nullptr) {
+        gradient = _easingFunction->ease(gradient);
       }
 
-      auto newVale = keys[key].value.copy();
+      AnimationValue newVale;
 
       switch (dataType) {
         // Float
@@ -561,21 +581,16 @@ AnimationValue Animation::_interpolate(float currentFrame, _IAnimationState& sta
           switch (state.loopMode.value()) {
             case Animation::ANIMATIONLOOPMODE_CYCLE:
             case Animation::ANIMATIONLOOPMODE_CONSTANT:
-              if (Animation::AllowMatricesInterpolation()) {
-                if (state.workValue) {
-                  auto& _workValue = *state.workValue;
-                  newVale
-                    = matrixInterpolateFunction(startValue.get<Matrix>(), endValue.get<Matrix>(),
-                                                gradient, _workValue.get<Matrix>());
-                  state.workValue = _workValue;
-                }
-                return newVale;
+              if (Animation::AllowMatricesInterpolation() && state.workValue) {
+                auto startMatrix = startValue.get<Matrix>();
+                auto endMatrix   = endValue.get<Matrix>();
+                auto& workMatrix = state.workValue->get<Matrix>();
+                matrixInterpolateFunction(startMatrix, endMatrix, gradient, workMatrix);
+                return workMatrix;
               }
-              newVale = startValue.get<Matrix>();
-              return newVale;
+              return startValue;
             case Animation::ANIMATIONLOOPMODE_RELATIVE:
-              newVale = startValue.get<Matrix>();
-              return newVale;
+              return startValue;
             default:
               break;
           }
@@ -615,8 +630,9 @@ AnimationPtr Animation::clone() const
   auto clonedAnimation = Animation::New(name, StringTools::join(targetPropertyPath, '.'),
                                         framePerSecond, dataType, loopMode);
 
-  clonedAnimation->enableBlending = enableBlending;
-  clonedAnimation->blendingSpeed  = blendingSpeed;
+  clonedAnimation->enableBlending        = enableBlending;
+  clonedAnimation->blendingSpeed         = blendingSpeed;
+  clonedAnimation->_bakedSamplesPerFrame = _bakedSamplesPerFrame;
 
   if (!_keys.empty()) {
     clonedAnimation->setKeys(_keys);
@@ -633,7 +649,8 @@ AnimationPtr Animation::clone() const
 
 void Animation::setKeys(const std::vector<IAnimationKey>& values)
 {
-  _keys = values;
+  _keys         = values;
+  _trackIsDirty = true;
 }
 
 json Animation::serialize() const
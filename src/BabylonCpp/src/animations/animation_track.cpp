@@ -0,0 +1,345 @@
+#include <babylon/animations/animation_track.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <babylon/animations/animation.h>
+#include <babylon/animations/easing/ieasing_function.h>
+#include <babylon/animations/ianimation_key.h>
+#include <babylon/babylon_enums.h>
+#include <babylon/maths/scalar.h>
+
+namespace BABYLON {
+
+namespace {
+
+// Key flags
+constexpr uint8_t StepKey       = 1;
+constexpr uint8_t HasInTangent  = 2;
+constexpr uint8_t HasOutTangent = 4;
+
+void StoreValue(const AnimationValue& value, unsigned int dataType, float* result)
+{
+  switch (dataType) {
+    case Animation::ANIMATIONTYPE_FLOAT:
+      result[0] = value.get<float>();
+      break;
+    case Animation::ANIMATIONTYPE_VECTOR2: {
+      const auto& vector = value.get<Vector2>();
+      result[0]          = vector.x;
+      result[1]          = vector.y;
+    } break;
+    case Animation::ANIMATIONTYPE_VECTOR3: {
+      const auto& vector = value.get<Vector3>();
+      result[0]          = vector.x;
+      result[1]          = vector.y;
+      result[2]          = vector.z;
+    } break;
+    case Animation::ANIMATIONTYPE_QUATERNION: {
+      const auto& quaternion = value.get<Quaternion>();
+      result[0]              = quaternion.x;
+      result[1]              = quaternion.y;
+      result[2]              = quaternion.z;
+      result[3]              = quaternion.w;
+    } break;
+    case Animation::ANIMATIONTYPE_COLOR3: {
+      const auto& color = value.get<Color3>();
+      result[0]         = color.r;
+      result[1]         = color.g;
+      result[2]         = color.b;
+    } break;
+    case Animation::ANIMATIONTYPE_COLOR4: {
+      const auto& color = value.get<Color4>();
+      result[0]         = color.r;
+      result[1]         = color.g;
+      result[2]         = color.b;
+      result[3]         = color.a;
+    } break;
+    case Animation::ANIMATIONTYPE_MATRIX: {
+      const auto& m = value.get<Matrix>().m();
+      std::copy(m.begin(), m.end(), result);
+    } break;
+    default:
+      break;
+  }
+}
+
+void LoadMatrix(const float* m, Matrix& result)
+{
+  Matrix::FromValuesToRef(m[0], m[1], m[2], m[3], m[4], m[5], m[6], m[7], m[8], m[9], m[10],
+                          m[11], m[12], m[13], m[14], m[15], result);
+}
+
+} // end of anonymous namespace
+
+bool AnimationTrack::IsStepKey(const IAnimationKey& key)
+{
+  return key.interpolation && key.interpolation->animationType() == Animation::ANIMATIONTYPE_INT
+         && key.interpolation->get<int>() == static_cast<int>(AnimationKeyInterpolation::STEP);
+}
+
+size_t AnimationTrack::ComponentCount(unsigned int dataType)
+{
+  switch (dataType) {
+    case Animation::ANIMATIONTYPE_FLOAT:
+      return 1;
+    case Animation::ANIMATIONTYPE_VECTOR2:
+      return 2;
+    case Animation::ANIMATIONTYPE_VECTOR3:
+    case Animation::ANIMATIONTYPE_COLOR3:
+      return 3;
+    case Animation::ANIMATIONTYPE_QUATERNION:
+    case Animation::ANIMATIONTYPE_COLOR4:
+      return 4;
+    case Animation::ANIMATIONTYPE_MATRIX:
+      return 16;
+    default:
+      return 0;
+  }
+}
+
+AnimationTrackPtr AnimationTrack::New(unsigned int dataType,
+                                      const std::vector<IAnimationKey>& keys)
+{
+  const auto componentCount = ComponentCount(dataType);
+  if (componentCount == 0 || keys.empty()) {
+    return nullptr;
+  }
+
+  const auto hasType = [dataType](const std::optional<AnimationValue>& value) {
+    return value && value->animationType() == dataType;
+  };
+
+  auto track = std::shared_ptr<AnimationTrack>(new AnimationTrack(dataType, componentCount));
+  track->_frames.reserve(keys.size());
+  track->_values.resize(keys.size() * componentCount);
+  track->_keyFlags.resize(keys.size());
+  for (size_t key = 0; key < keys.size(); ++key) {
+    const auto& animationKey = keys[key];
+    if (animationKey.value.animationType() != dataType) {
+      return nullptr;
+    }
+    track->_frames.emplace_back(animationKey.frame);
+    StoreValue(animationKey.value, dataType, &track->_values[key * componentCount]);
+
+    auto& flags = track->_keyFlags[key];
+    flags       = IsStepKey(animationKey) ? StepKey : 0;
+    // The tangents are only stored if a key has some
+    if (hasType(animationKey.inTangent)) {
+      track->_inTangents.resize(keys.size() * componentCount);
+      StoreValue(*animationKey.inTangent, dataType, &track->_inTangents[key * componentCount]);
+      flags |= HasInTangent;
+    }
+    if (hasType(animationKey.outTangent)) {
+      track->_outTangents.resize(keys.size() * componentCount);
+      StoreValue(*animationKey.outTangent, dataType, &track->_outTangents[key * componentCount]);
+      flags |= HasOutTangent;
+    }
+  }
+
+  return track;
+}
+
+AnimationTrack::AnimationTrack(unsigned int iDataType, size_t iComponentCount)
+    : _dataType{iDataType}, _componentCount{iComponentCount}, _bakedSamplesPerFrame{0.f}
+{
+}
+
+AnimationTrack::~AnimationTrack() = default;
+
+void AnimationTrack::bake(float samplesPerFrame, IEasingFunction* easingFunction)
+{
+  _bakedValues.clear();
+  if (samplesPerFrame <= 0.f || _frames.size() < 2) {
+    return;
+  }
+
+  const auto firstFrame = _frames.front();
+  const auto lastFrame  = _frames.back();
+  const auto nbSamples
+    = std::max(static_cast<size_t>(std::ceil((lastFrame - firstFrame) * samplesPerFrame)) + 1,
+               static_cast<size_t>(2));
+  Float32Array bakedValues(nbSamples * _componentCount);
+  int cursor = 0;
+  for (size_t i = 0; i < nbSamples; ++i) {
+    const auto frame = std::min(firstFrame + static_cast<float>(i) / samplesPerFrame, lastFrame);
+    sample(frame, cursor, easingFunction, &bakedValues[i * _componentCount]);
+  }
+
+  _bakedSamplesPerFrame = samplesPerFrame;
+  _bakedValues          = std::move(bakedValues);
+}
+
+void AnimationTrack::sample(float frame, int& cursor, IEasingFunction* easingFunction,
+                            float* result) const
+{
+  if (!_bakedValues.empty()) {
+    _sampleBaked(frame, result);
+    return;
+  }
+
+  const auto nbKeys = _frames.size();
+  if (nbKeys == 1) {
+    std::copy_n(_values.data(), _componentCount, result);
+    return;
+  }
+
+  // Start from the key of the previous sample, the frames mostly moving forward between samples
+  auto key = static_cast<size_t>(std::clamp(cursor, 0, static_cast<int>(nbKeys) - 2));
+  while (key > 0 && _frames[key] >= frame) {
+    --key;
+  }
+  for (; key + 1 < nbKeys; ++key) {
+    if (_frames[key + 1] >= frame) {
+      cursor = static_cast<int>(key);
+      if (_keyFlags[key] & StepKey) {
+        std::copy_n(&_values[key * _componentCount], _componentCount, result);
+        return;
+      }
+      // Percent of the frame between the start and the end keys
+      auto gradient = (frame - _frames[key]) / (_frames[key + 1] - _frames[key]);
+      if (easingFunction) {
+        gradient = easingFunction->ease(gradient);
+      }
+      _interpolateKeys(key, gradient, result);
+      return;
+    }
+  }
+
+  cursor = static_cast<int>(nbKeys) - 2;
+  std::copy_n(&_values[(nbKeys - 1) * _componentCount], _componentCount, result);
+}
+
+void AnimationTrack::_interpolateKeys(size_t key, float gradient, float* result) const
+{
+  const auto n      = _componentCount;
+  const auto* start = &_values[key * n];
+  const auto* end   = start + n;
+
+  const auto useTangents
+    = (_keyFlags[key] & HasOutTangent) && (_keyFlags[key + 1] & HasInTangent);
+  switch (_dataType) {
+    case Animation::ANIMATIONTYPE_FLOAT:
+    case Animation::ANIMATIONTYPE_VECTOR2:
+    case Animation::ANIMATIONTYPE_VECTOR3:
+    case Animation::ANIMATIONTYPE_QUATERNION:
+      if (useTangents) {
+        const auto frameDelta = _frames[key + 1] - _frames[key];
+        const auto* out       = &_outTangents[key * n];
+        const auto* in        = &_inTangents[(key + 1) * n];
+        for (size_t i = 0; i < n; ++i) {
+          result[i] = Scalar::Hermite(start[i], out[i] * frameDelta, end[i], in[i] * frameDelta,
+                                      gradient);
+        }
+        if (_dataType == Animation::ANIMATIONTYPE_QUATERNION) {
+          Quaternion quaternion(result[0], result[1], result[2], result[3]);
+          quaternion.normalize();
+          result[0] = quaternion.x;
+          result[1] = quaternion.y;
+          result[2] = quaternion.z;
+          result[3] = quaternion.w;
+        }
+        return;
+      }
+      if (_dataType == Animation::ANIMATIONTYPE_QUATERNION) {
+        Quaternion quaternion;
+        Quaternion::SlerpToRef(Quaternion(start[0], start[1], start[2], start[3]),
+                               Quaternion(end[0], end[1], end[2], end[3]), gradient, quaternion);
+        result[0] = quaternion.x;
+        result[1] = quaternion.y;
+        result[2] = quaternion.z;
+        result[3] = quaternion.w;
+        return;
+      }
+      break;
+    case Animation::ANIMATIONTYPE_MATRIX:
+      if (Animation::AllowMatricesInterpolation()) {
+        Matrix startMatrix, endMatrix, matrix;
+        LoadMatrix(start, startMatrix);
+        LoadMatrix(end, endMatrix);
+        if (Animation::AllowMatrixDecomposeForInterpolation()) {
+          Matrix::DecomposeLerpToRef(startMatrix, endMatrix, gradient, matrix);
+        }
+        else {
+          Matrix::LerpToRef(startMatrix, endMatrix, gradient, matrix);
+        }
+        std::copy(matrix.m().begin(), matrix.m().end(), result);
+      }
+      else {
+        std::copy_n(start, n, result);
+      }
+      return;
+    default:
+      break;
+  }
+
+  // Colors and the keys without tangents
+  for (size_t i = 0; i < n; ++i) {
+    result[i] = Scalar::Lerp(start[i], end[i], gradient);
+  }
+}
+
+void AnimationTrack::_sampleBaked(float frame, float* result) const
+{
+  const auto n         = _componentCount;
+  const auto nbSamples = _bakedValues.size() / n;
+  const auto position  = std::clamp((frame - _frames.front()) * _bakedSamplesPerFrame, 0.f,
+                                   static_cast<float>(nbSamples - 1));
+  const auto sample    = std::min(static_cast<size_t>(position), nbSamples - 2);
+  const auto gradient  = position - static_cast<float>(sample);
+  const auto* start    = &_bakedValues[sample * n];
+  const auto* end      = start + n;
+
+  if (_dataType == Animation::ANIMATIONTYPE_MATRIX && !Animation::AllowMatricesInterpolation()) {
+    std::copy_n(gradient < 1.f ? start : end, n, result);
+    return;
+  }
+
+  // Shortest path between the quaternions
+  auto endGradient = gradient;
+  if (_dataType == Animation::ANIMATIONTYPE_QUATERNION
+      && start[0] * end[0] + start[1] * end[1] + start[2] * end[2] + start[3] * end[3] < 0.f) {
+    endGradient = -gradient;
+  }
+  const auto startGradient = 1.f - gradient;
+  for (size_t i = 0; i < n; ++i) {
+    result[i] = start[i] * startGradient + end[i] * endGradient;
+  }
+
+  if (_dataType == Animation::ANIMATIONTYPE_QUATERNION) {
+    const auto length = std::sqrt(result[0] * result[0] + result[1] * result[1]
+                                  + result[2] * result[2] + result[3] * result[3]);
+    if (length > 0.f) {
+      for (size_t i = 0; i < n; ++i) {
+        result[i] /= length;
+      }
+    }
+  }
+}
+
+AnimationValue AnimationTrack::toAnimationValue(const float* value) const
+{
+  switch (_dataType) {
+    case Animation::ANIMATIONTYPE_FLOAT:
+      return AnimationValue(value[0]);
+    case Animation::ANIMATIONTYPE_VECTOR2:
+      return AnimationValue(Vector2(value[0], value[1]));
+    case Animation::ANIMATIONTYPE_VECTOR3:
+      return AnimationValue(Vector3(value[0], value[1], value[2]));
+    case Animation::ANIMATIONTYPE_QUATERNION:
+      return AnimationValue(Quaternion(value[0], value[1], value[2], value[3]));
+    case Animation::ANIMATIONTYPE_COLOR3:
+      return AnimationValue(Color3(value[0], value[1], value[2]));
+    case Animation::ANIMATIONTYPE_COLOR4:
+      return AnimationValue(Color4(value[0], value[1], value[2], value[3]));
+    case Animation::ANIMATIONTYPE_MATRIX: {
+      Matrix matrix;
+      LoadMatrix(value, matrix);
+      return AnimationValue(matrix);
+    }
+    default:
+      return AnimationValue();
+  }
+}
+
+} // end of namespace BABYLON
@@ -86,6 +86,13 @@ void IAnimatable::setProperty(
 {
 }
 
+AnimatedPropertySetter IAnimatable::_getAnimatedPropertySetter(
+  const std::vector<std::string>& /*targetPropertyPath*/,
+  unsigned int /*animationType*/)
+{
+  return nullptr;
+}
+
 AnimationValue IAnimatable::getProperty(const std::string& key,
                                         const Color3& color)
 {
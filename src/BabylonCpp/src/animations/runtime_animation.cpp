@@ -1,6 +1,7 @@
 #include <babylon/animations/runtime_animation.h>
 
 #include <cmath>
+#include <utility>
 
 #include <babylon/animations/_ianimation_state.h>
 #include <babylon/animations/animatable.h>
@@ -33,6 +34,9 @@ RuntimeAnimation::RuntimeAnimation(const IAnimatablePtr& iTarget, const Animatio
     , _ratioOffset{0.f}
     , _previousDelay{millisecond_t{0}}
     , _previousRatio{0.f}
+    , _propertySetter{nullptr}
+    , _trackValue{}
+    , _currentValueIsTrackValue{false}
     , _targetIsArray{false}
 {
   _animation     = animation;
@@ -51,20 +55,11 @@ RuntimeAnimation::RuntimeAnimation(const IAnimatablePtr& iTarget, const Animatio
   }
 
   // Limits
-  _keys     = _animation->getKeys();
-  _minFrame = _keys[0].frame;
-  _maxFrame = _keys.back().frame;
-  _minValue = _keys[0].value;
-  _maxValue = _keys.back().value;
-
-  // Add a start key at frame 0 if missing
-  if (_minFrame != 0.f) {
-    const auto newKey = IAnimationKey{
-      0.f,       // frame
-      _minValue, // value
-    };
-    _keys.insert(_keys.begin(), newKey);
-  }
+  const auto& keys = std::as_const(*_animation).getKeys();
+  _minFrame        = keys[0].frame;
+  _maxFrame        = keys.back().frame;
+  _minValue        = keys[0].value;
+  _maxValue        = keys.back().value;
 
   // Check data
   {
@@ -74,6 +69,12 @@ RuntimeAnimation::RuntimeAnimation(const IAnimatablePtr& iTarget, const Animatio
     _directTarget  = _activeTargets[0];
   }
 
+  // Typed track
+  if (_animation->_getTrack() && _directTarget) {
+    _propertySetter = _directTarget->_getAnimatedPropertySetter(
+      _animation->targetPropertyPath, static_cast<unsigned int>(_animation->dataType));
+  }
+
   // Cloning events locally
   const auto& events = animation->getEvents();
   if (!events.empty()) {
@@ -106,6 +107,14 @@ float RuntimeAnimation::get_weight() const
 
 std::optional<AnimationValue>& RuntimeAnimation::get_currentValue()
 {
+  // The last value was sampled in the typed track
+  if (_currentValueIsTrackValue) {
+    if (const auto& track = _animation->_getTrack()) {
+      _currentValue = track->toAnimationValue(_trackValue.data());
+    }
+    _currentValueIsTrackValue = false;
+  }
+
   return _currentValue;
 }
 
@@ -210,8 +219,9 @@ void RuntimeAnimation::_setValue(const IAnimatablePtr& iTarget, const IAnimatabl
                                  unsigned int targetIndex)
 {
   // Set value
-  _currentActiveTarget = destination;
-  _weight              = iWeight;
+  _currentActiveTarget      = destination;
+  _weight                   = iWeight;
+  _currentValueIsTrackValue = false;
 
   if (targetIndex >= _originalValue.size()) {
     _originalValue.resize(targetIndex + 1);
@@ -252,7 +262,7 @@ std::optional<unsigned int> RuntimeAnimation::_getCorrectLoopMode() const
 
 void RuntimeAnimation::goToFrame(float frame)
 {
-  auto& keys = _animation->getKeys();
+  const auto& keys = std::as_const(*_animation).getKeys();
 
   if (frame < keys[0].frame) {
     frame = keys[0].frame;
@@ -317,6 +327,15 @@ bool RuntimeAnimation::animate(millisecond_t delay, float from, float to, bool l
   _previousDelay = delay;
   _previousRatio = ratio;
 
+  // The typed track is sampled when the value is neither weighted nor offset by the loops
+  const auto repeatCount = range == 0.f ? 0 : static_cast<int>(ratio / range) >> 0;
+  const auto loopMode    = _animationState.loopMode;
+  auto track             = _propertySetter ? animation._getTrack().get() : nullptr;
+  const auto useTrack
+    = track && stl_util::almost_equal(iWeight, -1.f)
+      && (loopMode == Animation::ANIMATIONLOOPMODE_CYCLE
+          || (loopMode == Animation::ANIMATIONLOOPMODE_CONSTANT && repeatCount == 0));
+
   if (!loop && (to >= from && ratio >= range)) {
     // If we are out of range and not looping get back to caller
     returnValue    = false;
@@ -326,7 +345,7 @@ bool RuntimeAnimation::animate(millisecond_t delay, float from, float to, bool l
     returnValue    = false;
     highLimitValue = animation._getKeyValue(_minValue);
   }
-  else if (_animationState.loopMode != Animation::ANIMATIONLOOPMODE_CYCLE) {
+  else if (!useTrack && _animationState.loopMode != Animation::ANIMATIONLOOPMODE_CYCLE) {
     std::string keyOffset = std::to_string(to) + std::to_string(from);
     if (!_offsetsCache.count(keyOffset)) {
       _animationState.repeatCount = 0;
@@ -372,7 +391,7 @@ bool RuntimeAnimation::animate(millisecond_t delay, float from, float to, bool l
   }
 
   auto animationType = offsetValue.animationType();
-  if (!animationType.has_value()) {
+  if (!useTrack && !animationType.has_value()) {
     switch (_animation->dataType) {
       // Float
       case Animation::ANIMATIONTYPE_FLOAT:
@@ -433,15 +452,28 @@ bool RuntimeAnimation::animate(millisecond_t delay, float from, float to, bool l
       }
     }
   }
-  _currentFrame                  = iCurrentFrame;
-  _animationState.repeatCount    = range == 0.f ? 0 : static_cast<int>(ratio / range) >> 0;
-  _animationState.highLimitValue = highLimitValue;
-  _animationState.offsetValue    = offsetValue;
+  _currentFrame               = iCurrentFrame;
+  _animationState.repeatCount = repeatCount;
+
+  if (useTrack) {
+    // Set value
+    track->sample(iCurrentFrame, _animationState.key, animation.getEasingFunction().get(),
+                  _trackValue.data());
+    _currentActiveTarget      = _directTarget;
+    _weight                   = iWeight;
+    _currentValueIsTrackValue = true;
+    _propertySetter(_trackValue.data());
+    _target->markAsDirty(animation.targetProperty);
+  }
+  else {
+    _animationState.highLimitValue = highLimitValue;
+    _animationState.offsetValue    = offsetValue;
 
-  auto iCurrentValue = animation._interpolate(iCurrentFrame, _animationState);
+    auto iCurrentValue = animation._interpolate(iCurrentFrame, _animationState);
 
-  // Set value
-  setValue(iCurrentValue, iWeight);
+    // Set value
+    setValue(iCurrentValue, iWeight);
+  }
 
   // Check events
   if (!events.empty()) {
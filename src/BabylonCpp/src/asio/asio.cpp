@@ -3,7 +3,6 @@
 #include <babylon/asio/asio.h>
 #include <babylon/asio/internal/decode_data_uri.h>
 #include <babylon/asio/internal/file_loader_sync.h>
-#include <babylon/asio/internal/future_utils.h>
 #include <babylon/core/filesystem.h>
 #include <babylon/asio/internal/sync_callback_runner.h>
 #include <babylon/misc/string_tools.h>
@@ -23,10 +22,14 @@
 #endif
 
 
-#include <future>
+#include <algorithm>
 #include <atomic>
-#include <chrono>
 #include <cassert>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 
 
 
@@ -37,108 +40,171 @@ using namespace sync_io_impl;
 
 using OnSuccessFunctionArrayBuffer            = std::function<void(const ArrayBuffer& data)>;
 
-using FutureArrayBufferOrErrorMessage = std::future<ArrayBufferOrErrorMessage>;
+using CancelFlag = std::shared_ptr<std::atomic<bool>>;
 
-
-
-struct FutureAndCallbacks {
+struct IoRequest {
+  RequestId id;
+  int priority;
+  SyncLoaderFunction syncLoader;
   OnSuccessFunctionArrayBuffer onSuccessFunctionArrayBuffer;
   OnErrorFunction onErrorFunction;
-  FutureArrayBufferOrErrorMessage futureDataTypeOrErrorMessage;
+  CancelFlag cancelRequested;
 
-  std::optional<VoidCallback> shallCallNextCallback()
+  // Ordering used by the pending requests heap: higher priority first, then
+  // first-in first-out
+  bool operator<(const IoRequest& other) const
   {
-    auto status = get_future_running_status(futureDataTypeOrErrorMessage);
-    if (status != future_running_status::future_ready)
-      return std::nullopt;
-
-    ArrayBufferOrErrorMessage v = futureDataTypeOrErrorMessage.get();
-
-    VoidCallback nextCallback = EmptyVoidCallback;
-    if (std::holds_alternative<ErrorMessage>(v))
-    {
-      if (onErrorFunction)
-      {
-        const auto& errorMessage = std::get<ErrorMessage>(v);
+    if (priority != other.priority)
+      return priority < other.priority;
+    return id > other.id;
+  }
 
-        auto onErrorFunctionCopy = this->onErrorFunction;
-        nextCallback = [errorMessage, onErrorFunctionCopy]() {
-          onErrorFunctionCopy(errorMessage.errorMessage);
-        };
-      }
+  // Builds the callback that will be run *synchronously* by HeartBeat_Sync().
+  // The loaded buffer is moved into a shared holder, so that it is never
+  // copied on its way to the main thread.
+  VoidCallback makeCompletionCallback(ArrayBufferOrErrorMessage&& result) const
+  {
+    auto cancelFlag = cancelRequested;
+    if (std::holds_alternative<ErrorMessage>(result)) {
+      if (!onErrorFunction)
+        return EmptyVoidCallback;
+      auto onErrorFunctionCopy = onErrorFunction;
+      auto errorMessage = std::move(std::get<ErrorMessage>(result).errorMessage);
+      return [cancelFlag, onErrorFunctionCopy, errorMessage]() {
+        if (!*cancelFlag)
+          onErrorFunctionCopy(errorMessage);
+      };
     }
 
-    if (std::holds_alternative<ArrayBuffer>(v))
-    {
-      if (onSuccessFunctionArrayBuffer)
-      {
-        const auto& data = std::get<ArrayBuffer>(v);
-
-        auto onSuccessFunctionCopy = this->onSuccessFunctionArrayBuffer;
-        nextCallback = [onSuccessFunctionCopy, data]() {
-          onSuccessFunctionCopy(data);
-        };
-      }
-    }
-    return nextCallback;
+    if (!onSuccessFunctionArrayBuffer)
+      return EmptyVoidCallback;
+    auto onSuccessFunctionCopy = onSuccessFunctionArrayBuffer;
+    auto data = std::make_shared<ArrayBuffer>(std::move(std::get<ArrayBuffer>(result)));
+    return [cancelFlag, onSuccessFunctionCopy, data]() {
+      if (!*cancelFlag)
+        onSuccessFunctionCopy(*data);
+    };
   }
-
 };
 
 
+/**
+ * Completion driven io service: a bounded pool of worker threads pops the
+ * pending requests by priority, runs them, and pushes their completion
+ * callback to the sync_callback_runner as soon as they are done (no polling).
+ */
 class AsyncLoadService {
 private:
   AsyncLoadService()
   {
-    mStopRequested       = false;
-    mHasRunningIOTasks       = false;
-    mCheckIOCompletion_Async = really_async([this]() { this->CheckIOCompletion_AsyncProc(); });
+    auto hardwareConcurrency = static_cast<size_t>(std::thread::hardware_concurrency());
+    mNbWorkerThreads = std::clamp(hardwareConcurrency, size_t{2}, size_t{8});
   }
   ~AsyncLoadService()
   {
-    // mStopRequested = true;
+    StopWorkers();
   }
-  void CheckTasksStatus()
+
+  // Must be called with mMutexRequests locked
+  void EnsureWorkersStarted()
   {
-    std::lock_guard<std::mutex> guard(mMutexRunningIOTasks);
-    std::vector<FutureAndCallbacks> stillRunningTasks;
-    for (auto& runningTask : mRunningIOTasks)
-    {
-      std::optional<VoidCallback> nextCallback = runningTask.shallCallNextCallback();
-      if (nextCallback.has_value())
-        sync_callback_runner::PushCallback(std::move(nextCallback.value()));
-      else
-        stillRunningTasks.emplace_back(std::move(runningTask));
-    }
-    mRunningIOTasks  = std::move(stillRunningTasks);
-    mHasRunningIOTasks = !mRunningIOTasks.empty();
+    if (!mWorkers.empty())
+      return;
+    mStopRequested = false;
+    for (size_t i = 0; i < mNbWorkerThreads; ++i)
+      mWorkers.emplace_back([this]() { this->WorkerProc(); });
   }
 
-  void CheckIOCompletion_AsyncProc() // This will be called in a parallel thread
+  void WorkerProc() // This will be called in the worker threads
   {
-    using namespace std::literals;
 #ifdef CAN_NAME_THREAD
-    THIS_THREAD_SET_NAME("asio: CheckIOCompletion");
+    THIS_THREAD_SET_NAME("asio: IoWorker");
 #endif
-    while (!mStopRequested) {
-      CheckTasksStatus();
-      std::this_thread::sleep_for(15ms);
+    while (true) {
+      IoRequest request;
+      {
+        std::unique_lock<std::mutex> lock(mMutexRequests);
+        mRequestsCondition.wait(lock, [this]() { return mStopRequested || !mPendingRequests.empty(); });
+        if (mStopRequested)
+          return;
+        std::pop_heap(mPendingRequests.begin(), mPendingRequests.end());
+        request = std::move(mPendingRequests.back());
+        mPendingRequests.pop_back();
+      }
+
+      bool callbackPushed = false;
+      if (!*request.cancelRequested) {
+        ArrayBufferOrErrorMessage result = request.syncLoader(*request.cancelRequested);
+        if (!*request.cancelRequested) {
+          PushCompletionCallback(request, std::move(result));
+          callbackPushed = true;
+        }
+      }
+
+      OnRequestDone(request.id, !callbackPushed);
     }
   }
 
+  // The request stays alive (and can still be cancelled) until its callback is
+  // run by HeartBeat_Sync()
+  void PushCompletionCallback(const IoRequest& request, ArrayBufferOrErrorMessage&& result)
+  {
+    auto completionCallback = request.makeCompletionCallback(std::move(result));
+    auto requestId          = request.id;
+    sync_callback_runner::PushCallback([this, completionCallback, requestId]() {
+      completionCallback();
+      std::lock_guard<std::mutex> guard(mMutexRequests);
+      mAliveRequests.erase(requestId);
+    });
+  }
+
+  void OnRequestDone(RequestId requestId, bool forgetRequest)
+  {
+    {
+      std::lock_guard<std::mutex> guard(mMutexRequests);
+      if (forgetRequest)
+        mAliveRequests.erase(requestId);
+      --mNbRunningIOTasks;
+    }
+    mIdleCondition.notify_all();
+  }
+
 public:
-  void LoadData(
+  RequestId LoadData(
     const SyncLoaderFunction& syncLoader,
     const OnSuccessFunctionArrayBuffer & onSuccessFunctionArrayBuffer,
-    const OnErrorFunction& onErrorFunction
+    const OnErrorFunction& onErrorFunction,
+    RequestPriority priority = RequestPriority::Normal
   )
   {
-    std::lock_guard<std::mutex> guard(mMutexRunningIOTasks);
-    mHasRunningIOTasks = true;
-    FutureArrayBufferOrErrorMessage futureData = really_async(syncLoader);
-    FutureAndCallbacks payload{onSuccessFunctionArrayBuffer, onErrorFunction, std::move(futureData)};
+    RequestId requestId = 0;
+    {
+      std::lock_guard<std::mutex> guard(mMutexRequests);
+      EnsureWorkersStarted();
+      requestId = ++mLastRequestId;
+      auto cancelFlag = std::make_shared<std::atomic<bool>>(false);
+      mAliveRequests[requestId] = cancelFlag;
+      ++mNbRunningIOTasks;
+      mPendingRequests.push_back(IoRequest{requestId, static_cast<int>(priority), syncLoader,
+                                           onSuccessFunctionArrayBuffer, onErrorFunction,
+                                           cancelFlag});
+      std::push_heap(mPendingRequests.begin(), mPendingRequests.end());
+    }
+    mRequestsCondition.notify_one();
+    return requestId;
+  }
 
-    mRunningIOTasks.emplace_back(std::move(payload));
+  bool CancelRequest(RequestId requestId)
+  {
+    std::lock_guard<std::mutex> guard(mMutexRequests);
+    auto it = mAliveRequests.find(requestId);
+    if (it == mAliveRequests.end())
+      return false;
+    // Pending requests are skipped by the workers, running ones are
+    // interrupted by their loader, and completed ones are filtered out when
+    // their callback is run
+    *it->second = true;
+    return true;
   }
 
   static AsyncLoadService& Instance()
@@ -149,37 +215,75 @@ public:
 
   void WaitIoCompletion_Sync()
   {
-    using namespace std::literals;
-    while(mHasRunningIOTasks)
-      std::this_thread::sleep_for(50ms);
+    std::unique_lock<std::mutex> lock(mMutexRequests);
+    mIdleCondition.wait(lock, [this]() { return mNbRunningIOTasks == 0; });
   }
 
   bool HasRunningIOTasks()
   {
-    return mHasRunningIOTasks;
+    return mNbRunningIOTasks > 0;
   }
 
+  void SetNbWorkerThreads(size_t nbWorkerThreads)
+  {
+    StopWorkers();
+    std::lock_guard<std::mutex> guard(mMutexRequests);
+    mNbWorkerThreads = std::max(nbWorkerThreads, size_t{1});
+    if (!mPendingRequests.empty())
+      EnsureWorkersStarted();
+  }
+
+  // Joins the workers, then fails the requests that were still pending: their
+  // error callback is raised by HeartBeat_Sync() (unless they are cancelled)
   void Stop()
   {
-    mStopRequested = true;
+    StopWorkers();
+
+    std::vector<IoRequest> abortedRequests;
+    {
+      std::lock_guard<std::mutex> guard(mMutexRequests);
+      abortedRequests.swap(mPendingRequests);
+      mNbRunningIOTasks -= abortedRequests.size();
+    }
+    for (const auto& request : abortedRequests)
+      PushCompletionCallback(request, ErrorMessage{"Request aborted: the io service was stopped"});
+    mIdleCondition.notify_all();
   }
 
 private:
-  std::vector<FutureAndCallbacks> mRunningIOTasks;
-  std::atomic<bool> mHasRunningIOTasks;
-  std::mutex mMutexRunningIOTasks;
+  // Joins the workers; the pending requests are kept and will be run when the
+  // workers restart
+  void StopWorkers()
+  {
+    std::vector<std::thread> workers;
+    {
+      std::lock_guard<std::mutex> guard(mMutexRequests);
+      mStopRequested = true;
+      workers = std::move(mWorkers);
+      mWorkers.clear();
+    }
+    mRequestsCondition.notify_all();
+    for (auto& worker : workers)
+      worker.join();
+  }
 
-  std::future<void> mCheckIOCompletion_Async;
-  std::atomic<bool> mStopRequested;
+  size_t mNbWorkerThreads;
+  std::vector<std::thread> mWorkers;
+  bool mStopRequested = false;
 
+  std::vector<IoRequest> mPendingRequests; // heap, see IoRequest::operator<
+  std::unordered_map<RequestId, CancelFlag> mAliveRequests;
+  RequestId mLastRequestId = 0;
+  std::atomic<size_t> mNbRunningIOTasks{0};
+
+  std::mutex mMutexRequests;
+  std::condition_variable mRequestsCondition;
+  std::condition_variable mIdleCondition;
 };
 
 static std::string ArrayBufferToString(const ArrayBuffer & dataUint8)
 {
-  std::string dataString;
-  dataString.resize(dataUint8.size());
-  for (size_t i = 0; i < dataUint8.size(); ++i)
-    dataString[i] = static_cast<char>(dataUint8[i]);
+  std::string dataString(dataUint8.begin(), dataUint8.end());
   dataString = BABYLON::StringTools::replace(dataString, "\r\n", "\n");
   return dataString;
 }
@@ -196,25 +300,24 @@ void pop_HACK_DISABLE_ASYNC()
 }
 
 
-void LoadFileAsync_Text(const std::string& filename,
+RequestId LoadFileAsync_Text(const std::string& filename,
                        const OnSuccessFunction<std::string>& onSuccessFunction,
                        const OnErrorFunction& onErrorFunction,
-                       const OnProgressFunction& onProgressFunction
+                       const OnProgressFunction& onProgressFunction,
+                       RequestPriority priority = RequestPriority::Normal
                        )
 {
+  auto onSuccessFunctionArrayBuffer = [onSuccessFunction](const ArrayBuffer& dataUint8) {
+    onSuccessFunction(ArrayBufferToString(dataUint8));
+  };
+
   if (HACK_DISABLE_ASYNC == 0)
   {
     auto& service   = AsyncLoadService::Instance();
-    auto syncLoader = [filename, onProgressFunction]() {
-#ifdef CAN_NAME_THREAD
-      THIS_THREAD_SET_NAME("asio: LoadFileSync_Text");
-#endif
-      return LoadFileSync_Binary(filename, onProgressFunction);
-    };
-    auto onSuccessFunctionArrayBuffer = [onSuccessFunction](const ArrayBuffer& dataUint8) {
-      onSuccessFunction(ArrayBufferToString(dataUint8));
+    auto syncLoader = [filename, onProgressFunction](const std::atomic<bool>& cancelRequested) {
+      return LoadFileSync_Binary(filename, onProgressFunction, &cancelRequested);
     };
-    service.LoadData(syncLoader, onSuccessFunctionArrayBuffer, onErrorFunction);
+    return service.LoadData(syncLoader, onSuccessFunctionArrayBuffer, onErrorFunction, priority);
   }
   else
   {
@@ -224,31 +327,26 @@ void LoadFileAsync_Text(const std::string& filename,
       onErrorFunction( std::get<ErrorMessage>(r).errorMessage );
     }
     else {
-      auto onSuccessFunctionArrayBuffer = [onSuccessFunction](const ArrayBuffer& dataUint8) {
-        onSuccessFunction(ArrayBufferToString(dataUint8));
-      };
       onSuccessFunctionArrayBuffer(std::get<ArrayBuffer>(r));
     }
-
+    return 0;
   }
 }
 
-void LoadFileAsync_Binary(
+RequestId LoadFileAsync_Binary(
   const std::string& filename,
   const OnSuccessFunction<ArrayBuffer>& onSuccessFunction,
   const OnErrorFunction& onErrorFunction,
-  const OnProgressFunction& onProgressFunction
+  const OnProgressFunction& onProgressFunction,
+  RequestPriority priority = RequestPriority::Normal
   )
 {
   if (HACK_DISABLE_ASYNC == 0) {
     auto & service = AsyncLoadService::Instance();
-    auto syncLoader = [filename, onProgressFunction]() {
-#ifdef CAN_NAME_THREAD
-      THIS_THREAD_SET_NAME("asio: LoadFileSync_Binary");
-#endif
-      return LoadFileSync_Binary(filename, onProgressFunction);
+    auto syncLoader = [filename, onProgressFunction](const std::atomic<bool>& cancelRequested) {
+      return LoadFileSync_Binary(filename, onProgressFunction, &cancelRequested);
     };
-    service.LoadData(syncLoader, onSuccessFunction, onErrorFunction);
+    return service.LoadData(syncLoader, onSuccessFunction, onErrorFunction, priority);
   }
   else
   {
@@ -261,6 +359,7 @@ void LoadFileAsync_Binary(
       std::cout << "LoadFileAsync_Binary hack success with " << filename << "\n";
       onSuccessFunction(std::get<ArrayBuffer>(r));
     }
+    return 0;
   }
 }
 
@@ -271,8 +370,8 @@ void LoadAssetAsync_Text(
   const OnProgressFunction& onProgressFunction
 )
 {
-  std::string filename = assets_folder() + assetPath;
-  LoadFileAsync_Text(filename, onSuccessFunction, onErrorFunction, onProgressFunction);
+  LoadAssetAsync_Text_Prioritized(assetPath, RequestPriority::Normal, onSuccessFunction,
+                                  onErrorFunction, onProgressFunction);
 }
 
 
@@ -282,14 +381,97 @@ void LoadAssetAsync_Binary(
   const OnErrorFunction& onErrorFunction,
   const OnProgressFunction& onProgressFunction
 )
+{
+  LoadAssetAsync_Binary_Prioritized(assetPath, RequestPriority::Normal, onSuccessFunction,
+                                    onErrorFunction, onProgressFunction);
+}
+
+void LoadAssetAsync_Mapped(
+  const std::string& assetPath,
+  const OnSuccessFunction<MappedArrayBuffer>& onSuccessFunction,
+  const OnErrorFunction& onErrorFunction,
+  const OnProgressFunction& onProgressFunction
+)
 {
   if (IsBase64JpgDataUri(assetPath)) {
-    onSuccessFunction(DecodeBase64JpgDataUri(assetPath));
+    onSuccessFunction(MappedArrayBuffer(DecodeBase64JpgDataUri(assetPath)));
     return;
   }
 
   std::string filename = assets_folder() + assetPath;
-  LoadFileAsync_Binary(filename, onSuccessFunction, onErrorFunction, onProgressFunction);
+  if (HACK_DISABLE_ASYNC == 0) {
+    // The io workers transport ArrayBuffers: the mapped buffer travels beside
+    // the (empty) result, in a holder shared with the success callback
+    auto mappedHolder = std::make_shared<MappedArrayBuffer>();
+    auto syncLoader = [filename, onProgressFunction, mappedHolder](
+                        const std::atomic<bool>& /*cancelRequested*/) -> ArrayBufferOrErrorMessage {
+      *mappedHolder = MappedArrayBuffer::FromFile(filename);
+      if (!*mappedHolder)
+        return ErrorMessage("LoadFileSync_Mapped: Could not map file " + filename);
+      if (onProgressFunction) {
+        auto length = mappedHolder->byteLength();
+        sync_callback_runner::PushCallback([onProgressFunction, length]() {
+          onProgressFunction(true, length, length);
+        });
+      }
+      return ArrayBuffer{};
+    };
+    auto onSuccessFunctionArrayBuffer = [onSuccessFunction, mappedHolder](const ArrayBuffer&) {
+      onSuccessFunction(*mappedHolder);
+    };
+    AsyncLoadService::Instance().LoadData(syncLoader, onSuccessFunctionArrayBuffer, onErrorFunction);
+  }
+  else {
+    auto mapped = MappedArrayBuffer::FromFile(filename);
+    if (!mapped) {
+      onErrorFunction("LoadFileSync_Mapped: Could not map file " + filename);
+      return;
+    }
+    if (onProgressFunction)
+      onProgressFunction(true, mapped.byteLength(), mapped.byteLength());
+    onSuccessFunction(mapped);
+  }
+}
+
+RequestId LoadAssetAsync_Text_Prioritized(
+  const std::string& assetPath, RequestPriority priority,
+  const OnSuccessFunction<std::string>& onSuccessFunction,
+  const OnErrorFunction& onErrorFunction,
+  const OnProgressFunction& onProgressFunction
+)
+{
+  std::string filename = assets_folder() + assetPath;
+  return LoadFileAsync_Text(filename, onSuccessFunction, onErrorFunction, onProgressFunction,
+                            priority);
+}
+
+RequestId LoadAssetAsync_Binary_Prioritized(
+  const std::string& assetPath, RequestPriority priority,
+  const OnSuccessFunction<ArrayBuffer>& onSuccessFunction,
+  const OnErrorFunction& onErrorFunction,
+  const OnProgressFunction& onProgressFunction
+)
+{
+  if (IsBase64JpgDataUri(assetPath)) {
+    onSuccessFunction(DecodeBase64JpgDataUri(assetPath));
+    return 0;
+  }
+
+  std::string filename = assets_folder() + assetPath;
+  return LoadFileAsync_Binary(filename, onSuccessFunction, onErrorFunction, onProgressFunction,
+                              priority);
+}
+
+bool CancelRequest(RequestId requestId)
+{
+  auto & service = AsyncLoadService::Instance();
+  return service.CancelRequest(requestId);
+}
+
+void Service_SetNbWorkerThreads(size_t nbWorkerThreads)
+{
+  auto & service = AsyncLoadService::Instance();
+  service.SetNbWorkerThreads(nbWorkerThreads);
 }
 
 // Call this in the app's main loop: it will run the callbacks synchronously
@@ -147,6 +147,54 @@ void LoadAssetAsync_Binary(
   emscripten_async_wget_data(fullUrl.c_str(), (void*)downloadId, babylon_emscripten_onLoad, babylon_emscripten_onError);
 }
 
+void LoadAssetAsync_Mapped(
+  const std::string& assetPath,
+  const OnSuccessFunction<MappedArrayBuffer>& onSuccessFunction,
+  const OnErrorFunction& onErrorFunction,
+  const OnProgressFunction& onProgressFunction
+)
+{
+  // No memory mapping with emscripten: wrap the downloaded buffer
+  auto onSuccessFunctionArrayBuffer = [onSuccessFunction](const ArrayBuffer& data) {
+    onSuccessFunction(MappedArrayBuffer(ArrayBuffer(data)));
+  };
+  LoadAssetAsync_Binary(assetPath, onSuccessFunctionArrayBuffer, onErrorFunction, onProgressFunction);
+}
+
+RequestId LoadAssetAsync_Text_Prioritized(
+  const std::string& assetPath, RequestPriority /*priority*/,
+  const OnSuccessFunction<std::string>& onSuccessFunction,
+  const OnErrorFunction& onErrorFunction,
+  const OnProgressFunction& onProgressFunction
+)
+{
+  // emscripten_async_wget_data has no notion of priority
+  LoadAssetAsync_Text(assetPath, onSuccessFunction, onErrorFunction, onProgressFunction);
+  return 0;
+}
+
+RequestId LoadAssetAsync_Binary_Prioritized(
+  const std::string& assetPath, RequestPriority /*priority*/,
+  const OnSuccessFunction<ArrayBuffer>& onSuccessFunction,
+  const OnErrorFunction& onErrorFunction,
+  const OnProgressFunction& onProgressFunction
+)
+{
+  // emscripten_async_wget_data has no notion of priority
+  LoadAssetAsync_Binary(assetPath, onSuccessFunction, onErrorFunction, onProgressFunction);
+  return 0;
+}
+
+bool CancelRequest(RequestId /*requestId*/)
+{
+  BABYLON_LOG_WARN("asio", "CancelRequest does not work under emscripten", "");
+  return false;
+}
+
+void Service_SetNbWorkerThreads(size_t /*nbWorkerThreads*/)
+{
+}
+
 // Call this in the app's main loop: it will run the callbacks synchronously
 // after the io completion
 void HeartBeat_Sync()
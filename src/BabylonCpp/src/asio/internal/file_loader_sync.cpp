@@ -11,7 +11,8 @@ namespace sync_io_impl
 
 ArrayBufferOrErrorMessage LoadFileSync_Binary(
   const std::string& filename,
-  const OnProgressFunction& onProgressFunction
+  const OnProgressFunction& onProgressFunction,
+  const std::atomic<bool>* cancelRequested
 )
 {
   std::ifstream ifs(filename.c_str(), std::ios::binary | std::ios::ate);
@@ -31,12 +32,17 @@ ArrayBufferOrErrorMessage LoadFileSync_Binary(
 
   while (alreadyReadSize < fileSize)
   {
+    if (cancelRequested && *cancelRequested) {
+      std::string message = "LoadFileSync_Binary: Cancelled loading of " + std::string(filename);
+      return ErrorMessage(message);
+    }
+
     if (onProgressFunction)
     {
       auto f = [onProgressFunction, alreadyReadSize, fileSize]() {
         onProgressFunction(true, alreadyReadSize, fileSize);
       };
-      sync_callback_runner::PushCallback(f);
+      sync_callback_runner::PushCallback(std::move(f));
     }
 
     size_t sizeToRead = fileSize - alreadyReadSize > blockSize ? blockSize : fileSize - alreadyReadSize;
@@ -54,7 +60,7 @@ ArrayBufferOrErrorMessage LoadFileSync_Binary(
   }
 
   BABYLON_LOG_DEBUG("LoadFileSync_Binary", "Finished loading ", filename.c_str());
-  return buffer;
+  return ArrayBufferOrErrorMessage(std::move(buffer));
 }
 
 
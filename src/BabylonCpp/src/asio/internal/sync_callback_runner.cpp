@@ -22,6 +22,12 @@ void PushCallback(const VoidCallback & function)
   gPendingCallbacks.push_back(function);
 }
 
+void PushCallback(VoidCallback && function)
+{
+  std::lock_guard<std::mutex> guard(gMutexPendingCallbacks);
+  gPendingCallbacks.push_back(std::move(function));
+}
+
 void HeartBeat()
 {
   int nbRemainingCallback = -1;
@@ -39,7 +45,7 @@ void HeartBeat()
 
       if (!gPendingCallbacks.empty())
       {
-        callback = gPendingCallbacks.front();
+        callback = std::move(gPendingCallbacks.front());
         gPendingCallbacks.pop_front();
       }
       nbRemainingCallback = static_cast<int>(gPendingCallbacks.size());
@@ -85,6 +85,22 @@ void Bone::setProperty(const std::vector<std::string>& targetPropertyPath,
   }
 }
 
+AnimatedPropertySetter
+Bone::_getAnimatedPropertySetter(const std::vector<std::string>& targetPropertyPath,
+                                 unsigned int animationType)
+{
+  if (animationType == Animation::ANIMATIONTYPE_MATRIX && targetPropertyPath.size() == 1
+      && targetPropertyPath[0] == "_matrix") {
+    return [this](const float* m) {
+      Matrix::FromValuesToRef(m[0], m[1], m[2], m[3], m[4], m[5], m[6], m[7], m[8], m[9], m[10],
+                              m[11], m[12], m[13], m[14], m[15], _localMatrix);
+      _needToDecompose = true;
+    };
+  }
+
+  return nullptr;
+}
+
 // Members
 Matrix& Bone::get__matrix()
 {
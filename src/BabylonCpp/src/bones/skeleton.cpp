@@ -5,6 +5,7 @@
 #include <babylon/bones/bone.h>
 #include <babylon/core/json_util.h>
 #include <babylon/core/logging.h>
+#include <babylon/core/time.h>
 #include <babylon/engines/constants.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
@@ -21,14 +22,17 @@ Skeleton::Skeleton(const std::string& iName, const std::string& iId, Scene* scen
     , id{iId}
     , _numBonesWithLinkedTransformNode{0}
     , _hasWaitingData{std::nullopt}
+    , _activeEvaluationId{0}
     , doNotSerialize{false}
     , useTextureToStoreBoneMatrices{this, &Skeleton::get_useTextureToStoreBoneMatrices,
                                     &Skeleton::set_useTextureToStoreBoneMatrices}
     , isUsingTextureForMatrices{this, &Skeleton::get_isUsingTextureForMatrices}
     , uniqueId{this, &Skeleton::get_uniqueId}
+    , evaluationTimeCounter{this, &Skeleton::get_evaluationTimeCounter}
     , _isDirty{true}
     , _transformMatrixTexture{nullptr}
     , _identity{Matrix::Identity()}
+    , _synchronizedWithMesh{nullptr}
     , _lastAbsoluteTransformsUpdateId{-1}
     , _canUseTextureForBones{false}
     , _uniqueId{0}
@@ -109,11 +113,19 @@ size_t Skeleton::get_uniqueId() const
   return _uniqueId;
 }
 
+PerfCounter& Skeleton::get_evaluationTimeCounter()
+{
+  return _evaluationTime;
+}
+
 // Members
 Float32Array& Skeleton::getTransformMatrices(AbstractMesh* mesh)
 {
-  if (needInitialSkinMatrix && !mesh->_bonesTransformMatrices.empty()) {
-    return mesh->_bonesTransformMatrices;
+  if (needInitialSkinMatrix) {
+    const auto paletteMesh = _getPaletteMesh(mesh);
+    if (!paletteMesh->_bonesTransformMatrices.empty()) {
+      return paletteMesh->_bonesTransformMatrices;
+    }
   }
 
   if (_transformMatrices.empty()) {
@@ -125,13 +137,35 @@ Float32Array& Skeleton::getTransformMatrices(AbstractMesh* mesh)
 
 RawTexturePtr& Skeleton::getTransformMatrixTexture(AbstractMesh* mesh)
 {
-  if (needInitialSkinMatrix && mesh->_transformMatrixTexture) {
-    return mesh->_transformMatrixTexture;
+  if (needInitialSkinMatrix) {
+    const auto paletteMesh = _getPaletteMesh(mesh);
+    if (paletteMesh->_transformMatrixTexture) {
+      return paletteMesh->_transformMatrixTexture;
+    }
   }
 
   return _transformMatrixTexture;
 }
 
+AbstractMesh* Skeleton::_getPaletteMesh(AbstractMesh* mesh) const
+{
+  if (_sharedPaletteMeshes.empty()) {
+    return mesh;
+  }
+
+  const auto it = _sharedPaletteMeshes.find(mesh);
+  return it != _sharedPaletteMeshes.end() ? it->second : mesh;
+}
+
+size_t Skeleton::PoseMatrixHash::operator()(const std::array<float, 16>& poseMatrix) const
+{
+  size_t hash = 0;
+  for (const auto value : poseMatrix) {
+    hash = hash * 31 + std::hash<float>{}(value);
+  }
+  return hash;
+}
+
 Scene* Skeleton::getScene()
 {
   return _scene;
@@ -314,43 +348,97 @@ void Skeleton::_registerMeshWithPoseMatrix(AbstractMesh* mesh)
 void Skeleton::_unregisterMeshWithPoseMatrix(AbstractMesh* mesh)
 {
   stl_util::erase(_meshesWithPoseMatrix, mesh);
+
+  // The meshes sharing its bone matrices get their own ones
+  _poseMatrixMeshes.clear();
+  _sharedPaletteMeshes.clear();
+  _isDirty = true;
+}
+
+void Skeleton::_updateFlatHierarchy()
+{
+  auto isUpToDate = (_flatBones.size() == bones.size());
+  for (size_t index = 0; isUpToDate && index < bones.size(); ++index) {
+    const auto bone        = bones[index].get();
+    const auto parentIndex = _parentIndices[index];
+    const auto parentBone  = parentIndex >= 0 ? _flatBones[parentIndex] : nullptr;
+    if (parentIndex == -2) {
+      isUpToDate = (_flatBones[index] == bone) && bone->getParent();
+    }
+    else {
+      isUpToDate = (_flatBones[index] == bone) && (bone->getParent() == parentBone);
+    }
+  }
+
+  if (isUpToDate) {
+    return;
+  }
+
+  std::unordered_map<Bone*, int> boneIndices;
+  _flatBones.resize(bones.size());
+  _parentIndices.resize(bones.size());
+  for (size_t index = 0; index < bones.size(); ++index) {
+    _flatBones[index]               = bones[index].get();
+    boneIndices[bones[index].get()] = static_cast<int>(index);
+  }
+  for (size_t index = 0; index < bones.size(); ++index) {
+    const auto parentBone = _flatBones[index]->getParent();
+    if (!parentBone) {
+      _parentIndices[index] = -1;
+    }
+    else {
+      const auto it         = boneIndices.find(parentBone);
+      _parentIndices[index] = (it != boneIndices.end()) ? it->second : -2;
+    }
+  }
 }
 
 void Skeleton::_computeTransformMatrices(Float32Array& targetMatrix,
-                                         const std::optional<Matrix>& initialSkinMatrix)
+                                         const Matrix* initialSkinMatrix)
 {
   onBeforeComputeObservable.notifyObservers(this);
 
-  unsigned int index = 0;
-  for (const auto& bone : bones) {
+  for (size_t index = 0; index < _flatBones.size(); ++index) {
+    const auto bone        = _flatBones[index];
+    const auto parentIndex = _parentIndices[index];
+    auto& worldMatrix      = bone->getWorldMatrix();
     ++bone->_childUpdateId;
-    auto parentBone = bone->getParent();
 
-    if (parentBone) {
-      bone->getLocalMatrix().multiplyToRef(parentBone->getWorldMatrix(), bone->getWorldMatrix());
+    if (parentIndex >= 0) {
+      bone->getLocalMatrix().multiplyToRef(_flatBones[parentIndex]->getWorldMatrix(), worldMatrix);
+    }
+    else if (parentIndex == -2) {
+      bone->getLocalMatrix().multiplyToRef(bone->getParent()->getWorldMatrix(), worldMatrix);
+    }
+    else if (initialSkinMatrix) {
+      bone->getLocalMatrix().multiplyToRef(*initialSkinMatrix, worldMatrix);
     }
     else {
-      if (initialSkinMatrix.has_value()) {
-        bone->getLocalMatrix().multiplyToRef(*initialSkinMatrix, bone->getWorldMatrix());
-      }
-      else {
-        bone->getWorldMatrix().copyFrom(bone->getLocalMatrix());
-      }
+      worldMatrix.copyFrom(bone->getLocalMatrix());
     }
 
     if (!bone->_index.has_value() || *bone->_index != -1) {
-      auto mappedIndex
-        = !bone->_index.has_value() ? index : static_cast<unsigned int>(*bone->_index);
-      bone->getInvertedAbsoluteTransform().multiplyToArray(bone->getWorldMatrix(), targetMatrix,
-                                                           mappedIndex * 16);
+      const auto mappedIndex
+        = !bone->_index.has_value() ? index : static_cast<size_t>(*bone->_index);
+      bone->getInvertedAbsoluteTransform().multiplyToArray(
+        worldMatrix, targetMatrix, static_cast<unsigned int>(mappedIndex * 16));
     }
-    ++index;
   }
 
-  _identity.copyToArray(targetMatrix, static_cast<unsigned int>(bones.size()) * 16);
+  _identity.copyToArray(targetMatrix, static_cast<unsigned int>(_flatBones.size()) * 16);
 }
 
 void Skeleton::prepare()
+{
+  if (!_beginPrepare()) {
+    return;
+  }
+
+  _computeMatrices();
+  _endPrepare();
+}
+
+bool Skeleton::_beginPrepare()
 {
   // Update the local matrix of bones with linked transform nodes.
   if (_numBonesWithLinkedTransformNode > 0) {
@@ -365,22 +453,71 @@ void Skeleton::prepare()
   }
 
   if (!_isDirty) {
-    return;
+    return false;
   }
 
+  _updateFlatHierarchy();
+
+  const auto matricesSize = 16 * (bones.size() + 1);
+  const auto textureWidth = static_cast<int>((bones.size() + 1) * 4);
   if (needInitialSkinMatrix) {
     for (const auto& mesh : _meshesWithPoseMatrix) {
+      if (mesh->_bonesTransformMatrices.size() != matricesSize) {
+        mesh->_bonesTransformMatrices.resize(matricesSize);
+      }
+
+      if (isUsingTextureForMatrices()
+          && (!mesh->_transformMatrixTexture
+              || mesh->_transformMatrixTexture->getSize().width != textureWidth)) {
+        if (mesh->_transformMatrixTexture) {
+          mesh->_transformMatrixTexture->dispose();
+        }
+
+        mesh->_transformMatrixTexture = RawTexture::CreateRGBATexture(
+          mesh->_bonesTransformMatrices, textureWidth, 1, _scene, false, false,
+          Constants::TEXTURE_NEAREST_SAMPLINGMODE, Constants::TEXTURETYPE_FLOAT);
+      }
+    }
+  }
+  else if (_transformMatrices.size() != matricesSize) {
+    _transformMatrices.resize(matricesSize);
+
+    if (isUsingTextureForMatrices) {
+      if (_transformMatrixTexture) {
+        _transformMatrixTexture->dispose();
+      }
+
+      _transformMatrixTexture = RawTexture::CreateRGBATexture(
+        _transformMatrices, textureWidth, 1, _scene, false, false,
+        Constants::TEXTURE_NEAREST_SAMPLINGMODE, Constants::TEXTURETYPE_FLOAT);
+    }
+  }
+
+  return true;
+}
 
-      auto poseMatrix = mesh->getPoseMatrix();
+void Skeleton::_computeMatrices()
+{
+  const auto startTime = Time::highresTimepointNow();
+
+  if (needInitialSkinMatrix) {
+    // The bone matrices only depend on the pose matrix, meshes sharing the pose matrix of a
+    // previous mesh use its bone matrices
+    _poseMatrixMeshes.clear();
+    _sharedPaletteMeshes.clear();
+    for (const auto& mesh : _meshesWithPoseMatrix) {
+      const auto& poseMatrix = mesh->getPoseMatrix();
 
-      if (mesh->_bonesTransformMatrices.size() != 16 * (bones.size() + 1)) {
-        mesh->_bonesTransformMatrices.resize(16 * (bones.size() + 1));
+      const auto [it, inserted] = _poseMatrixMeshes.try_emplace(poseMatrix.m(), mesh);
+      if (!inserted) {
+        _sharedPaletteMeshes[mesh] = it->second;
+        continue;
       }
 
       if (_synchronizedWithMesh != mesh) {
         _synchronizedWithMesh = mesh;
         // Prepare bones
-        for (const auto& bone : bones) {
+        for (const auto& bone : _flatBones) {
           if (!bone->getParent()) {
             auto& tmpMatrix = TmpVectors::MatrixArray[0];
             auto& matrix    = bone->getBaseMatrix();
@@ -388,48 +525,31 @@ void Skeleton::prepare()
             bone->_updateDifferenceMatrix(tmpMatrix);
           }
         }
-
-        if (isUsingTextureForMatrices()) {
-          const auto textureWidth = static_cast<int>((bones.size() + 1) * 4);
-          if (!mesh->_transformMatrixTexture
-              || mesh->_transformMatrixTexture->getSize().width != textureWidth) {
-
-            if (mesh->_transformMatrixTexture) {
-              mesh->_transformMatrixTexture->dispose();
-            }
-
-            mesh->_transformMatrixTexture = RawTexture::CreateRGBATexture(
-              mesh->_bonesTransformMatrices, static_cast<int>((bones.size() + 1) * 4), 1, _scene,
-              false, false, Constants::TEXTURE_NEAREST_SAMPLINGMODE, Constants::TEXTURETYPE_FLOAT);
-          }
-        }
       }
 
-      _computeTransformMatrices(mesh->_bonesTransformMatrices, poseMatrix);
-
-      if (isUsingTextureForMatrices && mesh->_transformMatrixTexture) {
-        mesh->_transformMatrixTexture->update(mesh->_bonesTransformMatrices);
-      }
+      _computeTransformMatrices(mesh->_bonesTransformMatrices, &poseMatrix);
     }
   }
   else {
-    if (_transformMatrices.size() != 16 * (bones.size() + 1)) {
-      _transformMatrices.resize(16 * (bones.size() + 1));
+    _computeTransformMatrices(_transformMatrices);
+  }
 
-      if (isUsingTextureForMatrices) {
-        if (_transformMatrixTexture) {
-          _transformMatrixTexture->dispose();
-        }
+  _evaluationTime.fetchNewFrame();
+  _evaluationTime.addCount(
+    Time::fpTimeDiff<size_t, std::micro>(startTime, Time::highresTimepointNow()), true);
+}
 
-        _transformMatrixTexture = RawTexture::CreateRGBATexture(
-          _transformMatrices, static_cast<int>((bones.size() + 1) * 4), 1, _scene, false, false,
-          Constants::TEXTURE_NEAREST_SAMPLINGMODE, Constants::TEXTURETYPE_FLOAT);
+void Skeleton::_endPrepare()
+{
+  if (isUsingTextureForMatrices) {
+    if (needInitialSkinMatrix) {
+      for (const auto& mesh : _meshesWithPoseMatrix) {
+        if (mesh->_transformMatrixTexture && _getPaletteMesh(mesh) == mesh) {
+          mesh->_transformMatrixTexture->update(mesh->_bonesTransformMatrices);
+        }
       }
     }
-
-    _computeTransformMatrices(_transformMatrices);
-
-    if (isUsingTextureForMatrices && _transformMatrixTexture) {
+    else if (_transformMatrixTexture) {
       _transformMatrixTexture->update(_transformMatrices);
     }
   }
@@ -476,6 +596,8 @@ void Skeleton::enableBlending(float blendingSpeed)
 void Skeleton::dispose(bool /*doNotRecurse*/, bool /*disposeMaterialAndTextures*/)
 {
   _meshesWithPoseMatrix.clear();
+  _poseMatrixMeshes.clear();
+  _sharedPaletteMeshes.clear();
 
   // Animations
   getScene()->stopAnimation(this);
@@ -15,6 +15,7 @@ Collider::Collider()
     , _basePointWorld{Vector3::Zero()}
     , collisionMask{this, &Collider::get_collisionMask,
                     &Collider::set_collisionMask}
+    , _trianglePlane{0.f, 0.f, 0.f, 0.f}
     , _collisionPoint{Vector3::Zero()}
     , _planeIntersectionPoint{Vector3::Zero()}
     , _tempVector{Vector3::Zero()}
@@ -172,23 +173,16 @@ bool Collider::_canDoCollision(const Vector3& sphereCenter, float sphereRadius,
   return true;
 }
 
-void Collider::_testTriangle(size_t faceIndex,
-                             std::vector<Plane>& trianglePlaneArray,
-                             const Vector3& p1, const Vector3& p2,
+void Collider::_testTriangle(const Vector3& p1, const Vector3& p2,
                              const Vector3& p3, bool hasMaterial,
                              const AbstractMeshPtr& hostMesh)
 {
   auto f = 0.f, t0 = 0.f;
   auto embeddedInPlane = false;
 
-  if (faceIndex >= trianglePlaneArray.size()) {
-    for (size_t i = trianglePlaneArray.size(); i <= faceIndex; ++i) {
-      trianglePlaneArray.emplace_back(Plane(0.f, 0.f, 0.f, 0.f));
-    }
-    trianglePlaneArray[faceIndex].copyFromPoints(p1, p2, p3);
-  }
-
-  auto& trianglePlane = trianglePlaneArray[faceIndex];
+  // The plane depends on the radius of the collider, it is computed for each test
+  auto& trianglePlane = _trianglePlane;
+  trianglePlane.copyFromPoints(p1, p2, p3);
 
   if ((!hasMaterial)
       && !trianglePlane.isFrontFacingTo(_normalizedVelocity, 0)) {
@@ -377,21 +371,6 @@ void Collider::_testTriangle(size_t faceIndex,
   }
 }
 
-void Collider::_collide(std::vector<Plane>& trianglePlaneArray,
-                        const std::vector<Vector3>& pts,
-                        const IndicesArray& indices, size_t indexStart,
-                        size_t indexEnd, unsigned int decal, bool hasMaterial,
-                        const AbstractMeshPtr& hostMesh)
-{
-  for (size_t i = indexStart; i < indexEnd; i += 3) {
-    const auto& p1 = pts[indices[i] - decal];
-    const auto& p2 = pts[indices[i + 1] - decal];
-    const auto& p3 = pts[indices[i + 2] - decal];
-
-    _testTriangle(i, trianglePlaneArray, p3, p2, p1, hasMaterial, hostMesh);
-  }
-}
-
 void Collider::_getResponse(Vector3& pos, Vector3& vel)
 {
   pos.addToRef(vel, _destinationPoint);
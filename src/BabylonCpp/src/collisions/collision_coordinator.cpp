@@ -1,9 +1,14 @@
 #include <babylon/collisions/collision_coordinator.h>
 
+#include <algorithm>
+
 #include <babylon/collisions/collider.h>
+#include <babylon/culling/bvh/picking_bvh.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
 #include <babylon/meshes/abstract_mesh.h>
+#include <babylon/meshes/sub_mesh.h>
+#include <babylon/misc/job_pool.h>
 
 namespace BABYLON {
 
@@ -30,14 +35,55 @@ void DefaultCollisionCoordinator::getNewPosition(
   collider->_retry           = 0;
   collider->_initialVelocity = _scaledVelocity;
   collider->_initialPosition = _scaledPosition;
+  const auto meshesBVH
+    = _scene->collisionsBroadphaseEnabled ? &_scene->_getPickingBVH() : nullptr;
   _collideWithWorld(_scaledPosition, _scaledVelocity, collider, maximumRetry,
-                    _finalPosition, excludedMesh);
+                    _finalPosition, excludedMesh, meshesBVH, true);
 
   _finalPosition.multiplyInPlace(collider->_radius);
   // run the callback
   onNewPosition(collisionIndex, _finalPosition, collider->collidedMesh);
 }
 
+void DefaultCollisionCoordinator::getNewPositions(std::vector<ColliderMove>& moves)
+{
+  static constexpr size_t GrainSize = 4;
+
+  // The BVH is synchronized and the data created lazily by the collisions are created before
+  // the concurrent tests, which only read the meshes
+  const auto meshesBVH
+    = _scene->collisionsBroadphaseEnabled ? &_scene->_getPickingBVH() : nullptr;
+  for (const auto& mesh : _scene->meshes) {
+    if (!mesh->checkCollisions || mesh->subMeshes.empty()) {
+      continue;
+    }
+    mesh->_generatePointsArray();
+    mesh->_getTriangleBVH();
+    for (const auto& subMesh : mesh->subMeshes) {
+      subMesh->getMaterial();
+    }
+  }
+
+  JobPool::Default().parallelFor(moves.size(), GrainSize, [&](size_t begin, size_t end) {
+    for (size_t index = begin; index < end; ++index) {
+      auto& move           = moves[index];
+      const auto& collider = move.collider;
+
+      auto scaledPosition = move.position.divide(collider->_radius);
+      auto scaledVelocity = move.displacement.divide(collider->_radius);
+
+      collider->collidedMesh     = nullptr;
+      collider->_retry           = 0;
+      collider->_initialVelocity = scaledVelocity;
+      collider->_initialPosition = scaledPosition;
+      _collideWithWorld(scaledPosition, scaledVelocity, collider, move.maximumRetry,
+                        move.newPosition, move.excludedMesh, meshesBVH, false);
+
+      move.newPosition.multiplyInPlace(collider->_radius);
+    }
+  });
+}
+
 ColliderPtr DefaultCollisionCoordinator::createCollider()
 {
   return std::make_shared<Collider>();
@@ -51,7 +97,8 @@ void DefaultCollisionCoordinator::init(Scene* scene)
 void DefaultCollisionCoordinator::_collideWithWorld(
   Vector3& position, Vector3& velocity, const ColliderPtr& collider,
   unsigned int maximumRetry, Vector3& finalPosition,
-  const AbstractMeshPtr& excludedMesh)
+  const AbstractMeshPtr& excludedMesh, const PickingBVH* meshesBVH,
+  bool useSubMeshCandidates) const
 {
   auto closeDistance = Engine::CollisionsEpsilon * 10.f;
 
@@ -66,12 +113,39 @@ void DefaultCollisionCoordinator::_collideWithWorld(
 
   collider->_initialize(position, velocity, closeDistance);
 
-  // Check all meshes
-  for (const auto& mesh : _scene->meshes) {
+  const auto checkCollision = [&](const AbstractMeshPtr& mesh) {
     if (mesh->isEnabled() && mesh->checkCollisions && !mesh->subMeshes.empty()
         && mesh != excludedMesh
         && ((collisionMask & mesh->collisionGroup) != 0)) {
-      mesh->_checkCollision(*collider);
+      mesh->_checkCollision(*collider, useSubMeshCandidates);
+    }
+  };
+
+  if (meshesBVH) {
+    // Only the meshes whose world bounding box overlaps the bounds of the collider sweep (see
+    // Collider::_canDoCollision) are checked, in the order of the scene
+    const auto& radius     = collider->_radius;
+    const auto sweepRadius = collider->_velocityWorldLength
+                             + std::max({radius.x, radius.y, radius.z});
+    const Vector3 sweepExtents(sweepRadius, sweepRadius, sweepRadius);
+    const auto& center = collider->_basePointWorld;
+    const auto bounds
+      = BVHBounds::FromMinMax(center.subtract(sweepExtents), center.add(sweepExtents));
+
+    std::vector<uint32_t> candidates;
+    meshesBVH->intersectsBounds(bounds, [&candidates](uint32_t index) {
+      candidates.emplace_back(index);
+      return false;
+    });
+    std::sort(candidates.begin(), candidates.end());
+    for (const auto index : candidates) {
+      checkCollision(_scene->meshes[index]);
+    }
+  }
+  else {
+    // Check all meshes
+    for (const auto& mesh : _scene->meshes) {
+      checkCollision(mesh);
     }
   }
 
@@ -91,7 +165,7 @@ void DefaultCollisionCoordinator::_collideWithWorld(
 
   ++collider->_retry;
   _collideWithWorld(position, velocity, collider, maximumRetry, finalPosition,
-                    excludedMesh);
+                    excludedMesh, meshesBVH, useSubMeshCandidates);
 }
 
 } // end of namespace BABYLON
@@ -31,6 +31,11 @@ ArrayBufferView::ArrayBufferView(const Float32Array& buffer)
 {
 }
 
+ArrayBufferView::ArrayBufferView(const MappedArrayBuffer& mappedArrayBuffer)
+    : byteOffset{0}, _mappedArrayBuffer{mappedArrayBuffer}
+{
+}
+
 ArrayBufferView::ArrayBufferView(const ArrayBufferView& other) = default;
 
 ArrayBufferView::ArrayBufferView(ArrayBufferView&& other) = default;
@@ -43,52 +48,87 @@ ArrayBufferView::~ArrayBufferView() = default;
 
 size_t ArrayBufferView::byteLength() const
 {
-  return _uint8Array.size();
+  return _mappedArrayBuffer ? _mappedArrayBuffer.byteLength() : _uint8Array.size();
 }
 
 ArrayBufferView::operator bool() const
 {
-  return !_uint8Array.empty();
+  return byteLength() > 0;
+}
+
+const uint8_t* ArrayBufferView::data() const
+{
+  return _mappedArrayBuffer ? _mappedArrayBuffer.data() : _uint8Array.data();
+}
+
+bool ArrayBufferView::isMapped() const
+{
+  return static_cast<bool>(_mappedArrayBuffer);
+}
+
+ArrayBufferView ArrayBufferView::subView(size_t subByteOffset, size_t subByteLength) const
+{
+  if (_mappedArrayBuffer) {
+    return ArrayBufferView(_mappedArrayBuffer.slice(subByteOffset, subByteLength));
+  }
+  return ArrayBufferView(typedArray<uint8_t>(subByteOffset, subByteLength));
+}
+
+template <typename T>
+std::vector<T> ArrayBufferView::_toTypedArray() const
+{
+  if (_mappedArrayBuffer) {
+    return _mappedArrayBuffer.toTypedArray<T>();
+  }
+  return stl_util::to_array<T>(_uint8Array);
 }
 
 Int8Array ArrayBufferView::int8Array() const
 {
-  return stl_util::to_array<int8_t>(_uint8Array);
+  return _toTypedArray<int8_t>();
 }
 
 Uint8Array& ArrayBufferView::uint8Array()
 {
+  // The caller may modify the returned array: detach from the mapped storage
+  if (_mappedArrayBuffer) {
+    _uint8Array        = _mappedArrayBuffer.toArrayBuffer();
+    _mappedArrayBuffer = MappedArrayBuffer();
+  }
   return _uint8Array;
 }
 
 const Uint8Array& ArrayBufferView::uint8Array() const
 {
+  if (_mappedArrayBuffer && _uint8Array.size() != _mappedArrayBuffer.byteLength()) {
+    _uint8Array = _mappedArrayBuffer.toArrayBuffer();
+  }
   return _uint8Array;
 }
 
 Int16Array ArrayBufferView::int16Array() const
 {
-  return stl_util::to_array<int16_t>(_uint8Array);
+  return _toTypedArray<int16_t>();
 }
 
 Uint16Array ArrayBufferView::uint16Array() const
 {
-  return stl_util::to_array<uint16_t>(_uint8Array);
+  return _toTypedArray<uint16_t>();
 }
 
 Int32Array ArrayBufferView::int32Array() const
 {
-  return stl_util::to_array<int32_t>(_uint8Array);
+  return _toTypedArray<int32_t>();
 }
 
 Uint32Array ArrayBufferView::uint32Array() const
 {
-  return stl_util::to_array<uint32_t>(_uint8Array);
+  return _toTypedArray<uint32_t>();
 }
 
 Float32Array ArrayBufferView::float32Array() const
 {
-  return stl_util::to_array<float>(_uint8Array);
+  return _toTypedArray<float>();
 }
 
 } // end of namespace BABYLON
@@ -0,0 +1,193 @@
+#include <babylon/core/mapped_array_buffer.h>
+
+#include <babylon/core/filesystem.h>
+
+#if (defined(__unix__) || defined(__APPLE__)) && !defined(__EMSCRIPTEN__)
+#define BABYLON_HAS_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#elif defined(_WIN32)
+#define BABYLON_HAS_MAPVIEWOFFILE
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#endif
+
+namespace BABYLON {
+
+struct MappedArrayBuffer::Storage {
+  ArrayBuffer heapBuffer;
+  const uint8_t* mappedData = nullptr;
+  size_t mappedLength       = 0;
+#ifdef BABYLON_HAS_MAPVIEWOFFILE
+  HANDLE fileHandle    = INVALID_HANDLE_VALUE;
+  HANDLE mappingHandle = nullptr;
+#endif
+
+  Storage() = default;
+  Storage(const Storage&) = delete;
+  Storage& operator=(const Storage&) = delete;
+
+  ~Storage()
+  {
+    if (!mappedData) {
+      return;
+    }
+#if defined(BABYLON_HAS_MMAP)
+    ::munmap(const_cast<uint8_t*>(mappedData), mappedLength);
+#elif defined(BABYLON_HAS_MAPVIEWOFFILE)
+    ::UnmapViewOfFile(mappedData);
+    ::CloseHandle(mappingHandle);
+    ::CloseHandle(fileHandle);
+#endif
+  }
+
+  [[nodiscard]] const uint8_t* data() const
+  {
+    return mappedData ? mappedData : heapBuffer.data();
+  }
+
+  [[nodiscard]] size_t size() const
+  {
+    return mappedData ? mappedLength : heapBuffer.size();
+  }
+};
+
+std::shared_ptr<MappedArrayBuffer::Storage> MappedArrayBuffer::_MapFile(const std::string& filename)
+{
+#if defined(BABYLON_HAS_MMAP)
+  const int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return nullptr;
+  }
+  struct stat fileStat;
+  if (::fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0) {
+    ::close(fd);
+    return nullptr;
+  }
+  const auto length = static_cast<size_t>(fileStat.st_size);
+  void* address     = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+  // The mapping keeps its own reference to the file
+  ::close(fd);
+  if (address == MAP_FAILED) {
+    return nullptr;
+  }
+  ::madvise(address, length, MADV_WILLNEED);
+  auto storage          = std::make_shared<Storage>();
+  storage->mappedData   = static_cast<const uint8_t*>(address);
+  storage->mappedLength = length;
+  return storage;
+#elif defined(BABYLON_HAS_MAPVIEWOFFILE)
+  HANDLE fileHandle = ::CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (fileHandle == INVALID_HANDLE_VALUE) {
+    return nullptr;
+  }
+  LARGE_INTEGER fileSize;
+  if (!::GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart <= 0) {
+    ::CloseHandle(fileHandle);
+    return nullptr;
+  }
+  HANDLE mappingHandle = ::CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (!mappingHandle) {
+    ::CloseHandle(fileHandle);
+    return nullptr;
+  }
+  void* address = ::MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+  if (!address) {
+    ::CloseHandle(mappingHandle);
+    ::CloseHandle(fileHandle);
+    return nullptr;
+  }
+  auto storage           = std::make_shared<Storage>();
+  storage->mappedData    = static_cast<const uint8_t*>(address);
+  storage->mappedLength  = static_cast<size_t>(fileSize.QuadPart);
+  storage->fileHandle    = fileHandle;
+  storage->mappingHandle = mappingHandle;
+  return storage;
+#else
+  (void)filename;
+  return nullptr;
+#endif
+}
+
+MappedArrayBuffer MappedArrayBuffer::FromFile(const std::string& filename)
+{
+  if (auto storage = _MapFile(filename)) {
+    const auto length = storage->size();
+    return MappedArrayBuffer(storage, 0, length);
+  }
+
+  // No memory mapping available (or empty file): read it on the heap
+  if (!Filesystem::isFile(filename)) {
+    return MappedArrayBuffer();
+  }
+  return MappedArrayBuffer(Filesystem::readBinaryFile(filename.c_str()));
+}
+
+MappedArrayBuffer::MappedArrayBuffer() : _storage{nullptr}, _byteOffset{0}, _byteLength{0}
+{
+}
+
+MappedArrayBuffer::MappedArrayBuffer(ArrayBuffer&& buffer)
+    : _storage{nullptr}, _byteOffset{0}, _byteLength{buffer.size()}
+{
+  auto storage        = std::make_shared<Storage>();
+  storage->heapBuffer = std::move(buffer);
+  _storage            = std::move(storage);
+}
+
+MappedArrayBuffer::MappedArrayBuffer(const std::shared_ptr<const Storage>& storage,
+                                     size_t byteOffset, size_t byteLength)
+    : _storage{storage}, _byteOffset{byteOffset}, _byteLength{byteLength}
+{
+}
+
+MappedArrayBuffer::MappedArrayBuffer(const MappedArrayBuffer& other) = default;
+
+MappedArrayBuffer::MappedArrayBuffer(MappedArrayBuffer&& other) = default;
+
+MappedArrayBuffer& MappedArrayBuffer::operator=(const MappedArrayBuffer& other) = default;
+
+MappedArrayBuffer& MappedArrayBuffer::operator=(MappedArrayBuffer&& other) = default;
+
+MappedArrayBuffer::~MappedArrayBuffer() = default;
+
+MappedArrayBuffer MappedArrayBuffer::slice(size_t byteOffset, size_t byteLength) const
+{
+  if (byteOffset + byteLength > _byteLength) {
+    throw std::out_of_range("MappedArrayBuffer: slice out of range");
+  }
+  return MappedArrayBuffer(_storage, _byteOffset + byteOffset, byteLength);
+}
+
+const uint8_t* MappedArrayBuffer::data() const
+{
+  return _storage ? _storage->data() + _byteOffset : nullptr;
+}
+
+size_t MappedArrayBuffer::byteLength() const
+{
+  return _byteLength;
+}
+
+bool MappedArrayBuffer::isMemoryMapped() const
+{
+  return _storage && _storage->mappedData != nullptr;
+}
+
+MappedArrayBuffer::operator bool() const
+{
+  return _byteLength > 0;
+}
+
+ArrayBuffer MappedArrayBuffer::toArrayBuffer() const
+{
+  const auto* begin = data();
+  return begin ? ArrayBuffer(begin, begin + _byteLength) : ArrayBuffer();
+}
+
+} // end of namespace BABYLON
@@ -6,8 +6,12 @@
 
 namespace BABYLON {
 
-std::array<Vector3, 3> BoundingBox::TmpVector3{Vector3::Zero(), Vector3::Zero(),
-                                               Vector3::Zero()};
+namespace {
+
+// Thread local so that bounding infos can be updated from the active meshes evaluation workers
+thread_local std::array<Vector3, 3> TmpVector3{Vector3::Zero(), Vector3::Zero(), Vector3::Zero()};
+
+} // end of anonymous namespace
 
 BoundingBox::BoundingBox(const Vector3& min, const Vector3& max,
                          const std::optional<Matrix>& worldMatrix)
@@ -126,7 +130,7 @@ BoundingBox::~BoundingBox() = default;
 
 BoundingBox& BoundingBox::scale(float factor)
 {
-  auto& tmpVectors = BoundingBox::TmpVector3;
+  auto& tmpVectors = TmpVector3;
   auto& diff       = maximum.subtractToRef(minimum, tmpVectors[0]);
   const auto len   = diff.length();
   diff.normalizeFromLength(len);
@@ -262,7 +266,7 @@ bool BoundingBox::IntersectsSphere(const Vector3& minPoint,
                                    const Vector3& sphereCenter,
                                    float sphereRadius)
 {
-  auto& vector = BoundingBox::TmpVector3[0];
+  auto& vector = TmpVector3[0];
   Vector3::ClampToRef(sphereCenter, minPoint, maxPoint, vector);
   const auto num = Vector3::DistanceSquared(sphereCenter, vector);
   return (num <= (sphereRadius * sphereRadius));
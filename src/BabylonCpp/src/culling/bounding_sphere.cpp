@@ -7,8 +7,12 @@
 
 namespace BABYLON {
 
-std::array<Vector3, 3> BoundingSphere::TmpVector3{
-  Vector3::Zero(), Vector3::Zero(), Vector3::Zero()};
+namespace {
+
+// Per thread scratch vectors
+thread_local std::array<Vector3, 3> TmpVector3{Vector3::Zero(), Vector3::Zero(), Vector3::Zero()};
+
+} // end of anonymous namespace
 
 BoundingSphere::BoundingSphere(const Vector3& min, const Vector3& max,
                                const std::optional<Matrix>& worldMatrix)
@@ -47,7 +51,7 @@ void BoundingSphere::reConstruct(const Vector3& min, Vector3 max,
 BoundingSphere& BoundingSphere::scale(float factor)
 {
   const auto newRadius   = radius * factor;
-  auto& tmpVectors       = BoundingSphere::TmpVector3;
+  auto& tmpVectors       = TmpVector3;
   auto& tempRadiusVector = tmpVectors[0].setAll(newRadius);
   auto& min = center.subtractToRef(tempRadiusVector, tmpVectors[1]);
   auto& max = center.addToRef(tempRadiusVector, tmpVectors[2]);
@@ -66,7 +70,7 @@ void BoundingSphere::_update(Matrix worldMatrix)
 {
   if (!worldMatrix.isIdentity()) {
     Vector3::TransformCoordinatesToRef(center, worldMatrix, centerWorld);
-    auto& tempVector = BoundingSphere::TmpVector3[0];
+    auto& tempVector = TmpVector3[0];
     Vector3::TransformNormalFromFloatsToRef(1.f, 1.f, 1.f, worldMatrix,
                                             tempVector);
     radiusWorld
@@ -0,0 +1,198 @@
+#include <babylon/culling/bvh/bvh.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <tuple>
+
+namespace BABYLON {
+
+BVHBounds BVHBounds::Empty()
+{
+  const auto infinity = std::numeric_limits<float>::infinity();
+  return BVHBounds{{infinity, infinity, infinity}, {-infinity, -infinity, -infinity}};
+}
+
+BVHBounds BVHBounds::FromMinMax(const Vector3& minimum, const Vector3& maximum)
+{
+  return BVHBounds{{minimum.x, minimum.y, minimum.z}, {maximum.x, maximum.y, maximum.z}};
+}
+
+void BVHBounds::extend(const BVHBounds& other)
+{
+  for (unsigned int axis = 0; axis < 3; ++axis) {
+    minimum[axis] = std::min(minimum[axis], other.minimum[axis]);
+    maximum[axis] = std::max(maximum[axis], other.maximum[axis]);
+  }
+}
+
+bool BVHBounds::isEmpty() const
+{
+  return minimum[0] > maximum[0] || minimum[1] > maximum[1] || minimum[2] > maximum[2];
+}
+
+bool BVHBounds::operator==(const BVHBounds& other) const
+{
+  return minimum == other.minimum && maximum == other.maximum;
+}
+
+bool BVHBounds::operator!=(const BVHBounds& other) const
+{
+  return !(operator==(other));
+}
+
+BVH::BVH() = default;
+
+BVH::~BVH() = default;
+
+void BVH::build(const std::vector<BVHBounds>& primitiveBounds, size_t maxLeafSize)
+{
+  clear();
+
+  const auto nbPrimitives = primitiveBounds.size();
+  if (nbPrimitives == 0) {
+    return;
+  }
+
+  maxLeafSize      = std::max<size_t>(maxLeafSize, 1);
+  _primitiveBounds = primitiveBounds;
+  _primitives.resize(nbPrimitives);
+  std::iota(_primitives.begin(), _primitives.end(), 0u);
+  _primitiveLeaves.resize(nbPrimitives, 0u);
+
+  // Centers of the primitives, empty primitives are gathered at the origin
+  std::vector<std::array<float, 3>> centers(nbPrimitives);
+  for (size_t i = 0; i < nbPrimitives; ++i) {
+    const auto& bounds = primitiveBounds[i];
+    for (unsigned int axis = 0; axis < 3; ++axis) {
+      centers[i][axis]
+        = bounds.isEmpty() ? 0.f : (bounds.minimum[axis] + bounds.maximum[axis]) * 0.5f;
+    }
+  }
+
+  _nodes.reserve(2 * ((nbPrimitives + maxLeafSize - 1) / maxLeafSize));
+  _parents.reserve(_nodes.capacity());
+  _nodes.emplace_back(BVHNode{BVHBounds::Empty(), 0u, 0u});
+  _parents.emplace_back(0u);
+
+  // Node index and primitives range of the nodes to split
+  std::vector<std::tuple<uint32_t, uint32_t, uint32_t>> nodesToSplit{
+    {0u, 0u, static_cast<uint32_t>(nbPrimitives)}};
+  while (!nodesToSplit.empty()) {
+    const auto [nodeIndex, begin, end] = nodesToSplit.back();
+    nodesToSplit.pop_back();
+
+    auto bounds       = BVHBounds::Empty();
+    auto centerBounds = BVHBounds::Empty();
+    for (auto i = begin; i < end; ++i) {
+      const auto primitive = _primitives[i];
+      bounds.extend(primitiveBounds[primitive]);
+      centerBounds.extend(BVHBounds{centers[primitive], centers[primitive]});
+    }
+    _nodes[nodeIndex].bounds = bounds;
+
+    if (end - begin <= maxLeafSize) {
+      _nodes[nodeIndex].first = begin;
+      _nodes[nodeIndex].count = end - begin;
+      for (auto i = begin; i < end; ++i) {
+        _primitiveLeaves[_primitives[i]] = nodeIndex;
+      }
+      continue;
+    }
+
+    // Median split along the longest axis of the centers
+    unsigned int axis = 0;
+    for (unsigned int i = 1; i < 3; ++i) {
+      if (centerBounds.maximum[i] - centerBounds.minimum[i]
+          > centerBounds.maximum[axis] - centerBounds.minimum[axis]) {
+        axis = i;
+      }
+    }
+    const auto middle = begin + (end - begin) / 2;
+    std::nth_element(_primitives.begin() + begin, _primitives.begin() + middle,
+                     _primitives.begin() + end, [&centers, axis](uint32_t a, uint32_t b) {
+                       return centers[a][axis] < centers[b][axis];
+                     });
+
+    const auto firstChild   = static_cast<uint32_t>(_nodes.size());
+    _nodes[nodeIndex].first = firstChild;
+    _nodes[nodeIndex].count = 0u;
+    _nodes.emplace_back(BVHNode{BVHBounds::Empty(), 0u, 0u});
+    _nodes.emplace_back(BVHNode{BVHBounds::Empty(), 0u, 0u});
+    _parents.emplace_back(nodeIndex);
+    _parents.emplace_back(nodeIndex);
+    nodesToSplit.emplace_back(firstChild, begin, middle);
+    nodesToSplit.emplace_back(firstChild + 1, middle, end);
+  }
+}
+
+void BVH::clear()
+{
+  _nodes.clear();
+  _parents.clear();
+  _primitives.clear();
+  _primitiveLeaves.clear();
+  _primitiveBounds.clear();
+}
+
+void BVH::refit(size_t primitive, const BVHBounds& bounds)
+{
+  if (primitive >= _primitiveBounds.size() || _primitiveBounds[primitive] == bounds) {
+    return;
+  }
+  _primitiveBounds[primitive] = bounds;
+
+  // Leaf containing the primitive
+  auto nodeIndex  = _primitiveLeaves[primitive];
+  auto& leaf      = _nodes[nodeIndex];
+  auto leafBounds = BVHBounds::Empty();
+  for (auto i = leaf.first; i < leaf.first + leaf.count; ++i) {
+    leafBounds.extend(_primitiveBounds[_primitives[i]]);
+  }
+  if (leafBounds == leaf.bounds) {
+    return;
+  }
+  leaf.bounds = leafBounds;
+
+  // Ancestors, up to the first one whose bounds do not change
+  while (nodeIndex != 0) {
+    nodeIndex       = _parents[nodeIndex];
+    auto& node      = _nodes[nodeIndex];
+    auto nodeBounds = _nodes[node.first].bounds;
+    nodeBounds.extend(_nodes[node.first + 1].bounds);
+    if (nodeBounds == node.bounds) {
+      break;
+    }
+    node.bounds = nodeBounds;
+  }
+}
+
+size_t BVH::size() const
+{
+  return _primitives.size();
+}
+
+const BVHBounds& BVH::primitiveBounds(size_t primitive) const
+{
+  return _primitiveBounds[primitive];
+}
+
+const std::vector<BVHNode>& BVH::nodes() const
+{
+  return _nodes;
+}
+
+BVH::RayData BVH::_PrepareRay(const Ray& ray)
+{
+  RayData rayData;
+  const std::array<float, 3> direction{ray.direction.x, ray.direction.y, ray.direction.z};
+  rayData.origin = {ray.origin.x, ray.origin.y, ray.origin.z};
+  for (unsigned int axis = 0; axis < 3; ++axis) {
+    // Same threshold as Ray::intersectsBoxMinMax
+    rayData.parallel[axis]         = std::abs(direction[axis]) < 0.0000001f;
+    rayData.inverseDirection[axis] = rayData.parallel[axis] ? 0.f : 1.f / direction[axis];
+  }
+  return rayData;
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,115 @@
+#include <babylon/culling/bvh/picking_bvh.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <babylon/culling/bounding_info.h>
+#include <babylon/meshes/abstract_mesh.h>
+
+namespace BABYLON {
+
+PickingBVH::PickingBVH()
+    : _meshCount{0}, _refitCount{0}, _buildCount{0}, _needsRebuild{true}
+{
+}
+
+PickingBVH::~PickingBVH() = default;
+
+void PickingBVH::update(const std::vector<AbstractMeshPtr>& meshes)
+{
+  // Rebuild after a removal, when the added meshes become too many to be tested one by one, or
+  // when the refitted nodes have grown since the last build
+  const auto nbMeshes       = _meshes.size();
+  const auto maxAddedMeshes = std::max<size_t>(64, nbMeshes / 8);
+  if (_needsRebuild || meshes.size() < nbMeshes || meshes.size() - nbMeshes > maxAddedMeshes
+      || _refitCount > nbMeshes) {
+    _build(meshes);
+    return;
+  }
+  _meshCount = meshes.size();
+
+  for (size_t index = 0; index < nbMeshes; ++index) {
+    if (!_dirtyFlags[index]) {
+      continue;
+    }
+    _dirtyFlags[index] = 0;
+
+    const auto bounds = _GetBounds(_meshes[index]);
+    if (bounds != _bvh.primitiveBounds(index)) {
+      _bvh.refit(index, bounds);
+      ++_refitCount;
+    }
+  }
+}
+
+void PickingBVH::markDirty(AbstractMesh* mesh)
+{
+  const auto index = mesh->_pickingBVHIndex;
+  if (!_needsRebuild && index < _meshes.size() && _meshes[index] == mesh) {
+    _dirtyFlags[index] = 1;
+  }
+}
+
+void PickingBVH::markForRebuild()
+{
+  _needsRebuild = true;
+}
+
+size_t PickingBVH::buildCount() const
+{
+  return _buildCount;
+}
+
+void PickingBVH::_build(const std::vector<AbstractMeshPtr>& meshes)
+{
+  _meshes.resize(meshes.size());
+  _dirtyFlags.assign(meshes.size(), 0);
+
+  std::vector<BVHBounds> meshBounds(meshes.size());
+  for (size_t index = 0; index < meshes.size(); ++index) {
+    auto mesh              = meshes[index].get();
+    mesh->_pickingBVHIndex = index;
+    // Computes the world bounding box of the meshes never rendered, like the pick does
+    mesh->getWorldMatrix();
+    _meshes[index]         = mesh;
+    meshBounds[index]      = _GetBounds(mesh);
+  }
+  _bvh.build(meshBounds);
+
+  _meshCount    = meshes.size();
+  _refitCount   = 0;
+  _needsRebuild = false;
+  ++_buildCount;
+}
+
+BVHBounds PickingBVH::_GetBounds(AbstractMesh* mesh)
+{
+  const auto& boundingInfo = mesh->_boundingInfo;
+  if (!boundingInfo) {
+    return BVHBounds::Empty();
+  }
+
+  auto& boundingBox = boundingInfo->boundingBox;
+  auto bounds       = BVHBounds::FromMinMax(boundingBox.minimumWorld, boundingBox.maximumWorld);
+
+  // The intersection threshold of the line meshes is a margin in local space
+  const auto intersectionThreshold = mesh->_getIntersectionThreshold();
+  if (intersectionThreshold > 0.f) {
+    const auto& m = boundingBox.getWorldMatrix().m();
+    auto maxScale = 0.f;
+    for (unsigned int row = 0; row < 3; ++row) {
+      const auto scale = std::sqrt(m[row * 4] * m[row * 4] + m[row * 4 + 1] * m[row * 4 + 1]
+                                   + m[row * 4 + 2] * m[row * 4 + 2]);
+      maxScale         = std::max(maxScale, scale);
+    }
+    const auto margin = intersectionThreshold * maxScale;
+    for (unsigned int axis = 0; axis < 3; ++axis) {
+      bounds.minimum[axis] -= margin;
+      bounds.maximum[axis] += margin;
+    }
+  }
+
+  return bounds;
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,93 @@
+#include <babylon/culling/bvh/triangle_bvh.h>
+
+#include <algorithm>
+
+#include <babylon/collisions/intersection_info.h>
+
+namespace BABYLON {
+
+TriangleBVH::TriangleBVH(const std::vector<Vector3>& positions, const IndicesArray& indices)
+    : _indices{indices}
+{
+  const auto nbTriangles = _indices.size() / 3;
+  std::vector<BVHBounds> triangleBounds(nbTriangles, BVHBounds::Empty());
+  for (size_t triangle = 0; triangle < nbTriangles; ++triangle) {
+    auto& bounds = triangleBounds[triangle];
+    for (size_t index = triangle * 3; index < triangle * 3 + 3; ++index) {
+      // Triangles referencing missing vertices are never hit
+      if (_indices[index] >= positions.size()) {
+        bounds = BVHBounds::Empty();
+        break;
+      }
+      const auto& position = positions[_indices[index]];
+      bounds.extend(BVHBounds::FromMinMax(position, position));
+    }
+  }
+
+  _bvh.build(triangleBounds);
+}
+
+TriangleBVH::~TriangleBVH() = default;
+
+size_t TriangleBVH::triangleCount() const
+{
+  return _bvh.size();
+}
+
+const IndicesArray& TriangleBVH::indices() const
+{
+  return _indices;
+}
+
+std::optional<IntersectionInfo>
+TriangleBVH::intersects(Ray& ray, const std::vector<Vector3>& positions, size_t indexStart,
+                        size_t indexCount, bool fastCheck,
+                        const TrianglePickingPredicate& trianglePredicate) const
+{
+  std::optional<IntersectionInfo> intersectInfo = std::nullopt;
+
+  const auto indexEnd    = std::min(indexStart + indexCount, _indices.size());
+  const auto nbPositions = positions.size();
+  // Hits farther than the length of the ray are rejected by Ray::intersectsTriangle
+  auto maxDistance = ray.length;
+
+  _bvh.intersectsRay(ray, maxDistance, [&](uint32_t triangle) {
+    const auto index = static_cast<size_t>(triangle) * 3;
+    if (index < indexStart || index + 3 > indexEnd) {
+      return false;
+    }
+
+    const auto i0 = _indices[index], i1 = _indices[index + 1], i2 = _indices[index + 2];
+    if (i0 >= nbPositions || i1 >= nbPositions || i2 >= nbPositions) {
+      return false;
+    }
+
+    const auto& p0 = positions[i0];
+    const auto& p1 = positions[i1];
+    const auto& p2 = positions[i2];
+
+    if (trianglePredicate && !trianglePredicate(p0, p1, p2, ray)) {
+      return false;
+    }
+
+    const auto currentIntersectInfo = ray.intersectsTriangle(p0, p1, p2);
+    if (!currentIntersectInfo || currentIntersectInfo->distance < 0.f) {
+      return false;
+    }
+
+    // On equal distances, the first triangle in the index order wins like in SubMesh
+    const auto distance = currentIntersectInfo->distance;
+    if (fastCheck || !intersectInfo || distance < intersectInfo->distance
+        || (distance == intersectInfo->distance && triangle < intersectInfo->faceId)) {
+      intersectInfo         = currentIntersectInfo;
+      intersectInfo->faceId = triangle;
+      maxDistance           = distance;
+    }
+
+    return fastCheck;
+  });
+
+  return intersectInfo;
+}
+
+} // end of namespace BABYLON
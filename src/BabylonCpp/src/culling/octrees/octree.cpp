@@ -1,130 +1,361 @@
 #include <babylon/culling/octrees/octree.h>
 
-#include <babylon/babylon_stl_util.h>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
 #include <babylon/culling/bounding_box.h>
 #include <babylon/culling/bounding_info.h>
 #include <babylon/culling/octrees/octree_block.h>
+#include <babylon/culling/ray.h>
+#include <babylon/maths/plane.h>
 #include <babylon/maths/vector3.h>
 #include <babylon/meshes/abstract_mesh.h>
 #include <babylon/meshes/sub_mesh.h>
 
 namespace BABYLON {
 
+namespace {
+
+/**
+ * Returns a new selection id, the entries store the id of the last selection
+ * which contains them to avoid duplicates. The ids are shared by all octrees,
+ * an entry can be stored in several octrees.
+ */
+size_t NextSelectionId()
+{
+  static std::atomic<size_t> selectionId{0};
+  return ++selectionId;
+}
+
+} // end of anonymous namespace
+
 template <class T>
-Octree<T>::Octree() = default;
+Octree<T>::Octree() : maxDepth{2}, _maxBlockCapacity{64}
+{
+}
 
 template <class T>
-Octree<T>::Octree(
-  const std::function<void(T& entry, OctreeBlock<T>& block)>& creationFunc,
-  size_t maxBlockCapacity, size_t iMaxDepth)
-    : maxDepth{iMaxDepth}
-    , _maxBlockCapacity{maxBlockCapacity}
-    , _creationFunc{creationFunc}
+Octree<T>::Octree(const std::function<void(T& entry, OctreeBlock<T>& block)>& creationFunc,
+                  size_t maxBlockCapacity, size_t iMaxDepth)
+    : maxDepth{iMaxDepth}, _maxBlockCapacity{maxBlockCapacity}, _creationFunc{creationFunc}
 {
-  _selectionContent.resize(1024);
+  _selectionContent.reserve(1024);
 }
 
 template <class T>
 Octree<T>::~Octree() = default;
 
 template <class T>
-void Octree<T>::update(const Vector3& worldMin, const Vector3& worldMax,
-                       std::vector<T>& entries)
+void Octree<T>::update(const Vector3& worldMin, const Vector3& worldMax, std::vector<T>& entries)
 {
-  OctreeBlock<T>::_CreateBlocks(worldMin, worldMax, entries, _maxBlockCapacity,
-                                0, maxDepth, *this, _creationFunc);
+  IOctreeContainer<T>::blocks.clear();
+  _blocksBounds.clear();
+  _entryBlocks.clear();
+  _entryBlocks.reserve(entries.size());
+
+  _createBlocks(worldMin, worldMax, 1);
+  for (auto& entry : entries) {
+    addMesh(entry);
+  }
 }
 
 template <class T>
 void Octree<T>::addMesh(T& entry)
 {
-  for (auto& block : IOctreeContainer<T>::blocks) {
-    block.addEntry(entry);
+  if (IOctreeContainer<T>::blocks.empty()) {
+    return;
+  }
+
+  for (size_t i = 0; i < 8; ++i) {
+    _addEntry(i, entry);
   }
 }
 
 template <class T>
 void Octree<T>::removeMesh(T& entry)
 {
-  for (auto& block : IOctreeContainer<T>::blocks) {
-    block.removeEntry(entry);
+  auto it = _entryBlocks.find(entry);
+  if (it == _entryBlocks.end()) {
+    return;
   }
+
+  for (auto blockIndex : it->second) {
+    auto& entries = IOctreeContainer<T>::blocks[blockIndex].entries;
+    entries.erase(std::remove(entries.begin(), entries.end(), entry), entries.end());
+  }
+
+  _entryBlocks.erase(it);
 }
 
 template <class T>
-std::vector<T>& Octree<T>::select(const std::array<Plane, 6>& frustumPlanes,
-                                  bool allowDuplicate)
+void Octree<T>::updateMesh(T& entry)
 {
-  _selectionContent.clear();
+  removeMesh(entry);
+  addMesh(entry);
+}
 
-  for (auto& block : IOctreeContainer<T>::blocks) {
-    block.select(frustumPlanes, _selectionContent, allowDuplicate);
-  }
+template <class T>
+std::vector<T>& Octree<T>::select(const std::array<Plane, 6>& frustumPlanes, bool allowDuplicate)
+{
+  auto& allBlocks = IOctreeContainer<T>::blocks;
+
+  _selectionContent.clear();
+  const auto selectionId = allowDuplicate ? 0 : NextSelectionId();
 
-  if (allowDuplicate) {
-    stl_util::concat(_selectionContent, dynamicContent);
+  std::array<float, 8> intersections;
+  _blocksToVisit.clear();
+  if (!allBlocks.empty()) {
+    _blocksToVisit.emplace_back(0);
   }
-  else {
-    stl_util::concat_with_no_duplicates(_selectionContent, dynamicContent);
+  while (!_blocksToVisit.empty()) {
+    const auto blocksStart = _blocksToVisit.back();
+    _blocksToVisit.pop_back();
+    _IntersectsFrustum(_blocksBounds[blocksStart / 8], frustumPlanes, intersections);
+    for (size_t i = 0; i < 8; ++i) {
+      if (intersections[i] != 0.f) {
+        const auto& block = allBlocks[blocksStart + i];
+        if (block.hasInnerBlocks()) {
+          _blocksToVisit.emplace_back(block.innerBlocksStart());
+        }
+        else {
+          _appendEntries(block.entries, selectionId);
+        }
+      }
+    }
   }
 
+  _appendEntries(dynamicContent, selectionId);
+
   return _selectionContent;
 }
 
 template <class T>
-std::vector<T>& Octree<T>::intersects(const Vector3& sphereCenter,
-                                      float sphereRadius, bool allowDuplicate)
+std::vector<T>& Octree<T>::intersects(const Vector3& sphereCenter, float sphereRadius,
+                                      bool allowDuplicate)
 {
-  _selectionContent.clear();
+  auto& allBlocks = IOctreeContainer<T>::blocks;
 
-  for (auto& block : IOctreeContainer<T>::blocks) {
-    block.intersects(sphereCenter, sphereRadius, _selectionContent,
-                     allowDuplicate);
-  }
+  _selectionContent.clear();
+  const auto selectionId = allowDuplicate ? 0 : NextSelectionId();
 
-  if (allowDuplicate) {
-    stl_util::concat(_selectionContent, dynamicContent);
+  std::array<float, 8> intersections;
+  _blocksToVisit.clear();
+  if (!allBlocks.empty()) {
+    _blocksToVisit.emplace_back(0);
   }
-  else {
-    stl_util::concat_with_no_duplicates(_selectionContent, dynamicContent);
+  while (!_blocksToVisit.empty()) {
+    const auto blocksStart = _blocksToVisit.back();
+    _blocksToVisit.pop_back();
+    _IntersectsSphere(_blocksBounds[blocksStart / 8], sphereCenter, sphereRadius, intersections);
+    for (size_t i = 0; i < 8; ++i) {
+      if (intersections[i] != 0.f) {
+        const auto& block = allBlocks[blocksStart + i];
+        if (block.hasInnerBlocks()) {
+          _blocksToVisit.emplace_back(block.innerBlocksStart());
+        }
+        else {
+          _appendEntries(block.entries, selectionId);
+        }
+      }
+    }
   }
 
+  _appendEntries(dynamicContent, selectionId);
+
   return _selectionContent;
 }
 
 template <class T>
 std::vector<T>& Octree<T>::intersectsRay(const Ray& ray)
 {
+  auto& allBlocks = IOctreeContainer<T>::blocks;
+
   _selectionContent.clear();
+  const auto selectionId = NextSelectionId();
 
-  for (auto& block : IOctreeContainer<T>::blocks) {
-    block.intersectsRay(ray, _selectionContent);
+  _blocksToVisit.clear();
+  if (!allBlocks.empty()) {
+    _blocksToVisit.emplace_back(0);
+  }
+  while (!_blocksToVisit.empty()) {
+    const auto blocksStart = _blocksToVisit.back();
+    _blocksToVisit.pop_back();
+    for (size_t i = 0; i < 8; ++i) {
+      auto& block = allBlocks[blocksStart + i];
+      if (ray.intersectsBoxMinMax(block.minPoint(), block.maxPoint())) {
+        if (block.hasInnerBlocks()) {
+          _blocksToVisit.emplace_back(block.innerBlocksStart());
+        }
+        else {
+          _appendEntries(block.entries, selectionId);
+        }
+      }
+    }
   }
 
-  stl_util::concat_with_no_duplicates(_selectionContent, dynamicContent);
+  _appendEntries(dynamicContent, selectionId);
 
   return _selectionContent;
 }
 
 template <class T>
-void Octree<T>::CreationFuncForMeshes(AbstractMesh* entry,
-                                      OctreeBlock<AbstractMesh*>& block)
+size_t Octree<T>::_createBlocks(const Vector3& worldMin, const Vector3& worldMax, size_t depth)
+{
+  auto& allBlocks = IOctreeContainer<T>::blocks;
+
+  const auto blocksStart = allBlocks.size();
+  Vector3 blockSize((worldMax.x - worldMin.x) / 2.f, (worldMax.y - worldMin.y) / 2.f,
+                    (worldMax.z - worldMin.z) / 2.f);
+  BlocksBounds bounds;
+
+  // Segmenting space
+  size_t i = 0;
+  for (int x = 0; x < 2; ++x) {
+    for (int y = 0; y < 2; ++y) {
+      for (int z = 0; z < 2; ++z) {
+        const auto localMin = worldMin.add(
+          blockSize.multiplyByFloats(static_cast<float>(x), static_cast<float>(y),
+                                     static_cast<float>(z)));
+        const auto localMax = worldMin.add(
+          blockSize.multiplyByFloats(static_cast<float>(x) + 1.f, static_cast<float>(y) + 1.f,
+                                     static_cast<float>(z) + 1.f));
+        allBlocks.emplace_back(
+          OctreeBlock<T>(localMin, localMax, _maxBlockCapacity, depth, maxDepth));
+
+        bounds.centerX[i] = (localMin.x + localMax.x) / 2.f;
+        bounds.centerY[i] = (localMin.y + localMax.y) / 2.f;
+        bounds.centerZ[i] = (localMin.z + localMax.z) / 2.f;
+        bounds.extendX[i] = (localMax.x - localMin.x) / 2.f;
+        bounds.extendY[i] = (localMax.y - localMin.y) / 2.f;
+        bounds.extendZ[i] = (localMax.z - localMin.z) / 2.f;
+        ++i;
+      }
+    }
+  }
+
+  _blocksBounds.emplace_back(bounds);
+
+  return blocksStart;
+}
+
+template <class T>
+void Octree<T>::_createInnerBlocks(size_t blockIndex)
+{
+  auto& allBlocks = IOctreeContainer<T>::blocks;
+
+  // The blocks storage grows, the block is accessed by index only
+  const auto minPoint = allBlocks[blockIndex].minPoint();
+  const auto maxPoint = allBlocks[blockIndex].maxPoint();
+  const auto depth    = allBlocks[blockIndex].depth();
+  auto entries        = std::move(allBlocks[blockIndex].entries);
+  allBlocks[blockIndex].entries.clear();
+
+  const auto innerBlocksStart          = _createBlocks(minPoint, maxPoint, depth + 1);
+  allBlocks[blockIndex]._innerBlocksStart = innerBlocksStart;
+
+  // Move the content to the inner blocks
+  for (auto& entry : entries) {
+    auto& entryBlocks = _entryBlocks[entry];
+    entryBlocks.erase(std::remove(entryBlocks.begin(), entryBlocks.end(), blockIndex),
+                      entryBlocks.end());
+    for (size_t i = 0; i < 8; ++i) {
+      _addEntry(innerBlocksStart + i, entry);
+    }
+  }
+}
+
+template <class T>
+void Octree<T>::_addEntry(size_t blockIndex, T& entry)
+{
+  auto& allBlocks = IOctreeContainer<T>::blocks;
+
+  if (allBlocks[blockIndex].hasInnerBlocks()) {
+    const auto innerBlocksStart = allBlocks[blockIndex].innerBlocksStart();
+    for (size_t i = 0; i < 8; ++i) {
+      _addEntry(innerBlocksStart + i, entry);
+    }
+    return;
+  }
+
+  auto& block            = allBlocks[blockIndex];
+  const auto entriesSize = block.entries.size();
+  _creationFunc(entry, block);
+  if (block.entries.size() == entriesSize) {
+    return;
+  }
+
+  _entryBlocks[entry].emplace_back(blockIndex);
+
+  if (block.mustBeSubdivided()) {
+    _createInnerBlocks(blockIndex);
+  }
+}
+
+template <class T>
+void Octree<T>::_appendEntries(const std::vector<T>& entries, size_t selectionId)
+{
+  if (selectionId == 0) {
+    _selectionContent.insert(_selectionContent.end(), entries.begin(), entries.end());
+    return;
+  }
+
+  for (const auto& entry : entries) {
+    if (entry->_octreeSelectionId != selectionId) {
+      entry->_octreeSelectionId = selectionId;
+      _selectionContent.emplace_back(entry);
+    }
+  }
+}
+
+template <class T>
+void Octree<T>::_IntersectsFrustum(const BlocksBounds& bounds,
+                                   const std::array<Plane, 6>& frustumPlanes,
+                                   std::array<float, 8>& result)
+{
+  // A block is outside of the frustum when its farthest corner along the
+  // normal of a plane is behind this plane
+  result.fill(1.f);
+  for (const auto& plane : frustumPlanes) {
+    const auto nx = plane.normal.x, ny = plane.normal.y, nz = plane.normal.z;
+    const auto ax = std::abs(nx), ay = std::abs(ny), az = std::abs(nz);
+    for (size_t i = 0; i < 8; ++i) {
+      const auto distance
+        = nx * bounds.centerX[i] + ny * bounds.centerY[i] + nz * bounds.centerZ[i] + plane.d;
+      const auto radius = ax * bounds.extendX[i] + ay * bounds.extendY[i] + az * bounds.extendZ[i];
+      result[i]         = distance + radius < 0.f ? 0.f : result[i];
+    }
+  }
+}
+
+template <class T>
+void Octree<T>::_IntersectsSphere(const BlocksBounds& bounds, const Vector3& sphereCenter,
+                                  float sphereRadius, std::array<float, 8>& result)
+{
+  const auto radiusSquared = sphereRadius * sphereRadius;
+  for (size_t i = 0; i < 8; ++i) {
+    const auto dx = std::max(std::abs(sphereCenter.x - bounds.centerX[i]) - bounds.extendX[i], 0.f);
+    const auto dy = std::max(std::abs(sphereCenter.y - bounds.centerY[i]) - bounds.extendY[i], 0.f);
+    const auto dz = std::max(std::abs(sphereCenter.z - bounds.centerZ[i]) - bounds.extendZ[i], 0.f);
+    result[i]     = dx * dx + dy * dy + dz * dz <= radiusSquared ? 1.f : 0.f;
+  }
+}
+
+template <class T>
+void Octree<T>::CreationFuncForMeshes(AbstractMesh* entry, OctreeBlock<AbstractMesh*>& block)
 {
   const auto boundingInfo = entry->getBoundingInfo();
   if (!entry->isBlocked()
-      && boundingInfo->boundingBox.intersectsMinMax(block.minPoint(),
-                                                    block.maxPoint())) {
+      && boundingInfo->boundingBox.intersectsMinMax(block.minPoint(), block.maxPoint())) {
     block.entries.emplace_back(entry);
   }
 }
 
 template <class T>
-void Octree<T>::CreationFuncForSubMeshes(SubMesh* entry,
-                                         OctreeBlock<SubMesh*>& block)
+void Octree<T>::CreationFuncForSubMeshes(SubMesh* entry, OctreeBlock<SubMesh*>& block)
 {
   const auto boundingInfo = entry->getBoundingInfo();
-  if (boundingInfo->boundingBox.intersectsMinMax(block.minPoint(),
-                                                 block.maxPoint())) {
+  if (boundingInfo->boundingBox.intersectsMinMax(block.minPoint(), block.maxPoint())) {
     block.entries.emplace_back(entry);
   }
 }
@@ -18,6 +18,7 @@
 #include <babylon/materials/textures/render_target_texture.h>
 #include <babylon/meshes/webgl/webgl_data_buffer.h>
 #include <babylon/misc/string_tools.h>
+#include <babylon/misc/texture_pipeline.h>
 #include <babylon/postprocesses/post_process.h>
 #include <babylon/postprocesses/post_process_manager.h>
 #include <babylon/states/depth_culling_state.h>
@@ -1208,6 +1209,14 @@ void Engine::displayLoadingUI()
   const auto iLoadingScreen = loadingScreen();
   if (iLoadingScreen) {
     iLoadingScreen->displayLoadingUI();
+    const auto pipeline = texturePipeline();
+    if (pipeline && !_loadingScreenTextureTimingObserver) {
+      _loadingScreenTexturePipeline       = pipeline;
+      _loadingScreenTextureTimingObserver = pipeline->onImageUploadedObservable.add(
+        [iLoadingScreen](TextureLoadTiming* timing, EventState& /*es*/) {
+          iLoadingScreen->reportTextureLoadTiming(*timing);
+        });
+    }
   }
 }
 
@@ -1217,6 +1226,12 @@ void Engine::hideLoadingUI()
   if (iLoadingScreen) {
     iLoadingScreen->hideLoadingUI();
   }
+  if (_loadingScreenTextureTimingObserver) {
+    _loadingScreenTexturePipeline->onImageUploadedObservable.remove(
+      _loadingScreenTextureTimingObserver);
+    _loadingScreenTexturePipeline       = nullptr;
+    _loadingScreenTextureTimingObserver = nullptr;
+  }
 }
 
 ILoadingScreenPtr& Engine::get_loadingScreen()
@@ -44,6 +44,7 @@ Node::Node(const std::string& iName, Scene* scene)
     , onReady{nullptr}
     , _currentRenderId{-1}
     , _childUpdateId{-1}
+    , _transformUpdateId{-1}
     , _worldMatrix{Matrix::Identity()}
     , _worldMatrixDeterminant{0.f}
     , _worldMatrixDeterminantIsDirty{true}
@@ -332,6 +333,11 @@ bool Node::isSynchronizedWithParent() const
     return false;
   }
 
+  // No need to walk up the hierarchy again
+  if (_parentNode->_isValidatedByTransformUpdate()) {
+    return true;
+  }
+
   return _parentNode->isSynchronized();
 }
 
@@ -349,6 +355,11 @@ bool Node::isSynchronized()
   return _isSynchronized();
 }
 
+bool Node::_isValidatedByTransformUpdate() const
+{
+  return _scene->_transformUpdateId != -1 && _transformUpdateId == _scene->_transformUpdateId;
+}
+
 bool Node::isReady(bool /*completeCheck*/, bool /*forceInstanceSupport*/)
 {
   return _isReady;
@@ -84,6 +84,13 @@ WebGLDataBufferPtr NullEngine::createVertexBuffer(const Float32Array& /*vertices
   return buffer;
 }
 
+WebGLDataBufferPtr NullEngine::createVertexBuffer(const ArrayBufferView& /*vertices*/)
+{
+  auto buffer        = std::make_shared<WebGLDataBuffer>(nullptr);
+  buffer->references = 1;
+  return buffer;
+}
+
 WebGLDataBufferPtr NullEngine::createIndexBuffer(const IndicesArray& /*indices*/,
                                                  bool /*updatable*/)
 {
@@ -142,9 +149,10 @@ NullEngine::getUniforms(const IPipelineContextPtr& /*pipelineContext*/,
 }
 
 Int32Array NullEngine::getAttributes(const IPipelineContextPtr& /*pipelineContext*/,
-                                     const std::vector<std::string>& /*attributesNames*/)
+                                     const std::vector<std::string>& attributesNames)
 {
-  return {};
+  // One (unbound) location per attribute, as the effects index the result by attribute
+  return Int32Array(attributesNames.size(), -1);
 }
 
 void NullEngine::bindSamplers(Effect& /*effect*/)
@@ -232,6 +240,11 @@ void NullEngine::setMatrices(const WebGLUniformLocationPtr& /*uniform*/,
 {
 }
 
+void NullEngine::setMatrix4x4(const WebGLUniformLocationPtr& /*uniform*/,
+                              const std::array<float, 16>& /*matrix*/)
+{
+}
+
 void NullEngine::setMatrix3x3(const WebGLUniformLocationPtr& /*uniform*/,
                               const Float32Array& /*matrix*/)
 {
@@ -277,10 +290,25 @@ void NullEngine::setAlphaMode(unsigned int mode, bool noDepthWriteChange)
   _alphaMode = mode;
 }
 
-void NullEngine::bindBuffers(
-  const std::unordered_map<std::string, VertexBufferPtr>& /*vertexBuffers*/,
-  const WebGLDataBufferPtr& /*indexBuffer*/, const EffectPtr& /*effect*/)
+void NullEngine::bindBuffers(const std::unordered_map<std::string, VertexBufferPtr>& vertexBuffers,
+                             const WebGLDataBufferPtr& indexBuffer, const EffectPtr& effect)
 {
+  // Only keep track of the binding cache, there is no context to bind the buffers to
+  _resolveVertexBuffers(vertexBuffers, effect);
+  if (_updateVertexBuffersCache(effect)) {
+    ++_vertexBuffersBindingCount;
+  }
+  _cachedIndexBuffer = indexBuffer;
+}
+
+void NullEngine::bindBuffers(const std::vector<VertexBufferPtr>& vertexBuffersBySlot,
+                             const WebGLDataBufferPtr& indexBuffer, const EffectPtr& effect)
+{
+  _resolveVertexBuffers(vertexBuffersBySlot, effect);
+  if (_updateVertexBuffersCache(effect)) {
+    ++_vertexBuffersBindingCount;
+  }
+  _cachedIndexBuffer = indexBuffer;
 }
 
 void NullEngine::wipeCaches(bool bruteForce)
@@ -299,9 +327,9 @@ void NullEngine::wipeCaches(bool bruteForce)
     alphaState()->reset();
   }
 
-  _cachedVertexBuffers          = nullptr;
-  _cachedIndexBuffer            = nullptr;
-  _cachedEffectForVertexBuffers = nullptr;
+  _cachedVertexBuffers = nullptr;
+  _cachedIndexBuffer   = nullptr;
+  _clearVertexBuffersCache();
 }
 
 void NullEngine::draw(bool /*useTriangles*/, int /*indexStart*/, int /*indexCount*/,
@@ -517,7 +545,7 @@ void NullEngine::_bindTexture(int channel, const InternalTexturePtr& texture)
   _bindTextureDirectly(0, texture);
 }
 
-void NullEngine::_deleteBuffer(GL::IGLBuffer* /*buffer*/)
+void NullEngine::_deleteBuffer(const WebGLDataBufferPtr& /*buffer*/)
 {
 }
 
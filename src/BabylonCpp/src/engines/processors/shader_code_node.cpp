@@ -34,10 +34,10 @@ std::string ShaderCodeNode::process(std::unordered_map<std::string, std::string>
       }
       else if (/* (processor->uniformProcessor || processor->uniformBufferProcessor) && */
                StringTools::startsWith(line, "uniform")) {
-        auto reSearch = "uniform (.+) (.+)";
-        std::regex regex(reSearch, std::regex::optimize);
-
-        if (std::regex_search(line, regex)) { // uniform
+        // "uniform type name", the uniform buffers are declared as "uniform Name"
+        const auto typeEnd = line.find(' ', 9);
+        if (line.size() > 8 && line[7] == ' ' && typeEnd != std::string::npos
+            && typeEnd + 1 < line.size()) { // uniform
           /* if (processor->uniformProcessor) */ {
             value = processor->uniformProcessor(line, options.isFragment);
           }
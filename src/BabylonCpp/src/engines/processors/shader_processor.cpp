@@ -1,5 +1,9 @@
 #include <babylon/engines/processors/shader_processor.h>
 
+#include <array>
+#include <optional>
+#include <sstream>
+
 #include <babylon/babylon_stl_util.h>
 #include <babylon/engines/processors/expressions/operators/shader_define_and_operator.h>
 #include <babylon/engines/processors/expressions/operators/shader_define_arithmetic_operator.h>
@@ -17,14 +21,184 @@
 
 namespace BABYLON {
 
+namespace {
+
+/**
+ * Location and parts of an "#include<file>(search,replace,...)[min..max]" directive
+ */
+struct IncludeDirective {
+  size_t start{0};
+  size_t end{0};
+  std::string file{};
+  bool hasReplacements{false};
+  std::string replacements{};
+  bool hasIndex{false};
+  std::string indexString{};
+}; // end of struct IncludeDirective
+
+size_t LineEnd(const std::string& source, size_t from)
+{
+  const auto end = source.find_first_of("\r\n", from);
+  return end == std::string::npos ? source.size() : end;
+}
+
+/**
+ * Finds the next include directive, the delimiters are searched greedily up to the end of the
+ * line, same as the "#include<(.+)>(\((.*)\))*(\[(.*)\])*" expression.
+ */
+bool FindIncludeDirective(const std::string& source, size_t from, IncludeDirective& directive)
+{
+  static const std::string includeToken = "#include<";
+
+  for (auto start = source.find(includeToken, from); start != std::string::npos;
+       start      = source.find(includeToken, start + 1)) {
+    const auto fileStart = start + includeToken.size();
+    const auto lineEnd   = LineEnd(source, fileStart);
+    const auto fileEnd   = source.rfind('>', lineEnd - 1);
+    if (lineEnd == fileStart || fileEnd == std::string::npos || fileEnd <= fileStart) {
+      continue;
+    }
+
+    directive.start           = start;
+    directive.file            = source.substr(fileStart, fileEnd - fileStart);
+    directive.hasReplacements = false;
+    directive.hasIndex        = false;
+    auto cursor               = fileEnd + 1;
+
+    if (cursor < lineEnd && source[cursor] == '(') {
+      const auto closing = source.rfind(')', lineEnd - 1);
+      if (closing != std::string::npos && closing > cursor) {
+        directive.hasReplacements = true;
+        directive.replacements    = source.substr(cursor + 1, closing - cursor - 1);
+        cursor                    = closing + 1;
+      }
+    }
+
+    if (cursor < lineEnd && source[cursor] == '[') {
+      const auto closing = source.rfind(']', lineEnd - 1);
+      if (closing != std::string::npos && closing > cursor) {
+        directive.hasIndex    = true;
+        directive.indexString = source.substr(cursor + 1, closing - cursor - 1);
+        cursor                = closing + 1;
+      }
+    }
+
+    directive.end = cursor;
+    return true;
+  }
+
+  return false;
+}
+
+/**
+ * Returns the first preprocessor keyword found in the line, with the priorities of the
+ * "(#ifdef)|(#else)|(#elif)|(#endif)|(#ifndef)|(#if)" expression.
+ */
+std::string ExtractKeyword(const std::string& line)
+{
+  static const std::array<std::string, 6> keywords{
+    {"#ifdef", "#else", "#elif", "#endif", "#ifndef", "#if"}};
+
+  for (auto pos = line.find('#'); pos != std::string::npos; pos = line.find('#', pos + 1)) {
+    for (const auto& keyword : keywords) {
+      if (line.compare(pos, keyword.size(), keyword) == 0) {
+        return keyword;
+      }
+    }
+  }
+
+  return "";
+}
+
+/**
+ * Returns whether the replacement pattern of an include can be replaced as a plain string
+ */
+bool IsLiteralPattern(const std::string& pattern)
+{
+  return pattern.find_first_of("\\^$.|?*+()[]{}") == std::string::npos;
+}
+
+} // end of anonymous namespace
+
+std::unordered_map<std::string, ShaderProcessor::_ProcessedCode>
+  ShaderProcessor::_ProcessedCodeCache;
+std::deque<std::string> ShaderProcessor::_ProcessedCodeCacheKeys;
+std::mutex ShaderProcessor::_ProcessedCodeCacheMutex;
+
 void ShaderProcessor::Process(const std::string& sourceCode, ProcessingOptions& options,
                               const std::function<void(const std::string& migratedCode)>& callback)
 {
-  _ProcessIncludes(sourceCode, options,
-                   [&options, callback](const std::string& codeWithIncludes) -> void {
-                     const auto migratedCode = _ProcessShaderConversion(codeWithIncludes, options);
-                     callback(migratedCode);
-                   });
+  // The includes are resolved first, so that the cache key covers their content
+  _ProcessIncludes(
+    sourceCode, options, [&options, callback](const std::string& codeWithIncludes) -> void {
+      const auto cacheKey = _GetProcessedCodeCacheKey(codeWithIncludes, options);
+      std::optional<_ProcessedCode> cachedCode;
+      {
+        std::lock_guard<std::mutex> lock(_ProcessedCodeCacheMutex);
+        auto it = _ProcessedCodeCache.find(cacheKey);
+        if (it != _ProcessedCodeCache.end()) {
+          cachedCode = it->second;
+        }
+      }
+
+      if (cachedCode) {
+        options.lookForClosingBracketForUniformBuffer
+          = cachedCode->lookForClosingBracketForUniformBuffer;
+        callback(cachedCode->code);
+        return;
+      }
+
+      const auto migratedCode = _ProcessShaderConversion(codeWithIncludes, options);
+      {
+        std::lock_guard<std::mutex> lock(_ProcessedCodeCacheMutex);
+        if (_ProcessedCodeCache.find(cacheKey) == _ProcessedCodeCache.end()) {
+          if (_ProcessedCodeCacheKeys.size() >= MaxCacheSize) {
+            _ProcessedCodeCache.erase(_ProcessedCodeCacheKeys.front());
+            _ProcessedCodeCacheKeys.pop_front();
+          }
+          _ProcessedCodeCacheKeys.emplace_back(cacheKey);
+        }
+        _ProcessedCodeCache[cacheKey]
+          = _ProcessedCode{migratedCode, options.lookForClosingBracketForUniformBuffer};
+      }
+      callback(migratedCode);
+    });
+}
+
+void ShaderProcessor::ClearCache()
+{
+  std::lock_guard<std::mutex> lock(_ProcessedCodeCacheMutex);
+  _ProcessedCodeCache.clear();
+  _ProcessedCodeCacheKeys.clear();
+}
+
+size_t ShaderProcessor::CacheSize()
+{
+  std::lock_guard<std::mutex> lock(_ProcessedCodeCacheMutex);
+  return _ProcessedCodeCache.size();
+}
+
+std::string ShaderProcessor::_GetProcessedCodeCacheKey(const std::string& codeWithIncludes,
+                                                       const ProcessingOptions& options)
+{
+  std::string defines;
+  for (const auto& define : options.defines) {
+    defines += define;
+    defines += '\n';
+  }
+
+  // The include store is covered by the resolved code, the remaining options are all keyed
+  const auto& lookForClosingBracket = options.lookForClosingBracketForUniformBuffer;
+  const std::hash<std::string> hash;
+  std::ostringstream key;
+  key << hash(codeWithIncludes) << '|' << codeWithIncludes.size() << '|' << hash(defines) << '|'
+      << options.indexParameters.dump() << '|' << options.isFragment
+      << options.shouldUseHighPrecisionShader << options.supportsUniformBuffers
+      << (lookForClosingBracket ? (*lookForClosingBracket ? '1' : '0') : '-') << '|'
+      << options.version << '|' << options.platformName << '|' << options.shadersRepository << '|'
+      << options.processor.get();
+
+  return key.str();
 }
 
 std::string ShaderProcessor::_ProcessPrecision(std::string source, const ProcessingOptions& options)
@@ -50,13 +224,16 @@ std::string ShaderProcessor::_ProcessPrecision(std::string source, const Process
 
 ShaderDefineExpressionPtr ShaderProcessor::_ExtractOperation(const std::string& expression)
 {
-  auto reStr = R"(defined\((.+)\))";
-  std::regex regex(reStr, std::regex::optimize);
-  std::smatch match;
-
-  if (std::regex_search(expression, match, regex) && !match.empty()) {
-    return std::make_shared<ShaderDefineIsDefinedOperator>(StringTools::trimCopy(match[1]),
-                                                           expression[0] == '!');
+  // defined(DEFINE)
+  const auto definedStart = expression.find("defined(");
+  if (definedStart != std::string::npos) {
+    const auto operandStart = definedStart + 8;
+    const auto operandEnd   = expression.rfind(')');
+    if (operandEnd != std::string::npos && operandEnd > operandStart) {
+      return std::make_shared<ShaderDefineIsDefinedOperator>(
+        StringTools::trimCopy(expression.substr(operandStart, operandEnd - operandStart)),
+        expression[0] == '!');
+    }
   }
 
   const std::vector<std::string> operators{"==", ">=", "<=", "<", ">"};
@@ -163,14 +340,10 @@ bool ShaderProcessor::_MoveCursor(ShaderCodeCursor& cursor, const ShaderCodeNode
 {
   while (cursor.canRead()) {
     ++cursor.lineIndex;
-    const auto& line      = cursor.currentLine();
-    const auto reKeywords = R"((#ifdef)|(#else)|(#elif)|(#endif)|(#ifndef)|(#if))";
-    std::regex regex(reKeywords, std::regex::optimize);
-    std::smatch matches;
-
-    if (std::regex_search(line, matches, regex) && !matches.empty()) {
-      auto keyword = matches[0].str();
+    const auto& line   = cursor.currentLine();
+    const auto keyword = ExtractKeyword(line);
 
+    if (!keyword.empty()) {
       if (keyword == "#ifdef") {
         auto newRootNode = std::make_shared<ShaderCodeConditionNode>();
         rootNode->children.emplace_back(newRootNode);
@@ -313,16 +486,14 @@ std::string ShaderProcessor::_ProcessShaderConversion(const std::string& sourceC
 void ShaderProcessor::_ProcessIncludes(const std::string& sourceCode, ProcessingOptions& options,
                                        const std::function<void(const std::string& data)>& callback)
 {
-  static std::string reStr = R"(#include<(.+)>(\((.*)\))*(\[(.*)\])*)";
-  static std::regex regex(reStr, std::regex::optimize);
-  auto regexBegin = std::sregex_iterator(sourceCode.begin(), sourceCode.end(), regex);
-  auto regexEnd   = std::sregex_iterator();
+  std::string returnValue;
+  returnValue.reserve(sourceCode.size());
 
-  auto returnValue = sourceCode;
+  IncludeDirective match;
+  size_t position = 0;
 
-  for (std::sregex_iterator regexIt = regexBegin; regexIt != regexEnd; ++regexIt) {
-    auto match       = *regexIt;
-    auto includeFile = match[1].str();
+  while (FindIncludeDirective(sourceCode, position, match)) {
+    auto includeFile = match.file;
 
     // Uniform declaration
     if (StringTools::indexOf(includeFile, "__decl__") != -1) {
@@ -338,31 +509,34 @@ void ShaderProcessor::_ProcessIncludes(const std::string& sourceCode, Processing
         && !options.includesShadersStore[includeFile].empty()) {
       // Substitution
       auto includeContent = options.includesShadersStore[includeFile];
-      if (match.size() > 2 && !match[2].str().empty()) {
-        auto splits = StringTools::split(match[3].str(), ',');
+      if (match.hasReplacements) {
+        auto splits = StringTools::split(match.replacements, ',');
 
-        for (size_t index = 0; index < splits.size(); index += 2) {
-          auto dest = splits[index + 1];
+        for (size_t index = 0; index + 1 < splits.size(); index += 2) {
+          const auto& source = splits[index];
+          const auto& dest   = splits[index + 1];
 
-          includeContent = StringTools::regexReplace(includeContent, splits[index], dest);
+          includeContent = IsLiteralPattern(source) ?
+                             StringTools::replace(includeContent, source, dest) :
+                             StringTools::regexReplace(includeContent, source, dest);
         }
       }
 
-      if (match.size() > 4 && !match[4].str().empty()) {
-        auto indexString = match[5].str();
+      if (match.hasIndex) {
+        const auto& indexString = match.indexString;
+        const auto rangePos     = indexString.find("..");
 
-        if (StringTools::indexOf(indexString, "..") != -1) {
-          StringTools::replaceInPlace(indexString, "..", "@");
-          auto indexSplits = StringTools::split(indexString, '@');
-          auto minIndex    = StringTools::toNumber<int>(indexSplits[0]);
-          auto maxIndex    = StringTools::isDigit(indexSplits[1]) ?
-                            StringTools::toNumber<int>(indexSplits[1]) :
-                            -1;
-          auto sourceIncludeContent = StringTools::slice(includeContent, 0);
-          includeContent            = "";
+        if (rangePos != std::string::npos) {
+          const auto minString = indexString.substr(0, rangePos);
+          const auto maxString = indexString.substr(rangePos + 2);
+          auto minIndex        = StringTools::toNumber<int>(minString);
+          auto maxIndex
+            = StringTools::isDigit(maxString) ? StringTools::toNumber<int>(maxString) : -1;
+          const auto sourceIncludeContent = includeContent;
+          includeContent                  = "";
 
           if (maxIndex <= 0) {
-            maxIndex = options.indexParameters[indexSplits[1]];
+            maxIndex = options.indexParameters[maxString];
           }
 
           for (int i = minIndex; i < maxIndex; ++i) {
@@ -372,9 +546,8 @@ void ShaderProcessor::_ProcessIncludes(const std::string& sourceCode, Processing
              string, p1: string) => { return p1 + "{X}";
              });*/
             }
-            includeContent
-              += StringTools::regexReplace(sourceIncludeContent, R"(\{X\})", std::to_string(i))
-                 + "\n";
+            includeContent += StringTools::replace(sourceIncludeContent, "{X}", std::to_string(i));
+            includeContent += "\n";
           }
         }
         else {
@@ -384,15 +557,18 @@ void ShaderProcessor::_ProcessIncludes(const std::string& sourceCode, Processing
             => { return p1 + "{X}";
             });*/
           }
-          includeContent = StringTools::regexReplace(includeContent, R"(\{X\})", indexString);
+          includeContent = StringTools::replace(includeContent, "{X}", indexString);
         }
       }
 
       // Replace
-      returnValue = StringTools::replace(returnValue, match[0].str(), includeContent);
+      returnValue.append(sourceCode, position, match.start - position);
+      returnValue += includeContent;
+      position = match.end;
     }
     else {
       auto includeShaderUrl = options.shadersRepository + "ShadersInclude/" + includeFile + ".fx";
+      returnValue.append(sourceCode, position, std::string::npos);
 
       ShaderProcessor::_FileToolsLoadFile(
         includeShaderUrl,
@@ -408,6 +584,7 @@ void ShaderProcessor::_ProcessIncludes(const std::string& sourceCode, Processing
     }
   }
 
+  returnValue.append(sourceCode, position, std::string::npos);
   callback(returnValue);
 }
 
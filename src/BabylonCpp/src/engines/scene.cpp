@@ -21,6 +21,7 @@
 #include <babylon/core/logging.h>
 #include <babylon/culling/bounding_box.h>
 #include <babylon/culling/bounding_info.h>
+#include <babylon/culling/bvh/picking_bvh.h>
 #include <babylon/culling/octrees/octree_scene_component.h>
 #include <babylon/culling/ray.h>
 #include <babylon/debug/debug_layer.h>
@@ -60,11 +61,13 @@
 #include <babylon/meshes/abstract_mesh.h>
 #include <babylon/meshes/buffer.h>
 #include <babylon/meshes/geometry.h>
+#include <babylon/meshes/mesh.h>
 #include <babylon/meshes/mesh_simplification_scene_component.h>
 #include <babylon/meshes/simplification/simplification_queue.h>
 #include <babylon/meshes/sub_mesh.h>
 #include <babylon/meshes/vertex_buffer.h>
 #include <babylon/misc/guid.h>
+#include <babylon/misc/job_pool.h>
 #include <babylon/misc/tools.h>
 #include <babylon/morph/morph_target_manager.h>
 #include <babylon/particles/particle_system.h>
@@ -86,6 +89,17 @@
 
 namespace BABYLON {
 
+namespace {
+
+// World matrices depending on the camera or notifying observers are computed on the calling thread
+bool RequiresSerialWorldMatrixUpdate(TransformNode* node)
+{
+  return node->billboardMode() != TransformNode::BILLBOARDMODE_NONE || node->infiniteDistance()
+         || node->hasAfterWorldMatrixUpdateObservers();
+}
+
+} // end of anonymous namespace
+
 size_t Scene::_uniqueIdCounter = 0;
 
 microseconds_t Scene::MinDeltaTime = std::chrono::milliseconds(1);
@@ -114,6 +128,13 @@ Scene::Scene(Engine* engine, const std::optional<SceneOptions>& options)
     , pointerMovePredicate{nullptr}
     , forceWireframe{this, &Scene::get_forceWireframe, &Scene::set_forceWireframe}
     , skipFrustumClipping{this, &Scene::get_skipFrustumClipping, &Scene::set_skipFrustumClipping}
+    , parallelActiveMeshesEvaluation{false}
+    , parallelSkeletonsEvaluation{false}
+    , transformUpdatePassEnabled{false}
+    , sortKeyRenderQueueEnabled{false}
+    , _transformUpdateId{-1}
+    , pickingBVHEnabled{true}
+    , _pickingBVH{nullptr}
     , forcePointsCloud{this, &Scene::get_forcePointsCloud, &Scene::set_forcePointsCloud}
     , clipPlane{std::nullopt}
     , clipPlane2{std::nullopt}
@@ -156,6 +177,7 @@ Scene::Scene(Engine* engine, const std::optional<SceneOptions>& options)
     , skeletonsEnabled{this, &Scene::get_skeletonsEnabled, &Scene::set_skeletonsEnabled}
     , lensFlaresEnabled{true}
     , collisionsEnabled{true}
+    , collisionsBroadphaseEnabled{true}
     , collisionCoordinator{this, &Scene::get_collisionCoordinator}
     , gravity{Vector3(0.f, -9.807f, 0.f)}
     , postProcessesEnabled{true}
@@ -192,6 +214,8 @@ Scene::Scene(Engine* engine, const std::optional<SceneOptions>& options)
     , totalActiveIndicesPerfCounter{this, &Scene::get_totalActiveIndicesPerfCounter}
     , activeParticlesPerfCounter{this, &Scene::get_activeParticlesPerfCounter}
     , activeBonesPerfCounter{this, &Scene::get_activeBonesPerfCounter}
+    , worldMatrixUpdatesPerfCounter{this, &Scene::get_worldMatrixUpdatesPerfCounter}
+    , avoidedStateChangesPerfCounter{this, &Scene::get_avoidedStateChangesPerfCounter}
     , isLoading{this, &Scene::get_isLoading}
     , uid{this, &Scene::get_uid}
     , audioEnabled{this, &Scene::get_audioEnabled, &Scene::set_audioEnabled}
@@ -271,6 +295,7 @@ Scene::Scene(Engine* engine, const std::optional<SceneOptions>& options)
     , _activeMeshCandidateProvider{nullptr}
     , _activeMeshesFrozen{false}
     , _skipEvaluateActiveMeshesCompletely{false}
+    , _activeSkeletonsEvaluationId{0}
     , _renderingManager{nullptr}
     , _transformMatrix{Matrix::Zero()}
     , _sceneUbo{nullptr}
@@ -944,6 +969,26 @@ PerfCounter& Scene::get_activeBonesPerfCounter()
   return _activeBones;
 }
 
+size_t Scene::getWorldMatrixUpdates() const
+{
+  return _worldMatrixUpdates.current();
+}
+
+PerfCounter& Scene::get_worldMatrixUpdatesPerfCounter()
+{
+  return _worldMatrixUpdates;
+}
+
+size_t Scene::getAvoidedStateChanges() const
+{
+  return _avoidedStateChanges.current();
+}
+
+PerfCounter& Scene::get_avoidedStateChangesPerfCounter()
+{
+  return _avoidedStateChanges;
+}
+
 std::vector<AbstractMesh*>& Scene::getActiveMeshes()
 {
   return _activeMeshes;
@@ -2415,6 +2460,11 @@ int Scene::removeMesh(AbstractMesh* toRemove, bool recursive)
     // Remove from the scene if mesh found
     meshes.erase(it);
 
+    // The indices of the next meshes changed
+    if (_pickingBVH) {
+      _pickingBVH->markForRebuild();
+    }
+
     if (!toRemove->parent()) {
       toRemove->_removeFromSceneRootNodes();
     }
@@ -3420,17 +3470,161 @@ void Scene::_evaluateActiveMeshes()
   _processedMaterials.clear();
   _activeParticleSystems.clear();
   _activeSkeletons.clear();
+  ++_activeSkeletonsEvaluationId;
   _softwareSkinnedMeshes.clear();
 
   for (const auto& step : _beforeEvaluateActiveMeshStage) {
     step.action();
   }
 
+  if (transformUpdatePassEnabled) {
+    _updateTransforms();
+  }
+
   // Determine mesh candidates
   auto _meshes = getActiveMeshCandidates();
 
   // Check each mesh
-  for (const auto& mesh : _meshes) {
+  if (parallelActiveMeshesEvaluation) {
+    _evaluateActiveMeshCandidatesInParallel(_meshes);
+  }
+  else {
+    for (const auto& mesh : _meshes) {
+      if (mesh->isBlocked()) {
+        continue;
+      }
+
+      _totalVertices.addCount(mesh->getTotalVertices(), false);
+
+      if (!mesh->isReady() || !mesh->isEnabled()) {
+        continue;
+      }
+
+      mesh->computeWorldMatrix();
+
+      _evaluateActiveMeshCandidate(mesh, std::nullopt);
+    }
+  }
+
+  // Skeletons
+  _evaluateActiveSkeletons();
+
+  // Nodes can be moved again from now on
+  _transformUpdateId = -1;
+
+  onAfterActiveMeshesEvaluationObservable.notifyObservers(this);
+
+  // Particle systems
+  if (particlesEnabled) {
+    onBeforeParticlesRenderingObservable.notifyObservers(this);
+    for (const auto& particleSystem : particleSystems) {
+      if (!particleSystem->isStarted() || !particleSystem->hasEmitter()) {
+        continue;
+      }
+
+      if (std::holds_alternative<AbstractMeshPtr>(particleSystem->emitter)
+          && std::get<AbstractMeshPtr>(particleSystem->emitter)->isEnabled()) {
+        _activeParticleSystems.emplace_back(particleSystem.get());
+        particleSystem->animate();
+        _renderingManager->dispatchParticles(particleSystem.get());
+      }
+    }
+    onAfterParticlesRenderingObservable.notifyObservers(this);
+  }
+}
+
+void Scene::_updateTransforms()
+{
+  // Number of nodes updated by a single job
+  static constexpr size_t GrainSize = 128;
+
+  // Enabled nodes grouped by depth in the hierarchy
+  std::vector<std::vector<TransformNode*>> levels(1);
+  const auto addNode = [&levels](TransformNode* node) {
+    if (!node->isEnabled()) {
+      return;
+    }
+    size_t depth = 0;
+    for (auto ancestor = node->parent(); ancestor; ancestor = ancestor->parent()) {
+      ++depth;
+    }
+    if (depth >= levels.size()) {
+      levels.resize(depth + 1);
+    }
+    levels[depth].emplace_back(node);
+  };
+
+  for (const auto& transformNode : transformNodes) {
+    addNode(transformNode.get());
+  }
+  for (const auto& mesh : meshes) {
+    if (!mesh->isBlocked()) {
+      addNode(mesh.get());
+    }
+  }
+
+  _transformUpdateId = _renderId;
+
+  std::atomic<size_t> nbUpdates{0};
+  const auto updateNode = [this](TransformNode* node) {
+    const auto childUpdateId = node->_childUpdateId;
+    node->computeWorldMatrix();
+    node->_transformUpdateId = _transformUpdateId;
+    return node->_childUpdateId != childUpdateId;
+  };
+
+  std::vector<TransformNode*> parallelNodes;
+  for (const auto& level : levels) {
+    if (!parallelActiveMeshesEvaluation) {
+      for (const auto& node : level) {
+        nbUpdates += updateNode(node) ? 1 : 0;
+      }
+      continue;
+    }
+
+    // The workers only update nodes whose parent is already up to date
+    parallelNodes.clear();
+    for (const auto& node : level) {
+      const auto parentNode = node->parent();
+      if (RequiresSerialWorldMatrixUpdate(node)
+          || (parentNode && !parentNode->_isValidatedByTransformUpdate())) {
+        nbUpdates += updateNode(node) ? 1 : 0;
+      }
+      else {
+        parallelNodes.emplace_back(node);
+      }
+    }
+
+    JobPool::Default().parallelFor(
+      parallelNodes.size(), GrainSize, [&](size_t begin, size_t end) {
+        size_t nbJobUpdates = 0;
+        for (auto i = begin; i < end; ++i) {
+          nbJobUpdates += updateNode(parallelNodes[i]) ? 1 : 0;
+        }
+        nbUpdates += nbJobUpdates;
+      });
+  }
+
+  _worldMatrixUpdates.addCount(nbUpdates, false);
+}
+
+void Scene::_evaluateActiveMeshCandidatesInParallel(
+  const std::vector<AbstractMesh*>& meshCandidates)
+{
+  // Number of meshes evaluated by a single job
+  static constexpr size_t GrainSize = 128;
+
+  enum CandidateState : uint8_t {
+    // World matrix and frustum test are left to the calling thread
+    Serial,
+    Visible,
+    Hidden,
+  };
+
+  // Readiness checks can compile effects, they stay on the calling thread
+  std::vector<AbstractMesh*> candidates;
+  candidates.reserve(meshCandidates.size());
+  for (const auto& mesh : meshCandidates) {
     if (mesh->isBlocked()) {
       continue;
     }
@@ -3441,70 +3635,183 @@ void Scene::_evaluateActiveMeshes()
       continue;
     }
 
-    mesh->computeWorldMatrix();
+    candidates.emplace_back(mesh);
+  }
 
-    // Intersections
-    if (mesh->actionManager
-        && mesh->actionManager->hasSpecificTriggers2(ActionManager::OnIntersectionEnterTrigger,
-                                                     ActionManager::OnIntersectionExitTrigger)) {
-      if (std::find(_meshesForIntersections.begin(), _meshesForIntersections.end(), mesh)
-          == _meshesForIntersections.end()) {
-        _meshesForIntersections.emplace_back(mesh);
-      }
+  // Candidates grouped by depth in the hierarchy, a world matrix reads the parent one
+  std::vector<CandidateState> states(candidates.size(), CandidateState::Hidden);
+  std::vector<std::vector<size_t>> levels(1);
+  for (size_t index = 0; index < candidates.size(); ++index) {
+    const auto& mesh = candidates[index];
+    size_t depth     = 0;
+    for (auto node = mesh->parent(); node; node = node->parent()) {
+      ++depth;
+    }
+    if (depth >= levels.size()) {
+      levels.resize(depth + 1);
     }
+    levels[depth].emplace_back(index);
 
-    // Switch to current LOD
-    auto meshLOD = mesh->getLOD(_activeCamera);
-    if (!meshLOD) {
-      continue;
+    auto asMesh = dynamic_cast<Mesh*>(mesh);
+    if (RequiresSerialWorldMatrixUpdate(mesh)
+        || (asMesh && asMesh->delayLoadState != Constants::DELAYLOADSTATE_NONE)) {
+      states[index] = CandidateState::Serial;
     }
+  }
 
-    mesh->_preActivate();
+  onBeforeActiveMeshesParallelEvaluationObservable.notifyObservers(this);
 
-    if (mesh->isVisible && mesh->visibility() > 0.f
-        && (mesh->alwaysSelectAsActiveMesh
-            || ((mesh->layerMask & _activeCamera->layerMask) != 0
-                && mesh->isInFrustum(_frustumPlanes)))) {
-      _activeMeshes.emplace_back(mesh);
-      _activeCamera->_activeMeshes.emplace_back(_activeMeshes.back());
+  auto& jobPool = JobPool::Default();
+  for (const auto& level : levels) {
+    // Parents which are not candidates (and serial candidates) are computed before the workers
+    // start, so that the workers only read them. isSynchronized also refreshes the cached parents
+    // of the ancestors.
+    for (const auto& index : level) {
+      const auto& mesh = candidates[index];
+      if (auto parentNode = mesh->parent()) {
+        parentNode->getWorldMatrix();
+        parentNode->isSynchronized();
+      }
+      if (states[index] == CandidateState::Serial) {
+        mesh->computeWorldMatrix();
+      }
+    }
 
-      mesh->_activate(_renderId, false);
-      if (meshLOD != mesh) {
-        meshLOD->_activate(_renderId, false);
+    jobPool.parallelFor(level.size(), GrainSize, [&](size_t begin, size_t end) {
+      for (auto i = begin; i < end; ++i) {
+        const auto index = level[i];
+        if (states[index] == CandidateState::Serial) {
+          continue;
+        }
+        const auto& mesh = candidates[index];
+        mesh->computeWorldMatrix();
+        states[index] = _isActiveMeshCandidateVisible(mesh, true) ? CandidateState::Visible :
+                                                                    CandidateState::Hidden;
       }
+    });
+  }
+
+  onAfterActiveMeshesParallelEvaluationObservable.notifyObservers(this);
 
-      _activeMesh(mesh, meshLOD);
+  // Merge in the candidates order, the activation fills shared lists
+  for (size_t index = 0; index < candidates.size(); ++index) {
+    if (states[index] == CandidateState::Serial) {
+      _evaluateActiveMeshCandidate(candidates[index], std::nullopt);
+    }
+    else {
+      _evaluateActiveMeshCandidate(candidates[index], states[index] == CandidateState::Visible);
     }
   }
+}
 
-  onAfterActiveMeshesEvaluationObservable.notifyObservers(this);
+void Scene::_evaluateActiveSkeletons()
+{
+  // Number of skeletons evaluated by a single job
+  static constexpr size_t GrainSize = 4;
 
-  // Particle systems
-  if (particlesEnabled) {
-    onBeforeParticlesRenderingObservable.notifyObservers(this);
-    for (const auto& particleSystem : particleSystems) {
-      if (!particleSystem->isStarted() || !particleSystem->hasEmitter()) {
+  if (_activeSkeletons.empty()) {
+    return;
+  }
+
+  onBeforeSkeletonsEvaluationObservable.notifyObservers(this);
+
+  if (!parallelSkeletonsEvaluation) {
+    for (const auto& skeleton : _activeSkeletons) {
+      skeleton->prepare();
+    }
+  }
+  else {
+    // Linked transform nodes and textures are updated on the calling thread, as well as the
+    // skeletons notifying observers before their computation
+    std::vector<Skeleton*> parallelSkeletons;
+    parallelSkeletons.reserve(_activeSkeletons.size());
+    for (const auto& skeleton : _activeSkeletons) {
+      if (!skeleton->_beginPrepare()) {
         continue;
       }
-
-      if (std::holds_alternative<AbstractMeshPtr>(particleSystem->emitter)
-          && std::get<AbstractMeshPtr>(particleSystem->emitter)->isEnabled()) {
-        _activeParticleSystems.emplace_back(particleSystem.get());
-        particleSystem->animate();
-        _renderingManager->dispatchParticles(particleSystem.get());
+      if (skeleton->onBeforeComputeObservable.hasObservers()) {
+        skeleton->_computeMatrices();
+        skeleton->_endPrepare();
+      }
+      else {
+        parallelSkeletons.emplace_back(skeleton.get());
       }
     }
-    onAfterParticlesRenderingObservable.notifyObservers(this);
+
+    JobPool::Default().parallelFor(parallelSkeletons.size(), GrainSize,
+                                   [&](size_t begin, size_t end) {
+                                     for (auto i = begin; i < end; ++i) {
+                                       parallelSkeletons[i]->_computeMatrices();
+                                     }
+                                   });
+
+    for (const auto& skeleton : parallelSkeletons) {
+      skeleton->_endPrepare();
+    }
+  }
+
+  onAfterSkeletonsEvaluationObservable.notifyObservers(this);
+}
+
+void Scene::_evaluateActiveMeshCandidate(AbstractMesh* mesh, const std::optional<bool>& isVisible)
+{
+  // Intersections
+  if (mesh->actionManager
+      && mesh->actionManager->hasSpecificTriggers2(ActionManager::OnIntersectionEnterTrigger,
+                                                   ActionManager::OnIntersectionExitTrigger)) {
+    if (std::find(_meshesForIntersections.begin(), _meshesForIntersections.end(), mesh)
+        == _meshesForIntersections.end()) {
+      _meshesForIntersections.emplace_back(mesh);
+    }
+  }
+
+  // Switch to current LOD
+  auto meshLOD = mesh->getLOD(_activeCamera);
+  if (!meshLOD) {
+    return;
+  }
+
+  mesh->_preActivate();
+
+  if (isVisible.has_value() ? *isVisible : _isActiveMeshCandidateVisible(mesh, false)) {
+    _activeMeshes.emplace_back(mesh);
+    _activeCamera->_activeMeshes.emplace_back(_activeMeshes.back());
+
+    mesh->_activate(_renderId, false);
+    if (meshLOD != mesh) {
+      meshLOD->_activate(_renderId, false);
+    }
+
+    _activeMesh(mesh, meshLOD);
+  }
+}
+
+bool Scene::_isActiveMeshCandidateVisible(AbstractMesh* mesh, bool boundingInfoOnly) const
+{
+  if (!mesh->isVisible || mesh->visibility() <= 0.f) {
+    return false;
+  }
+
+  if (mesh->alwaysSelectAsActiveMesh) {
+    return true;
+  }
+
+  if ((mesh->layerMask & _activeCamera->layerMask) == 0) {
+    return false;
   }
+
+  // Mesh::isInFrustum can also queue the delayed loading of the mesh
+  return boundingInfoOnly ? mesh->AbstractMesh::isInFrustum(_frustumPlanes) :
+                            mesh->isInFrustum(_frustumPlanes);
 }
 
 void Scene::_activeMesh(AbstractMesh* sourceMesh, AbstractMesh* mesh)
 {
   if (_skeletonsEnabled && mesh->skeleton()) {
-    if (std::find(_activeSkeletons.begin(), _activeSkeletons.end(), mesh->skeleton())
-        == _activeSkeletons.end()) {
+    // The skeletons are prepared by _evaluateActiveSkeletons once all the meshes are activated
+    if (mesh->skeleton()->_activeEvaluationId != _activeSkeletonsEvaluationId) {
+      mesh->skeleton()->_activeEvaluationId = _activeSkeletonsEvaluationId;
       _activeSkeletons.emplace_back(mesh->skeleton());
-      mesh->skeleton()->prepare();
     }
 
     if (!mesh->computeBonesUsingShaders()) {
@@ -3780,6 +4087,8 @@ void Scene::render(bool updateCameras, bool ignoreAnimations)
   _totalVertices.fetchNewFrame();
   _activeIndices.fetchNewFrame();
   _activeBones.fetchNewFrame();
+  _worldMatrixUpdates.fetchNewFrame();
+  _avoidedStateChanges.fetchNewFrame();
   _meshesForIntersections.clear();
   resetCachedMaterial();
 
@@ -3925,6 +4234,8 @@ void Scene::render(bool updateCameras, bool ignoreAnimations)
   }
 
   _activeBones.addCount(0, true);
+  _worldMatrixUpdates.addCount(0, true);
+  _avoidedStateChanges.addCount(0, true);
   _activeIndices.addCount(0, true);
   _activeParticles.addCount(0, true);
 }
@@ -4148,6 +4459,10 @@ void Scene::dispose()
   onBeforeStepObservable.clear();
   onBeforeActiveMeshesEvaluationObservable.clear();
   onAfterActiveMeshesEvaluationObservable.clear();
+  onBeforeActiveMeshesParallelEvaluationObservable.clear();
+  onAfterActiveMeshesParallelEvaluationObservable.clear();
+  onBeforeSkeletonsEvaluationObservable.clear();
+  onAfterSkeletonsEvaluationObservable.clear();
   onBeforeParticlesRenderingObservable.clear();
   onAfterParticlesRenderingObservable.clear();
   onBeforeDrawPhaseObservable.clear();
@@ -4466,15 +4781,18 @@ Scene::_internalPick(const std::function<Ray(Matrix& world)>& rayFunction,
                      bool fastCheck)
 {
   std::optional<PickingInfo> pickingInfo = std::nullopt;
+  size_t pickingInfoMeshIndex            = 0;
 
-  for (const auto& mesh : meshes) {
+  // Returns whether the mesh is the new picked mesh
+  const auto pickMesh = [&](size_t index) {
+    const auto& mesh = meshes[index];
     if (predicate) {
       if (!predicate(mesh)) {
-        continue;
+        return false;
       }
     }
     else if (!mesh->isEnabled() || !mesh->isVisible || !mesh->isPickable) {
-      continue;
+      return false;
     }
 
     auto world = mesh->getWorldMatrix();
@@ -4482,20 +4800,48 @@ Scene::_internalPick(const std::function<Ray(Matrix& world)>& rayFunction,
 
     auto result = mesh->intersects(ray, fastCheck);
     if (/*!result || */ !result.hit) {
-      continue;
+      return false;
     }
 
-    if (!fastCheck && pickingInfo != std::nullopt && result.distance >= (*pickingInfo).distance) {
-      continue;
+    // On equal distances, the first mesh of the scene is picked
+    if (!fastCheck && pickingInfo != std::nullopt
+        && (result.distance > (*pickingInfo).distance
+            || (result.distance == (*pickingInfo).distance && index > pickingInfoMeshIndex))) {
+      return false;
     }
 
-    pickingInfo = result;
+    pickingInfo          = result;
+    pickingInfoMeshIndex = index;
+    return true;
+  };
 
-    if (fastCheck) {
-      break;
+  if (!pickingBVHEnabled) {
+    for (size_t index = 0; index < meshes.size(); ++index) {
+      if (pickMesh(index) && fastCheck) {
+        break;
+      }
     }
+    return pickingInfo ? pickingInfo : PickingInfo();
   }
 
+  // Only the meshes whose world bounding box is hit are tested, the farther ones are skipped once
+  // a mesh is picked
+  auto& pickingBVH = _getPickingBVH();
+  auto identity    = Matrix::Identity();
+  const auto ray   = rayFunction(identity);
+
+  const auto directionLength = ray.direction.length();
+  auto maxDistance           = std::numeric_limits<float>::max();
+  pickingBVH.intersectsRay(ray, maxDistance, [&](uint32_t index) {
+    if (!pickMesh(index)) {
+      return false;
+    }
+    if (directionLength > 0.f) {
+      maxDistance = (*pickingInfo).distance / directionLength;
+    }
+    return fastCheck;
+  });
+
   return pickingInfo ? pickingInfo : PickingInfo();
 }
 
@@ -4505,14 +4851,14 @@ Scene::_internalMultiPick(const std::function<Ray(Matrix& world)>& rayFunction,
 {
   std::vector<std::optional<PickingInfo>> pickingInfos;
 
-  for (const auto& mesh : meshes) {
+  const auto pickMesh = [&](const AbstractMeshPtr& mesh) {
     if (predicate) {
       if (!predicate(mesh.get())) {
-        continue;
+        return;
       }
     }
     else if (!mesh->isEnabled() || !mesh->isVisible || !mesh->isPickable) {
-      continue;
+      return;
     }
 
     auto world = mesh->getWorldMatrix();
@@ -4520,15 +4866,47 @@ Scene::_internalMultiPick(const std::function<Ray(Matrix& world)>& rayFunction,
 
     auto result = mesh->intersects(ray, false);
     if (/*!result || */ !result.hit) {
-      continue;
+      return;
     }
 
     pickingInfos.emplace_back(result);
+  };
+
+  if (!pickingBVHEnabled) {
+    for (const auto& mesh : meshes) {
+      pickMesh(mesh);
+    }
+    return pickingInfos;
+  }
+
+  // Meshes whose world bounding box is hit, tested in the order of the scene
+  auto& pickingBVH = _getPickingBVH();
+  auto identity    = Matrix::Identity();
+  const auto ray   = rayFunction(identity);
+
+  std::vector<uint32_t> candidates;
+  auto maxDistance = std::numeric_limits<float>::max();
+  pickingBVH.intersectsRay(ray, maxDistance, [&candidates](uint32_t index) {
+    candidates.emplace_back(index);
+    return false;
+  });
+  std::sort(candidates.begin(), candidates.end());
+  for (const auto index : candidates) {
+    pickMesh(meshes[index]);
   }
 
   return pickingInfos;
 }
 
+PickingBVH& Scene::_getPickingBVH()
+{
+  if (!_pickingBVH) {
+    _pickingBVH = std::make_unique<PickingBVH>();
+  }
+  _pickingBVH->update(meshes);
+  return *_pickingBVH;
+}
+
 std::optional<PickingInfo>
 Scene::_internalPickSprites(const Ray& ray, const std::function<bool(Sprite* sprite)>& predicate,
                             bool fastCheck, CameraPtr camera)
@@ -4703,6 +5081,21 @@ std::optional<PickingInfo> Scene::pickWithRay(
   return result;
 }
 
+std::vector<std::optional<PickingInfo>>
+Scene::pickBatch(const std::vector<Ray>& rays,
+                 const std::function<bool(const AbstractMeshPtr& mesh)>& predicate, bool fastCheck)
+{
+  std::vector<std::optional<PickingInfo>> pickingInfos;
+  pickingInfos.reserve(rays.size());
+
+  // The picking BVH is synchronized once, by the first ray
+  for (const auto& ray : rays) {
+    pickingInfos.emplace_back(pickWithRay(ray, predicate, fastCheck));
+  }
+
+  return pickingInfos;
+}
+
 std::vector<std::optional<PickingInfo>>
 Scene::multiPick(int x, int y, const std::function<bool(AbstractMesh* mesh)>& predicate,
                  const CameraPtr& camera)
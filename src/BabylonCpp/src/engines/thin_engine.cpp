@@ -13,6 +13,7 @@
 #include <babylon/engines/extensions/uniform_buffer_extension.h>
 #include <babylon/engines/instancing_attribute_info.h>
 #include <babylon/engines/scene.h>
+#include <babylon/engines/webgl/program_binary_cache.h>
 #include <babylon/engines/webgl/webgl2_shader_processor.h>
 #include <babylon/engines/webgl/webgl_pipeline_context.h>
 #include <babylon/interfaces/icanvas.h>
@@ -20,6 +21,7 @@
 #include <babylon/interfaces/igl_rendering_context.h>
 #include <babylon/materials/effect.h>
 #include <babylon/materials/ieffect_creation_options.h>
+#include <babylon/materials/material_defines.h>
 #include <babylon/materials/textures/base_texture.h>
 #include <babylon/materials/textures/iinternal_texture_loader.h>
 #include <babylon/materials/textures/internal_texture.h>
@@ -36,6 +38,7 @@
 #include <babylon/misc/dds.h>
 #include <babylon/misc/file_tools.h>
 #include <babylon/misc/string_tools.h>
+#include <babylon/misc/texture_pipeline.h>
 #include <babylon/states/alpha_state.h>
 #include <babylon/states/depth_culling_state.h>
 #include <babylon/states/stencil_state.h>
@@ -748,6 +751,9 @@ void ThinEngine::setViewport(const Viewport& viewport, const std::optional<int>&
 
 void ThinEngine::beginFrame()
 {
+  if (_texturePipeline) {
+    _texturePipeline->uploadDecodedImages();
+  }
 }
 
 void ThinEngine::endFrame()
@@ -923,15 +929,89 @@ void ThinEngine::restoreDefaultFramebuffer()
 void ThinEngine::_resetVertexBufferBinding()
 {
   bindArrayBuffer(nullptr);
-  _cachedVertexBuffersMap.clear();
+  _clearVertexBuffersCache();
   _cachedVertexBuffers = nullptr;
 }
 
+void ThinEngine::_resolveVertexBuffers(
+  const std::unordered_map<std::string, VertexBufferPtr>& vertexBuffers, const EffectPtr& effect)
+{
+  const auto& attributes = effect->getAttributesNames();
+
+  _resolvedAttributeVertexBuffers.resize(attributes.size());
+  for (size_t index = 0; index < attributes.size(); ++index) {
+    auto it                                = vertexBuffers.find(attributes[index]);
+    _resolvedAttributeVertexBuffers[index] = (it != vertexBuffers.end()) ? &it->second : nullptr;
+  }
+}
+
+void ThinEngine::_resolveVertexBuffers(const std::vector<VertexBufferPtr>& vertexBuffersBySlot,
+                                       const EffectPtr& effect)
+{
+  const auto& slots = effect->getAttributeKindSlots();
+
+  _resolvedAttributeVertexBuffers.resize(slots.size());
+  for (size_t index = 0; index < slots.size(); ++index) {
+    const auto slot = slots[index];
+    _resolvedAttributeVertexBuffers[index]
+      = (slot < vertexBuffersBySlot.size()) ? &vertexBuffersBySlot[slot] : nullptr;
+  }
+}
+
+bool ThinEngine::_updateVertexBuffersCache(const EffectPtr& effect)
+{
+  const auto nbAttributes = _resolvedAttributeVertexBuffers.size();
+
+  auto changed = _cachedEffectForVertexBuffers != effect
+                 || _cachedAttributeVertexBuffers.size() != nbAttributes;
+  for (size_t index = 0; !changed && index < nbAttributes; ++index) {
+    const auto* vertexBuffer = _resolvedAttributeVertexBuffers[index];
+    changed = (vertexBuffer ? vertexBuffer->get() : nullptr)
+              != _cachedAttributeVertexBuffers[index].get();
+  }
+
+  if (changed) {
+    _cachedEffectForVertexBuffers = effect;
+    _cachedAttributeVertexBuffers.resize(nbAttributes);
+    for (size_t index = 0; index < nbAttributes; ++index) {
+      const auto* vertexBuffer              = _resolvedAttributeVertexBuffers[index];
+      _cachedAttributeVertexBuffers[index] = vertexBuffer ? *vertexBuffer : nullptr;
+    }
+  }
+
+  return changed;
+}
+
+void ThinEngine::_clearVertexBuffersCache()
+{
+  _cachedAttributeVertexBuffers.clear();
+  _cachedEffectForVertexBuffers = nullptr;
+}
+
 WebGLDataBufferPtr ThinEngine::createVertexBuffer(const Float32Array& data)
 {
   return _createVertexBuffer(data, GL::STATIC_DRAW);
 }
 
+WebGLDataBufferPtr ThinEngine::createVertexBuffer(const ArrayBufferView& data)
+{
+  auto vbo = _gl->createBuffer();
+
+  if (!vbo) {
+    throw std::runtime_error("Unable to create vertex buffer");
+  }
+
+  auto dataBuffer = std::make_shared<WebGLDataBuffer>(vbo);
+  bindArrayBuffer(dataBuffer);
+
+  _gl->bufferData(GL::ARRAY_BUFFER, data, GL::STATIC_DRAW);
+
+  _resetVertexBufferBinding();
+
+  dataBuffer->references = 1;
+  return dataBuffer;
+}
+
 WebGLDataBufferPtr ThinEngine::_createVertexBuffer(const Float32Array& data, unsigned int usage)
 {
   auto vbo = _gl->createBuffer();
@@ -1105,11 +1185,8 @@ void ThinEngine::_bindIndexBufferWithCache(const WebGLDataBufferPtr& indexBuffer
   }
 }
 
-void ThinEngine::_bindVertexBuffersAttributes(
-  const std::unordered_map<std::string, VertexBufferPtr>& vertexBuffers, const EffectPtr& effect)
+void ThinEngine::_bindVertexBuffersAttributes(const EffectPtr& effect)
 {
-  auto attributes = effect->getAttributesNames();
-
   if (!_vaoRecordInProgress) {
     _unbindVertexArrayObject();
   }
@@ -1117,17 +1194,19 @@ void ThinEngine::_bindVertexBuffersAttributes(
   unbindAllAttributes();
 
   auto _order = 0u;
-  for (unsigned int index = 0; index < attributes.size(); ++index) {
+  for (unsigned int index = 0; index < _resolvedAttributeVertexBuffers.size(); ++index) {
     auto order = effect->getAttributeLocation(index);
 
     if (order >= 0) {
-      _order                   = static_cast<unsigned int>(order);
-      const auto& vertexBuffer = vertexBuffers.at(attributes[index]);
+      _order                        = static_cast<unsigned int>(order);
+      const auto* vertexBufferEntry = _resolvedAttributeVertexBuffers[index];
 
-      if (!vertexBuffer) {
+      if (!vertexBufferEntry || !*vertexBufferEntry) {
         continue;
       }
 
+      const auto& vertexBuffer = *vertexBufferEntry;
+
       _gl->enableVertexAttribArray(_order);
       if (!_vaoRecordInProgress) {
         _vertexAttribArraysEnabled[_order] = true;
@@ -1155,6 +1234,21 @@ void ThinEngine::_bindVertexBuffersAttributes(
 WebGLVertexArrayObjectPtr ThinEngine::recordVertexArrayObject(
   const std::unordered_map<std::string, VertexBufferPtr>& vertexBuffers,
   const WebGLDataBufferPtr& indexBuffer, const EffectPtr& effect)
+{
+  _resolveVertexBuffers(vertexBuffers, effect);
+  return _recordVertexArrayObject(indexBuffer, effect);
+}
+
+WebGLVertexArrayObjectPtr
+ThinEngine::recordVertexArrayObject(const std::vector<VertexBufferPtr>& vertexBuffersBySlot,
+                                    const WebGLDataBufferPtr& indexBuffer, const EffectPtr& effect)
+{
+  _resolveVertexBuffers(vertexBuffersBySlot, effect);
+  return _recordVertexArrayObject(indexBuffer, effect);
+}
+
+WebGLVertexArrayObjectPtr ThinEngine::_recordVertexArrayObject(const WebGLDataBufferPtr& indexBuffer,
+                                                               const EffectPtr& effect)
 {
   auto vao = _gl->createVertexArray();
 
@@ -1163,7 +1257,7 @@ WebGLVertexArrayObjectPtr ThinEngine::recordVertexArrayObject(
   _gl->bindVertexArray(vao.get());
 
   _mustWipeVertexAttributes = true;
-  _bindVertexBuffersAttributes(vertexBuffers, effect);
+  _bindVertexBuffersAttributes(effect);
 
   bindIndexBuffer(indexBuffer);
 
@@ -1180,7 +1274,7 @@ void ThinEngine::bindVertexArrayObject(const WebGLVertexArrayObjectPtr& vertexAr
     _cachedVertexArrayObject = vertexArrayObject;
 
     _gl->bindVertexArray(vertexArrayObject.get());
-    _cachedVertexBuffersMap.clear();
+    _clearVertexBuffersCache();
     _cachedVertexBuffers = nullptr;
     _cachedIndexBuffer   = nullptr;
 
@@ -1197,6 +1291,7 @@ void ThinEngine::bindBuffersDirectly(const WebGLDataBufferPtr& vertexBuffer,
   if (_cachedVertexBuffers != vertexBuffer || _cachedEffectForVertexBuffers != effect) {
     _cachedVertexBuffers          = vertexBuffer;
     _cachedEffectForVertexBuffers = effect;
+    _cachedAttributeVertexBuffers.clear();
 
     auto attributesCount = effect->getAttributesCount();
 
@@ -1245,11 +1340,20 @@ void ThinEngine::_unbindVertexArrayObject()
 void ThinEngine::bindBuffers(const std::unordered_map<std::string, VertexBufferPtr>& vertexBuffers,
                              const WebGLDataBufferPtr& indexBuffer, const EffectPtr& effect)
 {
-  if (_cachedVertexBuffersMap != vertexBuffers || _cachedEffectForVertexBuffers != effect) {
-    _cachedVertexBuffersMap       = vertexBuffers;
-    _cachedEffectForVertexBuffers = effect;
+  _resolveVertexBuffers(vertexBuffers, effect);
+  if (_updateVertexBuffersCache(effect)) {
+    _bindVertexBuffersAttributes(effect);
+  }
 
-    _bindVertexBuffersAttributes(vertexBuffers, effect);
+  _bindIndexBufferWithCache(indexBuffer);
+}
+
+void ThinEngine::bindBuffers(const std::vector<VertexBufferPtr>& vertexBuffersBySlot,
+                             const WebGLDataBufferPtr& indexBuffer, const EffectPtr& effect)
+{
+  _resolveVertexBuffers(vertexBuffersBySlot, effect);
+  if (_updateVertexBuffersCache(effect)) {
+    _bindVertexBuffersAttributes(effect);
   }
 
   _bindIndexBufferWithCache(indexBuffer);
@@ -1493,6 +1597,9 @@ void ThinEngine::_releaseEffect(Effect* effect)
 {
   if (stl_util::contains(_compiledEffects, effect->_key)) {
     _compiledEffects.erase(effect->_key);
+    for (auto it = _compiledEffectsByDefinesKey.begin(); it != _compiledEffectsByDefinesKey.end();) {
+      it = (it->second.get() == effect) ? _compiledEffectsByDefinesKey.erase(it) : std::next(it);
+    }
 
     _deletePipelineContext(
       std::static_pointer_cast<WebGLPipelineContext>(effect->getPipelineContext()));
@@ -1514,25 +1621,49 @@ EffectPtr ThinEngine::createEffect(
   IEffectCreationOptions& options, ThinEngine* engine,
   const std::function<void(const EffectPtr& effect)>& onCompiled)
 {
-  std::string name;
+  std::string shaders;
   if (std::holds_alternative<std::string>(baseName)) {
-    auto _baseName = std::get<std::string>(baseName);
-    name           = _baseName + "+" + _baseName + "@" + options.defines;
+    const auto& _baseName = std::get<std::string>(baseName);
+    shaders               = _baseName + "+" + _baseName;
   }
   else if (std::holds_alternative<std::unordered_map<std::string, std::string>>(baseName)) {
-    auto _baseName = std::get<std::unordered_map<std::string, std::string>>(baseName);
-    auto vertex    = stl_util::contains(_baseName, "vertexElement") ?
-                    _baseName["vertexElement"] :
-                    stl_util::contains(_baseName, "vertex") ? _baseName["vertex"] : "vertex";
+    const auto& _baseName = std::get<std::unordered_map<std::string, std::string>>(baseName);
+    auto vertex
+      = stl_util::contains(_baseName, "vertexElement") ?
+          _baseName.at("vertexElement") :
+          stl_util::contains(_baseName, "vertex") ? _baseName.at("vertex") : "vertex";
     auto fragment
       = stl_util::contains(_baseName, "fragmentElement") ?
-          _baseName["fragmentElement"] :
-          stl_util::contains(_baseName, "fragment") ? _baseName["fragment"] : "fragment";
-    name = vertex + "+" + fragment + "@" + options.defines;
+          _baseName.at("fragmentElement") :
+          stl_util::contains(_baseName, "fragment") ? _baseName.at("fragment") : "fragment";
+    shaders = vertex + "+" + fragment;
+  }
+
+  // Material defines carry a cached hash, so the effect can be found without building and hashing
+  // the full key. The defines string is still compared to guard against collisions.
+  std::optional<uint64_t> definesKey = std::nullopt;
+  if (options.materialDefines) {
+    definesKey = MaterialDefinesSchema::HashCombine(
+      MaterialDefinesSchema::HashCombine(MaterialDefinesSchema::HashSeed,
+                                         std::hash<std::string>{}(shaders)),
+      options.materialDefines->getHash());
+    auto it = _compiledEffectsByDefinesKey.find(*definesKey);
+    if (it != _compiledEffectsByDefinesKey.end() && it->second->defines == options.defines) {
+      const auto& compiledEffect = it->second;
+      if (onCompiled && compiledEffect->isReady()) {
+        onCompiled(compiledEffect);
+      }
+      return compiledEffect;
+    }
   }
 
-  if (stl_util::contains(_compiledEffects, name)) {
-    auto compiledEffect = _compiledEffects[name];
+  const auto name = shaders + "@" + options.defines;
+  auto it         = _compiledEffects.find(name);
+  if (it != _compiledEffects.end()) {
+    auto compiledEffect = it->second;
+    if (definesKey) {
+      _compiledEffectsByDefinesKey[*definesKey] = compiledEffect;
+    }
     if (onCompiled && compiledEffect->isReady()) {
       onCompiled(compiledEffect);
     }
@@ -1541,10 +1672,149 @@ EffectPtr ThinEngine::createEffect(
   auto effect            = Effect::New(baseName, options, engine);
   effect->_key           = name;
   _compiledEffects[name] = effect;
+  if (definesKey) {
+    _compiledEffectsByDefinesKey[*definesKey] = effect;
+  }
 
   return effect;
 }
 
+bool ThinEngine::setProgramBinaryCache(const ProgramBinaryCachePtr& programBinaryCache)
+{
+  if (programBinaryCache && _gl->getParameteri(GL::NUM_PROGRAM_BINARY_FORMATS) <= 0) {
+    BABYLON_LOG_WARN("ThinEngine", "Program binaries are not supported by the driver")
+    _programBinaryCache = nullptr;
+    return false;
+  }
+
+  _programBinaryCache = programBinaryCache;
+  return _programBinaryCache != nullptr;
+}
+
+ProgramBinaryCachePtr ThinEngine::programBinaryCache() const
+{
+  return _programBinaryCache;
+}
+
+void ThinEngine::setTexturePipeline(const TexturePipelinePtr& texturePipeline)
+{
+  _texturePipeline = texturePipeline;
+}
+
+TexturePipelinePtr ThinEngine::texturePipeline() const
+{
+  return _texturePipeline;
+}
+
+std::vector<EffectWarmUpEntry> ThinEngine::getEffectWarmUpEntries() const
+{
+  std::vector<EffectWarmUpEntry> entries;
+  entries.reserve(_compiledEffects.size());
+  for (const auto& [key, effect] : _compiledEffects) {
+    entries.emplace_back(EffectWarmUpEntry{key, effect->_indexParameters});
+  }
+
+  return entries;
+}
+
+void ThinEngine::warmUpEffects(const std::vector<EffectWarmUpEntry>& entries)
+{
+  const auto& shadersStore = Effect::ShadersStore();
+  for (const auto& entry : entries) {
+    // "vertexName+fragmentName@defines"
+    const auto& key           = entry.key;
+    const auto shadersEnd     = key.find('@');
+    const auto namesSeparator = key.find('+');
+    if (shadersEnd == std::string::npos || namesSeparator == std::string::npos
+        || namesSeparator > shadersEnd || stl_util::contains(_compiledEffects, key)) {
+      continue;
+    }
+
+    // Only the effects using shaders of the store can be created again
+    const auto vertex   = key.substr(0, namesSeparator);
+    const auto fragment = key.substr(namesSeparator + 1, shadersEnd - namesSeparator - 1);
+    if (!stl_util::contains(shadersStore, vertex + "VertexShader")
+        || (!stl_util::contains(shadersStore, fragment + "FragmentShader")
+            && !stl_util::contains(shadersStore, fragment + "PixelShader"))) {
+      continue;
+    }
+
+    IEffectCreationOptions options;
+    options.defines         = key.substr(shadersEnd + 1);
+    options.indexParameters = entry.indexParameters;
+    auto effect             = Effect::New(
+      std::unordered_map<std::string, std::string>{{"vertex", vertex}, {"fragment", fragment}},
+      options, this);
+
+    auto pipelineContext
+      = std::static_pointer_cast<WebGLPipelineContext>(effect->getPipelineContext());
+    if (pipelineContext && pipelineContext->program
+        && !pipelineContext->programBinaryCacheKey.empty()) {
+      _warmedUpEffects[pipelineContext->programBinaryCacheKey] = effect;
+    }
+  }
+}
+
+WebGLProgramPtr ThinEngine::_getCachedShaderProgram(const WebGLPipelineContextPtr& pipelineContext,
+                                                    const std::string& vertexCode,
+                                                    const std::string& fragmentCode,
+                                                    WebGLRenderingContext* context)
+{
+  const auto key = ProgramBinaryCache::GetKey(_glVendor + "|" + _glRenderer + "|" + _glVersion,
+                                              vertexCode, fragmentCode);
+  pipelineContext->programBinaryCacheKey = key;
+
+  // Program precompiled by warmUpEffects
+  auto it = _warmedUpEffects.find(key);
+  if (it != _warmedUpEffects.end()) {
+    auto warmedUpEffect = it->second;
+    auto warmedUpPipelineContext
+      = std::static_pointer_cast<WebGLPipelineContext>(warmedUpEffect->getPipelineContext());
+    _warmedUpEffects.erase(it);
+
+    if (warmedUpEffect->isReady() && warmedUpPipelineContext->context == context) {
+      auto program                     = warmedUpPipelineContext->program;
+      warmedUpPipelineContext->program = nullptr;
+      return _useLinkedShaderProgram(pipelineContext, program, context);
+    }
+    _deletePipelineContext(warmedUpPipelineContext);
+  }
+
+  // Program binary stored during a previous run
+  unsigned int binaryFormat = 0;
+  Uint8Array binary;
+  if (_programBinaryCache && _programBinaryCache->load(key, binaryFormat, binary)) {
+    auto program = context->createProgram();
+    if (program && context->programBinary(program.get(), binaryFormat, binary)) {
+      return _useLinkedShaderProgram(pipelineContext, program, context);
+    }
+
+    // Rejected by the driver, the program is compiled from source again
+    if (program) {
+      context->deleteProgram(program.get());
+    }
+    _programBinaryCache->remove(key);
+  }
+
+  return nullptr;
+}
+
+WebGLProgramPtr ThinEngine::_useLinkedShaderProgram(const WebGLPipelineContextPtr& pipelineContext,
+                                                    const WebGLProgramPtr& program,
+                                                    WebGLRenderingContext* context)
+{
+  pipelineContext->program        = program;
+  pipelineContext->context        = context;
+  pipelineContext->vertexShader   = nullptr;
+  pipelineContext->fragmentShader = nullptr;
+
+  if (!pipelineContext->isParallelCompiled) {
+    _finalizePipelineContext(pipelineContext.get());
+  }
+
+  return program;
+}
+
 std::string ThinEngine::_ConcatenateShader(const std::string& source, const std::string& defines,
                                            const std::string& shaderVersion)
 {
@@ -1581,6 +1851,12 @@ ThinEngine::createRawShaderProgram(const IPipelineContextPtr& pipelineContext,
 {
   context = context ? context : _gl;
 
+  auto webGLPipelineContext = std::static_pointer_cast<WebGLPipelineContext>(pipelineContext);
+  if (auto program
+      = _getCachedShaderProgram(webGLPipelineContext, vertexCode, fragmentCode, context)) {
+    return program;
+  }
+
   auto vertexShader   = _compileRawShader(vertexCode, "vertex");
   auto fragmentShader = _compileRawShader(fragmentCode, "fragment");
 
@@ -1602,8 +1878,17 @@ ThinEngine::createShaderProgram(const IPipelineContextPtr& pipelineContext,
 #else
   auto shaderVersion = (_webGLVersion > 1.f) ? "#version 330\n#define WEBGL2 \n" : "";
 #endif
-  auto vertexShader   = _compileShader(vertexCode, "vertex", defines, shaderVersion);
-  auto fragmentShader = _compileShader(fragmentCode, "fragment", defines, shaderVersion);
+  const auto vertexSource   = _ConcatenateShader(vertexCode, defines, shaderVersion);
+  const auto fragmentSource = _ConcatenateShader(fragmentCode, defines, shaderVersion);
+
+  auto webGLPipelineContext = std::static_pointer_cast<WebGLPipelineContext>(pipelineContext);
+  if (auto program
+      = _getCachedShaderProgram(webGLPipelineContext, vertexSource, fragmentSource, context)) {
+    return program;
+  }
+
+  auto vertexShader   = _compileRawShader(vertexSource, "vertex");
+  auto fragmentShader = _compileRawShader(fragmentSource, "fragment");
 
   return _createShaderProgram(std::static_pointer_cast<WebGLPipelineContext>(pipelineContext),
                               vertexShader, fragmentShader, context, transformFeedbackVaryings);
@@ -1636,6 +1921,10 @@ WebGLProgramPtr ThinEngine::_createShaderProgram(
   context->attachShader(shaderProgram.get(), vertexShader.get());
   context->attachShader(shaderProgram.get(), fragmentShader.get());
 
+  if (_programBinaryCache) {
+    context->programParameteri(shaderProgram.get(), GL::PROGRAM_BINARY_RETRIEVABLE_HINT, 1);
+  }
+
   context->linkProgram(shaderProgram.get());
 
   pipelineContext->context        = context;
@@ -1659,7 +1948,7 @@ void ThinEngine::_finalizePipelineContext(WebGLPipelineContext* pipelineContext)
   auto linked = context->getProgramParameter(program.get(), GL::LINK_STATUS);
   if (!linked) { // Get more info
     // Vertex
-    if (!_gl->getShaderParameter(vertexShader.get(), GL::COMPILE_STATUS)) {
+    if (vertexShader && !_gl->getShaderParameter(vertexShader.get(), GL::COMPILE_STATUS)) {
       auto log = _gl->getShaderInfoLog(vertexShader.get());
       if (!log.empty()) {
         pipelineContext->vertexCompilationError = log;
@@ -1668,7 +1957,7 @@ void ThinEngine::_finalizePipelineContext(WebGLPipelineContext* pipelineContext)
     }
 
     // Fragment
-    if (!_gl->getShaderParameter(fragmentShader.get(), GL::COMPILE_STATUS)) {
+    if (fragmentShader && !_gl->getShaderParameter(fragmentShader.get(), GL::COMPILE_STATUS)) {
       auto log = _gl->getShaderInfoLog(fragmentShader.get());
       if (!log.empty()) {
         pipelineContext->fragmentCompilationError = log;
@@ -1696,8 +1985,17 @@ void ThinEngine::_finalizePipelineContext(WebGLPipelineContext* pipelineContext)
     }
   }
 
-  context->deleteShader(vertexShader.get());
-  context->deleteShader(fragmentShader.get());
+  // The shaders are null when the program was loaded from a binary or precompiled
+  if (vertexShader && fragmentShader) {
+    if (_programBinaryCache && !pipelineContext->programBinaryCacheKey.empty()) {
+      GL::GLenum binaryFormat = 0;
+      const auto binary       = context->getProgramBinary(program.get(), binaryFormat);
+      _programBinaryCache->save(pipelineContext->programBinaryCacheKey, binaryFormat, binary);
+    }
+
+    context->deleteShader(vertexShader.get());
+    context->deleteShader(fragmentShader.get());
+  }
 
   pipelineContext->vertexShader   = nullptr;
   pipelineContext->fragmentShader = nullptr;
@@ -1905,6 +2203,16 @@ void ThinEngine::setMatrices(const WebGLUniformLocationPtr& uniform, const Float
   _gl->uniformMatrix4fv(uniform.get(), false, matrices);
 }
 
+void ThinEngine::setMatrix4x4(const WebGLUniformLocationPtr& uniform,
+                              const std::array<float, 16>& matrix)
+{
+  if (!uniform) {
+    return;
+  }
+
+  _gl->uniformMatrix4fv(uniform.get(), false, matrix);
+}
+
 void ThinEngine::setMatrix3x3(const WebGLUniformLocationPtr& uniform, const Float32Array& matrix)
 {
   if (!uniform) {
@@ -2299,17 +2607,22 @@ InternalTexturePtr ThinEngine::createTexture(
     }
   }
   else {
-    auto onload = [this, fromBlob, texture, scene, noMipmap, format, extension,
-                   samplingMode](const Image& img) {
+    auto onloadLevels = [this, fromBlob, texture, scene, noMipmap, format, extension,
+                         samplingMode](const Image& img, const std::vector<Image>& mipMaps) {
       if (fromBlob && !_doNotHandleContextLost) {
         // We need to store the image if we need to rebuild the texture in case of a webgl context
         // lost
         texture->_buffer = img;
       }
 
+      // The mip levels generated by the texture pipeline replace generateMipmap, the branches
+      // which cannot upload them generate the mip levels instead
+      const auto hasMipMaps = !noMipmap && !mipMaps.empty();
+
+      // The process function is run synchronously, the image is not copied
       _prepareWebGLTexture(
         texture, scene, img.width, img.height, texture->invertY, noMipmap, false,
-        [this, scene, img, format, extension,
+        [this, scene, &img, &mipMaps, hasMipMaps, format, extension,
          texture](int potWidth, int potHeight, const std::function<void()>& continuationCallback) {
           auto isPot = (img.width == potWidth && img.height == potHeight);
           auto internalFormat
@@ -2318,6 +2631,14 @@ InternalTexturePtr ThinEngine::createTexture(
           if (isPot) {
             _gl->texImage2D(GL::TEXTURE_2D, 0, static_cast<int>(internalFormat), img.width,
                             img.height, 0, GL::RGBA, GL::UNSIGNED_BYTE, &img.data);
+            if (hasMipMaps) {
+              for (size_t level = 0; level < mipMaps.size(); ++level) {
+                const auto& mipMap = mipMaps[level];
+                _gl->texImage2D(GL::TEXTURE_2D, static_cast<int>(level + 1),
+                                static_cast<int>(internalFormat), mipMap.width, mipMap.height, 0,
+                                GL::RGBA, GL::UNSIGNED_BYTE, &mipMap.data);
+              }
+            }
             return false;
           }
 
@@ -2338,6 +2659,9 @@ InternalTexturePtr ThinEngine::createTexture(
             _gl->texImage2D(GL::TEXTURE_2D, 0, static_cast<int>(internalFormat),
                             internalFormat, GL::UNSIGNED_BYTE, _workingCanvas);
 #endif
+            if (hasMipMaps) {
+              _gl->generateMipmap(GL::TEXTURE_2D);
+            }
             texture->width  = potWidth;
             texture->height = potHeight;
 
@@ -2351,9 +2675,12 @@ InternalTexturePtr ThinEngine::createTexture(
                             img.height, 0, GL::RGBA, GL::UNSIGNED_BYTE, &img.data);
 
             _rescaleTexture(source, texture, scene, internalFormat,
-                            [this, texture, source, continuationCallback]() {
+                            [this, texture, source, hasMipMaps, continuationCallback]() {
                               _releaseTexture(source);
                               _bindTextureDirectly(GL::TEXTURE_2D, texture);
+                              if (hasMipMaps) {
+                                _gl->generateMipmap(GL::TEXTURE_2D);
+                              }
 
                               continuationCallback();
                             });
@@ -2361,17 +2688,26 @@ InternalTexturePtr ThinEngine::createTexture(
 
           return true;
         },
-        samplingMode);
+        samplingMode, hasMipMaps);
     };
+    auto onload = [onloadLevels](const Image& img) { onloadLevels(img, {}); };
 
     if (!fromData || isBase64) {
       if (url.empty()) {
         // onload(buffer);
       }
+      else if (_texturePipeline) {
+        _texturePipeline->loadImageFromUrl(url, invertY, onloadLevels, onInternalError);
+      }
       else {
         ThinEngine::_FileToolsLoadImageFromUrl(url, onload, onInternalError, invertY, mimeType);
       }
     }
+    else if (_texturePipeline && buffer.has_value()
+             && std::holds_alternative<ArrayBuffer>(*buffer)) {
+      _texturePipeline->decodeAsync(url, std::get<ArrayBuffer>(*buffer), invertY, onloadLevels,
+                                    onInternalError);
+    }
     else if (buffer.has_value()
              && (std::holds_alternative<std::string>(*buffer)
                  || std::holds_alternative<ArrayBuffer>(*buffer)
@@ -2726,7 +3062,7 @@ void ThinEngine::_uploadArrayBufferViewToTexture(const InternalTexturePtr& textu
 
 void ThinEngine::_prepareWebGLTextureContinuation(const InternalTexturePtr& texture, Scene* scene,
                                                   bool noMipmap, bool isCompressed,
-                                                  unsigned int samplingMode)
+                                                  unsigned int samplingMode, bool mipMapsUploaded)
 {
   if (!_gl) {
     return;
@@ -2738,7 +3074,7 @@ void ThinEngine::_prepareWebGLTextureContinuation(const InternalTexturePtr& text
   gl.texParameteri(GL::TEXTURE_2D, GL::TEXTURE_MAG_FILTER, filters.mag);
   gl.texParameteri(GL::TEXTURE_2D, GL::TEXTURE_MIN_FILTER, filters.min);
 
-  if (!noMipmap && !isCompressed) {
+  if (!noMipmap && !isCompressed && !mipMapsUploaded) {
     gl.generateMipmap(GL::TEXTURE_2D);
   }
 
@@ -2758,7 +3094,7 @@ void ThinEngine::_prepareWebGLTexture(
   std::optional<bool> invertY, bool noMipmap, bool isCompressed,
   const std::function<bool(int width, int height,
                            const std::function<void()>& continuationCallback)>& processFunction,
-  unsigned int samplingMode)
+  unsigned int samplingMode, bool mipMapsUploaded)
 {
   auto maxTextureSize = getCaps().maxTextureSize;
   auto potWidth
@@ -2791,13 +3127,15 @@ void ThinEngine::_prepareWebGLTexture(
   texture->isReady    = true;
 
   if (processFunction(potWidth, potHeight, [=]() {
-        _prepareWebGLTextureContinuation(texture, scene, noMipmap, isCompressed, samplingMode);
+        _prepareWebGLTextureContinuation(texture, scene, noMipmap, isCompressed, samplingMode,
+                                         mipMapsUploaded);
       })) {
     // Returning as texture needs extra async steps
     return;
   }
 
-  _prepareWebGLTextureContinuation(texture, scene, noMipmap, isCompressed, samplingMode);
+  _prepareWebGLTextureContinuation(texture, scene, noMipmap, isCompressed, samplingMode,
+                                   mipMapsUploaded);
 }
 
 WebGLRenderbufferPtr ThinEngine::_setupFramebufferDepthAttachments(bool generateStencilBuffer,
@@ -3294,7 +3632,13 @@ void ThinEngine::releaseEffects()
     _deletePipelineContext(webGLPipelineContext);
   }
 
-  _compiledEffects = {};
+  for (const auto& warmedUpEffectItem : _warmedUpEffects) {
+    _deletePipelineContext(warmedUpEffectItem.second->getPipelineContext());
+  }
+
+  _compiledEffects             = {};
+  _compiledEffectsByDefinesKey = {};
+  _warmedUpEffects             = {};
 }
 
 void ThinEngine::dispose()
@@ -3319,6 +3663,12 @@ void ThinEngine::dispose()
   // Release effects
   releaseEffects();
 
+  // Drop the decoded images, their upload callbacks reference the engine
+  if (_texturePipeline) {
+    _texturePipeline->clear();
+    _texturePipeline = nullptr;
+  }
+
   // Unbind
   unbindAllAttributes();
   _boundUniforms = {};
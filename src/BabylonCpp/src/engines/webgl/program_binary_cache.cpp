@@ -0,0 +1,177 @@
+#include <babylon/engines/webgl/program_binary_cache.h>
+
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+#include <babylon/core/filesystem.h>
+#include <babylon/core/json_util.h>
+#include <babylon/core/logging.h>
+
+namespace BABYLON {
+
+namespace {
+
+// File header of a program binary
+struct ProgramBinaryHeader {
+  uint32_t magic;
+  uint32_t binaryFormat;
+  uint64_t binarySize;
+  uint64_t binaryHash;
+}; // end of struct ProgramBinaryHeader
+
+constexpr uint32_t ProgramBinaryMagic = 0x31425042; // "BPB1"
+constexpr uint64_t FnvOffsetBasis     = 0xcbf29ce484222325ull;
+constexpr uint64_t FnvPrime           = 0x100000001b3ull;
+
+// 64-bit FNV-1a, stable across runs and standard libraries unlike std::hash
+uint64_t Fnv1a(const uint8_t* data, size_t size, uint64_t hash = FnvOffsetBasis)
+{
+  for (size_t i = 0; i < size; ++i) {
+    hash = (hash ^ data[i]) * FnvPrime;
+  }
+  return hash;
+}
+
+uint64_t Fnv1a(const std::string& value, uint64_t hash = FnvOffsetBasis)
+{
+  // The terminating null character separates the hashed strings
+  return Fnv1a(reinterpret_cast<const uint8_t*>(value.c_str()), value.size() + 1, hash);
+}
+
+} // end of anonymous namespace
+
+ProgramBinaryCache::ProgramBinaryCache(const std::string& directory)
+    : _directory{Filesystem::standardizePath(directory)}
+{
+  if (!Filesystem::isDirectory(_directory) && !Filesystem::createDirectory(_directory)) {
+    BABYLON_LOGF_WARN("ProgramBinaryCache", "Unable to create the cache directory %s",
+                      _directory.c_str())
+  }
+}
+
+ProgramBinaryCache::~ProgramBinaryCache() = default;
+
+std::string ProgramBinaryCache::GetKey(const std::string& driverIdentity,
+                                       const std::string& vertexCode,
+                                       const std::string& fragmentCode)
+{
+  const auto hash = Fnv1a(fragmentCode, Fnv1a(vertexCode, Fnv1a(driverIdentity)));
+
+  std::ostringstream key;
+  key << std::hex << std::setw(16) << std::setfill('0') << hash;
+  return key.str();
+}
+
+const std::string& ProgramBinaryCache::directory() const
+{
+  return _directory;
+}
+
+bool ProgramBinaryCache::load(const std::string& key, unsigned int& binaryFormat,
+                              Uint8Array& binary) const
+{
+  const auto path = _getPath(key);
+  if (!Filesystem::isFile(path)) {
+    return false;
+  }
+
+  // Truncated or corrupted files are removed
+  const auto contents = Filesystem::readBinaryFile(path.c_str());
+  ProgramBinaryHeader header{};
+  if (contents.size() < sizeof(header)) {
+    remove(key);
+    return false;
+  }
+
+  std::memcpy(&header, contents.data(), sizeof(header));
+  const auto data = contents.data() + sizeof(header);
+  if (header.magic != ProgramBinaryMagic || header.binarySize != contents.size() - sizeof(header)
+      || header.binaryHash != Fnv1a(data, header.binarySize)) {
+    remove(key);
+    return false;
+  }
+
+  binaryFormat = header.binaryFormat;
+  binary.assign(data, data + header.binarySize);
+  return true;
+}
+
+bool ProgramBinaryCache::save(const std::string& key, unsigned int binaryFormat,
+                              const Uint8Array& binary) const
+{
+  if (binary.empty()) {
+    return false;
+  }
+
+  ProgramBinaryHeader header{};
+  header.magic        = ProgramBinaryMagic;
+  header.binaryFormat = binaryFormat;
+  header.binarySize   = binary.size();
+  header.binaryHash   = Fnv1a(binary.data(), binary.size());
+
+  ArrayBuffer contents(sizeof(header) + binary.size());
+  std::memcpy(contents.data(), &header, sizeof(header));
+  std::memcpy(contents.data() + sizeof(header), binary.data(), binary.size());
+
+  return Filesystem::writeBinaryFile(_getPath(key).c_str(), contents);
+}
+
+void ProgramBinaryCache::remove(const std::string& key) const
+{
+  Filesystem::removeFile(_getPath(key));
+}
+
+std::vector<EffectWarmUpEntry> ProgramBinaryCache::loadEffectWarmUpEntries() const
+{
+  std::vector<EffectWarmUpEntry> entries;
+
+  const auto path = _directory + "effects.json";
+  if (!Filesystem::isFile(path)) {
+    return entries;
+  }
+
+  const auto contents = json::parse(Filesystem::readFileContents(path.c_str()), nullptr, false);
+  if (!contents.is_array()) {
+    return entries;
+  }
+
+  for (const auto& item : contents) {
+    const auto key = json_util::get_string(item, "key");
+    if (key.empty()) {
+      continue;
+    }
+    EffectWarmUpEntry entry;
+    entry.key = key;
+    if (json_util::has_valid_key_value(item, "indexParameters")) {
+      const auto& indexParameters = item["indexParameters"];
+      for (auto it = indexParameters.begin(); it != indexParameters.end(); ++it) {
+        if (it.value().is_number_unsigned()) {
+          entry.indexParameters[it.key()] = it.value().get<unsigned int>();
+        }
+      }
+    }
+    entries.emplace_back(std::move(entry));
+  }
+
+  return entries;
+}
+
+bool ProgramBinaryCache::saveEffectWarmUpEntries(
+  const std::vector<EffectWarmUpEntry>& entries) const
+{
+  auto contents = json::array();
+  for (const auto& entry : entries) {
+    contents.push_back({{"key", entry.key}, {"indexParameters", entry.indexParameters}});
+  }
+
+  const auto path = _directory + "effects.json";
+  return Filesystem::writeFileContents(path.c_str(), contents.dump());
+}
+
+std::string ProgramBinaryCache::_getPath(const std::string& key) const
+{
+  return _directory + key + ".bin";
+}
+
+} // end of namespace BABYLON
@@ -16,6 +16,19 @@ SceneInstrumentation::SceneInstrumentation(Scene* iScene)
                                           get_captureActiveMeshesEvaluationTime,
                                         &SceneInstrumentation::
                                           set_captureActiveMeshesEvaluationTime}
+    , activeMeshesParallelEvaluationTimeCounter{this,
+                                                &SceneInstrumentation::
+                                                  get_activeMeshesParallelEvaluationTimeCounter}
+    , captureActiveMeshesParallelEvaluationTime{this,
+                                                &SceneInstrumentation::
+                                                  get_captureActiveMeshesParallelEvaluationTime,
+                                                &SceneInstrumentation::
+                                                  set_captureActiveMeshesParallelEvaluationTime}
+    , skeletonsEvaluationTimeCounter{this,
+                                     &SceneInstrumentation::get_skeletonsEvaluationTimeCounter}
+    , captureSkeletonsEvaluationTime{this,
+                                     &SceneInstrumentation::get_captureSkeletonsEvaluationTime,
+                                     &SceneInstrumentation::set_captureSkeletonsEvaluationTime}
     , renderTargetsRenderTimeCounter{this,
                                      &SceneInstrumentation::get_renderTargetsRenderTimeCounter}
     , captureRenderTargetsRenderTime{this,
@@ -46,7 +59,12 @@ SceneInstrumentation::SceneInstrumentation(Scene* iScene)
     , captureCameraRenderTime{this, &SceneInstrumentation::get_captureCameraRenderTime,
                               &SceneInstrumentation::set_captureCameraRenderTime}
     , drawCallsCounter{this, &SceneInstrumentation::get_drawCallsCounter}
+    , worldMatrixUpdatesCounter{this, &SceneInstrumentation::get_worldMatrixUpdatesCounter}
+    , avoidedStateChangesCounter{this, &SceneInstrumentation::get_avoidedStateChangesCounter}
+    , activeBonesCounter{this, &SceneInstrumentation::get_activeBonesCounter}
     , _captureActiveMeshesEvaluationTime{false}
+    , _captureActiveMeshesParallelEvaluationTime{false}
+    , _captureSkeletonsEvaluationTime{false}
     , _captureRenderTargetsRenderTime{false}
     , _captureFrameTime{false}
     , _captureRenderTime{false}
@@ -58,6 +76,10 @@ SceneInstrumentation::SceneInstrumentation(Scene* iScene)
     , _captureCameraRenderTime{false}
     , _onBeforeActiveMeshesEvaluationObserver{nullptr}
     , _onAfterActiveMeshesEvaluationObserver{nullptr}
+    , _onBeforeActiveMeshesParallelEvaluationObserver{nullptr}
+    , _onAfterActiveMeshesParallelEvaluationObserver{nullptr}
+    , _onBeforeSkeletonsEvaluationObserver{nullptr}
+    , _onAfterSkeletonsEvaluationObserver{nullptr}
     , _onBeforeRenderTargetsRenderObserver{nullptr}
     , _onAfterRenderTargetsRenderObserver{nullptr}
     , _onAfterRenderObserver{nullptr}
@@ -81,6 +103,14 @@ SceneInstrumentation::SceneInstrumentation(Scene* iScene)
           _activeMeshesEvaluationTime.fetchNewFrame();
         }
 
+        if (_captureActiveMeshesParallelEvaluationTime) {
+          _activeMeshesParallelEvaluationTime.fetchNewFrame();
+        }
+
+        if (_captureSkeletonsEvaluationTime) {
+          _skeletonsEvaluationTime.fetchNewFrame();
+        }
+
         if (_captureRenderTargetsRenderTime) {
           _renderTargetsRenderTime.fetchNewFrame();
         }
@@ -169,6 +199,90 @@ void SceneInstrumentation::set_captureActiveMeshesEvaluationTime(bool value)
   }
 }
 
+PerfCounter& SceneInstrumentation::get_activeMeshesParallelEvaluationTimeCounter()
+{
+  return _activeMeshesParallelEvaluationTime;
+}
+
+bool SceneInstrumentation::get_captureActiveMeshesParallelEvaluationTime() const
+{
+  return _captureActiveMeshesParallelEvaluationTime;
+}
+
+void SceneInstrumentation::set_captureActiveMeshesParallelEvaluationTime(bool value)
+{
+  if (value == _captureActiveMeshesParallelEvaluationTime) {
+    return;
+  }
+
+  _captureActiveMeshesParallelEvaluationTime = value;
+
+  if (value) {
+    _onBeforeActiveMeshesParallelEvaluationObserver
+      = scene->onBeforeActiveMeshesParallelEvaluationObservable.add(
+        [this](Scene* /*scene*/, EventState& /*es*/) {
+          Tools::StartPerformanceCounter("Parallel active meshes evaluation");
+          _activeMeshesParallelEvaluationTime.beginMonitoring();
+        });
+
+    _onAfterActiveMeshesParallelEvaluationObserver
+      = scene->onAfterActiveMeshesParallelEvaluationObservable.add(
+        [this](Scene* /*scene*/, EventState& /*es*/) {
+          Tools::EndPerformanceCounter("Parallel active meshes evaluation");
+          _activeMeshesParallelEvaluationTime.endMonitoring();
+        });
+  }
+  else {
+    scene->onBeforeActiveMeshesParallelEvaluationObservable.remove(
+      _onBeforeActiveMeshesParallelEvaluationObserver);
+    _onBeforeActiveMeshesParallelEvaluationObserver = nullptr;
+
+    scene->onAfterActiveMeshesParallelEvaluationObservable.remove(
+      _onAfterActiveMeshesParallelEvaluationObserver);
+    _onAfterActiveMeshesParallelEvaluationObserver = nullptr;
+  }
+}
+
+PerfCounter& SceneInstrumentation::get_skeletonsEvaluationTimeCounter()
+{
+  return _skeletonsEvaluationTime;
+}
+
+bool SceneInstrumentation::get_captureSkeletonsEvaluationTime() const
+{
+  return _captureSkeletonsEvaluationTime;
+}
+
+void SceneInstrumentation::set_captureSkeletonsEvaluationTime(bool value)
+{
+  if (value == _captureSkeletonsEvaluationTime) {
+    return;
+  }
+
+  _captureSkeletonsEvaluationTime = value;
+
+  if (value) {
+    _onBeforeSkeletonsEvaluationObserver = scene->onBeforeSkeletonsEvaluationObservable.add(
+      [this](Scene* /*scene*/, EventState& /*es*/) {
+        Tools::StartPerformanceCounter("Skeletons evaluation");
+        _skeletonsEvaluationTime.beginMonitoring();
+      });
+
+    _onAfterSkeletonsEvaluationObserver = scene->onAfterSkeletonsEvaluationObservable.add(
+      [this](Scene* /*scene*/, EventState& /*es*/) {
+        Tools::EndPerformanceCounter("Skeletons evaluation");
+        _skeletonsEvaluationTime.endMonitoring();
+      });
+  }
+  else {
+    scene->onBeforeSkeletonsEvaluationObservable.remove(_onBeforeSkeletonsEvaluationObserver);
+    _onBeforeSkeletonsEvaluationObserver = nullptr;
+
+    scene->onAfterSkeletonsEvaluationObservable.remove(_onAfterSkeletonsEvaluationObserver);
+    _onAfterSkeletonsEvaluationObserver = nullptr;
+  }
+}
+
 PerfCounter& SceneInstrumentation::get_renderTargetsRenderTimeCounter()
 {
   return _renderTargetsRenderTime;
@@ -474,6 +588,21 @@ PerfCounter& SceneInstrumentation::get_drawCallsCounter()
   return scene->getEngine()->_drawCalls;
 }
 
+PerfCounter& SceneInstrumentation::get_worldMatrixUpdatesCounter()
+{
+  return scene->_worldMatrixUpdates;
+}
+
+PerfCounter& SceneInstrumentation::get_avoidedStateChangesCounter()
+{
+  return scene->_avoidedStateChanges;
+}
+
+PerfCounter& SceneInstrumentation::get_activeBonesCounter()
+{
+  return scene->_activeBones;
+}
+
 void SceneInstrumentation::dispose(bool /*doNotRecurse*/, bool /*disposeMaterialAndTextures*/)
 {
   scene->onAfterRenderObservable.remove(_onAfterRenderObserver);
@@ -485,6 +614,20 @@ void SceneInstrumentation::dispose(bool /*doNotRecurse*/, bool /*disposeMaterial
   scene->onAfterActiveMeshesEvaluationObservable.remove(_onAfterActiveMeshesEvaluationObserver);
   _onAfterActiveMeshesEvaluationObserver = nullptr;
 
+  scene->onBeforeActiveMeshesParallelEvaluationObservable.remove(
+    _onBeforeActiveMeshesParallelEvaluationObserver);
+  _onBeforeActiveMeshesParallelEvaluationObserver = nullptr;
+
+  scene->onAfterActiveMeshesParallelEvaluationObservable.remove(
+    _onAfterActiveMeshesParallelEvaluationObserver);
+  _onAfterActiveMeshesParallelEvaluationObserver = nullptr;
+
+  scene->onBeforeSkeletonsEvaluationObservable.remove(_onBeforeSkeletonsEvaluationObserver);
+  _onBeforeSkeletonsEvaluationObserver = nullptr;
+
+  scene->onAfterSkeletonsEvaluationObservable.remove(_onAfterSkeletonsEvaluationObserver);
+  _onAfterSkeletonsEvaluationObserver = nullptr;
+
   scene->onBeforeRenderTargetsRenderObservable.remove(_onBeforeRenderTargetsRenderObserver);
   _onBeforeRenderTargetsRenderObserver = nullptr;
 
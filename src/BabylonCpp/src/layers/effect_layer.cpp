@@ -348,6 +348,9 @@ bool EffectLayer::_isReady(SubMesh* subMesh, bool useInstances,
   if (useInstances) {
     defines.emplace_back("#define INSTANCES");
     MaterialHelper::PushAttributesForInstances(attribs);
+    if (subMesh->getRenderingMesh()->hasThinInstances()) {
+      defines.emplace_back("#define THIN_INSTANCES");
+    }
   }
 
   _addCustomEffectDefines(defines);
@@ -494,9 +497,11 @@ void EffectLayer::_renderSubMesh(SubMesh* subMesh, bool enableAlphaMode)
     return;
   }
 
-  auto hardwareInstancedRendering = (engine->getCaps().instancedArrays)
-                                    && (stl_util::contains(batch->visibleInstances, subMesh->_id))
-                                    && (!batch->visibleInstances[subMesh->_id].empty());
+  auto hardwareInstancedRendering
+    = (engine->getCaps().instancedArrays)
+      && ((stl_util::contains(batch->visibleInstances, subMesh->_id)
+           && !batch->visibleInstances[subMesh->_id].empty())
+          || mesh->hasThinInstances());
 
   _setEmissiveTextureAndColor(mesh, subMesh, material);
 
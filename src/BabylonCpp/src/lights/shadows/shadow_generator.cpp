@@ -717,25 +717,36 @@ void ShadowGenerator::_renderSubMeshForShadowMap(SubMesh* subMesh)
     return;
   }
 
-  auto hardwareInstancedRendering = (engine->getCaps().instancedArrays)
-                                    && (stl_util::contains(batch->visibleInstances, subMesh->_id))
-                                    && (!batch->visibleInstances[subMesh->_id].empty());
+  auto hardwareInstancedRendering
+    = (engine->getCaps().instancedArrays)
+      && ((stl_util::contains(batch->visibleInstances, subMesh->_id)
+           && !batch->visibleInstances[subMesh->_id].empty())
+          || mesh->hasThinInstances());
   if (isReady(subMesh, hardwareInstancedRendering)) {
+    static const auto biasAndScaleHandle     = Effect::UniformHandle("biasAndScale");
+    static const auto viewProjectionHandle   = Effect::UniformHandle("viewProjection");
+    static const auto lightDataHandle        = Effect::UniformHandle("lightData");
+    static const auto depthValuesHandle      = Effect::UniformHandle("depthValues");
+    static const auto diffuseMatrixHandle    = Effect::UniformHandle("diffuseMatrix");
+    static const auto boneTextureWidthHandle = Effect::UniformHandle("boneTextureWidth");
+    static const auto bonesHandle            = Effect::UniformHandle("mBones");
+    static const auto worldHandle            = Effect::UniformHandle("world");
+
     engine->enableEffect(_effect);
     mesh->_bind(subMesh, _effect, Material::TriangleFillMode);
 
-    _effect->setFloat3("biasAndScale", bias(), normalBias(), depthScale());
+    _effect->setFloat3(biasAndScaleHandle, bias(), normalBias(), depthScale());
 
-    _effect->setMatrix("viewProjection", getTransformMatrix());
+    _effect->setMatrix(viewProjectionHandle, getTransformMatrix());
     if (getLight()->getTypeID() == Light::LIGHTTYPEID_DIRECTIONALLIGHT) {
-      _effect->setVector3("lightData", _cachedDirection);
+      _effect->setVector3(lightDataHandle, _cachedDirection);
     }
     else {
-      _effect->setVector3("lightData", _cachedPosition);
+      _effect->setVector3(lightDataHandle, _cachedPosition);
     }
 
     if (scene->activeCamera()) {
-      _effect->setFloat2("depthValues", getLight()->getDepthMinZ(*scene->activeCamera()),
+      _effect->setFloat2(depthValuesHandle, getLight()->getDepthMinZ(*scene->activeCamera()),
                          getLight()->getDepthMinZ(*scene->activeCamera())
                            + getLight()->getDepthMaxZ(*scene->activeCamera()));
     }
@@ -745,9 +756,9 @@ void ShadowGenerator::_renderSubMeshForShadowMap(SubMesh* subMesh)
       auto alphaTexture = material->getAlphaTestTexture();
       if (alphaTexture) {
         _effect->setTexture("diffuseSampler", alphaTexture);
-        _effect->setMatrix("diffuseMatrix", alphaTexture->getTextureMatrix() ?
-                                              *alphaTexture->getTextureMatrix() :
-                                              _defaultTextureMatrix);
+        _effect->setMatrix(diffuseMatrixHandle, alphaTexture->getTextureMatrix() ?
+                                                  *alphaTexture->getTextureMatrix() :
+                                                  _defaultTextureMatrix);
       }
     }
 
@@ -763,10 +774,10 @@ void ShadowGenerator::_renderSubMeshForShadowMap(SubMesh* subMesh)
         }
 
         _effect->setTexture("boneSampler", boneTexture);
-        _effect->setFloat("boneTextureWidth", 4.f * (skeleton->bones.size() + 1));
+        _effect->setFloat(boneTextureWidthHandle, 4.f * (skeleton->bones.size() + 1));
       }
       else {
-        _effect->setMatrices("mBones", skeleton->getTransformMatrices((mesh.get())));
+        _effect->setMatrices(bonesHandle, skeleton->getTransformMatrices((mesh.get())));
       }
     }
 
@@ -785,7 +796,7 @@ void ShadowGenerator::_renderSubMeshForShadowMap(SubMesh* subMesh)
     mesh->_processRendering(
       subMesh, _effect, Material::TriangleFillMode, batch, hardwareInstancedRendering,
       [&](bool /*isInstance*/, const Matrix& world, Material* /*effectiveMaterial*/) {
-        _effect->setMatrix("world", world);
+        _effect->setMatrix(worldHandle, world);
       });
 
     if (forceBackFacesOnly) {
@@ -967,6 +978,9 @@ bool ShadowGenerator::isReady(SubMesh* subMesh, bool useInstances)
   if (useInstances) {
     defines.emplace_back("#define INSTANCES");
     MaterialHelper::PushAttributesForInstances(attribs);
+    if (subMesh->getRenderingMesh()->hasThinInstances()) {
+      defines.emplace_back("#define THIN_INSTANCES");
+    }
   }
 
   if (customShaderOptions) {
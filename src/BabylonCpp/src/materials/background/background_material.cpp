@@ -757,7 +757,8 @@ bool BackgroundMaterial::isReadyForSubMesh(AbstractMesh* mesh, BaseSubMesh* subM
                                         _shouldTurnAlphaTestOn(mesh), defines);
 
   // Values that need to be evaluated on every frame
-  MaterialHelper::PrepareDefinesForFrameBoundValues(scene, engine, defines, useInstances);
+  MaterialHelper::PrepareDefinesForFrameBoundValues(scene, engine, defines, useInstances,
+                                                    std::nullopt, mesh->hasThinInstances());
 
   // Attribs
   if (MaterialHelper::PrepareDefinesForAttributes(mesh, defines, false, true, false)) {
@@ -1,5 +1,7 @@
 #include <babylon/materials/effect.h>
 
+#include <limits>
+#include <mutex>
 #include <sstream>
 
 #include <babylon/babylon_stl_util.h>
@@ -17,6 +19,7 @@
 #include <babylon/maths/color3.h>
 #include <babylon/maths/vector2.h>
 #include <babylon/maths/vector4.h>
+#include <babylon/meshes/vertex_buffer.h>
 #include <babylon/misc/string_tools.h>
 #include <babylon/misc/tools.h>
 #include <babylon/utils/base64.h>
@@ -66,6 +69,7 @@ Effect::Effect(
     _transformFeedbackVaryings = options.transformFeedbackVaryings;
 
     stl_util::concat(_uniformsNames, options.samplers);
+    _resolveUniformSlots();
 
     if (!options.uniformBuffersNames.empty()) {
       for (unsigned int i = 0; i < options.uniformBuffersNames.size(); ++i) {
@@ -234,6 +238,19 @@ int Effect::getAttributeLocation(unsigned int index)
   return -1;
 }
 
+const std::vector<size_t>& Effect::getAttributeKindSlots()
+{
+  if (_attributeKindSlots.size() != _attributesNames.size()) {
+    _attributeKindSlots.clear();
+    _attributeKindSlots.reserve(_attributesNames.size());
+    for (const auto& attributeName : _attributesNames) {
+      _attributeKindSlots.emplace_back(VertexBuffer::KindSlot(attributeName));
+    }
+  }
+
+  return _attributeKindSlots;
+}
+
 int Effect::getAttributeLocationByName(const std::string& _name)
 {
   return stl_util::contains(_attributeLocationByName, _name) ? _attributeLocationByName[_name] : -1;
@@ -244,18 +261,54 @@ size_t Effect::getAttributesCount()
   return _attributes.size();
 }
 
+void Effect::_resolveUniformSlots()
+{
+  _uniformHandlesByName.clear();
+  _uniformHandlesByName.reserve(_uniformsNames.size());
+  _uniformSlotsByHandle.clear();
+  for (size_t slot = 0; slot < _uniformsNames.size(); ++slot) {
+    const auto& uniformName = _uniformsNames[slot];
+    if (stl_util::contains(_uniformHandlesByName, uniformName)) {
+      continue;
+    }
+    const auto handle                  = Effect::UniformHandle(uniformName);
+    _uniformHandlesByName[uniformName] = handle;
+    if (handle >= _uniformSlotsByHandle.size()) {
+      _uniformSlotsByHandle.resize(handle + 1, -1);
+    }
+    _uniformSlotsByHandle[handle] = static_cast<int>(slot);
+  }
+
+  _uniformLocations.assign(_uniformsNames.size(), nullptr);
+  _valueCache.assign(_uniformsNames.size(), UniformValue{});
+}
+
+size_t Effect::_getUniformHandle(const std::string& uniformName) const
+{
+  auto it = _uniformHandlesByName.find(uniformName);
+  return (it != _uniformHandlesByName.end()) ? it->second : std::numeric_limits<size_t>::max();
+}
+
+int Effect::_getUniformSlot(size_t uniformHandle) const
+{
+  return (uniformHandle < _uniformSlotsByHandle.size()) ? _uniformSlotsByHandle[uniformHandle] :
+                                                          -1;
+}
+
 int Effect::getUniformIndex(const std::string& uniformName)
 {
-  return stl_util::index_of(_uniformsNames, uniformName);
+  return _getUniformSlot(_getUniformHandle(uniformName));
 }
 
 WebGLUniformLocationPtr Effect::getUniform(const std::string& uniformName)
 {
-  if (stl_util::contains(_uniforms, uniformName)) {
-    return _uniforms[uniformName];
-  }
+  return getUniform(_getUniformHandle(uniformName));
+}
 
-  return nullptr;
+WebGLUniformLocationPtr Effect::getUniform(size_t uniformHandle)
+{
+  const auto slot = _getUniformSlot(uniformHandle);
+  return (slot >= 0) ? _uniformLocations[slot] : nullptr;
 }
 
 std::vector<std::string>& Effect::getSamplers()
@@ -385,7 +438,7 @@ void Effect::_rebuildProgram(
 
 void Effect::_prepareEffect()
 {
-  _valueCache.clear();
+  _valueCache.assign(_uniformsNames.size(), UniformValue{});
 
   auto previousPipelineContext = _pipelineContext;
 
@@ -417,7 +470,10 @@ void Effect::_prepareEffect()
 
         auto uniforms = engine->getUniforms(_pipelineContext, _uniformsNames);
         for (auto& [uniformsName, uniformLocation] : uniforms) {
-          _uniforms[uniformsName] = std::move(uniformLocation);
+          const auto slot = _getUniformSlot(_getUniformHandle(uniformsName));
+          if (slot >= 0) {
+            _uniformLocations[slot] = std::move(uniformLocation);
+          }
         }
 
         _attributes = engine->getAttributes(_pipelineContext, attributesNames);
@@ -588,94 +644,106 @@ void Effect::setTextureFromPostProcessOutput(const std::string& channel,
   }
 }
 
-bool Effect::_cacheMatrix(const std::string& uniformName, const Matrix& matrix)
+bool Effect::_cacheMatrix(size_t slot, const Matrix& matrix)
 {
-  auto flag = matrix.updateFlag;
-  if (stl_util::contains(_valueCache, uniformName) && !_valueCache[uniformName].empty()
-      && static_cast<int>(_valueCache[uniformName][0]) == flag) {
+  auto& cache     = _valueCache[slot];
+  const auto flag = matrix.updateFlag;
+  if (cache.size == 16 && cache.updateFlag == flag) {
     return false;
   }
 
-  if (_valueCache[uniformName].empty()) {
-    _valueCache[uniformName].emplace_back(static_cast<float>(flag));
-  }
-  else {
-    _valueCache[uniformName][0] = static_cast<float>(flag);
+  cache.size       = 16;
+  cache.updateFlag = flag;
+
+  return true;
+}
+
+bool Effect::_cacheFloat(size_t slot, float x)
+{
+  auto& cache = _valueCache[slot];
+  if (cache.size == 1 && stl_util::almost_equal(cache.values[0], x)) {
+    return false;
   }
 
+  cache.size      = 1;
+  cache.values[0] = x;
+
   return true;
 }
 
-bool Effect::_cacheFloat2(const std::string& uniformName, float x, float y)
+bool Effect::_cacheFloat2(size_t slot, float x, float y)
 {
-  if (!stl_util::contains(_valueCache, uniformName)) {
-    _valueCache[uniformName] = {x, y};
+  auto& cache = _valueCache[slot];
+  if (cache.size != 2) {
+    cache.size   = 2;
+    cache.values = {x, y, 0.f, 0.f};
     return true;
   }
 
   auto changed = false;
-  auto& cache  = _valueCache[uniformName];
-  if (!stl_util::almost_equal(cache[0], x)) {
-    cache[0] = x;
-    changed  = true;
+  if (!stl_util::almost_equal(cache.values[0], x)) {
+    cache.values[0] = x;
+    changed         = true;
   }
-  if (!stl_util::almost_equal(cache[1], y)) {
-    cache[1] = y;
-    changed  = true;
+  if (!stl_util::almost_equal(cache.values[1], y)) {
+    cache.values[1] = y;
+    changed         = true;
   }
 
   return changed;
 }
 
-bool Effect::_cacheFloat3(const std::string& uniformName, float x, float y, float z)
+bool Effect::_cacheFloat3(size_t slot, float x, float y, float z)
 {
-  if (!stl_util::contains(_valueCache, uniformName)) {
-    _valueCache[uniformName] = {x, y, z};
+  auto& cache = _valueCache[slot];
+  if (cache.size != 3) {
+    cache.size   = 3;
+    cache.values = {x, y, z, 0.f};
     return true;
   }
 
   auto changed = false;
-  auto& cache  = _valueCache[uniformName];
-  if (!stl_util::almost_equal(cache[0], x)) {
-    cache[0] = x;
-    changed  = true;
+  if (!stl_util::almost_equal(cache.values[0], x)) {
+    cache.values[0] = x;
+    changed         = true;
   }
-  if (!stl_util::almost_equal(cache[1], y)) {
-    cache[1] = y;
-    changed  = true;
+  if (!stl_util::almost_equal(cache.values[1], y)) {
+    cache.values[1] = y;
+    changed         = true;
   }
-  if (!stl_util::almost_equal(cache[2], z)) {
-    cache[2] = z;
-    changed  = true;
+  if (!stl_util::almost_equal(cache.values[2], z)) {
+    cache.values[2] = z;
+    changed         = true;
   }
 
   return changed;
 }
 
-bool Effect::_cacheFloat4(const std::string& uniformName, float x, float y, float z, float w)
+bool Effect::_cacheFloat4(size_t slot, float x, float y, float z, float w)
 {
-  if (!stl_util::contains(_valueCache, uniformName)) {
-    _valueCache[uniformName] = {x, y, z, w};
+  auto& cache = _valueCache[slot];
+  if (cache.size != 4) {
+    cache.size   = 4;
+    cache.values = {x, y, z, w};
     return true;
   }
 
   auto changed = false;
-  auto& cache  = _valueCache[uniformName];
-  if (!stl_util::almost_equal(cache[0], x)) {
-    cache[0] = x;
-    changed  = true;
+  if (!stl_util::almost_equal(cache.values[0], x)) {
+    cache.values[0] = x;
+    changed         = true;
   }
-  if (!stl_util::almost_equal(cache[1], y)) {
-    cache[1] = y;
-    changed  = true;
+  if (!stl_util::almost_equal(cache.values[1], y)) {
+    cache.values[1] = y;
+    changed         = true;
   }
-  if (!stl_util::almost_equal(cache[2], z)) {
-    cache[2] = z;
-    changed  = true;
+  if (!stl_util::almost_equal(cache.values[2], z)) {
+    cache.values[2] = z;
+    changed         = true;
   }
-  if (!stl_util::almost_equal(cache[3], w)) {
-    cache[3] = w;
-    changed  = true;
+  if (!stl_util::almost_equal(cache.values[3], w)) {
+    cache.values[3] = w;
+    changed         = true;
   }
 
   return changed;
@@ -706,130 +774,181 @@ void Effect::bindUniformBlock(const std::string& blockName, unsigned index)
 
 Effect& Effect::setInt(const std::string& uniformName, int value)
 {
-  Float32Array _value{static_cast<float>(value)};
-  if (stl_util::contains(_valueCache, uniformName) && (_valueCache[uniformName] == _value)) {
-    return *this;
-  }
-
-  _valueCache[uniformName] = _value;
+  return setInt(_getUniformHandle(uniformName), value);
+}
 
-  _engine->setInt(getUniform(uniformName), value);
+Effect& Effect::setInt(size_t uniformHandle, int value)
+{
+  const auto slot = _getUniformSlot(uniformHandle);
+  if (slot >= 0 && _cacheFloat(slot, static_cast<float>(value))) {
+    _engine->setInt(_uniformLocations[slot], value);
+  }
 
   return *this;
 }
 
 Effect& Effect::setIntArray(const std::string& uniformName, const Int32Array& array)
 {
-  _valueCache.erase(uniformName);
-  _engine->setIntArray(getUniform(uniformName), array);
+  const auto slot = _getUniformSlot(_getUniformHandle(uniformName));
+  if (slot >= 0) {
+    _valueCache[slot] = UniformValue{};
+    _engine->setIntArray(_uniformLocations[slot], array);
+  }
 
   return *this;
 }
 
 Effect& Effect::setIntArray2(const std::string& uniformName, const Int32Array& array)
 {
-  _valueCache.erase(uniformName);
-  _engine->setIntArray2(getUniform(uniformName), array);
+  const auto slot = _getUniformSlot(_getUniformHandle(uniformName));
+  if (slot >= 0) {
+    _valueCache[slot] = UniformValue{};
+    _engine->setIntArray2(_uniformLocations[slot], array);
+  }
 
   return *this;
 }
 
 Effect& Effect::setIntArray3(const std::string& uniformName, const Int32Array& array)
 {
-  _valueCache.erase(uniformName);
-  _engine->setIntArray3(getUniform(uniformName), array);
+  const auto slot = _getUniformSlot(_getUniformHandle(uniformName));
+  if (slot >= 0) {
+    _valueCache[slot] = UniformValue{};
+    _engine->setIntArray3(_uniformLocations[slot], array);
+  }
 
   return *this;
 }
 
 Effect& Effect::setIntArray4(const std::string& uniformName, const Int32Array& array)
 {
-  _valueCache.erase(uniformName);
-  _engine->setIntArray4(getUniform(uniformName), array);
+  const auto slot = _getUniformSlot(_getUniformHandle(uniformName));
+  if (slot >= 0) {
+    _valueCache[slot] = UniformValue{};
+    _engine->setIntArray4(_uniformLocations[slot], array);
+  }
 
   return *this;
 }
 
 Effect& Effect::setFloatArray(const std::string& uniformName, const Float32Array& array)
 {
-  _valueCache.erase(uniformName);
-  _engine->setArray(getUniform(uniformName), array);
+  const auto slot = _getUniformSlot(_getUniformHandle(uniformName));
+  if (slot >= 0) {
+    _valueCache[slot] = UniformValue{};
+    _engine->setArray(_uniformLocations[slot], array);
+  }
 
   return *this;
 }
 
 Effect& Effect::setFloatArray2(const std::string& uniformName, const Float32Array& array)
 {
-  _valueCache.erase(uniformName);
-  _engine->setArray2(getUniform(uniformName), array);
+  const auto slot = _getUniformSlot(_getUniformHandle(uniformName));
+  if (slot >= 0) {
+    _valueCache[slot] = UniformValue{};
+    _engine->setArray2(_uniformLocations[slot], array);
+  }
 
   return *this;
 }
 
 Effect& Effect::setFloatArray3(const std::string& uniformName, const Float32Array& array)
 {
-  _valueCache.erase(uniformName);
-  _engine->setArray3(getUniform(uniformName), array);
+  const auto slot = _getUniformSlot(_getUniformHandle(uniformName));
+  if (slot >= 0) {
+    _valueCache[slot] = UniformValue{};
+    _engine->setArray3(_uniformLocations[slot], array);
+  }
 
   return *this;
 }
 
 Effect& Effect::setFloatArray4(const std::string& uniformName, const Float32Array& array)
 {
-  _valueCache.erase(uniformName);
-  _engine->setArray4(getUniform(uniformName), array);
+  const auto slot = _getUniformSlot(_getUniformHandle(uniformName));
+  if (slot >= 0) {
+    _valueCache[slot] = UniformValue{};
+    _engine->setArray4(_uniformLocations[slot], array);
+  }
 
   return *this;
 }
 
 Effect& Effect::setArray(const std::string& uniformName, Float32Array array)
 {
-  _valueCache.erase(uniformName);
-  _engine->setArray(getUniform(uniformName), array);
+  const auto slot = _getUniformSlot(_getUniformHandle(uniformName));
+  if (slot >= 0) {
+    _valueCache[slot] = UniformValue{};
+    _engine->setArray(_uniformLocations[slot], array);
+  }
 
   return *this;
 }
 
 Effect& Effect::setArray2(const std::string& uniformName, Float32Array array)
 {
-  _valueCache.erase(uniformName);
-  _engine->setArray2(getUniform(uniformName), array);
+  const auto slot = _getUniformSlot(_getUniformHandle(uniformName));
+  if (slot >= 0) {
+    _valueCache[slot] = UniformValue{};
+    _engine->setArray2(_uniformLocations[slot], array);
+  }
 
   return *this;
 }
 
 Effect& Effect::setArray3(const std::string& uniformName, Float32Array array)
 {
-  _valueCache.erase(uniformName);
-  _engine->setArray3(getUniform(uniformName), array);
+  const auto slot = _getUniformSlot(_getUniformHandle(uniformName));
+  if (slot >= 0) {
+    _valueCache[slot] = UniformValue{};
+    _engine->setArray3(_uniformLocations[slot], array);
+  }
 
   return *this;
 }
 
 Effect& Effect::setArray4(const std::string& uniformName, Float32Array array)
 {
-  _valueCache.erase(uniformName);
-  _engine->setArray4(getUniform(uniformName), array);
+  const auto slot = _getUniformSlot(_getUniformHandle(uniformName));
+  if (slot >= 0) {
+    _valueCache[slot] = UniformValue{};
+    _engine->setArray4(_uniformLocations[slot], array);
+  }
 
   return *this;
 }
 
 Effect& Effect::setMatrices(const std::string& uniformName, Float32Array matrices)
+{
+  return setMatrices(_getUniformHandle(uniformName), matrices);
+}
+
+Effect& Effect::setMatrices(size_t uniformHandle, const Float32Array& matrices)
 {
   if (matrices.empty()) {
     return *this;
   }
 
-  _valueCache.erase(uniformName);
-  _engine->setMatrices(getUniform(uniformName), matrices);
+  const auto slot = _getUniformSlot(uniformHandle);
+  if (slot >= 0) {
+    _valueCache[slot] = UniformValue{};
+    _engine->setMatrices(_uniformLocations[slot], matrices);
+  }
 
   return *this;
 }
 
 Effect& Effect::setMatrix(const std::string& uniformName, const Matrix& matrix)
 {
-  if (_cacheMatrix(uniformName, matrix)) {
-    _engine->setMatrices(getUniform(uniformName), matrix.toArray());
+  return setMatrix(_getUniformHandle(uniformName), matrix);
+}
+
+Effect& Effect::setMatrix(size_t uniformHandle, const Matrix& matrix)
+{
+  const auto slot = _getUniformSlot(uniformHandle);
+  if (slot >= 0 && _cacheMatrix(slot, matrix)) {
+    _engine->setMatrix4x4(_uniformLocations[slot], matrix.m());
   }
 
   return *this;
@@ -837,52 +956,66 @@ Effect& Effect::setMatrix(const std::string& uniformName, const Matrix& matrix)
 
 Effect& Effect::setMatrix3x3(const std::string& uniformName, const Float32Array& matrix)
 {
-  _valueCache.erase(uniformName);
-  _engine->setMatrix3x3(getUniform(uniformName), matrix);
+  const auto slot = _getUniformSlot(_getUniformHandle(uniformName));
+  if (slot >= 0) {
+    _valueCache[slot] = UniformValue{};
+    _engine->setMatrix3x3(_uniformLocations[slot], matrix);
+  }
 
   return *this;
 }
 
 Effect& Effect::setMatrix2x2(const std::string& uniformName, const Float32Array& matrix)
 {
-  _valueCache.erase(uniformName);
-  _engine->setMatrix2x2(getUniform(uniformName), matrix);
+  const auto slot = _getUniformSlot(_getUniformHandle(uniformName));
+  if (slot >= 0) {
+    _valueCache[slot] = UniformValue{};
+    _engine->setMatrix2x2(_uniformLocations[slot], matrix);
+  }
 
   return *this;
 }
 
 Effect& Effect::setFloat(const std::string& uniformName, float value)
 {
-  if (stl_util::contains(_valueCache, uniformName)
-      && stl_util::almost_equal(_valueCache[uniformName][0], value)) {
-    return *this;
-  }
-
-  _valueCache[uniformName] = {value};
+  return setFloat(_getUniformHandle(uniformName), value);
+}
 
-  _engine->setFloat(getUniform(uniformName), value);
+Effect& Effect::setFloat(size_t uniformHandle, float value)
+{
+  const auto slot = _getUniformSlot(uniformHandle);
+  if (slot >= 0 && _cacheFloat(slot, value)) {
+    _engine->setFloat(_uniformLocations[slot], value);
+  }
 
   return *this;
 }
 
 Effect& Effect::setBool(const std::string& uniformName, bool _bool)
 {
-  if (stl_util::contains(_valueCache, uniformName)
-      && stl_util::almost_equal(_valueCache[uniformName][0], _bool ? 1.f : 0.f)) {
-    return *this;
-  }
-
-  _valueCache[uniformName] = {_bool ? 1.f : 0.f};
+  return setBool(_getUniformHandle(uniformName), _bool);
+}
 
-  _engine->setInt(getUniform(uniformName), _bool ? 1 : 0);
+Effect& Effect::setBool(size_t uniformHandle, bool _bool)
+{
+  const auto slot = _getUniformSlot(uniformHandle);
+  if (slot >= 0 && _cacheFloat(slot, _bool ? 1.f : 0.f)) {
+    _engine->setInt(_uniformLocations[slot], _bool ? 1 : 0);
+  }
 
   return *this;
 }
 
 Effect& Effect::setVector2(const std::string& uniformName, const Vector2& vector2)
 {
-  if (_cacheFloat2(uniformName, vector2.x, vector2.y)) {
-    _engine->setFloat2(getUniform(uniformName), vector2.x, vector2.y);
+  return setVector2(_getUniformHandle(uniformName), vector2);
+}
+
+Effect& Effect::setVector2(size_t uniformHandle, const Vector2& vector2)
+{
+  const auto slot = _getUniformSlot(uniformHandle);
+  if (slot >= 0 && _cacheFloat2(slot, vector2.x, vector2.y)) {
+    _engine->setFloat2(_uniformLocations[slot], vector2.x, vector2.y);
   }
 
   return *this;
@@ -890,8 +1023,14 @@ Effect& Effect::setVector2(const std::string& uniformName, const Vector2& vector
 
 Effect& Effect::setFloat2(const std::string& uniformName, float x, float y)
 {
-  if (_cacheFloat2(uniformName, x, y)) {
-    _engine->setFloat2(getUniform(uniformName), x, y);
+  return setFloat2(_getUniformHandle(uniformName), x, y);
+}
+
+Effect& Effect::setFloat2(size_t uniformHandle, float x, float y)
+{
+  const auto slot = _getUniformSlot(uniformHandle);
+  if (slot >= 0 && _cacheFloat2(slot, x, y)) {
+    _engine->setFloat2(_uniformLocations[slot], x, y);
   }
 
   return *this;
@@ -899,8 +1038,14 @@ Effect& Effect::setFloat2(const std::string& uniformName, float x, float y)
 
 Effect& Effect::setVector3(const std::string& uniformName, const Vector3& vector3)
 {
-  if (_cacheFloat3(uniformName, vector3.x, vector3.y, vector3.z)) {
-    _engine->setFloat3(getUniform(uniformName), vector3.x, vector3.y, vector3.z);
+  return setVector3(_getUniformHandle(uniformName), vector3);
+}
+
+Effect& Effect::setVector3(size_t uniformHandle, const Vector3& vector3)
+{
+  const auto slot = _getUniformSlot(uniformHandle);
+  if (slot >= 0 && _cacheFloat3(slot, vector3.x, vector3.y, vector3.z)) {
+    _engine->setFloat3(_uniformLocations[slot], vector3.x, vector3.y, vector3.z);
   }
 
   return *this;
@@ -908,8 +1053,14 @@ Effect& Effect::setVector3(const std::string& uniformName, const Vector3& vector
 
 Effect& Effect::setFloat3(const std::string& uniformName, float x, float y, float z)
 {
-  if (_cacheFloat3(uniformName, x, y, z)) {
-    _engine->setFloat3(getUniform(uniformName), x, y, z);
+  return setFloat3(_getUniformHandle(uniformName), x, y, z);
+}
+
+Effect& Effect::setFloat3(size_t uniformHandle, float x, float y, float z)
+{
+  const auto slot = _getUniformSlot(uniformHandle);
+  if (slot >= 0 && _cacheFloat3(slot, x, y, z)) {
+    _engine->setFloat3(_uniformLocations[slot], x, y, z);
   }
 
   return *this;
@@ -917,8 +1068,14 @@ Effect& Effect::setFloat3(const std::string& uniformName, float x, float y, floa
 
 Effect& Effect::setVector4(const std::string& uniformName, const Vector4& vector4)
 {
-  if (_cacheFloat4(uniformName, vector4.x, vector4.y, vector4.z, vector4.w)) {
-    _engine->setFloat4(getUniform(uniformName), vector4.x, vector4.y, vector4.z, vector4.w);
+  return setVector4(_getUniformHandle(uniformName), vector4);
+}
+
+Effect& Effect::setVector4(size_t uniformHandle, const Vector4& vector4)
+{
+  const auto slot = _getUniformSlot(uniformHandle);
+  if (slot >= 0 && _cacheFloat4(slot, vector4.x, vector4.y, vector4.z, vector4.w)) {
+    _engine->setFloat4(_uniformLocations[slot], vector4.x, vector4.y, vector4.z, vector4.w);
   }
 
   return *this;
@@ -926,8 +1083,14 @@ Effect& Effect::setVector4(const std::string& uniformName, const Vector4& vector
 
 Effect& Effect::setFloat4(const std::string& uniformName, float x, float y, float z, float w)
 {
-  if (_cacheFloat4(uniformName, x, y, z, w)) {
-    _engine->setFloat4(getUniform(uniformName), x, y, z, w);
+  return setFloat4(_getUniformHandle(uniformName), x, y, z, w);
+}
+
+Effect& Effect::setFloat4(size_t uniformHandle, float x, float y, float z, float w)
+{
+  const auto slot = _getUniformSlot(uniformHandle);
+  if (slot >= 0 && _cacheFloat4(slot, x, y, z, w)) {
+    _engine->setFloat4(_uniformLocations[slot], x, y, z, w);
   }
 
   return *this;
@@ -935,8 +1098,14 @@ Effect& Effect::setFloat4(const std::string& uniformName, float x, float y, floa
 
 Effect& Effect::setColor3(const std::string& uniformName, const Color3& color3)
 {
-  if (_cacheFloat3(uniformName, color3.r, color3.g, color3.b)) {
-    _engine->setFloat3(getUniform(uniformName), color3.r, color3.g, color3.b);
+  return setColor3(_getUniformHandle(uniformName), color3);
+}
+
+Effect& Effect::setColor3(size_t uniformHandle, const Color3& color3)
+{
+  const auto slot = _getUniformSlot(uniformHandle);
+  if (slot >= 0 && _cacheFloat3(slot, color3.r, color3.g, color3.b)) {
+    _engine->setFloat3(_uniformLocations[slot], color3.r, color3.g, color3.b);
   }
 
   return *this;
@@ -944,8 +1113,14 @@ Effect& Effect::setColor3(const std::string& uniformName, const Color3& color3)
 
 Effect& Effect::setColor4(const std::string& uniformName, const Color3& color3, float alpha)
 {
-  if (_cacheFloat4(uniformName, color3.r, color3.g, color3.b, alpha)) {
-    _engine->setFloat4(getUniform(uniformName), color3.r, color3.g, color3.b, alpha);
+  return setColor4(_getUniformHandle(uniformName), color3, alpha);
+}
+
+Effect& Effect::setColor4(size_t uniformHandle, const Color3& color3, float alpha)
+{
+  const auto slot = _getUniformSlot(uniformHandle);
+  if (slot >= 0 && _cacheFloat4(slot, color3.r, color3.g, color3.b, alpha)) {
+    _engine->setFloat4(_uniformLocations[slot], color3.r, color3.g, color3.b, alpha);
   }
 
   return *this;
@@ -953,8 +1128,14 @@ Effect& Effect::setColor4(const std::string& uniformName, const Color3& color3,
 
 Effect& Effect::setDirectColor4(const std::string& uniformName, const Color4& color4)
 {
-  if (_cacheFloat4(uniformName, color4.r, color4.g, color4.b, color4.a)) {
-    _engine->setFloat4(getUniform(uniformName), color4.r, color4.g, color4.b, color4.a);
+  return setDirectColor4(_getUniformHandle(uniformName), color4);
+}
+
+Effect& Effect::setDirectColor4(size_t uniformHandle, const Color4& color4)
+{
+  const auto slot = _getUniformSlot(uniformHandle);
+  if (slot >= 0 && _cacheFloat4(slot, color4.r, color4.g, color4.b, color4.a)) {
+    _engine->setFloat4(_uniformLocations[slot], color4.r, color4.g, color4.b, color4.a);
   }
 
   return *this;
@@ -965,6 +1146,21 @@ void Effect::dispose(bool /*doNotRecurse*/, bool /*disposeMaterialAndTextures*/)
   _engine->_releaseEffect(this);
 }
 
+size_t Effect::UniformHandle(const std::string& uniformName)
+{
+  static std::mutex uniformHandlesMutex;
+  static std::unordered_map<std::string, size_t> uniformHandles;
+
+  std::lock_guard<std::mutex> lock(uniformHandlesMutex);
+  auto it = uniformHandles.find(uniformName);
+  if (it != uniformHandles.end()) {
+    return it->second;
+  }
+  const auto handle           = uniformHandles.size();
+  uniformHandles[uniformName] = handle;
+  return handle;
+}
+
 void Effect::RegisterShader(const std::string& name, const std::optional<std::string>& pixelShader,
                             const std::optional<std::string>& vertexShader)
 {
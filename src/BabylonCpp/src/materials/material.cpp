@@ -435,7 +435,8 @@ void Material::bindSceneUniformBuffer(Effect* effect, UniformBuffer* sceneUbo)
 void Material::bindView(Effect* effect)
 {
   if (!_useUBO) {
-    effect->setMatrix("view", getScene()->getViewMatrix());
+    static const auto viewHandle = Effect::UniformHandle("view");
+    effect->setMatrix(viewHandle, getScene()->getViewMatrix());
   }
   else {
     bindSceneUniformBuffer(effect, getScene()->getSceneUniformBuffer());
@@ -445,7 +446,8 @@ void Material::bindView(Effect* effect)
 void Material::bindViewProjection(const EffectPtr& effect)
 {
   if (!_useUBO) {
-    effect->setMatrix("viewProjection", getScene()->getTransformMatrix());
+    static const auto viewProjectionHandle = Effect::UniformHandle("viewProjection");
+    effect->setMatrix(viewProjectionHandle, getScene()->getTransformMatrix());
   }
   else {
     bindSceneUniformBuffer(effect.get(), getScene()->getSceneUniformBuffer());
@@ -0,0 +1,216 @@
+#include <babylon/materials/material_define_set.h>
+
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace BABYLON {
+
+namespace {
+
+struct MaterialDefinesRegistry {
+  std::shared_mutex mutex;
+  std::unordered_map<std::string, size_t> indices;
+  std::deque<std::string> names;
+};
+
+MaterialDefinesRegistry& GetMaterialDefinesRegistry()
+{
+  static MaterialDefinesRegistry registry;
+  return registry;
+}
+
+} // end of anonymous namespace
+
+size_t MaterialDefinesSchema::IndexOf(const std::string& name)
+{
+  auto& registry = GetMaterialDefinesRegistry();
+  {
+    std::shared_lock<std::shared_mutex> lock(registry.mutex);
+    auto it = registry.indices.find(name);
+    if (it != registry.indices.end()) {
+      return it->second;
+    }
+  }
+
+  std::unique_lock<std::shared_mutex> lock(registry.mutex);
+  auto it = registry.indices.find(name);
+  if (it != registry.indices.end()) {
+    return it->second;
+  }
+  const auto index = registry.names.size();
+  registry.names.emplace_back(name);
+  registry.indices[name] = index;
+  return index;
+}
+
+std::string MaterialDefinesSchema::NameOf(size_t index)
+{
+  auto& registry = GetMaterialDefinesRegistry();
+  std::shared_lock<std::shared_mutex> lock(registry.mutex);
+  return index < registry.names.size() ? registry.names[index] : std::string();
+}
+
+MaterialBoolDefineSet::MaterialBoolDefineSet(
+  std::initializer_list<std::pair<const std::string, bool>> defines)
+{
+  operator=(defines);
+}
+
+MaterialBoolDefineSet& MaterialBoolDefineSet::operator=(const MaterialBoolDefineSet& other)
+{
+  if (&other != this) {
+    _declared = other._declared;
+    _values   = other._values;
+    _size     = other._size;
+    // The version never goes backward, so that caches keyed by version stay valid after assignment
+    _version = std::max(_version, other._version) + 1;
+  }
+
+  return *this;
+}
+
+MaterialBoolDefineSet& MaterialBoolDefineSet::operator=(MaterialBoolDefineSet&& other)
+{
+  if (&other != this) {
+    _declared = std::move(other._declared);
+    _values   = std::move(other._values);
+    _size     = other._size;
+    _version  = std::max(_version, other._version) + 1;
+  }
+
+  return *this;
+}
+
+MaterialBoolDefineSet&
+MaterialBoolDefineSet::operator=(std::initializer_list<std::pair<const std::string, bool>> defines)
+{
+  _declared.clear();
+  _values.clear();
+  _size = 0;
+  for (const auto& define : defines) {
+    set(MaterialDefinesSchema::IndexOf(define.first), define.second);
+  }
+  ++_version;
+
+  return *this;
+}
+
+MaterialBoolDefineSet::Reference MaterialBoolDefineSet::operator[](const std::string& name)
+{
+  return operator[](MaterialDefinesSchema::IndexOf(name));
+}
+
+MaterialBoolDefineSet::Reference MaterialBoolDefineSet::operator[](size_t index)
+{
+  if (!contains(index)) {
+    set(index, false);
+  }
+
+  return Reference(*this, index);
+}
+
+bool MaterialBoolDefineSet::get(const std::string& name) const
+{
+  return get(MaterialDefinesSchema::IndexOf(name));
+}
+
+void MaterialBoolDefineSet::set(size_t index, bool value)
+{
+  const auto word = index >> 6;
+  const auto bit  = 1ull << (index & 63);
+  if (word >= _declared.size()) {
+    _declared.resize(word + 1, 0);
+    _values.resize(word + 1, 0);
+  }
+
+  if (!(_declared[word] & bit)) {
+    _declared[word] |= bit;
+    ++_size;
+    ++_version;
+  }
+
+  if (static_cast<bool>(_values[word] & bit) != value) {
+    _values[word] ^= bit;
+    ++_version;
+  }
+}
+
+bool MaterialBoolDefineSet::contains(const std::string& name) const
+{
+  return contains(MaterialDefinesSchema::IndexOf(name));
+}
+
+size_t MaterialBoolDefineSet::erase(const std::string& name)
+{
+  return erase(MaterialDefinesSchema::IndexOf(name));
+}
+
+size_t MaterialBoolDefineSet::erase(size_t index)
+{
+  if (!contains(index)) {
+    return 0;
+  }
+
+  const auto word = index >> 6;
+  const auto bit  = 1ull << (index & 63);
+  _declared[word] &= ~bit;
+  _values[word] &= ~bit;
+  --_size;
+  ++_version;
+
+  return 1;
+}
+
+uint64_t MaterialBoolDefineSet::hash() const
+{
+  // Trailing empty words are skipped so that equal sets always hash the same
+  auto nbWords = _declared.size();
+  while (nbWords > 0 && _declared[nbWords - 1] == 0) {
+    --nbWords;
+  }
+
+  auto hash = MaterialDefinesSchema::HashSeed;
+  for (size_t word = 0; word < nbWords; ++word) {
+    hash = MaterialDefinesSchema::HashCombine(hash, _declared[word]);
+    hash = MaterialDefinesSchema::HashCombine(hash, _values[word]);
+  }
+
+  return hash;
+}
+
+void MaterialBoolDefineSet::forEach(
+  const std::function<void(size_t index, bool value)>& callback) const
+{
+  for (size_t word = 0; word < _declared.size(); ++word) {
+    auto declared = _declared[word];
+    for (size_t bit = 0; declared != 0; ++bit, declared >>= 1) {
+      if (declared & 1ull) {
+        callback((word << 6) + bit, (_values[word] >> bit) & 1ull);
+      }
+    }
+  }
+}
+
+bool MaterialBoolDefineSet::operator==(const MaterialBoolDefineSet& other) const
+{
+  if (_size != other._size) {
+    return false;
+  }
+
+  const auto nbWords = std::max(_declared.size(), other._declared.size());
+  for (size_t word = 0; word < nbWords; ++word) {
+    const auto declared      = word < _declared.size() ? _declared[word] : 0;
+    const auto otherDeclared = word < other._declared.size() ? other._declared[word] : 0;
+    const auto values        = word < _values.size() ? _values[word] : 0;
+    const auto otherValues   = word < other._values.size() ? other._values[word] : 0;
+    if (declared != otherDeclared || values != otherValues) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+} // end of namespace BABYLON
@@ -1,6 +1,6 @@
 #include <babylon/materials/material_defines.h>
 
-#include <babylon/babylon_stl_util.h>
+#include <sstream>
 
 namespace BABYLON {
 
@@ -117,7 +117,12 @@ MaterialDefines::~MaterialDefines() = default;
 
 bool MaterialDefines::operator[](const std::string& define) const
 {
-  return stl_util::contains(boolDef, define) && boolDef.at(define);
+  return boolDef.get(define);
+}
+
+bool MaterialDefines::operator[](size_t index) const
+{
+  return boolDef.get(index);
 }
 
 bool MaterialDefines::operator==(const MaterialDefines& rhs) const
@@ -133,23 +138,7 @@ bool MaterialDefines::operator!=(const MaterialDefines& rhs) const
 std::ostream& operator<<(std::ostream& os,
                          const MaterialDefines& materialDefines)
 {
-  for (const auto& item : materialDefines.boolDef) {
-    if (item.second) {
-      os << "#define " << item.first << "\n";
-    }
-  }
-
-  for (const auto& item : materialDefines.intDef) {
-    os << "#define " << item.first << " " << item.second << "\n";
-  }
-
-  for (const auto& item : materialDefines.floatDef) {
-    os << "#define " << item.first << " " << item.second << "\n";
-  }
-
-  for (const auto& item : materialDefines.stringDef) {
-    os << "#define " << item.first << " " << item.second << "\n";
-  }
+  os << materialDefines.MaterialDefines::toString();
 
   return os;
 }
@@ -250,6 +239,10 @@ bool MaterialDefines::isEqual(const MaterialDefines& other) const
     return false;
   }
 
+  if (getHash() != other.getHash()) {
+    return false;
+  }
+
   if ((boolDef != other.boolDef) || (intDef != other.intDef)
       || (floatDef != other.floatDef) || (stringDef != other.stringDef)) {
     return false;
@@ -298,10 +291,56 @@ void MaterialDefines::reset()
 
 std::string MaterialDefines::toString() const
 {
+  const auto version = _getDefinesVersion();
+  if (_cachedStringVersion == version) {
+    return _cachedString;
+  }
+
   std::ostringstream oss;
-  oss << *this;
+  boolDef.forEach([&oss](size_t index, bool value) {
+    if (value) {
+      oss << "#define " << MaterialDefinesSchema::NameOf(index) << "\n";
+    }
+  });
+
+  for (const auto& [index, value] : intDef.entries()) {
+    oss << "#define " << MaterialDefinesSchema::NameOf(index) << " " << value << "\n";
+  }
+
+  for (const auto& [index, value] : floatDef.entries()) {
+    oss << "#define " << MaterialDefinesSchema::NameOf(index) << " " << value << "\n";
+  }
+
+  for (const auto& [index, value] : stringDef.entries()) {
+    oss << "#define " << MaterialDefinesSchema::NameOf(index) << " " << value << "\n";
+  }
+
+  _cachedString        = oss.str();
+  _cachedStringVersion = version;
 
-  return oss.str();
+  return _cachedString;
+}
+
+uint64_t MaterialDefines::getHash() const
+{
+  const auto version = _getDefinesVersion();
+  if (_cachedHashVersion != version) {
+    auto hash          = MaterialDefinesSchema::HashSeed;
+    hash               = MaterialDefinesSchema::HashCombine(hash, boolDef.hash());
+    hash               = MaterialDefinesSchema::HashCombine(hash, intDef.hash());
+    hash               = MaterialDefinesSchema::HashCombine(hash, floatDef.hash());
+    hash               = MaterialDefinesSchema::HashCombine(hash, stringDef.hash());
+    _cachedHash        = hash;
+    _cachedHashVersion = version;
+  }
+
+  return _cachedHash;
+}
+
+uint64_t MaterialDefines::_getDefinesVersion() const
+{
+  // Each set version only grows, so the sum changes whenever any define changes
+  return boolDef.version() + intDef.version() + floatDef.version() + stringDef.version();
 }
 
 } // end of namespace BABYLON
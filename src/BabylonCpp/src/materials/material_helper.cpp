@@ -1,5 +1,7 @@
 #include <babylon/materials/material_helper.h>
 
+#include <array>
+
 #include <babylon/babylon_stl_util.h>
 #include <babylon/bones/skeleton.h>
 #include <babylon/cameras/camera.h>
@@ -26,35 +28,112 @@
 
 namespace BABYLON {
 
+namespace {
+
+/**
+ * @brief Schema indices of the defines of a light.
+ */
+struct LightDefineIndices {
+  size_t light;
+  size_t spotLight;
+  size_t hemiLight;
+  size_t pointLight;
+  size_t dirLight;
+  size_t falloffPhysical;
+  size_t falloffGltf;
+  size_t falloffStandard;
+  size_t shadow;
+  size_t shadowPcf;
+  size_t shadowPcss;
+  size_t shadowPoisson;
+  size_t shadowEsm;
+  size_t shadowCube;
+  size_t shadowLowQuality;
+  size_t shadowMediumQuality;
+  size_t lightmapExcluded;
+  size_t lightmapNoSpecular;
+}; // end of struct LightDefineIndices
+
+LightDefineIndices ResolveLightDefineIndices(unsigned int lightIndex)
+{
+  const auto indexOf = [lightIndex](const char* name) {
+    return MaterialDefinesSchema::IndexOf(name + std::to_string(lightIndex));
+  };
+
+  return LightDefineIndices{
+    indexOf("LIGHT"),                  // light
+    indexOf("SPOTLIGHT"),              // spotLight
+    indexOf("HEMILIGHT"),              // hemiLight
+    indexOf("POINTLIGHT"),             // pointLight
+    indexOf("DIRLIGHT"),               // dirLight
+    indexOf("LIGHT_FALLOFF_PHYSICAL"), // falloffPhysical
+    indexOf("LIGHT_FALLOFF_GLTF"),     // falloffGltf
+    indexOf("LIGHT_FALLOFF_STANDARD"), // falloffStandard
+    indexOf("SHADOW"),                 // shadow
+    indexOf("SHADOWPCF"),              // shadowPcf
+    indexOf("SHADOWPCSS"),             // shadowPcss
+    indexOf("SHADOWPOISSON"),          // shadowPoisson
+    indexOf("SHADOWESM"),              // shadowEsm
+    indexOf("SHADOWCUBE"),             // shadowCube
+    indexOf("SHADOWLOWQUALITY"),       // shadowLowQuality
+    indexOf("SHADOWMEDIUMQUALITY"),    // shadowMediumQuality
+    indexOf("LIGHTMAPEXCLUDED"),       // lightmapExcluded
+    indexOf("LIGHTMAPNOSPECULAR"),     // lightmapNoSpecular
+  };
+}
+
+/**
+ * @brief Returns the define indices of a light, resolved once for the first light indices.
+ */
+LightDefineIndices GetLightDefineIndices(unsigned int lightIndex)
+{
+  static const auto cachedIndices = [] {
+    std::array<LightDefineIndices, 8> indices{};
+    for (unsigned int index = 0; index < indices.size(); ++index) {
+      indices[index] = ResolveLightDefineIndices(index);
+    }
+    return indices;
+  }();
+
+  return lightIndex < cachedIndices.size() ? cachedIndices[lightIndex] :
+                                             ResolveLightDefineIndices(lightIndex);
+}
+
+} // end of anonymous namespace
+
 std::unique_ptr<MaterialDefines> MaterialHelper::_TmpMorphInfluencers
   = std::make_unique<MaterialDefines>();
 Color3 MaterialHelper::_tempFogColor = Color3::Black();
 
 void MaterialHelper::BindEyePosition(const EffectPtr& effect, Scene* scene)
 {
+  static const auto eyePositionHandle = Effect::UniformHandle("vEyePosition");
   if (scene->_forcedViewPosition) {
-    effect->setVector3("vEyePosition", *scene->_forcedViewPosition);
+    effect->setVector3(eyePositionHandle, *scene->_forcedViewPosition);
     return;
   }
   const auto& globalPosition = scene->activeCamera()->globalPosition();
 
-  effect->setVector3("vEyePosition", scene->_mirroredCameraPosition ?
-                                       *scene->_mirroredCameraPosition :
-                                       globalPosition);
+  effect->setVector3(eyePositionHandle, scene->_mirroredCameraPosition ?
+                                          *scene->_mirroredCameraPosition :
+                                          globalPosition);
 }
 
 void MaterialHelper::PrepareDefinesForMergedUV(const BaseTexturePtr& texture,
                                                MaterialDefines& defines, const std::string& key)
 {
+  static const auto MAINUV1 = MaterialDefinesSchema::IndexOf("MAINUV1");
+  static const auto MAINUV2 = MaterialDefinesSchema::IndexOf("MAINUV2");
+
   defines._needUVs     = true;
   defines.boolDef[key] = true;
   if (texture->getTextureMatrix()->isIdentityAs3x2()) {
     defines.intDef[key + "DIRECTUV"] = texture->coordinatesIndex + 1;
     if (texture->coordinatesIndex == 0) {
-      defines.boolDef["MAINUV1"] = true;
+      defines.boolDef[MAINUV1] = true;
     }
     else {
-      defines.boolDef["MAINUV2"] = true;
+      defines.boolDef[MAINUV2] = true;
     }
   }
   else {
@@ -80,18 +159,25 @@ void MaterialHelper::PrepareDefinesForMisc(AbstractMesh* mesh, Scene* scene,
                                            bool fogEnabled, bool alphaTest,
                                            MaterialDefines& defines)
 {
+  static const auto LOGARITHMICDEPTH  = MaterialDefinesSchema::IndexOf("LOGARITHMICDEPTH");
+  static const auto POINTSIZE         = MaterialDefinesSchema::IndexOf("POINTSIZE");
+  static const auto FOG               = MaterialDefinesSchema::IndexOf("FOG");
+  static const auto NONUNIFORMSCALING = MaterialDefinesSchema::IndexOf("NONUNIFORMSCALING");
+  static const auto ALPHATEST         = MaterialDefinesSchema::IndexOf("ALPHATEST");
+
   if (defines._areMiscDirty) {
-    defines.boolDef["LOGARITHMICDEPTH"]  = useLogarithmicDepth;
-    defines.boolDef["POINTSIZE"]         = pointsCloud;
-    defines.boolDef["FOG"]               = fogEnabled && GetFogState(mesh, scene);
-    defines.boolDef["NONUNIFORMSCALING"] = mesh->nonUniformScaling();
-    defines.boolDef["ALPHATEST"]         = alphaTest;
+    defines.boolDef[LOGARITHMICDEPTH]  = useLogarithmicDepth;
+    defines.boolDef[POINTSIZE]         = pointsCloud;
+    defines.boolDef[FOG]               = fogEnabled && GetFogState(mesh, scene);
+    defines.boolDef[NONUNIFORMSCALING] = mesh->nonUniformScaling();
+    defines.boolDef[ALPHATEST]         = alphaTest;
   }
 }
 
 void MaterialHelper::PrepareDefinesForFrameBoundValues(Scene* scene, Engine* engine,
                                                        MaterialDefines& defines, bool useInstances,
-                                                       std::optional<bool> useClipPlane)
+                                                       std::optional<bool> useClipPlane,
+                                                       bool useThinInstances)
 {
   auto changed       = false;
   auto useClipPlane1 = false;
@@ -113,44 +199,34 @@ void MaterialHelper::PrepareDefinesForFrameBoundValues(Scene* scene, Engine* eng
   useClipPlane6
     = useClipPlane == std::nullopt ? (scene->clipPlane6 != std::nullopt) : *useClipPlane;
 
-  if (defines["CLIPPLANE"] != useClipPlane1) {
-    defines.boolDef["CLIPPLANE"] = useClipPlane1;
-    changed                      = true;
-  }
-
-  if (defines["CLIPPLANE2"] != useClipPlane2) {
-    defines.boolDef["CLIPPLANE2"] = useClipPlane2;
-    changed                       = true;
-  }
-
-  if (defines["CLIPPLANE3"] != useClipPlane3) {
-    defines.boolDef["CLIPPLANE3"] = useClipPlane3;
-    changed                       = true;
-  }
-
-  if (defines["CLIPPLANE4"] != useClipPlane4) {
-    defines.boolDef["CLIPPLANE4"] = useClipPlane4;
-    changed                       = true;
-  }
-
-  if (defines["CLIPPLANE5"] != useClipPlane5) {
-    defines.boolDef["CLIPPLANE5"] = useClipPlane5;
-    changed                       = true;
-  }
-
-  if (defines["CLIPPLANE6"] != useClipPlane6) {
-    defines.boolDef["CLIPPLANE6"] = useClipPlane6;
-    changed                       = true;
-  }
-
-  if (defines["DEPTHPREPASS"] != !engine->getColorWrite()) {
-    defines.boolDef["DEPTHPREPASS"] = !defines["DEPTHPREPASS"];
-    changed                         = true;
-  }
-
-  if (defines["INSTANCES"] != useInstances) {
-    defines.boolDef["INSTANCES"] = useInstances;
-    changed                      = true;
+  // Evaluated for every sub mesh on every frame: use the define indices instead of the names
+  static const auto CLIPPLANE      = MaterialDefinesSchema::IndexOf("CLIPPLANE");
+  static const auto CLIPPLANE2     = MaterialDefinesSchema::IndexOf("CLIPPLANE2");
+  static const auto CLIPPLANE3     = MaterialDefinesSchema::IndexOf("CLIPPLANE3");
+  static const auto CLIPPLANE4     = MaterialDefinesSchema::IndexOf("CLIPPLANE4");
+  static const auto CLIPPLANE5     = MaterialDefinesSchema::IndexOf("CLIPPLANE5");
+  static const auto CLIPPLANE6     = MaterialDefinesSchema::IndexOf("CLIPPLANE6");
+  static const auto DEPTHPREPASS   = MaterialDefinesSchema::IndexOf("DEPTHPREPASS");
+  static const auto INSTANCES      = MaterialDefinesSchema::IndexOf("INSTANCES");
+  static const auto THIN_INSTANCES = MaterialDefinesSchema::IndexOf("THIN_INSTANCES");
+
+  const std::array<std::pair<size_t, bool>, 9> frameBoundValues{{
+    {CLIPPLANE, useClipPlane1},               //
+    {CLIPPLANE2, useClipPlane2},              //
+    {CLIPPLANE3, useClipPlane3},              //
+    {CLIPPLANE4, useClipPlane4},              //
+    {CLIPPLANE5, useClipPlane5},              //
+    {CLIPPLANE6, useClipPlane6},              //
+    {DEPTHPREPASS, !engine->getColorWrite()}, //
+    {INSTANCES, useInstances},                //
+    {THIN_INSTANCES, useThinInstances},       //
+  }};
+
+  for (const auto& [index, value] : frameBoundValues) {
+    if (defines.boolDef.get(index) != value) {
+      defines.boolDef.set(index, value);
+      changed = true;
+    }
   }
 
   if (changed) {
@@ -160,47 +236,59 @@ void MaterialHelper::PrepareDefinesForFrameBoundValues(Scene* scene, Engine* eng
 
 void MaterialHelper::PrepareDefinesForBones(AbstractMesh* mesh, MaterialDefines& defines)
 {
+  static const auto NUM_BONE_INFLUENCERS = MaterialDefinesSchema::IndexOf("NUM_BONE_INFLUENCERS");
+  static const auto BONETEXTURE          = MaterialDefinesSchema::IndexOf("BONETEXTURE");
+  static const auto BonesPerMesh         = MaterialDefinesSchema::IndexOf("BonesPerMesh");
+
   if (mesh->useBones() && mesh->computeBonesUsingShaders() && mesh->skeleton()) {
-    defines.intDef["NUM_BONE_INFLUENCERS"] = mesh->numBoneInfluencers();
+    defines.intDef[NUM_BONE_INFLUENCERS] = mesh->numBoneInfluencers();
 
-    const auto materialSupportsBoneTexture = stl_util::contains(defines.boolDef, "BONETEXTURE");
+    const auto materialSupportsBoneTexture = defines.boolDef.contains(BONETEXTURE);
 
     if (mesh->skeleton()->isUsingTextureForMatrices && materialSupportsBoneTexture) {
-      defines.boolDef["BONETEXTURE"] = true;
+      defines.boolDef[BONETEXTURE] = true;
     }
     else {
-      defines.intDef["BonesPerMesh"]
-        = static_cast<unsigned int>(mesh->skeleton()->bones.size() + 1);
+      defines.intDef[BonesPerMesh] = static_cast<unsigned int>(mesh->skeleton()->bones.size() + 1);
       if (materialSupportsBoneTexture) {
-        defines.boolDef["BONETEXTURE"] = false;
+        defines.boolDef[BONETEXTURE] = false;
       }
       else {
-        defines.boolDef.erase("BONETEXTURE");
+        defines.boolDef.erase(BONETEXTURE);
       }
     }
   }
   else {
-    defines.intDef["NUM_BONE_INFLUENCERS"] = 0;
-    defines.intDef["BonesPerMesh"]         = 0;
+    defines.intDef[NUM_BONE_INFLUENCERS] = 0;
+    defines.intDef[BonesPerMesh]         = 0;
   }
 }
 
 void MaterialHelper::PrepareDefinesForMorphTargets(AbstractMesh* mesh, MaterialDefines& defines)
 {
+  static const auto MORPHTARGETS_UV       = MaterialDefinesSchema::IndexOf("MORPHTARGETS_UV");
+  static const auto UV1                   = MaterialDefinesSchema::IndexOf("UV1");
+  static const auto MORPHTARGETS_TANGENT  = MaterialDefinesSchema::IndexOf("MORPHTARGETS_TANGENT");
+  static const auto TANGENT               = MaterialDefinesSchema::IndexOf("TANGENT");
+  static const auto MORPHTARGETS_NORMAL   = MaterialDefinesSchema::IndexOf("MORPHTARGETS_NORMAL");
+  static const auto NORMAL                = MaterialDefinesSchema::IndexOf("NORMAL");
+  static const auto MORPHTARGETS          = MaterialDefinesSchema::IndexOf("MORPHTARGETS");
+  static const auto NUM_MORPH_INFLUENCERS = MaterialDefinesSchema::IndexOf("NUM_MORPH_INFLUENCERS");
+
   const auto& manager = static_cast<Mesh*>(mesh)->morphTargetManager();
   if (manager) {
-    defines.boolDef["MORPHTARGETS_UV"]      = manager->supportsUVs() && defines["UV1"];
-    defines.boolDef["MORPHTARGETS_TANGENT"] = manager->supportsTangents() && defines["TANGENT"];
-    defines.boolDef["MORPHTARGETS_NORMAL"]  = manager->supportsNormals() && defines["NORMAL"];
-    defines.boolDef["MORPHTARGETS"]         = (manager->numInfluencers() > 0);
-    defines.intDef["NUM_MORPH_INFLUENCERS"] = static_cast<unsigned int>(manager->numInfluencers());
+    defines.boolDef[MORPHTARGETS_UV]      = manager->supportsUVs() && defines[UV1];
+    defines.boolDef[MORPHTARGETS_TANGENT] = manager->supportsTangents() && defines[TANGENT];
+    defines.boolDef[MORPHTARGETS_NORMAL]  = manager->supportsNormals() && defines[NORMAL];
+    defines.boolDef[MORPHTARGETS]         = (manager->numInfluencers() > 0);
+    defines.intDef[NUM_MORPH_INFLUENCERS] = static_cast<unsigned int>(manager->numInfluencers());
   }
   else {
-    defines.boolDef["MORPHTARGETS_UV"]      = false;
-    defines.boolDef["MORPHTARGETS_TANGENT"] = false;
-    defines.boolDef["MORPHTARGETS_NORMAL"]  = false;
-    defines.boolDef["MORPHTARGETS"]         = false;
-    defines.intDef["NUM_MORPH_INFLUENCERS"] = 0u;
+    defines.boolDef[MORPHTARGETS_UV]      = false;
+    defines.boolDef[MORPHTARGETS_TANGENT] = false;
+    defines.boolDef[MORPHTARGETS_NORMAL]  = false;
+    defines.boolDef[MORPHTARGETS]         = false;
+    defines.intDef[NUM_MORPH_INFLUENCERS] = 0u;
   }
 }
 
@@ -208,6 +296,13 @@ bool MaterialHelper::PrepareDefinesForAttributes(AbstractMesh* mesh, MaterialDef
                                                  bool useVertexColor, bool useBones,
                                                  bool useMorphTargets, bool useVertexAlpha)
 {
+  static const auto NORMAL      = MaterialDefinesSchema::IndexOf("NORMAL");
+  static const auto TANGENT     = MaterialDefinesSchema::IndexOf("TANGENT");
+  static const auto UV1         = MaterialDefinesSchema::IndexOf("UV1");
+  static const auto UV2         = MaterialDefinesSchema::IndexOf("UV2");
+  static const auto VERTEXCOLOR = MaterialDefinesSchema::IndexOf("VERTEXCOLOR");
+  static const auto VERTEXALPHA = MaterialDefinesSchema::IndexOf("VERTEXALPHA");
+
   if (!defines._areAttributesDirty && defines._needNormals == defines._normals
       && defines._needUVs == defines._uvs) {
     return false;
@@ -216,27 +311,27 @@ bool MaterialHelper::PrepareDefinesForAttributes(AbstractMesh* mesh, MaterialDef
   defines._normals = defines._needNormals;
   defines._uvs     = defines._needUVs;
 
-  defines.boolDef["NORMAL"]
+  defines.boolDef[NORMAL]
     = (defines._needNormals && mesh->isVerticesDataPresent(VertexBuffer::NormalKind));
 
   if (defines._needNormals && mesh->isVerticesDataPresent(VertexBuffer::TangentKind)) {
-    defines.boolDef["TANGENT"] = true;
+    defines.boolDef[TANGENT] = true;
   }
 
   if (defines._needUVs) {
-    defines.boolDef["UV1"] = mesh->isVerticesDataPresent(VertexBuffer::UVKind);
-    defines.boolDef["UV2"] = mesh->isVerticesDataPresent(VertexBuffer::UV2Kind);
+    defines.boolDef[UV1] = mesh->isVerticesDataPresent(VertexBuffer::UVKind);
+    defines.boolDef[UV2] = mesh->isVerticesDataPresent(VertexBuffer::UV2Kind);
   }
   else {
-    defines.boolDef["UV1"] = false;
-    defines.boolDef["UV2"] = false;
+    defines.boolDef[UV1] = false;
+    defines.boolDef[UV2] = false;
   }
 
   if (useVertexColor) {
     auto hasVertexColors
       = mesh->useVertexColors() && mesh->isVerticesDataPresent(VertexBuffer::ColorKind);
-    defines.boolDef["VERTEXCOLOR"] = hasVertexColors;
-    defines.boolDef["VERTEXALPHA"] = mesh->hasVertexAlpha() && hasVertexColors && useVertexAlpha;
+    defines.boolDef[VERTEXCOLOR] = hasVertexColors;
+    defines.boolDef[VERTEXALPHA] = mesh->hasVertexAlpha() && hasVertexColors && useVertexAlpha;
   }
 
   if (useBones) {
@@ -252,12 +347,14 @@ bool MaterialHelper::PrepareDefinesForAttributes(AbstractMesh* mesh, MaterialDef
 
 void MaterialHelper::PrepareDefinesForMultiview(Scene* scene, MaterialDefines& defines)
 {
+  static const auto MULTIVIEW = MaterialDefinesSchema::IndexOf("MULTIVIEW");
+
   if (scene->activeCamera()) {
-    const auto previousMultiview = defines["MULTIVIEW"];
-    defines.boolDef["MULTIVIEW"]
-      = (scene->activeCamera()->outputRenderTarget != nullptr
-         && scene->activeCamera()->outputRenderTarget->getViewCount() > 1);
-    if (defines["MULTIVIEW"] != previousMultiview) {
+    const auto previousMultiview = defines.boolDef.get(MULTIVIEW);
+    defines.boolDef.set(MULTIVIEW, scene->activeCamera()->outputRenderTarget != nullptr
+                                     && scene->activeCamera()->outputRenderTarget->getViewCount()
+                                          > 1);
+    if (defines.boolDef.get(MULTIVIEW) != previousMultiview) {
       defines.markAsUnprocessed();
     }
   }
@@ -270,35 +367,35 @@ void MaterialHelper::PrepareDefinesForLight(Scene* scene, AbstractMesh* mesh, co
 {
   state.needNormals = true;
 
-  auto lightIndexStr = std::to_string(lightIndex);
+  const auto indices = GetLightDefineIndices(lightIndex);
 
-  if (!stl_util::contains(defines.boolDef, "LIGHT" + lightIndexStr)) {
+  if (!defines.boolDef.contains(indices.light)) {
     state.needRebuild = true;
   }
 
-  defines.boolDef["LIGHT" + lightIndexStr] = true;
+  defines.boolDef[indices.light] = true;
 
-  defines.boolDef["SPOTLIGHT" + lightIndexStr]  = false;
-  defines.boolDef["HEMILIGHT" + lightIndexStr]  = false;
-  defines.boolDef["POINTLIGHT" + lightIndexStr] = false;
-  defines.boolDef["DIRLIGHT" + lightIndexStr]   = false;
+  defines.boolDef[indices.spotLight]  = false;
+  defines.boolDef[indices.hemiLight]  = false;
+  defines.boolDef[indices.pointLight] = false;
+  defines.boolDef[indices.dirLight]   = false;
 
   light->prepareLightSpecificDefines(defines, lightIndex);
 
   // FallOff.
-  defines.boolDef["LIGHT_FALLOFF_PHYSICAL" + lightIndexStr] = false;
-  defines.boolDef["LIGHT_FALLOFF_GLTF" + lightIndexStr]     = false;
-  defines.boolDef["LIGHT_FALLOFF_STANDARD" + lightIndexStr] = false;
+  defines.boolDef[indices.falloffPhysical] = false;
+  defines.boolDef[indices.falloffGltf]     = false;
+  defines.boolDef[indices.falloffStandard] = false;
 
   switch (light->falloffType) {
     case Light::FALLOFF_GLTF:
-      defines.boolDef["LIGHT_FALLOFF_GLTF" + lightIndexStr] = true;
+      defines.boolDef[indices.falloffGltf] = true;
       break;
     case Light::FALLOFF_PHYSICAL:
-      defines.boolDef["LIGHT_FALLOFF_PHYSICAL" + lightIndexStr] = true;
+      defines.boolDef[indices.falloffPhysical] = true;
       break;
     case Light::FALLOFF_STANDARD:
-      defines.boolDef["LIGHT_FALLOFF_STANDARD" + lightIndexStr] = true;
+      defines.boolDef[indices.falloffStandard] = true;
       break;
   }
 
@@ -308,14 +405,14 @@ void MaterialHelper::PrepareDefinesForLight(Scene* scene, AbstractMesh* mesh, co
   }
 
   // Shadows
-  defines.boolDef["SHADOW" + lightIndexStr]              = false;
-  defines.boolDef["SHADOWPCF" + lightIndexStr]           = false;
-  defines.boolDef["SHADOWPCSS" + lightIndexStr]          = false;
-  defines.boolDef["SHADOWPOISSON" + lightIndexStr]       = false;
-  defines.boolDef["SHADOWESM" + lightIndexStr]           = false;
-  defines.boolDef["SHADOWCUBE" + lightIndexStr]          = false;
-  defines.boolDef["SHADOWLOWQUALITY" + lightIndexStr]    = false;
-  defines.boolDef["SHADOWMEDIUMQUALITY" + lightIndexStr] = false;
+  defines.boolDef[indices.shadow]              = false;
+  defines.boolDef[indices.shadowPcf]           = false;
+  defines.boolDef[indices.shadowPcss]          = false;
+  defines.boolDef[indices.shadowPoisson]       = false;
+  defines.boolDef[indices.shadowEsm]           = false;
+  defines.boolDef[indices.shadowCube]          = false;
+  defines.boolDef[indices.shadowLowQuality]    = false;
+  defines.boolDef[indices.shadowMediumQuality] = false;
 
   if (mesh && mesh->receiveShadows() && scene->shadowsEnabled() && light->shadowEnabled) {
     const auto& shadowGenerator = light->getShadowGenerator();
@@ -331,14 +428,14 @@ void MaterialHelper::PrepareDefinesForLight(Scene* scene, AbstractMesh* mesh, co
   }
 
   if (light->lightmapMode() != Light::LIGHTMAP_DEFAULT) {
-    state.lightmapMode                                  = true;
-    defines.boolDef["LIGHTMAPEXCLUDED" + lightIndexStr] = true;
-    defines.boolDef["LIGHTMAPNOSPECULAR" + lightIndexStr]
+    state.lightmapMode                        = true;
+    defines.boolDef[indices.lightmapExcluded] = true;
+    defines.boolDef[indices.lightmapNoSpecular]
       = (light->lightmapMode == Light::LIGHTMAP_SHADOWSONLY);
   }
   else {
-    defines.boolDef["LIGHTMAPEXCLUDED" + lightIndexStr]   = false;
-    defines.boolDef["LIGHTMAPNOSPECULAR" + lightIndexStr] = false;
+    defines.boolDef[indices.lightmapExcluded]   = false;
+    defines.boolDef[indices.lightmapNoSpecular] = false;
   }
 }
 
@@ -347,6 +444,11 @@ bool MaterialHelper::PrepareDefinesForLights(Scene* scene, AbstractMesh* mesh,
                                              unsigned int maxSimultaneousLights,
                                              bool disableLighting)
 {
+  static const auto SPECULARTERM     = MaterialDefinesSchema::IndexOf("SPECULARTERM");
+  static const auto SHADOWS          = MaterialDefinesSchema::IndexOf("SHADOWS");
+  static const auto SHADOWFLOAT      = MaterialDefinesSchema::IndexOf("SHADOWFLOAT");
+  static const auto LIGHTMAPEXCLUDED = MaterialDefinesSchema::IndexOf("LIGHTMAPEXCLUDED");
+
   if (!defines._areLightsDirty) {
     return defines._needNormals;
   }
@@ -371,41 +473,40 @@ bool MaterialHelper::PrepareDefinesForLights(Scene* scene, AbstractMesh* mesh,
     }
   }
 
-  defines.boolDef["SPECULARTERM"] = state.specularEnabled;
-  defines.boolDef["SHADOWS"]      = state.shadowEnabled;
+  defines.boolDef[SPECULARTERM] = state.specularEnabled;
+  defines.boolDef[SHADOWS]      = state.shadowEnabled;
 
   // Resetting all other lights if any
-  auto lightIndexStr = std::to_string(lightIndex);
   for (auto index = lightIndex; index < maxSimultaneousLights; ++index) {
-    const auto indexStr = std::to_string(index);
-    if (stl_util::contains(defines.boolDef, "LIGHT" + indexStr)) {
-      defines.boolDef["LIGHT" + indexStr]               = false;
-      defines.boolDef["HEMILIGHT" + indexStr]           = false;
-      defines.boolDef["POINTLIGHT" + indexStr]          = false;
-      defines.boolDef["DIRLIGHT" + indexStr]            = false;
-      defines.boolDef["SPOTLIGHT" + indexStr]           = false;
-      defines.boolDef["SHADOW" + indexStr]              = false;
-      defines.boolDef["SHADOWPCF" + indexStr]           = false;
-      defines.boolDef["SHADOWPCSS" + indexStr]          = false;
-      defines.boolDef["SHADOWPOISSON" + indexStr]       = false;
-      defines.boolDef["SHADOWESM" + indexStr]           = false;
-      defines.boolDef["SHADOWCUBE" + indexStr]          = false;
-      defines.boolDef["SHADOWLOWQUALITY" + indexStr]    = false;
-      defines.boolDef["SHADOWMEDIUMQUALITY" + indexStr] = false;
+    const auto indices = GetLightDefineIndices(index);
+    if (defines.boolDef.contains(indices.light)) {
+      defines.boolDef[indices.light]               = false;
+      defines.boolDef[indices.hemiLight]           = false;
+      defines.boolDef[indices.pointLight]          = false;
+      defines.boolDef[indices.dirLight]            = false;
+      defines.boolDef[indices.spotLight]           = false;
+      defines.boolDef[indices.shadow]              = false;
+      defines.boolDef[indices.shadowPcf]           = false;
+      defines.boolDef[indices.shadowPcss]          = false;
+      defines.boolDef[indices.shadowPoisson]       = false;
+      defines.boolDef[indices.shadowEsm]           = false;
+      defines.boolDef[indices.shadowCube]          = false;
+      defines.boolDef[indices.shadowLowQuality]    = false;
+      defines.boolDef[indices.shadowMediumQuality] = false;
     }
   }
 
   auto caps = scene->getEngine()->getCaps();
 
-  if (!stl_util::contains(defines.boolDef, "SHADOWFLOAT")) {
+  if (!defines.boolDef.contains(SHADOWFLOAT)) {
     state.needRebuild = true;
   }
 
-  defines.boolDef["SHADOWFLOAT"]
+  defines.boolDef[SHADOWFLOAT]
     = state.shadowEnabled
       && ((caps.textureFloatRender && caps.textureFloatLinearFiltering)
           || (caps.textureHalfFloatRender && caps.textureHalfFloatLinearFiltering));
-  defines.boolDef["LIGHTMAPEXCLUDED"] = state.lightmapMode;
+  defines.boolDef[LIGHTMAPEXCLUDED] = state.lightmapMode;
 
   if (state.needRebuild) {
     defines.rebuild();
@@ -461,6 +562,8 @@ void MaterialHelper::PrepareUniformsAndSamplersList(std::vector<std::string>& un
                                                     MaterialDefines& defines,
                                                     unsigned int maxSimultaneousLights)
 {
+  static const auto NUM_MORPH_INFLUENCERS = MaterialDefinesSchema::IndexOf("NUM_MORPH_INFLUENCERS");
+
   std::vector<std::string> uniformBuffersList;
 
   for (unsigned int lightIndex = 0; lightIndex < maxSimultaneousLights; ++lightIndex) {
@@ -474,14 +577,15 @@ void MaterialHelper::PrepareUniformsAndSamplersList(std::vector<std::string>& un
                                        defines["PROJECTEDLIGHTTEXTURE" + lightIndexStr]);
   }
 
-  if (stl_util::contains(defines.intDef, "NUM_MORPH_INFLUENCERS")
-      && defines.intDef["NUM_MORPH_INFLUENCERS"]) {
+  if (defines.intDef.contains(NUM_MORPH_INFLUENCERS) && defines.intDef[NUM_MORPH_INFLUENCERS]) {
     uniformsList.emplace_back("morphTargetInfluences");
   }
 }
 
 void MaterialHelper::PrepareUniformsAndSamplersList(IEffectCreationOptions& options)
 {
+  static const auto NUM_MORPH_INFLUENCERS = MaterialDefinesSchema::IndexOf("NUM_MORPH_INFLUENCERS");
+
   auto& uniformsList          = options.uniformsNames;
   auto& uniformBuffersList    = options.uniformBuffersNames;
   auto& samplersList          = options.samplers;
@@ -499,8 +603,7 @@ void MaterialHelper::PrepareUniformsAndSamplersList(IEffectCreationOptions& opti
                                        defines["PROJECTEDLIGHTTEXTURE" + lightIndexStr]);
   }
 
-  if (stl_util::contains(defines.intDef, "NUM_MORPH_INFLUENCERS")
-      && defines.intDef["NUM_MORPH_INFLUENCERS"]) {
+  if (defines.intDef.contains(NUM_MORPH_INFLUENCERS) && defines.intDef[NUM_MORPH_INFLUENCERS]) {
     uniformsList.emplace_back("morphTargetInfluences");
   }
 }
@@ -510,11 +613,13 @@ unsigned int MaterialHelper::HandleFallbacksForShadows(MaterialDefines& defines,
                                                        unsigned int maxSimultaneousLights,
                                                        unsigned int rank)
 {
+  static const auto SHADOWS = MaterialDefinesSchema::IndexOf("SHADOWS");
+
   unsigned int lightFallbackRank = 0;
   for (unsigned int lightIndex = 0; lightIndex < maxSimultaneousLights; ++lightIndex) {
     const std::string lightIndexStr = std::to_string(lightIndex);
 
-    if (!stl_util::contains(defines.boolDef, "LIGHT" + lightIndexStr)) {
+    if (!defines.boolDef.contains("LIGHT" + lightIndexStr)) {
       break;
     }
 
@@ -523,7 +628,7 @@ unsigned int MaterialHelper::HandleFallbacksForShadows(MaterialDefines& defines,
       fallbacks.addFallback(lightFallbackRank, "LIGHT" + lightIndexStr);
     }
 
-    if (!defines["SHADOWS"]) {
+    if (!defines[SHADOWS]) {
       if (defines["SHADOW" + lightIndexStr]) {
         fallbacks.addFallback(rank, "SHADOW" + lightIndexStr);
       }
@@ -553,23 +658,30 @@ void MaterialHelper::PrepareAttributesForMorphTargetsInfluencers(std::vector<std
                                                                  AbstractMesh* mesh,
                                                                  unsigned int influencers)
 {
-  _TmpMorphInfluencers->intDef["NUM_MORPH_INFLUENCERS"] = influencers;
+  static const auto NUM_MORPH_INFLUENCERS = MaterialDefinesSchema::IndexOf("NUM_MORPH_INFLUENCERS");
+
+  _TmpMorphInfluencers->intDef[NUM_MORPH_INFLUENCERS] = influencers;
   PrepareAttributesForMorphTargets(attribs, mesh, *_TmpMorphInfluencers);
 }
 
 void MaterialHelper::PrepareAttributesForMorphTargets(std::vector<std::string>& attribs,
                                                       AbstractMesh* mesh, MaterialDefines& defines)
 {
-  auto influencers = defines.intDef["NUM_MORPH_INFLUENCERS"];
+  static const auto NUM_MORPH_INFLUENCERS = MaterialDefinesSchema::IndexOf("NUM_MORPH_INFLUENCERS");
+  static const auto NORMAL                = MaterialDefinesSchema::IndexOf("NORMAL");
+  static const auto TANGENT               = MaterialDefinesSchema::IndexOf("TANGENT");
+  static const auto UV1                   = MaterialDefinesSchema::IndexOf("UV1");
+
+  unsigned int influencers = defines.intDef[NUM_MORPH_INFLUENCERS];
 
   auto engine = Engine::LastCreatedEngine();
   auto _mesh  = static_cast<Mesh*>(mesh);
   if (influencers > 0 && engine && _mesh) {
     auto maxAttributesCount = static_cast<unsigned>(engine->getCaps().maxVertexAttribs);
     auto manager            = _mesh->morphTargetManager();
-    auto normal             = manager && manager->supportsNormals() && defines["NORMAL"];
-    auto tangent            = manager && manager->supportsNormals() && defines["TANGENT"];
-    auto uv                 = manager && manager->supportsUVs() && defines["UV1"];
+    auto normal             = manager && manager->supportsNormals() && defines[NORMAL];
+    auto tangent            = manager && manager->supportsNormals() && defines[TANGENT];
+    auto uv                 = manager && manager->supportsUVs() && defines[UV1];
     for (auto index = 0u; index < influencers; ++index) {
       const auto indexStr = std::to_string(index);
       attribs.emplace_back(VertexBuffer::PositionKind + indexStr);
@@ -598,12 +710,14 @@ void MaterialHelper::PrepareAttributesForBones(std::vector<std::string>& attribs
                                                AbstractMesh* mesh, MaterialDefines& defines,
                                                EffectFallbacks& fallbacks)
 {
-  if (defines.intDef["NUM_BONE_INFLUENCERS"] > 0) {
+  static const auto NUM_BONE_INFLUENCERS = MaterialDefinesSchema::IndexOf("NUM_BONE_INFLUENCERS");
+
+  if (defines.intDef[NUM_BONE_INFLUENCERS] > 0) {
     fallbacks.addCPUSkinningFallback(0, mesh);
 
     attribs.emplace_back(VertexBuffer::MatricesIndicesKind);
     attribs.emplace_back(VertexBuffer::MatricesWeightsKind);
-    if (defines.intDef["NUM_BONE_INFLUENCERS"] > 4) {
+    if (defines.intDef[NUM_BONE_INFLUENCERS] > 4) {
       attribs.emplace_back(VertexBuffer::MatricesIndicesExtraKind);
       attribs.emplace_back(VertexBuffer::MatricesWeightsExtraKind);
     }
@@ -613,7 +727,9 @@ void MaterialHelper::PrepareAttributesForBones(std::vector<std::string>& attribs
 void MaterialHelper::PrepareAttributesForInstances(std::vector<std::string>& attribs,
                                                    MaterialDefines& defines)
 {
-  if (defines["INSTANCES"]) {
+  static const auto INSTANCES = MaterialDefinesSchema::IndexOf("INSTANCES");
+
+  if (defines[INSTANCES]) {
     PushAttributesForInstances(attribs);
   }
 }
@@ -657,12 +773,14 @@ void MaterialHelper::BindLights(Scene* scene, AbstractMesh* mesh, const EffectPt
                                 MaterialDefines& defines, unsigned int maxSimultaneousLights,
                                 bool usePhysicalLightFalloff, bool rebuildInParallel)
 {
+  static const auto SPECULARTERM = MaterialDefinesSchema::IndexOf("SPECULARTERM");
+
   auto len = std::min(mesh->lightSources().size(), static_cast<size_t>(maxSimultaneousLights));
 
   for (unsigned i = 0u; i < len; ++i) {
 
     auto& light = mesh->lightSources()[i];
-    BindLight(light, i, scene, effect, defines["SPECULARTERM"], usePhysicalLightFalloff,
+    BindLight(light, i, scene, effect, defines[SPECULARTERM], usePhysicalLightFalloff,
               rebuildInParallel);
   }
 }
@@ -671,15 +789,17 @@ void MaterialHelper::BindFogParameters(Scene* scene, AbstractMesh* mesh, const E
                                        bool linearSpace)
 {
   if (scene->fogEnabled() && mesh->applyFog() && scene->fogMode() != Scene::FOGMODE_NONE) {
-    effect->setFloat4("vFogInfos", static_cast<float>(scene->fogMode()), scene->fogStart,
+    static const auto fogInfosHandle = Effect::UniformHandle("vFogInfos");
+    static const auto fogColorHandle = Effect::UniformHandle("vFogColor");
+    effect->setFloat4(fogInfosHandle, static_cast<float>(scene->fogMode()), scene->fogStart,
                       scene->fogEnd, scene->fogDensity);
     // Convert fog color to linear space if used in a linear space computed shader.
     if (linearSpace) {
       scene->fogColor.toLinearSpaceToRef(MaterialHelper::_tempFogColor);
-      effect->setColor3("vFogColor", MaterialHelper::_tempFogColor);
+      effect->setColor3(fogColorHandle, MaterialHelper::_tempFogColor);
     }
     else {
-      effect->setColor3("vFogColor", scene->fogColor);
+      effect->setColor3(fogColorHandle, scene->fogColor);
     }
   }
 }
@@ -694,18 +814,20 @@ void MaterialHelper::BindBonesParameters(AbstractMesh* mesh, const EffectPtr& ef
   }
 
   if (mesh->useBones() && mesh->computeBonesUsingShaders() && mesh->skeleton()) {
-    const auto& skeleton = mesh->skeleton();
+    static const auto boneTextureWidthHandle = Effect::UniformHandle("boneTextureWidth");
+    static const auto bonesHandle            = Effect::UniformHandle("mBones");
+    const auto& skeleton                     = mesh->skeleton();
 
     if (skeleton->isUsingTextureForMatrices && effect->getUniformIndex("boneTextureWidth") > -1) {
       const auto& boneTexture = skeleton->getTransformMatrixTexture(mesh);
       effect->setTexture("boneSampler", boneTexture);
-      effect->setFloat("boneTextureWidth", 4.f * (skeleton->bones.size() + 1.f));
+      effect->setFloat(boneTextureWidthHandle, 4.f * (skeleton->bones.size() + 1.f));
     }
     else {
       const auto& matrices = skeleton->getTransformMatrices(mesh);
 
       if (!matrices.empty()) {
-        effect->setMatrices("mBones", matrices);
+        effect->setMatrices(bonesHandle, matrices);
       }
     }
   }
@@ -726,7 +848,9 @@ void MaterialHelper::BindMorphTargetParameters(AbstractMesh* abstractMesh, const
 
 void MaterialHelper::BindLogDepth(MaterialDefines& defines, const EffectPtr& effect, Scene* scene)
 {
-  if (defines["LOGARITHMICDEPTH"]) {
+  static const auto LOGARITHMICDEPTH = MaterialDefinesSchema::IndexOf("LOGARITHMICDEPTH");
+
+  if (defines[LOGARITHMICDEPTH]) {
     effect->setFloat("logarithmicDepthConstant",
                      2.f / (std::log(scene->activeCamera()->maxZ + 1.f) / Math::LN2));
   }
@@ -734,35 +858,41 @@ void MaterialHelper::BindLogDepth(MaterialDefines& defines, const EffectPtr& eff
 
 void MaterialHelper::BindClipPlane(const EffectPtr& effect, Scene* scene)
 {
+  static const auto clipPlaneHandle  = Effect::UniformHandle("vClipPlane");
+  static const auto clipPlane2Handle = Effect::UniformHandle("vClipPlane2");
+  static const auto clipPlane3Handle = Effect::UniformHandle("vClipPlane3");
+  static const auto clipPlane4Handle = Effect::UniformHandle("vClipPlane4");
+  static const auto clipPlane5Handle = Effect::UniformHandle("vClipPlane5");
+  static const auto clipPlane6Handle = Effect::UniformHandle("vClipPlane6");
   if (scene->clipPlane) {
     const auto& clipPlane = *scene->clipPlane;
-    effect->setFloat4("vClipPlane", clipPlane.normal.x, clipPlane.normal.y, clipPlane.normal.z,
+    effect->setFloat4(clipPlaneHandle, clipPlane.normal.x, clipPlane.normal.y, clipPlane.normal.z,
                       clipPlane.d);
   }
   if (scene->clipPlane2) {
     const auto& clipPlane = *scene->clipPlane2;
-    effect->setFloat4("vClipPlane2", clipPlane.normal.x, clipPlane.normal.y, clipPlane.normal.z,
+    effect->setFloat4(clipPlane2Handle, clipPlane.normal.x, clipPlane.normal.y, clipPlane.normal.z,
                       clipPlane.d);
   }
   if (scene->clipPlane3) {
     const auto& clipPlane = *scene->clipPlane3;
-    effect->setFloat4("vClipPlane3", clipPlane.normal.x, clipPlane.normal.y, clipPlane.normal.z,
+    effect->setFloat4(clipPlane3Handle, clipPlane.normal.x, clipPlane.normal.y, clipPlane.normal.z,
                       clipPlane.d);
   }
   if (scene->clipPlane4) {
     const auto& clipPlane = *scene->clipPlane4;
-    effect->setFloat4("vClipPlane4", clipPlane.normal.x, clipPlane.normal.y, clipPlane.normal.z,
+    effect->setFloat4(clipPlane4Handle, clipPlane.normal.x, clipPlane.normal.y, clipPlane.normal.z,
                       clipPlane.d);
   }
   if (scene->clipPlane5) {
     const auto& clipPlane = scene->clipPlane5;
-    effect->setFloat4("vClipPlane5", clipPlane->normal.x, clipPlane->normal.y, clipPlane->normal.z,
-                      clipPlane->d);
+    effect->setFloat4(clipPlane5Handle, clipPlane->normal.x, clipPlane->normal.y,
+                      clipPlane->normal.z, clipPlane->d);
   }
   if (scene->clipPlane6) {
     const auto& clipPlane = scene->clipPlane6;
-    effect->setFloat4("vClipPlane6", clipPlane->normal.x, clipPlane->normal.y, clipPlane->normal.z,
-                      clipPlane->d);
+    effect->setFloat4(clipPlane6Handle, clipPlane->normal.x, clipPlane->normal.y,
+                      clipPlane->normal.z, clipPlane->d);
   }
 }
 
@@ -165,7 +165,7 @@ void MorphTargetsBlock::replaceRepeatableContent(
   const auto& _tangentOutput  = tangentOutput();
   const auto& _uvOutput       = uvOutput();
   auto& _state                = vertexShaderState;
-  auto repeatCount            = defines.intDef["NUM_MORPH_INFLUENCERS"];
+  unsigned int repeatCount    = defines.intDef["NUM_MORPH_INFLUENCERS"];
   _repeatebleContentGenerated = repeatCount;
 
   auto& manager    = static_cast<Mesh*>(mesh)->morphTargetManager();
@@ -457,6 +457,31 @@ EffectPtr PBRBaseMaterial::_prepareEffect(
   std::function<void(Effect* effect, const std::string& errors)> iOnError,
   const std::optional<bool>& useInstances, const std::optional<bool>& useClipPlane)
 {
+  static const auto USESPHERICALINVERTEX = MaterialDefinesSchema::IndexOf("USESPHERICALINVERTEX");
+  static const auto FOG                  = MaterialDefinesSchema::IndexOf("FOG");
+  static const auto SPECULARAA           = MaterialDefinesSchema::IndexOf("SPECULARAA");
+  static const auto POINTSIZE            = MaterialDefinesSchema::IndexOf("POINTSIZE");
+  static const auto LOGARITHMICDEPTH     = MaterialDefinesSchema::IndexOf("LOGARITHMICDEPTH");
+  static const auto PARALLAX             = MaterialDefinesSchema::IndexOf("PARALLAX");
+  static const auto PARALLAXOCCLUSION    = MaterialDefinesSchema::IndexOf("PARALLAXOCCLUSION");
+  static const auto ENVIRONMENTBRDF      = MaterialDefinesSchema::IndexOf("ENVIRONMENTBRDF");
+  static const auto TANGENT              = MaterialDefinesSchema::IndexOf("TANGENT");
+  static const auto BUMP                 = MaterialDefinesSchema::IndexOf("BUMP");
+  static const auto SPECULARTERM         = MaterialDefinesSchema::IndexOf("SPECULARTERM");
+  static const auto USESPHERICALFROMREFLECTIONMAP
+    = MaterialDefinesSchema::IndexOf("USESPHERICALFROMREFLECTIONMAP");
+  static const auto USEIRRADIANCEMAP      = MaterialDefinesSchema::IndexOf("USEIRRADIANCEMAP");
+  static const auto LIGHTMAP              = MaterialDefinesSchema::IndexOf("LIGHTMAP");
+  static const auto NORMAL                = MaterialDefinesSchema::IndexOf("NORMAL");
+  static const auto AMBIENT               = MaterialDefinesSchema::IndexOf("AMBIENT");
+  static const auto EMISSIVE              = MaterialDefinesSchema::IndexOf("EMISSIVE");
+  static const auto VERTEXCOLOR           = MaterialDefinesSchema::IndexOf("VERTEXCOLOR");
+  static const auto MORPHTARGETS          = MaterialDefinesSchema::IndexOf("MORPHTARGETS");
+  static const auto MULTIVIEW             = MaterialDefinesSchema::IndexOf("MULTIVIEW");
+  static const auto UV1                   = MaterialDefinesSchema::IndexOf("UV1");
+  static const auto UV2                   = MaterialDefinesSchema::IndexOf("UV2");
+  static const auto NUM_MORPH_INFLUENCERS = MaterialDefinesSchema::IndexOf("NUM_MORPH_INFLUENCERS");
+
   _prepareDefines(mesh, defines, useInstances, useClipPlane);
   if (!defines.isDirty()) {
     return nullptr;
@@ -470,26 +495,26 @@ EffectPtr PBRBaseMaterial::_prepareEffect(
   // Fallbacks
   auto fallbacks    = std::make_unique<EffectFallbacks>();
   auto fallbackRank = 0u;
-  if (defines["USESPHERICALINVERTEX"]) {
+  if (defines[USESPHERICALINVERTEX]) {
     fallbacks->addFallback(fallbackRank++, "USESPHERICALINVERTEX");
   }
 
-  if (defines["FOG"]) {
+  if (defines[FOG]) {
     fallbacks->addFallback(fallbackRank, "FOG");
   }
-  if (defines["SPECULARAA"]) {
+  if (defines[SPECULARAA]) {
     fallbacks->addFallback(fallbackRank, "SPECULARAA");
   }
-  if (defines["POINTSIZE"]) {
+  if (defines[POINTSIZE]) {
     fallbacks->addFallback(fallbackRank, "POINTSIZE");
   }
-  if (defines["LOGARITHMICDEPTH"]) {
+  if (defines[LOGARITHMICDEPTH]) {
     fallbacks->addFallback(fallbackRank, "LOGARITHMICDEPTH");
   }
-  if (defines["PARALLAX"]) {
+  if (defines[PARALLAX]) {
     fallbacks->addFallback(fallbackRank, "PARALLAX");
   }
-  if (defines["PARALLAXOCCLUSION"]) {
+  if (defines[PARALLAXOCCLUSION]) {
     fallbacks->addFallback(fallbackRank++, "PARALLAXOCCLUSION");
   }
 
@@ -498,81 +523,81 @@ EffectPtr PBRBaseMaterial::_prepareEffect(
   fallbackRank = PBRSubSurfaceConfiguration::AddFallbacks(defines, *fallbacks, fallbackRank);
   fallbackRank = PBRSheenConfiguration::AddFallbacks(defines, *fallbacks, fallbackRank);
 
-  if (defines["ENVIRONMENTBRDF"]) {
+  if (defines[ENVIRONMENTBRDF]) {
     fallbacks->addFallback(fallbackRank++, "ENVIRONMENTBRDF");
   }
 
-  if (defines["TANGENT"]) {
+  if (defines[TANGENT]) {
     fallbacks->addFallback(fallbackRank++, "TANGENT");
   }
 
-  if (defines["BUMP"]) {
+  if (defines[BUMP]) {
     fallbacks->addFallback(fallbackRank++, "BUMP");
   }
 
   fallbackRank = MaterialHelper::HandleFallbacksForShadows(defines, *fallbacks,
                                                            _maxSimultaneousLights, fallbackRank++);
 
-  if (defines["SPECULARTERM"]) {
+  if (defines[SPECULARTERM]) {
     fallbacks->addFallback(fallbackRank++, "SPECULARTERM");
   }
 
-  if (defines["USESPHERICALFROMREFLECTIONMAP"]) {
+  if (defines[USESPHERICALFROMREFLECTIONMAP]) {
     fallbacks->addFallback(fallbackRank++, "USESPHERICALFROMREFLECTIONMAP");
   }
 
-  if (defines["USEIRRADIANCEMAP"]) {
+  if (defines[USEIRRADIANCEMAP]) {
     fallbacks->addFallback(fallbackRank++, "USEIRRADIANCEMAP");
   }
 
-  if (defines["LIGHTMAP"]) {
+  if (defines[LIGHTMAP]) {
     fallbacks->addFallback(fallbackRank++, "LIGHTMAP");
   }
 
-  if (defines["NORMAL"]) {
+  if (defines[NORMAL]) {
     fallbacks->addFallback(fallbackRank++, "NORMAL");
   }
 
-  if (defines["AMBIENT"]) {
+  if (defines[AMBIENT]) {
     fallbacks->addFallback(fallbackRank++, "AMBIENT");
   }
 
-  if (defines["EMISSIVE"]) {
+  if (defines[EMISSIVE]) {
     fallbacks->addFallback(fallbackRank++, "EMISSIVE");
   }
 
-  if (defines["VERTEXCOLOR"]) {
+  if (defines[VERTEXCOLOR]) {
     fallbacks->addFallback(fallbackRank++, "VERTEXCOLOR");
   }
 
-  if (defines["MORPHTARGETS"]) {
+  if (defines[MORPHTARGETS]) {
     fallbacks->addFallback(fallbackRank++, "MORPHTARGETS");
   }
 
-  if (defines["MULTIVIEW"]) {
+  if (defines[MULTIVIEW]) {
     fallbacks->addFallback(0, "MULTIVIEW");
   }
 
   // Attributes
   std::vector<std::string> attribs{VertexBuffer::PositionKind};
 
-  if (defines["NORMAL"]) {
+  if (defines[NORMAL]) {
     attribs.emplace_back(VertexBuffer::NormalKind);
   }
 
-  if (defines["TANGENT"]) {
+  if (defines[TANGENT]) {
     attribs.emplace_back(VertexBuffer::TangentKind);
   }
 
-  if (defines["UV1"]) {
+  if (defines[UV1]) {
     attribs.emplace_back(VertexBuffer::UVKind);
   }
 
-  if (defines["UV2"]) {
+  if (defines[UV2]) {
     attribs.emplace_back(VertexBuffer::UV2Kind);
   }
 
-  if (defines["VERTEXCOLOR"]) {
+  if (defines[VERTEXCOLOR]) {
     attribs.emplace_back(VertexBuffer::ColorKind);
   }
 
@@ -678,7 +703,7 @@ EffectPtr PBRBaseMaterial::_prepareEffect(
 
   std::unordered_map<std::string, unsigned int> indexParameters{
     {"maxSimultaneousLights", _maxSimultaneousLights},
-    {"maxSimultaneousMorphTargets", defines.intDef["NUM_MORPH_INFLUENCERS"]}};
+    {"maxSimultaneousMorphTargets", defines.intDef[NUM_MORPH_INFLUENCERS]}};
 
   if (customShaderNameResolve) {
     shaderName = customShaderNameResolve(shaderName, uniforms, uniformBuffers, samplers, defines);
@@ -708,6 +733,91 @@ void PBRBaseMaterial::_prepareDefines(AbstractMesh* mesh, PBRMaterialDefines& de
                                       const std::optional<bool>& useInstances,
                                       const std::optional<bool>& useClipPlane)
 {
+  static const auto METALLICWORKFLOW     = MaterialDefinesSchema::IndexOf("METALLICWORKFLOW");
+  static const auto LODBASEDMICROSFURACE = MaterialDefinesSchema::IndexOf("LODBASEDMICROSFURACE");
+  static const auto ALBEDO               = MaterialDefinesSchema::IndexOf("ALBEDO");
+  static const auto AMBIENTINGRAYSCALE   = MaterialDefinesSchema::IndexOf("AMBIENTINGRAYSCALE");
+  static const auto AMBIENT              = MaterialDefinesSchema::IndexOf("AMBIENT");
+  static const auto OPACITYRGB           = MaterialDefinesSchema::IndexOf("OPACITYRGB");
+  static const auto OPACITY              = MaterialDefinesSchema::IndexOf("OPACITY");
+  static const auto REFLECTION           = MaterialDefinesSchema::IndexOf("REFLECTION");
+  static const auto GAMMAREFLECTION      = MaterialDefinesSchema::IndexOf("GAMMAREFLECTION");
+  static const auto RGBDREFLECTION       = MaterialDefinesSchema::IndexOf("RGBDREFLECTION");
+  static const auto REFLECTIONMAP_OPPOSITEZ
+    = MaterialDefinesSchema::IndexOf("REFLECTIONMAP_OPPOSITEZ");
+  static const auto LODINREFLECTIONALPHA = MaterialDefinesSchema::IndexOf("LODINREFLECTIONALPHA");
+  static const auto LINEARSPECULARREFLECTION
+    = MaterialDefinesSchema::IndexOf("LINEARSPECULARREFLECTION");
+  static const auto INVERTCUBICMAP      = MaterialDefinesSchema::IndexOf("INVERTCUBICMAP");
+  static const auto REFLECTIONMAP_3D    = MaterialDefinesSchema::IndexOf("REFLECTIONMAP_3D");
+  static const auto REFLECTIONMAP_CUBIC = MaterialDefinesSchema::IndexOf("REFLECTIONMAP_CUBIC");
+  static const auto REFLECTIONMAP_EXPLICIT
+    = MaterialDefinesSchema::IndexOf("REFLECTIONMAP_EXPLICIT");
+  static const auto REFLECTIONMAP_PLANAR = MaterialDefinesSchema::IndexOf("REFLECTIONMAP_PLANAR");
+  static const auto REFLECTIONMAP_PROJECTION
+    = MaterialDefinesSchema::IndexOf("REFLECTIONMAP_PROJECTION");
+  static const auto REFLECTIONMAP_SKYBOX = MaterialDefinesSchema::IndexOf("REFLECTIONMAP_SKYBOX");
+  static const auto REFLECTIONMAP_SPHERICAL
+    = MaterialDefinesSchema::IndexOf("REFLECTIONMAP_SPHERICAL");
+  static const auto REFLECTIONMAP_EQUIRECTANGULAR
+    = MaterialDefinesSchema::IndexOf("REFLECTIONMAP_EQUIRECTANGULAR");
+  static const auto REFLECTIONMAP_EQUIRECTANGULAR_FIXED
+    = MaterialDefinesSchema::IndexOf("REFLECTIONMAP_EQUIRECTANGULAR_FIXED");
+  static const auto REFLECTIONMAP_MIRROREDEQUIRECTANGULAR_FIXED
+    = MaterialDefinesSchema::IndexOf("REFLECTIONMAP_MIRROREDEQUIRECTANGULAR_FIXED");
+  static const auto REFLECTIONMAP_SKYBOX_TRANSFORMED
+    = MaterialDefinesSchema::IndexOf("REFLECTIONMAP_SKYBOX_TRANSFORMED");
+  static const auto USE_LOCAL_REFLECTIONMAP_CUBIC
+    = MaterialDefinesSchema::IndexOf("USE_LOCAL_REFLECTIONMAP_CUBIC");
+  static const auto USEIRRADIANCEMAP = MaterialDefinesSchema::IndexOf("USEIRRADIANCEMAP");
+  static const auto USESPHERICALFROMREFLECTIONMAP
+    = MaterialDefinesSchema::IndexOf("USESPHERICALFROMREFLECTIONMAP");
+  static const auto USESPHERICALINVERTEX = MaterialDefinesSchema::IndexOf("USESPHERICALINVERTEX");
+  static const auto USELIGHTMAPASSHADOWMAP
+    = MaterialDefinesSchema::IndexOf("USELIGHTMAPASSHADOWMAP");
+  static const auto GAMMALIGHTMAP = MaterialDefinesSchema::IndexOf("GAMMALIGHTMAP");
+  static const auto RGBDLIGHTMAP  = MaterialDefinesSchema::IndexOf("RGBDLIGHTMAP");
+  static const auto LIGHTMAP      = MaterialDefinesSchema::IndexOf("LIGHTMAP");
+  static const auto EMISSIVE      = MaterialDefinesSchema::IndexOf("EMISSIVE");
+  static const auto ROUGHNESSSTOREINMETALMAPALPHA
+    = MaterialDefinesSchema::IndexOf("ROUGHNESSSTOREINMETALMAPALPHA");
+  static const auto ROUGHNESSSTOREINMETALMAPGREEN
+    = MaterialDefinesSchema::IndexOf("ROUGHNESSSTOREINMETALMAPGREEN");
+  static const auto METALLNESSSTOREINMETALMAPBLUE
+    = MaterialDefinesSchema::IndexOf("METALLNESSSTOREINMETALMAPBLUE");
+  static const auto AOSTOREINMETALMAPRED = MaterialDefinesSchema::IndexOf("AOSTOREINMETALMAPRED");
+  static const auto METALLICF0FACTORFROMMETALLICMAP
+    = MaterialDefinesSchema::IndexOf("METALLICF0FACTORFROMMETALLICMAP");
+  static const auto MICROSURFACEFROMREFLECTIVITYMAP
+    = MaterialDefinesSchema::IndexOf("MICROSURFACEFROMREFLECTIVITYMAP");
+  static const auto MICROSURFACEAUTOMATIC = MaterialDefinesSchema::IndexOf("MICROSURFACEAUTOMATIC");
+  static const auto REFLECTIVITY          = MaterialDefinesSchema::IndexOf("REFLECTIVITY");
+  static const auto MICROSURFACEMAP       = MaterialDefinesSchema::IndexOf("MICROSURFACEMAP");
+  static const auto PARALLAX              = MaterialDefinesSchema::IndexOf("PARALLAX");
+  static const auto PARALLAXOCCLUSION     = MaterialDefinesSchema::IndexOf("PARALLAXOCCLUSION");
+  static const auto OBJECTSPACE_NORMALMAP = MaterialDefinesSchema::IndexOf("OBJECTSPACE_NORMALMAP");
+  static const auto BUMP                  = MaterialDefinesSchema::IndexOf("BUMP");
+  static const auto ENVIRONMENTBRDF       = MaterialDefinesSchema::IndexOf("ENVIRONMENTBRDF");
+  static const auto ENVIRONMENTBRDF_RGBD  = MaterialDefinesSchema::IndexOf("ENVIRONMENTBRDF_RGBD");
+  static const auto ALPHAFROMALBEDO       = MaterialDefinesSchema::IndexOf("ALPHAFROMALBEDO");
+  static const auto SPECULAROVERALPHA     = MaterialDefinesSchema::IndexOf("SPECULAROVERALPHA");
+  static const auto USEPHYSICALLIGHTFALLOFF
+    = MaterialDefinesSchema::IndexOf("USEPHYSICALLIGHTFALLOFF");
+  static const auto USEGLTFLIGHTFALLOFF = MaterialDefinesSchema::IndexOf("USEGLTFLIGHTFALLOFF");
+  static const auto RADIANCEOVERALPHA   = MaterialDefinesSchema::IndexOf("RADIANCEOVERALPHA");
+  static const auto TWOSIDEDLIGHTING    = MaterialDefinesSchema::IndexOf("TWOSIDEDLIGHTING");
+  static const auto SPECULARAA          = MaterialDefinesSchema::IndexOf("SPECULARAA");
+  static const auto ALPHATESTVALUE      = MaterialDefinesSchema::IndexOf("ALPHATESTVALUE");
+  static const auto PREMULTIPLYALPHA    = MaterialDefinesSchema::IndexOf("PREMULTIPLYALPHA");
+  static const auto ALPHABLEND          = MaterialDefinesSchema::IndexOf("ALPHABLEND");
+  static const auto ALPHAFRESNEL        = MaterialDefinesSchema::IndexOf("ALPHAFRESNEL");
+  static const auto LINEARALPHAFRESNEL  = MaterialDefinesSchema::IndexOf("LINEARALPHAFRESNEL");
+  static const auto FORCENORMALFORWARD  = MaterialDefinesSchema::IndexOf("FORCENORMALFORWARD");
+  static const auto RADIANCEOCCLUSION   = MaterialDefinesSchema::IndexOf("RADIANCEOCCLUSION");
+  static const auto HORIZONOCCLUSION    = MaterialDefinesSchema::IndexOf("HORIZONOCCLUSION");
+  static const auto UNLIT               = MaterialDefinesSchema::IndexOf("UNLIT");
+  static const auto DEBUGMODE           = MaterialDefinesSchema::IndexOf("DEBUGMODE");
+
   auto scene  = getScene();
   auto engine = scene->getEngine();
 
@@ -720,182 +830,182 @@ void PBRBaseMaterial::_prepareDefines(AbstractMesh* mesh, PBRMaterialDefines& de
   MaterialHelper::PrepareDefinesForMultiview(scene, defines);
 
   // Textures
-  defines.boolDef["METALLICWORKFLOW"] = isMetallicWorkflow();
+  defines.boolDef[METALLICWORKFLOW] = isMetallicWorkflow();
   if (defines._areTexturesDirty) {
     defines._needUVs = false;
     if (scene->texturesEnabled()) {
       if (scene->getEngine()->getCaps().textureLOD) {
-        defines.boolDef["LODBASEDMICROSFURACE"] = true;
+        defines.boolDef[LODBASEDMICROSFURACE] = true;
       }
 
       if (_albedoTexture && MaterialFlags::DiffuseTextureEnabled()) {
         MaterialHelper::PrepareDefinesForMergedUV(_albedoTexture, defines, "ALBEDO");
       }
       else {
-        defines.boolDef["ALBEDO"] = false;
+        defines.boolDef[ALBEDO] = false;
       }
 
       if (_ambientTexture && MaterialFlags::AmbientTextureEnabled()) {
         MaterialHelper::PrepareDefinesForMergedUV(_ambientTexture, defines, "AMBIENT");
-        defines.boolDef["AMBIENTINGRAYSCALE"] = _useAmbientInGrayScale;
+        defines.boolDef[AMBIENTINGRAYSCALE] = _useAmbientInGrayScale;
       }
       else {
-        defines.boolDef["AMBIENT"] = false;
+        defines.boolDef[AMBIENT] = false;
       }
 
       if (_opacityTexture && MaterialFlags::OpacityTextureEnabled()) {
         MaterialHelper::PrepareDefinesForMergedUV(_opacityTexture, defines, "OPACITY");
-        defines.boolDef["OPACITYRGB"] = _opacityTexture->getAlphaFromRGB;
+        defines.boolDef[OPACITYRGB] = _opacityTexture->getAlphaFromRGB;
       }
       else {
-        defines.boolDef["OPACITY"] = false;
+        defines.boolDef[OPACITY] = false;
       }
 
       auto reflectionTexture = _getReflectionTexture();
       if (reflectionTexture && MaterialFlags::ReflectionTextureEnabled()) {
-        defines.boolDef["REFLECTION"]              = true;
-        defines.boolDef["GAMMAREFLECTION"]         = reflectionTexture->gammaSpace;
-        defines.boolDef["RGBDREFLECTION"]          = reflectionTexture->isRGBD;
-        defines.boolDef["REFLECTIONMAP_OPPOSITEZ"] = getScene()->useRightHandedSystem() ?
+        defines.boolDef[REFLECTION]              = true;
+        defines.boolDef[GAMMAREFLECTION]         = reflectionTexture->gammaSpace;
+        defines.boolDef[RGBDREFLECTION]          = reflectionTexture->isRGBD;
+        defines.boolDef[REFLECTIONMAP_OPPOSITEZ] = getScene()->useRightHandedSystem() ?
                                                        !reflectionTexture->invertZ :
                                                        reflectionTexture->invertZ;
-        defines.boolDef["LODINREFLECTIONALPHA"]     = reflectionTexture->lodLevelInAlpha;
-        defines.boolDef["LINEARSPECULARREFLECTION"] = reflectionTexture->linearSpecularLOD();
+        defines.boolDef[LODINREFLECTIONALPHA]     = reflectionTexture->lodLevelInAlpha;
+        defines.boolDef[LINEARSPECULARREFLECTION] = reflectionTexture->linearSpecularLOD();
 
         if (reflectionTexture->coordinatesMode() == TextureConstants::INVCUBIC_MODE) {
-          defines.boolDef["INVERTCUBICMAP"] = true;
+          defines.boolDef[INVERTCUBICMAP] = true;
         }
 
-        defines.boolDef["REFLECTIONMAP_3D"] = reflectionTexture->isCube();
+        defines.boolDef[REFLECTIONMAP_3D] = reflectionTexture->isCube();
 
-        defines.boolDef["REFLECTIONMAP_CUBIC"]                         = false;
-        defines.boolDef["REFLECTIONMAP_EXPLICIT"]                      = false;
-        defines.boolDef["REFLECTIONMAP_PLANAR"]                        = false;
-        defines.boolDef["REFLECTIONMAP_PROJECTION"]                    = false;
-        defines.boolDef["REFLECTIONMAP_SKYBOX"]                        = false;
-        defines.boolDef["REFLECTIONMAP_SPHERICAL"]                     = false;
-        defines.boolDef["REFLECTIONMAP_EQUIRECTANGULAR"]               = false;
-        defines.boolDef["REFLECTIONMAP_EQUIRECTANGULAR_FIXED"]         = false;
-        defines.boolDef["REFLECTIONMAP_MIRROREDEQUIRECTANGULAR_FIXED"] = false;
-        defines.boolDef["REFLECTIONMAP_SKYBOX_TRANSFORMED"]            = false;
+        defines.boolDef[REFLECTIONMAP_CUBIC]                         = false;
+        defines.boolDef[REFLECTIONMAP_EXPLICIT]                      = false;
+        defines.boolDef[REFLECTIONMAP_PLANAR]                        = false;
+        defines.boolDef[REFLECTIONMAP_PROJECTION]                    = false;
+        defines.boolDef[REFLECTIONMAP_SKYBOX]                        = false;
+        defines.boolDef[REFLECTIONMAP_SPHERICAL]                     = false;
+        defines.boolDef[REFLECTIONMAP_EQUIRECTANGULAR]               = false;
+        defines.boolDef[REFLECTIONMAP_EQUIRECTANGULAR_FIXED]         = false;
+        defines.boolDef[REFLECTIONMAP_MIRROREDEQUIRECTANGULAR_FIXED] = false;
+        defines.boolDef[REFLECTIONMAP_SKYBOX_TRANSFORMED]            = false;
 
         switch (reflectionTexture->coordinatesMode()) {
           case TextureConstants::EXPLICIT_MODE:
-            defines.boolDef["REFLECTIONMAP_EXPLICIT"] = true;
+            defines.boolDef[REFLECTIONMAP_EXPLICIT] = true;
             break;
           case TextureConstants::PLANAR_MODE:
-            defines.boolDef["REFLECTIONMAP_PLANAR"] = true;
+            defines.boolDef[REFLECTIONMAP_PLANAR] = true;
             break;
           case TextureConstants::PROJECTION_MODE:
-            defines.boolDef["REFLECTIONMAP_PROJECTION"] = true;
+            defines.boolDef[REFLECTIONMAP_PROJECTION] = true;
             break;
           case TextureConstants::SKYBOX_MODE:
-            defines.boolDef["REFLECTIONMAP_SKYBOX"] = true;
+            defines.boolDef[REFLECTIONMAP_SKYBOX] = true;
             break;
           case TextureConstants::SPHERICAL_MODE:
-            defines.boolDef["REFLECTIONMAP_SPHERICAL"] = true;
+            defines.boolDef[REFLECTIONMAP_SPHERICAL] = true;
             break;
           case TextureConstants::EQUIRECTANGULAR_MODE:
-            defines.boolDef["REFLECTIONMAP_EQUIRECTANGULAR"] = true;
+            defines.boolDef[REFLECTIONMAP_EQUIRECTANGULAR] = true;
             break;
           case TextureConstants::FIXED_EQUIRECTANGULAR_MODE:
-            defines.boolDef["REFLECTIONMAP_EQUIRECTANGULAR_FIXED"] = true;
+            defines.boolDef[REFLECTIONMAP_EQUIRECTANGULAR_FIXED] = true;
             break;
           case TextureConstants::FIXED_EQUIRECTANGULAR_MIRRORED_MODE:
-            defines.boolDef["REFLECTIONMAP_MIRROREDEQUIRECTANGULAR_FIXED"] = true;
+            defines.boolDef[REFLECTIONMAP_MIRROREDEQUIRECTANGULAR_FIXED] = true;
             break;
           case TextureConstants::CUBIC_MODE:
           case TextureConstants::INVCUBIC_MODE:
-            defines.boolDef["REFLECTIONMAP_CUBIC"] = true;
-            defines.boolDef["USE_LOCAL_REFLECTIONMAP_CUBIC"]
+            defines.boolDef[REFLECTIONMAP_CUBIC] = true;
+            defines.boolDef[USE_LOCAL_REFLECTIONMAP_CUBIC]
               = static_cast<bool>(reflectionTexture->boundingBoxSize());
             break;
         }
 
         if (reflectionTexture->coordinatesMode() != TextureConstants::SKYBOX_MODE) {
           if (reflectionTexture->irradianceTexture()) {
-            defines.boolDef["USEIRRADIANCEMAP"]              = true;
-            defines.boolDef["USESPHERICALFROMREFLECTIONMAP"] = false;
+            defines.boolDef[USEIRRADIANCEMAP]              = true;
+            defines.boolDef[USESPHERICALFROMREFLECTIONMAP] = false;
           }
           // Assume using spherical polynomial if the reflection texture is a cube map
           else if (reflectionTexture->isCube()) {
-            defines.boolDef["USESPHERICALFROMREFLECTIONMAP"] = true;
-            defines.boolDef["USEIRRADIANCEMAP"]              = false;
+            defines.boolDef[USESPHERICALFROMREFLECTIONMAP] = true;
+            defines.boolDef[USEIRRADIANCEMAP]              = false;
             if (_forceIrradianceInFragment
                 || scene->getEngine()->getCaps().maxVaryingVectors <= 8) {
-              defines.boolDef["USESPHERICALINVERTEX"] = false;
+              defines.boolDef[USESPHERICALINVERTEX] = false;
             }
             else {
-              defines.boolDef["USESPHERICALINVERTEX"] = true;
+              defines.boolDef[USESPHERICALINVERTEX] = true;
             }
           }
         }
         else {
-          defines.boolDef["REFLECTIONMAP_SKYBOX_TRANSFORMED"]
+          defines.boolDef[REFLECTIONMAP_SKYBOX_TRANSFORMED]
             = !reflectionTexture->getReflectionTextureMatrix()->isIdentity();
         }
       }
       else {
-        defines.boolDef["REFLECTION"]                                  = false;
-        defines.boolDef["REFLECTIONMAP_3D"]                            = false;
-        defines.boolDef["REFLECTIONMAP_SPHERICAL"]                     = false;
-        defines.boolDef["REFLECTIONMAP_PLANAR"]                        = false;
-        defines.boolDef["REFLECTIONMAP_CUBIC"]                         = false;
-        defines.boolDef["USE_LOCAL_REFLECTIONMAP_CUBIC"]               = false;
-        defines.boolDef["REFLECTIONMAP_PROJECTION"]                    = false;
-        defines.boolDef["REFLECTIONMAP_SKYBOX"]                        = false;
-        defines.boolDef["REFLECTIONMAP_SKYBOX_TRANSFORMED"]            = false;
-        defines.boolDef["REFLECTIONMAP_EXPLICIT"]                      = false;
-        defines.boolDef["REFLECTIONMAP_EQUIRECTANGULAR"]               = false;
-        defines.boolDef["REFLECTIONMAP_EQUIRECTANGULAR_FIXED"]         = false;
-        defines.boolDef["REFLECTIONMAP_MIRROREDEQUIRECTANGULAR_FIXED"] = false;
-        defines.boolDef["INVERTCUBICMAP"]                              = false;
-        defines.boolDef["USESPHERICALFROMREFLECTIONMAP"]               = false;
-        defines.boolDef["USEIRRADIANCEMAP"]                            = false;
-        defines.boolDef["USESPHERICALINVERTEX"]                        = false;
-        defines.boolDef["REFLECTIONMAP_OPPOSITEZ"]                     = false;
-        defines.boolDef["LODINREFLECTIONALPHA"]                        = false;
-        defines.boolDef["GAMMAREFLECTION"]                             = false;
-        defines.boolDef["RGBDREFLECTION"]                              = false;
-        defines.boolDef["LINEARSPECULARREFLECTION"]                    = false;
+        defines.boolDef[REFLECTION]                                  = false;
+        defines.boolDef[REFLECTIONMAP_3D]                            = false;
+        defines.boolDef[REFLECTIONMAP_SPHERICAL]                     = false;
+        defines.boolDef[REFLECTIONMAP_PLANAR]                        = false;
+        defines.boolDef[REFLECTIONMAP_CUBIC]                         = false;
+        defines.boolDef[USE_LOCAL_REFLECTIONMAP_CUBIC]               = false;
+        defines.boolDef[REFLECTIONMAP_PROJECTION]                    = false;
+        defines.boolDef[REFLECTIONMAP_SKYBOX]                        = false;
+        defines.boolDef[REFLECTIONMAP_SKYBOX_TRANSFORMED]            = false;
+        defines.boolDef[REFLECTIONMAP_EXPLICIT]                      = false;
+        defines.boolDef[REFLECTIONMAP_EQUIRECTANGULAR]               = false;
+        defines.boolDef[REFLECTIONMAP_EQUIRECTANGULAR_FIXED]         = false;
+        defines.boolDef[REFLECTIONMAP_MIRROREDEQUIRECTANGULAR_FIXED] = false;
+        defines.boolDef[INVERTCUBICMAP]                              = false;
+        defines.boolDef[USESPHERICALFROMREFLECTIONMAP]               = false;
+        defines.boolDef[USEIRRADIANCEMAP]                            = false;
+        defines.boolDef[USESPHERICALINVERTEX]                        = false;
+        defines.boolDef[REFLECTIONMAP_OPPOSITEZ]                     = false;
+        defines.boolDef[LODINREFLECTIONALPHA]                        = false;
+        defines.boolDef[GAMMAREFLECTION]                             = false;
+        defines.boolDef[RGBDREFLECTION]                              = false;
+        defines.boolDef[LINEARSPECULARREFLECTION]                    = false;
       }
 
       if (_lightmapTexture && MaterialFlags::LightmapTextureEnabled()) {
         MaterialHelper::PrepareDefinesForMergedUV(_lightmapTexture, defines, "LIGHTMAP");
-        defines.boolDef["USELIGHTMAPASSHADOWMAP"] = _useLightmapAsShadowmap;
-        defines.boolDef["GAMMALIGHTMAP"]          = _lightmapTexture->gammaSpace;
-        defines.boolDef["RGBDLIGHTMAP"]           = _lightmapTexture->isRGBD();
+        defines.boolDef[USELIGHTMAPASSHADOWMAP] = _useLightmapAsShadowmap;
+        defines.boolDef[GAMMALIGHTMAP]          = _lightmapTexture->gammaSpace;
+        defines.boolDef[RGBDLIGHTMAP]           = _lightmapTexture->isRGBD();
       }
       else {
-        defines.boolDef["LIGHTMAP"] = false;
+        defines.boolDef[LIGHTMAP] = false;
       }
 
       if (_emissiveTexture && MaterialFlags::EmissiveTextureEnabled()) {
         MaterialHelper::PrepareDefinesForMergedUV(_emissiveTexture, defines, "EMISSIVE");
       }
       else {
-        defines.boolDef["EMISSIVE"] = false;
+        defines.boolDef[EMISSIVE] = false;
       }
 
       if (MaterialFlags::SpecularTextureEnabled()) {
         if (_metallicTexture) {
           MaterialHelper::PrepareDefinesForMergedUV(_metallicTexture, defines, "REFLECTIVITY");
-          defines.boolDef["ROUGHNESSSTOREINMETALMAPALPHA"] = _useRoughnessFromMetallicTextureAlpha;
-          defines.boolDef["ROUGHNESSSTOREINMETALMAPGREEN"]
+          defines.boolDef[ROUGHNESSSTOREINMETALMAPALPHA] = _useRoughnessFromMetallicTextureAlpha;
+          defines.boolDef[ROUGHNESSSTOREINMETALMAPGREEN]
             = !_useRoughnessFromMetallicTextureAlpha && _useRoughnessFromMetallicTextureGreen;
-          defines.boolDef["METALLNESSSTOREINMETALMAPBLUE"] = _useMetallnessFromMetallicTextureBlue;
-          defines.boolDef["AOSTOREINMETALMAPRED"] = _useAmbientOcclusionFromMetallicTextureRed;
-          defines.boolDef["METALLICF0FACTORFROMMETALLICMAP"]
+          defines.boolDef[METALLNESSSTOREINMETALMAPBLUE] = _useMetallnessFromMetallicTextureBlue;
+          defines.boolDef[AOSTOREINMETALMAPRED] = _useAmbientOcclusionFromMetallicTextureRed;
+          defines.boolDef[METALLICF0FACTORFROMMETALLICMAP]
             = _useMetallicF0FactorFromMetallicTexture;
         }
         else if (_reflectivityTexture) {
           MaterialHelper::PrepareDefinesForMergedUV(_reflectivityTexture, defines, "REFLECTIVITY");
-          defines.boolDef["MICROSURFACEFROMREFLECTIVITYMAP"]
+          defines.boolDef[MICROSURFACEFROMREFLECTIVITYMAP]
             = _useMicroSurfaceFromReflectivityMapAlpha;
-          defines.boolDef["MICROSURFACEAUTOMATIC"] = _useAutoMicroSurfaceFromReflectivityMap;
+          defines.boolDef[MICROSURFACEAUTOMATIC] = _useAutoMicroSurfaceFromReflectivityMap;
         }
         else {
-          defines.boolDef["REFLECTIVITY"] = false;
+          defines.boolDef[REFLECTIVITY] = false;
         }
 
         if (_microSurfaceTexture) {
@@ -903,12 +1013,12 @@ void PBRBaseMaterial::_prepareDefines(AbstractMesh* mesh, PBRMaterialDefines& de
                                                     "MICROSURFACEMAP");
         }
         else {
-          defines.boolDef["MICROSURFACEMAP"] = false;
+          defines.boolDef[MICROSURFACEMAP] = false;
         }
       }
       else {
-        defines.boolDef["REFLECTIVITY"]    = false;
-        defines.boolDef["MICROSURFACEMAP"] = false;
+        defines.boolDef[REFLECTIVITY]    = false;
+        defines.boolDef[MICROSURFACEMAP] = false;
       }
 
       if (scene->getEngine()->getCaps().standardDerivatives && _bumpTexture
@@ -916,94 +1026,94 @@ void PBRBaseMaterial::_prepareDefines(AbstractMesh* mesh, PBRMaterialDefines& de
         MaterialHelper::PrepareDefinesForMergedUV(_bumpTexture, defines, "BUMP");
 
         if (_useParallax && _albedoTexture && MaterialFlags::DiffuseTextureEnabled()) {
-          defines.boolDef["PARALLAX"]          = true;
-          defines.boolDef["PARALLAXOCCLUSION"] = !!_useParallaxOcclusion;
+          defines.boolDef[PARALLAX]          = true;
+          defines.boolDef[PARALLAXOCCLUSION] = !!_useParallaxOcclusion;
         }
         else {
-          defines.boolDef["PARALLAX"] = false;
+          defines.boolDef[PARALLAX] = false;
         }
-        defines.boolDef["OBJECTSPACE_NORMALMAP"] = _useObjectSpaceNormalMap;
+        defines.boolDef[OBJECTSPACE_NORMALMAP] = _useObjectSpaceNormalMap;
       }
       else {
-        defines.boolDef["BUMP"] = false;
+        defines.boolDef[BUMP] = false;
       }
 
       if (_environmentBRDFTexture && MaterialFlags::ReflectionTextureEnabled()) {
-        defines.boolDef["ENVIRONMENTBRDF"] = true;
+        defines.boolDef[ENVIRONMENTBRDF] = true;
         // Not actual true RGBD, only the B chanel is encoded as RGBD for sheen.
-        defines.boolDef["ENVIRONMENTBRDF_RGBD"] = _environmentBRDFTexture->isRGBD();
+        defines.boolDef[ENVIRONMENTBRDF_RGBD] = _environmentBRDFTexture->isRGBD();
       }
       else {
-        defines.boolDef["ENVIRONMENTBRDF"]      = false;
-        defines.boolDef["ENVIRONMENTBRDF_RGBD"] = false;
+        defines.boolDef[ENVIRONMENTBRDF]      = false;
+        defines.boolDef[ENVIRONMENTBRDF_RGBD] = false;
       }
 
       if (_shouldUseAlphaFromAlbedoTexture()) {
-        defines.boolDef["ALPHAFROMALBEDO"] = true;
+        defines.boolDef[ALPHAFROMALBEDO] = true;
       }
       else {
-        defines.boolDef["ALPHAFROMALBEDO"] = false;
+        defines.boolDef[ALPHAFROMALBEDO] = false;
       }
     }
 
-    defines.boolDef["SPECULAROVERALPHA"] = _useSpecularOverAlpha;
+    defines.boolDef[SPECULAROVERALPHA] = _useSpecularOverAlpha;
 
     if (_lightFalloff == PBRBaseMaterial::LIGHTFALLOFF_STANDARD) {
-      defines.boolDef["USEPHYSICALLIGHTFALLOFF"] = false;
-      defines.boolDef["USEGLTFLIGHTFALLOFF"]     = false;
+      defines.boolDef[USEPHYSICALLIGHTFALLOFF] = false;
+      defines.boolDef[USEGLTFLIGHTFALLOFF]     = false;
     }
     else if (_lightFalloff == PBRBaseMaterial::LIGHTFALLOFF_GLTF) {
-      defines.boolDef["USEPHYSICALLIGHTFALLOFF"] = false;
-      defines.boolDef["USEGLTFLIGHTFALLOFF"]     = true;
+      defines.boolDef[USEPHYSICALLIGHTFALLOFF] = false;
+      defines.boolDef[USEGLTFLIGHTFALLOFF]     = true;
     }
     else {
-      defines.boolDef["USEPHYSICALLIGHTFALLOFF"] = true;
-      defines.boolDef["USEGLTFLIGHTFALLOFF"]     = false;
+      defines.boolDef[USEPHYSICALLIGHTFALLOFF] = true;
+      defines.boolDef[USEGLTFLIGHTFALLOFF]     = false;
     }
 
-    defines.boolDef["RADIANCEOVERALPHA"] = _useRadianceOverAlpha;
+    defines.boolDef[RADIANCEOVERALPHA] = _useRadianceOverAlpha;
 
     if (!backFaceCulling() && _twoSidedLighting) {
-      defines.boolDef["TWOSIDEDLIGHTING"] = true;
+      defines.boolDef[TWOSIDEDLIGHTING] = true;
     }
     else {
-      defines.boolDef["TWOSIDEDLIGHTING"] = false;
+      defines.boolDef[TWOSIDEDLIGHTING] = false;
     }
 
-    defines.boolDef["SPECULARAA"]
+    defines.boolDef[SPECULARAA]
       = scene->getEngine()->getCaps().standardDerivatives && _enableSpecularAntiAliasing;
   }
 
   if (defines._areTexturesDirty || defines._areMiscDirty) {
-    defines.stringDef["ALPHATESTVALUE"]
+    defines.stringDef[ALPHATESTVALUE]
       = std::to_string(_alphaCutOff) + (std::fmod(_alphaCutOff, 1.f) == 0.f ? "." : "");
-    defines.boolDef["PREMULTIPLYALPHA"]
+    defines.boolDef[PREMULTIPLYALPHA]
       = (alphaMode() == Constants::ALPHA_PREMULTIPLIED
          || alphaMode() == Constants::ALPHA_PREMULTIPLIED_PORTERDUFF);
-    defines.boolDef["ALPHABLEND"]         = needAlphaBlendingForMesh(*mesh);
-    defines.boolDef["ALPHAFRESNEL"]       = _useAlphaFresnel || _useLinearAlphaFresnel;
-    defines.boolDef["LINEARALPHAFRESNEL"] = _useLinearAlphaFresnel;
+    defines.boolDef[ALPHABLEND]         = needAlphaBlendingForMesh(*mesh);
+    defines.boolDef[ALPHAFRESNEL]       = _useAlphaFresnel || _useLinearAlphaFresnel;
+    defines.boolDef[LINEARALPHAFRESNEL] = _useLinearAlphaFresnel;
   }
 
   if (defines._areImageProcessingDirty && _imageProcessingConfiguration) {
     _imageProcessingConfiguration->prepareDefines(defines);
   }
 
-  defines.boolDef["FORCENORMALFORWARD"] = _forceNormalForward;
+  defines.boolDef[FORCENORMALFORWARD] = _forceNormalForward;
 
-  defines.boolDef["RADIANCEOCCLUSION"] = _useRadianceOcclusion;
+  defines.boolDef[RADIANCEOCCLUSION] = _useRadianceOcclusion;
 
-  defines.boolDef["HORIZONOCCLUSION"] = _useHorizonOcclusion;
+  defines.boolDef[HORIZONOCCLUSION] = _useHorizonOcclusion;
 
   // Misc.
   if (defines._areMiscDirty) {
     MaterialHelper::PrepareDefinesForMisc(mesh, scene, _useLogarithmicDepth, pointsCloud(),
                                           fogEnabled(),
                                           _shouldTurnAlphaTestOn(mesh) || _forceAlphaTest, defines);
-    defines.boolDef["UNLIT"] = _unlit
+    defines.boolDef[UNLIT] = _unlit
                                || ((pointsCloud() || wireframe())
                                    && !mesh->isVerticesDataPresent(VertexBuffer::NormalKind));
-    defines.intDef["DEBUGMODE"] = static_cast<unsigned>(_debugMode);
+    defines.intDef[DEBUGMODE] = static_cast<unsigned>(_debugMode);
   }
 
   // External config
@@ -1015,7 +1125,8 @@ void PBRBaseMaterial::_prepareDefines(AbstractMesh* mesh, PBRMaterialDefines& de
 
   // Values that need to be evaluated on every frame
   MaterialHelper::PrepareDefinesForFrameBoundValues(
-    scene, engine, defines, useInstances.has_value() && (*useInstances), useClipPlane);
+    scene, engine, defines, useInstances.has_value() && (*useInstances), useClipPlane,
+    mesh->hasThinInstances());
 
   // Attribs
   MaterialHelper::PrepareDefinesForAttributes(
@@ -1111,6 +1222,18 @@ void PBRBaseMaterial::unbind()
 
 void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh)
 {
+  static const auto INSTANCES             = MaterialDefinesSchema::IndexOf("INSTANCES");
+  static const auto OBJECTSPACE_NORMALMAP = MaterialDefinesSchema::IndexOf("OBJECTSPACE_NORMALMAP");
+  static const auto USEIRRADIANCEMAP      = MaterialDefinesSchema::IndexOf("USEIRRADIANCEMAP");
+  static const auto USESPHERICALFROMREFLECTIONMAP
+    = MaterialDefinesSchema::IndexOf("USESPHERICALFROMREFLECTIONMAP");
+  static const auto SPHERICAL_HARMONICS   = MaterialDefinesSchema::IndexOf("SPHERICAL_HARMONICS");
+  static const auto METALLICWORKFLOW      = MaterialDefinesSchema::IndexOf("METALLICWORKFLOW");
+  static const auto SS_REFRACTION         = MaterialDefinesSchema::IndexOf("SS_REFRACTION");
+  static const auto LODBASEDMICROSFURACE  = MaterialDefinesSchema::IndexOf("LODBASEDMICROSFURACE");
+  static const auto ENVIRONMENTBRDF       = MaterialDefinesSchema::IndexOf("ENVIRONMENTBRDF");
+  static const auto NUM_MORPH_INFLUENCERS = MaterialDefinesSchema::IndexOf("NUM_MORPH_INFLUENCERS");
+
   auto scene = getScene();
 
   auto definesTmp = static_cast<PBRMaterialDefines*>(subMesh->_materialDefines.get());
@@ -1127,12 +1250,12 @@ void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh
   _activeEffect = effect;
 
   // Matrices
-  if (!defines["INSTANCES"]) {
+  if (!defines[INSTANCES]) {
     bindOnlyWorldMatrix(world);
   }
 
   // Normal Matrix
-  if (defines["OBJECTSPACE_NORMALMAP"]) {
+  if (defines[OBJECTSPACE_NORMALMAP]) {
     world.toNormalMatrix(_normalMatrix);
     bindOnlyNormalMatrix(_normalMatrix);
   }
@@ -1186,42 +1309,55 @@ void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh
             }
           }
 
-          if (!defines["USEIRRADIANCEMAP"]) {
+          if (!defines[USEIRRADIANCEMAP]) {
             auto _polynomials = reflectionTexture->sphericalPolynomial();
-            if (defines["USESPHERICALFROMREFLECTIONMAP"] && _polynomials) {
+            if (defines[USESPHERICALFROMREFLECTIONMAP] && _polynomials) {
               auto polynomials = *_polynomials;
-              if (defines["SPHERICAL_HARMONICS"]) {
+              if (defines[SPHERICAL_HARMONICS]) {
                 auto& preScaledHarmonics = polynomials.preScaledHarmonics();
-                _activeEffect->setVector3("vSphericalL00", preScaledHarmonics.l00);
-                _activeEffect->setVector3("vSphericalL1_1", preScaledHarmonics.l1_1);
-                _activeEffect->setVector3("vSphericalL10", preScaledHarmonics.l10);
-                _activeEffect->setVector3("vSphericalL11", preScaledHarmonics.l11);
-                _activeEffect->setVector3("vSphericalL2_2", preScaledHarmonics.l2_2);
-                _activeEffect->setVector3("vSphericalL2_1", preScaledHarmonics.l2_1);
-                _activeEffect->setVector3("vSphericalL20", preScaledHarmonics.l20);
-                _activeEffect->setVector3("vSphericalL21", preScaledHarmonics.l21);
-                _activeEffect->setVector3("vSphericalL22", preScaledHarmonics.l22);
+                static const std::array<size_t, 9> harmonicsHandles{
+                  Effect::UniformHandle("vSphericalL00"),  Effect::UniformHandle("vSphericalL1_1"),
+                  Effect::UniformHandle("vSphericalL10"),  Effect::UniformHandle("vSphericalL11"),
+                  Effect::UniformHandle("vSphericalL2_2"), Effect::UniformHandle("vSphericalL2_1"),
+                  Effect::UniformHandle("vSphericalL20"),  Effect::UniformHandle("vSphericalL21"),
+                  Effect::UniformHandle("vSphericalL22")};
+                const std::array<const Vector3*, 9> harmonics{
+                  &preScaledHarmonics.l00,  &preScaledHarmonics.l1_1, &preScaledHarmonics.l10,
+                  &preScaledHarmonics.l11,  &preScaledHarmonics.l2_2, &preScaledHarmonics.l2_1,
+                  &preScaledHarmonics.l20,  &preScaledHarmonics.l21,  &preScaledHarmonics.l22};
+                for (size_t i = 0; i < harmonics.size(); ++i) {
+                  _activeEffect->setVector3(harmonicsHandles[i], *harmonics[i]);
+                }
               }
               else {
-                _activeEffect->setFloat3("vSphericalX", polynomials.x.x, polynomials.x.y,
+                static const auto sphericalXHandle    = Effect::UniformHandle("vSphericalX");
+                static const auto sphericalYHandle    = Effect::UniformHandle("vSphericalY");
+                static const auto sphericalZHandle    = Effect::UniformHandle("vSphericalZ");
+                static const auto sphericalXXZZHandle = Effect::UniformHandle("vSphericalXX_ZZ");
+                static const auto sphericalYYZZHandle = Effect::UniformHandle("vSphericalYY_ZZ");
+                static const auto sphericalZZHandle   = Effect::UniformHandle("vSphericalZZ");
+                static const auto sphericalXYHandle   = Effect::UniformHandle("vSphericalXY");
+                static const auto sphericalYZHandle   = Effect::UniformHandle("vSphericalYZ");
+                static const auto sphericalZXHandle   = Effect::UniformHandle("vSphericalZX");
+                _activeEffect->setFloat3(sphericalXHandle, polynomials.x.x, polynomials.x.y,
                                          polynomials.x.z);
-                _activeEffect->setFloat3("vSphericalY", polynomials.y.x, polynomials.y.y,
+                _activeEffect->setFloat3(sphericalYHandle, polynomials.y.x, polynomials.y.y,
                                          polynomials.y.z);
-                _activeEffect->setFloat3("vSphericalZ", polynomials.z.x, polynomials.z.y,
+                _activeEffect->setFloat3(sphericalZHandle, polynomials.z.x, polynomials.z.y,
                                          polynomials.z.z);
-                _activeEffect->setFloat3("vSphericalXX_ZZ", polynomials.xx.x - polynomials.zz.x,
+                _activeEffect->setFloat3(sphericalXXZZHandle, polynomials.xx.x - polynomials.zz.x,
                                          polynomials.xx.y - polynomials.zz.y,
                                          polynomials.xx.z - polynomials.zz.z);
-                _activeEffect->setFloat3("vSphericalYY_ZZ", polynomials.yy.x - polynomials.zz.x,
+                _activeEffect->setFloat3(sphericalYYZZHandle, polynomials.yy.x - polynomials.zz.x,
                                          polynomials.yy.y - polynomials.zz.y,
                                          polynomials.yy.z - polynomials.zz.z);
-                _activeEffect->setFloat3("vSphericalZZ", polynomials.zz.x, polynomials.zz.y,
+                _activeEffect->setFloat3(sphericalZZHandle, polynomials.zz.x, polynomials.zz.y,
                                          polynomials.zz.z);
-                _activeEffect->setFloat3("vSphericalXY", polynomials.xy.x, polynomials.xy.y,
+                _activeEffect->setFloat3(sphericalXYHandle, polynomials.xy.x, polynomials.xy.y,
                                          polynomials.xy.z);
-                _activeEffect->setFloat3("vSphericalYZ", polynomials.yz.x, polynomials.yz.y,
+                _activeEffect->setFloat3(sphericalYZHandle, polynomials.yz.x, polynomials.yz.y,
                                          polynomials.yz.z);
-                _activeEffect->setFloat3("vSphericalZX", polynomials.zx.x, polynomials.zx.y,
+                _activeEffect->setFloat3(sphericalZXHandle, polynomials.zx.x, polynomials.zx.y,
                                          polynomials.zx.z);
               }
             }
@@ -1289,7 +1425,7 @@ void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh
       }
 
       // Colors
-      if (defines["METALLICWORKFLOW"]) {
+      if (defines[METALLICWORKFLOW]) {
         TmpVectors::Color3Array[0].r = !_metallic.has_value() ? 1.f : *_metallic;
         TmpVectors::Color3Array[0].g = !_roughness.has_value() ? 1.f : *_roughness;
 
@@ -1308,7 +1444,7 @@ void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh
         "vEmissiveColor",
         MaterialFlags::EmissiveTextureEnabled() ? _emissiveColor : Color3::BlackReadOnly(), "");
       ubo.updateColor3("vReflectionColor", _reflectionColor, "");
-      if (!defines["SS_REFRACTION"] && subSurface->linkRefractionWithTransparency()) {
+      if (!defines[SS_REFRACTION] && subSurface->linkRefractionWithTransparency()) {
         ubo.updateColor4("vAlbedoColor", _albedoColor, 1.f, "");
       }
       else {
@@ -1342,7 +1478,7 @@ void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh
       }
 
       if (reflectionTexture && MaterialFlags::ReflectionTextureEnabled()) {
-        if (defines["LODBASEDMICROSFURACE"]) {
+        if (defines[LODBASEDMICROSFURACE]) {
           ubo.setTexture("reflectionSampler", reflectionTexture);
         }
         else {
@@ -1357,12 +1493,12 @@ void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh
                                                     reflectionTexture);
         }
 
-        if (defines["USEIRRADIANCEMAP"]) {
+        if (defines[USEIRRADIANCEMAP]) {
           ubo.setTexture("irradianceSampler", reflectionTexture->irradianceTexture());
         }
       }
 
-      if (defines["ENVIRONMENTBRDF"]) {
+      if (defines[ENVIRONMENTBRDF]) {
         ubo.setTexture("environmentBrdfSampler", _environmentBRDFTexture);
       }
 
@@ -1393,7 +1529,7 @@ void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh
       }
     }
 
-    subSurface->bindForSubMesh(ubo, scene, engine, isFrozen(), defines["LODBASEDMICROSFURACE"]);
+    subSurface->bindForSubMesh(ubo, scene, engine, isFrozen(), defines[LODBASEDMICROSFURACE]);
     clearCoat->bindForSubMesh(ubo, scene, engine, _disableBumpMap, isFrozen(), _invertNormalMapX,
                               _invertNormalMapY);
     anisotropy->bindForSubMesh(ubo, scene, isFrozen());
@@ -1411,11 +1547,14 @@ void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh
                                                            scene->activeCamera()->globalPosition());
     auto invertNormal
       = (scene->useRightHandedSystem() == (scene->_mirroredCameraPosition != nullptr));
-    effect->setFloat4("vEyePosition", eyePosition.x, eyePosition.y, eyePosition.z,
+    static const auto eyePositionHandle  = Effect::UniformHandle("vEyePosition");
+    static const auto ambientColorHandle = Effect::UniformHandle("vAmbientColor");
+    static const auto debugModeHandle    = Effect::UniformHandle("vDebugMode");
+    effect->setFloat4(eyePositionHandle, eyePosition.x, eyePosition.y, eyePosition.z,
                       invertNormal ? -1.f : 1.f);
-    effect->setColor3("vAmbientColor", _globalAmbientColor);
+    effect->setColor3(ambientColorHandle, _globalAmbientColor);
 
-    effect->setFloat2("vDebugMode", debugLimit, debugFactor);
+    effect->setFloat2(debugModeHandle, debugLimit, debugFactor);
   }
 
   if (mustRebind || !isFrozen()) {
@@ -1436,7 +1575,7 @@ void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh
     MaterialHelper::BindFogParameters(scene, mesh, _activeEffect, true);
 
     // Morph targets
-    if (defines.intDef["NUM_MORPH_INFLUENCERS"]) {
+    if (defines.intDef[NUM_MORPH_INFLUENCERS]) {
       MaterialHelper::BindMorphTargetParameters(mesh, _activeEffect);
     }
 
@@ -47,12 +47,14 @@ bool PushMaterial::isReady(AbstractMesh* mesh, bool useInstances)
 
 void PushMaterial::bindOnlyWorldMatrix(Matrix& world)
 {
-  _activeEffect->setMatrix("world", world);
+  static const auto worldHandle = Effect::UniformHandle("world");
+  _activeEffect->setMatrix(worldHandle, world);
 }
 
 void PushMaterial::bindOnlyNormalMatrix(Matrix& normalMatrix)
 {
-  _activeEffect->setMatrix("normalMatrix", normalMatrix);
+  static const auto normalMatrixHandle = Effect::UniformHandle("normalMatrix");
+  _activeEffect->setMatrix(normalMatrixHandle, normalMatrix);
 }
 
 void PushMaterial::bind(Matrix& world, Mesh* mesh)
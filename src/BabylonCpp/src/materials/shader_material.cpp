@@ -278,6 +278,12 @@ bool ShaderMaterial::_checkCache(AbstractMesh* mesh, bool useInstances)
     return false;
   }
 
+  if (_effect
+      && (_effect->defines.find("#define THIN_INSTANCES") != std::string::npos)
+           != (useInstances && mesh->hasThinInstances())) {
+    return false;
+  }
+
   return true;
 }
 
@@ -339,6 +345,9 @@ bool ShaderMaterial::isReady(AbstractMesh* mesh, bool useInstances)
   if (useInstances) {
     defines.emplace_back("#define INSTANCES");
     MaterialHelper::PushAttributesForInstances(attribs);
+    if (mesh && mesh->hasThinInstances()) {
+      defines.emplace_back("#define THIN_INSTANCES");
+    }
   }
 
   // Bones
@@ -402,6 +402,62 @@ BaseTexturePtr StandardMaterial::getAlphaTestTexture()
 bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, BaseSubMesh* subMesh,
                                          bool useInstances)
 {
+  static const auto MAINUV1             = MaterialDefinesSchema::IndexOf("MAINUV1");
+  static const auto MAINUV2             = MaterialDefinesSchema::IndexOf("MAINUV2");
+  static const auto DIFFUSE             = MaterialDefinesSchema::IndexOf("DIFFUSE");
+  static const auto AMBIENT             = MaterialDefinesSchema::IndexOf("AMBIENT");
+  static const auto OPACITYRGB          = MaterialDefinesSchema::IndexOf("OPACITYRGB");
+  static const auto OPACITY             = MaterialDefinesSchema::IndexOf("OPACITY");
+  static const auto REFLECTION          = MaterialDefinesSchema::IndexOf("REFLECTION");
+  static const auto ROUGHNESS           = MaterialDefinesSchema::IndexOf("ROUGHNESS");
+  static const auto REFLECTIONOVERALPHA = MaterialDefinesSchema::IndexOf("REFLECTIONOVERALPHA");
+  static const auto INVERTCUBICMAP      = MaterialDefinesSchema::IndexOf("INVERTCUBICMAP");
+  static const auto REFLECTIONMAP_3D    = MaterialDefinesSchema::IndexOf("REFLECTIONMAP_3D");
+  static const auto REFLECTIONMAP_SKYBOX_TRANSFORMED
+    = MaterialDefinesSchema::IndexOf("REFLECTIONMAP_SKYBOX_TRANSFORMED");
+  static const auto USE_LOCAL_REFLECTIONMAP_CUBIC
+    = MaterialDefinesSchema::IndexOf("USE_LOCAL_REFLECTIONMAP_CUBIC");
+  static const auto EMISSIVE = MaterialDefinesSchema::IndexOf("EMISSIVE");
+  static const auto USELIGHTMAPASSHADOWMAP
+    = MaterialDefinesSchema::IndexOf("USELIGHTMAPASSHADOWMAP");
+  static const auto LIGHTMAP              = MaterialDefinesSchema::IndexOf("LIGHTMAP");
+  static const auto GLOSSINESS            = MaterialDefinesSchema::IndexOf("GLOSSINESS");
+  static const auto SPECULAR              = MaterialDefinesSchema::IndexOf("SPECULAR");
+  static const auto PARALLAX              = MaterialDefinesSchema::IndexOf("PARALLAX");
+  static const auto PARALLAXOCCLUSION     = MaterialDefinesSchema::IndexOf("PARALLAXOCCLUSION");
+  static const auto OBJECTSPACE_NORMALMAP = MaterialDefinesSchema::IndexOf("OBJECTSPACE_NORMALMAP");
+  static const auto BUMP                  = MaterialDefinesSchema::IndexOf("BUMP");
+  static const auto REFRACTION            = MaterialDefinesSchema::IndexOf("REFRACTION");
+  static const auto REFRACTIONMAP_3D      = MaterialDefinesSchema::IndexOf("REFRACTIONMAP_3D");
+  static const auto TWOSIDEDLIGHTING      = MaterialDefinesSchema::IndexOf("TWOSIDEDLIGHTING");
+  static const auto ALPHAFROMDIFFUSE      = MaterialDefinesSchema::IndexOf("ALPHAFROMDIFFUSE");
+  static const auto EMISSIVEASILLUMINATION
+    = MaterialDefinesSchema::IndexOf("EMISSIVEASILLUMINATION");
+  static const auto LINKEMISSIVEWITHDIFFUSE
+    = MaterialDefinesSchema::IndexOf("LINKEMISSIVEWITHDIFFUSE");
+  static const auto SPECULAROVERALPHA    = MaterialDefinesSchema::IndexOf("SPECULAROVERALPHA");
+  static const auto PREMULTIPLYALPHA     = MaterialDefinesSchema::IndexOf("PREMULTIPLYALPHA");
+  static const auto IS_REFLECTION_LINEAR = MaterialDefinesSchema::IndexOf("IS_REFLECTION_LINEAR");
+  static const auto IS_REFRACTION_LINEAR = MaterialDefinesSchema::IndexOf("IS_REFRACTION_LINEAR");
+  static const auto DIFFUSEFRESNEL       = MaterialDefinesSchema::IndexOf("DIFFUSEFRESNEL");
+  static const auto OPACITYFRESNEL       = MaterialDefinesSchema::IndexOf("OPACITYFRESNEL");
+  static const auto REFLECTIONFRESNEL    = MaterialDefinesSchema::IndexOf("REFLECTIONFRESNEL");
+  static const auto REFLECTIONFRESNELFROMSPECULAR
+    = MaterialDefinesSchema::IndexOf("REFLECTIONFRESNELFROMSPECULAR");
+  static const auto REFRACTIONFRESNEL     = MaterialDefinesSchema::IndexOf("REFRACTIONFRESNEL");
+  static const auto EMISSIVEFRESNEL       = MaterialDefinesSchema::IndexOf("EMISSIVEFRESNEL");
+  static const auto FRESNEL               = MaterialDefinesSchema::IndexOf("FRESNEL");
+  static const auto FOG                   = MaterialDefinesSchema::IndexOf("FOG");
+  static const auto POINTSIZE             = MaterialDefinesSchema::IndexOf("POINTSIZE");
+  static const auto LOGARITHMICDEPTH      = MaterialDefinesSchema::IndexOf("LOGARITHMICDEPTH");
+  static const auto SPECULARTERM          = MaterialDefinesSchema::IndexOf("SPECULARTERM");
+  static const auto MULTIVIEW             = MaterialDefinesSchema::IndexOf("MULTIVIEW");
+  static const auto NORMAL                = MaterialDefinesSchema::IndexOf("NORMAL");
+  static const auto UV1                   = MaterialDefinesSchema::IndexOf("UV1");
+  static const auto UV2                   = MaterialDefinesSchema::IndexOf("UV2");
+  static const auto VERTEXCOLOR           = MaterialDefinesSchema::IndexOf("VERTEXCOLOR");
+  static const auto NUM_MORPH_INFLUENCERS = MaterialDefinesSchema::IndexOf("NUM_MORPH_INFLUENCERS");
+
   if (subMesh->effect() && isFrozen()) {
     if (_wasPreviouslyReady) {
       return true;
@@ -432,9 +488,9 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, BaseSubMesh* subMes
 
   // Textures
   if (defines._areTexturesDirty) {
-    defines._needUVs           = false;
-    defines.boolDef["MAINUV1"] = false;
-    defines.boolDef["MAINUV2"] = false;
+    defines._needUVs         = false;
+    defines.boolDef[MAINUV1] = false;
+    defines.boolDef[MAINUV2] = false;
     if (scene->texturesEnabled()) {
       if (_diffuseTexture && StandardMaterial::DiffuseTextureEnabled()) {
         if (!_diffuseTexture->isReadyOrNotBlocking()) {
@@ -445,7 +501,7 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, BaseSubMesh* subMes
         }
       }
       else {
-        defines.boolDef["DIFFUSE"] = false;
+        defines.boolDef[DIFFUSE] = false;
       }
 
       if (_ambientTexture && StandardMaterial::AmbientTextureEnabled()) {
@@ -457,7 +513,7 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, BaseSubMesh* subMes
         }
       }
       else {
-        defines.boolDef["AMBIENT"] = false;
+        defines.boolDef[AMBIENT] = false;
       }
 
       if (_opacityTexture && StandardMaterial::OpacityTextureEnabled()) {
@@ -466,11 +522,11 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, BaseSubMesh* subMes
         }
         else {
           MaterialHelper::PrepareDefinesForMergedUV(_opacityTexture, defines, "OPACITY");
-          defines.boolDef["OPACITYRGB"] = _opacityTexture->getAlphaFromRGB;
+          defines.boolDef[OPACITYRGB] = _opacityTexture->getAlphaFromRGB;
         }
       }
       else {
-        defines.boolDef["OPACITY"] = false;
+        defines.boolDef[OPACITY] = false;
       }
 
       if (_reflectionTexture && StandardMaterial::ReflectionTextureEnabled()) {
@@ -478,14 +534,14 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, BaseSubMesh* subMes
           return false;
         }
         else {
-          defines._needNormals          = true;
-          defines.boolDef["REFLECTION"] = true;
+          defines._needNormals        = true;
+          defines.boolDef[REFLECTION] = true;
 
-          defines.boolDef["ROUGHNESS"]           = (_roughness > 0);
-          defines.boolDef["REFLECTIONOVERALPHA"] = _useReflectionOverAlpha;
-          defines.boolDef["INVERTCUBICMAP"]
+          defines.boolDef[ROUGHNESS]           = (_roughness > 0);
+          defines.boolDef[REFLECTIONOVERALPHA] = _useReflectionOverAlpha;
+          defines.boolDef[INVERTCUBICMAP]
             = (_reflectionTexture->coordinatesMode() == TextureConstants::INVCUBIC_MODE);
-          defines.boolDef["REFLECTIONMAP_3D"] = _reflectionTexture->isCube;
+          defines.boolDef[REFLECTIONMAP_3D] = _reflectionTexture->isCube;
 
           switch (_reflectionTexture->coordinatesMode()) {
             case TextureConstants::EXPLICIT_MODE:
@@ -499,7 +555,7 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, BaseSubMesh* subMes
               break;
             case TextureConstants::SKYBOX_MODE:
               defines.setReflectionMode("REFLECTIONMAP_SKYBOX");
-              defines.boolDef["REFLECTIONMAP_SKYBOX_TRANSFORMED"]
+              defines.boolDef[REFLECTIONMAP_SKYBOX_TRANSFORMED]
                 = !_reflectionTexture->getReflectionTextureMatrix()->isIdentity();
               break;
             case TextureConstants::SPHERICAL_MODE:
@@ -520,12 +576,12 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, BaseSubMesh* subMes
               break;
           }
 
-          defines.boolDef["USE_LOCAL_REFLECTIONMAP_CUBIC"]
+          defines.boolDef[USE_LOCAL_REFLECTIONMAP_CUBIC]
             = static_cast<bool>(_reflectionTexture->boundingBoxSize());
         }
       }
       else {
-        defines.boolDef["REFLECTION"] = false;
+        defines.boolDef[REFLECTION] = false;
       }
 
       if (_emissiveTexture && StandardMaterial::EmissiveTextureEnabled()) {
@@ -537,7 +593,7 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, BaseSubMesh* subMes
         }
       }
       else {
-        defines.boolDef["EMISSIVE"] = false;
+        defines.boolDef[EMISSIVE] = false;
       }
 
       if (_lightmapTexture && StandardMaterial::LightmapTextureEnabled()) {
@@ -546,11 +602,11 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, BaseSubMesh* subMes
         }
         else {
           MaterialHelper::PrepareDefinesForMergedUV(_lightmapTexture, defines, "LIGHTMAP");
-          defines.boolDef["USELIGHTMAPASSHADOWMAP"] = _useLightmapAsShadowmap;
+          defines.boolDef[USELIGHTMAPASSHADOWMAP] = _useLightmapAsShadowmap;
         }
       }
       else {
-        defines.boolDef["LIGHTMAP"] = false;
+        defines.boolDef[LIGHTMAP] = false;
       }
 
       if (_specularTexture && StandardMaterial::SpecularTextureEnabled()) {
@@ -559,11 +615,11 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, BaseSubMesh* subMes
         }
         else {
           MaterialHelper::PrepareDefinesForMergedUV(_specularTexture, defines, "SPECULAR");
-          defines.boolDef["GLOSSINESS"] = _useGlossinessFromSpecularMapAlpha;
+          defines.boolDef[GLOSSINESS] = _useGlossinessFromSpecularMapAlpha;
         }
       }
       else {
-        defines.boolDef["SPECULAR"] = false;
+        defines.boolDef[SPECULAR] = false;
       }
 
       if (scene->getEngine()->getCaps().standardDerivatives && _bumpTexture
@@ -575,14 +631,14 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, BaseSubMesh* subMes
         else {
           MaterialHelper::PrepareDefinesForMergedUV(_bumpTexture, defines, "BUMP");
 
-          defines.boolDef["PARALLAX"]          = _useParallax;
-          defines.boolDef["PARALLAXOCCLUSION"] = _useParallaxOcclusion;
+          defines.boolDef[PARALLAX]          = _useParallax;
+          defines.boolDef[PARALLAXOCCLUSION] = _useParallaxOcclusion;
         }
 
-        defines.boolDef["OBJECTSPACE_NORMALMAP"] = _useObjectSpaceNormalMap;
+        defines.boolDef[OBJECTSPACE_NORMALMAP] = _useObjectSpaceNormalMap;
       }
       else {
-        defines.boolDef["BUMP"] = false;
+        defines.boolDef[BUMP] = false;
       }
 
       if (_refractionTexture && StandardMaterial::RefractionTextureEnabled()) {
@@ -590,38 +646,38 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, BaseSubMesh* subMes
           return false;
         }
         else {
-          defines._needUVs              = true;
-          defines.boolDef["REFRACTION"] = true;
+          defines._needUVs            = true;
+          defines.boolDef[REFRACTION] = true;
 
-          defines.boolDef["REFRACTIONMAP_3D"] = _refractionTexture->isCube;
+          defines.boolDef[REFRACTIONMAP_3D] = _refractionTexture->isCube;
         }
       }
       else {
-        defines.boolDef["REFRACTION"] = false;
+        defines.boolDef[REFRACTION] = false;
       }
 
-      defines.boolDef["TWOSIDEDLIGHTING"] = !_backFaceCulling && _twoSidedLighting;
+      defines.boolDef[TWOSIDEDLIGHTING] = !_backFaceCulling && _twoSidedLighting;
     }
     else {
-      defines.boolDef["DIFFUSE"]    = false;
-      defines.boolDef["AMBIENT"]    = false;
-      defines.boolDef["OPACITY"]    = false;
-      defines.boolDef["REFLECTION"] = false;
-      defines.boolDef["EMISSIVE"]   = false;
-      defines.boolDef["LIGHTMAP"]   = false;
-      defines.boolDef["BUMP"]       = false;
-      defines.boolDef["REFRACTION"] = false;
+      defines.boolDef[DIFFUSE]    = false;
+      defines.boolDef[AMBIENT]    = false;
+      defines.boolDef[OPACITY]    = false;
+      defines.boolDef[REFLECTION] = false;
+      defines.boolDef[EMISSIVE]   = false;
+      defines.boolDef[LIGHTMAP]   = false;
+      defines.boolDef[BUMP]       = false;
+      defines.boolDef[REFRACTION] = false;
     }
 
-    defines.boolDef["ALPHAFROMDIFFUSE"] = _shouldUseAlphaFromDiffuseTexture();
+    defines.boolDef[ALPHAFROMDIFFUSE] = _shouldUseAlphaFromDiffuseTexture();
 
-    defines.boolDef["EMISSIVEASILLUMINATION"] = _useEmissiveAsIllumination;
+    defines.boolDef[EMISSIVEASILLUMINATION] = _useEmissiveAsIllumination;
 
-    defines.boolDef["LINKEMISSIVEWITHDIFFUSE"] = _linkEmissiveWithDiffuse;
+    defines.boolDef[LINKEMISSIVEWITHDIFFUSE] = _linkEmissiveWithDiffuse;
 
-    defines.boolDef["SPECULAROVERALPHA"] = _useSpecularOverAlpha;
+    defines.boolDef[SPECULAROVERALPHA] = _useSpecularOverAlpha;
 
-    defines.boolDef["PREMULTIPLYALPHA"]
+    defines.boolDef[PREMULTIPLYALPHA]
       = (alphaMode() == Constants::ALPHA_PREMULTIPLIED
          || alphaMode() == Constants::ALPHA_PREMULTIPLIED_PORTERDUFF);
   }
@@ -633,9 +689,9 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, BaseSubMesh* subMes
 
     _imageProcessingConfiguration->prepareDefines(defines);
 
-    defines.boolDef["IS_REFLECTION_LINEAR"]
+    defines.boolDef[IS_REFLECTION_LINEAR]
       = (reflectionTexture() != nullptr && !reflectionTexture()->gammaSpace);
-    defines.boolDef["IS_REFRACTION_LINEAR"]
+    defines.boolDef[IS_REFRACTION_LINEAR]
       = (refractionTexture() != nullptr && !refractionTexture()->gammaSpace);
   }
 
@@ -645,29 +701,29 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, BaseSubMesh* subMes
       if (_diffuseFresnelParameters || _opacityFresnelParameters || _emissiveFresnelParameters
           || _refractionFresnelParameters || _reflectionFresnelParameters) {
 
-        defines.boolDef["DIFFUSEFRESNEL"]
+        defines.boolDef[DIFFUSEFRESNEL]
           = (_diffuseFresnelParameters && _diffuseFresnelParameters->isEnabled());
 
-        defines.boolDef["OPACITYFRESNEL"]
+        defines.boolDef[OPACITYFRESNEL]
           = (_opacityFresnelParameters && _opacityFresnelParameters->isEnabled());
 
-        defines.boolDef["REFLECTIONFRESNEL"]
+        defines.boolDef[REFLECTIONFRESNEL]
           = (_reflectionFresnelParameters && _reflectionFresnelParameters->isEnabled());
 
-        defines.boolDef["REFLECTIONFRESNELFROMSPECULAR"] = _useReflectionFresnelFromSpecular;
+        defines.boolDef[REFLECTIONFRESNELFROMSPECULAR] = _useReflectionFresnelFromSpecular;
 
-        defines.boolDef["REFRACTIONFRESNEL"]
+        defines.boolDef[REFRACTIONFRESNEL]
           = (_refractionFresnelParameters && _refractionFresnelParameters->isEnabled());
 
-        defines.boolDef["EMISSIVEFRESNEL"]
+        defines.boolDef[EMISSIVEFRESNEL]
           = (_emissiveFresnelParameters && _emissiveFresnelParameters->isEnabled());
 
-        defines._needNormals       = true;
-        defines.boolDef["FRESNEL"] = true;
+        defines._needNormals     = true;
+        defines.boolDef[FRESNEL] = true;
       }
     }
     else {
-      defines.boolDef["FRESNEL"] = false;
+      defines.boolDef[FRESNEL] = false;
     }
   }
 
@@ -679,7 +735,8 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, BaseSubMesh* subMes
   MaterialHelper::PrepareDefinesForAttributes(mesh, defines, true, true, true, true);
 
   // Values that need to be evaluated on every frame
-  MaterialHelper::PrepareDefinesForFrameBoundValues(scene, engine, defines, useInstances);
+  MaterialHelper::PrepareDefinesForFrameBoundValues(scene, engine, defines, useInstances,
+                                                    std::nullopt, mesh->hasThinInstances());
 
   // Get correct effect
   if (defines.isDirty()) {
@@ -688,88 +745,88 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, BaseSubMesh* subMes
 
     // Fallbacks
     auto fallbacks = std::make_unique<EffectFallbacks>();
-    if (defines["REFLECTION"]) {
+    if (defines[REFLECTION]) {
       fallbacks->addFallback(0, "REFLECTION");
     }
 
-    if (defines["SPECULAR"]) {
+    if (defines[SPECULAR]) {
       fallbacks->addFallback(0, "SPECULAR");
     }
 
-    if (defines["BUMP"]) {
+    if (defines[BUMP]) {
       fallbacks->addFallback(0, "BUMP");
     }
 
-    if (defines["PARALLAX"]) {
+    if (defines[PARALLAX]) {
       fallbacks->addFallback(1, "PARALLAX");
     }
 
-    if (defines["PARALLAXOCCLUSION"]) {
+    if (defines[PARALLAXOCCLUSION]) {
       fallbacks->addFallback(0, "PARALLAXOCCLUSION");
     }
 
-    if (defines["SPECULAROVERALPHA"]) {
+    if (defines[SPECULAROVERALPHA]) {
       fallbacks->addFallback(0, "SPECULAROVERALPHA");
     }
 
-    if (defines["FOG"]) {
+    if (defines[FOG]) {
       fallbacks->addFallback(1, "FOG");
     }
 
-    if (defines["POINTSIZE"]) {
+    if (defines[POINTSIZE]) {
       fallbacks->addFallback(0, "POINTSIZE");
     }
 
-    if (defines["LOGARITHMICDEPTH"]) {
+    if (defines[LOGARITHMICDEPTH]) {
       fallbacks->addFallback(0, "LOGARITHMICDEPTH");
     }
 
     MaterialHelper::HandleFallbacksForShadows(defines, *fallbacks, _maxSimultaneousLights);
 
-    if (defines["SPECULARTERM"]) {
+    if (defines[SPECULARTERM]) {
       fallbacks->addFallback(0, "SPECULARTERM");
     }
 
-    if (defines["DIFFUSEFRESNEL"]) {
+    if (defines[DIFFUSEFRESNEL]) {
       fallbacks->addFallback(1, "DIFFUSEFRESNEL");
     }
 
-    if (defines["OPACITYFRESNEL"]) {
+    if (defines[OPACITYFRESNEL]) {
       fallbacks->addFallback(2, "OPACITYFRESNEL");
     }
 
-    if (defines["REFLECTIONFRESNEL"]) {
+    if (defines[REFLECTIONFRESNEL]) {
       fallbacks->addFallback(3, "REFLECTIONFRESNEL");
     }
 
-    if (defines["EMISSIVEFRESNEL"]) {
+    if (defines[EMISSIVEFRESNEL]) {
       fallbacks->addFallback(4, "EMISSIVEFRESNEL");
     }
 
-    if (defines["FRESNEL"]) {
+    if (defines[FRESNEL]) {
       fallbacks->addFallback(4, "FRESNEL");
     }
 
-    if (defines["MULTIVIEW"]) {
+    if (defines[MULTIVIEW]) {
       fallbacks->addFallback(0, "MULTIVIEW");
     }
 
     // Attributes
     std::vector<std::string> attribs{VertexBuffer::PositionKind};
 
-    if (defines["NORMAL"]) {
+    if (defines[NORMAL]) {
       attribs.emplace_back(VertexBuffer::NormalKind);
     }
 
-    if (defines["UV1"]) {
+    if (defines[UV1]) {
       attribs.emplace_back(VertexBuffer::UVKind);
     }
 
-    if (defines["UV2"]) {
+    if (defines[UV2]) {
       attribs.emplace_back(VertexBuffer::UV2Kind);
     }
 
-    if (defines["VERTEXCOLOR"]) {
+    if (defines[VERTEXCOLOR]) {
       attribs.emplace_back(VertexBuffer::ColorKind);
     }
 
@@ -845,7 +902,7 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, BaseSubMesh* subMes
 
     std::unordered_map<std::string, unsigned int> indexParameters{
       {"maxSimultaneousLights", _maxSimultaneousLights},
-      {"maxSimultaneousMorphTargets", defines.intDef["NUM_MORPH_INFLUENCERS"]}};
+      {"maxSimultaneousMorphTargets", defines.intDef[NUM_MORPH_INFLUENCERS]}};
 
     IEffectCreationOptions options;
     options.attributes            = std::move(attribs);
@@ -970,6 +1027,12 @@ void StandardMaterial::unbind()
 
 void StandardMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh)
 {
+  static const auto INSTANCES             = MaterialDefinesSchema::IndexOf("INSTANCES");
+  static const auto OBJECTSPACE_NORMALMAP = MaterialDefinesSchema::IndexOf("OBJECTSPACE_NORMALMAP");
+  static const auto FRESNEL               = MaterialDefinesSchema::IndexOf("FRESNEL");
+  static const auto SPECULARTERM          = MaterialDefinesSchema::IndexOf("SPECULARTERM");
+  static const auto NUM_MORPH_INFLUENCERS = MaterialDefinesSchema::IndexOf("NUM_MORPH_INFLUENCERS");
+
   auto scene = getScene();
 
   auto definesTmp = static_cast<StandardMaterialDefines*>(subMesh->_materialDefines.get());
@@ -985,12 +1048,12 @@ void StandardMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMes
   _activeEffect = effect;
 
   // Matrices
-  if (!defines["INSTANCES"]) {
+  if (!defines[INSTANCES]) {
     bindOnlyWorldMatrix(world);
   }
 
   // Normal Matrix
-  if (defines["OBJECTSPACE_NORMALMAP"]) {
+  if (defines[OBJECTSPACE_NORMALMAP]) {
     world.toNormalMatrix(_normalMatrix);
     bindOnlyNormalMatrix(_normalMatrix);
   }
@@ -1006,7 +1069,7 @@ void StandardMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMes
     bindViewProjection(effect);
     if (!ubo.useUbo() || !isFrozen() || !ubo.isSync()) {
 
-      if (StandardMaterial::FresnelEnabled() && defines["FRESNEL"]) {
+      if (StandardMaterial::FresnelEnabled() && defines[FRESNEL]) {
         // Fresnel
         if (_diffuseFresnelParameters && _diffuseFresnelParameters->isEnabled()) {
           ubo.updateColor4("diffuseLeftColor", _diffuseFresnelParameters->leftColor,
@@ -1053,7 +1116,8 @@ void StandardMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMes
           MaterialHelper::BindTextureMatrix(*_diffuseTexture, ubo, "diffuse");
 
           if (_diffuseTexture->hasAlpha()) {
-            effect->setFloat("alphaCutOff", alphaCutOff);
+            static const auto alphaCutOffHandle = Effect::UniformHandle("alphaCutOff");
+            effect->setFloat(alphaCutOffHandle, alphaCutOff);
           }
         }
 
@@ -1134,7 +1198,7 @@ void StandardMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMes
         ubo.updateFloat("pointSize", pointSize);
       }
 
-      if (defines["SPECULARTERM"]) {
+      if (defines[SPECULARTERM]) {
         ubo.updateColor4("vSpecularColor", specularColor, specularPower, "");
       }
       ubo.updateColor3(
@@ -1205,7 +1269,8 @@ void StandardMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMes
     scene->ambientColor.multiplyToRef(ambientColor, _globalAmbientColor);
 
     MaterialHelper::BindEyePosition(effect, scene);
-    effect->setColor3("vAmbientColor", _globalAmbientColor);
+    static const auto ambientColorHandle = Effect::UniformHandle("vAmbientColor");
+    effect->setColor3(ambientColorHandle, _globalAmbientColor);
   }
 
   if (mustRebind || !isFrozen()) {
@@ -1225,7 +1290,7 @@ void StandardMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMes
     MaterialHelper::BindFogParameters(scene, mesh, effect);
 
     // Morph targets
-    if (defines.intDef["NUM_MORPH_INFLUENCERS"]) {
+    if (defines.intDef[NUM_MORPH_INFLUENCERS]) {
       MaterialHelper::BindMorphTargetParameters(mesh, effect);
     }
 
@@ -283,16 +283,22 @@ void UniformBuffer::update()
 void UniformBuffer::updateUniform(const std::string& uniformName, const Float32Array& data,
                                   size_t size)
 {
-  size_t location = _uniformLocations[uniformName];
-  if (!stl_util::contains(_uniformLocations, uniformName)) {
+  _updateUniform(uniformName, data.data(), size);
+}
+
+void UniformBuffer::_updateUniform(const std::string& uniformName, const float* data, size_t size)
+{
+  auto it = _uniformLocations.find(uniformName);
+  if (it == _uniformLocations.end()) {
     if (_buffer) {
       // Cannot add an uniform if the buffer is already created
       BABYLON_LOG_ERROR("UniformBuffer", "Cannot add an uniform after UBO has been created.")
       return;
     }
     addUniform(uniformName, static_cast<int>(size));
-    location = _uniformLocations[uniformName];
+    it = _uniformLocations.find(uniformName);
   }
+  const auto location = it->second;
 
   if (!_buffer) {
     create();
@@ -331,6 +337,17 @@ bool UniformBuffer::_cacheMatrix(const std::string& name, const Matrix& matrix)
   return true;
 }
 
+const std::string& UniformBuffer::_getEffectUniformName(const std::string& name,
+                                                      const std::string& suffix)
+{
+  if (suffix.empty()) {
+    return name;
+  }
+
+  _suffixedName.assign(name).append(suffix);
+  return _suffixedName;
+}
+
 void UniformBuffer::_updateMatrix3x3ForUniform(const std::string& name, const Float32Array& matrix)
 {
   // To match std140, matrix must be realigned
@@ -381,7 +398,7 @@ void UniformBuffer::_updateFloatForUniform(const std::string& name, float x)
 void UniformBuffer::_updateFloat2ForEffect(const std::string& name, float x, float y,
                                            const std::string& suffix)
 {
-  _currentEffect->setFloat2(name + suffix, x, y);
+  _currentEffect->setFloat2(_getEffectUniformName(name, suffix), x, y);
 }
 
 void UniformBuffer::_updateFloat2ForUniform(const std::string& name, float x, float y)
@@ -394,7 +411,7 @@ void UniformBuffer::_updateFloat2ForUniform(const std::string& name, float x, fl
 void UniformBuffer::_updateFloat3ForEffect(const std::string& name, float x, float y, float z,
                                            const std::string& suffix)
 {
-  _currentEffect->setFloat3(name + suffix, x, y, z);
+  _currentEffect->setFloat3(_getEffectUniformName(name, suffix), x, y, z);
 }
 
 void UniformBuffer::_updateFloat3ForUniform(const std::string& name, float x, float y, float z)
@@ -408,7 +425,7 @@ void UniformBuffer::_updateFloat3ForUniform(const std::string& name, float x, fl
 void UniformBuffer::_updateFloat4ForEffect(const std::string& name, float x, float y, float z,
                                            float w, const std::string& suffix)
 {
-  _currentEffect->setFloat4(name + suffix, x, y, z, w);
+  _currentEffect->setFloat4(_getEffectUniformName(name, suffix), x, y, z, w);
 }
 
 void UniformBuffer::_updateFloat4ForUniform(const std::string& name, float x, float y, float z,
@@ -429,7 +446,7 @@ void UniformBuffer::_updateMatrixForEffect(const std::string& name, const Matrix
 void UniformBuffer::_updateMatrixForUniform(const std::string& name, const Matrix& mat)
 {
   if (_cacheMatrix(name, mat)) {
-    updateUniform(name, mat.toArray(), 16);
+    _updateUniform(name, mat.m().data(), 16);
   }
 }
 
@@ -458,7 +475,7 @@ void UniformBuffer::_updateVector4ForUniform(const std::string& name, const Vect
 void UniformBuffer::_updateColor3ForEffect(const std::string& name, const Color3& color,
                                            const std::string& suffix)
 {
-  _currentEffect->setColor3(name + suffix, color);
+  _currentEffect->setColor3(_getEffectUniformName(name, suffix), color);
 }
 
 void UniformBuffer::_updateColor3ForUniform(const std::string& name, const Color3& color)
@@ -470,7 +487,7 @@ void UniformBuffer::_updateColor3ForUniform(const std::string& name, const Color
 void UniformBuffer::_updateColor4ForEffect(const std::string& name, const Color3& color,
                                            float alpha, const std::string& suffix)
 {
-  _currentEffect->setColor4(name + suffix, color, alpha);
+  _currentEffect->setColor4(_getEffectUniformName(name, suffix), color, alpha);
 }
 
 void UniformBuffer::_updateColor4ForUniform(const std::string& name, const Color3& color,
@@ -0,0 +1,669 @@
+#include <babylon/maths/batch_math.h>
+
+#include <algorithm>
+#include <atomic>
+#include <initializer_list>
+
+#if defined(OPTION_ENABLE_SIMD) && (defined(__SSE__) || defined(_M_X64))
+#define BABYLON_BATCH_MATH_USE_SSE
+#include <immintrin.h>
+#if defined(__GNUC__)
+// The AVX2 kernels are compiled for their own target and only called when the CPU supports them
+#define BABYLON_BATCH_MATH_USE_AVX2
+#define BABYLON_BATCH_MATH_AVX2_TARGET __attribute__((target("avx2,fma")))
+#elif defined(__AVX2__)
+#define BABYLON_BATCH_MATH_USE_AVX2
+#define BABYLON_BATCH_MATH_AVX2_TARGET
+#endif
+#elif defined(OPTION_ENABLE_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#define BABYLON_BATCH_MATH_USE_NEON
+#include <arm_neon.h>
+#endif
+
+namespace BABYLON {
+
+namespace {
+
+/**
+ * Kernels of a backend. The matrices multiplication reads the other matrices with a stride of 16
+ * floats (one matrix per product) or 0 (the same matrix for all the products).
+ */
+struct Kernels {
+  BatchMathBackend backend;
+  void (*multiplyMatrices)(const float* matrices, const float* others, size_t othersStride,
+                           float* result, size_t count);
+  void (*transformCoordinates)(const float* points, const float* m, float* result, size_t count);
+  void (*transformNormals)(const float* normals, const float* m, float* result, size_t count);
+  void (*transformBoundingBoxes)(const float* boxes, const float* matrices, float* result,
+                                 size_t count);
+};
+
+//------------------------------------------------------------------------------
+// Scalar
+//------------------------------------------------------------------------------
+
+void MultiplyMatricesScalar(const float* matrices, const float* others, size_t othersStride,
+                            float* result, size_t count)
+{
+  float product[16];
+  for (size_t i = 0; i < count; ++i, matrices += 16, others += othersStride, result += 16) {
+    const auto a = matrices;
+    const auto b = others;
+    for (size_t row = 0; row < 16; row += 4) {
+      for (size_t col = 0; col < 4; ++col) {
+        product[row + col] = a[row] * b[col] + a[row + 1] * b[4 + col] + a[row + 2] * b[8 + col]
+                             + a[row + 3] * b[12 + col];
+      }
+    }
+    std::copy(product, product + 16, result);
+  }
+}
+
+void TransformCoordinatesScalar(const float* points, const float* m, float* result, size_t count)
+{
+  for (size_t i = 0; i < count * 3; i += 3) {
+    const auto x  = points[i];
+    const auto y  = points[i + 1];
+    const auto z  = points[i + 2];
+    const auto rw = 1.f / (x * m[3] + y * m[7] + z * m[11] + m[15]);
+    result[i]     = (x * m[0] + y * m[4] + z * m[8] + m[12]) * rw;
+    result[i + 1] = (x * m[1] + y * m[5] + z * m[9] + m[13]) * rw;
+    result[i + 2] = (x * m[2] + y * m[6] + z * m[10] + m[14]) * rw;
+  }
+}
+
+void TransformNormalsScalar(const float* normals, const float* m, float* result, size_t count)
+{
+  for (size_t i = 0; i < count * 3; i += 3) {
+    const auto x  = normals[i];
+    const auto y  = normals[i + 1];
+    const auto z  = normals[i + 2];
+    result[i]     = x * m[0] + y * m[4] + z * m[8];
+    result[i + 1] = x * m[1] + y * m[5] + z * m[9];
+    result[i + 2] = x * m[2] + y * m[6] + z * m[10];
+  }
+}
+
+void TransformBoundingBoxesScalar(const float* boxes, const float* matrices, float* result,
+                                  size_t count)
+{
+  // Each axis of the box contributes its smallest and largest projections (Arvo)
+  for (size_t i = 0; i < count; ++i, boxes += 6, matrices += 16, result += 6) {
+    const auto m     = matrices;
+    float minimum[3] = {m[12], m[13], m[14]};
+    float maximum[3] = {m[12], m[13], m[14]};
+    for (size_t axis = 0; axis < 3; ++axis) {
+      for (size_t col = 0; col < 3; ++col) {
+        const auto e = m[axis * 4 + col] * boxes[axis];
+        const auto f = m[axis * 4 + col] * boxes[3 + axis];
+        minimum[col] += std::min(e, f);
+        maximum[col] += std::max(e, f);
+      }
+    }
+    std::copy(minimum, minimum + 3, result);
+    std::copy(maximum, maximum + 3, result + 3);
+  }
+}
+
+const Kernels ScalarKernels{BatchMathBackend::Scalar, &MultiplyMatricesScalar,
+                            &TransformCoordinatesScalar, &TransformNormalsScalar,
+                            &TransformBoundingBoxesScalar};
+
+//------------------------------------------------------------------------------
+// SSE
+//------------------------------------------------------------------------------
+
+#ifdef BABYLON_BATCH_MATH_USE_SSE
+
+/**
+ * Loads 4 points (x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3) as xs, ys and zs.
+ */
+inline void LoadPointsSSE(const float* points, __m128& xs, __m128& ys, __m128& zs)
+{
+  const auto a = _mm_loadu_ps(points);
+  const auto b = _mm_loadu_ps(points + 4);
+  const auto c = _mm_loadu_ps(points + 8);
+  xs = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+  ys = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)),
+                      _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+  zs = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), c, _MM_SHUFFLE(3, 0, 2, 0));
+}
+
+/**
+ * Stores xs, ys and zs as 4 points.
+ */
+inline void StorePointsSSE(float* points, __m128 xs, __m128 ys, __m128 zs)
+{
+  const auto a = _mm_shuffle_ps(_mm_shuffle_ps(xs, ys, _MM_SHUFFLE(0, 0, 0, 0)),
+                                _mm_shuffle_ps(zs, xs, _MM_SHUFFLE(1, 1, 0, 0)),
+                                _MM_SHUFFLE(2, 0, 2, 0));
+  const auto b = _mm_shuffle_ps(_mm_shuffle_ps(ys, zs, _MM_SHUFFLE(1, 1, 1, 1)),
+                                _mm_shuffle_ps(xs, ys, _MM_SHUFFLE(2, 2, 2, 2)),
+                                _MM_SHUFFLE(2, 0, 2, 0));
+  const auto c = _mm_shuffle_ps(_mm_shuffle_ps(zs, xs, _MM_SHUFFLE(3, 3, 2, 2)),
+                                _mm_shuffle_ps(ys, zs, _MM_SHUFFLE(3, 3, 3, 3)),
+                                _MM_SHUFFLE(2, 0, 2, 0));
+  _mm_storeu_ps(points, a);
+  _mm_storeu_ps(points + 4, b);
+  _mm_storeu_ps(points + 8, c);
+}
+
+void MultiplyMatricesSSE(const float* matrices, const float* others, size_t othersStride,
+                         float* result, size_t count)
+{
+  for (size_t i = 0; i < count; ++i, matrices += 16, others += othersStride, result += 16) {
+    // The rows of the other matrix are loaded first, and a row of the matrix is read before its
+    // result is stored, so the result can be either operand
+    const auto row0 = _mm_loadu_ps(others);
+    const auto row1 = _mm_loadu_ps(others + 4);
+    const auto row2 = _mm_loadu_ps(others + 8);
+    const auto row3 = _mm_loadu_ps(others + 12);
+    for (size_t r = 0; r < 16; r += 4) {
+      auto row = _mm_mul_ps(_mm_set1_ps(matrices[r]), row0);
+      row      = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(matrices[r + 1]), row1));
+      row      = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(matrices[r + 2]), row2));
+      row      = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(matrices[r + 3]), row3));
+      _mm_storeu_ps(result + r, row);
+    }
+  }
+}
+
+void TransformCoordinatesSSE(const float* points, const float* m, float* result, size_t count)
+{
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    __m128 xs, ys, zs;
+    LoadPointsSSE(points + i * 3, xs, ys, zs);
+    auto rx = _mm_add_ps(_mm_mul_ps(xs, _mm_set1_ps(m[0])), _mm_set1_ps(m[12]));
+    auto ry = _mm_add_ps(_mm_mul_ps(xs, _mm_set1_ps(m[1])), _mm_set1_ps(m[13]));
+    auto rz = _mm_add_ps(_mm_mul_ps(xs, _mm_set1_ps(m[2])), _mm_set1_ps(m[14]));
+    auto rw = _mm_add_ps(_mm_mul_ps(xs, _mm_set1_ps(m[3])), _mm_set1_ps(m[15]));
+    rx      = _mm_add_ps(rx, _mm_mul_ps(ys, _mm_set1_ps(m[4])));
+    ry      = _mm_add_ps(ry, _mm_mul_ps(ys, _mm_set1_ps(m[5])));
+    rz      = _mm_add_ps(rz, _mm_mul_ps(ys, _mm_set1_ps(m[6])));
+    rw      = _mm_add_ps(rw, _mm_mul_ps(ys, _mm_set1_ps(m[7])));
+    rx      = _mm_add_ps(rx, _mm_mul_ps(zs, _mm_set1_ps(m[8])));
+    ry      = _mm_add_ps(ry, _mm_mul_ps(zs, _mm_set1_ps(m[9])));
+    rz      = _mm_add_ps(rz, _mm_mul_ps(zs, _mm_set1_ps(m[10])));
+    rw      = _mm_add_ps(rw, _mm_mul_ps(zs, _mm_set1_ps(m[11])));
+    rw      = _mm_div_ps(_mm_set1_ps(1.f), rw);
+    StorePointsSSE(result + i * 3, _mm_mul_ps(rx, rw), _mm_mul_ps(ry, rw), _mm_mul_ps(rz, rw));
+  }
+  TransformCoordinatesScalar(points + i * 3, m, result + i * 3, count - i);
+}
+
+void TransformNormalsSSE(const float* normals, const float* m, float* result, size_t count)
+{
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    __m128 xs, ys, zs;
+    LoadPointsSSE(normals + i * 3, xs, ys, zs);
+    auto rx = _mm_mul_ps(xs, _mm_set1_ps(m[0]));
+    auto ry = _mm_mul_ps(xs, _mm_set1_ps(m[1]));
+    auto rz = _mm_mul_ps(xs, _mm_set1_ps(m[2]));
+    rx      = _mm_add_ps(rx, _mm_mul_ps(ys, _mm_set1_ps(m[4])));
+    ry      = _mm_add_ps(ry, _mm_mul_ps(ys, _mm_set1_ps(m[5])));
+    rz      = _mm_add_ps(rz, _mm_mul_ps(ys, _mm_set1_ps(m[6])));
+    rx      = _mm_add_ps(rx, _mm_mul_ps(zs, _mm_set1_ps(m[8])));
+    ry      = _mm_add_ps(ry, _mm_mul_ps(zs, _mm_set1_ps(m[9])));
+    rz      = _mm_add_ps(rz, _mm_mul_ps(zs, _mm_set1_ps(m[10])));
+    StorePointsSSE(result + i * 3, rx, ry, rz);
+  }
+  TransformNormalsScalar(normals + i * 3, m, result + i * 3, count - i);
+}
+
+void TransformBoundingBoxesSSE(const float* boxes, const float* matrices, float* result,
+                               size_t count)
+{
+  alignas(16) float minimum[4];
+  alignas(16) float maximum[4];
+  for (size_t i = 0; i < count; ++i, boxes += 6, matrices += 16, result += 6) {
+    auto minimumRow = _mm_loadu_ps(matrices + 12);
+    auto maximumRow = minimumRow;
+    for (size_t axis = 0; axis < 3; ++axis) {
+      const auto row = _mm_loadu_ps(matrices + axis * 4);
+      const auto e   = _mm_mul_ps(row, _mm_set1_ps(boxes[axis]));
+      const auto f   = _mm_mul_ps(row, _mm_set1_ps(boxes[3 + axis]));
+      minimumRow     = _mm_add_ps(minimumRow, _mm_min_ps(e, f));
+      maximumRow     = _mm_add_ps(maximumRow, _mm_max_ps(e, f));
+    }
+    // The boxes are 6 floats, a 4 floats store would overwrite the next box
+    _mm_store_ps(minimum, minimumRow);
+    _mm_store_ps(maximum, maximumRow);
+    std::copy(minimum, minimum + 3, result);
+    std::copy(maximum, maximum + 3, result + 3);
+  }
+}
+
+const Kernels SSEKernels{BatchMathBackend::SSE, &MultiplyMatricesSSE, &TransformCoordinatesSSE,
+                         &TransformNormalsSSE, &TransformBoundingBoxesSSE};
+
+#endif
+
+//------------------------------------------------------------------------------
+// AVX2
+//------------------------------------------------------------------------------
+
+#ifdef BABYLON_BATCH_MATH_USE_AVX2
+
+BABYLON_BATCH_MATH_AVX2_TARGET inline __m256 Combine(__m128 low, __m128 high)
+{
+  return _mm256_insertf128_ps(_mm256_castps128_ps256(low), high, 1);
+}
+
+/**
+ * Loads 8 points as xs, ys and zs.
+ */
+BABYLON_BATCH_MATH_AVX2_TARGET inline void LoadPointsAVX2(const float* points, __m256& xs,
+                                                          __m256& ys, __m256& zs)
+{
+  __m128 xs0, ys0, zs0, xs1, ys1, zs1;
+  LoadPointsSSE(points, xs0, ys0, zs0);
+  LoadPointsSSE(points + 12, xs1, ys1, zs1);
+  xs = Combine(xs0, xs1);
+  ys = Combine(ys0, ys1);
+  zs = Combine(zs0, zs1);
+}
+
+/**
+ * Stores xs, ys and zs as 8 points.
+ */
+BABYLON_BATCH_MATH_AVX2_TARGET inline void StorePointsAVX2(float* points, __m256 xs, __m256 ys,
+                                                           __m256 zs)
+{
+  StorePointsSSE(points, _mm256_castps256_ps128(xs), _mm256_castps256_ps128(ys),
+                 _mm256_castps256_ps128(zs));
+  StorePointsSSE(points + 12, _mm256_extractf128_ps(xs, 1), _mm256_extractf128_ps(ys, 1),
+                 _mm256_extractf128_ps(zs, 1));
+}
+
+BABYLON_BATCH_MATH_AVX2_TARGET void MultiplyMatricesAVX2(const float* matrices,
+                                                         const float* others,
+                                                         size_t othersStride, float* result,
+                                                         size_t count)
+{
+  for (size_t i = 0; i < count; ++i, matrices += 16, others += othersStride, result += 16) {
+    // Two rows of the result at once: the rows of the other matrix are repeated in both lanes and
+    // weighted by the coefficients of the two rows of the matrix
+    const auto row0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(others));
+    const auto row1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(others + 4));
+    const auto row2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(others + 8));
+    const auto row3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(others + 12));
+    for (size_t r = 0; r < 16; r += 8) {
+      const auto rows = _mm256_loadu_ps(matrices + r);
+      auto product    = _mm256_mul_ps(_mm256_permute_ps(rows, 0x00), row0);
+      product         = _mm256_fmadd_ps(_mm256_permute_ps(rows, 0x55), row1, product);
+      product         = _mm256_fmadd_ps(_mm256_permute_ps(rows, 0xAA), row2, product);
+      product         = _mm256_fmadd_ps(_mm256_permute_ps(rows, 0xFF), row3, product);
+      _mm256_storeu_ps(result + r, product);
+    }
+  }
+}
+
+BABYLON_BATCH_MATH_AVX2_TARGET void TransformCoordinatesAVX2(const float* points, const float* m,
+                                                             float* result, size_t count)
+{
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    __m256 xs, ys, zs;
+    LoadPointsAVX2(points + i * 3, xs, ys, zs);
+    auto rx = _mm256_fmadd_ps(xs, _mm256_set1_ps(m[0]), _mm256_set1_ps(m[12]));
+    auto ry = _mm256_fmadd_ps(xs, _mm256_set1_ps(m[1]), _mm256_set1_ps(m[13]));
+    auto rz = _mm256_fmadd_ps(xs, _mm256_set1_ps(m[2]), _mm256_set1_ps(m[14]));
+    auto rw = _mm256_fmadd_ps(xs, _mm256_set1_ps(m[3]), _mm256_set1_ps(m[15]));
+    rx      = _mm256_fmadd_ps(ys, _mm256_set1_ps(m[4]), rx);
+    ry      = _mm256_fmadd_ps(ys, _mm256_set1_ps(m[5]), ry);
+    rz      = _mm256_fmadd_ps(ys, _mm256_set1_ps(m[6]), rz);
+    rw      = _mm256_fmadd_ps(ys, _mm256_set1_ps(m[7]), rw);
+    rx      = _mm256_fmadd_ps(zs, _mm256_set1_ps(m[8]), rx);
+    ry      = _mm256_fmadd_ps(zs, _mm256_set1_ps(m[9]), ry);
+    rz      = _mm256_fmadd_ps(zs, _mm256_set1_ps(m[10]), rz);
+    rw      = _mm256_fmadd_ps(zs, _mm256_set1_ps(m[11]), rw);
+    rw      = _mm256_div_ps(_mm256_set1_ps(1.f), rw);
+    StorePointsAVX2(result + i * 3, _mm256_mul_ps(rx, rw), _mm256_mul_ps(ry, rw),
+                    _mm256_mul_ps(rz, rw));
+  }
+  TransformCoordinatesSSE(points + i * 3, m, result + i * 3, count - i);
+}
+
+BABYLON_BATCH_MATH_AVX2_TARGET void TransformNormalsAVX2(const float* normals, const float* m,
+                                                         float* result, size_t count)
+{
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    __m256 xs, ys, zs;
+    LoadPointsAVX2(normals + i * 3, xs, ys, zs);
+    auto rx = _mm256_mul_ps(xs, _mm256_set1_ps(m[0]));
+    auto ry = _mm256_mul_ps(xs, _mm256_set1_ps(m[1]));
+    auto rz = _mm256_mul_ps(xs, _mm256_set1_ps(m[2]));
+    rx      = _mm256_fmadd_ps(ys, _mm256_set1_ps(m[4]), rx);
+    ry      = _mm256_fmadd_ps(ys, _mm256_set1_ps(m[5]), ry);
+    rz      = _mm256_fmadd_ps(ys, _mm256_set1_ps(m[6]), rz);
+    rx      = _mm256_fmadd_ps(zs, _mm256_set1_ps(m[8]), rx);
+    ry      = _mm256_fmadd_ps(zs, _mm256_set1_ps(m[9]), ry);
+    rz      = _mm256_fmadd_ps(zs, _mm256_set1_ps(m[10]), rz);
+    StorePointsAVX2(result + i * 3, rx, ry, rz);
+  }
+  TransformNormalsSSE(normals + i * 3, m, result + i * 3, count - i);
+}
+
+// A bounding box only fills 4 lanes, the SSE kernel is used
+const Kernels AVX2Kernels{BatchMathBackend::AVX2, &MultiplyMatricesAVX2, &TransformCoordinatesAVX2,
+                          &TransformNormalsAVX2, &TransformBoundingBoxesSSE};
+
+#endif
+
+//------------------------------------------------------------------------------
+// NEON
+//------------------------------------------------------------------------------
+
+#ifdef BABYLON_BATCH_MATH_USE_NEON
+
+inline float32x4_t ReciprocalNEON(float32x4_t values)
+{
+#if defined(__aarch64__)
+  return vdivq_f32(vdupq_n_f32(1.f), values);
+#else
+  // Estimate refined by two Newton-Raphson steps
+  auto reciprocal = vrecpeq_f32(values);
+  reciprocal      = vmulq_f32(vrecpsq_f32(values, reciprocal), reciprocal);
+  return vmulq_f32(vrecpsq_f32(values, reciprocal), reciprocal);
+#endif
+}
+
+void MultiplyMatricesNEON(const float* matrices, const float* others, size_t othersStride,
+                          float* result, size_t count)
+{
+  for (size_t i = 0; i < count; ++i, matrices += 16, others += othersStride, result += 16) {
+    const auto row0 = vld1q_f32(others);
+    const auto row1 = vld1q_f32(others + 4);
+    const auto row2 = vld1q_f32(others + 8);
+    const auto row3 = vld1q_f32(others + 12);
+    for (size_t r = 0; r < 16; r += 4) {
+      auto row = vmulq_n_f32(row0, matrices[r]);
+      row      = vmlaq_n_f32(row, row1, matrices[r + 1]);
+      row      = vmlaq_n_f32(row, row2, matrices[r + 2]);
+      row      = vmlaq_n_f32(row, row3, matrices[r + 3]);
+      vst1q_f32(result + r, row);
+    }
+  }
+}
+
+void TransformCoordinatesNEON(const float* points, const float* m, float* result, size_t count)
+{
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    // vld3q deinterleaves the x, y and z of 4 points
+    const auto p = vld3q_f32(points + i * 3);
+    auto rx      = vmlaq_n_f32(vdupq_n_f32(m[12]), p.val[0], m[0]);
+    auto ry      = vmlaq_n_f32(vdupq_n_f32(m[13]), p.val[0], m[1]);
+    auto rz      = vmlaq_n_f32(vdupq_n_f32(m[14]), p.val[0], m[2]);
+    auto rw      = vmlaq_n_f32(vdupq_n_f32(m[15]), p.val[0], m[3]);
+    rx           = vmlaq_n_f32(rx, p.val[1], m[4]);
+    ry           = vmlaq_n_f32(ry, p.val[1], m[5]);
+    rz           = vmlaq_n_f32(rz, p.val[1], m[6]);
+    rw           = vmlaq_n_f32(rw, p.val[1], m[7]);
+    rx           = vmlaq_n_f32(rx, p.val[2], m[8]);
+    ry           = vmlaq_n_f32(ry, p.val[2], m[9]);
+    rz           = vmlaq_n_f32(rz, p.val[2], m[10]);
+    rw           = vmlaq_n_f32(rw, p.val[2], m[11]);
+    rw           = ReciprocalNEON(rw);
+    float32x4x3_t transformed;
+    transformed.val[0] = vmulq_f32(rx, rw);
+    transformed.val[1] = vmulq_f32(ry, rw);
+    transformed.val[2] = vmulq_f32(rz, rw);
+    vst3q_f32(result + i * 3, transformed);
+  }
+  TransformCoordinatesScalar(points + i * 3, m, result + i * 3, count - i);
+}
+
+void TransformNormalsNEON(const float* normals, const float* m, float* result, size_t count)
+{
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    const auto n = vld3q_f32(normals + i * 3);
+    float32x4x3_t transformed;
+    transformed.val[0] = vmulq_n_f32(n.val[0], m[0]);
+    transformed.val[1] = vmulq_n_f32(n.val[0], m[1]);
+    transformed.val[2] = vmulq_n_f32(n.val[0], m[2]);
+    transformed.val[0] = vmlaq_n_f32(transformed.val[0], n.val[1], m[4]);
+    transformed.val[1] = vmlaq_n_f32(transformed.val[1], n.val[1], m[5]);
+    transformed.val[2] = vmlaq_n_f32(transformed.val[2], n.val[1], m[6]);
+    transformed.val[0] = vmlaq_n_f32(transformed.val[0], n.val[2], m[8]);
+    transformed.val[1] = vmlaq_n_f32(transformed.val[1], n.val[2], m[9]);
+    transformed.val[2] = vmlaq_n_f32(transformed.val[2], n.val[2], m[10]);
+    vst3q_f32(result + i * 3, transformed);
+  }
+  TransformNormalsScalar(normals + i * 3, m, result + i * 3, count - i);
+}
+
+void TransformBoundingBoxesNEON(const float* boxes, const float* matrices, float* result,
+                                size_t count)
+{
+  float minimum[4];
+  float maximum[4];
+  for (size_t i = 0; i < count; ++i, boxes += 6, matrices += 16, result += 6) {
+    auto minimumRow = vld1q_f32(matrices + 12);
+    auto maximumRow = minimumRow;
+    for (size_t axis = 0; axis < 3; ++axis) {
+      const auto row = vld1q_f32(matrices + axis * 4);
+      const auto e   = vmulq_n_f32(row, boxes[axis]);
+      const auto f   = vmulq_n_f32(row, boxes[3 + axis]);
+      minimumRow     = vaddq_f32(minimumRow, vminq_f32(e, f));
+      maximumRow     = vaddq_f32(maximumRow, vmaxq_f32(e, f));
+    }
+    vst1q_f32(minimum, minimumRow);
+    vst1q_f32(maximum, maximumRow);
+    std::copy(minimum, minimum + 3, result);
+    std::copy(maximum, maximum + 3, result + 3);
+  }
+}
+
+const Kernels NEONKernels{BatchMathBackend::NEON, &MultiplyMatricesNEON,
+                          &TransformCoordinatesNEON, &TransformNormalsNEON,
+                          &TransformBoundingBoxesNEON};
+
+#endif
+
+//------------------------------------------------------------------------------
+// Dispatch
+//------------------------------------------------------------------------------
+
+const Kernels* KernelsOf(BatchMathBackend backend)
+{
+  switch (backend) {
+#ifdef BABYLON_BATCH_MATH_USE_SSE
+    case BatchMathBackend::SSE:
+      return &SSEKernels;
+#endif
+#ifdef BABYLON_BATCH_MATH_USE_AVX2
+    case BatchMathBackend::AVX2:
+#if defined(__GNUC__)
+      if (!__builtin_cpu_supports("avx2") || !__builtin_cpu_supports("fma")) {
+        return nullptr;
+      }
+#endif
+      return &AVX2Kernels;
+#endif
+#ifdef BABYLON_BATCH_MATH_USE_NEON
+    case BatchMathBackend::NEON:
+      return &NEONKernels;
+#endif
+    case BatchMathBackend::Scalar:
+      return &ScalarKernels;
+    default:
+      return nullptr;
+  }
+}
+
+std::atomic<const Kernels*>& ActiveKernels()
+{
+  static std::atomic<const Kernels*> activeKernels{[]() {
+    for (auto backend : {BatchMathBackend::AVX2, BatchMathBackend::NEON, BatchMathBackend::SSE}) {
+      if (auto kernels = KernelsOf(backend)) {
+        return kernels;
+      }
+    }
+    return &ScalarKernels;
+  }()};
+  return activeKernels;
+}
+
+inline const Kernels& Active()
+{
+  return *ActiveKernels().load(std::memory_order_relaxed);
+}
+
+} // end of anonymous namespace
+
+BatchMathBackend BatchMath::Backend()
+{
+  return Active().backend;
+}
+
+const char* BatchMath::BackendName(BatchMathBackend backend)
+{
+  switch (backend) {
+    case BatchMathBackend::SSE:
+      return "SSE";
+    case BatchMathBackend::AVX2:
+      return "AVX2";
+    case BatchMathBackend::NEON:
+      return "NEON";
+    default:
+      return "Scalar";
+  }
+}
+
+bool BatchMath::IsSupported(BatchMathBackend backend)
+{
+  return KernelsOf(backend) != nullptr;
+}
+
+bool BatchMath::SetBackend(BatchMathBackend backend)
+{
+  const auto kernels = KernelsOf(backend);
+  if (!kernels) {
+    return false;
+  }
+  ActiveKernels().store(kernels);
+  return true;
+}
+
+void BatchMath::MultiplyMatrices(const float* matrices, const float* others, float* result,
+                                 size_t count)
+{
+  Active().multiplyMatrices(matrices, others, 16, result, count);
+}
+
+void BatchMath::MultiplyMatricesByMatrix(const float* matrices, const float* other, float* result,
+                                         size_t count)
+{
+  Active().multiplyMatrices(matrices, other, 0, result, count);
+}
+
+void BatchMath::TransformCoordinates(const float* points, const float* matrix, float* result,
+                                     size_t count)
+{
+  Active().transformCoordinates(points, matrix, result, count);
+}
+
+void BatchMath::TransformNormals(const float* normals, const float* matrix, float* result,
+                                 size_t count)
+{
+  Active().transformNormals(normals, matrix, result, count);
+}
+
+void BatchMath::ComposeMatrices(const float* scalings, const float* rotations,
+                                const float* translations, float* result, size_t count)
+{
+  // Dominated by the per matrix arithmetic of the quaternion, all the backends share this loop
+  for (size_t i = 0; i < count; ++i, scalings += 3, rotations += 4, translations += 3) {
+    const auto x = rotations[0], y = rotations[1], z = rotations[2], w = rotations[3];
+    const auto x2 = x + x, y2 = y + y, z2 = z + z;
+    const auto xx = x * x2, xy = x * y2, xz = x * z2;
+    const auto yy = y * y2, yz = y * z2, zz = z * z2;
+    const auto wx = w * x2, wy = w * y2, wz = w * z2;
+
+    const auto sx = scalings[0], sy = scalings[1], sz = scalings[2];
+
+    auto m = result + i * 16;
+    m[0]   = (1 - (yy + zz)) * sx;
+    m[1]   = (xy + wz) * sx;
+    m[2]   = (xz - wy) * sx;
+    m[3]   = 0;
+
+    m[4] = (xy - wz) * sy;
+    m[5] = (1 - (xx + zz)) * sy;
+    m[6] = (yz + wx) * sy;
+    m[7] = 0;
+
+    m[8]  = (xz + wy) * sz;
+    m[9]  = (yz - wx) * sz;
+    m[10] = (1 - (xx + yy)) * sz;
+    m[11] = 0;
+
+    m[12] = translations[0];
+    m[13] = translations[1];
+    m[14] = translations[2];
+    m[15] = 1;
+  }
+}
+
+void BatchMath::InvertAffineMatrices(const float* matrices, float* result, size_t count)
+{
+  // The inverse of [A 0; t 1] is [inv(A) 0; -t * inv(A) 1], with a 3x3 inverse only
+  for (size_t i = 0; i < count; ++i, matrices += 16, result += 16) {
+    const auto m0 = matrices[0], m1 = matrices[1], m2 = matrices[2];
+    const auto m4 = matrices[4], m5 = matrices[5], m6 = matrices[6];
+    const auto m8 = matrices[8], m9 = matrices[9], m10 = matrices[10];
+    const auto t0 = matrices[12], t1 = matrices[13], t2 = matrices[14];
+
+    const auto cofact_00 = m5 * m10 - m6 * m9;
+    const auto cofact_01 = m6 * m8 - m4 * m10;
+    const auto cofact_02 = m4 * m9 - m5 * m8;
+
+    const auto det = m0 * cofact_00 + m1 * cofact_01 + m2 * cofact_02;
+    if (det == 0.f) {
+      // not invertible
+      std::copy(matrices, matrices + 16, result);
+      continue;
+    }
+
+    const auto detInv = 1.f / det;
+    const auto i0     = cofact_00 * detInv;
+    const auto i1     = (m2 * m9 - m1 * m10) * detInv;
+    const auto i2     = (m1 * m6 - m2 * m5) * detInv;
+    const auto i4     = cofact_01 * detInv;
+    const auto i5     = (m0 * m10 - m2 * m8) * detInv;
+    const auto i6     = (m2 * m4 - m0 * m6) * detInv;
+    const auto i8     = cofact_02 * detInv;
+    const auto i9     = (m1 * m8 - m0 * m9) * detInv;
+    const auto i10    = (m0 * m5 - m1 * m4) * detInv;
+
+    result[0]  = i0;
+    result[1]  = i1;
+    result[2]  = i2;
+    result[3]  = 0.f;
+    result[4]  = i4;
+    result[5]  = i5;
+    result[6]  = i6;
+    result[7]  = 0.f;
+    result[8]  = i8;
+    result[9]  = i9;
+    result[10] = i10;
+    result[11] = 0.f;
+    result[12] = -(t0 * i0 + t1 * i4 + t2 * i8);
+    result[13] = -(t0 * i1 + t1 * i5 + t2 * i9);
+    result[14] = -(t0 * i2 + t1 * i6 + t2 * i10);
+    result[15] = 1.f;
+  }
+}
+
+void BatchMath::TransformBoundingBoxes(const float* boxes, const float* matrices, float* result,
+                                       size_t count)
+{
+  Active().transformBoundingBoxes(boxes, matrices, result, count);
+}
+
+} // end of namespace BABYLON
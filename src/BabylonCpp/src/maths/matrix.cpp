@@ -11,9 +11,14 @@
 #include <babylon/maths/vector4.h>
 #include <babylon/maths/viewport.h>
 
+#if defined(OPTION_ENABLE_SIMD) && (defined(__SSE__) || defined(_M_X64))
+#define BABYLON_MATRIX_USE_SSE
+#include <xmmintrin.h>
+#endif
+
 namespace BABYLON {
 
-int Matrix::_updateFlagSeed      = 0;
+std::atomic<int> Matrix::_updateFlagSeed{0};
 Matrix Matrix::_identityReadOnly = Matrix::Identity();
 
 Matrix::Matrix()
@@ -68,8 +73,8 @@ const std::array<float, 16>& Matrix::m() const
 
 void Matrix::_markAsUpdated()
 {
-  updateFlag
-    = (Matrix::_updateFlagSeed < std::numeric_limits<int>::max()) ? Matrix::_updateFlagSeed++ : 0;
+  const auto seed = Matrix::_updateFlagSeed.fetch_add(1, std::memory_order_relaxed);
+  updateFlag      = (seed < std::numeric_limits<int>::max()) ? seed : 0;
   _isIdentity         = false;
   _isIdentity3x2      = false;
   _isIdentityDirty    = true;
@@ -79,7 +84,7 @@ void Matrix::_markAsUpdated()
 void Matrix::_updateIdentityStatus(bool isIdentity, bool isIdentityDirty, bool isIdentity3x2,
                                    bool isIdentity3x2Dirty)
 {
-  updateFlag          = Matrix::_updateFlagSeed++;
+  updateFlag          = Matrix::_updateFlagSeed.fetch_add(1, std::memory_order_relaxed);
   _isIdentity         = isIdentity;
   _isIdentity3x2      = isIdentity || isIdentity3x2;
   _isIdentityDirty    = _isIdentity ? false : isIdentityDirty;
@@ -460,11 +465,38 @@ Matrix& Matrix::multiplyToRef(const Matrix& other, Matrix& result)
   return *this;
 }
 
+#ifdef BABYLON_MATRIX_USE_SSE
+namespace {
+
+void MultiplyMatricesSSE(const float* m, const float* otherM, float* result)
+{
+  // Each row of the result is the combination of the rows of the other matrix weighted by the
+  // same row of this matrix. The rows of the other matrix are loaded first, and a row of this
+  // matrix is read before its result is stored, so result can be either operand.
+  const auto row0 = _mm_loadu_ps(&otherM[0]);
+  const auto row1 = _mm_loadu_ps(&otherM[4]);
+  const auto row2 = _mm_loadu_ps(&otherM[8]);
+  const auto row3 = _mm_loadu_ps(&otherM[12]);
+  for (unsigned int i = 0; i < 16; i += 4) {
+    auto row = _mm_mul_ps(_mm_set1_ps(m[i]), row0);
+    row      = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(m[i + 1]), row1));
+    row      = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(m[i + 2]), row2));
+    row      = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(m[i + 3]), row3));
+    _mm_storeu_ps(&result[i], row);
+  }
+}
+
+} // end of anonymous namespace
+#endif
+
 const Matrix& Matrix::multiplyToArray(const Matrix& other, std::array<float, 16>& result,
                                       unsigned int offset) const
 {
   const auto& m      = _m;
   const auto& otherM = other.m();
+#ifdef BABYLON_MATRIX_USE_SSE
+  MultiplyMatricesSSE(m.data(), otherM.data(), &result[offset]);
+#else
   const auto tm0 = m[0], tm1 = m[1], tm2 = m[2], tm3 = m[3];
   const auto tm4 = m[4], tm5 = m[5], tm6 = m[6], tm7 = m[7];
   const auto tm8 = m[8], tm9 = m[9], tm10 = m[10], tm11 = m[11];
@@ -494,6 +526,7 @@ const Matrix& Matrix::multiplyToArray(const Matrix& other, std::array<float, 16>
   result[offset + 13] = tm12 * om1 + tm13 * om5 + tm14 * om9 + tm15 * om13;
   result[offset + 14] = tm12 * om2 + tm13 * om6 + tm14 * om10 + tm15 * om14;
   result[offset + 15] = tm12 * om3 + tm13 * om7 + tm14 * om11 + tm15 * om15;
+#endif
 
   return *this;
 }
@@ -507,6 +540,10 @@ const Matrix& Matrix::multiplyToArray(const Matrix& other, Float32Array& result,
 
   const auto& m      = _m;
   const auto& otherM = other.m();
+#ifdef BABYLON_MATRIX_USE_SSE
+  // The bone matrices of the skeletons are written through this overload
+  MultiplyMatricesSSE(m.data(), otherM.data(), &result[offset]);
+#else
   const auto tm0 = m[0], tm1 = m[1], tm2 = m[2], tm3 = m[3];
   const auto tm4 = m[4], tm5 = m[5], tm6 = m[6], tm7 = m[7];
   const auto tm8 = m[8], tm9 = m[9], tm10 = m[10], tm11 = m[11];
@@ -536,6 +573,7 @@ const Matrix& Matrix::multiplyToArray(const Matrix& other, Float32Array& result,
   result[offset + 13] = tm12 * om1 + tm13 * om5 + tm14 * om9 + tm15 * om13;
   result[offset + 14] = tm12 * om2 + tm13 * om6 + tm14 * om10 + tm15 * om14;
   result[offset + 15] = tm12 * om3 + tm13 * om7 + tm14 * om11 + tm15 * om15;
+#endif
 
   return *this;
 }
@@ -10,23 +10,22 @@
 
 namespace BABYLON {
 
-std::array<Color3, 3> TmpVectors::Color3Array{
+thread_local std::array<Color3, 3> TmpVectors::Color3Array{
   {Color3::Black(), Color3::Black(), Color3::Black()}};
-std::array<Color4, 3> TmpVectors::Color4Array{{Color4(0.f, 0.f, 0.f, 0.f),
-                                               Color4(0.f, 0.f, 0.f, 0.f),
-                                               Color4(0.f, 0.f, 0.f, 0.f)}};
-std::array<Vector2, 3> TmpVectors::Vector2Array{
+thread_local std::array<Color4, 3> TmpVectors::Color4Array{
+  {Color4(0.f, 0.f, 0.f, 0.f), Color4(0.f, 0.f, 0.f, 0.f), Color4(0.f, 0.f, 0.f, 0.f)}};
+thread_local std::array<Vector2, 3> TmpVectors::Vector2Array{
   {Vector2::Zero(), Vector2::Zero(), Vector2::Zero()}};
-std::array<Vector3, 13> TmpVectors::Vector3Array{
+thread_local std::array<Vector3, 13> TmpVectors::Vector3Array{
   {Vector3::Zero(), Vector3::Zero(), Vector3::Zero(), Vector3::Zero(),
    Vector3::Zero(), Vector3::Zero(), Vector3::Zero(), Vector3::Zero(),
    Vector3::Zero(), Vector3::Zero(), Vector3::Zero(), Vector3::Zero(),
    Vector3::Zero()}};
-std::array<Vector4, 3> TmpVectors::Vector4Array{
+thread_local std::array<Vector4, 3> TmpVectors::Vector4Array{
   {Vector4::Zero(), Vector4::Zero(), Vector4::Zero()}};
-std::array<Quaternion, 2> TmpVectors::QuaternionArray{
+thread_local std::array<Quaternion, 2> TmpVectors::QuaternionArray{
   {Quaternion::Zero(), Quaternion::Zero()}};
-std::array<Matrix, 8> TmpVectors::MatrixArray{
+thread_local std::array<Matrix, 8> TmpVectors::MatrixArray{
   {Matrix::Identity(), Matrix::Identity(), Matrix::Identity(),
    Matrix::Identity(), Matrix::Identity(), Matrix::Identity(),
    Matrix::Identity(), Matrix::Identity()}};
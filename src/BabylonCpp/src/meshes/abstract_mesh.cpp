@@ -5,11 +5,14 @@
 #include <babylon/bones/bone.h>
 #include <babylon/bones/skeleton.h>
 #include <babylon/cameras/camera.h>
+#include <babylon/collisions/collider.h>
 #include <babylon/collisions/icollision_coordinator.h>
 #include <babylon/collisions/intersection_info.h>
 #include <babylon/collisions/picking_info.h>
 #include <babylon/culling/bounding_box.h>
 #include <babylon/culling/bounding_info.h>
+#include <babylon/culling/bvh/picking_bvh.h>
+#include <babylon/culling/bvh/triangle_bvh.h>
 #include <babylon/culling/octrees/octree_scene_component.h>
 #include <babylon/culling/ray.h>
 #include <babylon/engines/engine.h>
@@ -24,7 +27,6 @@
 #include <babylon/maths/frustum.h>
 #include <babylon/maths/functions.h>
 #include <babylon/maths/tmp_vectors.h>
-#include <babylon/meshes/lines_mesh.h>
 #include <babylon/meshes/sub_mesh.h>
 #include <babylon/meshes/vertex_buffer.h>
 #include <babylon/meshes/vertex_data.h>
@@ -111,8 +113,11 @@ AbstractMesh::AbstractMesh(const std::string& iName, Scene* scene)
     , _materialDefines{nullptr}
     , _boundingInfo{nullptr}
     , _renderId{0}
+    , _octreeSelectionId{0}
+    , _pickingBVHIndex{0}
     , _submeshesOctree{nullptr}
     , _unIndexed{false}
+    , _isLinesMesh{false}
     , lightSources{this, &AbstractMesh::get_lightSources}
     , _positions{this, &AbstractMesh::get__positions}
     , _waitingData{_WaitingData{
@@ -127,6 +132,7 @@ AbstractMesh::AbstractMesh(const std::string& iName, Scene* scene)
     , useBones{this, &AbstractMesh::get_useBones}
     , isAnInstance{this, &AbstractMesh::get_isAnInstance}
     , hasInstances{this, &AbstractMesh::get_hasInstances}
+    , hasThinInstances{this, &AbstractMesh::get_hasThinInstances}
     , checkCollisions{this, &AbstractMesh::get_checkCollisions, &AbstractMesh::set_checkCollisions}
     , collider{this, &AbstractMesh::get_collider}
     , _renderingGroupId{0}
@@ -843,6 +849,9 @@ AbstractMesh::normalizeToUnitCube(bool includeDescendants, bool ignoreRotation,
 AbstractMesh& AbstractMesh::setBoundingInfo(const BoundingInfo& boundingInfo)
 {
   _boundingInfo = std::make_unique<BoundingInfo>(boundingInfo);
+  if (_scene->_pickingBVH) {
+    _scene->_pickingBVH->markDirty(this);
+  }
   return *this;
 }
 
@@ -910,6 +919,11 @@ bool AbstractMesh::get_hasInstances() const
   return false;
 }
 
+bool AbstractMesh::get_hasThinInstances() const
+{
+  return false;
+}
+
 AbstractMesh& AbstractMesh::movePOV(float amountRight, float amountUp, float amountForward)
 {
   position().addInPlace(calcMovePOV(amountRight, amountUp, amountForward));
@@ -1036,6 +1050,7 @@ Float32Array AbstractMesh::_getPositionData(bool applySkeleton)
           _positions()[index / 3].copyFrom(tempVector);
         }
       }
+      _resetTriangleBVH();
     }
   }
 
@@ -1053,6 +1068,9 @@ AbstractMesh& AbstractMesh::_updateBoundingInfo()
                                                    effectiveMesh->worldMatrixFromCache());
   }
   _updateSubMeshesBoundingInfo(effectiveMesh->worldMatrixFromCache());
+  if (_scene->_pickingBVH) {
+    _scene->_pickingBVH->markDirty(this);
+  }
   return *this;
 }
 
@@ -1319,42 +1337,95 @@ Octree<SubMesh*>* AbstractMesh::createOrUpdateSubmeshesOctree(size_t maxCapacity
 }
 
 AbstractMesh& AbstractMesh::_collideForSubMesh(SubMesh* subMesh, const Matrix& transformMatrix,
-                                               Collider& /*iCollider*/)
+                                               Collider& iCollider)
 {
   _generatePointsArray();
 
-  if (_positions().empty()) {
+  const auto& positions = _positions();
+  if (positions.empty()) {
     return *this;
   }
 
-  // Transformation
-  if (subMesh->_lastColliderWorldVertices.empty()
-      || !subMesh->_lastColliderTransformMatrix->equals(transformMatrix)) {
-    subMesh->_lastColliderTransformMatrix = std::make_unique<Matrix>(transformMatrix);
-    subMesh->_lastColliderWorldVertices   = {};
-    subMesh->_trianglePlanes              = {};
-    auto start                            = subMesh->verticesStart;
-    auto end                              = (subMesh->verticesStart + subMesh->verticesCount);
-    for (unsigned int i = start; i < end; i++) {
-      subMesh->_lastColliderWorldVertices.emplace_back(
-        Vector3::TransformCoordinates(_positions()[i], transformMatrix));
+  const auto triangleBVH = _getTriangleBVH();
+  const auto meshIndices = triangleBVH ? IndicesArray() : getIndices();
+  const auto& indices    = triangleBVH ? triangleBVH->indices() : meshIndices;
+  const auto indexStart  = static_cast<size_t>(subMesh->indexStart);
+  const auto indexEnd    = std::min(indexStart + subMesh->indexCount, indices.size());
+  const auto hasMaterial = subMesh->getMaterial() != nullptr;
+  const auto hostMesh    = shared_from_base<AbstractMesh>();
+
+  // The triangles are transformed in the space of the collider ellipsoid when they are tested
+  const auto collideTriangle = [&](size_t index) {
+    const auto i0 = indices[index], i1 = indices[index + 1], i2 = indices[index + 2];
+    if (i0 >= positions.size() || i1 >= positions.size() || i2 >= positions.size()) {
+      return;
     }
+    const auto p1 = Vector3::TransformCoordinates(positions[i0], transformMatrix);
+    const auto p2 = Vector3::TransformCoordinates(positions[i1], transformMatrix);
+    const auto p3 = Vector3::TransformCoordinates(positions[i2], transformMatrix);
+    iCollider._testTriangle(p3, p2, p1, hasMaterial, hostMesh);
+  };
+
+  if (!triangleBVH) {
+    for (size_t index = indexStart; index + 3 <= indexEnd; index += 3) {
+      collideTriangle(index);
+    }
+    return *this;
   }
-  // Collide
-#if 0
-  iCollider._collide(
-    subMesh->_trianglePlanes, subMesh->_lastColliderWorldVertices, getIndices(),
-    subMesh->indexStart, subMesh->indexStart + subMesh->indexCount,
-    subMesh->verticesStart, subMesh->getMaterial() != nullptr);
-#endif
+
+  // Bounds of the collider sweep (see Collider::_canDoCollision) in the space of the collider
+  // ellipsoid, then in the local space of the geometry
+  const auto& radius = iCollider._radius;
+  const auto sweepRadius
+    = iCollider._velocityWorldLength + std::max({radius.x, radius.y, radius.z});
+  const auto center = iCollider._basePointWorld.divide(radius);
+  const std::array<float, 3> extents{{sweepRadius / radius.x, sweepRadius / radius.y,
+                                      sweepRadius / radius.z}};
+
+  auto inverseTransformMatrix = transformMatrix;
+  if (inverseTransformMatrix.determinant() == 0.f) {
+    return *this;
+  }
+  inverseTransformMatrix.invert();
+  const auto localCenter = Vector3::TransformCoordinates(center, inverseTransformMatrix);
+  const auto& m          = inverseTransformMatrix.m();
+  auto localBounds       = BVHBounds::FromMinMax(localCenter, localCenter);
+  for (unsigned int axis = 0; axis < 3; ++axis) {
+    auto extent = 0.f;
+    for (unsigned int row = 0; row < 3; ++row) {
+      extent += std::abs(m[row * 4 + axis]) * extents[row];
+    }
+    // Margin for the rounding errors of the inversion
+    extent *= 1.01f;
+    localBounds.minimum[axis] -= extent;
+    localBounds.maximum[axis] += extent;
+  }
+
+  // The triangles are tested in the index order, the first of equally distant ones is kept
+  std::vector<uint32_t> triangles;
+  triangleBVH->intersectsBounds(localBounds, [&](uint32_t triangle) {
+    const auto index = static_cast<size_t>(triangle) * 3;
+    if (index >= indexStart && index + 3 <= indexEnd) {
+      triangles.emplace_back(triangle);
+    }
+    return false;
+  });
+  std::sort(triangles.begin(), triangles.end());
+  for (const auto triangle : triangles) {
+    collideTriangle(static_cast<size_t>(triangle) * 3);
+  }
+
   return *this;
 }
 
 AbstractMesh& AbstractMesh::_processCollisionsForSubMeshes(Collider& iCollider,
-                                                           const Matrix& transformMatrix)
+                                                           const Matrix& transformMatrix,
+                                                           bool useSubMeshCandidates)
 {
-  auto iSubMeshes = _scene->getCollidingSubMeshCandidates(this, iCollider);
-  auto len        = iSubMeshes.size();
+  const auto iSubMeshes = useSubMeshCandidates ?
+                            _scene->getCollidingSubMeshCandidates(this, iCollider) :
+                            stl_util::to_raw_ptr_vector(subMeshes);
+  const auto len = iSubMeshes.size();
 
   for (size_t index = 0; index < len; ++index) {
     auto& subMesh = iSubMeshes[index];
@@ -1369,20 +1440,21 @@ AbstractMesh& AbstractMesh::_processCollisionsForSubMeshes(Collider& iCollider,
   return *this;
 }
 
-AbstractMesh& AbstractMesh::_checkCollision(Collider& iCollider)
+AbstractMesh& AbstractMesh::_checkCollision(Collider& iCollider, bool useSubMeshCandidates)
 {
   // Bounding box test
   if (!_boundingInfo->_checkCollision(iCollider)) {
     return *this;
   }
 
-  // Transformation matrix
-  auto& collisionsScalingMatrix   = TmpVectors::MatrixArray[0];
-  auto& collisionsTransformMatrix = TmpVectors::MatrixArray[1];
+  // Transformation matrix (not stored in the shared temporary matrices as the meshes can be
+  // tested from several threads)
+  Matrix collisionsScalingMatrix;
+  Matrix collisionsTransformMatrix;
   Matrix::ScalingToRef(1.f / iCollider._radius.x, 1.f / iCollider._radius.y,
                        1.f / iCollider._radius.z, collisionsScalingMatrix);
   worldMatrixFromCache().multiplyToRef(collisionsScalingMatrix, collisionsTransformMatrix);
-  _processCollisionsForSubMeshes(iCollider, collisionsTransformMatrix);
+  _processCollisionsForSubMeshes(iCollider, collisionsTransformMatrix, useSubMeshCandidates);
   return *this;
 }
 
@@ -1391,16 +1463,27 @@ bool AbstractMesh::_generatePointsArray()
   return false;
 }
 
+float AbstractMesh::_getIntersectionThreshold() const
+{
+  return 0.f;
+}
+
+TriangleBVH* AbstractMesh::_getTriangleBVH()
+{
+  return nullptr;
+}
+
+void AbstractMesh::_resetTriangleBVH()
+{
+}
+
 PickingInfo AbstractMesh::intersects(Ray& ray, bool fastCheck,
                                      const TrianglePickingPredicate& trianglePredicate)
 {
   PickingInfo pickingInfo;
 
-  auto intersectionThreshold
-    = getClassName() == "InstancedLinesMesh" || getClassName() == "LinesMesh" ?
-        static_cast<LinesMesh*>(this)->intersectionThreshold :
-        0.f;
-  const auto& boundingInfo = _boundingInfo;
+  const auto intersectionThreshold = _getIntersectionThreshold();
+  const auto& boundingInfo         = _boundingInfo;
   if (subMeshes.empty() || !boundingInfo
       || !ray.intersectsSphere(boundingInfo->boundingSphere, intersectionThreshold)
       || !ray.intersectsBox(boundingInfo->boundingBox, intersectionThreshold)) {
@@ -1413,6 +1496,10 @@ PickingInfo AbstractMesh::intersects(Ray& ray, bool fastCheck,
 
   std::optional<IntersectionInfo> intersectInfo = std::nullopt;
 
+  // The submeshes of large geometries are tested through the BVH of their triangles, which holds
+  // its own copy of the indices
+  const auto indices = _getTriangleBVH() ? IndicesArray() : getIndices();
+
   // Octrees
   auto _subMeshes = _scene->getIntersectingSubMeshCandidates(this, ray);
   auto len        = _subMeshes.size();
@@ -1425,7 +1512,7 @@ PickingInfo AbstractMesh::intersects(Ray& ray, bool fastCheck,
     }
 
     auto currentIntersectInfo
-      = subMesh->intersects(ray, _positions(), getIndices(), fastCheck, trianglePredicate);
+      = subMesh->intersects(ray, _positions(), indices, fastCheck, trianglePredicate);
 
     if (currentIntersectInfo) {
       if (fastCheck || !intersectInfo || currentIntersectInfo->distance < intersectInfo->distance) {
@@ -54,6 +54,35 @@ Buffer::Buffer(Mesh* mesh, const Float32Array& data, bool updatable, std::option
   }
 }
 
+Buffer::Buffer(Engine* engine, const ArrayBufferView& data, bool updatable,
+               std::optional<size_t> stride, bool postponeInternalCreation, bool instanced,
+               bool useBytes, const std::optional<unsigned int>& divisor)
+    : _buffer{nullptr}
+{
+  _engine    = engine ? engine : Engine::LastCreatedEngine();
+  _updatable = updatable;
+  _instanced = instanced;
+  _divisor   = divisor.value_or(1);
+
+  // Dynamic buffers are updated from a Float32Array, only static ones keep the raw bytes
+  if (updatable) {
+    _data = data.float32Array();
+  }
+  else {
+    _bytes = data;
+  }
+
+  if (!stride.has_value()) {
+    stride = 0ull;
+  }
+
+  byteStride = useBytes ? *stride : *stride * sizeof(float);
+
+  if (!postponeInternalCreation) { // by default
+    create();
+  }
+}
+
 Buffer::~Buffer() = default;
 
 std::unique_ptr<VertexBuffer> Buffer::createVertexBuffer(const std::string& kind, size_t offset,
@@ -81,6 +110,10 @@ bool Buffer::isUpdatable() const
 
 Float32Array& Buffer::getData()
 {
+  // Buffers created from raw bytes are only converted when read on the CPU
+  if (_data.empty() && _bytes) {
+    _data = _bytes.float32Array();
+  }
   return _data;
 }
 
@@ -105,6 +138,11 @@ WebGLDataBufferPtr Buffer::create(Float32Array data)
     data = _data;
   }
 
+  if (data.empty() && _bytes && !_buffer) {
+    _buffer = _engine->createVertexBuffer(_bytes);
+    return _buffer;
+  }
+
   if (data.empty()) {
     return nullptr;
   }
@@ -5,6 +5,7 @@
 #include <babylon/babylon_stl_util.h>
 #include <babylon/bones/skeleton.h>
 #include <babylon/culling/bounding_info.h>
+#include <babylon/culling/bvh/triangle_bvh.h>
 #include <babylon/engines/constants.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
@@ -171,6 +172,10 @@ AbstractMesh* Geometry::setVerticesData(const std::string& kind, const Float32Ar
 void Geometry::removeVerticesData(const std::string& kind)
 {
   if (stl_util::contains(_vertexBuffers, kind) && _vertexBuffers[kind]) {
+    const auto slot = _vertexBuffers[kind]->getKindSlot();
+    if (slot < _vertexBuffersBySlot.size()) {
+      _vertexBuffersBySlot[slot] = nullptr;
+    }
     _vertexBuffers[kind]->dispose();
     _vertexBuffers[kind] = nullptr;
     _vertexBuffers.erase(kind);
@@ -188,6 +193,12 @@ void Geometry::setVerticesBuffer(const VertexBufferPtr& buffer,
 
   _vertexBuffers[kind] = buffer;
 
+  const auto slot = buffer->getKindSlot();
+  if (slot >= _vertexBuffersBySlot.size()) {
+    _vertexBuffersBySlot.resize(slot + 1);
+  }
+  _vertexBuffersBySlot[slot] = buffer;
+
   if (kind == VertexBuffer::PositionKind) {
     auto& data = buffer->getData();
 
@@ -285,23 +296,22 @@ void Geometry::_bind(const EffectPtr& effect, WebGLDataBufferPtr indexToBind)
     indexToBind = _indexBuffer;
   }
 
-  auto vbs = getVertexBuffers();
-
-  if (vbs.empty()) {
+  if (!isReady() || _vertexBuffers.empty()) {
     return;
   }
 
-  if (indexToBind != _indexBuffer /*|| _vertexArrayObjects.empty()*/) {
-    _engine->bindBuffers(vbs, indexToBind, effect);
+  if (indexToBind != _indexBuffer || !_engine->getCaps().vertexArrayObject) {
+    _engine->bindBuffers(_vertexBuffersBySlot, indexToBind, effect);
     return;
   }
 
   // Using VAO
-  if (!stl_util::contains(_vertexArrayObjects, effect->key())) {
-    _vertexArrayObjects[effect->key()] = _engine->recordVertexArrayObject(vbs, indexToBind, effect);
+  auto& vertexArrayObject = _vertexArrayObjects[effect->uniqueId];
+  if (!vertexArrayObject) {
+    vertexArrayObject = _engine->recordVertexArrayObject(_vertexBuffersBySlot, indexToBind, effect);
   }
 
-  _engine->bindVertexArrayObject(_vertexArrayObjects[effect->key()], indexToBind);
+  _engine->bindVertexArrayObject(vertexArrayObject, indexToBind);
 }
 
 size_t Geometry::getTotalVertices() const
@@ -412,6 +422,7 @@ void Geometry::updateIndices(const IndicesArray& indices, int offset, bool gpuMe
 
     if (!gpuMemoryOnly) {
       _indices = indices;
+      _resetTriangleBVH();
     }
     _engine->updateDynamicIndexBuffer(_indexBuffer, indices, offset);
     if (needToUpdateSubMeshes) {
@@ -433,6 +444,7 @@ AbstractMesh* Geometry::setIndices(const IndicesArray& indices, size_t totalVert
 
   _indices                = indices;
   _indexBufferIsUpdatable = updatable;
+  _resetTriangleBVH();
   if (!_meshes.empty()) {
     _indexBuffer = _engine->createIndexBuffer(_indices, updatable);
   }
@@ -487,9 +499,10 @@ void Geometry::_releaseVertexArrayObject(const EffectPtr& effect)
     return;
   }
 
-  if (stl_util::contains(_vertexArrayObjects, effect->key())) {
-    _engine->releaseVertexArrayObject(_vertexArrayObjects[effect->key()]);
-    _vertexArrayObjects[effect->key()] = nullptr;
+  auto it = _vertexArrayObjects.find(effect->uniqueId);
+  if (it != _vertexArrayObjects.end()) {
+    _engine->releaseVertexArrayObject(it->second);
+    _vertexArrayObjects.erase(it);
   }
 }
 
@@ -657,6 +670,7 @@ void Geometry::toLeftHanded()
 void Geometry::_resetPointsArrayCache()
 {
   _positions.clear();
+  _resetTriangleBVH();
 }
 
 bool Geometry::_generatePointsArray()
@@ -680,6 +694,21 @@ bool Geometry::_generatePointsArray()
   return true;
 }
 
+TriangleBVH* Geometry::_getTriangleBVH()
+{
+  if (!_triangleBVH && _indices.size() / 3 >= TriangleBVH::MinTriangleCount
+      && _generatePointsArray()) {
+    _triangleBVH = std::make_unique<TriangleBVH>(_positions, _indices);
+  }
+
+  return _triangleBVH.get();
+}
+
+void Geometry::_resetTriangleBVH()
+{
+  _triangleBVH = nullptr;
+}
+
 bool Geometry::isDisposed() const
 {
   return _isDisposed;
@@ -709,6 +738,7 @@ void Geometry::dispose()
     _vertexBuffers[item.first] = nullptr;
   }
   _vertexBuffers.clear();
+  _vertexBuffersBySlot.clear();
   _totalVertices = 0;
 
   if (_indexBuffer) {
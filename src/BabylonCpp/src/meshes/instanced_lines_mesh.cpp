@@ -6,8 +6,9 @@ namespace BABYLON {
 
 InstancedLinesMesh::InstancedLinesMesh(const std::string& iName,
                                        const LinesMeshPtr& iSource)
-    : InstancedMesh{iName, iSource}
+    : InstancedMesh{iName, iSource}, intersectionThreshold{iSource->intersectionThreshold}
 {
+  _isLinesMesh = true;
 }
 
 InstancedLinesMesh::~InstancedLinesMesh() = default;
@@ -17,6 +18,11 @@ std::string InstancedLinesMesh::getClassName() const
   return "InstancedLinesMesh";
 }
 
+float InstancedLinesMesh::_getIntersectionThreshold() const
+{
+  return intersectionThreshold;
+}
+
 InstancedLinesMesh&
 InstancedLinesMesh::enableEdgesRendering(float epsilon,
                                          bool checkVerticesInsteadOfIndices)
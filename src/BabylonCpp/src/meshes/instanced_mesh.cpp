@@ -289,6 +289,16 @@ bool InstancedMesh::_generatePointsArray()
   return _sourceMesh->_generatePointsArray();
 }
 
+TriangleBVH* InstancedMesh::_getTriangleBVH()
+{
+  return _sourceMesh->_getTriangleBVH();
+}
+
+void InstancedMesh::_resetTriangleBVH()
+{
+  _sourceMesh->_resetTriangleBVH();
+}
+
 InstancedMeshPtr InstancedMesh::clone(const std::string& /*iNname*/, Node* newParent,
                                       bool doNotCloneChildren)
 {
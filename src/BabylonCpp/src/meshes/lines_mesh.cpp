@@ -34,6 +34,7 @@ LinesMesh::LinesMesh(const std::string& iName, Scene* scene, Node* iParent, Line
   }
 
   intersectionThreshold = 0.1f;
+  _isLinesMesh          = true;
 
   std::vector<std::string> defines;
   IShaderMaterialOptions options;
@@ -116,6 +117,11 @@ Type LinesMesh::type() const
   return Type::LINESMESH;
 }
 
+float LinesMesh::_getIntersectionThreshold() const
+{
+  return intersectionThreshold;
+}
+
 MaterialPtr& LinesMesh::get_material()
 {
   _colorShaderMaterial = std::static_pointer_cast<Material>(_colorShader);
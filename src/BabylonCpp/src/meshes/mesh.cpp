@@ -28,6 +28,7 @@
 #include <babylon/meshes/_instance_data_storage.h>
 #include <babylon/meshes/_instances_batch.h>
 #include <babylon/meshes/_internal_mesh_data_info.h>
+#include <babylon/meshes/_thin_instance_data_storage.h>
 #include <babylon/meshes/_visible_instances.h>
 #include <babylon/meshes/buffer.h>
 #include <babylon/meshes/builders/box_builder.h>
@@ -53,9 +54,12 @@
 #include <babylon/meshes/ground_mesh.h>
 #include <babylon/meshes/instanced_mesh.h>
 #include <babylon/meshes/mesh_lod_level.h>
+#include <babylon/meshes/simplification/simplification_queue.h>
+#include <babylon/meshes/software_skinning.h>
 #include <babylon/meshes/vertex_buffer.h>
 #include <babylon/meshes/vertex_data.h>
 #include <babylon/misc/file_tools.h>
+#include <babylon/misc/job_pool.h>
 #include <babylon/misc/string_tools.h>
 #include <babylon/morph/morph_target.h>
 #include <babylon/morph/morph_target_manager.h>
@@ -93,10 +97,13 @@ Mesh::Mesh(const std::string& iName, Scene* scene, Node* iParent, Mesh* source,
     , geometry{this, &Mesh::get_geometry}
     , areNormalsFrozen{this, &Mesh::get_areNormalsFrozen}
     , overridenInstanceCount{this, &Mesh::set_overridenInstanceCount}
+    , thinInstanceCount{this, &Mesh::get_thinInstanceCount, &Mesh::set_thinInstanceCount}
     , _internalMeshDataInfo{std::make_unique<_InternalMeshDataInfo>()}
     , _onBeforeDrawObserver{nullptr}
     , _instanceDataStorage{std::make_unique<_InstanceDataStorage>()}
     , _effectiveMaterial{nullptr}
+    , _thinInstanceDataStorage{std::make_unique<_ThinInstanceDataStorage>()}
+    , _userThinInstanceBuffersStorage{nullptr}
     , _tessellation{0}
     , _arc{1.f}
 {
@@ -331,6 +338,25 @@ bool Mesh::get_hasInstances() const
   return !instances.empty();
 }
 
+bool Mesh::get_hasThinInstances() const
+{
+  return _thinInstanceDataStorage->instancesCount > 0;
+}
+
+size_t Mesh::get_thinInstanceCount() const
+{
+  return _thinInstanceDataStorage->instancesCount;
+}
+
+void Mesh::set_thinInstanceCount(size_t value)
+{
+  const auto numMaxInstances = _thinInstanceDataStorage->matrixData.size() / 16;
+
+  if (value <= numMaxInstances) {
+    _thinInstanceDataStorage->instancesCount = value;
+  }
+}
+
 std::string Mesh::toString(bool fullDetails)
 {
   std::ostringstream oss;
@@ -1079,9 +1105,10 @@ _InstancesBatchPtr Mesh::_getInstancesRenderList(size_t subMeshId, bool isReplac
   }
 
   batchCache->hardwareInstancedRendering[subMeshId]
-    = !isReplacementMode && _instanceDataStorage->hardwareInstancedRendering
-      && (batchCache->visibleInstances.find(subMeshId) != batchCache->visibleInstances.end())
-      && (!batchCache->visibleInstances[subMeshId].empty());
+    = get_hasThinInstances()
+      || (!isReplacementMode && _instanceDataStorage->hardwareInstancedRendering
+          && (batchCache->visibleInstances.find(subMeshId) != batchCache->visibleInstances.end())
+          && (!batchCache->visibleInstances[subMeshId].empty()));
   _instanceDataStorage->previousBatch = batchCache;
 
   return batchCache;
@@ -1191,7 +1218,11 @@ Mesh& Mesh::_processRendering(
   auto scene  = getScene();
   auto engine = scene->getEngine();
 
-  if (hardwareInstancedRendering) {
+  if (hardwareInstancedRendering && get_hasThinInstances()) {
+    _renderWithThinInstances(subMesh, static_cast<unsigned>(fillMode), effect, engine,
+                             iOnBeforeDraw, effectiveMaterial);
+  }
+  else if (hardwareInstancedRendering) {
     _renderWithInstances(subMesh, static_cast<unsigned>(fillMode), batch, effect, engine);
   }
   else {
@@ -1233,6 +1264,396 @@ Mesh& Mesh::_processRendering(
   return *this;
 }
 
+size_t Mesh::thinInstanceAdd(const Matrix& matrix, bool refresh)
+{
+  _thinInstanceUpdateBufferSize("matrix", 1);
+  _thinInstanceUpdateAttributeBufferSizes(1);
+
+  const auto index = _thinInstanceDataStorage->instancesCount++;
+  thinInstanceSetMatrixAt(index, matrix, refresh);
+
+  return index;
+}
+
+size_t Mesh::thinInstanceAdd(const std::vector<Matrix>& matrices, bool refresh)
+{
+  _thinInstanceUpdateBufferSize("matrix", matrices.size());
+  _thinInstanceUpdateAttributeBufferSizes(matrices.size());
+
+  const auto index = _thinInstanceDataStorage->instancesCount;
+  for (size_t i = 0; i < matrices.size(); ++i) {
+    thinInstanceSetMatrixAt(_thinInstanceDataStorage->instancesCount++, matrices[i],
+                            refresh && i == matrices.size() - 1);
+  }
+
+  return index;
+}
+
+size_t Mesh::thinInstanceAddSelf(bool refresh)
+{
+  return thinInstanceAdd(Matrix::IdentityReadOnly(), refresh);
+}
+
+void Mesh::thinInstanceRegisterAttribute(const std::string& kind, size_t stride)
+{
+  removeVerticesData(kind);
+
+  if (!_userThinInstanceBuffersStorage) {
+    _userThinInstanceBuffersStorage = std::make_unique<_UserThinInstanceBuffersStorage>();
+  }
+
+  auto& storage = *_userThinInstanceBuffersStorage;
+  // Initial size
+  storage.strides[kind] = stride;
+  storage.sizes[kind]   = stride * std::max(size_t(32), _thinInstanceDataStorage->instancesCount);
+  storage.data[kind]    = Float32Array(storage.sizes[kind]);
+
+  _thinInstanceCreateAttributeBuffer(kind);
+}
+
+bool Mesh::thinInstanceSetMatrixAt(size_t index, const Matrix& matrix, bool refresh)
+{
+  auto& storage = *_thinInstanceDataStorage;
+  if (storage.matrixData.empty() || index >= storage.instancesCount) {
+    return false;
+  }
+
+  matrix.copyToArray(storage.matrixData, static_cast<unsigned int>(index * 16));
+
+  if (refresh) {
+    thinInstanceBufferUpdated("matrix");
+
+    if (!doNotSyncBoundingInfo) {
+      thinInstanceRefreshBoundingInfo(false);
+    }
+  }
+
+  return true;
+}
+
+bool Mesh::thinInstanceSetAttributeAt(const std::string& kind, size_t index,
+                                      const Float32Array& value, bool refresh)
+{
+  if (!_userThinInstanceBuffersStorage
+      || !stl_util::contains(_userThinInstanceBuffersStorage->data, kind)
+      || index >= _thinInstanceDataStorage->instancesCount) {
+    return false;
+  }
+
+  // Make sure the buffer for the kind attribute is big enough
+  _thinInstanceUpdateBufferSize(kind, 0);
+
+  auto& storage     = *_userThinInstanceBuffersStorage;
+  auto& data        = storage.data[kind];
+  const auto stride = storage.strides[kind];
+  std::copy_n(value.begin(), std::min(value.size(), stride), data.begin() + index * stride);
+
+  if (refresh) {
+    thinInstanceBufferUpdated(kind);
+  }
+
+  return true;
+}
+
+void Mesh::thinInstanceSetBuffer(const std::string& kind, Float32Array buffer, size_t stride,
+                                 bool staticBuffer)
+{
+  if (kind == "matrix") {
+    auto& storage = *_thinInstanceDataStorage;
+    stride        = 16;
+
+    if (storage.matrixBuffer) {
+      storage.matrixBuffer->dispose();
+      storage.matrixBuffer = nullptr;
+    }
+
+    storage.matrixBufferSize = !buffer.empty() ? buffer.size() : 32 * stride;
+    storage.matrixData       = std::move(buffer);
+
+    if (!storage.matrixData.empty()) {
+      storage.instancesCount = storage.matrixData.size() / stride;
+      _thinInstanceCreateMatrixBuffer(staticBuffer);
+
+      if (!doNotSyncBoundingInfo) {
+        thinInstanceRefreshBoundingInfo(false);
+      }
+    }
+    else {
+      storage.instancesCount = 0;
+
+      if (!doNotSyncBoundingInfo) {
+        // Restores the bounding info of the geometry
+        storage.boundingMinimum = std::nullopt;
+        storage.boundingMaximum = std::nullopt;
+        refreshBoundingInfo();
+      }
+    }
+  }
+  else if (buffer.empty()) {
+    if (_userThinInstanceBuffersStorage
+        && stl_util::contains(_userThinInstanceBuffersStorage->data, kind)) {
+      removeVerticesData(kind);
+      auto& storage = *_userThinInstanceBuffersStorage;
+      storage.data.erase(kind);
+      storage.strides.erase(kind);
+      storage.sizes.erase(kind);
+      if (storage.buffers[kind]) {
+        storage.buffers[kind]->dispose();
+      }
+      storage.buffers.erase(kind);
+    }
+  }
+  else {
+    if (!_userThinInstanceBuffersStorage) {
+      _userThinInstanceBuffersStorage = std::make_unique<_UserThinInstanceBuffersStorage>();
+    }
+
+    auto& storage         = *_userThinInstanceBuffersStorage;
+    storage.strides[kind] = stride;
+    storage.sizes[kind]   = buffer.size();
+    storage.data[kind]    = std::move(buffer);
+
+    _thinInstanceCreateAttributeBuffer(kind, staticBuffer);
+  }
+}
+
+Float32Array* Mesh::thinInstanceGetBuffer(const std::string& kind)
+{
+  if (kind == "matrix") {
+    return _thinInstanceDataStorage->matrixData.empty() ? nullptr :
+                                                          &_thinInstanceDataStorage->matrixData;
+  }
+
+  if (!_userThinInstanceBuffersStorage
+      || !stl_util::contains(_userThinInstanceBuffersStorage->data, kind)) {
+    return nullptr;
+  }
+
+  return &_userThinInstanceBuffersStorage->data[kind];
+}
+
+void Mesh::thinInstanceBufferUpdated(const std::string& kind)
+{
+  if (kind == "matrix") {
+    auto& storage = *_thinInstanceDataStorage;
+    if (storage.matrixBuffer) {
+      // Only the part of the buffer used by the thin instances is uploaded
+      storage.matrixBuffer->updateDirectly(storage.matrixData, 0, storage.instancesCount);
+    }
+  }
+  else if (_userThinInstanceBuffersStorage
+           && stl_util::contains(_userThinInstanceBuffersStorage->buffers, kind)) {
+    auto& storage = *_userThinInstanceBuffersStorage;
+    storage.buffers[kind]->updateDirectly(storage.data[kind], 0);
+  }
+}
+
+void Mesh::thinInstancePartialBufferUpdate(const std::string& kind, const Float32Array& data,
+                                           size_t offset)
+{
+  Float32Array* target = nullptr;
+  BufferPtr buffer     = nullptr;
+  if (kind == "matrix") {
+    target = &_thinInstanceDataStorage->matrixData;
+    buffer = _thinInstanceDataStorage->matrixBuffer;
+  }
+  else if (_userThinInstanceBuffersStorage
+           && stl_util::contains(_userThinInstanceBuffersStorage->buffers, kind)) {
+    target = &_userThinInstanceBuffersStorage->data[kind];
+    buffer = _userThinInstanceBuffersStorage->buffers[kind];
+  }
+
+  if (!buffer || offset + data.size() > target->size()) {
+    return;
+  }
+
+  // Keep the CPU copy in sync, then upload the updated range only
+  std::copy(data.begin(), data.end(), target->begin() + offset);
+  buffer->updateDirectly(data, offset);
+}
+
+void Mesh::thinInstanceRefreshBoundingInfo(bool forceRefreshParentInfo)
+{
+  auto& storage = *_thinInstanceDataStorage;
+  if (storage.matrixData.empty() || !storage.matrixBuffer) {
+    return;
+  }
+
+  if (forceRefreshParentInfo) {
+    storage.boundingMinimum = std::nullopt;
+    storage.boundingMaximum = std::nullopt;
+    refreshBoundingInfo();
+  }
+
+  auto& boundingInfo = getBoundingInfo();
+  if (!boundingInfo || boundingInfo->isLocked()) {
+    return;
+  }
+
+  // The bounds of the geometry are kept as the bounding info is replaced below
+  if (!storage.boundingMinimum || !storage.boundingMaximum) {
+    storage.boundingMinimum = boundingInfo->boundingBox.minimum;
+    storage.boundingMaximum = boundingInfo->boundingBox.maximum;
+  }
+
+  const auto center = (*storage.boundingMinimum + *storage.boundingMaximum).scale(0.5f);
+  const auto extend = (*storage.boundingMaximum - *storage.boundingMinimum).scale(0.5f);
+
+  // Transforming the center and the absolute extends gives the axis aligned box of the 8
+  // transformed corners, for affine matrices
+  const auto maxFloat = std::numeric_limits<float>::max();
+  Vector3 minimum(maxFloat, maxFloat, maxFloat);
+  Vector3 maximum(-maxFloat, -maxFloat, -maxFloat);
+  const auto* m = storage.matrixData.data();
+  for (size_t i = 0; i < storage.instancesCount; ++i, m += 16) {
+    const auto cx = center.x * m[0] + center.y * m[4] + center.z * m[8] + m[12];
+    const auto cy = center.x * m[1] + center.y * m[5] + center.z * m[9] + m[13];
+    const auto cz = center.x * m[2] + center.y * m[6] + center.z * m[10] + m[14];
+    const auto ex = extend.x * std::abs(m[0]) + extend.y * std::abs(m[4])
+                    + extend.z * std::abs(m[8]);
+    const auto ey = extend.x * std::abs(m[1]) + extend.y * std::abs(m[5])
+                    + extend.z * std::abs(m[9]);
+    const auto ez = extend.x * std::abs(m[2]) + extend.y * std::abs(m[6])
+                    + extend.z * std::abs(m[10]);
+    minimum.x = std::min(minimum.x, cx - ex);
+    minimum.y = std::min(minimum.y, cy - ey);
+    minimum.z = std::min(minimum.z, cz - ez);
+    maximum.x = std::max(maximum.x, cx + ex);
+    maximum.y = std::max(maximum.y, cy + ey);
+    maximum.z = std::max(maximum.z, cz + ez);
+  }
+
+  if (storage.instancesCount == 0) {
+    minimum = *storage.boundingMinimum;
+    maximum = *storage.boundingMaximum;
+  }
+
+  boundingInfo->reConstruct(minimum, maximum);
+  _updateBoundingInfo();
+}
+
+Mesh& Mesh::_renderWithThinInstances(
+  SubMesh* subMesh, unsigned int fillMode, const EffectPtr& effect, Engine* engine,
+  const std::function<void(bool isInstance, const Matrix& world, Material* effectiveMaterial)>&
+    iOnBeforeDraw,
+  Material* effectiveMaterial)
+{
+  // Stats
+  const auto instancesCount = _thinInstanceDataStorage->instancesCount;
+  getScene()->_activeIndices.addCount(subMesh->indexCount * instancesCount, false);
+
+  // The thin instance matrices are relative to the world matrix of the mesh
+  if (iOnBeforeDraw) {
+    iOnBeforeDraw(false, _effectiveMesh()->getWorldMatrix(), effectiveMaterial);
+  }
+
+  // Draw
+  _bind(subMesh, effect, fillMode);
+  _draw(subMesh, static_cast<int>(fillMode), instancesCount);
+
+  engine->unbindInstanceAttributes();
+
+  return *this;
+}
+
+void Mesh::_thinInstanceUpdateBufferSize(const std::string& kind, size_t numInstances)
+{
+  const auto kindIsMatrix = (kind == "matrix");
+
+  if (!kindIsMatrix
+      && (!_userThinInstanceBuffersStorage
+          || !stl_util::contains(_userThinInstanceBuffersStorage->strides, kind))) {
+    return;
+  }
+
+  auto& storage     = *_thinInstanceDataStorage;
+  const auto stride = kindIsMatrix ? 16 : _userThinInstanceBuffersStorage->strides[kind];
+  const auto currentSize
+    = kindIsMatrix ? storage.matrixBufferSize : _userThinInstanceBuffersStorage->sizes[kind];
+  auto& data = kindIsMatrix ? storage.matrixData : _userThinInstanceBuffersStorage->data[kind];
+
+  const auto bufferSize = (storage.instancesCount + numInstances) * stride;
+  auto newSize          = std::max(currentSize, stride);
+  while (newSize < bufferSize) {
+    newSize *= 2;
+  }
+
+  if (!data.empty() && currentSize == newSize) {
+    return;
+  }
+
+  data.resize(newSize, 0.f);
+
+  if (kindIsMatrix) {
+    if (storage.matrixBuffer) {
+      storage.matrixBuffer->dispose();
+    }
+    storage.matrixBufferSize = newSize;
+    _thinInstanceCreateMatrixBuffer();
+  }
+  else {
+    _userThinInstanceBuffersStorage->sizes[kind] = newSize;
+    _thinInstanceCreateAttributeBuffer(kind);
+  }
+}
+
+void Mesh::_thinInstanceUpdateAttributeBufferSizes(size_t numInstances)
+{
+  if (!_userThinInstanceBuffersStorage) {
+    return;
+  }
+
+  // The custom attributes must have a value for each of the new thin instances
+  for (const auto& item : _userThinInstanceBuffersStorage->strides) {
+    _thinInstanceUpdateBufferSize(item.first, numInstances);
+  }
+}
+
+void Mesh::_thinInstanceCreateMatrixBuffer(bool staticBuffer)
+{
+  auto& storage = *_thinInstanceDataStorage;
+
+  storage.matrixBuffer
+    = std::make_shared<Buffer>(getEngine(), storage.matrixData, !staticBuffer, 16, false, true);
+
+  setVerticesBuffer(storage.matrixBuffer->createVertexBuffer(VertexBuffer::World0Kind, 0, 4));
+  setVerticesBuffer(storage.matrixBuffer->createVertexBuffer(VertexBuffer::World1Kind, 4, 4));
+  setVerticesBuffer(storage.matrixBuffer->createVertexBuffer(VertexBuffer::World2Kind, 8, 4));
+  setVerticesBuffer(storage.matrixBuffer->createVertexBuffer(VertexBuffer::World3Kind, 12, 4));
+}
+
+void Mesh::_thinInstanceCreateAttributeBuffer(const std::string& kind, bool staticBuffer)
+{
+  auto& storage = *_userThinInstanceBuffersStorage;
+
+  if (storage.buffers[kind]) {
+    storage.buffers[kind]->dispose();
+  }
+
+  const auto stride     = storage.strides[kind];
+  storage.buffers[kind] = std::make_shared<Buffer>(getEngine(), storage.data[kind], !staticBuffer,
+                                                   stride, false, true);
+
+  setVerticesBuffer(storage.buffers[kind]->createVertexBuffer(kind, 0, stride));
+}
+
+void Mesh::_disposeThinInstanceSpecificData()
+{
+  if (_thinInstanceDataStorage->matrixBuffer) {
+    _thinInstanceDataStorage->matrixBuffer->dispose();
+    _thinInstanceDataStorage->matrixBuffer = nullptr;
+  }
+
+  if (_userThinInstanceBuffersStorage) {
+    for (const auto& item : _userThinInstanceBuffersStorage->buffers) {
+      if (item.second) {
+        item.second->dispose();
+      }
+    }
+    _userThinInstanceBuffersStorage = nullptr;
+  }
+}
+
 void Mesh::_rebuild()
 {
   if (_instanceDataStorage->instancesBuffer) {
@@ -1241,6 +1662,17 @@ void Mesh::_rebuild()
     _instanceDataStorage->instancesBuffer->dispose();
     _instanceDataStorage->instancesBuffer = nullptr;
   }
+  // The thin instance buffers are recreated from their CPU copy
+  if (_thinInstanceDataStorage->matrixBuffer) {
+    _thinInstanceCreateMatrixBuffer(!_thinInstanceDataStorage->matrixBuffer->isUpdatable());
+  }
+  if (_userThinInstanceBuffersStorage) {
+    for (const auto& item : _userThinInstanceBuffersStorage->buffers) {
+      if (item.second) {
+        _thinInstanceCreateAttributeBuffer(item.first, !item.second->isUpdatable());
+      }
+    }
+  }
   AbstractMesh::_rebuild();
 }
 
@@ -1840,6 +2272,23 @@ bool Mesh::_generatePointsArray()
   return false;
 }
 
+TriangleBVH* Mesh::_getTriangleBVH()
+{
+  // Line meshes are picked with their segments
+  if (_geometry && !_isLinesMesh) {
+    return _geometry->_getTriangleBVH();
+  }
+
+  return nullptr;
+}
+
+void Mesh::_resetTriangleBVH()
+{
+  if (_geometry) {
+    _geometry->_resetTriangleBVH();
+  }
+}
+
 MeshPtr Mesh::clone(const std::string& iName, Node* newParent, bool doNotCloneChildren,
                     bool clonePhysicsImpostor)
 {
@@ -1892,6 +2341,7 @@ void Mesh::dispose(bool doNotRecurse, bool disposeMaterialAndTextures)
 
   // Instances
   _disposeInstanceSpecificData();
+  _disposeThinInstanceSpecificData();
 
   AbstractMesh::dispose(doNotRecurse, disposeMaterialAndTextures);
 }
@@ -2412,6 +2862,20 @@ void Mesh::forceSharedVertices()
   }
 }
 
+Mesh& Mesh::simplify(const std::vector<ISimplificationSettings>& settings,
+                     bool parallelProcessing, SimplificationType simplificationType,
+                     const std::function<void()>& successCallback)
+{
+  getScene()->simplificationQueue()->addTask({
+    settings,           // settings
+    simplificationType, // simplificationType
+    this,               // mesh
+    successCallback,    // successCallback
+    parallelProcessing  // parallelProcessing
+  });
+  return *this;
+}
+
 InstancedMeshPtr Mesh::createInstance(const std::string& iName)
 {
   return InstancedMesh::New(iName, shared_from_base<Mesh>());
@@ -3447,50 +3911,31 @@ Mesh* Mesh::applySkeleton(const SkeletonPtr& iSkeleton)
   auto matricesWeightsExtraData
     = needExtras ? getVerticesData(VertexBuffer::MatricesWeightsExtraKind) : Float32Array();
 
-  auto skeletonMatrices = iSkeleton->getTransformMatrices(this);
-
-  auto tempVector3 = Vector3::Zero();
-  Matrix finalMatrix;
-  Matrix tempMatrix;
-
-  unsigned int matWeightIdx = 0;
-  unsigned int inf;
-  float weight;
-  for (unsigned int index = 0; index < positionsData.size(); index += 3, matWeightIdx += 4) {
-    for (inf = 0; inf < 4; ++inf) {
-      weight = matricesWeightsData[matWeightIdx + inf];
-      if (weight > 0.f) {
-        Matrix::FromFloat32ArrayToRefScaled(
-          skeletonMatrices,
-          static_cast<unsigned int>(std::floor(matricesIndicesData[matWeightIdx + inf] * 16)),
-          weight, tempMatrix);
-        finalMatrix.addToSelf(tempMatrix);
-      }
-    }
-    if (needExtras) {
-      for (inf = 0; inf < 4; ++inf) {
-        weight = matricesWeightsExtraData[matWeightIdx + inf];
-        if (weight > 0.f) {
-          Matrix::FromFloat32ArrayToRefScaled(skeletonMatrices,
-                                              static_cast<unsigned int>(std::floor(
-                                                matricesIndicesExtraData[matWeightIdx + inf] * 16)),
-                                              weight, tempMatrix);
-          finalMatrix.addToSelf(tempMatrix);
-        }
-      }
-    }
-
-    Vector3::TransformCoordinatesFromFloatsToRef(
-      internalDataInfo._sourcePositions[index], internalDataInfo._sourcePositions[index + 1],
-      internalDataInfo._sourcePositions[index + 2], finalMatrix, tempVector3);
-    tempVector3.toArray(positionsData, index);
+  const auto vertexCount = positionsData.size() / 3;
+  if (internalDataInfo._sourcePositions.size() < vertexCount * 3
+      || internalDataInfo._sourceNormals.size() < vertexCount * 3
+      || normalsData.size() < vertexCount * 3 || matricesIndicesData.size() < vertexCount * 4
+      || matricesWeightsData.size() < vertexCount * 4) {
+    return this;
+  }
 
-    Vector3::TransformNormalFromFloatsToRef(
-      internalDataInfo._sourceNormals[index], internalDataInfo._sourceNormals[index + 1],
-      internalDataInfo._sourceNormals[index + 2], finalMatrix, tempVector3);
-    tempVector3.toArray(normalsData, index);
+  SkinnedVertexData skinnedData;
+  skinnedData.vertexCount     = vertexCount;
+  skinnedData.sourcePositions = internalDataInfo._sourcePositions.data();
+  skinnedData.sourceNormals   = internalDataInfo._sourceNormals.data();
+  skinnedData.positions       = positionsData.data();
+  skinnedData.normals         = normalsData.data();
 
-    finalMatrix.reset();
+  const auto& skeletonMatrices = iSkeleton->getTransformMatrices(this);
+  if (needExtras && matricesIndicesExtraData.size() >= vertexCount * 4
+      && matricesWeightsExtraData.size() >= vertexCount * 4) {
+    SoftwareSkinning::Skin8(skinnedData, skeletonMatrices, matricesIndicesData.data(),
+                            matricesWeightsData.data(), matricesIndicesExtraData.data(),
+                            matricesWeightsExtraData.data(), &JobPool::Default());
+  }
+  else {
+    SoftwareSkinning::Skin4(skinnedData, skeletonMatrices, matricesIndicesData.data(),
+                            matricesWeightsData.data(), &JobPool::Default());
   }
 
   updateVerticesData(VertexBuffer::PositionKind, positionsData);
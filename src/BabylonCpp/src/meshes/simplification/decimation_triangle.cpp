@@ -2,12 +2,13 @@
 
 namespace BABYLON {
 
-DecimationTriangle::DecimationTriangle(
-  const std::vector<DecimationVertex>& iVertices)
-    : deleted{false}
+DecimationTriangle::DecimationTriangle(const std::array<DecimationVertex*, 3>& iVertices)
+    : error{{0.f, 0.f, 0.f, 0.f}}
+    , deleted{false}
     , isDirty{false}
     , borderFactor{0}
     , deletePending{false}
+    , originalOffset{0}
     , vertices{iVertices}
 {
 }
@@ -0,0 +1,610 @@
+#include <babylon/meshes/simplification/quadratic_error_simplification.h>
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+#include <babylon/asio/internal/sync_callback_runner.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/sub_mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+
+namespace BABYLON {
+
+namespace {
+
+/**
+ * Cell of the grid used to find the vertices sharing the same position
+ */
+struct VertexCell {
+  int64_t x, y, z;
+
+  bool operator==(const VertexCell& other) const
+  {
+    return x == other.x && y == other.y && z == other.z;
+  }
+}; // end of struct VertexCell
+
+struct VertexCellHash {
+  size_t operator()(const VertexCell& cell) const
+  {
+    return std::hash<int64_t>{}((cell.x * 73856093) ^ (cell.y * 19349663) ^ (cell.z * 83492791));
+  }
+}; // end of struct VertexCellHash
+
+} // end of anonymous namespace
+
+QuadraticErrorSimplification::QuadraticErrorSimplification(Mesh* mesh)
+    : aggressiveness{7.f}
+    , decimationIterations{100}
+    , vertexMergeEpsilon{0.0001f}
+    , _mesh{mesh}
+{
+}
+
+QuadraticErrorSimplification::~QuadraticErrorSimplification() = default;
+
+void QuadraticErrorSimplification::simplify(
+  const ISimplificationSettings& settings,
+  const std::function<void(const MeshPtr& simplifiedMesh)>& successCallback)
+{
+  _copyMeshData();
+
+  // The callback is moved out of the background job before it completes, so
+  // that the job does not keep the simplifier alive
+  _decimation
+    = std::async(std::launch::async, [this, settings, callback = successCallback]() mutable {
+        _decimate(settings);
+        asio::sync_callback_runner::PushCallback([this, callback = std::move(callback)]() {
+          callback(_createSimplifiedMesh());
+        });
+      });
+}
+
+void QuadraticErrorSimplification::_copyMeshData()
+{
+  _positionData = _mesh->getVerticesData(VertexBuffer::PositionKind);
+  _normalData   = _mesh->getVerticesData(VertexBuffer::NormalKind);
+  _uvs          = _mesh->getVerticesData(VertexBuffer::UVKind);
+  _colorsData   = _mesh->getVerticesData(VertexBuffer::ColorKind);
+  _indices      = _mesh->getIndices();
+
+  _subMeshes.clear();
+  for (const auto& subMesh : _mesh->subMeshes) {
+    _subMeshes.emplace_back(SubMeshRange{subMesh->materialIndex, subMesh->verticesStart,
+                                         subMesh->verticesCount, subMesh->indexStart,
+                                         subMesh->indexCount});
+  }
+}
+
+void QuadraticErrorSimplification::_decimate(const ISimplificationSettings& settings)
+{
+  _newPositionData.clear();
+  _newNormalData.clear();
+  _newUVsData.clear();
+  _newColorsData.clear();
+  _newIndices.clear();
+  _newSubMeshes.clear();
+
+  // Iterating through the submeshes array, one after the other
+  for (size_t submeshIndex = 0; submeshIndex < _subMeshes.size(); ++submeshIndex) {
+    initWithMesh(submeshIndex, settings.optimizeMesh);
+    runDecimation(settings, submeshIndex);
+  }
+
+  // Release the decimation state
+  _triangles  = std::vector<DecimationTriangle>();
+  _vertices   = std::vector<DecimationVertex>();
+  _references = std::vector<Reference>();
+}
+
+MeshPtr QuadraticErrorSimplification::_createSimplifiedMesh()
+{
+  auto reconstructedMesh              = Mesh::New(_mesh->name + "Decimated", _mesh->getScene());
+  reconstructedMesh->material         = _mesh->material();
+  reconstructedMesh->parent           = _mesh->parent();
+  reconstructedMesh->isVisible        = false;
+  reconstructedMesh->renderingGroupId = _mesh->renderingGroupId();
+
+  if (!_newIndices.empty()) {
+    reconstructedMesh->setVerticesData(VertexBuffer::PositionKind, _newPositionData);
+    if (!_newNormalData.empty()) {
+      reconstructedMesh->setVerticesData(VertexBuffer::NormalKind, _newNormalData);
+    }
+    if (!_newUVsData.empty()) {
+      reconstructedMesh->setVerticesData(VertexBuffer::UVKind, _newUVsData);
+    }
+    if (!_newColorsData.empty()) {
+      reconstructedMesh->setVerticesData(VertexBuffer::ColorKind, _newColorsData);
+    }
+    reconstructedMesh->setIndices(_newIndices);
+
+    // Create the submeshes
+    if (_newSubMeshes.size() > 1) {
+      reconstructedMesh->subMeshes.clear();
+      for (const auto& subMesh : _newSubMeshes) {
+        SubMesh::AddToMesh(subMesh.materialIndex, subMesh.verticesStart, subMesh.verticesCount,
+                           subMesh.indexStart, subMesh.indexCount, reconstructedMesh);
+      }
+    }
+  }
+
+  // The decimated data now lives in the vertex buffers of the mesh
+  _newPositionData = Float32Array();
+  _newNormalData   = Float32Array();
+  _newUVsData      = Float32Array();
+  _newColorsData   = Float32Array();
+  _newIndices      = IndicesArray();
+
+  return reconstructedMesh;
+}
+
+void QuadraticErrorSimplification::runDecimation(const ISimplificationSettings& settings,
+                                                 size_t submeshIndex)
+{
+  const auto triangleCount = _triangles.size();
+  const auto targetCount
+    = static_cast<size_t>(static_cast<float>(triangleCount) * settings.quality);
+  size_t deletedTriangles = 0;
+
+  // Buffers reused for every collapsed edge
+  std::vector<bool> deleted0, deleted1;
+  std::vector<DecimationTriangle*> delTr, uniqueArray;
+  Vector3 p;
+
+  for (size_t iteration = 0;
+       iteration < decimationIterations && triangleCount - deletedTriangles > targetCount;
+       ++iteration) {
+    if (iteration % 5 == 0) {
+      updateMesh(iteration == 0);
+    }
+
+    for (auto& triangle : _triangles) {
+      triangle.isDirty = false;
+    }
+
+    const auto threshold
+      = 0.000000001f * std::pow(static_cast<float>(iteration + 3), aggressiveness);
+    const auto nbTriangles = _triangles.size();
+
+    for (size_t i = 0; i < nbTriangles && triangleCount - deletedTriangles > targetCount; ++i) {
+      auto& t = _triangles[(nbTriangles / 2 + i) % nbTriangles];
+      if (t.error[3] > threshold || t.deleted || t.isDirty) {
+        continue;
+      }
+      for (size_t j = 0; j < 3; ++j) {
+        if (t.error[j] < threshold) {
+          auto v0 = t.vertices[j];
+          auto v1 = t.vertices[(j + 1) % 3];
+
+          if (v0->isBorder || v1->isBorder) {
+            continue;
+          }
+
+          calculateError(*v0, *v1, &p);
+
+          delTr.clear();
+
+          if (isFlipped(*v0, *v1, p, deleted0, delTr)) {
+            continue;
+          }
+          if (isFlipped(*v1, *v0, p, deleted1, delTr)) {
+            continue;
+          }
+
+          if (std::find(deleted0.begin(), deleted0.end(), true) == deleted0.end()
+              || std::find(deleted1.begin(), deleted1.end(), true) == deleted1.end()) {
+            continue;
+          }
+
+          uniqueArray.clear();
+          for (auto deletedT : delTr) {
+            if (std::find(uniqueArray.begin(), uniqueArray.end(), deletedT) == uniqueArray.end()) {
+              deletedT->deletePending = true;
+              uniqueArray.emplace_back(deletedT);
+            }
+          }
+
+          if (uniqueArray.size() % 2 != 0) {
+            continue;
+          }
+
+          v0->q = v1->q.add(v0->q);
+
+          v0->updatePosition(p);
+
+          const auto tStart = _references.size();
+
+          deletedTriangles = updateTriangles(v0, *v0, deleted0, deletedTriangles);
+          deletedTriangles = updateTriangles(v0, *v1, deleted1, deletedTriangles);
+
+          const auto tCount = _references.size() - tStart;
+
+          if (tCount <= static_cast<size_t>(v0->triangleCount)) {
+            // Reuse the range of the vertex, the new references are released
+            std::copy(_references.begin() + static_cast<std::ptrdiff_t>(tStart), _references.end(),
+                      _references.begin() + v0->triangleStart);
+            _references.erase(_references.begin() + static_cast<std::ptrdiff_t>(tStart),
+                              _references.end());
+          }
+          else {
+            v0->triangleStart = static_cast<int>(tStart);
+          }
+
+          v0->triangleCount = static_cast<int>(tCount);
+          break;
+        }
+      }
+    }
+  }
+
+  // Reconstruct this part of the mesh
+  reconstructMesh(submeshIndex);
+}
+
+void QuadraticErrorSimplification::initWithMesh(size_t submeshIndex, bool optimizeMesh)
+{
+  _vertices.clear();
+  _triangles.clear();
+  _references.clear();
+
+  const auto& submesh = _subMeshes[submeshIndex];
+  if (_positionData.empty() || _indices.empty()) {
+    return;
+  }
+
+  // Grid of the vertices, used to merge the vertices sharing the same position
+  // without comparing every pair of vertices
+  std::unordered_map<VertexCell, size_t, VertexCellHash> vertexCells;
+  const auto toCell = [this](const Vector3& position) {
+    return VertexCell{static_cast<int64_t>(std::floor(position.x / vertexMergeEpsilon)),
+                      static_cast<int64_t>(std::floor(position.y / vertexMergeEpsilon)),
+                      static_cast<int64_t>(std::floor(position.z / vertexMergeEpsilon))};
+  };
+  const auto findInVertices = [&](const Vector3& positionToSearch, const VertexCell& cell) {
+    for (int64_t x = -1; x <= 1; ++x) {
+      for (int64_t y = -1; y <= 1; ++y) {
+        for (int64_t z = -1; z <= 1; ++z) {
+          const auto it = vertexCells.find(VertexCell{cell.x + x, cell.y + y, cell.z + z});
+          if (it != vertexCells.end()
+              && _vertices[it->second].position.equalsWithEpsilon(positionToSearch,
+                                                                  vertexMergeEpsilon)) {
+            return it->second;
+          }
+        }
+      }
+    }
+    return _vertices.size();
+  };
+
+  // The vertices are referenced by the triangles, the storage must not grow
+  // once the triangles are created
+  const auto totalVertices = submesh.verticesCount;
+  _vertices.reserve(totalVertices);
+  if (optimizeMesh) {
+    vertexCells.reserve(totalVertices);
+  }
+
+  std::vector<size_t> vertexReferences(totalVertices);
+  for (size_t i = 0; i < totalVertices; ++i) {
+    const auto offset   = i + submesh.verticesStart;
+    const auto position = Vector3::FromArray(_positionData, static_cast<unsigned int>(offset * 3));
+    auto id             = _vertices.size();
+    if (optimizeMesh) {
+      const auto cell = toCell(position);
+      id              = findInVertices(position, cell);
+      if (id == _vertices.size()) {
+        vertexCells[cell] = id;
+      }
+    }
+    if (id == _vertices.size()) {
+      _vertices.emplace_back(DecimationVertex(position, static_cast<int>(id)));
+    }
+    _vertices[id].originalOffsets.emplace_back(offset);
+    vertexReferences[i] = id;
+  }
+
+  const auto totalTriangles = submesh.indexCount / 3;
+  _triangles.reserve(totalTriangles);
+  for (size_t i = 0; i < totalTriangles; ++i) {
+    const auto pos = submesh.indexStart + i * 3;
+    auto v0        = &_vertices[vertexReferences[_indices[pos + 0] - submesh.verticesStart]];
+    auto v1        = &_vertices[vertexReferences[_indices[pos + 1] - submesh.verticesStart]];
+    auto v2        = &_vertices[vertexReferences[_indices[pos + 2] - submesh.verticesStart]];
+    _triangles.emplace_back(DecimationTriangle(std::array<DecimationVertex*, 3>{{v0, v1, v2}}));
+    _triangles.back().originalOffset = pos;
+  }
+
+  init();
+}
+
+void QuadraticErrorSimplification::init()
+{
+  for (auto& t : _triangles) {
+    t.normal = Vector3::Cross(t.vertices[1]->position.subtract(t.vertices[0]->position),
+                              t.vertices[2]->position.subtract(t.vertices[0]->position))
+                 .normalize();
+    const auto data = QuadraticMatrix::DataFromNumbers(
+      t.normal.x, t.normal.y, t.normal.z, -(Vector3::Dot(t.normal, t.vertices[0]->position)));
+    for (auto vertex : t.vertices) {
+      vertex->q.addArrayInPlace(data);
+    }
+  }
+
+  for (auto& t : _triangles) {
+    for (size_t j = 0; j < 3; ++j) {
+      t.error[j] = calculateError(*t.vertices[j], *t.vertices[(j + 1) % 3]);
+    }
+    t.error[3] = std::min({t.error[0], t.error[1], t.error[2]});
+  }
+}
+
+void QuadraticErrorSimplification::reconstructMesh(size_t submeshIndex)
+{
+  for (auto& vertex : _vertices) {
+    vertex.triangleCount = 0;
+  }
+
+  std::vector<const DecimationTriangle*> newTriangles;
+  for (const auto& t : _triangles) {
+    if (!t.deleted) {
+      for (auto vertex : t.vertices) {
+        vertex->triangleCount = 1;
+      }
+      newTriangles.emplace_back(&t);
+    }
+  }
+
+  const auto startingIndex  = _newIndices.size();
+  const auto startingVertex = _newPositionData.size() / 3;
+
+  size_t vertexCount = 0;
+  for (auto& vertex : _vertices) {
+    vertex.id = static_cast<int>(vertexCount);
+    if (vertex.triangleCount) {
+      for (const auto originalOffset : vertex.originalOffsets) {
+        _newPositionData.emplace_back(vertex.position.x);
+        _newPositionData.emplace_back(vertex.position.y);
+        _newPositionData.emplace_back(vertex.position.z);
+        if (!_normalData.empty()) {
+          _newNormalData.emplace_back(_normalData[originalOffset * 3]);
+          _newNormalData.emplace_back(_normalData[originalOffset * 3 + 1]);
+          _newNormalData.emplace_back(_normalData[originalOffset * 3 + 2]);
+        }
+        if (!_uvs.empty()) {
+          _newUVsData.emplace_back(_uvs[originalOffset * 2]);
+          _newUVsData.emplace_back(_uvs[originalOffset * 2 + 1]);
+        }
+        if (!_colorsData.empty()) {
+          _newColorsData.emplace_back(_colorsData[originalOffset * 4]);
+          _newColorsData.emplace_back(_colorsData[originalOffset * 4 + 1]);
+          _newColorsData.emplace_back(_colorsData[originalOffset * 4 + 2]);
+          _newColorsData.emplace_back(_colorsData[originalOffset * 4 + 3]);
+        }
+        ++vertexCount;
+      }
+    }
+  }
+
+  // Now get the new referencing point for each vertex
+  for (const auto t : newTriangles) {
+    for (size_t idx = 0; idx < 3; ++idx) {
+      const auto id               = _indices[t->originalOffset + idx];
+      const auto& originalOffsets = t->vertices[idx]->originalOffsets;
+      const auto it     = std::find(originalOffsets.begin(), originalOffsets.end(), id);
+      const auto offset = it == originalOffsets.end() ?
+                            0 :
+                            static_cast<size_t>(std::distance(originalOffsets.begin(), it));
+      _newIndices.emplace_back(
+        static_cast<uint32_t>(static_cast<size_t>(t->vertices[idx]->id) + offset + startingVertex));
+    }
+  }
+
+  const auto& originalSubmesh = _subMeshes[submeshIndex];
+  _newSubMeshes.emplace_back(SubMeshRange{originalSubmesh.materialIndex,
+                                          static_cast<unsigned int>(startingVertex), vertexCount,
+                                          static_cast<unsigned int>(startingIndex),
+                                          newTriangles.size() * 3});
+}
+
+bool QuadraticErrorSimplification::isFlipped(const DecimationVertex& vertex1,
+                                             const DecimationVertex& vertex2, const Vector3& point,
+                                             std::vector<bool>& deletedArray,
+                                             std::vector<DecimationTriangle*>& delTr)
+{
+  deletedArray.assign(static_cast<size_t>(vertex1.triangleCount), false);
+
+  for (size_t i = 0; i < deletedArray.size(); ++i) {
+    const auto& ref = _references[static_cast<size_t>(vertex1.triangleStart) + i];
+    auto& t         = _triangles[static_cast<size_t>(ref.triangleId)];
+    if (t.deleted) {
+      continue;
+    }
+
+    const auto s  = static_cast<size_t>(ref.vertexId);
+    const auto v1 = t.vertices[(s + 1) % 3];
+    const auto v2 = t.vertices[(s + 2) % 3];
+
+    if (v1 == &vertex2 || v2 == &vertex2) {
+      deletedArray[i] = true;
+      delTr.emplace_back(&t);
+      continue;
+    }
+
+    auto d1 = v1->position.subtract(point);
+    d1.normalize();
+    auto d2 = v2->position.subtract(point);
+    d2.normalize();
+    if (std::abs(Vector3::Dot(d1, d2)) > 0.999f) {
+      return true;
+    }
+    auto normal = Vector3::Cross(d1, d2);
+    normal.normalize();
+    deletedArray[i] = false;
+    if (Vector3::Dot(normal, t.normal) < 0.2f) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+size_t QuadraticErrorSimplification::updateTriangles(DecimationVertex* origVertex,
+                                                     const DecimationVertex& vertex,
+                                                     const std::vector<bool>& deletedArray,
+                                                     size_t deletedTriangles)
+{
+  auto newDeleted = deletedTriangles;
+  for (size_t i = 0; i < static_cast<size_t>(vertex.triangleCount); ++i) {
+    // Copied, the references may be reallocated below
+    const auto ref = _references[static_cast<size_t>(vertex.triangleStart) + i];
+    auto& t        = _triangles[static_cast<size_t>(ref.triangleId)];
+    if (t.deleted) {
+      continue;
+    }
+    if (deletedArray[i] && t.deletePending) {
+      t.deleted = true;
+      ++newDeleted;
+      continue;
+    }
+    t.vertices[static_cast<size_t>(ref.vertexId)] = origVertex;
+    t.isDirty                                     = true;
+    t.error[0] = calculateError(*t.vertices[0], *t.vertices[1]) + (t.borderFactor / 2.f);
+    t.error[1] = calculateError(*t.vertices[1], *t.vertices[2]) + (t.borderFactor / 2.f);
+    t.error[2] = calculateError(*t.vertices[2], *t.vertices[0]) + (t.borderFactor / 2.f);
+    t.error[3] = std::min({t.error[0], t.error[1], t.error[2]});
+    _references.emplace_back(ref);
+  }
+  return newDeleted;
+}
+
+void QuadraticErrorSimplification::identifyBorder()
+{
+  std::vector<int> vCount;
+  std::vector<int> vId;
+  for (auto& v : _vertices) {
+    vCount.clear();
+    vId.clear();
+    for (size_t j = 0; j < static_cast<size_t>(v.triangleCount); ++j) {
+      const auto& triangle
+        = _triangles[static_cast<size_t>(_references[v.triangleStart + j].triangleId)];
+      for (const auto vv : triangle.vertices) {
+        size_t ofs = 0;
+        while (ofs < vCount.size()) {
+          if (vId[ofs] == vv->id) {
+            break;
+          }
+          ++ofs;
+        }
+        if (ofs == vCount.size()) {
+          vCount.emplace_back(1);
+          vId.emplace_back(vv->id);
+        }
+        else {
+          ++vCount[ofs];
+        }
+      }
+    }
+
+    for (size_t j = 0; j < vCount.size(); ++j) {
+      _vertices[static_cast<size_t>(vId[j])].isBorder = (vCount[j] == 1);
+    }
+  }
+}
+
+void QuadraticErrorSimplification::updateMesh(bool identifyBorders)
+{
+  if (!identifyBorders) {
+    _triangles.erase(std::remove_if(_triangles.begin(), _triangles.end(),
+                                    [](const DecimationTriangle& t) { return t.deleted; }),
+                     _triangles.end());
+  }
+
+  for (auto& v : _vertices) {
+    v.triangleCount = 0;
+    v.triangleStart = 0;
+  }
+
+  for (const auto& t : _triangles) {
+    for (auto v : t.vertices) {
+      ++v->triangleCount;
+    }
+  }
+
+  int tStart = 0;
+  for (auto& v : _vertices) {
+    v.triangleStart = tStart;
+    tStart += v.triangleCount;
+    v.triangleCount = 0;
+  }
+
+  _references.assign(_triangles.size() * 3, Reference(0, 0));
+  for (size_t i = 0; i < _triangles.size(); ++i) {
+    const auto& t = _triangles[i];
+    for (size_t j = 0; j < 3; ++j) {
+      auto v = t.vertices[j];
+      _references[static_cast<size_t>(v->triangleStart + v->triangleCount)]
+        = Reference(static_cast<int>(j), static_cast<int>(i));
+      ++v->triangleCount;
+    }
+  }
+
+  if (identifyBorders) {
+    identifyBorder();
+  }
+}
+
+float QuadraticErrorSimplification::vertexError(const QuadraticMatrix& q,
+                                                const Vector3& point) const
+{
+  const auto x = point.x;
+  const auto y = point.y;
+  const auto z = point.z;
+  return q.data[0] * x * x + 2.f * q.data[1] * x * y + 2.f * q.data[2] * x * z
+         + 2.f * q.data[3] * x + q.data[4] * y * y + 2.f * q.data[5] * y * z + 2.f * q.data[6] * y
+         + q.data[7] * z * z + 2.f * q.data[8] * z + q.data[9];
+}
+
+float QuadraticErrorSimplification::calculateError(const DecimationVertex& vertex1,
+                                                   const DecimationVertex& vertex2,
+                                                   Vector3* pointResult) const
+{
+  const auto q      = vertex1.q.add(vertex2.q);
+  const auto border = vertex1.isBorder && vertex2.isBorder;
+  auto error        = 0.f;
+  const auto qDet   = q.det(0, 1, 2, 1, 4, 5, 2, 5, 7);
+
+  if (qDet != 0.f && !border) {
+    Vector3 point;
+    point.x = -1.f / qDet * (q.det(1, 2, 3, 4, 5, 6, 5, 7, 8));
+    point.y = 1.f / qDet * (q.det(0, 2, 3, 1, 5, 6, 2, 7, 8));
+    point.z = -1.f / qDet * (q.det(0, 1, 3, 1, 4, 6, 2, 5, 8));
+    error   = vertexError(q, point);
+    if (pointResult) {
+      pointResult->copyFrom(point);
+    }
+  }
+  else {
+    const auto p3     = (vertex1.position.add(vertex2.position)).scale(0.5f);
+    const auto error1 = vertexError(q, vertex1.position);
+    const auto error2 = vertexError(q, vertex2.position);
+    const auto error3 = vertexError(q, p3);
+    error             = std::min({error1, error2, error3});
+    if (pointResult) {
+      if (error == error1) {
+        pointResult->copyFrom(vertex1.position);
+      }
+      else if (error == error2) {
+        pointResult->copyFrom(vertex2.position);
+      }
+      else {
+        pointResult->copyFrom(p3);
+      }
+    }
+  }
+
+  return error;
+}
+
+} // end of namespace BABYLON
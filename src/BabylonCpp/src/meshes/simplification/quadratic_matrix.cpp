@@ -23,9 +23,9 @@ QuadraticMatrix& QuadraticMatrix::operator=(QuadraticMatrix&& other) = default;
 
 QuadraticMatrix::~QuadraticMatrix() = default;
 
-float QuadraticMatrix::det(unsigned int a11, unsigned int a12, int unsigned a13,
+float QuadraticMatrix::det(unsigned int a11, unsigned int a12, unsigned int a13,
                            unsigned int a21, unsigned int a22, unsigned int a23,
-                           unsigned int a31, unsigned int a32, unsigned int a33)
+                           unsigned int a31, unsigned int a32, unsigned int a33) const
 {
   return data[a11] * data[a22] * data[a33] + data[a13] * data[a21] * data[a32]
          + data[a12] * data[a23] * data[a31] - data[a13] * data[a22] * data[a31]
@@ -47,7 +47,7 @@ void QuadraticMatrix::addArrayInPlace(const std::array<float, 10>& _data)
   }
 }
 
-QuadraticMatrix QuadraticMatrix::add(const QuadraticMatrix& matrix)
+QuadraticMatrix QuadraticMatrix::add(const QuadraticMatrix& matrix) const
 {
   QuadraticMatrix m;
   for (unsigned int i = 0; i < 10; ++i) {
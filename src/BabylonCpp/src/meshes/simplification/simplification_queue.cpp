@@ -1,5 +1,7 @@
 #include <babylon/meshes/simplification/simplification_queue.h>
 
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/simplification/quadratic_error_simplification.h>
 #include <babylon/meshes/simplification/simplification_settings.h>
 
 namespace BABYLON {
@@ -18,8 +20,8 @@ void SimplificationQueue::addTask(const ISimplificationTask& task)
 void SimplificationQueue::executeNext()
 {
   if (!_simplificationQueue.empty()) {
-    running                         = true;
-    const ISimplificationTask& task = _simplificationQueue.front();
+    running   = true;
+    auto task = _simplificationQueue.front();
     _simplificationQueue.pop();
     runSimplification(task);
   }
@@ -28,18 +30,59 @@ void SimplificationQueue::executeNext()
   }
 }
 
-void SimplificationQueue::runSimplification(const ISimplificationTask& /*task*/)
+void SimplificationQueue::runSimplification(const ISimplificationTask& task)
 {
+  if (task.parallelProcessing && !task.settings.empty()) {
+    // Parallel simplifier
+    auto remaining = std::make_shared<size_t>(task.settings.size());
+    for (const auto& setting : task.settings) {
+      auto simplifier = getSimplifier(task);
+      simplifier->simplify(
+        setting, [this, task, setting, simplifier, remaining](const MeshPtr& newMesh) {
+          task.mesh->addLODLevel(setting.distance, newMesh);
+          newMesh->isVisible = true;
+          // Check if it is the last
+          if (--(*remaining) == 0) {
+            // All done, run the success callback
+            if (task.successCallback) {
+              task.successCallback();
+            }
+            executeNext();
+          }
+        });
+    }
+  }
+  else {
+    // Single simplifier
+    runDecimation(getSimplifier(task), task, 0);
+  }
+}
+
+void SimplificationQueue::runDecimation(const ISimplifierPtr& simplifier,
+                                        const ISimplificationTask& task, size_t settingIndex)
+{
+  if (settingIndex >= task.settings.size()) {
+    if (task.successCallback) {
+      task.successCallback();
+    }
+    executeNext();
+    return;
+  }
+
+  simplifier->simplify(task.settings[settingIndex],
+                       [this, simplifier, task, settingIndex](const MeshPtr& newMesh) {
+                         task.mesh->addLODLevel(task.settings[settingIndex].distance, newMesh);
+                         newMesh->isVisible = true;
+                         runDecimation(simplifier, task, settingIndex + 1);
+                       });
 }
 
-ISimplifier* SimplificationQueue::getSimplifier(const ISimplificationTask& task)
+ISimplifierPtr SimplificationQueue::getSimplifier(const ISimplificationTask& task)
 {
   switch (task.simplificationType) {
     case SimplificationType::QUADRATIC:
     default:
-      // TODO FIXME
-      return nullptr;
-      // return new QuadraticErrorSimplification(task.mesh);
+      return std::make_shared<QuadraticErrorSimplification>(task.mesh);
   }
 }
 
@@ -0,0 +1,210 @@
+#include <babylon/meshes/software_skinning.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+#include <babylon/misc/job_pool.h>
+
+#if defined(OPTION_ENABLE_SIMD) && (defined(__SSE__) || defined(_M_X64))
+#define BABYLON_SOFTWARE_SKINNING_USE_SSE
+#include <xmmintrin.h>
+#endif
+
+namespace BABYLON {
+
+namespace {
+
+/**
+ * Bone influences of a vertex: up to 2 groups of 4 indices and weights.
+ */
+struct Influences {
+  const float* indices[2];
+  const float* weights[2];
+  size_t nbGroups;
+};
+
+void RunRange(size_t count, size_t grainSize, JobPool* jobPool,
+              const std::function<void(size_t begin, size_t end)>& job)
+{
+  if (!jobPool || count <= grainSize) {
+    job(0, count);
+    return;
+  }
+  jobPool->parallelFor(count, grainSize, job);
+}
+
+#ifdef BABYLON_SOFTWARE_SKINNING_USE_SSE
+
+void SkinRange(const SkinnedVertexData& data, const Float32Array& boneMatrices,
+               const Influences& influences, size_t begin, size_t end)
+{
+  const auto nbBoneFloats = boneMatrices.size();
+  alignas(16) float result[4];
+  for (auto vertex = begin; vertex < end; ++vertex) {
+    // Weighted sum of the rows of the bone matrices
+    auto row0 = _mm_setzero_ps();
+    auto row1 = _mm_setzero_ps();
+    auto row2 = _mm_setzero_ps();
+    auto row3 = _mm_setzero_ps();
+    for (size_t group = 0; group < influences.nbGroups; ++group) {
+      const auto indices = influences.indices[group] + vertex * 4;
+      const auto weights = influences.weights[group] + vertex * 4;
+      for (size_t inf = 0; inf < 4; ++inf) {
+        const auto weight = weights[inf];
+        if (!(weight > 0.f)) {
+          continue;
+        }
+        const auto offset = static_cast<size_t>(std::floor(indices[inf])) * 16;
+        if (offset + 16 > nbBoneFloats) {
+          continue;
+        }
+        const auto m  = &boneMatrices[offset];
+        const auto ws = _mm_set1_ps(weight);
+        row0          = _mm_add_ps(row0, _mm_mul_ps(ws, _mm_loadu_ps(m)));
+        row1          = _mm_add_ps(row1, _mm_mul_ps(ws, _mm_loadu_ps(m + 4)));
+        row2          = _mm_add_ps(row2, _mm_mul_ps(ws, _mm_loadu_ps(m + 8)));
+        row3          = _mm_add_ps(row3, _mm_mul_ps(ws, _mm_loadu_ps(m + 12)));
+      }
+    }
+
+    // Positions are transformed as coordinates (divided by w)
+    {
+      const auto source = data.sourcePositions + vertex * 3;
+      auto position     = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(source[0]), row0), row3);
+      position          = _mm_add_ps(position, _mm_mul_ps(_mm_set1_ps(source[1]), row1));
+      position          = _mm_add_ps(position, _mm_mul_ps(_mm_set1_ps(source[2]), row2));
+      _mm_store_ps(result, position);
+      const auto rw   = 1.f / result[3];
+      const auto dest = data.positions + vertex * 3;
+      dest[0]         = result[0] * rw;
+      dest[1]         = result[1] * rw;
+      dest[2]         = result[2] * rw;
+    }
+
+    // Normals and tangents are transformed as directions
+    const auto transformDirection = [&](const float* source, float* dest) {
+      auto direction = _mm_mul_ps(_mm_set1_ps(source[0]), row0);
+      direction      = _mm_add_ps(direction, _mm_mul_ps(_mm_set1_ps(source[1]), row1));
+      direction      = _mm_add_ps(direction, _mm_mul_ps(_mm_set1_ps(source[2]), row2));
+      _mm_store_ps(result, direction);
+      dest[0] = result[0];
+      dest[1] = result[1];
+      dest[2] = result[2];
+    };
+    if (data.normals) {
+      transformDirection(data.sourceNormals + vertex * 3, data.normals + vertex * 3);
+    }
+    if (data.tangents) {
+      transformDirection(data.sourceTangents + vertex * 4, data.tangents + vertex * 4);
+      data.tangents[vertex * 4 + 3] = data.sourceTangents[vertex * 4 + 3];
+    }
+  }
+}
+
+#else
+
+void SkinRange(const SkinnedVertexData& data, const Float32Array& boneMatrices,
+               const Influences& influences, size_t begin, size_t end)
+{
+  const auto nbBoneFloats = boneMatrices.size();
+  float m[16];
+  for (auto vertex = begin; vertex < end; ++vertex) {
+    // Weighted sum of the bone matrices
+    std::fill(m, m + 16, 0.f);
+    for (size_t group = 0; group < influences.nbGroups; ++group) {
+      const auto indices = influences.indices[group] + vertex * 4;
+      const auto weights = influences.weights[group] + vertex * 4;
+      for (size_t inf = 0; inf < 4; ++inf) {
+        const auto weight = weights[inf];
+        if (!(weight > 0.f)) {
+          continue;
+        }
+        const auto offset = static_cast<size_t>(std::floor(indices[inf])) * 16;
+        if (offset + 16 > nbBoneFloats) {
+          continue;
+        }
+        const auto bone = &boneMatrices[offset];
+        for (size_t index = 0; index < 16; ++index) {
+          m[index] += weight * bone[index];
+        }
+      }
+    }
+
+    // Positions are transformed as coordinates (divided by w)
+    {
+      const auto source = data.sourcePositions + vertex * 3;
+      const auto x      = source[0];
+      const auto y      = source[1];
+      const auto z      = source[2];
+      const auto rw     = 1.f / (x * m[3] + y * m[7] + z * m[11] + m[15]);
+      const auto dest   = data.positions + vertex * 3;
+      dest[0]           = (x * m[0] + y * m[4] + z * m[8] + m[12]) * rw;
+      dest[1]           = (x * m[1] + y * m[5] + z * m[9] + m[13]) * rw;
+      dest[2]           = (x * m[2] + y * m[6] + z * m[10] + m[14]) * rw;
+    }
+
+    // Normals and tangents are transformed as directions
+    const auto transformDirection = [&m](const float* source, float* dest) {
+      const auto x = source[0];
+      const auto y = source[1];
+      const auto z = source[2];
+      dest[0]      = x * m[0] + y * m[4] + z * m[8];
+      dest[1]      = x * m[1] + y * m[5] + z * m[9];
+      dest[2]      = x * m[2] + y * m[6] + z * m[10];
+    };
+    if (data.normals) {
+      transformDirection(data.sourceNormals + vertex * 3, data.normals + vertex * 3);
+    }
+    if (data.tangents) {
+      transformDirection(data.sourceTangents + vertex * 4, data.tangents + vertex * 4);
+      data.tangents[vertex * 4 + 3] = data.sourceTangents[vertex * 4 + 3];
+    }
+  }
+}
+
+#endif
+
+} // end of anonymous namespace
+
+void SoftwareSkinning::Skin4(const SkinnedVertexData& data, const Float32Array& boneMatrices,
+                             const float* matricesIndices, const float* matricesWeights,
+                             JobPool* jobPool)
+{
+  const Influences influences{{matricesIndices, nullptr}, {matricesWeights, nullptr}, 1};
+  RunRange(data.vertexCount, GrainSize, jobPool, [&](size_t begin, size_t end) {
+    SkinRange(data, boneMatrices, influences, begin, end);
+  });
+}
+
+void SoftwareSkinning::Skin8(const SkinnedVertexData& data, const Float32Array& boneMatrices,
+                             const float* matricesIndices, const float* matricesWeights,
+                             const float* matricesIndicesExtra,
+                             const float* matricesWeightsExtra, JobPool* jobPool)
+{
+  const Influences influences{
+    {matricesIndices, matricesIndicesExtra}, {matricesWeights, matricesWeightsExtra}, 2};
+  RunRange(data.vertexCount, GrainSize, jobPool, [&](size_t begin, size_t end) {
+    SkinRange(data, boneMatrices, influences, begin, end);
+  });
+}
+
+void SoftwareSkinning::Morph(const float* source, const std::vector<const float*>& targets,
+                             const float* influences, float* result, size_t floatCount,
+                             JobPool* jobPool)
+{
+  // Each chunk is blended target after target while it stays in the cache, the unit stride loops
+  // are vectorized by the compiler
+  RunRange(floatCount, GrainSize * 3, jobPool, [&](size_t begin, size_t end) {
+    std::copy(source + begin, source + end, result + begin);
+    for (size_t target = 0; target < targets.size(); ++target) {
+      const auto influence  = influences[target];
+      const auto targetData = targets[target];
+      for (auto index = begin; index < end; ++index) {
+        result[index] += influence * (targetData[index] - source[index]);
+      }
+    }
+  });
+}
+
+} // end of namespace BABYLON
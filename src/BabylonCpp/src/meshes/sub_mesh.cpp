@@ -3,6 +3,7 @@
 #include <babylon/babylon_stl_util.h>
 #include <babylon/collisions/intersection_info.h>
 #include <babylon/culling/bounding_info.h>
+#include <babylon/culling/bvh/triangle_bvh.h>
 #include <babylon/culling/ray.h>
 #include <babylon/engines/constants.h>
 #include <babylon/engines/engine.h>
@@ -14,8 +15,6 @@
 #include <babylon/maths/plane.h>
 #include <babylon/meshes/abstract_mesh.h>
 #include <babylon/meshes/geometry.h>
-#include <babylon/meshes/instanced_lines_mesh.h>
-#include <babylon/meshes/lines_mesh.h>
 #include <babylon/meshes/transform_node.h>
 #include <babylon/meshes/vertex_buffer.h>
 #include <babylon/misc/tools.h>
@@ -32,8 +31,8 @@ SubMesh::SubMesh(unsigned int iMaterialIndex, unsigned int iVerticesStart, size_
     , indexCount{iIndexCount}
     , createBoundingBox{iCreateBoundingBox}
     , _linesIndexCount{0}
-    , _lastColliderTransformMatrix{nullptr}
     , _renderId{0}
+    , _octreeSelectionId{0}
     , _alphaIndex{0}
     , _distanceToCamera{0.f}
     , _mesh{mesh}
@@ -122,8 +121,6 @@ MaterialPtr SubMesh::getMaterial()
 // Methods
 SubMesh& SubMesh::refreshBoundingInfo(const Float32Array& iData)
 {
-  _lastColliderWorldVertices.clear();
-
   if (isGlobal() || !_renderingMesh || !_renderingMesh->geometry()) {
     return *this;
   }
@@ -264,8 +261,8 @@ SubMesh::intersects(Ray& ray, const std::vector<Vector3>& positions, const Uint3
   }
 
   // LineMesh first as it's also a Mesh...
-  if (_mesh->getClassName() == "InstancedLinesMesh" || _mesh->getClassName() == "LinesMesh") {
-    auto intersectionThreshold = std::static_pointer_cast<LinesMesh>(_mesh)->intersectionThreshold;
+  if (_mesh->_isLinesMesh) {
+    const auto intersectionThreshold = _mesh->_getIntersectionThreshold();
     // Check if mesh is unindexed
     if (indices.empty()) {
       return _intersectUnIndexedLines(ray, positions, indices, intersectionThreshold, fastCheck);
@@ -347,6 +344,16 @@ SubMesh::_intersectTriangles(Ray& ray, const std::vector<Vector3>& positions,
   if (positions.empty())
     return std::nullopt;
 
+  // Large geometries are tested through the BVH of their triangles
+  if (const auto triangleBVH = _mesh->_getTriangleBVH()) {
+    return triangleBVH->intersects(ray, positions, indexStart, indexCount, fastCheck,
+                                   trianglePredicate);
+  }
+
+  if (indices.size() < indexStart + indexCount) {
+    return std::nullopt;
+  }
+
   std::optional<IntersectionInfo> intersectInfo = std::nullopt;
 
   // Triangles test
@@ -0,0 +1,347 @@
+#include <babylon/meshes/tangent_space_generator.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <babylon/babylon_stl_util.h>
+#include <babylon/misc/job_pool.h>
+
+namespace BABYLON {
+
+namespace {
+
+/**
+ * Normalizes a vector, leaving it unchanged when its length is (almost) zero.
+ */
+inline void Normalize(float& x, float& y, float& z)
+{
+  auto length = std::sqrt(x * x + y * y + z * z);
+  length      = stl_util::almost_equal(length, 0.f) ? 1.f : length;
+  x /= length;
+  y /= length;
+  z /= length;
+}
+
+} // end of anonymous namespace
+
+TangentSpaceGenerator::TangentSpaceGenerator(JobPool* jobPool)
+    : _jobPool{jobPool}
+    , _indicesData{nullptr}
+    , _nbIndices{0}
+    , _nbVertices{0}
+    , _topologyDirty{true}
+    , _faceNormalSign{1.f}
+    , _faceNormalsValid{false}
+    , _updateId{0}
+{
+}
+
+TangentSpaceGenerator::~TangentSpaceGenerator() = default;
+
+void TangentSpaceGenerator::markTopologyAsDirty()
+{
+  _topologyDirty = true;
+}
+
+void TangentSpaceGenerator::_parallelFor(
+  size_t count, const std::function<void(size_t begin, size_t end)>& job) const
+{
+  if (!_jobPool || count <= GrainSize) {
+    job(0, count);
+    return;
+  }
+  _jobPool->parallelFor(count, GrainSize, job);
+}
+
+void TangentSpaceGenerator::_updateTopology(const Uint32Array& indices, size_t nbVertices)
+{
+  if (!_topologyDirty && _indicesData == indices.data() && _nbIndices == indices.size()
+      && _nbVertices == nbVertices) {
+    return;
+  }
+
+  _indicesData      = indices.data();
+  _nbIndices        = indices.size();
+  _nbVertices       = nbVertices;
+  _topologyDirty    = false;
+  _faceNormalsValid = false;
+
+  // Count the faces around each vertex, a face using a vertex twice is listed twice as the face
+  // loop of VertexData::ComputeNormals accumulates it twice
+  const auto nbCorners = (indices.size() / 3) * 3;
+  _vertexFaceOffsets.assign(nbVertices + 1, 0);
+  for (size_t corner = 0; corner < nbCorners; ++corner) {
+    if (indices[corner] < nbVertices) {
+      ++_vertexFaceOffsets[indices[corner] + 1];
+    }
+  }
+  for (size_t vertex = 0; vertex < nbVertices; ++vertex) {
+    _vertexFaceOffsets[vertex + 1] += _vertexFaceOffsets[vertex];
+  }
+
+  // Fill the rows in increasing face order
+  _vertexFaces.resize(_vertexFaceOffsets.back());
+  Uint32Array cursors(_vertexFaceOffsets.begin(), _vertexFaceOffsets.end() - 1);
+  for (size_t corner = 0; corner < nbCorners; ++corner) {
+    if (indices[corner] < nbVertices) {
+      _vertexFaces[cursors[indices[corner]]++] = static_cast<uint32_t>(corner / 3);
+    }
+  }
+
+  _faceUpdateIds.clear();
+  _vertexUpdateIds.clear();
+}
+
+void TangentSpaceGenerator::_computeFaceNormal(const Float32Array& positions,
+                                               const Uint32Array& indices, size_t face)
+{
+  auto faceNormal = &_faceNormals[face * 3];
+  const auto i1   = indices[face * 3];
+  const auto i2   = indices[face * 3 + 1];
+  const auto i3   = indices[face * 3 + 2];
+  if (i1 >= _nbVertices || i2 >= _nbVertices || i3 >= _nbVertices) {
+    std::fill(faceNormal, faceNormal + 3, 0.f);
+    return;
+  }
+
+  // Same computation as VertexData::ComputeNormals: p1p2 x p3p2, normalized
+  const auto p1    = &positions[i1 * 3];
+  const auto p2    = &positions[i2 * 3];
+  const auto p3    = &positions[i3 * 3];
+  const auto p1p2x = p1[0] - p2[0];
+  const auto p1p2y = p1[1] - p2[1];
+  const auto p1p2z = p1[2] - p2[2];
+  const auto p3p2x = p3[0] - p2[0];
+  const auto p3p2y = p3[1] - p2[1];
+  const auto p3p2z = p3[2] - p2[2];
+
+  auto faceNormalx = _faceNormalSign * (p1p2y * p3p2z - p1p2z * p3p2y);
+  auto faceNormaly = _faceNormalSign * (p1p2z * p3p2x - p1p2x * p3p2z);
+  auto faceNormalz = _faceNormalSign * (p1p2x * p3p2y - p1p2y * p3p2x);
+  Normalize(faceNormalx, faceNormaly, faceNormalz);
+
+  faceNormal[0] = faceNormalx;
+  faceNormal[1] = faceNormaly;
+  faceNormal[2] = faceNormalz;
+}
+
+void TangentSpaceGenerator::_gatherNormal(Float32Array& normals, size_t vertex) const
+{
+  float x = 0.f, y = 0.f, z = 0.f;
+  for (auto row = _vertexFaceOffsets[vertex]; row < _vertexFaceOffsets[vertex + 1]; ++row) {
+    const auto faceNormal = &_faceNormals[_vertexFaces[row] * 3];
+    x += faceNormal[0];
+    y += faceNormal[1];
+    z += faceNormal[2];
+  }
+  Normalize(x, y, z);
+  normals[vertex * 3]     = x;
+  normals[vertex * 3 + 1] = y;
+  normals[vertex * 3 + 2] = z;
+}
+
+void TangentSpaceGenerator::computeNormals(const Float32Array& positions,
+                                           const Uint32Array& indices, Float32Array& normals,
+                                           bool useRightHandedSystem)
+{
+  const auto nbVertices = positions.size() / 3;
+  const auto nbFaces    = indices.size() / 3;
+  normals.resize(positions.size());
+  _updateTopology(indices, nbVertices);
+
+  // Face normals, then the sum of the normals of the faces around each vertex: the faces and the
+  // vertices are independent and split over the pool
+  _faceNormalSign = useRightHandedSystem ? -1.f : 1.f;
+  _faceNormals.resize(nbFaces * 3);
+  _parallelFor(nbFaces, [&](size_t begin, size_t end) {
+    for (auto face = begin; face < end; ++face) {
+      _computeFaceNormal(positions, indices, face);
+    }
+  });
+  _parallelFor(nbVertices, [&](size_t begin, size_t end) {
+    for (auto vertex = begin; vertex < end; ++vertex) {
+      _gatherNormal(normals, vertex);
+    }
+  });
+  _faceNormalsValid = true;
+}
+
+void TangentSpaceGenerator::updateNormals(const Float32Array& positions,
+                                          const Uint32Array& indices, Float32Array& normals,
+                                          size_t dirtyStart, size_t dirtyCount,
+                                          bool useRightHandedSystem)
+{
+  const auto nbVertices = positions.size() / 3;
+  const auto nbFaces    = indices.size() / 3;
+  _updateTopology(indices, nbVertices);
+  if (!_faceNormalsValid || normals.size() != positions.size()
+      || _faceNormalSign != (useRightHandedSystem ? -1.f : 1.f)) {
+    computeNormals(positions, indices, normals, useRightHandedSystem);
+    return;
+  }
+
+  const auto dirtyEnd = std::min(dirtyStart + dirtyCount, nbVertices);
+  if (dirtyStart >= dirtyEnd) {
+    return;
+  }
+
+  // Each face and vertex is collected once per update
+  if (_faceUpdateIds.size() != nbFaces || _vertexUpdateIds.size() != nbVertices
+      || ++_updateId == 0) {
+    _faceUpdateIds.assign(nbFaces, 0);
+    _vertexUpdateIds.assign(nbVertices, 0);
+    _updateId = 1;
+  }
+
+  // Faces touching a moved vertex
+  _dirtyFaces.clear();
+  for (auto vertex = dirtyStart; vertex < dirtyEnd; ++vertex) {
+    for (auto row = _vertexFaceOffsets[vertex]; row < _vertexFaceOffsets[vertex + 1]; ++row) {
+      const auto face = _vertexFaces[row];
+      if (_faceUpdateIds[face] != _updateId) {
+        _faceUpdateIds[face] = _updateId;
+        _dirtyFaces.emplace_back(face);
+      }
+    }
+  }
+  _parallelFor(_dirtyFaces.size(), [&](size_t begin, size_t end) {
+    for (auto index = begin; index < end; ++index) {
+      _computeFaceNormal(positions, indices, _dirtyFaces[index]);
+    }
+  });
+
+  // Vertices of these faces
+  _dirtyVertices.clear();
+  for (const auto face : _dirtyFaces) {
+    for (size_t corner = 0; corner < 3; ++corner) {
+      const auto vertex = indices[face * 3 + corner];
+      if (vertex < nbVertices && _vertexUpdateIds[vertex] != _updateId) {
+        _vertexUpdateIds[vertex] = _updateId;
+        _dirtyVertices.emplace_back(vertex);
+      }
+    }
+  }
+  _parallelFor(_dirtyVertices.size(), [&](size_t begin, size_t end) {
+    for (auto index = begin; index < end; ++index) {
+      _gatherNormal(normals, _dirtyVertices[index]);
+    }
+  });
+}
+
+void TangentSpaceGenerator::computeTangents(const Float32Array& positions,
+                                            const Float32Array& normals, const Float32Array& uvs,
+                                            const Uint32Array& indices, Float32Array& tangents)
+{
+  const auto nbVertices = positions.size() / 3;
+  const auto nbFaces    = indices.size() / 3;
+  tangents.assign(nbVertices * 4, 0.f);
+  if (normals.size() < nbVertices * 3 || uvs.size() < nbVertices * 2) {
+    return;
+  }
+  _updateTopology(indices, nbVertices);
+
+  // Uv tangent of each face (x, y, z) and the orientation of its uvs (w, 0 when degenerated)
+  Float32Array faceTangents(nbFaces * 4);
+  _parallelFor(nbFaces, [&](size_t begin, size_t end) {
+    for (auto face = begin; face < end; ++face) {
+      auto faceTangent = &faceTangents[face * 4];
+      const auto i0    = indices[face * 3];
+      const auto i1    = indices[face * 3 + 1];
+      const auto i2    = indices[face * 3 + 2];
+      if (i0 >= nbVertices || i1 >= nbVertices || i2 >= nbVertices) {
+        std::fill(faceTangent, faceTangent + 4, 0.f);
+        continue;
+      }
+      const auto d1x  = positions[i1 * 3] - positions[i0 * 3];
+      const auto d1y  = positions[i1 * 3 + 1] - positions[i0 * 3 + 1];
+      const auto d1z  = positions[i1 * 3 + 2] - positions[i0 * 3 + 2];
+      const auto d2x  = positions[i2 * 3] - positions[i0 * 3];
+      const auto d2y  = positions[i2 * 3 + 1] - positions[i0 * 3 + 1];
+      const auto d2z  = positions[i2 * 3 + 2] - positions[i0 * 3 + 2];
+      const auto t21x = uvs[i1 * 2] - uvs[i0 * 2];
+      const auto t21y = uvs[i1 * 2 + 1] - uvs[i0 * 2 + 1];
+      const auto t31x = uvs[i2 * 2] - uvs[i0 * 2];
+      const auto t31y = uvs[i2 * 2 + 1] - uvs[i0 * 2 + 1];
+      // Twice the signed area of the face in uv space
+      const auto signedArea = t21x * t31y - t21y * t31x;
+      const auto orient     = signedArea > 0.f ? 1.f : -1.f;
+      auto tx               = orient * (t31y * d1x - t21y * d2x);
+      auto ty               = orient * (t31y * d1y - t21y * d2y);
+      auto tz               = orient * (t31y * d1z - t21y * d2z);
+      Normalize(tx, ty, tz);
+      faceTangent[0] = tx;
+      faceTangent[1] = ty;
+      faceTangent[2] = tz;
+      faceTangent[3] = signedArea != 0.f ? orient : 0.f;
+    }
+  });
+
+  _parallelFor(nbVertices, [&](size_t begin, size_t end) {
+    for (auto vertex = begin; vertex < end; ++vertex) {
+      const auto nx = normals[vertex * 3];
+      const auto ny = normals[vertex * 3 + 1];
+      const auto nz = normals[vertex * 3 + 2];
+      // Projects a vector on the plane of the normal and normalizes it
+      const auto project = [nx, ny, nz](float& x, float& y, float& z) {
+        const auto d = x * nx + y * ny + z * nz;
+        x -= d * nx;
+        y -= d * ny;
+        z -= d * nz;
+        const auto length = std::sqrt(x * x + y * y + z * z);
+        if (length > 0.f) {
+          x /= length;
+          y /= length;
+          z /= length;
+        }
+        return length > 0.f;
+      };
+
+      float x = 0.f, y = 0.f, z = 0.f, orientation = 0.f;
+      for (auto row = _vertexFaceOffsets[vertex]; row < _vertexFaceOffsets[vertex + 1]; ++row) {
+        const auto face        = _vertexFaces[row];
+        const auto faceTangent = &faceTangents[face * 4];
+        auto tx = faceTangent[0], ty = faceTangent[1], tz = faceTangent[2];
+        if (faceTangent[3] == 0.f || !project(tx, ty, tz)) {
+          continue;
+        }
+        // Angle of the face at the vertex, between the projected edges
+        size_t corner = 0;
+        while (corner < 2 && indices[face * 3 + corner] != vertex) {
+          ++corner;
+        }
+        const auto next = indices[face * 3 + (corner + 1) % 3];
+        const auto prev = indices[face * 3 + (corner + 2) % 3];
+        auto e1x        = positions[next * 3] - positions[vertex * 3];
+        auto e1y        = positions[next * 3 + 1] - positions[vertex * 3 + 1];
+        auto e1z        = positions[next * 3 + 2] - positions[vertex * 3 + 2];
+        auto e2x        = positions[prev * 3] - positions[vertex * 3];
+        auto e2y        = positions[prev * 3 + 1] - positions[vertex * 3 + 1];
+        auto e2z        = positions[prev * 3 + 2] - positions[vertex * 3 + 2];
+        if (!project(e1x, e1y, e1z) || !project(e2x, e2y, e2z)) {
+          continue;
+        }
+        const auto angle
+          = std::acos(std::clamp(e1x * e2x + e1y * e2y + e1z * e2z, -1.f, 1.f));
+        x += angle * tx;
+        y += angle * ty;
+        z += angle * tz;
+        orientation += angle * faceTangent[3];
+      }
+
+      // Any direction of the plane of the normal when no face gives one
+      if (!project(x, y, z)) {
+        x = std::abs(nx) < 0.9f ? 1.f : 0.f;
+        y = std::abs(nx) < 0.9f ? 0.f : 1.f;
+        z = 0.f;
+        project(x, y, z);
+      }
+      auto tangent = &tangents[vertex * 4];
+      tangent[0]   = x;
+      tangent[1]   = y;
+      tangent[2]   = z;
+      tangent[3]   = orientation < 0.f ? -1.f : 1.f;
+    }
+  });
+}
+
+} // end of namespace BABYLON
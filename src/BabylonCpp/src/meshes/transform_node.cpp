@@ -176,6 +176,50 @@ void TransformNode::setProperty(const std::vector<std::string>& targetPropertyPa
   }
 }
 
+AnimatedPropertySetter
+TransformNode::_getAnimatedPropertySetter(const std::vector<std::string>& targetPropertyPath,
+                                          unsigned int animationType)
+{
+  if (targetPropertyPath.size() == 1) {
+    const auto& target = targetPropertyPath[0];
+    if (animationType == Animation::ANIMATIONTYPE_QUATERNION && target == "rotationQuaternion") {
+      return [this](const float* value) {
+        if (_rotationQuaternion) {
+          _rotationQuaternion->copyFromFloats(value[0], value[1], value[2], value[3]);
+        }
+        else {
+          _rotationQuaternion = Quaternion(value[0], value[1], value[2], value[3]);
+        }
+        _rotation.setAll(0.f);
+        _isDirty = true;
+      };
+    }
+    if (animationType == Animation::ANIMATIONTYPE_VECTOR3) {
+      if (target == "position") {
+        return [this](const float* value) {
+          _position.copyFromFloats(value[0], value[1], value[2]);
+          _isDirty = true;
+        };
+      }
+      if (target == "rotation") {
+        return [this](const float* value) {
+          _rotation.copyFromFloats(value[0], value[1], value[2]);
+          _rotationQuaternion = std::nullopt;
+          _isDirty            = true;
+        };
+      }
+      if (target == "scaling") {
+        return [this](const float* value) {
+          _scaling.copyFromFloats(value[0], value[1], value[2]);
+          _isDirty = true;
+        };
+      }
+    }
+  }
+
+  return nullptr;
+}
+
 std::string TransformNode::getClassName() const
 {
   return "TransformNode";
@@ -838,7 +882,7 @@ Matrix& TransformNode::computeWorldMatrix(bool force, bool /*useWasUpdatedFlag*/
   }
 
   const auto currentRenderId = getScene()->getRenderId();
-  if (!_isDirty && !force && isSynchronized()) {
+  if (!_isDirty && !force && (_isValidatedByTransformUpdate() || isSynchronized())) {
     _currentRenderId = currentRenderId;
     return _worldMatrix;
   }
@@ -1084,6 +1128,11 @@ TransformNode& TransformNode::unregisterAfterWorldMatrixUpdate(
   return *this;
 }
 
+bool TransformNode::hasAfterWorldMatrixUpdateObservers() const
+{
+  return onAfterWorldMatrixUpdateObservable.hasObservers();
+}
+
 Vector3 TransformNode::getPositionInCameraSpace(const CameraPtr& camera) const
 {
   if (!camera) {
@@ -5,6 +5,8 @@
 #include <babylon/meshes/buffer.h>
 #include <babylon/misc/string_tools.h>
 
+#include <mutex>
+
 namespace BABYLON {
 
 VertexBuffer::VertexBuffer(Engine* engine, const std::variant<Float32Array, Buffer*>& data,
@@ -30,7 +32,8 @@ VertexBuffer::VertexBuffer(Engine* engine, const std::variant<Float32Array, Buff
     _ownsBuffer = true;
   }
 
-  _kind = kind;
+  _kind     = kind;
+  _kindSlot = VertexBuffer::KindSlot(kind);
 
   if (!iType.has_value()) {
     type = VertexBuffer::FLOAT;
@@ -92,6 +95,11 @@ const std::string& VertexBuffer::getKind() const
   return _kind;
 }
 
+size_t VertexBuffer::getKindSlot() const
+{
+  return _kindSlot;
+}
+
 Buffer* VertexBuffer::_getBuffer() const
 {
   if (_ownsBuffer) {
@@ -201,6 +209,21 @@ size_t VertexBuffer::DeduceStride(const std::string& kind)
   }
 }
 
+size_t VertexBuffer::KindSlot(const std::string& kind)
+{
+  static std::mutex kindSlotsMutex;
+  static std::unordered_map<std::string, size_t> kindSlots;
+
+  std::lock_guard<std::mutex> lock(kindSlotsMutex);
+  auto it = kindSlots.find(kind);
+  if (it != kindSlots.end()) {
+    return it->second;
+  }
+  const auto slot = kindSlots.size();
+  kindSlots[kind] = slot;
+  return slot;
+}
+
 unsigned int VertexBuffer::GetTypeByteLength(unsigned int type)
 {
   switch (type) {
@@ -4,12 +4,15 @@
 #include <babylon/core/json_util.h>
 #include <babylon/engines/engine.h>
 #include <babylon/maths/axis.h>
+#include <babylon/maths/batch_math.h>
 #include <babylon/maths/vector2.h>
 #include <babylon/maths/vector3.h>
 #include <babylon/meshes/builders/mesh_builder_options.h>
 #include <babylon/meshes/facet_parameters.h>
 #include <babylon/meshes/geometry.h>
+#include <babylon/meshes/tangent_space_generator.h>
 #include <babylon/meshes/vertex_buffer.h>
+#include <babylon/misc/job_pool.h>
 #include <babylon/misc/tools.h>
 
 namespace BABYLON {
@@ -239,31 +242,14 @@ VertexData& VertexData::transform(const Matrix& matrix)
 {
   const auto& matrixM = matrix.m();
   bool flip           = matrixM[0] * matrixM[5] * matrixM[10] < 0.f;
-  auto transformed    = Vector3::Zero();
   if (!positions.empty()) {
-    auto position = Vector3::Zero();
-
-    for (uint32_t index = 0; index < positions.size(); index += 3) {
-      Vector3::FromArrayToRef(positions, index, position);
-
-      Vector3::TransformCoordinatesToRef(position, matrix, transformed);
-      positions[index + 0] = transformed.x;
-      positions[index + 1] = transformed.y;
-      positions[index + 2] = transformed.z;
-    }
+    BatchMath::TransformCoordinates(positions.data(), matrixM.data(), positions.data(),
+                                    positions.size() / 3);
   }
 
   if (!normals.empty()) {
-    auto normal = Vector3::Zero();
-
-    for (uint32_t index = 0; index < normals.size(); index += 3) {
-      Vector3::FromArrayToRef(normals, index, normal);
-
-      Vector3::TransformNormalToRef(normal, matrix, transformed);
-      normals[index + 0] = transformed.x;
-      normals[index + 1] = transformed.y;
-      normals[index + 2] = transformed.z;
-    }
+    BatchMath::TransformNormals(normals.data(), matrixM.data(), normals.data(),
+                                normals.size() / 3);
   }
 
   if (!tangents.empty()) {
@@ -3261,6 +3247,12 @@ void VertexData::ComputeNormals(const Float32Array& positions, const Uint32Array
     normals.resize(positions.size());
   }
 
+  // Large meshes without facet data are split over the default job pool, with the same result
+  if (!options && indices.size() / 3 > 2 * TangentSpaceGenerator::GrainSize) {
+    TangentSpaceGenerator(&JobPool::Default()).computeNormals(positions, indices, normals);
+    return;
+  }
+
   // temporary scalar variables
   uint32_t index                    = 0;   // facet index
   float p1p2x                       = 0.f; // p1p2 vector x coordinate
@@ -1,20 +1,40 @@
 #include <babylon/misc/dds.h>
 
+#include <cmath>
+
 #include <babylon/babylon_stl_util.h>
 #include <babylon/core/logging.h>
 #include <babylon/engines/constants.h>
 #include <babylon/engines/engine.h>
 #include <babylon/interfaces/igl_rendering_context.h>
 #include <babylon/materials/textures/internal_texture.h>
-#include <babylon/maths/scalar.h>
 #include <babylon/misc/dds_info.h>
 #include <babylon/misc/highdynamicrange/cube_map_to_spherical_polynomial_tools.h>
+#include <babylon/misc/pixel_conversion.h>
+#include <babylon/misc/string_tools.h>
 
 namespace BABYLON {
 
+namespace {
+
+/**
+ * Returns the pixels of a level, or nullptr if the file is truncated. The pixels are read in
+ * place, the levels start on a 4 bytes boundary.
+ */
+template <typename T>
+const T* LevelData(const Uint8Array& arrayBuffer, int dataOffset, size_t dataLength)
+{
+  if (dataOffset < 0
+      || static_cast<size_t>(dataOffset) + dataLength * sizeof(T) > arrayBuffer.size()) {
+    BABYLON_LOG_ERROR("DDSTools", "Truncated DDS level data")
+    return nullptr;
+  }
+  return reinterpret_cast<const T*>(arrayBuffer.data() + dataOffset);
+}
+
+} // end of anonymous namespace
+
 bool DDSTools::StoreLODInAlphaChannel = false;
-Float32Array DDSTools::_FloatView;
-Int32Array DDSTools::_Int32View;
 
 DDSInfo DDSTools::GetDDSInfo(const std::variant<std::string, ArrayBuffer>& iArrayBuffer)
 {
@@ -76,215 +96,103 @@ DDSInfo DDSTools::GetDDSInfo(const std::variant<std::string, ArrayBuffer>& iArra
     nullptr);
 }
 
-float DDSTools::_ToHalfFloat(float value)
+Float32Array DDSTools::_GetHalfFloatAsFloatRGBAArrayBuffer(int dataOffset, size_t dataLength,
+                                                           const Uint8Array& arrayBuffer, int lod)
 {
-  if (DDSTools::_FloatView.empty()) {
-    DDSTools::_FloatView = Float32Array(1);
-    DDSTools::_Int32View = Int32Array(DDSTools::_FloatView.size());
+  const auto srcData = LevelData<uint16_t>(arrayBuffer, dataOffset, dataLength);
+  if (!srcData) {
+    return Float32Array();
   }
 
-  DDSTools::_FloatView[0] = value;
-  auto x                  = DDSTools::_Int32View[0];
-
-  auto bits = (x >> 16) & 0x8000; /* Get the sign */
-  auto m    = (x >> 12) & 0x07ff; /* Keep one extra bit for rounding */
-  auto e    = (x >> 23) & 0xff;   /* Using int is faster here */
-
-  /* If zero, or denormal, or exponent underflows too much for a denormal
-   * half, return signed zero. */
-  if (e < 103) {
-    return static_cast<float>(bits);
-  }
-
-  /* If NaN, return NaN. If Inf or exponent overflow, return Inf. */
-  if (e > 142) {
-    bits |= 0x7c00;
-    /* If exponent was 0xff and one mantissa bit was set, it means NaN,
-     * not Inf, so make sure we set one mantissa bit too. */
-    bits |= ((e == 255) ? 0 : 1) && (x & 0x007fffff);
-    return static_cast<float>(bits);
-  }
-
-  /* If exponent underflows but not too much, return a denormal */
-  if (e < 113) {
-    m |= 0x0800;
-    /* Extra rounding may overflow and set mantissa to 0 and exponent
-     * to 1, which is OK. */
-    bits |= (m >> (114 - e)) + ((m >> (113 - e)) & 1);
-    return static_cast<float>(bits);
+  Float32Array destArray(dataLength);
+  PixelConversion::HalfToFloat(srcData, destArray.data(), dataLength);
+  if (DDSTools::StoreLODInAlphaChannel) {
+    PixelConversion::FillAlpha(destArray.data(), dataLength / 4, static_cast<float>(lod));
   }
 
-  bits |= ((e - 112) << 10) | (m >> 1);
-  bits += m & 1;
-  return static_cast<float>(bits);
+  return destArray;
 }
 
-float DDSTools::_FromHalfFloat(uint16_t value)
+Uint16Array DDSTools::_GetHalfFloatRGBAArrayBuffer(int dataOffset, size_t dataLength,
+                                                   const Uint8Array& arrayBuffer, int lod)
 {
-  auto s = (value & 0x8000) >> 15;
-  auto e = (value & 0x7C00) >> 10;
-  auto f = value & 0x03FF;
-
-  if (e == 0) {
-    auto result = (s ? -1 : 1) * std::pow(2, -14) * (f / std::pow(2, 10));
-    return static_cast<float>(result);
+  const auto srcData = LevelData<uint16_t>(arrayBuffer, dataOffset, dataLength);
+  if (!srcData) {
+    return Uint16Array();
   }
-  else if (e == 0x1F) {
-    return f ? 0.f : ((s ? -1.f : 1.f) * std::numeric_limits<int>::infinity());
-  }
-
-  auto result = (s ? -1 : 1) * std::pow(2, e - 15) * (1 + (f / std::pow(2, 10)));
-  return static_cast<float>(result);
-}
 
-Float32Array DDSTools::_GetHalfFloatAsFloatRGBAArrayBuffer(float width, float height,
-                                                           int dataOffset, size_t dataLength,
-                                                           const Uint8Array& arrayBuffer, int lod)
-{
-  Float32Array destArray(dataLength);
-  Uint16Array srcData(stl_util::to_array<uint16_t>(arrayBuffer, static_cast<size_t>(dataOffset)));
-  size_t index = 0;
-  for (float y = 0; y < height; ++y) {
-    for (float x = 0; x < width; ++x) {
-      auto srcPos          = static_cast<size_t>((x + y * width) * 4);
-      destArray[index]     = DDSTools::_FromHalfFloat(srcData[srcPos]);
-      destArray[index + 1] = DDSTools::_FromHalfFloat(srcData[srcPos + 1]);
-      destArray[index + 2] = DDSTools::_FromHalfFloat(srcData[srcPos + 2]);
-      if (DDSTools::StoreLODInAlphaChannel) {
-        destArray[index + 3] = static_cast<float>(lod);
-      }
-      else {
-        destArray[index + 3] = DDSTools::_FromHalfFloat(srcData[srcPos + 3]);
-      }
-      index += 4;
-    }
+  Uint16Array destArray(srcData, srcData + dataLength);
+  if (DDSTools::StoreLODInAlphaChannel) {
+    PixelConversion::FillAlpha(destArray.data(), dataLength / 4,
+                               PixelConversion::FloatToHalf(static_cast<float>(lod)));
   }
 
   return destArray;
 }
 
-Uint16Array DDSTools::_GetHalfFloatRGBAArrayBuffer(float width, float height, int dataOffset,
-                                                   size_t dataLength, const Uint8Array& arrayBuffer,
-                                                   int lod)
+Float32Array DDSTools::_GetFloatRGBAArrayBuffer(int dataOffset, size_t dataLength,
+                                                const Uint8Array& arrayBuffer, int lod)
 {
-  if (DDSTools::StoreLODInAlphaChannel) {
-    Uint16Array destArray(dataLength);
-    Uint16Array srcData(stl_util::to_array<uint16_t>(arrayBuffer, static_cast<size_t>(dataOffset)));
-    size_t index = 0;
-    for (float y = 0; y < height; ++y) {
-      for (float x = 0; x < width; ++x) {
-        auto srcPos          = static_cast<size_t>((x + y * width) * 4);
-        destArray[index]     = srcData[srcPos];
-        destArray[index + 1] = srcData[srcPos + 1];
-        destArray[index + 2] = srcData[srcPos + 2];
-        destArray[index + 3]
-          = static_cast<uint8_t>(DDSTools::_ToHalfFloat(static_cast<float>(lod)));
-        index += 4;
-      }
-    }
-
-    return destArray;
+  const auto srcData = LevelData<float>(arrayBuffer, dataOffset, dataLength);
+  if (!srcData) {
+    return Float32Array();
   }
 
-  return stl_util::to_array<uint16_t>(arrayBuffer, static_cast<size_t>(dataOffset), dataLength);
-}
-
-Float32Array DDSTools::_GetFloatRGBAArrayBuffer(float width, float height, int dataOffset,
-                                                size_t dataLength, const Uint8Array& arrayBuffer,
-                                                int lod)
-{
+  Float32Array destArray(srcData, srcData + dataLength);
   if (DDSTools::StoreLODInAlphaChannel) {
-    Float32Array destArray(dataLength);
-    Float32Array srcData(stl_util::to_array<float>(arrayBuffer, static_cast<size_t>(dataOffset)));
-    size_t index = 0;
-    for (float y = 0; y < height; ++y) {
-      for (float x = 0; x < width; ++x) {
-        auto srcPos          = static_cast<size_t>((x + y * width) * 4);
-        destArray[index]     = srcData[srcPos];
-        destArray[index + 1] = srcData[srcPos + 1];
-        destArray[index + 2] = srcData[srcPos + 2];
-        destArray[index + 3] = static_cast<float>(lod);
-        index += 4;
-      }
-    }
-
-    return destArray;
+    PixelConversion::FillAlpha(destArray.data(), dataLength / 4, static_cast<float>(lod));
   }
-  return stl_util::to_array<float>(arrayBuffer, static_cast<size_t>(dataOffset), dataLength);
+
+  return destArray;
 }
 
-Float32Array DDSTools::_GetFloatAsUIntRGBAArrayBuffer(float width, float height, int dataOffset,
-                                                      size_t dataLength,
+Float32Array DDSTools::_GetFloatAsUIntRGBAArrayBuffer(int dataOffset, size_t dataLength,
                                                       const Uint8Array& arrayBuffer, int lod)
 {
+  const auto srcData = LevelData<float>(arrayBuffer, dataOffset, dataLength);
+  if (!srcData) {
+    return Float32Array();
+  }
+
   Float32Array destArray(dataLength);
-  Float32Array srcData(stl_util::to_array<float>(arrayBuffer, static_cast<size_t>(dataOffset)));
-  size_t index = 0;
-  for (float y = 0; y < height; ++y) {
-    for (float x = 0; x < width; ++x) {
-      auto srcPos          = static_cast<size_t>((x + y * width) * 4);
-      destArray[index]     = Scalar::Clamp(srcData[srcPos]) * 255;
-      destArray[index + 1] = Scalar::Clamp(srcData[srcPos + 1]) * 255;
-      destArray[index + 2] = Scalar::Clamp(srcData[srcPos + 2]) * 255;
-      if (DDSTools::StoreLODInAlphaChannel) {
-        destArray[index + 3] = static_cast<float>(lod);
-      }
-      else {
-        destArray[index + 3] = Scalar::Clamp(srcData[srcPos + 3]) * 255;
-      }
-      index += 4;
-    }
+  PixelConversion::FloatToByteRange(srcData, destArray.data(), dataLength);
+  if (DDSTools::StoreLODInAlphaChannel) {
+    PixelConversion::FillAlpha(destArray.data(), dataLength / 4, static_cast<float>(lod));
   }
 
   return destArray;
 }
 
-Float32Array DDSTools::_GetHalfFloatAsUIntRGBAArrayBuffer(float width, float height, int dataOffset,
-                                                          size_t dataLength,
+Float32Array DDSTools::_GetHalfFloatAsUIntRGBAArrayBuffer(int dataOffset, size_t dataLength,
                                                           const Uint8Array& arrayBuffer, int lod)
 {
+  const auto srcData = LevelData<uint16_t>(arrayBuffer, dataOffset, dataLength);
+  if (!srcData) {
+    return Float32Array();
+  }
+
   Float32Array destArray(dataLength);
-  Uint16Array srcData(stl_util::to_array<uint16_t>(arrayBuffer, static_cast<size_t>(dataOffset)));
-  size_t index = 0;
-  for (float y = 0; y < height; ++y) {
-    for (float x = 0; x < width; ++x) {
-      auto srcPos = static_cast<size_t>((x + y * width) * 4);
-
-      destArray[index]     = Scalar::Clamp(DDSTools::_FromHalfFloat(srcData[srcPos])) * 255;
-      destArray[index + 1] = Scalar::Clamp(DDSTools::_FromHalfFloat(srcData[srcPos + 1])) * 255;
-      destArray[index + 2] = Scalar::Clamp(DDSTools::_FromHalfFloat(srcData[srcPos + 2])) * 255;
-      if (DDSTools::StoreLODInAlphaChannel) {
-        destArray[index + 3] = static_cast<float>(lod);
-      }
-      else {
-        destArray[index + 3] = Scalar::Clamp(DDSTools::_FromHalfFloat(srcData[srcPos + 3])) * 255;
-      }
-      index += 4;
-    }
+  PixelConversion::HalfToByteRange(srcData, destArray.data(), dataLength);
+  if (DDSTools::StoreLODInAlphaChannel) {
+    PixelConversion::FillAlpha(destArray.data(), dataLength / 4, static_cast<float>(lod));
   }
 
   return destArray;
 }
 
-Uint8Array DDSTools::_GetRGBAArrayBuffer(float width, float height, int dataOffset,
-                                         size_t dataLength, const Uint8Array& arrayBuffer,
-                                         int rOffset, int gOffset, int bOffset, int aOffset)
+Uint8Array DDSTools::_GetRGBAArrayBuffer(int dataOffset, size_t dataLength,
+                                         const Uint8Array& arrayBuffer, int rOffset, int gOffset,
+                                         int bOffset, int aOffset)
 {
-  Uint8Array byteArray(dataLength);
-  Uint8Array srcData(stl_util::to_array<uint8_t>(arrayBuffer, static_cast<size_t>(dataOffset)));
-  size_t index = 0;
-  for (float y = 0; y < height; ++y) {
-    for (float x = 0; x < width; ++x) {
-      auto srcPos = static_cast<int>(x + y * width) * 4;
-
-      byteArray[index]     = srcData[static_cast<size_t>(srcPos + rOffset)];
-      byteArray[index + 1] = srcData[static_cast<size_t>(srcPos + gOffset)];
-      byteArray[index + 2] = srcData[static_cast<size_t>(srcPos + bOffset)];
-      byteArray[index + 3] = srcData[static_cast<size_t>(srcPos + aOffset)];
-      index += 4;
-    }
+  const auto srcData = LevelData<uint8_t>(arrayBuffer, dataOffset, dataLength);
+  if (!srcData) {
+    return Uint8Array();
   }
 
+  Uint8Array byteArray(dataLength);
+  PixelConversion::SwizzleRGBA(srcData, byteArray.data(), dataLength / 4, rOffset, gOffset,
+                               bOffset, aOffset);
+
   return byteArray;
 }
 
@@ -297,41 +205,34 @@ int DDSTools::_ExtractLongWordOrder(int value)
   return 1 + DDSTools::_ExtractLongWordOrder(value >> 8);
 }
 
-Uint8Array DDSTools::_GetRGBArrayBuffer(float width, float height, int dataOffset,
-                                        size_t dataLength, const Uint8Array& arrayBuffer,
-                                        int rOffset, int gOffset, int bOffset)
+Uint8Array DDSTools::_GetRGBArrayBuffer(int dataOffset, size_t dataLength,
+                                        const Uint8Array& arrayBuffer, int rOffset, int gOffset,
+                                        int bOffset)
 {
-  Uint8Array byteArray(dataLength);
-  Uint8Array srcData(stl_util::to_array<uint8_t>(arrayBuffer, static_cast<size_t>(dataOffset)));
-  size_t index = 0;
-  for (float y = 0; y < height; ++y) {
-    for (float x = 0; x < width; ++x) {
-      auto srcPos = static_cast<int>(x + y * width) * 3;
-
-      byteArray[index]     = srcData[static_cast<size_t>(srcPos + rOffset)];
-      byteArray[index + 1] = srcData[static_cast<size_t>(srcPos + gOffset)];
-      byteArray[index + 2] = srcData[static_cast<size_t>(srcPos + bOffset)];
-      index += 3;
-    }
+  const auto srcData = LevelData<uint8_t>(arrayBuffer, dataOffset, dataLength);
+  if (!srcData) {
+    return Uint8Array();
   }
 
+  Uint8Array byteArray(dataLength);
+  PixelConversion::SwizzleRGB(srcData, byteArray.data(), dataLength / 3, rOffset, gOffset,
+                              bOffset);
+
   return byteArray;
 }
 
 Uint8Array DDSTools::_GetLuminanceArrayBuffer(float width, float height, int dataOffset,
                                               size_t dataLength, const Uint8Array& arrayBuffer)
 {
-  Uint8Array byteArray(dataLength);
-  Uint8Array srcData(stl_util::to_array<uint8_t>(arrayBuffer, static_cast<size_t>(dataOffset)));
-  size_t index = 0;
-  for (float y = 0; y < height; ++y) {
-    for (float x = 0; x < width; ++x) {
-      auto srcPos      = static_cast<size_t>(x + y * width);
-      byteArray[index] = srcData[srcPos];
-      ++index;
-    }
+  const auto nbPixels = static_cast<size_t>(width * height);
+  const auto srcData  = LevelData<uint8_t>(arrayBuffer, dataOffset, nbPixels);
+  if (!srcData) {
+    return Uint8Array();
   }
 
+  Uint8Array byteArray(dataLength);
+  std::copy(srcData, srcData + nbPixels, byteArray.begin());
+
   return byteArray;
 }
 
@@ -461,19 +362,19 @@ void DDSTools::UploadDDSLevels(ThinEngine* engine, const InternalTexturePtr& tex
                                                          // issues with float and half float
                                                          // generation
             if (bpp == 128) {
-              floatArray = DDSTools::_GetFloatAsUIntRGBAArrayBuffer(width, height, dataOffset,
-                                                                    dataLength, arrayBuffer, i);
+              floatArray = DDSTools::_GetFloatAsUIntRGBAArrayBuffer(dataOffset, dataLength,
+                                                                    arrayBuffer, i);
               if (i == 0) {
-                sphericalPolynomialFaces.emplace_back(DDSTools::_GetFloatRGBAArrayBuffer(
-                  width, height, dataOffset, dataLength, arrayBuffer, i));
+                sphericalPolynomialFaces.emplace_back(
+                  DDSTools::_GetFloatRGBAArrayBuffer(dataOffset, dataLength, arrayBuffer, i));
               }
             }
             else if (bpp == 64) {
-              floatArray = DDSTools::_GetHalfFloatAsUIntRGBAArrayBuffer(width, height, dataOffset,
-                                                                        dataLength, arrayBuffer, i);
+              floatArray = DDSTools::_GetHalfFloatAsUIntRGBAArrayBuffer(dataOffset, dataLength,
+                                                                        arrayBuffer, i);
               if (i == 0) {
                 sphericalPolynomialFaces.emplace_back(DDSTools::_GetHalfFloatAsFloatRGBAArrayBuffer(
-                  width, height, dataOffset, dataLength, arrayBuffer, i));
+                  dataOffset, dataLength, arrayBuffer, i));
               }
             }
 
@@ -482,27 +383,27 @@ void DDSTools::UploadDDSLevels(ThinEngine* engine, const InternalTexturePtr& tex
           else {
             if (bpp == 128) {
               texture->type = Constants::TEXTURETYPE_FLOAT;
-              floatArray = DDSTools::_GetFloatRGBAArrayBuffer(width, height, dataOffset, dataLength,
-                                                              arrayBuffer, i);
+              floatArray
+                = DDSTools::_GetFloatRGBAArrayBuffer(dataOffset, dataLength, arrayBuffer, i);
               if (i == 0) {
                 sphericalPolynomialFaces.emplace_back(floatArray);
               }
             }
             else if (bpp == 64 && !engine->getCaps().textureHalfFloat) {
               texture->type = Constants::TEXTURETYPE_FLOAT;
-              floatArray    = DDSTools::_GetHalfFloatAsFloatRGBAArrayBuffer(
-                width, height, dataOffset, dataLength, arrayBuffer, i);
+              floatArray    = DDSTools::_GetHalfFloatAsFloatRGBAArrayBuffer(dataOffset, dataLength,
+                                                                         arrayBuffer, i);
               if (i == 0) {
                 sphericalPolynomialFaces.emplace_back(floatArray);
               }
             }
             else { // 64
               texture->type = Constants::TEXTURETYPE_HALF_FLOAT;
-              floatArray    = DDSTools::_GetHalfFloatRGBAArrayBuffer(width, height, dataOffset,
-                                                                  dataLength, arrayBuffer, i);
+              floatArray
+                = DDSTools::_GetHalfFloatRGBAArrayBuffer(dataOffset, dataLength, arrayBuffer, i);
               if (i == 0) {
                 sphericalPolynomialFaces.emplace_back(DDSTools::_GetHalfFloatAsFloatRGBAArrayBuffer(
-                  width, height, dataOffset, dataLength, arrayBuffer, i));
+                  dataOffset, dataLength, arrayBuffer, i));
               }
             }
           }
@@ -516,16 +417,15 @@ void DDSTools::UploadDDSLevels(ThinEngine* engine, const InternalTexturePtr& tex
           if (bpp == 24) {
             texture->format = Constants::TEXTUREFORMAT_RGB;
             dataLength      = static_cast<size_t>(width * height * 3);
-            byteArray       = DDSTools::_GetRGBArrayBuffer(width, height, dataOffset, dataLength,
-                                                     arrayBuffer, rOffset, gOffset, bOffset);
+            byteArray       = DDSTools::_GetRGBArrayBuffer(dataOffset, dataLength, arrayBuffer,
+                                                     rOffset, gOffset, bOffset);
             engine->_uploadDataToTextureDirectly(texture, byteArray, face, i);
           }
           else { // 32
             texture->format = Constants::TEXTUREFORMAT_RGBA;
             dataLength      = static_cast<size_t>(width * height * 4);
-            byteArray
-              = DDSTools::_GetRGBAArrayBuffer(width, height, dataOffset, dataLength, arrayBuffer,
-                                              rOffset, gOffset, bOffset, aOffset);
+            byteArray       = DDSTools::_GetRGBAArrayBuffer(dataOffset, dataLength, arrayBuffer,
+                                                      rOffset, gOffset, bOffset, aOffset);
             engine->_uploadDataToTextureDirectly(texture, byteArray, face, i);
           }
         }
@@ -98,6 +98,55 @@ EnvironmentTextureTools::CreateImageDataArrayBufferViews(const ArrayBuffer& arra
   return imageData;
 }
 
+ArrayBuffer EnvironmentTextureTools::CreateEnvArrayBuffer(
+  const std::vector<std::vector<ArrayBuffer>>& imageData, int width,
+  const SphericalPolynomial* sphericalPolynomial, float lodGenerationScale)
+{
+  // Sets the specular image data information
+  auto mipmaps    = json::array();
+  size_t position = 0;
+  for (const auto& faces : imageData) {
+    if (faces.size() != 6) {
+      throw std::runtime_error("Unsupported number of faces " + std::to_string(faces.size()));
+    }
+    for (const auto& image : faces) {
+      mipmaps.push_back({{"length", image.size()}, {"position", position}});
+      position += image.size();
+    }
+  }
+
+  json info;
+  info["version"]  = 1;
+  info["width"]    = width;
+  info["specular"] = {{"mipmaps", mipmaps}, {"lodGenerationScale", lodGenerationScale}};
+
+  // Sets the irradiance information
+  if (sphericalPolynomial) {
+    const auto toArray = [](const Vector3& vector) {
+      return json::array({vector.x, vector.y, vector.z});
+    };
+    const auto& sp     = *sphericalPolynomial;
+    info["irradiance"] = {{"x", toArray(sp.x)},   {"y", toArray(sp.y)},   {"z", toArray(sp.z)},
+                          {"xx", toArray(sp.xx)}, {"yy", toArray(sp.yy)}, {"zz", toArray(sp.zz)},
+                          {"yz", toArray(sp.yz)}, {"zx", toArray(sp.zx)}, {"xy", toArray(sp.xy)}};
+  }
+
+  // Magic bytes, null terminated json manifest and images
+  const auto infoString = info.dump();
+  ArrayBuffer arrayBuffer(EnvironmentTextureTools::_MagicBytes.begin(),
+                          EnvironmentTextureTools::_MagicBytes.end());
+  arrayBuffer.reserve(arrayBuffer.size() + infoString.size() + 1 + position);
+  arrayBuffer.insert(arrayBuffer.end(), infoString.begin(), infoString.end());
+  arrayBuffer.emplace_back(0);
+  for (const auto& faces : imageData) {
+    for (const auto& image : faces) {
+      arrayBuffer.insert(arrayBuffer.end(), image.begin(), image.end());
+    }
+  }
+
+  return arrayBuffer;
+}
+
 void EnvironmentTextureTools::UploadEnvLevels(const InternalTexturePtr& texture,
                                               const ArrayBuffer& arrayBuffer,
                                               const EnvironmentTextureInfo& info)
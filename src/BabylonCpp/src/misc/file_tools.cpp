@@ -38,10 +38,26 @@
 #include <babylon/misc/string_tools.h>
 #include <babylon/utils/base64.h>
 
+#include <cstring>
 #include <stdexcept>
 
 namespace BABYLON {
 
+namespace {
+
+// Copies the rows of a decoded image, flipping it vertically if requested. The flip flag of
+// stb_image is global and would race with the images decoded by other threads
+void CopyRows(unsigned char* destination, const unsigned char* source, size_t rowSize,
+              size_t height, bool flipVertically)
+{
+  for (size_t row = 0; row < height; ++row) {
+    const auto sourceRow = flipVertically ? height - 1 - row : row;
+    std::memcpy(destination + row * rowSize, source + sourceRow * rowSize, rowSize);
+  }
+}
+
+} // end of anonymous namespace
+
 std::string FileTools::PreprocessUrl(const std::string& url)
 {
   return url;
@@ -105,6 +121,12 @@ void FileTools::LoadImageFromBuffer(
 }
 
 Image FileTools::ArrayBufferToImage(const ArrayBuffer& buffer, bool flipVertically)
+{
+  return ArrayBufferToImage(buffer, flipVertically, ArrayBuffer());
+}
+
+Image FileTools::ArrayBufferToImage(const ArrayBuffer& buffer, bool flipVertically,
+                                    ArrayBuffer&& storage)
 {
   if (buffer.empty()) {
     return Image();
@@ -113,18 +135,18 @@ Image FileTools::ArrayBufferToImage(const ArrayBuffer& buffer, bool flipVertical
   int w = -1, h = -1, n = -1;
   int req_comp = STBI_rgb_alpha;
 
-  stbi_set_flip_vertically_on_load(flipVertically);
   unsigned char* ucharBuffer
     = stbi_load_from_memory(buffer.data(), bufferSize, &w, &h, &n, req_comp);
-  stbi_set_flip_vertically_on_load(false);
 
   if (!ucharBuffer)
     return Image();
 
-  n = STBI_rgb_alpha;
-  Image image(ucharBuffer, w * h * n, w, h, n, (n == 3) ? GL::RGB : GL::RGBA);
+  n                  = STBI_rgb_alpha;
+  const auto rowSize = static_cast<size_t>(w * n);
+  storage.resize(rowSize * static_cast<size_t>(h));
+  CopyRows(storage.data(), ucharBuffer, rowSize, static_cast<size_t>(h), flipVertically);
   stbi_image_free(ucharBuffer);
-  return image;
+  return Image(std::move(storage), w, h, n, (n == 3) ? GL::RGB : GL::RGBA);
 }
 
 Image FileTools::StringToImage(const std::string& uri, bool flipVertically)
@@ -247,8 +269,6 @@ Image FileTools::StringToImage(const std::string& uri, bool flipVertically)
     req_comp = 4;
     int bits = 8;
 
-    stbi_set_flip_vertically_on_load(flipVertically);
-
     // It is possible that the image we want to load is a 16bit per channel
     // image We are going to attempt to load it as 16bit per channel, and if it
     // worked, set the image data accodingly. We are casting the returned
@@ -280,8 +300,6 @@ Image FileTools::StringToImage(const std::string& uri, bool flipVertically)
       return false;
     }
 
-    stbi_set_flip_vertically_on_load(false);
-
     if ((w < 1) || (h < 1)) {
       stbi_image_free(data);
       BABYLON_LOG_ERROR("StringToImage", "Invalid image data for image")
@@ -309,7 +327,8 @@ Image FileTools::StringToImage(const std::string& uri, bool flipVertically)
     image.depth  = req_comp;
     image.mode   = (req_comp == 3) ? GL::RGB : GL::RGBA;
     image.data.resize(static_cast<size_t>(w * h * req_comp) * size_t(bits / 8));
-    std::copy(data, data + w * h * req_comp * (bits / 8), image.data.begin());
+    CopyRows(image.data.data(), data, static_cast<size_t>(w * req_comp) * size_t(bits / 8),
+             static_cast<size_t>(h), flipVertically);
     stbi_image_free(data);
 
     return true;
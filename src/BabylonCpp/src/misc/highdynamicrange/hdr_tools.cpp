@@ -1,41 +1,11 @@
 #include <babylon/misc/highdynamicrange/hdr_tools.h>
 
-#include <babylon/babylon_stl_util.h>
 #include <babylon/misc/highdynamicrange/panorama_to_cube_map_tools.h>
+#include <babylon/misc/pixel_conversion.h>
 #include <babylon/misc/string_tools.h>
 
 namespace BABYLON {
 
-float HDRTools::Ldexp(float mantissa, float exponent)
-{
-  if (exponent > 1023.f) {
-    return mantissa * std::pow(2.f, 1023.f) * std::pow(2.f, exponent - 1023.f);
-  }
-
-  if (exponent < -1074.f) {
-    return mantissa * std::pow(2.f, -1074.f) * std::pow(2.f, exponent + 1074.f);
-  }
-
-  return mantissa * std::pow(2.f, exponent);
-}
-
-void HDRTools::Rgbe2float(Float32Array& float32array, float red, float green, float blue,
-                          float exponent, size_t index)
-{
-  if (exponent > 0.f) { /*nonzero pixel*/
-    exponent = Ldexp(1.f, exponent - (128.f + 8.f));
-
-    float32array[index + 0] = red * exponent;
-    float32array[index + 1] = green * exponent;
-    float32array[index + 2] = blue * exponent;
-  }
-  else {
-    float32array[index + 0] = 0.f;
-    float32array[index + 1] = 0.f;
-    float32array[index + 2] = 0.f;
-  }
-}
-
 std::string HDRTools::readStringLine(const Uint8Array& uint8array, size_t startIndex)
 {
   std::ostringstream line;
@@ -138,12 +108,10 @@ Float32Array HDRTools::RGBE_ReadPixels_RLE(const Uint8Array& uint8array, const H
   auto dataIndex = hdrInfo.dataPosition;
   auto index = 0ull, endIndex = 0ull, i = 0ull;
 
-  ArrayBuffer scanLineArrayBuffer(scanline_width * 4); // four channel R G B E
-  auto scanLineArray = stl_util::to_array<uint8_t>(scanLineArrayBuffer);
+  Uint8Array scanLineArray(scanline_width * 4); // four channel R G B E
 
-  // 3 channels of 4 bytes per pixel in float.
-  ArrayBuffer resultBuffer(hdrInfo.width * hdrInfo.height * 4 * 3);
-  auto resultArray = stl_util::to_array<float>(resultBuffer);
+  // 3 channels per pixel in float.
+  Float32Array resultArray(hdrInfo.width * hdrInfo.height * 3);
 
   // read in each successive scanline
   while (num_scanlines > 0) {
@@ -200,15 +168,11 @@ Float32Array HDRTools::RGBE_ReadPixels_RLE(const Uint8Array& uint8array, const H
     }
 
     // now convert data from buffer into floats
-    for (i = 0; i < scanline_width; ++i) {
-      a = scanLineArray[i];
-      b = scanLineArray[i + scanline_width];
-      c = scanLineArray[i + 2 * scanline_width];
-      d = scanLineArray[i + 3 * scanline_width];
-
-      Rgbe2float(resultArray, a, b, c, d,
-                 (hdrInfo.height - num_scanlines) * scanline_width * 3 + i * 3);
-    }
+    const auto* scanLine = scanLineArray.data();
+    PixelConversion::RGBEToFloat(
+      scanLine, scanLine + scanline_width, scanLine + 2 * scanline_width,
+      scanLine + 3 * scanline_width,
+      resultArray.data() + (hdrInfo.height - num_scanlines) * scanline_width * 3, scanline_width);
 
     --num_scanlines;
   }
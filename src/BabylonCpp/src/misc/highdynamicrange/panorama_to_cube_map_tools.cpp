@@ -1,9 +1,11 @@
 #include <babylon/misc/highdynamicrange/panorama_to_cube_map_tools.h>
 
+#include <algorithm>
 #include <cmath>
 
 #include <babylon/core/logging.h>
 #include <babylon/engines/constants.h>
+#include <babylon/misc/job_pool.h>
 
 namespace BABYLON {
 
@@ -50,7 +52,7 @@ std::array<Vector3, 4> PanoramaToCubeMapTools::FACE_UP{{
 
 CubeMapInfo PanoramaToCubeMapTools::ConvertPanoramaToCubemap(
   const Float32Array& float32Array, size_t inputWidth, size_t inputHeight,
-  size_t size)
+  size_t size, JobPool* jobPool)
 {
   CubeMapInfo cubeMapInfo;
 
@@ -60,18 +62,33 @@ CubeMapInfo PanoramaToCubeMapTools::ConvertPanoramaToCubemap(
     return cubeMapInfo;
   }
 
-  cubeMapInfo.front = CreateCubemapTexture(size, FACE_FRONT, float32Array,
-                                           inputWidth, inputHeight);
-  cubeMapInfo.back  = CreateCubemapTexture(size, FACE_BACK, float32Array,
-                                          inputWidth, inputHeight);
-  cubeMapInfo.left  = CreateCubemapTexture(size, FACE_LEFT, float32Array,
-                                          inputWidth, inputHeight);
-  cubeMapInfo.right = CreateCubemapTexture(size, FACE_RIGHT, float32Array,
-                                           inputWidth, inputHeight);
-  cubeMapInfo.up = CreateCubemapTexture(size, FACE_UP, float32Array, inputWidth,
-                                        inputHeight);
-  cubeMapInfo.down       = CreateCubemapTexture(size, FACE_DOWN, float32Array,
-                                          inputWidth, inputHeight);
+  // Front, back, left, right, up and down faces, 3 channels per pixels
+  const std::array<const std::array<Vector3, 4>*, 6> facesData{
+    {&FACE_FRONT, &FACE_BACK, &FACE_LEFT, &FACE_RIGHT, &FACE_UP, &FACE_DOWN}};
+  std::array<Float32Array, 6> faces;
+  for (auto& face : faces) {
+    face.resize(size * size * 3);
+  }
+
+  // Every row of every face is independent
+  auto& pool = jobPool ? *jobPool : JobPool::Default();
+  pool.parallelFor(6 * size, RowGrainSize, [&](size_t begin, size_t end) {
+    Float32Array directions(3 * size);
+    for (size_t row = begin; row < end; ++row) {
+      const auto faceIndex = row / size;
+      const auto y         = row % size;
+      CreateCubemapRow(size, y, *facesData[faceIndex], float32Array,
+                       inputWidth, inputHeight, directions.data(),
+                       faces[faceIndex].data() + y * size * 3);
+    }
+  });
+
+  cubeMapInfo.front      = faces[0];
+  cubeMapInfo.back       = faces[1];
+  cubeMapInfo.left       = faces[2];
+  cubeMapInfo.right      = faces[3];
+  cubeMapInfo.up         = faces[4];
+  cubeMapInfo.down       = faces[5];
   cubeMapInfo.size       = size;
   cubeMapInfo.type       = Constants::TEXTURETYPE_FLOAT;
   cubeMapInfo.format     = Constants::TEXTUREFORMAT_RGB;
@@ -80,88 +97,70 @@ CubeMapInfo PanoramaToCubeMapTools::ConvertPanoramaToCubemap(
   return cubeMapInfo;
 }
 
-Float32Array PanoramaToCubeMapTools::CreateCubemapTexture(
-  size_t texSize, const std::array<Vector3, 4>& faceData,
-  const Float32Array& float32Array, size_t inputWidth, size_t inputHeight)
-{
-  Float32Array textureArray(texSize * texSize * 4 * 3);
-
-  auto texSizef = static_cast<float>(texSize);
-  auto rotDX1   = faceData[1].subtract(faceData[0]).scale(1.f / texSizef);
-  auto rotDX2   = faceData[3].subtract(faceData[2]).scale(1.f / texSizef);
-
-  auto dy = 1.f / static_cast<float>(texSize);
-  auto fy = 0.f;
-
-  for (size_t y = 0; y < texSize; ++y) {
-    auto xv1 = faceData[0];
-    auto xv2 = faceData[2];
-
-    for (size_t x = 0; x < texSize; ++x) {
-      auto v = xv2.subtract(xv1).scale(fy).add(xv1);
-      v.normalize();
-
-      auto color
-        = CalcProjectionSpherical(v, float32Array, inputWidth, inputHeight);
-
-      // 3 channels per pixels
-      textureArray[y * texSize * 3 + (x * 3) + 0] = color.r;
-      textureArray[y * texSize * 3 + (x * 3) + 1] = color.g;
-      textureArray[y * texSize * 3 + (x * 3) + 2] = color.b;
-
-      xv1 = xv1.add(rotDX1);
-      xv2 = xv2.add(rotDX2);
-    }
-
-    fy += dy;
-  }
-
-  return textureArray;
-}
-
-Color3 PanoramaToCubeMapTools::CalcProjectionSpherical(
-  const Vector3& vDir, const Float32Array& float32Array, size_t inputWidth,
-  size_t inputHeight)
+void PanoramaToCubeMapTools::CreateCubemapRow(
+  size_t texSize, size_t y, const std::array<Vector3, 4>& faceData,
+  const Float32Array& float32Array, size_t inputWidth, size_t inputHeight,
+  float* directions, float* rgb)
 {
-  auto theta = std::atan2(vDir.z, vDir.x);
-  auto phi   = std::acos(vDir.y);
-
-  while (theta < -Math::PI) {
-    theta += 2.f * Math::PI;
-  }
-  while (theta > Math::PI) {
-    theta -= 2.f * Math::PI;
-  }
-
-  auto dx = theta / Math::PI;
-  auto dy = phi / Math::PI;
-
-  // recenter.
-  dx = dx * 0.5f + 0.5f;
-
-  auto px = static_cast<int>(std::round(dx * static_cast<float>(inputWidth)));
-  if (px < 0) {
-    px = 0;
-  }
-  else if (static_cast<size_t>(px) >= inputWidth) {
-    px = static_cast<int>(inputWidth) - 1;
+  const auto texSizef = static_cast<float>(texSize);
+  const auto fy       = static_cast<float>(y) / texSizef;
+
+  // The direction of the texel x of the row is start + x * step, start being
+  // interpolated between the first and the third corners, and step between
+  // the steps along the top and the bottom edges of the face
+  const auto lerp = [fy](float a, float b) { return a + (b - a) * fy; };
+  const std::array<float, 3> start{{lerp(faceData[0].x, faceData[2].x),
+                                    lerp(faceData[0].y, faceData[2].y),
+                                    lerp(faceData[0].z, faceData[2].z)}};
+  const std::array<float, 3> step{
+    {lerp(faceData[1].x - faceData[0].x, faceData[3].x - faceData[2].x)
+       / texSizef,
+     lerp(faceData[1].y - faceData[0].y, faceData[3].y - faceData[2].y)
+       / texSizef,
+     lerp(faceData[1].z - faceData[0].z, faceData[3].z - faceData[2].z)
+       / texSizef}};
+
+  // Normalized directions, one array per axis
+  auto* dirX = directions;
+  auto* dirY = directions + texSize;
+  auto* dirZ = directions + 2 * texSize;
+  for (size_t x = 0; x < texSize; ++x) {
+    const auto fx     = static_cast<float>(x);
+    const auto vx     = start[0] + step[0] * fx;
+    const auto vy     = start[1] + step[1] * fx;
+    const auto vz     = start[2] + step[2] * fx;
+    const auto invLen = 1.f / std::sqrt(vx * vx + vy * vy + vz * vz);
+    dirX[x]           = vx * invLen;
+    dirY[x]           = vy * invLen;
+    dirZ[x]           = vz * invLen;
   }
 
-  auto py = static_cast<int>(std::round(dy * static_cast<float>(inputHeight)));
-  if (py < 0) {
-    py = 0;
+  // Spherical projection on the panorama
+  const auto inputWidthf  = static_cast<float>(inputWidth);
+  const auto inputHeightf = static_cast<float>(inputHeight);
+  const auto maxX         = static_cast<long>(inputWidth) - 1;
+  const auto maxY         = static_cast<long>(inputHeight) - 1;
+  for (size_t x = 0; x < texSize; ++x) {
+    // theta is in [-PI, PI] and phi in [0, PI]
+    const auto theta = std::atan2(dirZ[x], dirX[x]);
+    const auto phi   = std::acos(dirY[x]);
+
+    // recenter.
+    const auto dx = (theta / Math::PI) * 0.5f + 0.5f;
+    const auto dy = phi / Math::PI;
+
+    const auto px = std::clamp(std::lround(dx * inputWidthf), 0l, maxX);
+    const auto py = std::clamp(std::lround(dy * inputHeightf), 0l, maxY);
+
+    // the panorama rows are stored from the bottom
+    const auto inputY = static_cast<size_t>(maxY - py);
+    const auto inputX = static_cast<size_t>(px);
+    const auto* color
+      = float32Array.data() + (inputY * inputWidth + inputX) * 3;
+    rgb[x * 3 + 0] = color[0];
+    rgb[x * 3 + 1] = color[1];
+    rgb[x * 3 + 2] = color[2];
   }
-  else if (static_cast<size_t>(py) >= inputHeight) {
-    py = static_cast<int>(inputHeight) - 1;
-  }
-
-  auto inputY = (inputHeight - static_cast<size_t>(py) - 1);
-  auto _px    = static_cast<size_t>(px);
-  auto r      = float32Array[inputY * inputWidth * 3 + (_px * 3) + 0];
-  auto g      = float32Array[inputY * inputWidth * 3 + (_px * 3) + 1];
-  auto b      = float32Array[inputY * inputWidth * 3 + (_px * 3) + 2];
-
-  return Color3(r, g, b);
 }
 
 } // end of namespace BABYLON
@@ -2,6 +2,8 @@
 
 #include <cmath>
 
+#include <babylon/misc/job_pool.h>
+
 namespace BABYLON {
 
 template <typename ArrayBufferView>
@@ -111,7 +113,7 @@ PMREMGenerator<ArrayBufferView>::PMREMGenerator(
   const std::vector<ArrayBufferView>& _input, int _inputSize, int _outputSize,
   size_t _maxNumMipLevels, size_t _numChannels, bool _isFloat,
   float _specularPower, float _cosinePowerDropPerMip, bool _excludeBase,
-  bool _fixup)
+  bool _fixup, JobPool* jobPool)
     : input{_input}
     , inputSize{_inputSize}
     , outputSize{_outputSize}
@@ -122,6 +124,8 @@ PMREMGenerator<ArrayBufferView>::PMREMGenerator(
     , cosinePowerDropPerMip{_cosinePowerDropPerMip}
     , excludeBase{_excludeBase}
     , fixup{_fixup}
+    , _jobPool{jobPool}
+    , _numMipLevels{0}
 {
 }
 
@@ -156,9 +160,10 @@ void PMREMGenerator<ArrayBufferView>::init()
   mipLevelSize = outputSize;
 
   // Iterate over mip chain, and init ArrayBufferView for mip-chain
-  _outputSurface.resize(maxNumMipLevels);
+  _outputSurface.clear();
+  _numMipLevels = 0;
   for (unsigned int j = 0; j < maxNumMipLevels; ++j) {
-    _outputSurface[j].resize(6);
+    _outputSurface.emplace_back(std::vector<ArrayBufferView>(6));
     // Iterate over faces for output images
     for (unsigned i = 0; i < 6; i++) {
       // Initializes a new array for the output.
@@ -172,7 +177,6 @@ void PMREMGenerator<ArrayBufferView>::init()
 
     // terminate if mip chain becomes too small
     if (mipLevelSize == 0) {
-      maxNumMipLevels = j;
       return;
     }
   }
@@ -211,8 +215,7 @@ void PMREMGenerator<ArrayBufferView>::filterCubeMapMipChain()
     // Special case for cosine power mipmap chain. For quality requirement, we
     // always process the current mipmap from the top mipmap
     std::vector<ArrayBufferView>& srcCubeImage = input;
-    std::vector<std::vector<ArrayBufferView>>& dstCubeImage
-      = _outputSurface[levelIndex];
+    std::vector<ArrayBufferView>& dstCubeImage = _outputSurface[levelIndex];
     size_t dstSize = outputSize >> levelIndex;
 
     // Compute required angle.
@@ -272,26 +275,31 @@ template <typename ArrayBufferView>
 void PMREMGenerator<ArrayBufferView>::buildNormalizerSolidAngleCubemap(
   size_t size)
 {
-  // iterate over cube faces
+  // First three planes for norm cube, and last plane for solid angle
+  const size_t planeSize = size * size;
   for (unsigned int iCubeFace = 0; iCubeFace < 6; ++iCubeFace) {
-    // First three channels for norm cube, and last channel for solid angle
-    _normCubeMap.emplace_back(Float32Array(size * size * 4));
+    _normCubeMap.emplace_back(Float32Array(planeSize * 4));
+  }
 
-    // fast texture walk, build normalizer cube map
-    // ArrayBufferView& facesData = input[iCubeFace];
+  // iterate over the rows of the cube faces
+  auto& jobPool = _jobPool ? *_jobPool : JobPool::Default();
+  jobPool.parallelFor(6 * size, RowGrainSize, [&](size_t begin, size_t end) {
+    for (size_t row = begin; row < end; ++row) {
+      const auto iCubeFace = static_cast<unsigned int>(row / size);
+      const auto v         = row % size;
+      auto* texels         = _normCubeMap[iCubeFace].data() + v * size;
 
-    for (size_t v = 0; v < size; v++) {
       for (size_t u = 0; u < size; u++) {
-        Vector3 vect = texelCoordToVect(iCubeFace, u, v, size, fixup);
-        _normCubeMap[iCubeFace][(v * size + u) * 4 + 0] = vect.x;
-        _normCubeMap[iCubeFace][(v * size + u) * 4 + 1] = vect.y;
-        _normCubeMap[iCubeFace][(v * size + u) * 4 + 2] = vect.z;
+        Vector4 vect = texelCoordToVect(iCubeFace, u, v, size, fixup);
+        texels[u]                 = vect.x;
+        texels[planeSize + u]     = vect.y;
+        texels[2 * planeSize + u] = vect.z;
 
         float solidAngle = texelCoordSolidAngle(iCubeFace, u, v, size);
-        _normCubeMap[iCubeFace][(v * size + u) * 4 + 4] = solidAngle;
+        texels[3 * planeSize + u] = solidAngle;
       }
     }
-  }
+  });
 }
 
 template <typename ArrayBufferView>
@@ -315,9 +323,10 @@ Vector4 PMREMGenerator<ArrayBufferView>::texelCoordToVect(unsigned int faceIdx,
     // Code from Nvtt :
     // http://code.google.com/p/nvidia-texture-tools/source/browse/trunk/src/nvtt/CubeSurface.cpp
     auto sizef  = static_cast<float>(size);
-    float a     = std::pow(sizef, 2.f) / std::pow(sizef - 1.f, 3.f);
-    nvcU        = a * std::pow(nvcU, 3.f) + nvcU;
-    nvcV        = a * std::pow(nvcV, 3.f) + nvcV;
+    float sizem = sizef - 1.f;
+    float a     = (sizef * sizef) / (sizem * sizem * sizem);
+    nvcU        = a * nvcU * nvcU * nvcU + nvcU;
+    nvcV        = a * nvcV * nvcV * nvcV + nvcV;
   }
 
   // Get current vector
@@ -458,9 +467,6 @@ void PMREMGenerator<ArrayBufferView>::filterCubeSurfaces(
   std::vector<ArrayBufferView>& dstCubeMap, size_t dstSize,
   float filterConeAngle, float _specularPower)
 {
-  // bounding box per face to specify region to process
-  std::array<CMGBoundinBox, 6> filterExtents;
-
   // min angle a src texel can cover (in degrees)
   float srcTexelAngle = (180.f / (Math::PI)*std::atan2(1.f, srcSize));
 
@@ -492,14 +498,25 @@ void PMREMGenerator<ArrayBufferView>::filterCubeSurfaces(
   //  reside within the cone angle
   float dotProdThresh = std::cos((Math::PI / 180.f) * filterAngle);
 
-  // process required faces
-  for (unsigned int iCubeFace = 0; iCubeFace < 6; ++iCubeFace) {
-    // iterate over dst cube map face texel
-    for (unsigned int v = 0; v < dstSize; ++v) {
-      for (unsigned int u = 0; u < dstSize; ++u) {
+  // process required faces, every dst texel is filtered independently so the
+  // rows of the 6 faces are spread over the job pool
+  auto& jobPool = _jobPool ? *_jobPool : JobPool::Default();
+  jobPool.parallelFor(6 * dstSize, RowGrainSize, [&](size_t begin, size_t end) {
+    // bounding box per face to specify region to process
+    std::array<CMGBoundinBox, 6> filterExtents;
+    Float32Array tapDotProducts(static_cast<size_t>(srcSize));
+
+    for (size_t row = begin; row < end; ++row) {
+      const auto iCubeFace = static_cast<unsigned int>(row / dstSize);
+      const auto v         = row % dstSize;
+      auto* dstTexel
+        = dstCubeMap[iCubeFace].data() + v * dstSize * numChannels;
+
+      // iterate over dst cube map face texel
+      for (size_t u = 0; u < dstSize; ++u, dstTexel += numChannels) {
         // get center tap direction
         Vector4 centerTapDir
-          = texelCoordToVect(iCubeFace, u, v, dstSize, fixup).clone();
+          = texelCoordToVect(iCubeFace, u, v, dstSize, fixup);
 
         // clear old per-face filter extents
         clearFilterExtents(filterExtents);
@@ -509,16 +526,19 @@ void PMREMGenerator<ArrayBufferView>::filterCubeSurfaces(
                                filterExtents);
 
         // perform filtering of src faces using filter extents
-        Vector3 vect
-          = processFilterExtents(centerTapDir, dotProdThresh, filterExtents,
-                                 srcCubeMap, srcSize, _specularPower);
-
-        dstCubeMap[iCubeFace][(v * dstSize + u) * numChannels + 0] = vect.x;
-        dstCubeMap[iCubeFace][(v * dstSize + u) * numChannels + 1] = vect.y;
-        dstCubeMap[iCubeFace][(v * dstSize + u) * numChannels + 2] = vect.z;
+        Vector4 vect = processFilterExtents(centerTapDir, dotProdThresh,
+                                            filterExtents, srcCubeMap, srcSize,
+                                            _specularPower, tapDotProducts);
+
+        dstTexel[0] = vect.x;
+        dstTexel[1] = vect.y;
+        dstTexel[2] = vect.z;
+        if (numChannels > 3) {
+          dstTexel[3] = vect.w;
+        }
       }
     }
-  }
+  });
 }
 
 template <typename ArrayBufferView>
@@ -546,7 +566,7 @@ void PMREMGenerator<ArrayBufferView>::determineFilterExtents(
   unsigned int oppositeFaceIdx = 0;
 
   // get face idx, and u, v info from center tap dir
-  Vector3 result
+  Vector4 result
     = vectToTexelCoord(centerTapDir.x, centerTapDir.y, centerTapDir.z, srcSize);
   auto faceIdx         = static_cast<unsigned>(result.x);
   float u              = result.y;
@@ -687,127 +707,111 @@ Vector4 PMREMGenerator<ArrayBufferView>::processFilterExtents(
   const Vector4& centerTapDir, float dotProdThresh,
   const std::array<CMGBoundinBox, 6>& filterExtents,
   const std::vector<ArrayBufferView>& srcCubeMap, size_t srcSize,
-  size_t _specularPower) const
+  float _specularPower, Float32Array& tapDotProducts) const
 {
   Vector4 _vectorTemp{0.f, 0.f, 0.f, 0.f};
 
   // accumulators are 64-bit floats in order to have the precision needed
   // over a summation of a large number of pixels
-  std::array<float, 4> dstAccum{{0, 0, 0, 0}};
-  float weightAccum   = 0.f;
+  std::array<double, 4> dstAccum{{0, 0, 0, 0}};
+  double weightAccum  = 0.0;
   size_t nSrcChannels = numChannels;
 
   // norm cube map and srcCubeMap have same face width
   size_t faceWidth = srcSize;
-
-  // amount to add to pointer to move to next scanline in images
-  size_t normCubePitch = faceWidth * 4; // 4 channels in normCubeMap.
-  size_t srcCubePitch
-    = faceWidth
-      * numChannels; // numChannels correponds to the cubemap number of channel
+  size_t planeSize = faceWidth * faceWidth;
 
   unsigned int IsPhongBRDF = 1; // Only works in Phong BRDF yet.
   //(a_LightingModel == CP_LIGHTINGMODEL_PHONG_BRDF || a_LightingModel ==
   // CP_LIGHTINGMODEL_BLINN_BRDF) ? 1 : 0; // This value will be added to the
   // specular power
 
+  // Here we decide if we use a Phong/Blinn or a Phong/Blinn BRDF.
+  // Phong/Blinn BRDF is just the Phong/Blinn model multiply by the
+  // cosine of the lambert law
+  // so just adding one to specularpower do the trick.
+  const float tapPower = _specularPower + static_cast<float>(IsPhongBRDF);
+
+  const float centerX = centerTapDir.x;
+  const float centerY = centerTapDir.y;
+  const float centerZ = centerTapDir.z;
+  float* dotProducts  = tapDotProducts.data();
+
   // iterate over cubefaces
   for (unsigned int iFaceIdx = 0; iFaceIdx < 6; iFaceIdx++) {
 
     // if bbox is non empty
     if (!filterExtents[iFaceIdx].empty()) {
-      float uStart = filterExtents[iFaceIdx].min.x;
-      float vStart = filterExtents[iFaceIdx].min.y;
-      float uEnd   = filterExtents[iFaceIdx].max.x;
-      float vEnd   = filterExtents[iFaceIdx].max.y;
-
-      auto startIndexNormCubeMap = static_cast<size_t>(4.f * ((vStart * faceWidth) + uStart));
-      auto startIndexSrcCubeMap
-        = static_cast<size_t>(numChannels * ((vStart * faceWidth) + uStart));
+      auto uStart = static_cast<size_t>(filterExtents[iFaceIdx].min.x);
+      auto vStart = static_cast<size_t>(filterExtents[iFaceIdx].min.y);
+      auto uEnd   = static_cast<size_t>(filterExtents[iFaceIdx].max.x);
+      auto vEnd   = static_cast<size_t>(filterExtents[iFaceIdx].max.y);
 
       // note that <= is used to ensure filter extents always encompass at least
       // one pixel if bbox is non empty
-      for (float v = vStart; v <= vEnd; v++) {
-        float normCubeRowWalk = 0;
-        float srcCubeRowWalk  = 0;
-
-        for (float u = uStart; u <= uEnd; u++) {
-          // pointer to direction in cube map associated with texel
-          float texelVectX = _normCubeMap[iFaceIdx][startIndexNormCubeMap
-                                                    + normCubeRowWalk + 0];
-          float texelVectY = _normCubeMap[iFaceIdx][startIndexNormCubeMap
-                                                    + normCubeRowWalk + 1];
-          float texelVectZ = _normCubeMap[iFaceIdx][startIndexNormCubeMap
-                                                    + normCubeRowWalk + 2];
+      const size_t rowLength = uEnd - uStart + 1;
+
+      for (size_t v = vStart; v <= vEnd; v++) {
+        // directions and solid angles of the taps of the row
+        const size_t rowStart = v * faceWidth + uStart;
+        const float* texelVectX = _normCubeMap[iFaceIdx].data() + rowStart;
+        const float* texelVectY = texelVectX + planeSize;
+        const float* texelVectZ = texelVectX + 2 * planeSize;
+        const float* solidAngle = texelVectX + 3 * planeSize;
+        const float* srcTexel
+          = srcCubeMap[iFaceIdx].data() + rowStart * nSrcChannels;
+
+        // dot products of the row taps with the center tap
+        for (size_t i = 0; i < rowLength; ++i) {
+          dotProducts[i] = texelVectX[i] * centerX + texelVectY[i] * centerY
+                           + texelVectZ[i] * centerZ;
+        }
 
+        for (size_t i = 0; i < rowLength; ++i) {
           // check dot product to see if texel is within cone
-          float tapDotProd = texelVectX * centerTapDir.x
-                             + texelVectY * centerTapDir.y
-                             + texelVectZ * centerTapDir.z;
-
+          const float tapDotProd = dotProducts[i];
           if (tapDotProd >= dotProdThresh && tapDotProd > 0.f) {
-            // solid angle stored in 4th channel of normalizer/solid angle cube
+            // solid angle stored in 4th plane of normalizer/solid angle cube
             // map
-            float weight = _normCubeMap[iFaceIdx][startIndexNormCubeMap
-                                                  + normCubeRowWalk + 3];
-
-            // Here we decide if we use a Phong/Blinn or a Phong/Blinn BRDF.
-            // Phong/Blinn BRDF is just the Phong/Blinn model multiply by the
-            // cosine of the lambert law
-            // so just adding one to specularpower do the trick.
-            weight *= std::pow(tapDotProd, (_specularPower + IsPhongBRDF));
+            const double weight
+              = solidAngle[i] * std::pow(tapDotProd, tapPower);
 
             // iterate over channels
-            for (size_t k = 0; k < nSrcChannels;
-                 k++) //(aSrcCubeMap[iFaceIdx].m_NumChannels) //up to 4 channels
-            {
-              dstAccum[k] += weight
-                             * srcCubeMap[iFaceIdx][startIndexSrcCubeMap
-                                                    + srcCubeRowWalk];
-              srcCubeRowWalk++;
+            for (size_t k = 0; k < nSrcChannels; k++) {
+              dstAccum[k] += weight * srcTexel[i * nSrcChannels + k];
             }
 
             weightAccum += weight; // accumulate weight
           }
-          else {
-            // step across source pixel
-            srcCubeRowWalk += nSrcChannels;
-          }
-
-          normCubeRowWalk += 4; // 4 channels per norm cube map.
         }
-
-        startIndexNormCubeMap += normCubePitch;
-        startIndexSrcCubeMap += srcCubePitch;
       }
     }
   }
 
   // divide through by weights if weight is non zero
-  if (weightAccum != 0.f) {
-    _vectorTemp.x = (dstAccum[0] / weightAccum);
-    _vectorTemp.y = (dstAccum[1] / weightAccum);
-    _vectorTemp.z = (dstAccum[2] / weightAccum);
+  if (weightAccum != 0.0) {
+    _vectorTemp.x = static_cast<float>(dstAccum[0] / weightAccum);
+    _vectorTemp.y = static_cast<float>(dstAccum[1] / weightAccum);
+    _vectorTemp.z = static_cast<float>(dstAccum[2] / weightAccum);
     if (numChannels > 3) {
-      _vectorTemp.w = (dstAccum[3] / weightAccum);
+      _vectorTemp.w = static_cast<float>(dstAccum[3] / weightAccum);
     }
   }
   else {
     // otherwise sample nearest
     // get face idx and u, v texel coordinate in face
-    Vector3 coord = vectToTexelCoord(centerTapDir.x, centerTapDir.y,
-                                     centerTapDir.z, srcSize)
-                      .clone();
-
-    _vectorTemp.x
-      = srcCubeMap[coord.x][numChannels * (coord.z * srcSize + coord.y) + 0];
-    _vectorTemp.y
-      = srcCubeMap[coord.x][numChannels * (coord.z * srcSize + coord.y) + 1];
-    _vectorTemp.z
-      = srcCubeMap[coord.x][numChannels * (coord.z * srcSize + coord.y) + 2];
+    Vector4 coord = vectToTexelCoord(centerTapDir.x, centerTapDir.y,
+                                     centerTapDir.z, srcSize);
+    const auto faceIdx = static_cast<size_t>(coord.x);
+    const auto texel
+      = static_cast<size_t>(coord.z) * srcSize + static_cast<size_t>(coord.y);
+    const float* srcTexel = srcCubeMap[faceIdx].data() + texel * numChannels;
+
+    _vectorTemp.x = srcTexel[0];
+    _vectorTemp.y = srcTexel[1];
+    _vectorTemp.z = srcTexel[2];
     if (numChannels > 3) {
-      _vectorTemp.z
-        = srcCubeMap[coord.x][numChannels * (coord.z * srcSize + coord.y) + 3];
+      _vectorTemp.w = srcTexel[3];
     }
   }
 
@@ -837,7 +841,7 @@ void PMREMGenerator<ArrayBufferView>::fixupCubeEdges(
   if (cubeMapSize == 1) {
     // iterate over channels
     for (unsigned int k = 0; k < numChannels; ++k) {
-      size_t accum = 0.f;
+      float accum = 0.f;
 
       // iterate over faces to accumulate face colors
       for (unsigned int iFace = 0; iFace < 6; ++iFace) {
@@ -857,15 +861,16 @@ void PMREMGenerator<ArrayBufferView>::fixupCubeEdges(
   }
 
   // iterate over faces to collect list of corner texel pointers
+  const auto lastTexel = static_cast<uint32_t>(cubeMapSize - 1);
+  const auto pitch     = static_cast<uint32_t>(cubeMapSize * numChannels);
+  const auto channels  = static_cast<uint32_t>(numChannels);
   for (unsigned int iFace = 0; iFace < 6; ++iFace) {
     // the 4 corner pointers for this face
     faceCornerStartIndicies[0] = {iFace, 0};
-    faceCornerStartIndicies[1] = {iFace, ((cubeMapSize - 1) * numChannels)};
-    faceCornerStartIndicies[2]
-      = {iFace, ((cubeMapSize) * (cubeMapSize - 1) * numChannels)};
+    faceCornerStartIndicies[1] = {iFace, lastTexel * channels};
+    faceCornerStartIndicies[2] = {iFace, lastTexel * pitch};
     faceCornerStartIndicies[3]
-      = {iFace, ((((cubeMapSize) * (cubeMapSize - 1)) + (cubeMapSize - 1))
-                 * numChannels)};
+      = {iFace, lastTexel * pitch + lastTexel * channels};
 
     // iterate over face corners to collect cube corner pointers
     for (unsigned int iCorner = 0; iCorner < 4; ++iCorner) {
@@ -909,30 +914,32 @@ void PMREMGenerator<ArrayBufferView>::fixupCubeEdges(
     unsigned int neighborFace = PMREMGenerator::_sgCubeNgh[face][edge][0];
     unsigned int neighborEdge = PMREMGenerator::_sgCubeNgh[face][edge][1];
 
-    unsigned int edgeStartIndex = 0; // a_CubeMap[face].m_ImgData;
-    unsigned int neighborEdgeStartIndex
-      = 0; // a_CubeMap[neighborFace].m_ImgData;
-    unsigned int edgeWalk         = 0;
-    unsigned int neighborEdgeWalk = 0;
+    // walks can be negative
+    long edgeStartIndex         = 0; // a_CubeMap[face].m_ImgData;
+    long neighborEdgeStartIndex = 0; // a_CubeMap[neighborFace].m_ImgData;
+    long edgeWalk               = 0;
+    long neighborEdgeWalk       = 0;
+    const auto nChannels        = static_cast<long>(numChannels);
+    const auto size             = static_cast<long>(cubeMapSize);
 
     // Determine walking pointers based on edge type
     // e.g. CP_EDGE_LEFT, CP_EDGE_RIGHT, CP_EDGE_TOP, CP_EDGE_BOTTOM
     switch (edge) {
       case PMREMGenerator::CP_EDGE_LEFT:
         // no change to faceEdgeStartPtr
-        edgeWalk = numChannels * cubeMapSize;
+        edgeWalk = nChannels * size;
         break;
       case PMREMGenerator::CP_EDGE_RIGHT:
-        edgeStartIndex += (cubeMapSize - 1) * numChannels;
-        edgeWalk = numChannels * cubeMapSize;
+        edgeStartIndex += (size - 1) * nChannels;
+        edgeWalk = nChannels * size;
         break;
       case PMREMGenerator::CP_EDGE_TOP:
         // no change to faceEdgeStartPtr
-        edgeWalk = numChannels;
+        edgeWalk = nChannels;
         break;
       case PMREMGenerator::CP_EDGE_BOTTOM:
-        edgeStartIndex += (cubeMapSize) * (cubeMapSize - 1) * numChannels;
-        edgeWalk = numChannels;
+        edgeStartIndex += size * (size - 1) * nChannels;
+        edgeWalk = nChannels;
         break;
     }
 
@@ -956,25 +963,25 @@ void PMREMGenerator<ArrayBufferView>::fixupCubeEdges(
       switch (neighborEdge) {
         case PMREMGenerator::CP_EDGE_LEFT: // start at lower left and walk up
           neighborEdgeStartIndex
-            += (cubeMapSize - 1) * (cubeMapSize)*numChannels;
-          neighborEdgeWalk = -(numChannels * cubeMapSize);
+            += (size - 1) * size * nChannels;
+          neighborEdgeWalk = -(nChannels * size);
           break;
         case PMREMGenerator::CP_EDGE_RIGHT: // start at lower right and walk up
           neighborEdgeStartIndex
-            += ((cubeMapSize - 1) * (cubeMapSize) + (cubeMapSize - 1))
-               * numChannels;
-          neighborEdgeWalk = -(numChannels * cubeMapSize);
+            += ((size - 1) * size + (size - 1))
+               * nChannels;
+          neighborEdgeWalk = -(nChannels * size);
           break;
         case PMREMGenerator::CP_EDGE_TOP: // start at upper right and walk left
-          neighborEdgeStartIndex += (cubeMapSize - 1) * numChannels;
-          neighborEdgeWalk = -numChannels;
+          neighborEdgeStartIndex += (size - 1) * nChannels;
+          neighborEdgeWalk = -nChannels;
           break;
         case PMREMGenerator::CP_EDGE_BOTTOM: // start at lower right and walk
                                              // left
           neighborEdgeStartIndex
-            += ((cubeMapSize - 1) * (cubeMapSize) + (cubeMapSize - 1))
-               * numChannels;
-          neighborEdgeWalk = -numChannels;
+            += ((size - 1) * size + (size - 1))
+               * nChannels;
+          neighborEdgeWalk = -nChannels;
           break;
       }
     }
@@ -984,23 +991,23 @@ void PMREMGenerator<ArrayBufferView>::fixupCubeEdges(
         case PMREMGenerator::CP_EDGE_LEFT: // start at upper left and walk down
           // no change to neighborEdgeStartPtr for this case since it points
           // to the upper left corner already
-          neighborEdgeWalk = numChannels * cubeMapSize;
+          neighborEdgeWalk = nChannels * size;
           break;
         case PMREMGenerator::CP_EDGE_RIGHT: // start at upper right and walk
                                             // down
-          neighborEdgeStartIndex += (cubeMapSize - 1) * numChannels;
-          neighborEdgeWalk = numChannels * cubeMapSize;
+          neighborEdgeStartIndex += (size - 1) * nChannels;
+          neighborEdgeWalk = nChannels * size;
           break;
         case PMREMGenerator::CP_EDGE_TOP: // start at upper left and walk left
           // no change to neighborEdgeStartPtr for this case since it points
           // to the upper left corner already
-          neighborEdgeWalk = numChannels;
+          neighborEdgeWalk = nChannels;
           break;
         case PMREMGenerator::CP_EDGE_BOTTOM: // start at lower left and walk
                                              // left
           neighborEdgeStartIndex
-            += (cubeMapSize) * (cubeMapSize - 1) * numChannels;
-          neighborEdgeWalk = numChannels;
+            += size * (size - 1) * nChannels;
+          neighborEdgeWalk = nChannels;
           break;
       }
     }
@@ -1019,17 +1026,16 @@ void PMREMGenerator<ArrayBufferView>::fixupCubeEdges(
     for (unsigned int j = 1; j < (cubeMapSize - 1); j++) {
       // for each set of taps along edge, average them
       // and rewrite the results into the edges
-      for (unsigned int k = 0; k < numChannels; k++) {
-        ArrayBufferView& edgeTap = cubeMap[face][edgeStartIndex + k];
-        ArrayBufferView& neighborEdgeTap
-          = cubeMap[neighborFace][neighborEdgeStartIndex + k];
-
+      float* edgeTap         = cubeMap[face].data() + edgeStartIndex;
+      float* neighborEdgeTap = cubeMap[neighborFace].data()
+                               + neighborEdgeStartIndex;
+      for (size_t k = 0; k < numChannels; k++) {
         // compute average of tap intensity values
-        float avgTap = 0.5f * (edgeTap + neighborEdgeTap);
+        float avgTap = 0.5f * (edgeTap[k] + neighborEdgeTap[k]);
 
         // propagate average of taps to edge taps
-        cubeMap[face][edgeStartIndex + k]                 = avgTap;
-        cubeMap[neighborFace][neighborEdgeStartIndex + k] = avgTap;
+        edgeTap[k]         = avgTap;
+        neighborEdgeTap[k] = avgTap;
       }
 
       edgeStartIndex += edgeWalk;
@@ -1038,4 +1044,6 @@ void PMREMGenerator<ArrayBufferView>::fixupCubeEdges(
   }
 }
 
+template class PMREMGenerator<Float32Array>;
+
 } // end of namespace BABYLON
@@ -0,0 +1,157 @@
+#include <babylon/misc/job_pool.h>
+
+#include <algorithm>
+
+namespace BABYLON {
+
+namespace {
+
+// Set on the threads currently running a job, nested parallelFor calls run serially
+thread_local bool InsideJob = false;
+
+struct InsideJobScope {
+  InsideJobScope() : _previous{InsideJob}
+  {
+    InsideJob = true;
+  }
+  ~InsideJobScope()
+  {
+    InsideJob = _previous;
+  }
+
+private:
+  bool _previous;
+};
+
+} // end of anonymous namespace
+
+JobPool& JobPool::Default()
+{
+  static JobPool pool(std::max(std::thread::hardware_concurrency(), 1u) - 1);
+  return pool;
+}
+
+JobPool::JobPool(size_t nbWorkers)
+    : _stopping{false}
+    , _generation{0}
+    , _activeWorkers{0}
+    , _exception{nullptr}
+    , _job{nullptr}
+    , _count{0}
+    , _grainSize{1}
+    , _nbChunks{0}
+    , _nextChunk{0}
+    , _remainingChunks{0}
+{
+  _workers.reserve(nbWorkers);
+  for (size_t i = 0; i < nbWorkers; ++i) {
+    _workers.emplace_back([this]() { _workerLoop(); });
+  }
+}
+
+JobPool::~JobPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stopping = true;
+  }
+  _wakeCondition.notify_all();
+  for (auto& worker : _workers) {
+    worker.join();
+  }
+}
+
+void JobPool::parallelFor(size_t count, size_t grainSize, const Job& job)
+{
+  if (count == 0) {
+    return;
+  }
+
+  grainSize = std::max(grainSize, size_t(1));
+
+  if (_workers.empty() || count <= grainSize || InsideJob) {
+    InsideJobScope scope;
+    for (size_t begin = 0; begin < count; begin += grainSize) {
+      job(begin, std::min(begin + grainSize, count));
+    }
+    return;
+  }
+
+  std::lock_guard<std::mutex> dispatchLock(_dispatchMutex);
+
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    // A worker woken late by the previous call may still be leaving _runChunks
+    _doneCondition.wait(lock, [this]() { return _activeWorkers == 0; });
+    _job       = &job;
+    _count     = count;
+    _grainSize = grainSize;
+    _nbChunks  = (count + grainSize - 1) / grainSize;
+    _exception = nullptr;
+    _nextChunk.store(0);
+    _remainingChunks.store(_nbChunks);
+    ++_generation;
+  }
+  _wakeCondition.notify_all();
+
+  _runChunks();
+
+  std::exception_ptr exception = nullptr;
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _doneCondition.wait(lock, [this]() { return _remainingChunks.load() == 0; });
+    exception = _exception;
+    _exception = nullptr;
+  }
+
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
+}
+
+void JobPool::_workerLoop()
+{
+  uint64_t generation = 0;
+  for (;;) {
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _wakeCondition.wait(lock, [&]() { return _stopping || _generation != generation; });
+      if (_stopping) {
+        return;
+      }
+      generation = _generation;
+      ++_activeWorkers;
+    }
+
+    _runChunks();
+
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      --_activeWorkers;
+    }
+    _doneCondition.notify_all();
+  }
+}
+
+void JobPool::_runChunks()
+{
+  InsideJobScope scope;
+  for (auto chunk = _nextChunk.fetch_add(1); chunk < _nbChunks; chunk = _nextChunk.fetch_add(1)) {
+    const auto begin = chunk * _grainSize;
+    try {
+      (*_job)(begin, std::min(begin + _grainSize, _count));
+    }
+    catch (...) {
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (!_exception) {
+        _exception = std::current_exception();
+      }
+    }
+    if (_remainingChunks.fetch_sub(1) == 1) {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _doneCondition.notify_all();
+    }
+  }
+}
+
+} // end of namespace BABYLON
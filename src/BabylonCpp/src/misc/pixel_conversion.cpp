@@ -0,0 +1,887 @@
+#include <babylon/misc/pixel_conversion.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <string>
+
+#if defined(OPTION_ENABLE_SIMD) && (defined(__SSE2__) || defined(_M_X64))
+#define BABYLON_PIXEL_CONVERSION_USE_SSE
+#include <immintrin.h>
+#if defined(__GNUC__)
+// The SSSE3 and F16C kernels are compiled for their own target and only called when the CPU
+// supports them
+#define BABYLON_PIXEL_CONVERSION_USE_SSSE3
+#define BABYLON_PIXEL_CONVERSION_USE_F16C
+#define BABYLON_PIXEL_CONVERSION_SSSE3_TARGET __attribute__((target("ssse3")))
+#define BABYLON_PIXEL_CONVERSION_F16C_TARGET __attribute__((target("avx,f16c")))
+#elif defined(__AVX2__)
+#define BABYLON_PIXEL_CONVERSION_USE_SSSE3
+#define BABYLON_PIXEL_CONVERSION_USE_F16C
+#define BABYLON_PIXEL_CONVERSION_SSSE3_TARGET
+#define BABYLON_PIXEL_CONVERSION_F16C_TARGET
+#endif
+#elif defined(OPTION_ENABLE_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#define BABYLON_PIXEL_CONVERSION_USE_NEON
+#include <arm_neon.h>
+#endif
+
+namespace BABYLON {
+
+namespace {
+
+//------------------------------------------------------------------------------
+// Dispatch
+//------------------------------------------------------------------------------
+
+struct CpuFeatures {
+  bool ssse3 = false;
+  bool f16c  = false;
+}; // end of struct CpuFeatures
+
+const CpuFeatures& Features()
+{
+  static const CpuFeatures features{[]() {
+    CpuFeatures detected;
+#if defined(BABYLON_PIXEL_CONVERSION_USE_SSSE3) && defined(__GNUC__)
+    detected.ssse3 = __builtin_cpu_supports("ssse3");
+    detected.f16c  = __builtin_cpu_supports("avx") && __builtin_cpu_supports("f16c");
+#elif defined(BABYLON_PIXEL_CONVERSION_USE_SSSE3)
+    detected.ssse3 = true;
+    detected.f16c  = true;
+#endif
+    return detected;
+  }()};
+  return features;
+}
+
+std::atomic<bool>& SIMDEnabled()
+{
+  static std::atomic<bool> enabled{true};
+  return enabled;
+}
+
+inline bool UseSIMD()
+{
+  return SIMDEnabled().load(std::memory_order_relaxed);
+}
+
+[[maybe_unused]] inline bool UseSSSE3()
+{
+  return UseSIMD() && Features().ssse3;
+}
+
+[[maybe_unused]] inline bool UseF16C()
+{
+  return UseSIMD() && Features().f16c;
+}
+
+//------------------------------------------------------------------------------
+// Scalar
+//------------------------------------------------------------------------------
+
+inline uint32_t FloatBits(float value)
+{
+  uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+inline float BitsToFloat(uint32_t bits)
+{
+  float value;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+float HalfToFloatScalar(uint16_t value)
+{
+  const uint32_t sign = (value & 0x8000u) << 16;
+  uint32_t exponent   = (value >> 10) & 0x1Fu;
+  uint32_t mantissa   = value & 0x3FFu;
+
+  if (exponent == 0x1F) {
+    // Infinity, or NaN made quiet as F16C does
+    return BitsToFloat(sign | 0x7F800000u | (mantissa << 13) | (mantissa ? 0x400000u : 0u));
+  }
+  if (exponent != 0) {
+    return BitsToFloat(sign | ((exponent + 112) << 23) | (mantissa << 13));
+  }
+  if (mantissa == 0) {
+    return BitsToFloat(sign);
+  }
+
+  // Denormal half, normal float
+  exponent = 113;
+  while ((mantissa & 0x400u) == 0) {
+    mantissa <<= 1;
+    --exponent;
+  }
+  return BitsToFloat(sign | (exponent << 23) | ((mantissa & 0x3FFu) << 13));
+}
+
+uint16_t FloatToHalfScalar(float value)
+{
+  const auto bits     = FloatBits(value);
+  const auto sign     = static_cast<uint16_t>((bits >> 16) & 0x8000u);
+  const auto absolute = bits & 0x7FFFFFFFu;
+
+  if (absolute > 0x7F800000u) {
+    // NaN: quiet, mantissa truncated
+    return static_cast<uint16_t>(sign | 0x7E00u | ((absolute >> 13) & 0x3FFu));
+  }
+  if (absolute >= 0x47800000u) {
+    // Infinity or larger than the largest half after rounding
+    return static_cast<uint16_t>(sign | 0x7C00u);
+  }
+  if (absolute < 0x38800000u) {
+    // Denormal half (or zero), rounded to the nearest even
+    const auto exponent = absolute >> 23;
+    if (exponent < 102) {
+      return sign;
+    }
+    const auto mantissa  = (absolute & 0x7FFFFFu) | 0x800000u;
+    const auto shift     = 126 - exponent;
+    const auto halfway   = 1u << (shift - 1);
+    const auto remainder = mantissa & ((1u << shift) - 1);
+    auto half            = mantissa >> shift;
+    if (remainder > halfway || (remainder == halfway && (half & 1u))) {
+      ++half;
+    }
+    return static_cast<uint16_t>(sign | half);
+  }
+
+  // Normal half, the rounding carry can overflow the mantissa into the exponent
+  auto half            = (absolute >> 13) - (112u << 10);
+  const auto remainder = absolute & 0x1FFFu;
+  if (remainder > 0x1000u || (remainder == 0x1000u && (half & 1u))) {
+    ++half;
+  }
+  return static_cast<uint16_t>(sign | half);
+}
+
+void HalfToFloatScalar(const uint16_t* source, float* destination, size_t count)
+{
+  for (size_t i = 0; i < count; ++i) {
+    destination[i] = HalfToFloatScalar(source[i]);
+  }
+}
+
+void FloatToHalfScalar(const float* source, uint16_t* destination, size_t count)
+{
+  for (size_t i = 0; i < count; ++i) {
+    destination[i] = FloatToHalfScalar(source[i]);
+  }
+}
+
+void FloatToByteRangeScalar(const float* source, float* destination, size_t count)
+{
+  for (size_t i = 0; i < count; ++i) {
+    const auto value = source[i];
+    destination[i]   = value > 0.f ? (value < 1.f ? value : 1.f) * 255.f : 0.f;
+  }
+}
+
+void RGBEToFloatScalar(const uint8_t* red, const uint8_t* green, const uint8_t* blue,
+                       const uint8_t* exponents, float* rgb, size_t count)
+{
+  for (size_t i = 0; i < count; ++i, rgb += 3) {
+    const int exponent = exponents[i];
+    if (exponent == 0) {
+      rgb[0] = rgb[1] = rgb[2] = 0.f;
+      continue;
+    }
+    // mantissa / 256 * 2^(exponent - 128)
+    rgb[0] = std::ldexp(static_cast<float>(red[i]), exponent - 136);
+    rgb[1] = std::ldexp(static_cast<float>(green[i]), exponent - 136);
+    rgb[2] = std::ldexp(static_cast<float>(blue[i]), exponent - 136);
+  }
+}
+
+void SwizzleRGBAScalar(const uint8_t* source, uint8_t* destination, size_t nbPixels, int rOffset,
+                       int gOffset, int bOffset, int aOffset)
+{
+  for (size_t i = 0; i < nbPixels; ++i, source += 4, destination += 4) {
+    destination[0] = source[rOffset];
+    destination[1] = source[gOffset];
+    destination[2] = source[bOffset];
+    destination[3] = source[aOffset];
+  }
+}
+
+void SwizzleRGBScalar(const uint8_t* source, uint8_t* destination, size_t nbPixels, int rOffset,
+                      int gOffset, int bOffset)
+{
+  for (size_t i = 0; i < nbPixels; ++i, source += 3, destination += 3) {
+    destination[0] = source[rOffset];
+    destination[1] = source[gOffset];
+    destination[2] = source[bOffset];
+  }
+}
+
+void RGBToRGBAScalar(const uint8_t* source, uint8_t* destination, size_t nbPixels, int rOffset,
+                     int gOffset, int bOffset)
+{
+  for (size_t i = 0; i < nbPixels; ++i, source += 3, destination += 4) {
+    destination[0] = source[rOffset];
+    destination[1] = source[gOffset];
+    destination[2] = source[bOffset];
+    destination[3] = 255;
+  }
+}
+
+void LuminanceToRGBAScalar(const uint8_t* source, uint8_t* destination, size_t nbPixels)
+{
+  for (size_t i = 0; i < nbPixels; ++i, destination += 4) {
+    destination[0] = destination[1] = destination[2] = source[i];
+    destination[3]                                   = 255;
+  }
+}
+
+void LuminanceAlphaToRGBAScalar(const uint8_t* source, uint8_t* destination, size_t nbPixels)
+{
+  for (size_t i = 0; i < nbPixels; ++i, source += 2, destination += 4) {
+    destination[0] = destination[1] = destination[2] = source[0];
+    destination[3]                                   = source[1];
+  }
+}
+
+//------------------------------------------------------------------------------
+// SSE2
+//------------------------------------------------------------------------------
+
+#ifdef BABYLON_PIXEL_CONVERSION_USE_SSE
+
+void HalfToFloatSSE2(const uint16_t* source, float* destination, size_t count)
+{
+  // The exponent and mantissa bits are moved in place and rebiased by a multiplication by 2^112,
+  // which also normalizes the denormal halves
+  const auto zero         = _mm_setzero_si128();
+  const auto expMantMask  = _mm_set1_epi32(0x7FFF);
+  const auto rebias       = _mm_castsi128_ps(_mm_set1_epi32(0x77800000));
+  const auto maxFinite    = _mm_set1_epi32(0x7BFF);
+  const auto infinity     = _mm_set1_epi32(0x7C00);
+  const auto infNaNBits   = _mm_set1_epi32(0x7F800000);
+  const auto quietNaNBits = _mm_set1_epi32(0x400000);
+  size_t i                = 0;
+  for (; i + 4 <= count; i += 4) {
+    const auto halves
+      = _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(source + i)), zero);
+    const auto expMant = _mm_and_si128(halves, expMantMask);
+    const auto sign    = _mm_slli_epi32(_mm_xor_si128(halves, expMant), 16);
+    const auto scaled  = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(expMant, 13)), rebias);
+    const auto infNaN  = _mm_and_si128(_mm_cmpgt_epi32(expMant, maxFinite), infNaNBits);
+    const auto quiet   = _mm_and_si128(_mm_cmpgt_epi32(expMant, infinity), quietNaNBits);
+    const auto bits
+      = _mm_or_si128(_mm_or_si128(_mm_castps_si128(scaled), sign), _mm_or_si128(infNaN, quiet));
+    _mm_storeu_ps(destination + i, _mm_castsi128_ps(bits));
+  }
+  HalfToFloatScalar(source + i, destination + i, count - i);
+}
+
+void FloatToByteRangeSSE2(const float* source, float* destination, size_t count)
+{
+  const auto zero  = _mm_setzero_ps();
+  const auto one   = _mm_set1_ps(1.f);
+  const auto scale = _mm_set1_ps(255.f);
+  size_t i         = 0;
+  for (; i + 4 <= count; i += 4) {
+    // maxps returns its second operand when the first one is NaN
+    const auto clamped = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(source + i), zero), one);
+    _mm_storeu_ps(destination + i, _mm_mul_ps(clamped, scale));
+  }
+  FloatToByteRangeScalar(source + i, destination + i, count - i);
+}
+
+/**
+ * Loads 4 bytes as 4 integers.
+ */
+inline __m128i LoadBytesSSE2(const uint8_t* bytes)
+{
+  int32_t packed;
+  std::memcpy(&packed, bytes, sizeof(packed));
+  const auto zero = _mm_setzero_si128();
+  return _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(packed), zero), zero);
+}
+
+/**
+ * Stores xs, ys and zs as 4 RGB pixels.
+ */
+inline void StoreRGBSSE2(float* rgb, __m128 xs, __m128 ys, __m128 zs)
+{
+  const auto a = _mm_shuffle_ps(_mm_shuffle_ps(xs, ys, _MM_SHUFFLE(0, 0, 0, 0)),
+                                _mm_shuffle_ps(zs, xs, _MM_SHUFFLE(1, 1, 0, 0)),
+                                _MM_SHUFFLE(2, 0, 2, 0));
+  const auto b = _mm_shuffle_ps(_mm_shuffle_ps(ys, zs, _MM_SHUFFLE(1, 1, 1, 1)),
+                                _mm_shuffle_ps(xs, ys, _MM_SHUFFLE(2, 2, 2, 2)),
+                                _MM_SHUFFLE(2, 0, 2, 0));
+  const auto c = _mm_shuffle_ps(_mm_shuffle_ps(zs, xs, _MM_SHUFFLE(3, 3, 2, 2)),
+                                _mm_shuffle_ps(ys, zs, _MM_SHUFFLE(3, 3, 3, 3)),
+                                _MM_SHUFFLE(2, 0, 2, 0));
+  _mm_storeu_ps(rgb, a);
+  _mm_storeu_ps(rgb + 4, b);
+  _mm_storeu_ps(rgb + 8, c);
+}
+
+void RGBEToFloatSSE2(const uint8_t* red, const uint8_t* green, const uint8_t* blue,
+                     const uint8_t* exponents, float* rgb, size_t count)
+{
+  // 2^(e - 136) does not fit in the exponent of a float for all e, it is split in two factors
+  const auto zero = _mm_setzero_si128();
+  size_t i        = 0;
+  for (; i + 4 <= count; i += 4) {
+    const auto e     = LoadBytesSSE2(exponents + i);
+    const auto half  = _mm_srli_epi32(e, 1);
+    const auto scale
+      = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(half, _mm_set1_epi32(64)), 23));
+    const auto scale2 = _mm_castsi128_ps(
+      _mm_slli_epi32(_mm_add_epi32(_mm_sub_epi32(e, half), _mm_set1_epi32(54)), 23));
+    const auto isZero = _mm_castsi128_ps(_mm_cmpeq_epi32(e, zero));
+    const auto convert = [&](const uint8_t* mantissas) {
+      const auto value = _mm_mul_ps(_mm_cvtepi32_ps(LoadBytesSSE2(mantissas + i)), scale);
+      return _mm_andnot_ps(isZero, _mm_mul_ps(value, scale2));
+    };
+    StoreRGBSSE2(rgb + i * 3, convert(red), convert(green), convert(blue));
+  }
+  RGBEToFloatScalar(red + i, green + i, blue + i, exponents + i, rgb + i * 3, count - i);
+}
+
+void LuminanceToRGBASSE2(const uint8_t* source, uint8_t* destination, size_t nbPixels)
+{
+  const auto opaque = _mm_set1_epi8(-1);
+  size_t i          = 0;
+  for (; i + 16 <= nbPixels; i += 16) {
+    const auto luminance = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+    // LL and LA pairs, interleaved as LLLA
+    const auto llLow  = _mm_unpacklo_epi8(luminance, luminance);
+    const auto llHigh = _mm_unpackhi_epi8(luminance, luminance);
+    const auto laLow  = _mm_unpacklo_epi8(luminance, opaque);
+    const auto laHigh = _mm_unpackhi_epi8(luminance, opaque);
+    auto* rgba        = reinterpret_cast<__m128i*>(destination + i * 4);
+    _mm_storeu_si128(rgba, _mm_unpacklo_epi16(llLow, laLow));
+    _mm_storeu_si128(rgba + 1, _mm_unpackhi_epi16(llLow, laLow));
+    _mm_storeu_si128(rgba + 2, _mm_unpacklo_epi16(llHigh, laHigh));
+    _mm_storeu_si128(rgba + 3, _mm_unpackhi_epi16(llHigh, laHigh));
+  }
+  LuminanceToRGBAScalar(source + i, destination + i * 4, nbPixels - i);
+}
+
+void LuminanceAlphaToRGBASSE2(const uint8_t* source, uint8_t* destination, size_t nbPixels)
+{
+  const auto luminanceMask = _mm_set1_epi16(0xFF);
+  size_t i                 = 0;
+  for (; i + 8 <= nbPixels; i += 8) {
+    const auto la = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i * 2));
+    const auto l  = _mm_and_si128(la, luminanceMask);
+    const auto ll = _mm_or_si128(l, _mm_slli_epi16(l, 8));
+    auto* rgba    = reinterpret_cast<__m128i*>(destination + i * 4);
+    _mm_storeu_si128(rgba, _mm_unpacklo_epi16(ll, la));
+    _mm_storeu_si128(rgba + 1, _mm_unpackhi_epi16(ll, la));
+  }
+  LuminanceAlphaToRGBAScalar(source + i * 2, destination + i * 4, nbPixels - i);
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+// SSSE3
+//------------------------------------------------------------------------------
+
+#ifdef BABYLON_PIXEL_CONVERSION_USE_SSSE3
+
+/**
+ * Builds the pshufb mask gathering the channels of the pixels of a register (-1 for zero).
+ */
+__m128i ShuffleMask(size_t sourceStride, size_t destinationStride, size_t nbPixels,
+                    const int* offsets)
+{
+  alignas(16) int8_t mask[16];
+  std::fill(mask, mask + 16, static_cast<int8_t>(-1));
+  for (size_t pixel = 0; pixel < nbPixels; ++pixel) {
+    for (size_t channel = 0; channel < destinationStride && offsets[channel] >= 0; ++channel) {
+      mask[pixel * destinationStride + channel]
+        = static_cast<int8_t>(pixel * sourceStride + static_cast<size_t>(offsets[channel]));
+    }
+  }
+  return _mm_load_si128(reinterpret_cast<const __m128i*>(mask));
+}
+
+BABYLON_PIXEL_CONVERSION_SSSE3_TARGET void SwizzleRGBASSSE3(const uint8_t* source,
+                                                           uint8_t* destination, size_t nbPixels,
+                                                           int rOffset, int gOffset, int bOffset,
+                                                           int aOffset)
+{
+  const int offsets[] = {rOffset, gOffset, bOffset, aOffset};
+  const auto mask     = ShuffleMask(4, 4, 4, offsets);
+  size_t i            = 0;
+  for (; i + 4 <= nbPixels; i += 4) {
+    const auto pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i * 4));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i * 4),
+                     _mm_shuffle_epi8(pixels, mask));
+  }
+  SwizzleRGBAScalar(source + i * 4, destination + i * 4, nbPixels - i, rOffset, gOffset, bOffset,
+                    aOffset);
+}
+
+BABYLON_PIXEL_CONVERSION_SSSE3_TARGET void SwizzleRGBSSSE3(const uint8_t* source,
+                                                          uint8_t* destination, size_t nbPixels,
+                                                          int rOffset, int gOffset, int bOffset)
+{
+  // 5 pixels per register, the 16th byte is overwritten by the next pixels
+  const int offsets[] = {rOffset, gOffset, bOffset};
+  const auto mask     = ShuffleMask(3, 3, 5, offsets);
+  size_t i            = 0;
+  for (; i * 3 + 16 <= nbPixels * 3; i += 5) {
+    const auto pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i * 3));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i * 3),
+                     _mm_shuffle_epi8(pixels, mask));
+  }
+  SwizzleRGBScalar(source + i * 3, destination + i * 3, nbPixels - i, rOffset, gOffset, bOffset);
+}
+
+BABYLON_PIXEL_CONVERSION_SSSE3_TARGET void RGBToRGBASSSE3(const uint8_t* source,
+                                                         uint8_t* destination, size_t nbPixels,
+                                                         int rOffset, int gOffset, int bOffset)
+{
+  // 4 pixels out of the 16 bytes loaded
+  const int offsets[] = {rOffset, gOffset, bOffset, -1};
+  const auto mask     = ShuffleMask(3, 4, 4, offsets);
+  const auto opaque   = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+  size_t i            = 0;
+  for (; i * 3 + 16 <= nbPixels * 3; i += 4) {
+    const auto pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i * 3));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i * 4),
+                     _mm_or_si128(_mm_shuffle_epi8(pixels, mask), opaque));
+  }
+  RGBToRGBAScalar(source + i * 3, destination + i * 4, nbPixels - i, rOffset, gOffset, bOffset);
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+// F16C
+//------------------------------------------------------------------------------
+
+#ifdef BABYLON_PIXEL_CONVERSION_USE_F16C
+
+BABYLON_PIXEL_CONVERSION_F16C_TARGET void HalfToFloatF16C(const uint16_t* source,
+                                                         float* destination, size_t count)
+{
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    const auto halves = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+    _mm256_storeu_ps(destination + i, _mm256_cvtph_ps(halves));
+  }
+  HalfToFloatScalar(source + i, destination + i, count - i);
+}
+
+BABYLON_PIXEL_CONVERSION_F16C_TARGET void FloatToHalfF16C(const float* source,
+                                                         uint16_t* destination, size_t count)
+{
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    const auto halves = _mm256_cvtps_ph(_mm256_loadu_ps(source + i), _MM_FROUND_TO_NEAREST_INT);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), halves);
+  }
+  FloatToHalfScalar(source + i, destination + i, count - i);
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+// NEON
+//------------------------------------------------------------------------------
+
+#ifdef BABYLON_PIXEL_CONVERSION_USE_NEON
+
+#if defined(__aarch64__)
+
+void HalfToFloatNEON(const uint16_t* source, float* destination, size_t count)
+{
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    const auto halves = vreinterpret_f16_u16(vld1_u16(source + i));
+    vst1q_f32(destination + i, vcvt_f32_f16(halves));
+  }
+  HalfToFloatScalar(source + i, destination + i, count - i);
+}
+
+void FloatToHalfNEON(const float* source, uint16_t* destination, size_t count)
+{
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    vst1_u16(destination + i, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(source + i))));
+  }
+  FloatToHalfScalar(source + i, destination + i, count - i);
+}
+
+#endif
+
+void FloatToByteRangeNEON(const float* source, float* destination, size_t count)
+{
+  const auto zero  = vdupq_n_f32(0.f);
+  const auto one   = vdupq_n_f32(1.f);
+  const auto scale = vdupq_n_f32(255.f);
+  size_t i         = 0;
+  for (; i + 4 <= count; i += 4) {
+    // The comparison is false for NaN, which becomes 0
+    const auto value    = vld1q_f32(source + i);
+    const auto positive = vbslq_f32(vcgtq_f32(value, zero), value, zero);
+    vst1q_f32(destination + i, vmulq_f32(vminq_f32(positive, one), scale));
+  }
+  FloatToByteRangeScalar(source + i, destination + i, count - i);
+}
+
+/**
+ * Converts 4 mantissas sharing the exponents to floats, see RGBEToFloatSSE2.
+ */
+inline float32x4_t RGBEChannelNEON(uint32x4_t mantissas, float32x4_t scale, float32x4_t scale2,
+                                   uint32x4_t isZero)
+{
+  const auto value = vmulq_f32(vmulq_f32(vcvtq_f32_u32(mantissas), scale), scale2);
+  return vbslq_f32(isZero, vdupq_n_f32(0.f), value);
+}
+
+void RGBEToFloatNEON(const uint8_t* red, const uint8_t* green, const uint8_t* blue,
+                     const uint8_t* exponents, float* rgb, size_t count)
+{
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    const auto e8 = vmovl_u8(vld1_u8(exponents + i));
+    const auto r8 = vmovl_u8(vld1_u8(red + i));
+    const auto g8 = vmovl_u8(vld1_u8(green + i));
+    const auto b8 = vmovl_u8(vld1_u8(blue + i));
+    for (size_t part = 0; part < 2; ++part) {
+      const auto e      = vmovl_u16(part ? vget_high_u16(e8) : vget_low_u16(e8));
+      const auto half   = vshrq_n_u32(e, 1);
+      const auto scale  = vreinterpretq_f32_u32(vshlq_n_u32(vaddq_u32(half, vdupq_n_u32(64)), 23));
+      const auto scale2 = vreinterpretq_f32_u32(
+        vshlq_n_u32(vaddq_u32(vsubq_u32(e, half), vdupq_n_u32(54)), 23));
+      const auto isZero = vceqq_u32(e, vdupq_n_u32(0));
+      float32x4x3_t pixels;
+      pixels.val[0] = RGBEChannelNEON(vmovl_u16(part ? vget_high_u16(r8) : vget_low_u16(r8)),
+                                      scale, scale2, isZero);
+      pixels.val[1] = RGBEChannelNEON(vmovl_u16(part ? vget_high_u16(g8) : vget_low_u16(g8)),
+                                      scale, scale2, isZero);
+      pixels.val[2] = RGBEChannelNEON(vmovl_u16(part ? vget_high_u16(b8) : vget_low_u16(b8)),
+                                      scale, scale2, isZero);
+      vst3q_f32(rgb + (i + part * 4) * 3, pixels);
+    }
+  }
+  RGBEToFloatScalar(red + i, green + i, blue + i, exponents + i, rgb + i * 3, count - i);
+}
+
+void SwizzleRGBANEON(const uint8_t* source, uint8_t* destination, size_t nbPixels, int rOffset,
+                     int gOffset, int bOffset, int aOffset)
+{
+  size_t i = 0;
+  for (; i + 16 <= nbPixels; i += 16) {
+    const auto pixels = vld4q_u8(source + i * 4);
+    uint8x16x4_t swizzled;
+    swizzled.val[0] = pixels.val[rOffset];
+    swizzled.val[1] = pixels.val[gOffset];
+    swizzled.val[2] = pixels.val[bOffset];
+    swizzled.val[3] = pixels.val[aOffset];
+    vst4q_u8(destination + i * 4, swizzled);
+  }
+  SwizzleRGBAScalar(source + i * 4, destination + i * 4, nbPixels - i, rOffset, gOffset, bOffset,
+                    aOffset);
+}
+
+void SwizzleRGBNEON(const uint8_t* source, uint8_t* destination, size_t nbPixels, int rOffset,
+                    int gOffset, int bOffset)
+{
+  size_t i = 0;
+  for (; i + 16 <= nbPixels; i += 16) {
+    const auto pixels = vld3q_u8(source + i * 3);
+    uint8x16x3_t swizzled;
+    swizzled.val[0] = pixels.val[rOffset];
+    swizzled.val[1] = pixels.val[gOffset];
+    swizzled.val[2] = pixels.val[bOffset];
+    vst3q_u8(destination + i * 3, swizzled);
+  }
+  SwizzleRGBScalar(source + i * 3, destination + i * 3, nbPixels - i, rOffset, gOffset, bOffset);
+}
+
+void RGBToRGBANEON(const uint8_t* source, uint8_t* destination, size_t nbPixels, int rOffset,
+                   int gOffset, int bOffset)
+{
+  size_t i = 0;
+  for (; i + 16 <= nbPixels; i += 16) {
+    const auto pixels = vld3q_u8(source + i * 3);
+    uint8x16x4_t rgba;
+    rgba.val[0] = pixels.val[rOffset];
+    rgba.val[1] = pixels.val[gOffset];
+    rgba.val[2] = pixels.val[bOffset];
+    rgba.val[3] = vdupq_n_u8(255);
+    vst4q_u8(destination + i * 4, rgba);
+  }
+  RGBToRGBAScalar(source + i * 3, destination + i * 4, nbPixels - i, rOffset, gOffset, bOffset);
+}
+
+void LuminanceToRGBANEON(const uint8_t* source, uint8_t* destination, size_t nbPixels)
+{
+  size_t i = 0;
+  for (; i + 16 <= nbPixels; i += 16) {
+    const auto luminance = vld1q_u8(source + i);
+    uint8x16x4_t rgba;
+    rgba.val[0] = rgba.val[1] = rgba.val[2] = luminance;
+    rgba.val[3]                             = vdupq_n_u8(255);
+    vst4q_u8(destination + i * 4, rgba);
+  }
+  LuminanceToRGBAScalar(source + i, destination + i * 4, nbPixels - i);
+}
+
+void LuminanceAlphaToRGBANEON(const uint8_t* source, uint8_t* destination, size_t nbPixels)
+{
+  size_t i = 0;
+  for (; i + 16 <= nbPixels; i += 16) {
+    const auto la = vld2q_u8(source + i * 2);
+    uint8x16x4_t rgba;
+    rgba.val[0] = rgba.val[1] = rgba.val[2] = la.val[0];
+    rgba.val[3]                             = la.val[1];
+    vst4q_u8(destination + i * 4, rgba);
+  }
+  LuminanceAlphaToRGBAScalar(source + i * 2, destination + i * 4, nbPixels - i);
+}
+
+#endif
+
+} // end of anonymous namespace
+
+const char* PixelConversion::InstructionSets()
+{
+  static const std::string simdInstructionSets{[]() {
+    std::string names;
+#if defined(BABYLON_PIXEL_CONVERSION_USE_SSE)
+    names = "SSE2";
+#if defined(BABYLON_PIXEL_CONVERSION_USE_SSSE3)
+    names += Features().ssse3 ? " SSSE3" : "";
+    names += Features().f16c ? " F16C" : "";
+#endif
+#elif defined(BABYLON_PIXEL_CONVERSION_USE_NEON)
+    names = "NEON";
+#endif
+    return names;
+  }()};
+  return (UseSIMD() && !simdInstructionSets.empty()) ? simdInstructionSets.c_str() : "Scalar";
+}
+
+void PixelConversion::SetSIMDEnabled(bool enabled)
+{
+  SIMDEnabled().store(enabled, std::memory_order_relaxed);
+}
+
+float PixelConversion::HalfToFloat(uint16_t value)
+{
+  return HalfToFloatScalar(value);
+}
+
+uint16_t PixelConversion::FloatToHalf(float value)
+{
+  return FloatToHalfScalar(value);
+}
+
+void PixelConversion::HalfToFloat(const uint16_t* source, float* destination, size_t count)
+{
+#if defined(BABYLON_PIXEL_CONVERSION_USE_F16C)
+  if (UseF16C()) {
+    HalfToFloatF16C(source, destination, count);
+    return;
+  }
+#endif
+#if defined(BABYLON_PIXEL_CONVERSION_USE_SSE)
+  if (UseSIMD()) {
+    HalfToFloatSSE2(source, destination, count);
+    return;
+  }
+#elif defined(BABYLON_PIXEL_CONVERSION_USE_NEON) && defined(__aarch64__)
+  if (UseSIMD()) {
+    HalfToFloatNEON(source, destination, count);
+    return;
+  }
+#endif
+  HalfToFloatScalar(source, destination, count);
+}
+
+void PixelConversion::FloatToHalf(const float* source, uint16_t* destination, size_t count)
+{
+#if defined(BABYLON_PIXEL_CONVERSION_USE_F16C)
+  if (UseF16C()) {
+    FloatToHalfF16C(source, destination, count);
+    return;
+  }
+#elif defined(BABYLON_PIXEL_CONVERSION_USE_NEON) && defined(__aarch64__)
+  if (UseSIMD()) {
+    FloatToHalfNEON(source, destination, count);
+    return;
+  }
+#endif
+  FloatToHalfScalar(source, destination, count);
+}
+
+void PixelConversion::FloatToByteRange(const float* source, float* destination, size_t count)
+{
+#if defined(BABYLON_PIXEL_CONVERSION_USE_SSE)
+  if (UseSIMD()) {
+    FloatToByteRangeSSE2(source, destination, count);
+    return;
+  }
+#elif defined(BABYLON_PIXEL_CONVERSION_USE_NEON)
+  if (UseSIMD()) {
+    FloatToByteRangeNEON(source, destination, count);
+    return;
+  }
+#endif
+  FloatToByteRangeScalar(source, destination, count);
+}
+
+void PixelConversion::HalfToByteRange(const uint16_t* source, float* destination, size_t count)
+{
+  // Converted by blocks which stay in the L1 cache for the second pass
+  constexpr size_t blockSize = 2048;
+  for (size_t i = 0; i < count; i += blockSize) {
+    const auto blockCount = std::min(blockSize, count - i);
+    HalfToFloat(source + i, destination + i, blockCount);
+    FloatToByteRange(destination + i, destination + i, blockCount);
+  }
+}
+
+void PixelConversion::FillAlpha(float* rgba, size_t nbPixels, float alpha)
+{
+  for (size_t i = 0; i < nbPixels; ++i) {
+    rgba[i * 4 + 3] = alpha;
+  }
+}
+
+void PixelConversion::FillAlpha(uint16_t* rgba, size_t nbPixels, uint16_t alpha)
+{
+  for (size_t i = 0; i < nbPixels; ++i) {
+    rgba[i * 4 + 3] = alpha;
+  }
+}
+
+void PixelConversion::RGBEToFloat(const uint8_t* red, const uint8_t* green, const uint8_t* blue,
+                                  const uint8_t* exponents, float* rgb, size_t count)
+{
+#if defined(BABYLON_PIXEL_CONVERSION_USE_SSE)
+  if (UseSIMD()) {
+    RGBEToFloatSSE2(red, green, blue, exponents, rgb, count);
+    return;
+  }
+#elif defined(BABYLON_PIXEL_CONVERSION_USE_NEON)
+  if (UseSIMD()) {
+    RGBEToFloatNEON(red, green, blue, exponents, rgb, count);
+    return;
+  }
+#endif
+  RGBEToFloatScalar(red, green, blue, exponents, rgb, count);
+}
+
+void PixelConversion::FloatToRGBD(const float* rgb, uint8_t* rgbd, size_t nbPixels)
+{
+  // Same encoding as the rgbdEncode shader (toRGBD)
+  constexpr float rgbdMaxRange = 255.f;
+  constexpr float epsilon      = 0.0000001f;
+  constexpr float toGamma      = 1.f / 2.2f;
+  const auto toByte            = [](float value) {
+    return static_cast<uint8_t>(std::lround(std::clamp(value, 0.f, 1.f) * 255.f));
+  };
+  for (size_t i = 0; i < nbPixels; ++i, rgb += 3, rgbd += 4) {
+    const auto maxRGB = std::max(std::max(rgb[0], std::max(rgb[1], rgb[2])), epsilon);
+    auto d            = std::max(rgbdMaxRange / maxRGB, 1.f);
+    d                 = std::clamp(std::floor(d) / 255.f, 0.f, 1.f);
+    rgbd[0]           = toByte(std::pow(std::max(rgb[0], 0.f) * d, toGamma));
+    rgbd[1]           = toByte(std::pow(std::max(rgb[1], 0.f) * d, toGamma));
+    rgbd[2]           = toByte(std::pow(std::max(rgb[2], 0.f) * d, toGamma));
+    rgbd[3]           = toByte(d);
+  }
+}
+
+void PixelConversion::SwizzleRGBA(const uint8_t* source, uint8_t* destination, size_t nbPixels,
+                                  int rOffset, int gOffset, int bOffset, int aOffset)
+{
+#if defined(BABYLON_PIXEL_CONVERSION_USE_SSSE3)
+  if (UseSSSE3()) {
+    SwizzleRGBASSSE3(source, destination, nbPixels, rOffset, gOffset, bOffset, aOffset);
+    return;
+  }
+#elif defined(BABYLON_PIXEL_CONVERSION_USE_NEON)
+  if (UseSIMD()) {
+    SwizzleRGBANEON(source, destination, nbPixels, rOffset, gOffset, bOffset, aOffset);
+    return;
+  }
+#endif
+  SwizzleRGBAScalar(source, destination, nbPixels, rOffset, gOffset, bOffset, aOffset);
+}
+
+void PixelConversion::SwizzleRGB(const uint8_t* source, uint8_t* destination, size_t nbPixels,
+                                 int rOffset, int gOffset, int bOffset)
+{
+#if defined(BABYLON_PIXEL_CONVERSION_USE_SSSE3)
+  if (UseSSSE3()) {
+    SwizzleRGBSSSE3(source, destination, nbPixels, rOffset, gOffset, bOffset);
+    return;
+  }
+#elif defined(BABYLON_PIXEL_CONVERSION_USE_NEON)
+  if (UseSIMD()) {
+    SwizzleRGBNEON(source, destination, nbPixels, rOffset, gOffset, bOffset);
+    return;
+  }
+#endif
+  SwizzleRGBScalar(source, destination, nbPixels, rOffset, gOffset, bOffset);
+}
+
+void PixelConversion::RGBToRGBA(const uint8_t* source, uint8_t* destination, size_t nbPixels,
+                                int rOffset, int gOffset, int bOffset)
+{
+#if defined(BABYLON_PIXEL_CONVERSION_USE_SSSE3)
+  if (UseSSSE3()) {
+    RGBToRGBASSSE3(source, destination, nbPixels, rOffset, gOffset, bOffset);
+    return;
+  }
+#elif defined(BABYLON_PIXEL_CONVERSION_USE_NEON)
+  if (UseSIMD()) {
+    RGBToRGBANEON(source, destination, nbPixels, rOffset, gOffset, bOffset);
+    return;
+  }
+#endif
+  RGBToRGBAScalar(source, destination, nbPixels, rOffset, gOffset, bOffset);
+}
+
+void PixelConversion::LuminanceToRGBA(const uint8_t* source, uint8_t* destination,
+                                      size_t nbPixels)
+{
+#if defined(BABYLON_PIXEL_CONVERSION_USE_SSE)
+  if (UseSIMD()) {
+    LuminanceToRGBASSE2(source, destination, nbPixels);
+    return;
+  }
+#elif defined(BABYLON_PIXEL_CONVERSION_USE_NEON)
+  if (UseSIMD()) {
+    LuminanceToRGBANEON(source, destination, nbPixels);
+    return;
+  }
+#endif
+  LuminanceToRGBAScalar(source, destination, nbPixels);
+}
+
+void PixelConversion::LuminanceAlphaToRGBA(const uint8_t* source, uint8_t* destination,
+                                           size_t nbPixels)
+{
+#if defined(BABYLON_PIXEL_CONVERSION_USE_SSE)
+  if (UseSIMD()) {
+    LuminanceAlphaToRGBASSE2(source, destination, nbPixels);
+    return;
+  }
+#elif defined(BABYLON_PIXEL_CONVERSION_USE_NEON)
+  if (UseSIMD()) {
+    LuminanceAlphaToRGBANEON(source, destination, nbPixels);
+    return;
+  }
+#endif
+  LuminanceAlphaToRGBAScalar(source, destination, nbPixels);
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,269 @@
+#include <babylon/misc/texture_pipeline.h>
+
+#include <algorithm>
+#include <chrono>
+
+#include <babylon/misc/file_tools.h>
+
+namespace BABYLON {
+
+namespace {
+
+using Clock = std::chrono::high_resolution_clock;
+
+double ElapsedMs(const Clock::time_point& start)
+{
+  return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+} // end of anonymous namespace
+
+TexturePipeline::TexturePipeline(size_t nbWorkers)
+    : premultiplyAlpha{false}
+    , generateMipMaps{false}
+    , uploadBudget{4.0}
+    , maxStagingBuffers{16}
+    , _stopping{false}
+    , _decodingImages{0}
+    , _generation{0}
+{
+  if (nbWorkers == 0) {
+    const auto hardwareConcurrency = static_cast<size_t>(std::thread::hardware_concurrency());
+    nbWorkers = std::clamp(hardwareConcurrency, size_t{2}, size_t{9}) - 1;
+  }
+  _workers.reserve(nbWorkers);
+  for (size_t i = 0; i < nbWorkers; ++i) {
+    _workers.emplace_back([this]() { _workerLoop(); });
+  }
+}
+
+TexturePipeline::~TexturePipeline()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stopping = true;
+  }
+  _wakeCondition.notify_all();
+  for (auto& worker : _workers) {
+    worker.join();
+  }
+}
+
+void TexturePipeline::PremultiplyAlpha(Image& image)
+{
+  const auto nbPixels = static_cast<size_t>(image.width) * static_cast<size_t>(image.height);
+  if (image.depth != 4 || image.data.size() != nbPixels * 4) {
+    return;
+  }
+
+  auto* pixel = image.data.data();
+  for (size_t i = 0; i < nbPixels; ++i, pixel += 4) {
+    const unsigned int alpha = pixel[3];
+    for (unsigned int c = 0; c < 3; ++c) {
+      pixel[c] = static_cast<uint8_t>((pixel[c] * alpha + 127u) / 255u);
+    }
+  }
+}
+
+Image TexturePipeline::DownsampleImage(const Image& image, ArrayBuffer&& storage)
+{
+  const auto width  = static_cast<size_t>(std::max(image.width / 2, 1));
+  const auto height = static_cast<size_t>(std::max(image.height / 2, 1));
+  const auto sourceWidth  = static_cast<size_t>(image.width);
+  const auto sourceHeight = static_cast<size_t>(image.height);
+  storage.resize(width * height * 4);
+
+  const auto* source = image.data.data();
+  auto* destination  = storage.data();
+  for (size_t y = 0; y < height; ++y) {
+    // Odd sizes: the last row (or column) is averaged with itself
+    const auto row0 = source + std::min(y * 2, sourceHeight - 1) * sourceWidth * 4;
+    const auto row1 = source + std::min(y * 2 + 1, sourceHeight - 1) * sourceWidth * 4;
+    for (size_t x = 0; x < width; ++x, destination += 4) {
+      const auto x0 = std::min(x * 2, sourceWidth - 1) * 4;
+      const auto x1 = std::min(x * 2 + 1, sourceWidth - 1) * 4;
+      for (size_t c = 0; c < 4; ++c) {
+        const unsigned int sum = row0[x0 + c] + row0[x1 + c] + row1[x0 + c] + row1[x1 + c];
+        destination[c]         = static_cast<uint8_t>((sum + 2u) / 4u);
+      }
+    }
+  }
+
+  return Image(std::move(storage), static_cast<int>(width), static_cast<int>(height), 4,
+               image.mode);
+}
+
+void TexturePipeline::loadImageFromUrl(const std::string& url, bool flipVertically,
+                                       const OnLoadFunction& onLoad,
+                                       const OnErrorFunction& onError)
+{
+  const auto onSuccess = [this, url, flipVertically, onLoad,
+                          onError](const std::variant<std::string, ArrayBuffer>& data,
+                                   const std::string& /*responseURL*/) {
+    decodeAsync(url, std::get<ArrayBuffer>(data), flipVertically, onLoad, onError);
+  };
+  FileTools::LoadFile(url, onSuccess, nullptr, true, onError);
+}
+
+void TexturePipeline::decodeAsync(const std::string& url, ArrayBuffer buffer,
+                                  bool flipVertically, const OnLoadFunction& onLoad,
+                                  const OnErrorFunction& onError)
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _decodeQueue.emplace_back(DecodeRequest{url, std::move(buffer), flipVertically,
+                                            premultiplyAlpha, generateMipMaps, onLoad, onError});
+  }
+  _wakeCondition.notify_one();
+}
+
+size_t TexturePipeline::uploadDecodedImages()
+{
+  const auto start = Clock::now();
+  size_t uploaded  = 0;
+  while (true) {
+    DecodedImage decoded;
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (_decodedImages.empty()) {
+        break;
+      }
+      decoded = std::move(_decodedImages.front());
+      _decodedImages.pop_front();
+    }
+
+    const auto uploadStart = Clock::now();
+    const auto valid       = decoded.image.valid();
+    if (valid && decoded.onLoad) {
+      decoded.onLoad(decoded.image, decoded.mipMaps);
+    }
+    else if (!valid && decoded.onError) {
+      decoded.onError("Unable to decode image " + decoded.url, "");
+    }
+    TextureLoadTiming timing{decoded.url, decoded.image.width, decoded.image.height,
+                             decoded.decodeMs, ElapsedMs(uploadStart)};
+    ++uploaded;
+
+    // The pixels are not referenced once uploaded
+    _releaseStagingBuffer(std::move(decoded.image.data));
+    for (auto& mipMap : decoded.mipMaps) {
+      _releaseStagingBuffer(std::move(mipMap.data));
+    }
+
+    if (valid) {
+      onImageUploadedObservable.notifyObservers(&timing);
+    }
+    if (ElapsedMs(start) >= uploadBudget) {
+      break;
+    }
+  }
+
+  return uploaded;
+}
+
+size_t TexturePipeline::pendingImages() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _decodeQueue.size() + _decodingImages + _decodedImages.size();
+}
+
+void TexturePipeline::waitDecoding()
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  _idleCondition.wait(lock, [this]() { return _decodeQueue.empty() && _decodingImages == 0; });
+}
+
+void TexturePipeline::clear()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _decodeQueue.clear();
+  _decodedImages.clear();
+  ++_generation;
+}
+
+void TexturePipeline::_workerLoop()
+{
+  while (true) {
+    DecodeRequest request;
+    uint64_t generation = 0;
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _wakeCondition.wait(lock, [this]() { return _stopping || !_decodeQueue.empty(); });
+      if (_stopping) {
+        return;
+      }
+      request = std::move(_decodeQueue.front());
+      _decodeQueue.pop_front();
+      generation = _generation;
+      ++_decodingImages;
+    }
+
+    auto decoded = _decode(request);
+
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      --_decodingImages;
+      if (generation == _generation) {
+        _decodedImages.emplace_back(std::move(decoded));
+      }
+    }
+    _idleCondition.notify_all();
+  }
+}
+
+TexturePipeline::DecodedImage TexturePipeline::_decode(DecodeRequest& request)
+{
+  const auto start = Clock::now();
+
+  DecodedImage decoded;
+  decoded.url     = std::move(request.url);
+  decoded.onLoad  = std::move(request.onLoad);
+  decoded.onError = std::move(request.onError);
+  decoded.image   = FileTools::ArrayBufferToImage(request.buffer, request.flipVertically,
+                                                _acquireStagingBuffer());
+  ArrayBuffer().swap(request.buffer);
+
+  if (decoded.image.valid()) {
+    if (request.premultiplyAlpha) {
+      PremultiplyAlpha(decoded.image);
+    }
+    if (request.generateMipMaps) {
+      // Levels down to 1x1, each one filtered from the previous one
+      auto size = std::max(decoded.image.width, decoded.image.height);
+      while (size > 1) {
+        const auto& previous
+          = decoded.mipMaps.empty() ? decoded.image : decoded.mipMaps.back();
+        auto mipMap = DownsampleImage(previous, _acquireStagingBuffer());
+        decoded.mipMaps.emplace_back(std::move(mipMap));
+        size /= 2;
+      }
+    }
+  }
+
+  decoded.decodeMs = ElapsedMs(start);
+  return decoded;
+}
+
+ArrayBuffer TexturePipeline::_acquireStagingBuffer()
+{
+  std::lock_guard<std::mutex> lock(_stagingMutex);
+  if (_stagingBuffers.empty()) {
+    return ArrayBuffer();
+  }
+  auto buffer = std::move(_stagingBuffers.back());
+  _stagingBuffers.pop_back();
+  return buffer;
+}
+
+void TexturePipeline::_releaseStagingBuffer(ArrayBuffer&& buffer)
+{
+  if (buffer.capacity() == 0) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(_stagingMutex);
+  if (_stagingBuffers.size() < maxStagingBuffers) {
+    _stagingBuffers.emplace_back(std::move(buffer));
+  }
+}
+
+} // end of namespace BABYLON
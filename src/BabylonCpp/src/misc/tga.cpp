@@ -1,12 +1,52 @@
 #include <babylon/misc/tga.h>
 
+#include <algorithm>
+
 #include <babylon/babylon_stl_util.h>
 #include <babylon/core/logging.h>
 #include <babylon/engines/engine.h>
 #include <babylon/materials/textures/internal_texture.h>
+#include <babylon/misc/pixel_conversion.h>
 
 namespace BABYLON {
 
+namespace {
+
+/**
+ * Converts the pixels to RGBA row by row, the rows stored from right to left
+ * being reversed once converted.
+ */
+template <typename ConvertRow>
+Uint8Array ConvertRows(const TGAHeader& header, const Uint8Array& pixel_data,
+                       size_t bytesPerPixel, int32_t y_start, int32_t y_step,
+                       int32_t y_end, int32_t x_step,
+                       const ConvertRow& convertRow)
+{
+  const auto width  = static_cast<size_t>(header.width);
+  const auto height = static_cast<size_t>(header.height);
+
+  auto imageData = Uint8Array(width * height * 4);
+  if (pixel_data.size() < width * height * bytesPerPixel) {
+    return imageData;
+  }
+
+  const auto* source = pixel_data.data();
+  for (auto y = y_start; y != y_end;
+       y += y_step, source += width * bytesPerPixel) {
+    auto* row = imageData.data() + static_cast<size_t>(y) * width * 4;
+    convertRow(source, row, width);
+    if (x_step < 0 && width > 1) {
+      for (size_t left = 0, right = width - 1; left < right; ++left, --right) {
+        std::swap_ranges(row + left * 4, row + left * 4 + 4, row + right * 4);
+      }
+    }
+  }
+
+  return imageData;
+}
+
+} // end of anonymous namespace
+
 TGAHeader TGATools::GetTGAHeader(const Uint8Array& data)
 {
   auto offset    = 0u;
@@ -300,110 +340,56 @@ Uint8Array TGATools::_getImageData24bits(const TGAHeader& header,
                                          const Uint8Array& /*palettes*/,
                                          const Uint8Array& pixel_data,
                                          int32_t y_start, int32_t y_step,
-                                         int32_t y_end, int32_t x_start,
-                                         int32_t x_step, int32_t x_end)
+                                         int32_t y_end, int32_t /*x_start*/,
+                                         int32_t x_step, int32_t /*x_end*/)
 {
-  const auto& image = pixel_data;
-  auto width = header.width, height = header.height;
-  auto i = 0, x = 0, y = 0;
-
-  auto imageData = Uint8Array(static_cast<uint32_t>(width * height * 4));
-
-  for (y = y_start; y != y_end; y += y_step) {
-    for (x = x_start; x != x_end; x += x_step, i += 3) {
-      const auto xwy         = static_cast<uint32_t>(x + width * y);
-      const auto _i          = static_cast<uint32_t>(i);
-      imageData[xwy * 4 + 3] = 255;
-      imageData[xwy * 4 + 2] = image[_i + 0];
-      imageData[xwy * 4 + 1] = image[_i + 1];
-      imageData[xwy * 4 + 0] = image[_i + 2];
-    }
-  }
-
-  return imageData;
+  return ConvertRows(
+    header, pixel_data, 3, y_start, y_step, y_end, x_step,
+    [](const uint8_t* source, uint8_t* destination, size_t nbPixels) {
+      PixelConversion::RGBToRGBA(source, destination, nbPixels, 2, 1, 0);
+    });
 }
 
 Uint8Array TGATools::_getImageData32bits(const TGAHeader& header,
                                          const Uint8Array& /*palettes*/,
                                          const Uint8Array& pixel_data,
                                          int32_t y_start, int32_t y_step,
-                                         int32_t y_end, int32_t x_start,
-                                         int32_t x_step, int32_t x_end)
+                                         int32_t y_end, int32_t /*x_start*/,
+                                         int32_t x_step, int32_t /*x_end*/)
 {
-  const auto& image = pixel_data;
-  auto width = header.width, height = header.height;
-  auto i = 0, x = 0, y = 0;
-
-  auto imageData = Uint8Array(static_cast<uint32_t>(width * height * 4));
-
-  for (y = y_start; y != y_end; y += y_step) {
-    for (x = x_start; x != x_end; x += x_step, i += 4) {
-      const auto xwy         = static_cast<uint32_t>(x + width * y);
-      const auto _i          = static_cast<uint32_t>(i);
-      imageData[xwy * 4 + 2] = image[_i + 0];
-      imageData[xwy * 4 + 1] = image[_i + 1];
-      imageData[xwy * 4 + 0] = image[_i + 2];
-      imageData[xwy * 4 + 3] = image[_i + 3];
-    }
-  }
-
-  return imageData;
+  return ConvertRows(
+    header, pixel_data, 4, y_start, y_step, y_end, x_step,
+    [](const uint8_t* source, uint8_t* destination, size_t nbPixels) {
+      PixelConversion::SwizzleRGBA(source, destination, nbPixels, 2, 1, 0, 3);
+    });
 }
 
 Uint8Array TGATools::_getImageDataGrey8bits(const TGAHeader& header,
                                             const Uint8Array& /*palettes*/,
                                             const Uint8Array& pixel_data,
                                             int32_t y_start, int32_t y_step,
-                                            int32_t y_end, int32_t x_start,
-                                            int32_t x_step, int32_t x_end)
+                                            int32_t y_end, int32_t /*x_start*/,
+                                            int32_t x_step, int32_t /*x_end*/)
 {
-  const auto& image = pixel_data;
-  auto width = header.width, height = header.height;
-  uint8_t color = 0;
-  auto i = 0, x = 0, y = 0;
-
-  auto imageData = Uint8Array(static_cast<uint32_t>(width * height * 4));
-
-  for (y = y_start; y != y_end; y += y_step) {
-    for (x = x_start; x != x_end; x += x_step, i++) {
-      const auto xwy         = static_cast<uint32_t>(x + width * y);
-      const auto _i          = static_cast<uint32_t>(i);
-      color                  = image[_i];
-      imageData[xwy * 4 + 0] = color;
-      imageData[xwy * 4 + 1] = color;
-      imageData[xwy * 4 + 2] = color;
-      imageData[xwy * 4 + 3] = 255;
-    }
-  }
-
-  return imageData;
+  return ConvertRows(
+    header, pixel_data, 1, y_start, y_step, y_end, x_step,
+    [](const uint8_t* source, uint8_t* destination, size_t nbPixels) {
+      PixelConversion::LuminanceToRGBA(source, destination, nbPixels);
+    });
 }
 
 Uint8Array TGATools::_getImageDataGrey16bits(const TGAHeader& header,
                                              const Uint8Array& /*palettes*/,
                                              const Uint8Array& pixel_data,
                                              int32_t y_start, int32_t y_step,
-                                             int32_t y_end, int32_t x_start,
-                                             int32_t x_step, int32_t x_end)
+                                             int32_t y_end, int32_t /*x_start*/,
+                                             int32_t x_step, int32_t /*x_end*/)
 {
-  const auto& image = pixel_data;
-  auto width = header.width, height = header.height;
-  auto i = 0, x = 0, y = 0;
-
-  auto imageData = Uint8Array(static_cast<uint32_t>(width * height * 4));
-
-  for (y = y_start; y != y_end; y += y_step) {
-    for (x = x_start; x != x_end; x += x_step, i += 2) {
-      const auto xwy         = static_cast<uint32_t>(x + width * y);
-      const auto _i          = static_cast<uint32_t>(i);
-      imageData[xwy * 4 + 0] = image[_i + 0];
-      imageData[xwy * 4 + 1] = image[_i + 0];
-      imageData[xwy * 4 + 2] = image[_i + 0];
-      imageData[xwy * 4 + 3] = image[_i + 1];
-    }
-  }
-
-  return imageData;
+  return ConvertRows(
+    header, pixel_data, 2, y_start, y_step, y_end, x_step,
+    [](const uint8_t* source, uint8_t* destination, size_t nbPixels) {
+      PixelConversion::LuminanceAlphaToRGBA(source, destination, nbPixels);
+    });
 }
 
 } // end of namespace BABYLON
@@ -66,6 +66,18 @@ void MorphTarget::setProperty(const std::vector<std::string>& targetPropertyPath
   }
 }
 
+AnimatedPropertySetter
+MorphTarget::_getAnimatedPropertySetter(const std::vector<std::string>& targetPropertyPath,
+                                        unsigned int animationType)
+{
+  if (animationType == Animation::ANIMATIONTYPE_FLOAT && targetPropertyPath.size() == 1
+      && targetPropertyPath[0] == "influence") {
+    return [this](const float* value) { influence = value[0]; };
+  }
+
+  return nullptr;
+}
+
 float MorphTarget::get_influence() const
 {
   return _influence;
@@ -6,6 +6,8 @@
 #include <babylon/engines/scene.h>
 #include <babylon/meshes/abstract_mesh.h>
 #include <babylon/meshes/mesh.h>
+#include <babylon/meshes/software_skinning.h>
+#include <babylon/meshes/vertex_buffer.h>
 
 namespace BABYLON {
 
@@ -197,6 +199,39 @@ void MorphTargetManager::synchronize()
   }
 }
 
+bool MorphTargetManager::blendVertexData(const std::string& kind, const Float32Array& source,
+                                         Float32Array& result, JobPool* jobPool) const
+{
+  std::vector<const float*> targets;
+  Float32Array targetInfluences;
+  targets.reserve(_activeTargets.size());
+  targetInfluences.reserve(_activeTargets.size());
+  for (const auto& target : _activeTargets) {
+    const MorphTarget& morphTarget = *target;
+    const Float32Array* data       = nullptr;
+    if (kind == VertexBuffer::PositionKind) {
+      data = &morphTarget.getPositions();
+    }
+    else if (kind == VertexBuffer::NormalKind) {
+      data = &morphTarget.getNormals();
+    }
+    else if (kind == VertexBuffer::UVKind) {
+      data = &morphTarget.getUVs();
+    }
+    if (!data || data->size() != source.size()) {
+      return false;
+    }
+    targets.emplace_back(data->data());
+    targetInfluences.emplace_back(morphTarget.influence());
+  }
+
+  result.resize(source.size());
+  SoftwareSkinning::Morph(source.data(), targets, targetInfluences.data(), result.data(),
+                          source.size(), jobPool);
+
+  return true;
+}
+
 MorphTargetManagerPtr MorphTargetManager::Parse(const json& serializationObject, Scene* scene)
 {
   auto result = MorphTargetManager::New(scene);
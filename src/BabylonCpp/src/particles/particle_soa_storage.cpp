@@ -0,0 +1,362 @@
+#include <babylon/particles/particle_soa_storage.h>
+
+#include <algorithm>
+
+#include <babylon/misc/color_gradient.h>
+#include <babylon/misc/factor_gradient.h>
+#include <babylon/particles/particle.h>
+
+namespace BABYLON {
+
+namespace {
+
+// The kernels below are unit stride loops over __restrict parameters. Selections are written as
+// arithmetic masks instead of branches, as floating point comparisons are not if-converted (and
+// the loops not vectorized) under the default -ftrapping-math.
+
+// out[i] = value
+void Fill(float* __restrict out, float value, size_t count)
+{
+  for (size_t i = 0; i < count; ++i) {
+    out[i] = value;
+  }
+}
+
+// out[i] *= factor[i]
+void Multiply(float* __restrict out, const float* __restrict factor, size_t count)
+{
+  for (size_t i = 0; i < count; ++i) {
+    out[i] *= factor[i];
+  }
+}
+
+// out[i] *= 1 - factor[i]
+void MultiplyOneMinus(float* __restrict out, const float* __restrict factor, size_t count)
+{
+  for (size_t i = 0; i < count; ++i) {
+    out[i] *= 1.f - factor[i];
+  }
+}
+
+// out[i] += value[i] * scale[i]
+void MultiplyAdd(float* __restrict out, const float* __restrict value,
+                 const float* __restrict scale, size_t count)
+{
+  for (size_t i = 0; i < count; ++i) {
+    out[i] += value[i] * scale[i];
+  }
+}
+
+// out[i] += value * scale[i]
+void ScaleAdd(float* __restrict out, float value, const float* __restrict scale, size_t count)
+{
+  for (size_t i = 0; i < count; ++i) {
+    out[i] += value * scale[i];
+  }
+}
+
+// out[i] = max(out[i], 0)
+void ClampToZero(float* __restrict out, size_t count)
+{
+  for (size_t i = 0; i < count; ++i) {
+    out[i] = std::max(out[i], 0.f);
+  }
+}
+
+// Ages the particles, the step is clamped so that a particle does not live past its life time
+void IntegrateAge(float* __restrict age, const float* __restrict lifeTime, float* __restrict step,
+                  float* __restrict ratio, float scaledUpdateSpeed, size_t count)
+{
+  for (size_t i = 0; i < count; ++i) {
+    const auto remainingLife = lifeTime[i] - age[i];
+    const auto isDying       = static_cast<float>(scaledUpdateSpeed > remainingLife);
+    step[i]                  = scaledUpdateSpeed + isDying * (remainingLife - scaledUpdateSpeed);
+    age[i] += step[i];
+    ratio[i] = age[i] / lifeTime[i];
+  }
+}
+
+// Replaces out[i] by the interpolation of [value1, value2] where ratio[i] is in
+// [gradient1, gradient2]
+void SampleSegment(float* __restrict out, const float* __restrict ratio, float gradient1,
+                   float gradient2, float value1, float value2, size_t count)
+{
+  const auto slope = (value2 - value1) / (gradient2 - gradient1);
+  for (size_t i = 0; i < count; ++i) {
+    const auto inSegment = static_cast<float>((ratio[i] >= gradient1) & (ratio[i] <= gradient2));
+    const auto value     = value1 + (ratio[i] - gradient1) * slope;
+    out[i] += inSegment * (value - out[i]);
+  }
+}
+
+// Damps the directions longer than their limit (a negative limit is always exceeded)
+void LimitVelocity(float* __restrict directionX, float* __restrict directionY,
+                   float* __restrict directionZ, const float* __restrict limitVelocity,
+                   float limitVelocityDamping, size_t count)
+{
+  for (size_t i = 0; i < count; ++i) {
+    const auto velocitySquared = directionX[i] * directionX[i] + directionY[i] * directionY[i]
+                                 + directionZ[i] * directionZ[i];
+    const auto isOverLimit
+      = static_cast<float>((velocitySquared > limitVelocity[i] * limitVelocity[i])
+                           | (limitVelocity[i] < 0.f));
+    const auto damping = 1.f + isOverLimit * (limitVelocityDamping - 1.f);
+    directionX[i] *= damping;
+    directionY[i] *= damping;
+    directionZ[i] *= damping;
+  }
+}
+
+} // end of anonymous namespace
+
+ParticleSoAStorage::ParticleSoAStorage() : _count{0}
+{
+}
+
+ParticleSoAStorage::~ParticleSoAStorage() = default;
+
+void ParticleSoAStorage::resize(size_t count)
+{
+  for (auto* array :
+       {&_positionX, &_positionY, &_positionZ, &_directionX, &_directionY, &_directionZ,
+        &_initialDirectionX, &_initialDirectionY, &_initialDirectionZ, &_hasInitialDirection,
+        &_colorR, &_colorG, &_colorB, &_colorA, &_colorStepR, &_colorStepG, &_colorStepB,
+        &_colorStepA, &_age, &_lifeTime, &_size, &_scaleX, &_scaleY, &_angle, &_angularSpeed,
+        &_step, &_ratio, &_directionScale, &_scratch}) {
+    array->resize(count);
+  }
+  _count = count;
+}
+
+void ParticleSoAStorage::load(size_t index, const Particle& particle)
+{
+  _positionX[index]  = particle.position.x;
+  _positionY[index]  = particle.position.y;
+  _positionZ[index]  = particle.position.z;
+  _directionX[index] = particle.direction.x;
+  _directionY[index] = particle.direction.y;
+  _directionZ[index] = particle.direction.z;
+  if (particle._initialDirection) {
+    _initialDirectionX[index]   = particle._initialDirection->x;
+    _initialDirectionY[index]   = particle._initialDirection->y;
+    _initialDirectionZ[index]   = particle._initialDirection->z;
+    _hasInitialDirection[index] = 1.f;
+  }
+  else {
+    _hasInitialDirection[index] = 0.f;
+  }
+  _colorR[index]       = particle.color.r;
+  _colorG[index]       = particle.color.g;
+  _colorB[index]       = particle.color.b;
+  _colorA[index]       = particle.color.a;
+  _colorStepR[index]   = particle.colorStep.r;
+  _colorStepG[index]   = particle.colorStep.g;
+  _colorStepB[index]   = particle.colorStep.b;
+  _colorStepA[index]   = particle.colorStep.a;
+  _age[index]          = particle.age;
+  _lifeTime[index]     = particle.lifeTime;
+  _size[index]         = particle.size;
+  _scaleX[index]       = particle.scale.x;
+  _scaleY[index]       = particle.scale.y;
+  _angle[index]        = particle.angle;
+  _angularSpeed[index] = particle.angularSpeed;
+}
+
+void ParticleSoAStorage::store(size_t index, Particle& particle) const
+{
+  particle.position.copyFromFloats(_positionX[index], _positionY[index], _positionZ[index]);
+  particle.direction.copyFromFloats(_directionX[index], _directionY[index], _directionZ[index]);
+  particle.color.set(_colorR[index], _colorG[index], _colorB[index], _colorA[index]);
+  particle.colorStep.set(_colorStepR[index], _colorStepG[index], _colorStepB[index],
+                         _colorStepA[index]);
+  particle.age          = _age[index];
+  particle.lifeTime     = _lifeTime[index];
+  particle.size         = _size[index];
+  particle.angle        = _angle[index];
+  particle.angularSpeed = _angularSpeed[index];
+  particle.scale.copyFromFloats(_scaleX[index], _scaleY[index]);
+}
+
+void ParticleSoAStorage::copy(size_t from, size_t to)
+{
+  for (auto* array :
+       {&_positionX, &_positionY, &_positionZ, &_directionX, &_directionY, &_directionZ,
+        &_initialDirectionX, &_initialDirectionY, &_initialDirectionZ, &_hasInitialDirection,
+        &_colorR, &_colorG, &_colorB, &_colorA, &_colorStepR, &_colorStepG, &_colorStepB,
+        &_colorStepA, &_age, &_lifeTime, &_size, &_scaleX, &_scaleY, &_angle, &_angularSpeed}) {
+    (*array)[to] = (*array)[from];
+  }
+}
+
+void ParticleSoAStorage::integrateAge(float scaledUpdateSpeed)
+{
+  IntegrateAge(_age.data(), _lifeTime.data(), _step.data(), _ratio.data(), scaledUpdateSpeed,
+               _count);
+}
+
+void ParticleSoAStorage::integrateColor()
+{
+  MultiplyAdd(_colorR.data(), _colorStepR.data(), _step.data(), _count);
+  MultiplyAdd(_colorG.data(), _colorStepG.data(), _step.data(), _count);
+  MultiplyAdd(_colorB.data(), _colorStepB.data(), _step.data(), _count);
+  MultiplyAdd(_colorA.data(), _colorStepA.data(), _step.data(), _count);
+  ClampToZero(_colorA.data(), _count);
+}
+
+void ParticleSoAStorage::sampleColor(const std::vector<ColorGradient>& colorGradients)
+{
+  // Over the last gradient
+  const auto& last = colorGradients.back().color1;
+  Fill(_colorR.data(), last.r, _count);
+  Fill(_colorG.data(), last.g, _count);
+  Fill(_colorB.data(), last.b, _count);
+  Fill(_colorA.data(), last.a, _count);
+
+  // Segments are visited backward so that the first matching one wins, as in GradientHelper
+  for (size_t segment = colorGradients.size() - 1; segment-- > 0;) {
+    const auto& gradient1 = colorGradients[segment];
+    const auto& gradient2 = colorGradients[segment + 1];
+    const auto* ratio     = _ratio.data();
+    SampleSegment(_colorR.data(), ratio, gradient1.gradient, gradient2.gradient,
+                  gradient1.color1.r, gradient2.color1.r, _count);
+    SampleSegment(_colorG.data(), ratio, gradient1.gradient, gradient2.gradient,
+                  gradient1.color1.g, gradient2.color1.g, _count);
+    SampleSegment(_colorB.data(), ratio, gradient1.gradient, gradient2.gradient,
+                  gradient1.color1.b, gradient2.color1.b, _count);
+    SampleSegment(_colorA.data(), ratio, gradient1.gradient, gradient2.gradient,
+                  gradient1.color1.a, gradient2.color1.a, _count);
+  }
+}
+
+void ParticleSoAStorage::sampleAngularSpeed(
+  const std::vector<FactorGradient>& angularSpeedGradients)
+{
+  _sampleFactorGradients(angularSpeedGradients, _angularSpeed.data());
+}
+
+void ParticleSoAStorage::integrateAngle()
+{
+  MultiplyAdd(_angle.data(), _angularSpeed.data(), _step.data(), _count);
+}
+
+void ParticleSoAStorage::integratePosition(
+  const std::vector<FactorGradient>& velocityGradients,
+  const std::vector<FactorGradient>& dragGradients,
+  const std::vector<FactorGradient>& limitVelocityGradients, float limitVelocityDamping,
+  const Vector3& gravity)
+{
+  std::copy(_step.begin(), _step.end(), _directionScale.begin());
+
+  // Velocity
+  if (!velocityGradients.empty()) {
+    _sampleFactorGradients(velocityGradients, _scratch.data());
+    Multiply(_directionScale.data(), _scratch.data(), _count);
+  }
+
+  // Drag
+  if (!dragGradients.empty()) {
+    _sampleFactorGradients(dragGradients, _scratch.data());
+    MultiplyOneMinus(_directionScale.data(), _scratch.data(), _count);
+  }
+
+  // Move along the direction of the beginning of the step
+  MultiplyAdd(_positionX.data(), _directionX.data(), _directionScale.data(), _count);
+  MultiplyAdd(_positionY.data(), _directionY.data(), _directionScale.data(), _count);
+  MultiplyAdd(_positionZ.data(), _directionZ.data(), _directionScale.data(), _count);
+
+  // Limit velocity
+  if (!limitVelocityGradients.empty()) {
+    _sampleFactorGradients(limitVelocityGradients, _scratch.data());
+    LimitVelocity(_directionX.data(), _directionY.data(), _directionZ.data(), _scratch.data(),
+                  limitVelocityDamping, _count);
+  }
+
+  // Gravity
+  ScaleAdd(_directionX.data(), gravity.x, _step.data(), _count);
+  ScaleAdd(_directionY.data(), gravity.y, _step.data(), _count);
+  ScaleAdd(_directionZ.data(), gravity.z, _step.data(), _count);
+}
+
+void ParticleSoAStorage::sampleSize(const std::vector<FactorGradient>& sizeGradients)
+{
+  _sampleFactorGradients(sizeGradients, _size.data());
+}
+
+void ParticleSoAStorage::writeVertices(Float32Array& vertexData,
+                                       const ParticleSoAVertexLayout& layout) const
+{
+  static constexpr float cornerOffsetsX[4] = {0.f, 1.f, 1.f, 0.f};
+  static constexpr float cornerOffsetsY[4] = {0.f, 0.f, 1.f, 1.f};
+
+  const auto nbVertices    = layout.useInstancing ? 1u : 4u;
+  const auto& worldOffset  = layout.worldOffset;
+  const auto directionMode = layout.directionMode;
+  float* vertices          = vertexData.data();
+
+  for (size_t i = 0; i < _count; ++i) {
+    const auto sizeX = _scaleX[i] * _size[i];
+    const auto sizeY = _scaleY[i] * _size[i];
+
+    auto directionX = _directionX[i];
+    auto directionY = _directionY[i];
+    auto directionZ = _directionZ[i];
+    if (directionMode == ParticleSoAVertexLayout::DirectionMode::InitialDirection
+        && _hasInitialDirection[i] != 0.f) {
+      directionX = _initialDirectionX[i];
+      directionY = _initialDirectionY[i];
+      directionZ = _initialDirectionZ[i];
+    }
+
+    for (unsigned int vertex = 0; vertex < nbVertices; ++vertex) {
+      float* __restrict out = vertices + (i * nbVertices + vertex) * layout.vertexBufferSize;
+      *out++                = _positionX[i] + worldOffset.x;
+      *out++                = _positionY[i] + worldOffset.y;
+      *out++                = _positionZ[i] + worldOffset.z;
+      *out++                = _colorR[i];
+      *out++                = _colorG[i];
+      *out++                = _colorB[i];
+      *out++                = _colorA[i];
+      *out++                = _angle[i];
+      *out++                = sizeX;
+      *out++                = sizeY;
+      if (directionMode != ParticleSoAVertexLayout::DirectionMode::None) {
+        *out++ = directionX;
+        *out++ = directionY;
+        *out++ = directionZ;
+      }
+      if (!layout.useInstancing) {
+        *out++ = cornerOffsetsX[vertex];
+        *out++ = cornerOffsetsY[vertex];
+      }
+    }
+  }
+}
+
+bool ParticleSoAStorage::IsDeterministic(const std::vector<FactorGradient>& gradients)
+{
+  return std::all_of(gradients.begin(), gradients.end(),
+                     [](const FactorGradient& gradient) { return !gradient.factor2.has_value(); });
+}
+
+bool ParticleSoAStorage::IsDeterministic(const std::vector<ColorGradient>& gradients)
+{
+  return std::all_of(gradients.begin(), gradients.end(),
+                     [](const ColorGradient& gradient) { return !gradient.color2.has_value(); });
+}
+
+void ParticleSoAStorage::_sampleFactorGradients(const std::vector<FactorGradient>& gradients,
+                                                float* result) const
+{
+  // Over the last gradient
+  Fill(result, gradients.back().factor1, _count);
+
+  // Segments are visited backward so that the first matching one wins, as in GradientHelper
+  for (size_t segment = gradients.size() - 1; segment-- > 0;) {
+    const auto& gradient1 = gradients[segment];
+    const auto& gradient2 = gradients[segment + 1];
+    SampleSegment(result, _ratio.data(), gradient1.gradient, gradient2.gradient, gradient1.factor1,
+                  gradient2.factor1, _count);
+  }
+}
+
+} // end of namespace BABYLON
@@ -32,6 +32,7 @@
 #include <babylon/particles/emittertypes/sphere_directed_particle_emitter.h>
 #include <babylon/particles/emittertypes/sphere_particle_emitter.h>
 #include <babylon/particles/particle.h>
+#include <babylon/particles/particle_soa_storage.h>
 #include <babylon/particles/sub_emitter.h>
 
 namespace BABYLON {
@@ -40,6 +41,8 @@ ParticleSystem::ParticleSystem(const std::string& iName, size_t capacity, Scene*
                                const EffectPtr& customEffect, bool iIsAnimationSheetEnabled,
                                float epsilon)
     : BaseParticleSystem{iName}
+    , useStructureOfArrays{this, &ParticleSystem::get_useStructureOfArrays,
+                           &ParticleSystem::set_useStructureOfArrays}
     , onDispose{this, &ParticleSystem::set_onDispose}
     , _currentEmitRateGradient{std::nullopt}
     , _currentEmitRate1{0.f}
@@ -65,6 +68,8 @@ ParticleSystem::ParticleSystem(const std::string& iName, size_t capacity, Scene*
     , _appendParticleVertexes{nullptr}
     , _rootParticleSystem{nullptr}
     , _zeroVector3{Vector3::Zero()}
+    , _soaStorage{nullptr}
+    , _defaultUpdateFunctionType{nullptr}
 {
   _capacity = capacity;
 
@@ -309,6 +314,8 @@ ParticleSystem::ParticleSystem(const std::string& iName, size_t capacity, Scene*
       }
     }
   };
+  // Used to detect whether the update function was replaced
+  _defaultUpdateFunctionType = &updateFunction.target_type();
 }
 
 ParticleSystem::~ParticleSystem() = default;
@@ -474,7 +481,7 @@ IParticleSystem& ParticleSystem::removeVelocityGradient(float gradient)
 IParticleSystem& ParticleSystem::addLimitVelocityGradient(float gradient, float factor,
                                                           const std::optional<float>& factor2)
 {
-  _addFactorGradient(_limitVelocityGradients, gradient, factor, *factor2);
+  _addFactorGradient(_limitVelocityGradients, gradient, factor, factor2);
 
   return *this;
 }
@@ -640,6 +647,11 @@ IParticleSystem& ParticleSystem::removeColorGradient(float gradient)
   return *this;
 }
 
+std::vector<Particle*>& ParticleSystem::particles()
+{
+  return _particles;
+}
+
 float ParticleSystem::_fetchR(float u, float v, float width, float height, const Uint8Array& pixels)
 {
   u = std::abs(u) * 0.5f + 0.5f;
@@ -656,6 +668,32 @@ void ParticleSystem::_reset()
 {
 }
 
+bool ParticleSystem::get_useStructureOfArrays() const
+{
+  return _soaStorage != nullptr;
+}
+
+void ParticleSystem::set_useStructureOfArrays(bool value)
+{
+  if (value == (_soaStorage != nullptr)) {
+    return;
+  }
+
+  if (value) {
+    _soaStorage = std::make_unique<ParticleSoAStorage>();
+    _soaStorage->resize(_particles.size());
+    for (size_t index = 0; index < _particles.size(); ++index) {
+      _soaStorage->load(index, *_particles[index]);
+    }
+  }
+  else {
+    for (size_t index = 0; index < _particles.size(); ++index) {
+      _soaStorage->store(index, *_particles[index]);
+    }
+    _soaStorage = nullptr;
+  }
+}
+
 void ParticleSystem::_resetEffect()
 {
   if (_vertexBuffer) {
@@ -854,6 +892,9 @@ void ParticleSystem::reset()
 {
   _stockParticles.clear();
   _particles.clear();
+  if (_soaStorage) {
+    _soaStorage->resize(0);
+  }
 }
 
 void ParticleSystem::_appendParticleVertex(unsigned int index, Particle* particle, int offsetX,
@@ -1015,7 +1056,20 @@ void ParticleSystem::_update(int newParticles)
       = Matrix::Translation(emitterPosition.x, emitterPosition.y, emitterPosition.z);
   }
 
-  updateFunction(_particles);
+  const auto useStructureOfArraysKernels = _soaStorage && _canUseStructureOfArraysKernels();
+  if (useStructureOfArraysKernels) {
+    _updateStructureOfArrays();
+  }
+  else {
+    // The update function works on the particle objects
+    if (_soaStorage) {
+      for (size_t index = 0; index < _particles.size(); ++index) {
+        _soaStorage->store(index, *_particles[index]);
+      }
+    }
+    updateFunction(_particles);
+  }
+  const auto firstParticleToLoad = useStructureOfArraysKernels ? _particles.size() : 0;
 
   // Add new ones
   Particle* particle = nullptr;
@@ -1080,7 +1134,7 @@ void ParticleSystem::_update(int newParticles)
     }
 
     // Size
-    if (!_sizeGradients.empty()) {
+    if (_sizeGradients.empty()) {
       particle->size = Scalar::RandomRange(minSize, maxSize);
     }
     else {
@@ -1117,7 +1171,7 @@ void ParticleSystem::_update(int newParticles)
     }
 
     // Angle
-    if (!_angularSpeedGradients.empty()) {
+    if (_angularSpeedGradients.empty()) {
       particle->angularSpeed = Scalar::RandomRange(minAngularSpeed, maxAngularSpeed);
     }
     else {
@@ -1161,7 +1215,7 @@ void ParticleSystem::_update(int newParticles)
     }
 
     // Drag
-    if (_dragGradients.empty()) {
+    if (!_dragGradients.empty()) {
       particle->_currentDragGradient = _dragGradients[0];
       particle->_currentDrag1        = particle->_currentDragGradient->getFactor();
 
@@ -1230,6 +1284,75 @@ void ParticleSystem::_update(int newParticles)
     // particle
     particle->_inheritParticleInfoToSubEmitters();
   }
+
+  if (_soaStorage) {
+    _soaStorage->resize(_particles.size());
+    for (size_t index = firstParticleToLoad; index < _particles.size(); ++index) {
+      _soaStorage->load(index, *_particles[index]);
+    }
+  }
+}
+
+bool ParticleSystem::_canUseStructureOfArraysKernels()
+{
+  return updateFunction && updateFunction.target_type() == *_defaultUpdateFunctionType
+         && !noiseTexture() && !_isAnimationSheetEnabled && !_useRampGradients
+         && _subEmitters.empty() && ParticleSoAStorage::IsDeterministic(_colorGradients)
+         && ParticleSoAStorage::IsDeterministic(_sizeGradients)
+         && ParticleSoAStorage::IsDeterministic(_angularSpeedGradients)
+         && ParticleSoAStorage::IsDeterministic(_velocityGradients)
+         && ParticleSoAStorage::IsDeterministic(_limitVelocityGradients)
+         && ParticleSoAStorage::IsDeterministic(_dragGradients);
+}
+
+void ParticleSystem::_updateStructureOfArrays()
+{
+  auto& storage = *_soaStorage;
+
+  // Age
+  storage.integrateAge(static_cast<float>(_scaledUpdateSpeed));
+
+  // Color
+  if (!_colorGradients.empty()) {
+    storage.sampleColor(_colorGradients);
+  }
+  else {
+    storage.integrateColor();
+  }
+
+  // Angular speed
+  if (!_angularSpeedGradients.empty()) {
+    storage.sampleAngularSpeed(_angularSpeedGradients);
+  }
+  storage.integrateAngle();
+
+  // Direction, velocity, drag, limit velocity and gravity
+  storage.integratePosition(_velocityGradients, _dragGradients, _limitVelocityGradients,
+                            limitVelocityDamping, gravity);
+
+  // Size
+  if (!_sizeGradients.empty()) {
+    storage.sampleSize(_sizeGradients);
+  }
+
+  // Recycle by swapping with last particle
+  for (size_t index = 0; index < _particles.size();) {
+    if (!storage.isDead(index)) {
+      ++index;
+      continue;
+    }
+
+    auto deadParticle = _particles[index];
+    storage.store(index, *deadParticle);
+    _emitFromParticle(deadParticle);
+
+    const auto lastIndex = _particles.size() - 1;
+    storage.copy(lastIndex, index);
+    _particles[index] = _particles[lastIndex];
+    _particles.pop_back();
+    _stockParticles.emplace_back(deadParticle);
+  }
+  storage.resize(_particles.size());
 }
 
 std::vector<std::string> ParticleSystem::_GetAttributeNamesOrOptions(bool iIsAnimationSheetEnabled,
@@ -1450,10 +1573,25 @@ void ParticleSystem::animate(bool preWarmOnly)
 
   if (!preWarmOnly) {
     // Update VBO
-    unsigned int offset = 0;
-    for (auto& particle : _particles) {
-      _appendParticleVertices(offset, particle);
-      offset += _useInstancing ? 1 : 4;
+    if (_soaStorage && !_isAnimationSheetEnabled && !_useRampGradients) {
+      ParticleSoAVertexLayout layout;
+      layout.vertexBufferSize = _vertexBufferSize;
+      layout.useInstancing    = _useInstancing;
+      layout.worldOffset      = worldOffset;
+      if (!_isBillboardBased) {
+        layout.directionMode = ParticleSoAVertexLayout::DirectionMode::InitialDirection;
+      }
+      else if (billboardMode == ParticleSystem::BILLBOARDMODE_STRETCHED) {
+        layout.directionMode = ParticleSoAVertexLayout::DirectionMode::Direction;
+      }
+      _soaStorage->writeVertices(_vertexData, layout);
+    }
+    else {
+      unsigned int offset = 0;
+      for (auto& particle : _particles) {
+        _appendParticleVertices(offset, particle);
+        offset += _useInstancing ? 1 : 4;
+      }
     }
 
     if (_vertexBuffer) {
@@ -1491,9 +1629,9 @@ void ParticleSystem::rebuild()
 
 bool ParticleSystem::isReady()
 {
-  if (!std::holds_alternative<AbstractMeshPtr>(emitter) || !std::holds_alternative<Vector3>(emitter)
-      || !_imageProcessingConfiguration->isReady() || !particleTexture
-      || !particleTexture->isReady()) {
+  if ((std::holds_alternative<AbstractMeshPtr>(emitter) && !std::get<AbstractMeshPtr>(emitter))
+      || (_imageProcessingConfiguration && !_imageProcessingConfiguration->isReady())
+      || !particleTexture || !particleTexture->isReady()) {
     return false;
   }
 
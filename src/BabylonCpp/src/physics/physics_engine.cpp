@@ -59,7 +59,9 @@ float PhysicsEngine::getSubTimeStep() const
 
 void PhysicsEngine::dispose()
 {
-  for (const auto& impostor : _impostors) {
+  // Disposing an impostor removes it from the list
+  const auto impostors = _impostors;
+  for (const auto& impostor : impostors) {
     impostor->dispose();
   }
   _physicsPlugin->dispose();
@@ -72,6 +74,7 @@ std::string PhysicsEngine::getPhysicsPluginName() const
 
 void PhysicsEngine::addImpostor(PhysicsImpostor* impostor)
 {
+  // The impostors are owned by their objects, they remove themselves when disposed
   _impostors.emplace_back(impostor);
   impostor->uniqueId = _impostors.size();
   // if no parent, generate the body
@@ -84,7 +87,7 @@ void PhysicsEngine::removeImpostor(PhysicsImpostor* impostor)
 {
   auto it = std::find_if(
     _impostors.begin(), _impostors.end(),
-    [&impostor](const PhysicsImpostorPtr& _imposter) { return _imposter.get() == impostor; });
+    [&impostor](const PhysicsImpostor* _imposter) { return _imposter == impostor; });
   if (it != _impostors.end()) {
     _impostors.erase(it);
     getPhysicsPlugin()->removePhysicsBody(*impostor);
@@ -125,7 +128,7 @@ void PhysicsEngine::removeJoint(PhysicsImpostor* mainImpostor, PhysicsImpostor*
   }
 }
 
-void PhysicsEngine::_step(float /*delta*/)
+void PhysicsEngine::_step(float delta)
 {
   // check if any mesh has no body / requires an update
   for (auto& impostor : _impostors) {
@@ -134,7 +137,6 @@ void PhysicsEngine::_step(float /*delta*/)
     }
   }
 
-#if 0
   if (delta > 0.1f) {
     delta = 0.1f;
   }
@@ -143,7 +145,6 @@ void PhysicsEngine::_step(float /*delta*/)
   }
 
   _physicsPlugin->executeStep(delta, _impostors);
-#endif
 }
 
 IPhysicsEnginePlugin* PhysicsEngine::getPhysicsPlugin()
@@ -151,7 +152,7 @@ IPhysicsEnginePlugin* PhysicsEngine::getPhysicsPlugin()
   return _physicsPlugin;
 }
 
-std::vector<PhysicsImpostorPtr>& PhysicsEngine::getImpostors()
+std::vector<PhysicsImpostor*>& PhysicsEngine::getImpostors()
 {
   return _impostors;
 }
@@ -160,16 +161,16 @@ PhysicsImpostor* PhysicsEngine::getImpostorForPhysicsObject(IPhysicsEnabledObjec
 {
   auto it = std::find_if(
     _impostors.begin(), _impostors.end(),
-    [&object](const PhysicsImpostorPtr& impostor) { return impostor->object == object; });
-  return (it == _impostors.end()) ? nullptr : (*it).get();
+    [&object](const PhysicsImpostor* impostor) { return impostor->object == object; });
+  return (it == _impostors.end()) ? nullptr : *it;
 }
 
 PhysicsImpostor* PhysicsEngine::getImpostorWithPhysicsBody(IPhysicsBody* body)
 {
   auto it = std::find_if(
     _impostors.begin(), _impostors.end(),
-    [&body](const PhysicsImpostorPtr& impostor) { return impostor->physicsBody() == body; });
-  return (it == _impostors.end()) ? nullptr : (*it).get();
+    [&body](const PhysicsImpostor* impostor) { return impostor->physicsBody() == body; });
+  return (it == _impostors.end()) ? nullptr : *it;
 }
 
 bool PhysicsEngine::isInitialized() const
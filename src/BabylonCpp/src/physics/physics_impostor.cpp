@@ -44,8 +44,10 @@ PhysicsImpostor::PhysicsImpostor(IPhysicsEnabledObject* iObject, unsigned int iT
     , parent{this, &PhysicsImpostor::get_parent, &PhysicsImpostor::set_parent}
     , _options{options}
     , _scene{scene}
+    , _physicsBody{nullptr}
     , _bodyUpdateRequired{false}
     , _deltaPosition{Vector3::Zero()}
+    , _parent{nullptr}
     , _isDisposed{false}
     , nullPhysicsImpostor{nullptr}
 {
@@ -134,7 +136,7 @@ void PhysicsImpostor::_init()
 
 PhysicsImpostorPtr PhysicsImpostor::_getPhysicsParent()
 {
-  if (object->parent()->type() == Type::ABSTRACTMESH) {
+  if (object->parent() && object->parent()->type() == Type::ABSTRACTMESH) {
     auto parentMesh = static_cast<AbstractMesh*>(object->parent());
     return parentMesh->physicsImpostor();
   }
@@ -190,8 +192,8 @@ void PhysicsImpostor::resetUpdateFlags()
 
 Vector3 PhysicsImpostor::getObjectExtendSize()
 {
-  if (object->hasBoundingInfo()) {
-    auto& q = object->rotationQuaternion();
+  if (object->getBoundingInfo() != nullptr) {
+    const auto q = object->rotationQuaternion();
     // reset rotation
     object->rotationQuaternion = PhysicsImpostor::IDENTITY_QUATERNION;
     // calculate the world matrix with no rotation
@@ -201,7 +203,7 @@ Vector3 PhysicsImpostor::getObjectExtendSize()
     auto size          = boundingInfo.boundingBox.extendSizeWorld.scale(2.f);
 
     // bring back the rotation
-    object->rotationQuaternion = *q;
+    object->rotationQuaternion = q;
     // calculate the world matrix with the new rotation
     object->computeWorldMatrix();
     object->computeWorldMatrix(true);
@@ -215,7 +217,7 @@ Vector3 PhysicsImpostor::getObjectExtendSize()
 
 Vector3 PhysicsImpostor::getObjectCenter()
 {
-  if (object->hasBoundingInfo()) {
+  if (object->getBoundingInfo() != nullptr) {
     const auto& boundingInfo = *object->getBoundingInfo();
     return boundingInfo.boundingBox.centerWorld;
   }
@@ -0,0 +1,166 @@
+#include <babylon/physics/plugins/native_physics_body.h>
+
+namespace BABYLON {
+
+NativePhysicsBody::NativePhysicsBody(const NativePhysicsShapePtr& shape, float iMass)
+    : friction{0.2f}
+    , restitution{0.2f}
+    , linearDamping{0.01f}
+    , angularDamping{0.05f}
+    , _shape{shape}
+    , _mass{iMass}
+    , _inverseMass{0.f}
+    , _inverseInertia{Vector3::Zero()}
+    , _position{Vector3::Zero()}
+    , _orientation{Quaternion::Identity()}
+    , _linearVelocity{Vector3::Zero()}
+    , _angularVelocity{Vector3::Zero()}
+    , _force{Vector3::Zero()}
+    , _torque{Vector3::Zero()}
+    , _sleeping{false}
+    , _sleepTime{0.f}
+    , _bounds{BVHBounds::Empty()}
+    , _index{0}
+    , _uniqueId{0}
+{
+  _updateMassProperties();
+}
+
+NativePhysicsBody::~NativePhysicsBody() = default;
+
+void NativePhysicsBody::setPosition(const Vector3& newPosition)
+{
+  _position.copyFrom(newPosition);
+  awake();
+}
+
+void NativePhysicsBody::setOrientation(const Quaternion& newRotation)
+{
+  _orientation.copyFrom(newRotation);
+  _orientation.normalize();
+  awake();
+}
+
+void NativePhysicsBody::setShapesDensity(float density)
+{
+  setMass(density * _shape->volume());
+}
+
+void NativePhysicsBody::setupMass(int type)
+{
+  if (type == StaticBody) {
+    _mass = 0.f;
+  }
+  _updateMassProperties();
+}
+
+float NativePhysicsBody::mass()
+{
+  return _mass;
+}
+
+void NativePhysicsBody::setMass(float iMass)
+{
+  _mass = iMass;
+  _updateMassProperties();
+  awake();
+}
+
+void NativePhysicsBody::applyImpulse(const Vector3& position, const Vector3& force)
+{
+  if (isStatic()) {
+    return;
+  }
+  _linearVelocity.addInPlace(force.scale(_inverseMass));
+  // The inverse inertia is diagonal in the local space of the body
+  auto angularImpulse = Vector3::Cross(position.subtract(_position), force);
+  Vector3 localImpulse, angularVelocityChange;
+  angularImpulse.rotateByQuaternionToRef(_orientation.conjugate(), localImpulse);
+  localImpulse.multiplyInPlace(_inverseInertia);
+  localImpulse.rotateByQuaternionToRef(_orientation, angularVelocityChange);
+  _angularVelocity.addInPlace(angularVelocityChange);
+  awake();
+}
+
+void NativePhysicsBody::applyForce(const Vector3& position, const Vector3& force)
+{
+  if (isStatic()) {
+    return;
+  }
+  _force.addInPlace(force);
+  _torque.addInPlace(Vector3::Cross(position.subtract(_position), force));
+  awake();
+}
+
+Vector3 NativePhysicsBody::angularVelocity()
+{
+  return _angularVelocity;
+}
+
+void NativePhysicsBody::setAngularVelocity(const Vector3& velocity)
+{
+  if (isStatic()) {
+    return;
+  }
+  _angularVelocity.copyFrom(velocity);
+  awake();
+}
+
+Vector3 NativePhysicsBody::linearVelocity()
+{
+  return _linearVelocity;
+}
+
+void NativePhysicsBody::setLinearVelocity(const Vector3& velocity)
+{
+  if (isStatic()) {
+    return;
+  }
+  _linearVelocity.copyFrom(velocity);
+  awake();
+}
+
+void NativePhysicsBody::sleep()
+{
+  if (isStatic()) {
+    return;
+  }
+  _sleeping = true;
+  _linearVelocity.setAll(0.f);
+  _angularVelocity.setAll(0.f);
+}
+
+bool NativePhysicsBody::sleeping()
+{
+  return _sleeping;
+}
+
+void NativePhysicsBody::awake()
+{
+  _sleeping  = false;
+  _sleepTime = 0.f;
+}
+
+void NativePhysicsBody::syncShapes()
+{
+  _updateMassProperties();
+}
+
+void NativePhysicsBody::_updateMassProperties()
+{
+  if (_mass <= 0.f || _shape->type() == NativePhysicsShape::Type::Mesh) {
+    _inverseMass = 0.f;
+    _inverseInertia.setAll(0.f);
+    _linearVelocity.setAll(0.f);
+    _angularVelocity.setAll(0.f);
+    return;
+  }
+
+  _inverseMass           = 1.f / _mass;
+  const auto unitInertia = _shape->unitInertia();
+  _inverseInertia.set(unitInertia.x > 0.f ? _inverseMass / unitInertia.x : 0.f,
+                      unitInertia.y > 0.f ? _inverseMass / unitInertia.y : 0.f,
+                      unitInertia.z > 0.f ? _inverseMass / unitInertia.z : 0.f);
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,448 @@
+#include <babylon/physics/plugins/native_physics_plugin.h>
+
+#include <cmath>
+
+#include <babylon/babylon_constants.h>
+#include <babylon/core/logging.h>
+#include <babylon/meshes/abstract_mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+#include <babylon/physics/physics_impostor.h>
+#include <babylon/physics/physics_raycast_result.h>
+
+namespace BABYLON {
+
+namespace {
+
+// Thickness given to the flat boxes, such as the planes
+constexpr float MinimumHalfExtent       = 0.005f;
+constexpr float ParticleRadius          = 0.01f;
+constexpr unsigned int CylinderSegments = 16;
+
+} // end of anonymous namespace
+
+NativePhysicsPlugin::NativePhysicsPlugin(size_t iterations, JobPool* jobPool)
+    : _world{jobPool}, _timeStep{1.f / 60.f}
+{
+  world                     = nullptr;
+  name                      = "NativePhysicsPlugin";
+  _world.velocityIterations = iterations;
+}
+
+NativePhysicsPlugin::~NativePhysicsPlugin() = default;
+
+void NativePhysicsPlugin::setGravity(const Vector3& gravity)
+{
+  _world.gravity.copyFrom(gravity);
+}
+
+void NativePhysicsPlugin::setTimeStep(float timeStep)
+{
+  _timeStep = timeStep;
+}
+
+float NativePhysicsPlugin::getTimeStep() const
+{
+  return _timeStep;
+}
+
+void NativePhysicsPlugin::executeStep(float delta, const std::vector<PhysicsImpostor*>& impostors)
+{
+  for (const auto& impostor : impostors) {
+    if (!impostor->soft) {
+      impostor->beforeStep();
+    }
+  }
+
+  _world.step(delta);
+
+  for (const auto& impostor : impostors) {
+    if (!impostor->soft) {
+      impostor->afterStep();
+    }
+  }
+}
+
+void NativePhysicsPlugin::applyImpulse(const PhysicsImpostor& impostor, const Vector3& force,
+                                       const Vector3& contactPoint)
+{
+  if (auto body = _getBody(impostor)) {
+    body->applyImpulse(contactPoint, force);
+  }
+}
+
+void NativePhysicsPlugin::applyForce(const PhysicsImpostor& impostor, const Vector3& force,
+                                     const Vector3& contactPoint)
+{
+  if (auto body = _getBody(impostor)) {
+    body->applyForce(contactPoint, force);
+  }
+}
+
+void NativePhysicsPlugin::generatePhysicsBody(const PhysicsImpostor& iImpostor)
+{
+  // The impostor is updated with its new body
+  auto& impostor = const_cast<PhysicsImpostor&>(iImpostor);
+  if (impostor.soft) {
+    BABYLON_LOG_WARN("NativePhysicsPlugin", "Soft body impostors are not supported")
+    return;
+  }
+
+  // Parent impostors are not supported, the children get their own bodies
+  auto object = impostor.object;
+  if (!object) {
+    return;
+  }
+  removePhysicsBody(impostor);
+  auto shape = _createShape(impostor);
+  if (!shape) {
+    return;
+  }
+
+  object->computeWorldMatrix(true);
+  const auto orientation = object->rotationQuaternion() ? *object->rotationQuaternion() :
+                                                          Quaternion::Identity();
+  auto body = _world.createBody(shape, impostor.getParam("mass"), object->getAbsolutePosition(),
+                                orientation);
+  body->friction    = impostor.getParam("friction");
+  body->restitution = impostor.getParam("restitution");
+
+  impostor.physicsBody = body;
+  _bodies[&impostor]   = body;
+}
+
+void NativePhysicsPlugin::removePhysicsBody(const PhysicsImpostor& impostor)
+{
+  auto it = _bodies.find(&impostor);
+  if (it != _bodies.end()) {
+    _world.removeBody(it->second);
+    _bodies.erase(it);
+  }
+}
+
+void NativePhysicsPlugin::generateJoint(PhysicsImpostorJoint* /*joint*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin", "Joints are not supported")
+}
+
+void NativePhysicsPlugin::removeJoint(PhysicsImpostorJoint* /*joint*/)
+{
+}
+
+bool NativePhysicsPlugin::isSupported()
+{
+  return true;
+}
+
+void NativePhysicsPlugin::setTransformationFromPhysicsBody(const PhysicsImpostor& impostor)
+{
+  auto body = _getBody(impostor);
+  if (!body || body->isStatic() || body->sleeping()) {
+    return;
+  }
+
+  auto object                = impostor.object;
+  object->position           = body->position();
+  object->rotationQuaternion = body->orientation();
+}
+
+void NativePhysicsPlugin::setPhysicsBodyTransformation(const PhysicsImpostor& impostor,
+                                                       const Vector3& newPosition,
+                                                       const Quaternion& newRotation)
+{
+  // Only the objects moved since the last step wake their bodies up
+  auto body = _getBody(impostor);
+  if (!body) {
+    return;
+  }
+  if (!body->position().equalsWithEpsilon(newPosition)) {
+    body->setPosition(newPosition);
+  }
+  const auto& orientation = body->orientation();
+  if (std::abs(orientation.x - newRotation.x) > Math::Epsilon
+      || std::abs(orientation.y - newRotation.y) > Math::Epsilon
+      || std::abs(orientation.z - newRotation.z) > Math::Epsilon
+      || std::abs(orientation.w - newRotation.w) > Math::Epsilon) {
+    body->setOrientation(newRotation);
+  }
+}
+
+void NativePhysicsPlugin::setLinearVelocity(const PhysicsImpostor& impostor,
+                                            const std::optional<Vector3>& velocity)
+{
+  if (auto body = _getBody(impostor)) {
+    body->setLinearVelocity(velocity.value_or(Vector3::Zero()));
+  }
+}
+
+void NativePhysicsPlugin::setAngularVelocity(const PhysicsImpostor& impostor,
+                                             const std::optional<Vector3>& velocity)
+{
+  if (auto body = _getBody(impostor)) {
+    body->setAngularVelocity(velocity.value_or(Vector3::Zero()));
+  }
+}
+
+Vector3 NativePhysicsPlugin::getLinearVelocity(const PhysicsImpostor& impostor)
+{
+  auto body = _getBody(impostor);
+  return body ? body->linearVelocity() : Vector3::Zero();
+}
+
+Vector3 NativePhysicsPlugin::getAngularVelocity(const PhysicsImpostor& impostor)
+{
+  auto body = _getBody(impostor);
+  return body ? body->angularVelocity() : Vector3::Zero();
+}
+
+void NativePhysicsPlugin::setBodyMass(const PhysicsImpostor& impostor, float mass)
+{
+  if (auto body = _getBody(impostor)) {
+    body->setMass(mass);
+  }
+}
+
+float NativePhysicsPlugin::getBodyMass(const PhysicsImpostor& impostor)
+{
+  auto body = _getBody(impostor);
+  return body ? body->mass() : 0.f;
+}
+
+float NativePhysicsPlugin::getBodyFriction(const PhysicsImpostor& impostor)
+{
+  auto body = _getBody(impostor);
+  return body ? body->friction : 0.f;
+}
+
+void NativePhysicsPlugin::setBodyFriction(const PhysicsImpostor& impostor, float friction)
+{
+  if (auto body = _getBody(impostor)) {
+    body->friction = friction;
+  }
+}
+
+float NativePhysicsPlugin::getBodyRestitution(const PhysicsImpostor& impostor)
+{
+  auto body = _getBody(impostor);
+  return body ? body->restitution : 0.f;
+}
+
+void NativePhysicsPlugin::setBodyRestitution(const PhysicsImpostor& impostor, float restitution)
+{
+  if (auto body = _getBody(impostor)) {
+    body->restitution = restitution;
+  }
+}
+
+float NativePhysicsPlugin::getBodyPressure(const PhysicsImpostor& /*impostor*/)
+{
+  return 0.f;
+}
+
+void NativePhysicsPlugin::setBodyPressure(const PhysicsImpostor& /*impostor*/, float /*pressure*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin", "Soft body pressure is not supported")
+}
+
+float NativePhysicsPlugin::getBodyStiffness(const PhysicsImpostor& /*impostor*/)
+{
+  return 0.f;
+}
+
+void NativePhysicsPlugin::setBodyStiffness(const PhysicsImpostor& /*impostor*/,
+                                           float /*stiffness*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin", "Soft body stiffness is not supported")
+}
+
+size_t NativePhysicsPlugin::getBodyVelocityIterations(const PhysicsImpostor& /*impostor*/)
+{
+  return _world.velocityIterations;
+}
+
+void NativePhysicsPlugin::setBodyVelocityIterations(const PhysicsImpostor& /*impostor*/,
+                                                    size_t /*velocityIterations*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin",
+                   "The velocity iterations are set for the whole world, not per body")
+}
+
+size_t NativePhysicsPlugin::getBodyPositionIterations(const PhysicsImpostor& /*impostor*/)
+{
+  return 0;
+}
+
+void NativePhysicsPlugin::setBodyPositionIterations(const PhysicsImpostor& /*impostor*/,
+                                                    size_t /*positionIterations*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin", "Position iterations are not supported")
+}
+
+void NativePhysicsPlugin::appendAnchor(const PhysicsImpostor& /*impostor*/,
+                                       const PhysicsImpostorPtr& /*otherImpostor*/,
+                                       int /*width*/, int /*height*/, float /*influence*/,
+                                       bool /*noCollisionBetweenLinkedBodies*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin", "Soft body anchors are not supported")
+}
+
+void NativePhysicsPlugin::appendHook(const PhysicsImpostor& /*impostor*/,
+                                     const PhysicsImpostorPtr& /*otherImpostor*/,
+                                     float /*length*/, float /*influence*/,
+                                     bool /*noCollisionBetweenLinkedBodies*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin", "Soft body hooks are not supported")
+}
+
+void NativePhysicsPlugin::sleepBody(const PhysicsImpostor& impostor)
+{
+  if (auto body = _getBody(impostor)) {
+    body->sleep();
+  }
+}
+
+void NativePhysicsPlugin::wakeUpBody(const PhysicsImpostor& impostor)
+{
+  if (auto body = _getBody(impostor)) {
+    body->awake();
+  }
+}
+
+PhysicsRaycastResult NativePhysicsPlugin::raycast(const Vector3& from, const Vector3& to)
+{
+  PhysicsRaycastResult result;
+  result.reset(from, to);
+  if (const auto hit = _world.raycast(from, to)) {
+    result.setHitData(IXYZ{hit->normal.x, hit->normal.y, hit->normal.z},
+                      IXYZ{hit->point.x, hit->point.y, hit->point.z});
+    result.calculateHitDistance();
+  }
+  return result;
+}
+
+void NativePhysicsPlugin::updateDistanceJoint(DistanceJoint* /*joint*/, float /*maxDistance*/,
+                                              float /*minDistance*/)
+{
+}
+
+void NativePhysicsPlugin::setMotor(IMotorEnabledJoint* /*joint*/, float /*speed*/,
+                                   float /*maxForce*/, unsigned int /*motorIndex*/)
+{
+}
+
+void NativePhysicsPlugin::setLimit(IMotorEnabledJoint* /*joint*/, float /*upperLimit*/,
+                                   float /*lowerLimit*/, unsigned int /*motorIndex*/)
+{
+}
+
+float NativePhysicsPlugin::getRadius(const PhysicsImpostor& impostor)
+{
+  auto body = _getBody(impostor);
+  return body ? body->shape()->radius() : 0.f;
+}
+
+void NativePhysicsPlugin::getBoxSizeToRef(const PhysicsImpostor& impostor, Vector3& result)
+{
+  auto body = _getBody(impostor);
+  if (!body) {
+    result.setAll(0.f);
+    return;
+  }
+  const auto& extents = body->shape()->halfExtents();
+  result.set(extents[0] * 2.f, extents[1] * 2.f, extents[2] * 2.f);
+}
+
+void NativePhysicsPlugin::syncMeshWithImpostor(AbstractMesh* mesh,
+                                               const PhysicsImpostor& impostor)
+{
+  auto body = _getBody(impostor);
+  if (!mesh || !body) {
+    return;
+  }
+  mesh->position           = body->position();
+  mesh->rotationQuaternion = body->orientation();
+}
+
+void NativePhysicsPlugin::dispose()
+{
+  _bodies.clear();
+  _world.clear();
+}
+
+NativePhysicsBody* NativePhysicsPlugin::_getBody(const PhysicsImpostor& impostor) const
+{
+  auto it = _bodies.find(&impostor);
+  return it == _bodies.end() ? nullptr : it->second;
+}
+
+NativePhysicsShapePtr NativePhysicsPlugin::_createShape(PhysicsImpostor& impostor) const
+{
+  auto object           = impostor.object;
+  const auto extendSize = impostor.getObjectExtendSize();
+  const auto halfSize   = extendSize.scale(0.5f);
+
+  // Vertices of the object in its space, scaled as in the world
+  const auto scaledPositions = [object]() {
+    std::vector<Vector3> positions;
+    const auto data    = object->getVerticesData(VertexBuffer::PositionKind);
+    const auto scaling = object->absoluteScaling();
+    positions.reserve(data.size() / 3);
+    for (size_t i = 0; i + 2 < data.size(); i += 3) {
+      positions.emplace_back(data[i] * scaling.x, data[i + 1] * scaling.y,
+                             data[i + 2] * scaling.z);
+    }
+    return positions;
+  };
+
+  switch (impostor.physicsImposterType) {
+    case PhysicsImpostor::SphereImpostor:
+      return NativePhysicsShape::CreateSphere(
+        std::max(std::max(halfSize.x, halfSize.y), std::max(halfSize.z, MinimumHalfExtent)));
+    case PhysicsImpostor::BoxImpostor:
+    case PhysicsImpostor::PlaneImpostor:
+      return NativePhysicsShape::CreateBox(Vector3(std::max(halfSize.x, MinimumHalfExtent),
+                                                   std::max(halfSize.y, MinimumHalfExtent),
+                                                   std::max(halfSize.z, MinimumHalfExtent)));
+    case PhysicsImpostor::CapsuleImpostor: {
+      const auto radius = std::max(std::max(halfSize.x, halfSize.z), MinimumHalfExtent);
+      return NativePhysicsShape::CreateCapsule(radius, std::max(halfSize.y - radius, 0.f));
+    }
+    case PhysicsImpostor::CylinderImpostor: {
+      // Convex hull of two polygons
+      std::vector<Vector3> points;
+      const auto radius = std::max(std::max(halfSize.x, halfSize.z), MinimumHalfExtent);
+      for (unsigned int i = 0; i < CylinderSegments; ++i) {
+        const auto angle = 2.f * Math::PI * static_cast<float>(i) / CylinderSegments;
+        const auto x = radius * std::cos(angle), z = radius * std::sin(angle);
+        points.emplace_back(x, -halfSize.y, z);
+        points.emplace_back(x, halfSize.y, z);
+      }
+      return NativePhysicsShape::CreateConvexHull(points);
+    }
+    case PhysicsImpostor::ParticleImpostor:
+      return NativePhysicsShape::CreateSphere(ParticleRadius);
+    case PhysicsImpostor::ConvexHullImpostor: {
+      const auto positions = scaledPositions();
+      if (positions.empty()) {
+        break;
+      }
+      return NativePhysicsShape::CreateConvexHull(positions);
+    }
+    case PhysicsImpostor::MeshImpostor:
+    case PhysicsImpostor::HeightmapImpostor: {
+      const auto positions = scaledPositions();
+      const auto indices   = object->getIndices();
+      if (positions.empty() || indices.empty()) {
+        break;
+      }
+      return NativePhysicsShape::CreateMesh(positions, indices);
+    }
+    default:
+      break;
+  }
+
+  BABYLON_LOGF_WARN("NativePhysicsPlugin", "Unsupported impostor type %u",
+                    impostor.physicsImposterType)
+  return nullptr;
+}
+
+} // end of namespace BABYLON
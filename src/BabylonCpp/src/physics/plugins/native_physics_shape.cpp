@@ -0,0 +1,391 @@
+#include <babylon/physics/plugins/native_physics_shape.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <babylon/babylon_constants.h>
+#include <babylon/culling/bvh/triangle_bvh.h>
+
+namespace BABYLON {
+
+namespace {
+
+NativePhysicsShape::Point ToPoint(const Vector3& vector)
+{
+  return {vector.x, vector.y, vector.z};
+}
+
+Vector3 ToVector3(const NativePhysicsShape::Point& point)
+{
+  return Vector3(point[0], point[1], point[2]);
+}
+
+/**
+ * Returns the indices of the points of the 2D convex hull of the given points, counter clockwise
+ * (Andrew's monotone chain, collinear points are dropped)
+ */
+std::vector<size_t> ConvexHull2D(const std::vector<std::pair<float, float>>& points, float epsilon)
+{
+  std::vector<size_t> order(points.size());
+  for (size_t i = 0; i < order.size(); ++i) {
+    order[i] = i;
+  }
+  std::sort(order.begin(), order.end(), [&points](size_t a, size_t b) { //
+    return points[a] < points[b];
+  });
+
+  const auto cross = [&points](size_t o, size_t a, size_t b) {
+    return (points[a].first - points[o].first) * (points[b].second - points[o].second)
+           - (points[a].second - points[o].second) * (points[b].first - points[o].first);
+  };
+
+  std::vector<size_t> hull(2 * order.size());
+  size_t count = 0;
+  for (const auto index : order) {
+    while (count >= 2 && cross(hull[count - 2], hull[count - 1], index) <= epsilon) {
+      --count;
+    }
+    hull[count++] = index;
+  }
+  for (size_t i = order.size() - 1, lower = count + 1; i-- > 0;) {
+    const auto index = order[i];
+    while (count >= lower && cross(hull[count - 2], hull[count - 1], index) <= epsilon) {
+      --count;
+    }
+    hull[count++] = index;
+  }
+  hull.resize(count > 1 ? count - 1 : count);
+
+  return hull;
+}
+
+} // end of anonymous namespace
+
+NativePhysicsShape::NativePhysicsShape(Type type)
+    : _type{type}
+    , _radius{0.f}
+    , _halfHeight{0.f}
+    , _halfExtents{{0.f, 0.f, 0.f}}
+    , _localBounds{BVHBounds::Empty()}
+{
+}
+
+NativePhysicsShape::~NativePhysicsShape() = default;
+
+NativePhysicsShapePtr NativePhysicsShape::CreateSphere(float radius)
+{
+  auto shape     = std::shared_ptr<NativePhysicsShape>(new NativePhysicsShape(Type::Sphere));
+  shape->_radius = radius;
+  shape->_computeLocalBounds();
+  return shape;
+}
+
+NativePhysicsShapePtr NativePhysicsShape::CreateBox(const Vector3& halfExtents)
+{
+  auto shape          = std::shared_ptr<NativePhysicsShape>(new NativePhysicsShape(Type::Box));
+  shape->_halfExtents = ToPoint(halfExtents);
+
+  std::vector<Vector3> corners;
+  for (const auto x : {-halfExtents.x, halfExtents.x}) {
+    for (const auto y : {-halfExtents.y, halfExtents.y}) {
+      for (const auto z : {-halfExtents.z, halfExtents.z}) {
+        corners.emplace_back(Vector3(x, y, z));
+      }
+    }
+  }
+  shape->_buildPolyhedron(corners);
+  shape->_computeLocalBounds();
+  return shape;
+}
+
+NativePhysicsShapePtr NativePhysicsShape::CreateCapsule(float radius, float halfHeight)
+{
+  auto shape         = std::shared_ptr<NativePhysicsShape>(new NativePhysicsShape(Type::Capsule));
+  shape->_radius     = radius;
+  shape->_halfHeight = halfHeight;
+  shape->_computeLocalBounds();
+  return shape;
+}
+
+NativePhysicsShapePtr NativePhysicsShape::CreateConvexHull(const std::vector<Vector3>& points)
+{
+  auto shape = std::shared_ptr<NativePhysicsShape>(new NativePhysicsShape(Type::ConvexHull));
+  shape->_buildPolyhedron(points);
+  shape->_computeLocalBounds();
+  return shape;
+}
+
+NativePhysicsShapePtr NativePhysicsShape::CreateMesh(const std::vector<Vector3>& positions,
+                                                     const IndicesArray& indices)
+{
+  auto shape            = std::shared_ptr<NativePhysicsShape>(new NativePhysicsShape(Type::Mesh));
+  shape->_meshPositions = positions;
+  shape->_triangleBVH   = std::make_unique<TriangleBVH>(positions, indices);
+  shape->_computeLocalBounds();
+  return shape;
+}
+
+float NativePhysicsShape::volume() const
+{
+  switch (_type) {
+    case Type::Sphere:
+      return 4.f / 3.f * Math::PI * _radius * _radius * _radius;
+    case Type::Capsule:
+      return Math::PI * _radius * _radius * (2.f * _halfHeight + 4.f / 3.f * _radius);
+    default:
+      return 8.f * _halfExtents[0] * _halfExtents[1] * _halfExtents[2];
+  }
+}
+
+Vector3 NativePhysicsShape::unitInertia() const
+{
+  switch (_type) {
+    case Type::Sphere: {
+      const auto inertia = 0.4f * _radius * _radius;
+      return Vector3(inertia, inertia, inertia);
+    }
+    case Type::Capsule: {
+      // Cylinder and hemispheres, sharing the mass according to their volumes
+      const auto radius2        = _radius * _radius;
+      const auto height         = 2.f * _halfHeight;
+      const auto cylinderVolume = Math::PI * radius2 * height;
+      const auto spheresVolume  = 4.f / 3.f * Math::PI * radius2 * _radius;
+      const auto cylinderMass   = cylinderVolume / (cylinderVolume + spheresVolume);
+      const auto spheresMass    = 1.f - cylinderMass;
+      const auto axial          = cylinderMass * radius2 * 0.5f + spheresMass * 0.4f * radius2;
+      const auto lateral
+        = cylinderMass * (height * height / 12.f + radius2 * 0.25f)
+          + spheresMass * (0.4f * radius2 + height * height * 0.25f + 0.375f * height * _radius);
+      return Vector3(lateral, axial, lateral);
+    }
+    default: {
+      // Inertia of the bounds, moved to the origin of the body
+      std::array<float, 3> inertia{}, center{};
+      for (unsigned int axis = 0; axis < 3; ++axis) {
+        center[axis] = (_localBounds.minimum[axis] + _localBounds.maximum[axis]) * 0.5f;
+      }
+      const auto& extents = _halfExtents;
+      for (unsigned int axis = 0; axis < 3; ++axis) {
+        const auto axis1 = (axis + 1) % 3, axis2 = (axis + 2) % 3;
+        inertia[axis]    = (extents[axis1] * extents[axis1] + extents[axis2] * extents[axis2]) / 3.f
+                        + center[axis1] * center[axis1] + center[axis2] * center[axis2];
+      }
+      return Vector3(inertia[0], inertia[1], inertia[2]);
+    }
+  }
+}
+
+void NativePhysicsShape::_buildPolyhedron(const std::vector<Vector3>& points)
+{
+  auto bounds = BVHBounds::Empty();
+  for (const auto& point : points) {
+    bounds.extend(BVHBounds::FromMinMax(point, point));
+  }
+  auto size = 0.f;
+  for (unsigned int axis = 0; axis < 3 && !bounds.isEmpty(); ++axis) {
+    size = std::max(size, bounds.maximum[axis] - bounds.minimum[axis]);
+  }
+  const auto epsilon = std::max(size * 1e-4f, 1e-6f);
+
+  // Unique points, simplified to the points supporting the hull in a fixed set of directions
+  // (the axes, the diagonals and a spiral on the sphere) when there are too many of them
+  std::vector<Vector3> hullPoints;
+  const auto addUniquePoint = [&hullPoints, epsilon](const Vector3& point) {
+    for (const auto& hullPoint : hullPoints) {
+      if ((hullPoint - point).lengthSquared() <= epsilon * epsilon) {
+        return;
+      }
+    }
+    hullPoints.emplace_back(point);
+  };
+  if (points.size() <= MaxConvexHullVertices) {
+    for (const auto& point : points) {
+      addUniquePoint(point);
+    }
+  }
+  else {
+    std::vector<Vector3> directions;
+    for (const auto x : {-1.f, 0.f, 1.f}) {
+      for (const auto y : {-1.f, 0.f, 1.f}) {
+        for (const auto z : {-1.f, 0.f, 1.f}) {
+          if (x != 0.f || y != 0.f || z != 0.f) {
+            directions.emplace_back(Vector3(x, y, z));
+          }
+        }
+      }
+    }
+    const size_t nbSpiralDirections = 2 * MaxConvexHullVertices;
+    const auto goldenAngle          = Math::PI * (3.f - std::sqrt(5.f));
+    for (size_t i = 0; i < nbSpiralDirections; ++i) {
+      const auto y = 1.f - 2.f * (static_cast<float>(i) + 0.5f) / nbSpiralDirections;
+      const auto r = std::sqrt(std::max(0.f, 1.f - y * y));
+      const auto a = goldenAngle * static_cast<float>(i);
+      directions.emplace_back(Vector3(r * std::cos(a), y, r * std::sin(a)));
+    }
+    for (const auto& direction : directions) {
+      if (hullPoints.size() == MaxConvexHullVertices) {
+        break;
+      }
+      const auto support = std::max_element(
+        points.begin(), points.end(), [&direction](const auto& a, const auto& b) {
+          return Vector3::Dot(a, direction) < Vector3::Dot(b, direction);
+        });
+      addUniquePoint(*support);
+    }
+  }
+
+  // Planes through 3 points leaving all the points on the same side, a flat set of points has
+  // the planes of both sides
+  const auto nbPoints = hullPoints.size();
+  std::vector<std::pair<Vector3, float>> planes;
+  const auto addPlane = [&planes, epsilon](const Vector3& normal, float distance) {
+    for (const auto& [planeNormal, planeDistance] : planes) {
+      if (Vector3::Dot(planeNormal, normal) > 1.f - 1e-5f
+          && std::abs(planeDistance - distance) <= epsilon) {
+        return;
+      }
+    }
+    planes.emplace_back(normal, distance);
+  };
+  for (size_t i = 0; i < nbPoints; ++i) {
+    for (size_t j = i + 1; j < nbPoints; ++j) {
+      for (size_t k = j + 1; k < nbPoints; ++k) {
+        auto normal = Vector3::Cross(hullPoints[j] - hullPoints[i], hullPoints[k] - hullPoints[i]);
+        const auto length = normal.length();
+        if (length <= epsilon * epsilon) {
+          continue;
+        }
+        normal.scaleInPlace(1.f / length);
+        const auto distance = Vector3::Dot(normal, hullPoints[i]);
+        auto below = true, above = true;
+        for (size_t l = 0; l < nbPoints && (below || above); ++l) {
+          const auto side = Vector3::Dot(normal, hullPoints[l]) - distance;
+          below           = below && side <= epsilon;
+          above           = above && side >= -epsilon;
+        }
+        if (below) {
+          addPlane(normal, distance);
+        }
+        if (above) {
+          addPlane(normal.negate(), -distance);
+        }
+      }
+    }
+  }
+
+  // Faces: the 2D hulls of the points lying on each plane
+  std::vector<int> vertexIndices(nbPoints, -1);
+  for (const auto& [normal, distance] : planes) {
+    const auto tangent = std::abs(normal.x) < 0.57f ? Vector3(1.f, 0.f, 0.f) :
+                                                      Vector3(0.f, 1.f, 0.f);
+    const auto u = Vector3::Cross(tangent, normal).normalize();
+    const auto v = Vector3::Cross(normal, u);
+
+    std::vector<size_t> facePoints;
+    std::vector<std::pair<float, float>> facePoints2D;
+    for (size_t i = 0; i < nbPoints; ++i) {
+      if (std::abs(Vector3::Dot(normal, hullPoints[i]) - distance) <= epsilon) {
+        facePoints.emplace_back(i);
+        facePoints2D.emplace_back(Vector3::Dot(u, hullPoints[i]), Vector3::Dot(v, hullPoints[i]));
+      }
+    }
+    const auto polygon = ConvexHull2D(facePoints2D, epsilon * epsilon);
+    if (polygon.size() < 3) {
+      continue;
+    }
+
+    Face face{ToPoint(normal), distance, static_cast<uint32_t>(_faceVertices.size()),
+              static_cast<uint32_t>(polygon.size())};
+    for (const auto polygonIndex : polygon) {
+      auto& vertexIndex = vertexIndices[facePoints[polygonIndex]];
+      if (vertexIndex < 0) {
+        vertexIndex = static_cast<int>(_vertices.size());
+        _vertices.emplace_back(ToPoint(hullPoints[facePoints[polygonIndex]]));
+      }
+      _faceVertices.emplace_back(static_cast<uint32_t>(vertexIndex));
+    }
+    _faces.emplace_back(face);
+  }
+
+  if (_faces.empty()) {
+    // Aligned points, replaced by the box of their bounds
+    _vertices.clear();
+    _faceVertices.clear();
+    const auto minimumExtent = std::max(size * 0.01f, 1e-3f);
+    std::vector<Vector3> corners;
+    for (unsigned int corner = 0; corner < 8; ++corner) {
+      std::array<float, 3> point{};
+      for (unsigned int axis = 0; axis < 3; ++axis) {
+        const auto center = (bounds.minimum[axis] + bounds.maximum[axis]) * 0.5f;
+        const auto extent
+          = std::max((bounds.maximum[axis] - bounds.minimum[axis]) * 0.5f, minimumExtent);
+        point[axis] = (corner & (1u << axis)) ? center + extent : center - extent;
+      }
+      corners.emplace_back(Vector3(point[0], point[1], point[2]));
+    }
+    if (!bounds.isEmpty()) {
+      _buildPolyhedron(corners);
+    }
+    return;
+  }
+
+  // Edges of the faces and the faces sharing them
+  for (uint32_t faceIndex = 0; faceIndex < _faces.size(); ++faceIndex) {
+    const auto& face = _faces[faceIndex];
+    for (uint32_t i = 0; i < face.vertexCount; ++i) {
+      auto vertex0 = _faceVertices[face.firstVertex + i];
+      auto vertex1 = _faceVertices[face.firstVertex + (i + 1) % face.vertexCount];
+      if (vertex0 > vertex1) {
+        std::swap(vertex0, vertex1);
+      }
+      auto edge = std::find_if(_edges.begin(), _edges.end(), [&](const Edge& other) {
+        return other.vertex0 == vertex0 && other.vertex1 == vertex1;
+      });
+      if (edge == _edges.end()) {
+        _edges.emplace_back(Edge{vertex0, vertex1, faceIndex, faceIndex});
+      }
+      else {
+        edge->face1 = faceIndex;
+      }
+    }
+  }
+}
+
+void NativePhysicsShape::_computeLocalBounds()
+{
+  switch (_type) {
+    case Type::Sphere:
+      _localBounds = BVHBounds::FromMinMax(Vector3(-_radius, -_radius, -_radius),
+                                           Vector3(_radius, _radius, _radius));
+      break;
+    case Type::Capsule: {
+      const auto height = _halfHeight + _radius;
+      _localBounds      = BVHBounds::FromMinMax(Vector3(-_radius, -height, -_radius),
+                                           Vector3(_radius, height, _radius));
+    } break;
+    case Type::Mesh:
+      _localBounds = BVHBounds::Empty();
+      for (const auto& position : _meshPositions) {
+        _localBounds.extend(BVHBounds::FromMinMax(position, position));
+      }
+      break;
+    default:
+      _localBounds = BVHBounds::Empty();
+      for (const auto& vertex : _vertices) {
+        const auto position = ToVector3(vertex);
+        _localBounds.extend(BVHBounds::FromMinMax(position, position));
+      }
+      break;
+  }
+
+  if (_localBounds.isEmpty()) {
+    _localBounds = BVHBounds::FromMinMax(Vector3::Zero(), Vector3::Zero());
+  }
+  if (_type != Type::Box) {
+    for (unsigned int axis = 0; axis < 3; ++axis) {
+      _halfExtents[axis] = (_localBounds.maximum[axis] - _localBounds.minimum[axis]) * 0.5f;
+    }
+  }
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,1783 @@
+#include <babylon/physics/plugins/native_physics_world.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <babylon/collisions/intersection_info.h>
+#include <babylon/culling/bvh/triangle_bvh.h>
+#include <babylon/misc/job_pool.h>
+
+namespace BABYLON {
+
+namespace {
+
+//------------------------------------------------------------------------------------------------
+// Math of the narrowphase and the solver, kept inline on plain floats
+//------------------------------------------------------------------------------------------------
+
+struct Vec3 {
+  float x, y, z;
+}; // end of struct Vec3
+
+inline Vec3 operator+(const Vec3& a, const Vec3& b)
+{
+  return {a.x + b.x, a.y + b.y, a.z + b.z};
+}
+
+inline Vec3 operator-(const Vec3& a, const Vec3& b)
+{
+  return {a.x - b.x, a.y - b.y, a.z - b.z};
+}
+
+inline Vec3 operator-(const Vec3& a)
+{
+  return {-a.x, -a.y, -a.z};
+}
+
+inline Vec3 operator*(const Vec3& a, float s)
+{
+  return {a.x * s, a.y * s, a.z * s};
+}
+
+inline Vec3& operator+=(Vec3& a, const Vec3& b)
+{
+  a.x += b.x;
+  a.y += b.y;
+  a.z += b.z;
+  return a;
+}
+
+inline Vec3& operator-=(Vec3& a, const Vec3& b)
+{
+  a.x -= b.x;
+  a.y -= b.y;
+  a.z -= b.z;
+  return a;
+}
+
+inline float Dot(const Vec3& a, const Vec3& b)
+{
+  return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+inline Vec3 Cross(const Vec3& a, const Vec3& b)
+{
+  return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};
+}
+
+inline float LengthSquared(const Vec3& a)
+{
+  return Dot(a, a);
+}
+
+inline float Length(const Vec3& a)
+{
+  return std::sqrt(Dot(a, a));
+}
+
+inline Vec3 NormalizeOr(const Vec3& a, const Vec3& fallback)
+{
+  const auto length = Length(a);
+  return length > 1e-12f ? a * (1.f / length) : fallback;
+}
+
+inline float Component(const Vec3& a, unsigned int axis)
+{
+  return axis == 0 ? a.x : (axis == 1 ? a.y : a.z);
+}
+
+inline Vec3 Load(const Vector3& v)
+{
+  return {v.x, v.y, v.z};
+}
+
+inline Vec3 Load(const NativePhysicsShape::Point& p)
+{
+  return {p[0], p[1], p[2]};
+}
+
+inline Vector3 ToVector3(const Vec3& v)
+{
+  return Vector3(v.x, v.y, v.z);
+}
+
+struct Quat {
+  float x, y, z, w;
+}; // end of struct Quat
+
+inline Quat Load(const Quaternion& q)
+{
+  return {q.x, q.y, q.z, q.w};
+}
+
+inline Quat Normalize(const Quat& q)
+{
+  const auto length = std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+  if (length <= 1e-12f) {
+    return {0.f, 0.f, 0.f, 1.f};
+  }
+  const auto inverse = 1.f / length;
+  return {q.x * inverse, q.y * inverse, q.z * inverse, q.w * inverse};
+}
+
+/**
+ * Columns of a 3x3 matrix
+ */
+struct Mat3 {
+  Vec3 c0, c1, c2;
+}; // end of struct Mat3
+
+inline Vec3 operator*(const Mat3& m, const Vec3& v)
+{
+  return m.c0 * v.x + m.c1 * v.y + m.c2 * v.z;
+}
+
+inline Vec3 MultiplyTransposed(const Mat3& m, const Vec3& v)
+{
+  return {Dot(m.c0, v), Dot(m.c1, v), Dot(m.c2, v)};
+}
+
+inline Mat3 RotationMatrix(const Quat& q)
+{
+  const auto xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+  const auto xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+  const auto xw = q.x * q.w, yw = q.y * q.w, zw = q.z * q.w;
+  return {{1.f - 2.f * (yy + zz), 2.f * (xy + zw), 2.f * (xz - yw)},
+          {2.f * (xy - zw), 1.f - 2.f * (xx + zz), 2.f * (yz + xw)},
+          {2.f * (xz + yw), 2.f * (yz - xw), 1.f - 2.f * (xx + yy)}};
+}
+
+/**
+ * Inverse inertia tensor in world space: R * diag(inverseInertia) * transpose(R)
+ */
+inline Mat3 WorldInverseInertia(const Mat3& r, const Vec3& inverseInertia)
+{
+  const auto column = [&](float x, float y, float z) {
+    return r.c0 * (inverseInertia.x * x) + r.c1 * (inverseInertia.y * y)
+           + r.c2 * (inverseInertia.z * z);
+  };
+  return {column(r.c0.x, r.c1.x, r.c2.x), column(r.c0.y, r.c1.y, r.c2.y),
+          column(r.c0.z, r.c1.z, r.c2.z)};
+}
+
+struct Pose {
+  Vec3 position;
+  Mat3 rotation;
+
+  [[nodiscard]] Vec3 transform(const Vec3& point) const
+  {
+    return rotation * point + position;
+  }
+
+  [[nodiscard]] Vec3 inverseTransform(const Vec3& point) const
+  {
+    return MultiplyTransposed(rotation, point - position);
+  }
+}; // end of struct Pose
+
+/**
+ * Closest points of the segments [p1, q1] and [p2, q2]
+ */
+void ClosestPointsOfSegments(const Vec3& p1, const Vec3& q1, const Vec3& p2, const Vec3& q2,
+                             Vec3& c1, Vec3& c2)
+{
+  const auto d1 = q1 - p1, d2 = q2 - p2, r = p1 - p2;
+  const auto a = Dot(d1, d1), e = Dot(d2, d2), f = Dot(d2, r);
+  auto s = 0.f, t = 0.f;
+  if (a <= 1e-12f && e <= 1e-12f) {
+    c1 = p1;
+    c2 = p2;
+    return;
+  }
+  if (a <= 1e-12f) {
+    t = std::clamp(f / e, 0.f, 1.f);
+  }
+  else {
+    const auto c = Dot(d1, r);
+    if (e <= 1e-12f) {
+      s = std::clamp(-c / a, 0.f, 1.f);
+    }
+    else {
+      const auto b     = Dot(d1, d2);
+      const auto denom = a * e - b * b;
+      s                = denom > 1e-12f ? std::clamp((b * f - c * e) / denom, 0.f, 1.f) : 0.f;
+      t                = (b * s + f) / e;
+      if (t < 0.f) {
+        t = 0.f;
+        s = std::clamp(-c / a, 0.f, 1.f);
+      }
+      else if (t > 1.f) {
+        t = 1.f;
+        s = std::clamp((b - c) / a, 0.f, 1.f);
+      }
+    }
+  }
+  c1 = p1 + d1 * s;
+  c2 = p2 + d2 * t;
+}
+
+inline Vec3 ClosestPointOnSegment(const Vec3& point, const Vec3& p, const Vec3& q)
+{
+  const auto d      = q - p;
+  const auto length = LengthSquared(d);
+  const auto t      = length > 1e-12f ? std::clamp(Dot(point - p, d) / length, 0.f, 1.f) : 0.f;
+  return p + d * t;
+}
+
+//------------------------------------------------------------------------------------------------
+// Narrowphase
+//------------------------------------------------------------------------------------------------
+
+struct Contact {
+  Vec3 position;
+  // From the first shape to the second one
+  Vec3 normal;
+  float separation;
+}; // end of struct Contact
+
+/**
+ * Contacts of a pair of shapes before their reduction to the points of a manifold, the deepest
+ * ones being kept when there are too many of them
+ */
+struct ContactBuffer {
+  static constexpr size_t Capacity = 64;
+
+  void add(const Vec3& position, const Vec3& normal, float separation)
+  {
+    if (count < Capacity) {
+      contacts[count++] = Contact{position, normal, separation};
+      return;
+    }
+    auto shallowest = std::max_element(
+      contacts.begin(), contacts.end(),
+      [](const Contact& a, const Contact& b) { return a.separation < b.separation; });
+    if (shallowest->separation > separation) {
+      *shallowest = Contact{position, normal, separation};
+    }
+  }
+
+  std::array<Contact, Capacity> contacts;
+  size_t count = 0;
+}; // end of struct ContactBuffer
+
+struct WorldPlane {
+  Vec3 normal;
+  float distance;
+}; // end of struct WorldPlane
+
+/**
+ * Polyhedron (or triangle) in world space, sharing the topology of its shape
+ */
+struct WorldPolyhedron {
+  static constexpr size_t MaxVertices = NativePhysicsShape::MaxConvexHullVertices;
+  static constexpr size_t MaxFaces    = 2 * NativePhysicsShape::MaxConvexHullVertices;
+
+  [[nodiscard]] Vec3 support(const Vec3& direction) const
+  {
+    auto best        = 0u;
+    auto bestDotProd = Dot(vertices[0], direction);
+    for (uint32_t i = 1; i < vertexCount; ++i) {
+      const auto dotProd = Dot(vertices[i], direction);
+      if (dotProd > bestDotProd) {
+        best        = i;
+        bestDotProd = dotProd;
+      }
+    }
+    return vertices[best];
+  }
+
+  [[nodiscard]] const Vec3& faceVertex(size_t face, size_t index) const
+  {
+    return vertices[faceVertices[faces[face].firstVertex + index]];
+  }
+
+  const NativePhysicsShape::Face* faces;
+  uint32_t faceCount;
+  const uint32_t* faceVertices;
+  const NativePhysicsShape::Edge* edges;
+  uint32_t edgeCount;
+  uint32_t vertexCount;
+  std::array<Vec3, MaxVertices> vertices;
+  std::array<WorldPlane, MaxFaces> planes;
+  Vec3 center;
+}; // end of struct WorldPolyhedron
+
+const std::array<NativePhysicsShape::Face, 2> TriangleFaces{
+  {{{{0.f, 0.f, 0.f}}, 0.f, 0, 3}, {{{0.f, 0.f, 0.f}}, 0.f, 3, 3}}};
+const std::array<uint32_t, 6> TriangleFaceVertices{{0, 1, 2, 0, 2, 1}};
+const std::array<NativePhysicsShape::Edge, 3> TriangleEdges{
+  {{0, 1, 0, 1}, {1, 2, 0, 1}, {0, 2, 0, 1}}};
+
+void SetPolyhedron(const NativePhysicsShape& shape, const Pose& pose, WorldPolyhedron& result)
+{
+  const auto& vertices = shape.vertices();
+  const auto& faces    = shape.faces();
+  result.faces         = faces.data();
+  result.faceCount = static_cast<uint32_t>(std::min(faces.size(), WorldPolyhedron::MaxFaces));
+  result.faceVertices = shape.faceVertices().data();
+  result.edges        = shape.edges().data();
+  result.edgeCount    = static_cast<uint32_t>(shape.edges().size());
+  result.vertexCount
+    = static_cast<uint32_t>(std::min(vertices.size(), WorldPolyhedron::MaxVertices));
+  for (uint32_t i = 0; i < result.vertexCount; ++i) {
+    result.vertices[i] = pose.transform(Load(vertices[i]));
+  }
+  for (uint32_t i = 0; i < result.faceCount; ++i) {
+    const auto normal = pose.rotation * Load(faces[i].normal);
+    result.planes[i]  = WorldPlane{normal, faces[i].distance + Dot(normal, pose.position)};
+  }
+  const auto& bounds = shape.localBounds();
+  result.center      = pose.transform(Vec3{(bounds.minimum[0] + bounds.maximum[0]) * 0.5f,
+                                      (bounds.minimum[1] + bounds.maximum[1]) * 0.5f,
+                                      (bounds.minimum[2] + bounds.maximum[2]) * 0.5f});
+}
+
+/**
+ * Sets a triangle as a flat polyhedron with a face on each side, returns false for a degenerated
+ * triangle
+ */
+bool SetTriangle(const Vec3& p0, const Vec3& p1, const Vec3& p2, WorldPolyhedron& result)
+{
+  const auto normal = Cross(p1 - p0, p2 - p0);
+  const auto length = Length(normal);
+  if (length <= 1e-12f) {
+    return false;
+  }
+  const auto unitNormal = normal * (1.f / length);
+  result.faces          = TriangleFaces.data();
+  result.faceCount      = 2;
+  result.faceVertices   = TriangleFaceVertices.data();
+  result.edges          = TriangleEdges.data();
+  result.edgeCount      = 3;
+  result.vertexCount    = 3;
+  result.vertices[0]    = p0;
+  result.vertices[1]    = p1;
+  result.vertices[2]    = p2;
+  result.planes[0]      = WorldPlane{unitNormal, Dot(unitNormal, p0)};
+  result.planes[1]      = WorldPlane{-unitNormal, -Dot(unitNormal, p0)};
+  result.center         = (p0 + p1 + p2) * (1.f / 3.f);
+  return true;
+}
+
+/**
+ * Signed distance of a point to a polyhedron, with the closest point of the polyhedron and the
+ * outward normal at this point (the one of the least deep face for an inner point)
+ */
+float SignedDistance(const WorldPolyhedron& polyhedron, const Vec3& point, Vec3& closest,
+                     Vec3& normal)
+{
+  auto bestFace       = 0u;
+  auto bestSeparation = -std::numeric_limits<float>::max();
+  for (uint32_t face = 0; face < polyhedron.faceCount; ++face) {
+    const auto& plane     = polyhedron.planes[face];
+    const auto separation = Dot(plane.normal, point) - plane.distance;
+    if (separation > bestSeparation) {
+      bestFace       = face;
+      bestSeparation = separation;
+    }
+  }
+
+  const auto& faceNormal = polyhedron.planes[bestFace].normal;
+  closest                = point - faceNormal * bestSeparation;
+  normal                 = faceNormal;
+  if (bestSeparation <= 0.f) {
+    return bestSeparation;
+  }
+
+  // The projection on the face is the closest point when it lies inside the face, else the
+  // closest point is on an edge
+  const auto& face = polyhedron.faces[bestFace];
+  auto inside      = true;
+  for (uint32_t i = 0; i < face.vertexCount && inside; ++i) {
+    const auto& v0 = polyhedron.faceVertex(bestFace, i);
+    const auto& v1 = polyhedron.faceVertex(bestFace, (i + 1) % face.vertexCount);
+    inside         = Dot(Cross(v1 - v0, faceNormal), closest - v0) <= 0.f;
+  }
+  if (inside) {
+    return bestSeparation;
+  }
+
+  auto bestDistance = std::numeric_limits<float>::max();
+  for (uint32_t i = 0; i < polyhedron.edgeCount; ++i) {
+    const auto& edge      = polyhedron.edges[i];
+    const auto edgePoint  = ClosestPointOnSegment(point, polyhedron.vertices[edge.vertex0],
+                                                 polyhedron.vertices[edge.vertex1]);
+    const auto distance = LengthSquared(point - edgePoint);
+    if (distance < bestDistance) {
+      bestDistance = distance;
+      closest      = edgePoint;
+    }
+  }
+  bestDistance = std::sqrt(bestDistance);
+  normal       = NormalizeOr(point - closest, faceNormal);
+  return bestDistance;
+}
+
+void CollideSpheres(const Vec3& centerA, float radiusA, const Vec3& centerB, float radiusB,
+                    ContactBuffer& contacts)
+{
+  const auto delta    = centerB - centerA;
+  const auto distance = Length(delta);
+  if (distance > radiusA + radiusB + NativePhysicsWorld::ContactMargin) {
+    return;
+  }
+  const auto normal = distance > 1e-6f ? delta * (1.f / distance) : Vec3{0.f, 1.f, 0.f};
+  const auto pointA = centerA + normal * radiusA, pointB = centerB - normal * radiusB;
+  contacts.add((pointA + pointB) * 0.5f, normal, distance - radiusA - radiusB);
+}
+
+void CollideSpherePolyhedron(const Vec3& center, float radius, const WorldPolyhedron& polyhedron,
+                             ContactBuffer& contacts)
+{
+  Vec3 closest, normal;
+  const auto distance = SignedDistance(polyhedron, center, closest, normal);
+  if (distance > radius + NativePhysicsWorld::ContactMargin) {
+    return;
+  }
+  const auto spherePoint = center - normal * radius;
+  contacts.add((spherePoint + closest) * 0.5f, -normal, distance - radius);
+}
+
+void CollideCapsules(const Vec3& p1, const Vec3& q1, float radius1, const Vec3& p2,
+                     const Vec3& q2, float radius2, ContactBuffer& contacts)
+{
+  const auto d1 = q1 - p1, d2 = q2 - p2;
+  const auto parallel
+    = LengthSquared(Cross(d1, d2)) <= 1e-3f * LengthSquared(d1) * LengthSquared(d2);
+  if (parallel && LengthSquared(d1) > 1e-12f && LengthSquared(d2) > 1e-12f) {
+    // Side by side capsules touch along a segment, its ends are the contacts
+    ContactBuffer endContacts;
+    for (const auto& end : {p1, q1}) {
+      CollideSpheres(end, radius1, ClosestPointOnSegment(end, p2, q2), radius2, endContacts);
+    }
+    for (const auto& end : {p2, q2}) {
+      CollideSpheres(ClosestPointOnSegment(end, p1, q1), radius1, end, radius2, endContacts);
+    }
+    for (size_t i = 0; i < endContacts.count; ++i) {
+      const auto& contact = endContacts.contacts[i];
+      contacts.add(contact.position, contact.normal, contact.separation);
+    }
+    return;
+  }
+
+  Vec3 c1, c2;
+  ClosestPointsOfSegments(p1, q1, p2, q2, c1, c2);
+  CollideSpheres(c1, radius1, c2, radius2, contacts);
+}
+
+void CollideCapsulePolyhedron(const Vec3& p, const Vec3& q, float radius,
+                              const WorldPolyhedron& polyhedron, ContactBuffer& contacts)
+{
+  const auto margin = radius + NativePhysicsWorld::ContactMargin;
+
+  // The signed distance along the segment is convex, its minimum is found with a golden section
+  // search
+  const auto distanceAt = [&](float t, Vec3& closest, Vec3& normal) {
+    return SignedDistance(polyhedron, p + (q - p) * t, closest, normal);
+  };
+  Vec3 closest, normal;
+  constexpr auto invPhi = 0.618034f;
+  auto low = 0.f, high = 1.f;
+  auto t1 = high - invPhi * (high - low), t2 = low + invPhi * (high - low);
+  auto f1 = distanceAt(t1, closest, normal), f2 = distanceAt(t2, closest, normal);
+  for (unsigned int iteration = 0; iteration < 24; ++iteration) {
+    if (f1 < f2) {
+      high = t2;
+      t2   = t1;
+      f2   = f1;
+      t1   = high - invPhi * (high - low);
+      f1   = distanceAt(t1, closest, normal);
+    }
+    else {
+      low = t1;
+      t1  = t2;
+      f1  = f2;
+      t2  = low + invPhi * (high - low);
+      f2  = distanceAt(t2, closest, normal);
+    }
+  }
+  const auto t        = (low + high) * 0.5f;
+  const auto distance = distanceAt(t, closest, normal);
+  if (distance > margin) {
+    return;
+  }
+
+  // A capsule lying on a face touches it along the part of its segment above the face
+  const auto axis = q - p;
+  auto faceIndex  = 0u;
+  auto faceDot    = -1.f;
+  for (uint32_t face = 0; face < polyhedron.faceCount; ++face) {
+    const auto dotProd = Dot(polyhedron.planes[face].normal, normal);
+    if (dotProd > faceDot) {
+      faceIndex = face;
+      faceDot   = dotProd;
+    }
+  }
+  const auto& plane = polyhedron.planes[faceIndex];
+  if (faceDot > 0.999f && std::abs(Dot(axis, plane.normal)) <= 0.1f * Length(axis)) {
+    auto clipStart = 0.f, clipEnd = 1.f;
+    const auto& face = polyhedron.faces[faceIndex];
+    for (uint32_t i = 0; i < face.vertexCount; ++i) {
+      const auto& v0        = polyhedron.faceVertex(faceIndex, i);
+      const auto& v1        = polyhedron.faceVertex(faceIndex, (i + 1) % face.vertexCount);
+      const auto sideNormal = Cross(v1 - v0, plane.normal);
+      const auto startSide = Dot(sideNormal, p - v0), axisSide = Dot(sideNormal, axis);
+      if (std::abs(axisSide) <= 1e-12f) {
+        if (startSide > 0.f) {
+          clipEnd = -1.f;
+        }
+        continue;
+      }
+      const auto crossing = -startSide / axisSide;
+      if (axisSide > 0.f) {
+        clipEnd = std::min(clipEnd, crossing);
+      }
+      else {
+        clipStart = std::max(clipStart, crossing);
+      }
+    }
+    if (clipStart <= clipEnd) {
+      for (const auto clip : {clipStart, clipEnd}) {
+        const auto point      = p + axis * clip;
+        const auto separation = Dot(plane.normal, point) - plane.distance - radius;
+        if (separation <= NativePhysicsWorld::ContactMargin) {
+          contacts.add(point - plane.normal * (radius + separation * 0.5f), -plane.normal,
+                       separation);
+        }
+      }
+      return;
+    }
+  }
+
+  // Else the ends of the segment and its closest point
+  auto endsDistance = std::numeric_limits<float>::max();
+  for (const auto end : {0.f, 1.f}) {
+    Vec3 endClosest, endNormal;
+    const auto endDistance = distanceAt(end, endClosest, endNormal);
+    if (endDistance <= margin) {
+      const auto spherePoint = p + axis * end - endNormal * radius;
+      contacts.add((spherePoint + endClosest) * 0.5f, -endNormal, endDistance - radius);
+    }
+    endsDistance = std::min(endsDistance, endDistance);
+  }
+  if (t > 0.02f && t < 0.98f && distance < endsDistance - NativePhysicsWorld::LinearSlop) {
+    const auto spherePoint = p + axis * t - normal * radius;
+    contacts.add((spherePoint + closest) * 0.5f, -normal, distance - radius);
+  }
+}
+
+struct FaceQuery {
+  uint32_t face;
+  float separation;
+}; // end of struct FaceQuery
+
+struct EdgeQuery {
+  uint32_t edgeA;
+  uint32_t edgeB;
+  float separation;
+  Vec3 axis;
+}; // end of struct EdgeQuery
+
+FaceQuery QueryFaceDirections(const WorldPolyhedron& a, const WorldPolyhedron& b)
+{
+  FaceQuery query{0u, -std::numeric_limits<float>::max()};
+  for (uint32_t face = 0; face < a.faceCount; ++face) {
+    const auto& plane     = a.planes[face];
+    const auto separation = Dot(plane.normal, b.support(-plane.normal)) - plane.distance;
+    if (separation > query.separation) {
+      query = FaceQuery{face, separation};
+      if (separation > NativePhysicsWorld::ContactMargin) {
+        break;
+      }
+    }
+  }
+  return query;
+}
+
+/**
+ * Tests if the arcs AB and CD of the Gauss maps of two edges intersect, i.e. if the edges build a
+ * face of the Minkowski difference
+ */
+bool IsMinkowskiFace(const Vec3& a, const Vec3& b, const Vec3& c, const Vec3& d)
+{
+  const auto bxa = Cross(b, a), dxc = Cross(d, c);
+  const auto cba = Dot(c, bxa), dba = Dot(d, bxa);
+  const auto adc = Dot(a, dxc), bdc = Dot(b, dxc);
+  return cba * dba < 0.f && adc * bdc < 0.f && cba * bdc > 0.f;
+}
+
+bool IsMinkowskiFace(const WorldPolyhedron& a, const NativePhysicsShape::Edge& edgeA,
+                     const WorldPolyhedron& b, const NativePhysicsShape::Edge& edgeB)
+{
+  // The Gauss map of an edge of a flat polyhedron is the half circle between its faces passing
+  // through its outward direction, tested as two arcs
+  const auto arcs = [](const WorldPolyhedron& polyhedron, const NativePhysicsShape::Edge& edge,
+                       bool negate, std::array<Vec3, 3>& points) {
+    const auto sign = negate ? -1.f : 1.f;
+    points[0]       = polyhedron.planes[edge.face0].normal * sign;
+    points[2]       = polyhedron.planes[edge.face1].normal * sign;
+    if (Dot(points[0], points[2]) > -0.999f) {
+      points[1] = points[2];
+      return false;
+    }
+    const auto& v0 = polyhedron.vertices[edge.vertex0];
+    const auto& v1 = polyhedron.vertices[edge.vertex1];
+    auto outward   = NormalizeOr(Cross(v1 - v0, points[0]), points[0]);
+    if (Dot(outward, v0 - polyhedron.center) * sign < 0.f) {
+      outward = -outward;
+    }
+    points[1] = outward;
+    return true;
+  };
+  std::array<Vec3, 3> arcA, arcB;
+  const auto splitA = arcs(a, edgeA, false, arcA);
+  const auto splitB = arcs(b, edgeB, true, arcB);
+  for (unsigned int i = 0; i < (splitA ? 2u : 1u); ++i) {
+    const auto& a0 = arcA[i];
+    const auto& a1 = splitA ? arcA[i + 1] : arcA[2];
+    for (unsigned int j = 0; j < (splitB ? 2u : 1u); ++j) {
+      if (IsMinkowskiFace(a0, a1, arcB[j], splitB ? arcB[j + 1] : arcB[2])) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+EdgeQuery QueryEdgeDirections(const WorldPolyhedron& a, const WorldPolyhedron& b)
+{
+  EdgeQuery query{0u, 0u, -std::numeric_limits<float>::max(), Vec3{0.f, 0.f, 0.f}};
+  for (uint32_t i = 0; i < a.edgeCount; ++i) {
+    const auto& edgeA = a.edges[i];
+    if (edgeA.face0 == edgeA.face1) {
+      continue;
+    }
+    const auto& pA       = a.vertices[edgeA.vertex0];
+    const auto directionA = a.vertices[edgeA.vertex1] - pA;
+    for (uint32_t j = 0; j < b.edgeCount; ++j) {
+      const auto& edgeB = b.edges[j];
+      if (edgeB.face0 == edgeB.face1 || !IsMinkowskiFace(a, edgeA, b, edgeB)) {
+        continue;
+      }
+      const auto& pB   = b.vertices[edgeB.vertex0];
+      auto axis        = Cross(directionA, b.vertices[edgeB.vertex1] - pB);
+      const auto length = Length(axis);
+      if (length <= 1e-6f * Length(directionA)) {
+        continue;
+      }
+      axis = axis * (1.f / length);
+      if (Dot(axis, pA - a.center) < 0.f) {
+        axis = -axis;
+      }
+      const auto separation = Dot(axis, pB - pA);
+      if (separation > query.separation) {
+        query = EdgeQuery{i, j, separation, axis};
+        if (separation > NativePhysicsWorld::ContactMargin) {
+          return query;
+        }
+      }
+    }
+  }
+  return query;
+}
+
+/**
+ * Clips the incident face of a polyhedron against the side planes of the reference face of the
+ * other one, the points below the reference face are the contacts
+ */
+void ClipFaces(const WorldPolyhedron& reference, uint32_t referenceFace,
+               const WorldPolyhedron& incident, bool flip, ContactBuffer& contacts)
+{
+  constexpr size_t MaxPolygonSize = 2 * WorldPolyhedron::MaxVertices + 8;
+  const auto& plane               = reference.planes[referenceFace];
+
+  auto incidentFace = 0u;
+  auto minDotProd   = std::numeric_limits<float>::max();
+  for (uint32_t face = 0; face < incident.faceCount; ++face) {
+    const auto dotProd = Dot(incident.planes[face].normal, plane.normal);
+    if (dotProd < minDotProd) {
+      incidentFace = face;
+      minDotProd   = dotProd;
+    }
+  }
+
+  std::array<Vec3, MaxPolygonSize> polygon, clipped;
+  size_t polygonSize = 0;
+  for (uint32_t i = 0; i < incident.faces[incidentFace].vertexCount; ++i) {
+    polygon[polygonSize++] = incident.faceVertex(incidentFace, i);
+  }
+
+  const auto& face = reference.faces[referenceFace];
+  for (uint32_t i = 0; i < face.vertexCount && polygonSize > 0; ++i) {
+    const auto& v0        = reference.faceVertex(referenceFace, i);
+    const auto& v1        = reference.faceVertex(referenceFace, (i + 1) % face.vertexCount);
+    const auto sideNormal = Cross(v1 - v0, plane.normal);
+    const auto sideOffset = Dot(sideNormal, v0);
+
+    // Sutherland-Hodgman
+    size_t clippedSize = 0;
+    for (size_t j = 0; j < polygonSize; ++j) {
+      const auto& start     = polygon[j];
+      const auto& end       = polygon[(j + 1) % polygonSize];
+      const auto startSide = Dot(sideNormal, start) - sideOffset;
+      const auto endSide   = Dot(sideNormal, end) - sideOffset;
+      if (startSide <= 0.f && clippedSize < MaxPolygonSize) {
+        clipped[clippedSize++] = start;
+      }
+      if ((startSide < 0.f && endSide > 0.f) || (startSide > 0.f && endSide < 0.f)) {
+        if (clippedSize < MaxPolygonSize) {
+          clipped[clippedSize++] = start + (end - start) * (startSide / (startSide - endSide));
+        }
+      }
+    }
+    std::copy(clipped.begin(), clipped.begin() + static_cast<std::ptrdiff_t>(clippedSize),
+              polygon.begin());
+    polygonSize = clippedSize;
+  }
+
+  const auto normal = flip ? -plane.normal : plane.normal;
+  for (size_t i = 0; i < polygonSize; ++i) {
+    const auto separation = Dot(plane.normal, polygon[i]) - plane.distance;
+    if (separation <= NativePhysicsWorld::ContactMargin) {
+      contacts.add(polygon[i] - plane.normal * (separation * 0.5f), normal, separation);
+    }
+  }
+}
+
+void CollidePolyhedra(const WorldPolyhedron& a, const WorldPolyhedron& b, ContactBuffer& contacts)
+{
+  constexpr auto RelativeEdgeTolerance = 0.90f;
+  constexpr auto RelativeFaceTolerance = 0.98f;
+  constexpr auto AbsoluteTolerance     = 0.5f * NativePhysicsWorld::LinearSlop;
+
+  const auto faceQueryA = QueryFaceDirections(a, b);
+  if (faceQueryA.separation > NativePhysicsWorld::ContactMargin) {
+    return;
+  }
+  const auto faceQueryB = QueryFaceDirections(b, a);
+  if (faceQueryB.separation > NativePhysicsWorld::ContactMargin) {
+    return;
+  }
+  const auto edgeQuery = QueryEdgeDirections(a, b);
+  if (edgeQuery.separation > NativePhysicsWorld::ContactMargin) {
+    return;
+  }
+
+  // The faces are preferred to the edges, and the faces of the first polyhedron to the ones of
+  // the second one, to keep the same contacts from a step to the next one
+  const auto faceSeparation = std::max(faceQueryA.separation, faceQueryB.separation);
+  if (edgeQuery.separation > RelativeEdgeTolerance * faceSeparation + AbsoluteTolerance) {
+    const auto& edgeA = a.edges[edgeQuery.edgeA];
+    const auto& edgeB = b.edges[edgeQuery.edgeB];
+    Vec3 pointA, pointB;
+    ClosestPointsOfSegments(a.vertices[edgeA.vertex0], a.vertices[edgeA.vertex1],
+                            b.vertices[edgeB.vertex0], b.vertices[edgeB.vertex1], pointA, pointB);
+    contacts.add((pointA + pointB) * 0.5f, edgeQuery.axis, edgeQuery.separation);
+  }
+  else if (faceQueryB.separation
+           > RelativeFaceTolerance * faceQueryA.separation + AbsoluteTolerance) {
+    ClipFaces(b, faceQueryB.face, a, true, contacts);
+  }
+  else {
+    ClipFaces(a, faceQueryA.face, b, false, contacts);
+  }
+}
+
+/**
+ * Keeps the deepest contact and the ones spanning the largest area around it
+ */
+size_t ReduceContacts(ContactBuffer& buffer, size_t maxContacts)
+{
+  auto& contacts = buffer.contacts;
+  if (buffer.count <= maxContacts) {
+    return buffer.count;
+  }
+
+  const auto begin = contacts.begin(), end = contacts.begin() + buffer.count;
+  std::iter_swap(begin, std::min_element(begin, end, [](const Contact& a, const Contact& b) {
+                   return a.separation < b.separation;
+                 }));
+  const auto p0 = contacts[0].position;
+  std::iter_swap(begin + 1,
+                 std::max_element(begin + 1, end, [&](const Contact& a, const Contact& b) {
+                   return LengthSquared(a.position - p0) < LengthSquared(b.position - p0);
+                 }));
+  const auto p1        = contacts[1].position;
+  const auto& normal   = contacts[0].normal;
+  const auto areaOf    = [&](const Contact& contact) {
+    return Dot(Cross(p1 - p0, contact.position - p0), normal);
+  };
+  std::iter_swap(begin + 2,
+                 std::max_element(begin + 2, end, [&](const Contact& a, const Contact& b) {
+                   return areaOf(a) < areaOf(b);
+                 }));
+  if (maxContacts > 3) {
+    std::iter_swap(begin + 3,
+                   std::min_element(begin + 3, end, [&](const Contact& a, const Contact& b) {
+                     return areaOf(a) < areaOf(b);
+                   }));
+  }
+  return std::min(maxContacts, buffer.count);
+}
+
+struct ShapePose {
+  const NativePhysicsShape* shape;
+  Pose pose;
+}; // end of struct ShapePose
+
+inline void CapsuleSegment(const ShapePose& capsule, Vec3& p, Vec3& q)
+{
+  const auto axis = capsule.pose.rotation.c1 * capsule.shape->halfHeight();
+  p               = capsule.pose.position - axis;
+  q               = capsule.pose.position + axis;
+}
+
+/**
+ * Collides a convex shape with a polyhedron (a convex shape or a triangle of a mesh)
+ */
+void CollideWithPolyhedron(const ShapePose& a, const WorldPolyhedron& b, ContactBuffer& contacts)
+{
+  switch (a.shape->type()) {
+    case NativePhysicsShape::Type::Sphere:
+      CollideSpherePolyhedron(a.pose.position, a.shape->radius(), b, contacts);
+      break;
+    case NativePhysicsShape::Type::Capsule: {
+      Vec3 p, q;
+      CapsuleSegment(a, p, q);
+      CollideCapsulePolyhedron(p, q, a.shape->radius(), b, contacts);
+    } break;
+    case NativePhysicsShape::Type::Box:
+    case NativePhysicsShape::Type::ConvexHull: {
+      WorldPolyhedron polyhedron;
+      SetPolyhedron(*a.shape, a.pose, polyhedron);
+      CollidePolyhedra(polyhedron, b, contacts);
+    } break;
+    default:
+      break;
+  }
+}
+
+/**
+ * Collides two shapes, the type of the first one being lower than or equal to the type of the
+ * second one
+ */
+void CollideShapes(const ShapePose& a, const ShapePose& b, const BVHBounds& boundsA,
+                   ContactBuffer& contacts)
+{
+  using Type = NativePhysicsShape::Type;
+
+  const auto typeB = b.shape->type();
+  if (typeB == Type::Mesh) {
+    if (!b.shape->triangleBVH()) {
+      return;
+    }
+    // The triangles overlapping the bounds of the other shape, in the space of the mesh
+    auto localBounds = BVHBounds::Empty();
+    for (unsigned int corner = 0; corner < 8; ++corner) {
+      const Vec3 point{(corner & 1) ? boundsA.maximum[0] : boundsA.minimum[0],
+                       (corner & 2) ? boundsA.maximum[1] : boundsA.minimum[1],
+                       (corner & 4) ? boundsA.maximum[2] : boundsA.minimum[2]};
+      const auto localPoint = ToVector3(b.pose.inverseTransform(point));
+      localBounds.extend(BVHBounds::FromMinMax(localPoint, localPoint));
+    }
+    const auto& positions = b.shape->meshPositions();
+    const auto& indices   = b.shape->triangleBVH()->indices();
+    WorldPolyhedron triangle;
+    b.shape->triangleBVH()->intersectsBounds(localBounds, [&](uint32_t triangleIndex) {
+      const auto index = static_cast<size_t>(triangleIndex) * 3;
+      if (SetTriangle(b.pose.transform(Load(positions[indices[index]])),
+                      b.pose.transform(Load(positions[indices[index + 1]])),
+                      b.pose.transform(Load(positions[indices[index + 2]])), triangle)) {
+        CollideWithPolyhedron(a, triangle, contacts);
+      }
+      return false;
+    });
+    return;
+  }
+
+  switch (a.shape->type()) {
+    case Type::Sphere:
+      if (typeB == Type::Sphere) {
+        CollideSpheres(a.pose.position, a.shape->radius(), b.pose.position, b.shape->radius(),
+                       contacts);
+      }
+      else if (typeB == Type::Capsule) {
+        Vec3 p, q;
+        CapsuleSegment(b, p, q);
+        CollideSpheres(a.pose.position, a.shape->radius(),
+                       ClosestPointOnSegment(a.pose.position, p, q), b.shape->radius(), contacts);
+      }
+      else {
+        WorldPolyhedron polyhedron;
+        SetPolyhedron(*b.shape, b.pose, polyhedron);
+        CollideSpherePolyhedron(a.pose.position, a.shape->radius(), polyhedron, contacts);
+      }
+      break;
+    case Type::Capsule:
+      if (typeB == Type::Capsule) {
+        Vec3 p1, q1, p2, q2;
+        CapsuleSegment(a, p1, q1);
+        CapsuleSegment(b, p2, q2);
+        CollideCapsules(p1, q1, a.shape->radius(), p2, q2, b.shape->radius(), contacts);
+      }
+      else {
+        WorldPolyhedron polyhedron;
+        SetPolyhedron(*b.shape, b.pose, polyhedron);
+        Vec3 p, q;
+        CapsuleSegment(a, p, q);
+        CollideCapsulePolyhedron(p, q, a.shape->radius(), polyhedron, contacts);
+      }
+      break;
+    default: {
+      WorldPolyhedron polyhedronA, polyhedronB;
+      SetPolyhedron(*a.shape, a.pose, polyhedronA);
+      SetPolyhedron(*b.shape, b.pose, polyhedronB);
+      CollidePolyhedra(polyhedronA, polyhedronB, contacts);
+    } break;
+  }
+}
+
+BVHBounds ComputeBounds(const NativePhysicsShape& shape, const Pose& pose, float margin)
+{
+  const auto& localBounds = shape.localBounds();
+  Vec3 center{}, extents{};
+  for (unsigned int axis = 0; axis < 3; ++axis) {
+    const auto middle = (localBounds.minimum[axis] + localBounds.maximum[axis]) * 0.5f;
+    const auto extent = (localBounds.maximum[axis] - localBounds.minimum[axis]) * 0.5f;
+    (axis == 0 ? center.x : (axis == 1 ? center.y : center.z))    = middle;
+    (axis == 0 ? extents.x : (axis == 1 ? extents.y : extents.z)) = extent;
+  }
+  if (shape.type() == NativePhysicsShape::Type::Sphere) {
+    extents = Vec3{shape.radius(), shape.radius(), shape.radius()};
+  }
+
+  // Extents of the rotated box
+  const auto& r       = pose.rotation;
+  const auto absolute = [](const Vec3& v) {
+    return Vec3{std::abs(v.x), std::abs(v.y), std::abs(v.z)};
+  };
+  const auto worldCenter  = pose.transform(center);
+  const auto worldExtents = absolute(r.c0) * extents.x + absolute(r.c1) * extents.y
+                            + absolute(r.c2) * extents.z + Vec3{margin, margin, margin};
+  return BVHBounds{{worldCenter.x - worldExtents.x, worldCenter.y - worldExtents.y,
+                    worldCenter.z - worldExtents.z},
+                   {worldCenter.x + worldExtents.x, worldCenter.y + worldExtents.y,
+                    worldCenter.z + worldExtents.z}};
+}
+
+inline bool Overlaps(const BVHBounds& a, const BVHBounds& b, unsigned int axis)
+{
+  return a.minimum[axis] <= b.maximum[axis] && b.minimum[axis] <= a.maximum[axis];
+}
+
+inline uint64_t PairKey(uint32_t uniqueIdA, uint32_t uniqueIdB)
+{
+  return uniqueIdA < uniqueIdB ? (static_cast<uint64_t>(uniqueIdA) << 32) | uniqueIdB :
+                                 (static_cast<uint64_t>(uniqueIdB) << 32) | uniqueIdA;
+}
+
+//------------------------------------------------------------------------------------------------
+// Ray casts, in the local space of the shapes
+//------------------------------------------------------------------------------------------------
+
+bool RaycastSphere(const Vec3& origin, const Vec3& direction, float radius, float maxDistance,
+                   float& distance, Vec3& normal, const Vec3& center = Vec3{0.f, 0.f, 0.f})
+{
+  const auto m = origin - center;
+  const auto b = Dot(m, direction);
+  const auto c = Dot(m, m) - radius * radius;
+  if (c > 0.f && b > 0.f) {
+    return false;
+  }
+  const auto discriminant = b * b - c;
+  if (discriminant < 0.f) {
+    return false;
+  }
+  const auto t = std::max(-b - std::sqrt(discriminant), 0.f);
+  if (t > maxDistance) {
+    return false;
+  }
+  distance = t;
+  normal   = NormalizeOr(origin + direction * t - center, -direction);
+  return true;
+}
+
+bool RaycastCapsule(const Vec3& origin, const Vec3& direction, float radius, float halfHeight,
+                    float maxDistance, float& distance, Vec3& normal)
+{
+  auto hit = false;
+  distance = maxDistance;
+
+  // Side of the cylinder, in the xz plane
+  const auto a = direction.x * direction.x + direction.z * direction.z;
+  const auto b = origin.x * direction.x + origin.z * direction.z;
+  const auto c = origin.x * origin.x + origin.z * origin.z - radius * radius;
+  if (a > 1e-12f) {
+    const auto discriminant = b * b - a * c;
+    if (discriminant >= 0.f) {
+      const auto t = std::max((-b - std::sqrt(discriminant)) / a, 0.f);
+      const auto y = origin.y + direction.y * t;
+      if (t <= distance && y >= -halfHeight && y <= halfHeight) {
+        const auto point = origin + direction * t;
+        hit              = true;
+        distance         = t;
+        normal           = NormalizeOr(Vec3{point.x, 0.f, point.z}, -direction);
+      }
+    }
+  }
+
+  // Caps
+  for (const auto capY : {-halfHeight, halfHeight}) {
+    auto capDistance = 0.f;
+    Vec3 capNormal;
+    if (RaycastSphere(origin, direction, radius, distance, capDistance, capNormal,
+                      Vec3{0.f, capY, 0.f})
+        && (!hit || capDistance < distance)) {
+      hit      = true;
+      distance = capDistance;
+      normal   = capNormal;
+    }
+  }
+  return hit;
+}
+
+bool RaycastPolyhedron(const NativePhysicsShape& shape, const Vec3& origin, const Vec3& direction,
+                       float maxDistance, float& distance, Vec3& normal)
+{
+  auto enter = 0.f, exit = maxDistance;
+  normal = -direction;
+  for (const auto& face : shape.faces()) {
+    const auto faceNormal = Load(face.normal);
+    const auto side       = Dot(faceNormal, origin) - face.distance;
+    const auto speed      = Dot(faceNormal, direction);
+    if (std::abs(speed) <= 1e-12f) {
+      if (side > 0.f) {
+        return false;
+      }
+      continue;
+    }
+    const auto t = -side / speed;
+    if (speed < 0.f) {
+      if (t > enter) {
+        enter  = t;
+        normal = faceNormal;
+      }
+    }
+    else {
+      exit = std::min(exit, t);
+    }
+    if (enter > exit) {
+      return false;
+    }
+  }
+  distance = enter;
+  return true;
+}
+
+} // end of anonymous namespace
+
+//------------------------------------------------------------------------------------------------
+// World
+//------------------------------------------------------------------------------------------------
+
+struct NativePhysicsWorld::ContactPoint {
+  Vec3 position;
+  // From the first body to the second one
+  Vec3 normal;
+  // Position in the space of the first body, matching the points of successive steps
+  Vec3 localPosition;
+  float separation;
+  float normalImpulse;
+  float tangentImpulse0;
+  float tangentImpulse1;
+}; // end of struct ContactPoint
+
+struct NativePhysicsWorld::ContactManifold {
+  uint64_t key;
+  uint32_t bodyA;
+  uint32_t bodyB;
+  uint32_t pointCount;
+  float friction;
+  float restitution;
+  std::array<ContactPoint, MaxManifoldPoints> points;
+}; // end of struct ContactManifold
+
+struct NativePhysicsWorld::Island {
+  uint32_t firstBody;
+  uint32_t bodyCount;
+  uint32_t firstManifold;
+  uint32_t manifoldCount;
+}; // end of struct Island
+
+struct NativePhysicsWorld::SolverBody {
+  Vec3 linearVelocity;
+  Vec3 angularVelocity;
+  Vec3 position;
+  Quat orientation;
+  Mat3 rotation;
+  Mat3 inverseInertia;
+  float inverseMass;
+  // Static or sleeping, not moved by the solver
+  bool isFixed;
+}; // end of struct SolverBody
+
+NativePhysicsWorld::NativePhysicsWorld(JobPool* jobPool)
+    : gravity{Vector3(0.f, -9.807f, 0.f)}
+    , velocityIterations{10}
+    , sleepingEnabled{true}
+    , _jobPool{jobPool ? jobPool : &JobPool::Default()}
+    , _nextUniqueId{0}
+    , _sweepAxis{0}
+{
+}
+
+NativePhysicsWorld::~NativePhysicsWorld() = default;
+
+NativePhysicsBody* NativePhysicsWorld::createBody(const NativePhysicsShapePtr& shape, float mass,
+                                                  const Vector3& position,
+                                                  const Quaternion& orientation)
+{
+  auto body = std::make_unique<NativePhysicsBody>(shape, mass);
+  body->_position.copyFrom(position);
+  body->_orientation.copyFrom(orientation);
+  body->_orientation.normalize();
+  body->_index    = _bodies.size();
+  body->_uniqueId = _nextUniqueId++;
+  _bodies.emplace_back(std::move(body));
+  return _bodies.back().get();
+}
+
+void NativePhysicsWorld::removeBody(NativePhysicsBody* body)
+{
+  if (!body || body->_index >= _bodies.size() || _bodies[body->_index].get() != body) {
+    return;
+  }
+
+  // The contacts of the body are dropped, its neighbors are woken up
+  const auto uniqueId = body->_uniqueId;
+  for (auto& manifold : _manifolds) {
+    const auto touching = (manifold.key >> 32) == uniqueId
+                          || (manifold.key & 0xFFFFFFFFu) == uniqueId;
+    if (touching) {
+      _bodies[manifold.bodyA]->awake();
+      _bodies[manifold.bodyB]->awake();
+      manifold.pointCount = 0;
+    }
+  }
+  _manifolds.erase(std::remove_if(_manifolds.begin(), _manifolds.end(),
+                                  [](const ContactManifold& m) { return m.pointCount == 0; }),
+                   _manifolds.end());
+
+  // The last body takes the place of the removed one
+  const auto index = body->_index;
+  if (index + 1 != _bodies.size()) {
+    const auto lastIndex = static_cast<uint32_t>(_bodies.size() - 1);
+    std::swap(_bodies[index], _bodies.back());
+    _bodies[index]->_index = index;
+    for (auto& manifold : _manifolds) {
+      manifold.bodyA = manifold.bodyA == lastIndex ? static_cast<uint32_t>(index) : manifold.bodyA;
+      manifold.bodyB = manifold.bodyB == lastIndex ? static_cast<uint32_t>(index) : manifold.bodyB;
+    }
+  }
+  _bodies.pop_back();
+  _sweepOrder.clear();
+}
+
+void NativePhysicsWorld::clear()
+{
+  _bodies.clear();
+  _sweepOrder.clear();
+  _pairs.clear();
+  _manifolds.clear();
+  _previousManifolds.clear();
+  _islands.clear();
+}
+
+size_t NativePhysicsWorld::contactCount() const
+{
+  return _manifolds.size();
+}
+
+size_t NativePhysicsWorld::islandCount() const
+{
+  return _islands.size();
+}
+
+size_t NativePhysicsWorld::awakeBodyCount() const
+{
+  return static_cast<size_t>(std::count_if(_bodies.begin(), _bodies.end(), [](const auto& body) {
+    return !body->isStatic() && !body->_sleeping;
+  }));
+}
+
+void NativePhysicsWorld::step(float delta)
+{
+  if (delta <= 0.f) {
+    return;
+  }
+
+  _prepareBodies(delta);
+  _findPairs();
+  _collide();
+  _buildIslands();
+
+  // The islands are independent, the largest ones are solved first
+  static constexpr size_t IslandGrainSize = 1;
+  _jobPool->parallelFor(_islands.size(), IslandGrainSize, [&](size_t begin, size_t end) {
+    for (size_t island = begin; island < end; ++island) {
+      _solveIsland(_islands[island], delta);
+    }
+  });
+}
+
+void NativePhysicsWorld::_prepareBodies(float /*delta*/)
+{
+  static constexpr size_t BodyGrainSize = 256;
+
+  _solverBodies.resize(_bodies.size());
+  _jobPool->parallelFor(_bodies.size(), BodyGrainSize, [&](size_t begin, size_t end) {
+    for (size_t index = begin; index < end; ++index) {
+      auto& body        = *_bodies[index];
+      auto& solverBody  = _solverBodies[index];
+      solverBody.isFixed         = body.isStatic() || body._sleeping;
+      solverBody.linearVelocity  = Load(body._linearVelocity);
+      solverBody.angularVelocity = Load(body._angularVelocity);
+      solverBody.position        = Load(body._position);
+      solverBody.orientation     = Normalize(Load(body._orientation));
+      solverBody.rotation        = RotationMatrix(solverBody.orientation);
+      _setSolverBodyMass(body, solverBody);
+      body._bounds = ComputeBounds(*body._shape, Pose{solverBody.position, solverBody.rotation},
+                                   ContactMargin);
+    }
+  });
+}
+
+void NativePhysicsWorld::_setSolverBodyMass(const NativePhysicsBody& body, SolverBody& solverBody)
+{
+  // The fixed bodies have an infinite mass for the contacts
+  if (solverBody.isFixed) {
+    solverBody.inverseMass    = 0.f;
+    solverBody.inverseInertia = Mat3{};
+  }
+  else {
+    solverBody.inverseMass = body._inverseMass;
+    solverBody.inverseInertia
+      = WorldInverseInertia(solverBody.rotation, Load(body._inverseInertia));
+  }
+}
+
+void NativePhysicsWorld::_findPairs()
+{
+  const auto nbBodies = static_cast<uint32_t>(_bodies.size());
+  _pairs.clear();
+
+  // Axis with the largest spread of the centers of the bodies, changed only when another axis is
+  // clearly better to keep the order of the bodies
+  std::array<double, 3> sum{}, sumSquares{};
+  for (const auto& body : _bodies) {
+    for (unsigned int axis = 0; axis < 3; ++axis) {
+      const double center = (body->_bounds.minimum[axis] + body->_bounds.maximum[axis]) * 0.5;
+      sum[axis] += center;
+      sumSquares[axis] += center * center;
+    }
+  }
+  std::array<double, 3> variance{};
+  for (unsigned int axis = 0; axis < 3; ++axis) {
+    variance[axis] = nbBodies > 0 ? sumSquares[axis] / nbBodies
+                                      - (sum[axis] / nbBodies) * (sum[axis] / nbBodies) :
+                                    0.0;
+  }
+  const auto bestAxis = static_cast<unsigned int>(
+    std::distance(variance.begin(), std::max_element(variance.begin(), variance.end())));
+  auto sorted = _sweepOrder.size() == nbBodies;
+  if (variance[bestAxis] > 1.5 * variance[_sweepAxis]) {
+    _sweepAxis = bestAxis;
+    sorted     = false;
+  }
+
+  const auto axis      = _sweepAxis;
+  const auto minimumOf = [this, axis](uint32_t index) {
+    return _bodies[index]->_bounds.minimum[axis];
+  };
+  if (!sorted) {
+    _sweepOrder.resize(nbBodies);
+    for (uint32_t i = 0; i < nbBodies; ++i) {
+      _sweepOrder[i] = i;
+    }
+    std::sort(_sweepOrder.begin(), _sweepOrder.end(),
+              [&](uint32_t a, uint32_t b) { return minimumOf(a) < minimumOf(b); });
+  }
+  else {
+    // Insertion sort of the nearly sorted bodies, replaced by a full sort when they moved a lot
+    size_t moves          = 0;
+    const size_t maxMoves = 8 * static_cast<size_t>(nbBodies) + 64;
+    for (size_t i = 1; i < nbBodies && moves <= maxMoves; ++i) {
+      const auto index   = _sweepOrder[i];
+      const auto minimum = minimumOf(index);
+      auto j             = i;
+      for (; j > 0 && minimumOf(_sweepOrder[j - 1]) > minimum; --j) {
+        _sweepOrder[j] = _sweepOrder[j - 1];
+        ++moves;
+      }
+      _sweepOrder[j] = index;
+    }
+    if (moves > maxMoves) {
+      std::sort(_sweepOrder.begin(), _sweepOrder.end(),
+                [&](uint32_t a, uint32_t b) { return minimumOf(a) < minimumOf(b); });
+    }
+  }
+
+  // Sweep: the bodies starting before the end of a body overlap it along the axis
+  const auto axis1 = (axis + 1) % 3, axis2 = (axis + 2) % 3;
+  for (uint32_t i = 0; i < nbBodies; ++i) {
+    const auto indexA  = _sweepOrder[i];
+    const auto& bodyA  = *_bodies[indexA];
+    const auto& boundsA = bodyA._bounds;
+    const auto activeA = !bodyA.isStatic() && !bodyA._sleeping;
+    for (uint32_t j = i + 1; j < nbBodies; ++j) {
+      const auto indexB = _sweepOrder[j];
+      const auto& bodyB = *_bodies[indexB];
+      if (bodyB._bounds.minimum[axis] > boundsA.maximum[axis]) {
+        break;
+      }
+      const auto activeB = !bodyB.isStatic() && !bodyB._sleeping;
+      if ((activeA || activeB) && (!bodyA.isStatic() || !bodyB.isStatic())
+          && Overlaps(boundsA, bodyB._bounds, axis1) && Overlaps(boundsA, bodyB._bounds, axis2)) {
+        _pairs.emplace_back(indexA, indexB);
+      }
+    }
+  }
+}
+
+void NativePhysicsWorld::_collide()
+{
+  static constexpr size_t PairGrainSize = 64;
+  // Contact points closer than this distance in successive steps share their impulses
+  static constexpr float WarmStartDistance = 0.05f;
+
+  std::swap(_manifolds, _previousManifolds);
+  _manifolds.resize(_pairs.size());
+
+  _jobPool->parallelFor(_pairs.size(), PairGrainSize, [&](size_t begin, size_t end) {
+    ContactBuffer contacts;
+    for (size_t pairIndex = begin; pairIndex < end; ++pairIndex) {
+      auto indexA = _pairs[pairIndex].first, indexB = _pairs[pairIndex].second;
+      // Shapes ordered by type, then by identifier for the same type
+      {
+        const auto typeA = _bodies[indexA]->_shape->type();
+        const auto typeB = _bodies[indexB]->_shape->type();
+        if (typeA > typeB
+            || (typeA == typeB && _bodies[indexA]->_uniqueId > _bodies[indexB]->_uniqueId)) {
+          std::swap(indexA, indexB);
+        }
+      }
+      const auto& bodyA       = *_bodies[indexA];
+      const auto& bodyB       = *_bodies[indexB];
+      const auto& solverBodyA = _solverBodies[indexA];
+      const auto& solverBodyB = _solverBodies[indexB];
+
+      auto& manifold       = _manifolds[pairIndex];
+      manifold.key         = PairKey(bodyA._uniqueId, bodyB._uniqueId);
+      manifold.bodyA       = indexA;
+      manifold.bodyB       = indexB;
+      manifold.pointCount  = 0;
+      manifold.friction    = std::sqrt(bodyA.friction * bodyB.friction);
+      manifold.restitution = std::max(bodyA.restitution, bodyB.restitution);
+
+      contacts.count = 0;
+      CollideShapes(ShapePose{bodyA._shape.get(), Pose{solverBodyA.position, solverBodyA.rotation}},
+                    ShapePose{bodyB._shape.get(), Pose{solverBodyB.position, solverBodyB.rotation}},
+                    bodyA._bounds, contacts);
+      if (contacts.count == 0) {
+        continue;
+      }
+
+      const auto previous = std::lower_bound(
+        _previousManifolds.begin(), _previousManifolds.end(), manifold.key,
+        [](const ContactManifold& m, uint64_t key) { return m.key < key; });
+      const auto hasPrevious = previous != _previousManifolds.end()
+                               && previous->key == manifold.key && previous->bodyA == indexA;
+
+      const Pose poseA{solverBodyA.position, solverBodyA.rotation};
+      manifold.pointCount = static_cast<uint32_t>(ReduceContacts(contacts, MaxManifoldPoints));
+      for (uint32_t i = 0; i < manifold.pointCount; ++i) {
+        const auto& contact = contacts.contacts[i];
+        auto& point         = manifold.points[i];
+        point.position      = contact.position;
+        point.normal        = contact.normal;
+        point.localPosition = poseA.inverseTransform(contact.position);
+        point.separation    = contact.separation;
+        point.normalImpulse = point.tangentImpulse0 = point.tangentImpulse1 = 0.f;
+        for (uint32_t j = 0; hasPrevious && j < previous->pointCount; ++j) {
+          const auto& previousPoint = previous->points[j];
+          if (LengthSquared(previousPoint.localPosition - point.localPosition)
+              <= WarmStartDistance * WarmStartDistance) {
+            point.normalImpulse   = previousPoint.normalImpulse;
+            point.tangentImpulse0 = previousPoint.tangentImpulse0;
+            point.tangentImpulse1 = previousPoint.tangentImpulse1;
+            break;
+          }
+        }
+      }
+    }
+  });
+
+  // Touching pairs only, sorted by key to be found by the next step
+  _manifolds.erase(std::remove_if(_manifolds.begin(), _manifolds.end(),
+                                  [](const ContactManifold& m) { return m.pointCount == 0; }),
+                   _manifolds.end());
+  std::sort(_manifolds.begin(), _manifolds.end(),
+            [](const ContactManifold& a, const ContactManifold& b) { return a.key < b.key; });
+}
+
+void NativePhysicsWorld::_buildIslands()
+{
+  const auto nbBodies = static_cast<uint32_t>(_bodies.size());
+  _islandParents.resize(nbBodies);
+  for (uint32_t i = 0; i < nbBodies; ++i) {
+    _islandParents[i] = i;
+  }
+  const auto find = [this](uint32_t index) {
+    while (_islandParents[index] != index) {
+      _islandParents[index] = _islandParents[_islandParents[index]];
+      index                 = _islandParents[index];
+    }
+    return index;
+  };
+
+  // The sleeping bodies touched by an awake body wake up, the touching dynamic bodies are merged
+  for (const auto& manifold : _manifolds) {
+    auto& bodyA = *_bodies[manifold.bodyA];
+    auto& bodyB = *_bodies[manifold.bodyB];
+    if (bodyA.isStatic() || bodyB.isStatic()) {
+      continue;
+    }
+    if (bodyA._sleeping != bodyB._sleeping) {
+      auto& sleepingBody = bodyA._sleeping ? bodyA : bodyB;
+      auto& solverBody   = _solverBodies[sleepingBody._index];
+      sleepingBody.awake();
+      solverBody.isFixed = false;
+      _setSolverBodyMass(sleepingBody, solverBody);
+    }
+    const auto rootA = find(manifold.bodyA), rootB = find(manifold.bodyB);
+    if (rootA != rootB) {
+      _islandParents[std::max(rootA, rootB)] = std::min(rootA, rootB);
+    }
+  }
+
+  // Islands of the awake bodies, as ranges of bodies and contacts
+  std::vector<uint32_t> islandOfRoot(nbBodies, std::numeric_limits<uint32_t>::max());
+  _islands.clear();
+  for (uint32_t i = 0; i < nbBodies; ++i) {
+    if (_solverBodies[i].isFixed) {
+      continue;
+    }
+    auto& island = islandOfRoot[find(i)];
+    if (island == std::numeric_limits<uint32_t>::max()) {
+      island = static_cast<uint32_t>(_islands.size());
+      _islands.emplace_back(Island{0, 0, 0, 0});
+    }
+    ++_islands[island].bodyCount;
+  }
+  const auto islandOfManifold = [&](const ContactManifold& manifold) {
+    const auto body = _solverBodies[manifold.bodyA].isFixed ? manifold.bodyB : manifold.bodyA;
+    return islandOfRoot[find(body)];
+  };
+  for (const auto& manifold : _manifolds) {
+    ++_islands[islandOfManifold(manifold)].manifoldCount;
+  }
+  uint32_t firstBody = 0, firstManifold = 0;
+  for (auto& island : _islands) {
+    island.firstBody     = firstBody;
+    island.firstManifold = firstManifold;
+    firstBody += island.bodyCount;
+    firstManifold += island.manifoldCount;
+    island.bodyCount     = 0;
+    island.manifoldCount = 0;
+  }
+  _islandBodies.resize(firstBody);
+  _islandManifolds.resize(firstManifold);
+  for (uint32_t i = 0; i < nbBodies; ++i) {
+    if (!_solverBodies[i].isFixed) {
+      auto& island = _islands[islandOfRoot[find(i)]];
+      _islandBodies[island.firstBody + island.bodyCount++] = i;
+    }
+  }
+  for (uint32_t i = 0; i < _manifolds.size(); ++i) {
+    auto& island = _islands[islandOfManifold(_manifolds[i])];
+    _islandManifolds[island.firstManifold + island.manifoldCount++] = i;
+  }
+
+  std::sort(_islands.begin(), _islands.end(), [](const Island& a, const Island& b) {
+    return a.bodyCount + a.manifoldCount > b.bodyCount + b.manifoldCount;
+  });
+}
+
+void NativePhysicsWorld::_solveIsland(const Island& island, float delta)
+{
+  struct ContactConstraint {
+    ContactPoint* point;
+    SolverBody* bodyA;
+    SolverBody* bodyB;
+    Vec3 rA, rB;
+    Vec3 normal, tangent0, tangent1;
+    float normalMass, tangentMass0, tangentMass1;
+    float velocityBias;
+    float friction;
+  };
+
+  const auto bodies    = _islandBodies.data() + island.firstBody;
+  const auto manifolds = _islandManifolds.data() + island.firstManifold;
+  const auto dampingOf = [delta](float damping) { return 1.f / (1.f + delta * damping); };
+
+  // Velocities
+  const auto gravityVector = Load(gravity);
+  for (uint32_t i = 0; i < island.bodyCount; ++i) {
+    auto& body       = *_bodies[bodies[i]];
+    auto& solverBody = _solverBodies[bodies[i]];
+    solverBody.linearVelocity
+      += (gravityVector + Load(body._force) * solverBody.inverseMass) * delta;
+    solverBody.angularVelocity += (solverBody.inverseInertia * Load(body._torque)) * delta;
+    solverBody.linearVelocity  = solverBody.linearVelocity * dampingOf(body.linearDamping);
+    solverBody.angularVelocity = solverBody.angularVelocity * dampingOf(body.angularDamping);
+    body._force.setAll(0.f);
+    body._torque.setAll(0.f);
+  }
+
+  // Contact constraints, using the velocities before the warm start
+  thread_local std::vector<ContactConstraint> constraints;
+  constraints.clear();
+  const auto inverseDelta = 1.f / delta;
+  for (uint32_t i = 0; i < island.manifoldCount; ++i) {
+    auto& manifold = _manifolds[manifolds[i]];
+    auto& bodyA    = _solverBodies[manifold.bodyA];
+    auto& bodyB    = _solverBodies[manifold.bodyB];
+    for (uint32_t j = 0; j < manifold.pointCount; ++j) {
+      auto& point = manifold.points[j];
+      ContactConstraint constraint;
+      constraint.point    = &point;
+      constraint.bodyA    = &bodyA;
+      constraint.bodyB    = &bodyB;
+      constraint.rA       = point.position - bodyA.position;
+      constraint.rB       = point.position - bodyB.position;
+      constraint.normal   = point.normal;
+      constraint.friction = manifold.friction;
+
+      const auto& n       = constraint.normal;
+      constraint.tangent0 = std::abs(n.x) < 0.57f ? NormalizeOr(Cross(n, Vec3{1.f, 0.f, 0.f}), n) :
+                                                    NormalizeOr(Cross(n, Vec3{0.f, 1.f, 0.f}), n);
+      constraint.tangent1 = Cross(n, constraint.tangent0);
+
+      const auto effectiveMass = [&](const Vec3& direction) {
+        const auto rnA = Cross(constraint.rA, direction), rnB = Cross(constraint.rB, direction);
+        const auto k   = bodyA.inverseMass + bodyB.inverseMass
+                       + Dot(rnA, bodyA.inverseInertia * rnA)
+                       + Dot(rnB, bodyB.inverseInertia * rnB);
+        return k > 0.f ? 1.f / k : 0.f;
+      };
+      constraint.normalMass   = effectiveMass(n);
+      constraint.tangentMass0 = effectiveMass(constraint.tangent0);
+      constraint.tangentMass1 = effectiveMass(constraint.tangent1);
+
+      // Speculative contacts let the bodies close the gap, penetrations are slowly recovered and
+      // fast approaching bodies bounce
+      const auto relativeVelocity
+        = bodyB.linearVelocity + Cross(bodyB.angularVelocity, constraint.rB)
+          - bodyA.linearVelocity - Cross(bodyA.angularVelocity, constraint.rA);
+      const auto normalVelocity = Dot(relativeVelocity, n);
+      if (point.separation > 0.f) {
+        constraint.velocityBias = -point.separation * inverseDelta;
+      }
+      else {
+        constraint.velocityBias = PenetrationRecovery
+                                  * std::max(-point.separation - LinearSlop, 0.f) * inverseDelta;
+      }
+      if (normalVelocity < -RestitutionThreshold) {
+        constraint.velocityBias
+          = std::max(constraint.velocityBias, -manifold.restitution * normalVelocity);
+      }
+
+      constraints.emplace_back(constraint);
+    }
+  }
+
+  // The fixed bodies can be shared by several islands solved concurrently, they are only read
+  const auto applyImpulse = [](ContactConstraint& constraint, const Vec3& impulse) {
+    auto& bodyA = *constraint.bodyA;
+    auto& bodyB = *constraint.bodyB;
+    if (!bodyA.isFixed && bodyA.inverseMass != 0.f) {
+      bodyA.linearVelocity -= impulse * bodyA.inverseMass;
+      bodyA.angularVelocity -= bodyA.inverseInertia * Cross(constraint.rA, impulse);
+    }
+    if (!bodyB.isFixed && bodyB.inverseMass != 0.f) {
+      bodyB.linearVelocity += impulse * bodyB.inverseMass;
+      bodyB.angularVelocity += bodyB.inverseInertia * Cross(constraint.rB, impulse);
+    }
+  };
+
+  // Warm start
+  for (auto& constraint : constraints) {
+    const auto& point = *constraint.point;
+    applyImpulse(constraint, constraint.normal * point.normalImpulse
+                               + constraint.tangent0 * point.tangentImpulse0
+                               + constraint.tangent1 * point.tangentImpulse1);
+  }
+
+  // Sequential impulses
+  for (size_t iteration = 0; iteration < velocityIterations; ++iteration) {
+    for (auto& constraint : constraints) {
+      auto& point       = *constraint.point;
+      const auto& bodyA = *constraint.bodyA;
+      const auto& bodyB = *constraint.bodyB;
+      const auto relativeVelocity = [&]() {
+        return bodyB.linearVelocity + Cross(bodyB.angularVelocity, constraint.rB)
+               - bodyA.linearVelocity - Cross(bodyA.angularVelocity, constraint.rA);
+      };
+
+      // Friction, bounded by the normal impulse
+      const auto maxFriction = constraint.friction * point.normalImpulse;
+      {
+        const auto velocity = relativeVelocity();
+        const auto impulse0 = -constraint.tangentMass0 * Dot(velocity, constraint.tangent0);
+        const auto impulse1 = -constraint.tangentMass1 * Dot(velocity, constraint.tangent1);
+        const auto previous0 = point.tangentImpulse0, previous1 = point.tangentImpulse1;
+        point.tangentImpulse0 = std::clamp(previous0 + impulse0, -maxFriction, maxFriction);
+        point.tangentImpulse1 = std::clamp(previous1 + impulse1, -maxFriction, maxFriction);
+        applyImpulse(constraint, constraint.tangent0 * (point.tangentImpulse0 - previous0)
+                                   + constraint.tangent1 * (point.tangentImpulse1 - previous1));
+      }
+
+      // Non penetration
+      {
+        const auto velocity = Dot(relativeVelocity(), constraint.normal);
+        const auto impulse  = constraint.normalMass * (constraint.velocityBias - velocity);
+        const auto previous = point.normalImpulse;
+        point.normalImpulse = std::max(previous + impulse, 0.f);
+        applyImpulse(constraint, constraint.normal * (point.normalImpulse - previous));
+      }
+    }
+  }
+
+  // Positions and sleeping
+  auto minSleepTime = std::numeric_limits<float>::max();
+  for (uint32_t i = 0; i < island.bodyCount; ++i) {
+    auto& body       = *_bodies[bodies[i]];
+    auto& solverBody = _solverBodies[bodies[i]];
+    solverBody.position += solverBody.linearVelocity * delta;
+    const auto& w = solverBody.angularVelocity;
+    auto& q       = solverBody.orientation;
+    const auto h  = 0.5f * delta;
+    q             = Normalize(Quat{q.x + h * (w.x * q.w + w.y * q.z - w.z * q.y),
+                       q.y + h * (w.y * q.w + w.z * q.x - w.x * q.z),
+                       q.z + h * (w.z * q.w + w.x * q.y - w.y * q.x),
+                       q.w - h * (w.x * q.x + w.y * q.y + w.z * q.z)});
+
+    body._position.set(solverBody.position.x, solverBody.position.y, solverBody.position.z);
+    body._orientation.copyFromFloats(q.x, q.y, q.z, q.w);
+    body._linearVelocity.set(solverBody.linearVelocity.x, solverBody.linearVelocity.y,
+                             solverBody.linearVelocity.z);
+    body._angularVelocity.set(w.x, w.y, w.z);
+
+    const auto resting
+      = LengthSquared(solverBody.linearVelocity) <= SleepLinearVelocity * SleepLinearVelocity
+        && LengthSquared(w) <= SleepAngularVelocity * SleepAngularVelocity;
+    body._sleepTime = resting ? body._sleepTime + delta : 0.f;
+    minSleepTime    = std::min(minSleepTime, body._sleepTime);
+  }
+  if (sleepingEnabled && minSleepTime >= TimeToSleep) {
+    for (uint32_t i = 0; i < island.bodyCount; ++i) {
+      _bodies[bodies[i]]->sleep();
+    }
+  }
+}
+
+std::optional<NativePhysicsRaycastHit> NativePhysicsWorld::raycast(const Vector3& from,
+                                                                   const Vector3& to) const
+{
+  const auto origin = Load(from);
+  auto maxDistance  = Length(Load(to) - origin);
+  if (maxDistance <= 0.f) {
+    return std::nullopt;
+  }
+  const auto direction = (Load(to) - origin) * (1.f / maxDistance);
+
+  std::optional<NativePhysicsRaycastHit> closestHit = std::nullopt;
+  for (const auto& body : _bodies) {
+    const auto& shape = *body->_shape;
+    const Pose pose{Load(body->_position), RotationMatrix(Normalize(Load(body->_orientation)))};
+
+    // Slab test of the bounds
+    const auto bounds = ComputeBounds(shape, pose, 0.f);
+    auto enter = 0.f, exit = maxDistance;
+    for (unsigned int axis = 0; axis < 3 && enter <= exit; ++axis) {
+      const auto start = Component(origin, axis), speed = Component(direction, axis);
+      if (std::abs(speed) <= 1e-12f) {
+        if (start < bounds.minimum[axis] || start > bounds.maximum[axis]) {
+          enter = exit + 1.f;
+        }
+        continue;
+      }
+      auto t0 = (bounds.minimum[axis] - start) / speed, t1 = (bounds.maximum[axis] - start) / speed;
+      if (t0 > t1) {
+        std::swap(t0, t1);
+      }
+      enter = std::max(enter, t0);
+      exit  = std::min(exit, t1);
+    }
+    if (enter > exit) {
+      continue;
+    }
+
+    const auto localOrigin    = pose.inverseTransform(origin);
+    const auto localDirection = MultiplyTransposed(pose.rotation, direction);
+    auto distance             = 0.f;
+    Vec3 localNormal{0.f, 0.f, 0.f};
+    auto hit = false;
+    switch (shape.type()) {
+      case NativePhysicsShape::Type::Sphere:
+        hit = RaycastSphere(localOrigin, localDirection, shape.radius(), maxDistance, distance,
+                            localNormal);
+        break;
+      case NativePhysicsShape::Type::Capsule:
+        hit = RaycastCapsule(localOrigin, localDirection, shape.radius(), shape.halfHeight(),
+                             maxDistance, distance, localNormal);
+        break;
+      case NativePhysicsShape::Type::Mesh: {
+        if (!shape.triangleBVH()) {
+          break;
+        }
+        Ray ray(ToVector3(localOrigin), ToVector3(localDirection), maxDistance);
+        const auto& positions = shape.meshPositions();
+        const auto& indices   = shape.triangleBVH()->indices();
+        const auto info
+          = shape.triangleBVH()->intersects(ray, positions, 0, indices.size(), false);
+        if (info && info->distance <= maxDistance) {
+          const auto index = static_cast<size_t>(info->faceId) * 3;
+          const auto p0    = Load(positions[indices[index]]);
+          localNormal      = NormalizeOr(Cross(Load(positions[indices[index + 1]]) - p0,
+                                          Load(positions[indices[index + 2]]) - p0),
+                                    -localDirection);
+          if (Dot(localNormal, localDirection) > 0.f) {
+            localNormal = -localNormal;
+          }
+          distance = info->distance;
+          hit      = true;
+        }
+      } break;
+      default:
+        hit = RaycastPolyhedron(shape, localOrigin, localDirection, maxDistance, distance,
+                                localNormal);
+        break;
+    }
+    if (hit && distance <= maxDistance) {
+      maxDistance = distance;
+      closestHit  = NativePhysicsRaycastHit{body.get(), ToVector3(origin + direction * distance),
+                                           ToVector3(pose.rotation * localNormal), distance};
+    }
+  }
+
+  return closestHit;
+}
+
+} // end of namespace BABYLON
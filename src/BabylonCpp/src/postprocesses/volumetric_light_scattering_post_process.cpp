@@ -135,6 +135,9 @@ bool VolumetricLightScatteringPostProcess::_isReady(SubMesh* subMesh, bool useIn
   if (useInstances) {
     defines.emplace_back("#define INSTANCES");
     MaterialHelper::PushAttributesForInstances(attribs);
+    if (subMesh->getRenderingMesh()->hasThinInstances()) {
+      defines.emplace_back("#define THIN_INSTANCES");
+    }
   }
 
   // Get correct effect
@@ -242,7 +245,8 @@ void VolumetricLightScatteringPostProcess::_createPass(Scene* scene, float ratio
 
     bool hardwareInstancedRendering
       = (engine_->getCaps().instancedArrays)
-        && (batch->visibleInstances.find(subMesh->_id) != batch->visibleInstances.end());
+        && ((batch->visibleInstances.find(subMesh->_id) != batch->visibleInstances.end())
+            || _mesh->hasThinInstances());
 
     if (_isReady(subMesh, hardwareInstancedRendering)) {
       auto effect = _volumetricLightScatteringPass;
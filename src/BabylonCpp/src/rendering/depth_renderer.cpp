@@ -96,7 +96,8 @@ DepthRenderer::DepthRenderer(Scene* scene, unsigned int type, const CameraPtr& c
 
     bool hardwareInstancedRendering
       = engine->getCaps().instancedArrays
-        && (batch->visibleInstances.find(subMesh->_id) != batch->visibleInstances.end());
+        && ((batch->visibleInstances.find(subMesh->_id) != batch->visibleInstances.end())
+            || mesh->hasThinInstances());
 
     auto camera = (!_camera) ? _camera : scene->activeCamera;
     if (isReady(subMesh, hardwareInstancedRendering) && camera) {
@@ -222,6 +223,9 @@ bool DepthRenderer::isReady(SubMesh* subMesh, bool useInstances)
   if (useInstances) {
     defines.emplace_back("#define INSTANCES");
     MaterialHelper::PushAttributesForInstances(attribs);
+    if (subMesh->getRenderingMesh()->hasThinInstances()) {
+      defines.emplace_back("#define THIN_INSTANCES");
+    }
   }
 
   // None linear depth
@@ -199,6 +199,9 @@ bool GeometryBufferRenderer::isReady(SubMesh* subMesh, bool useInstances)
   if (useInstances) {
     defines.emplace_back("#define INSTANCES");
     MaterialHelper::PushAttributesForInstances(attribs);
+    if (subMesh->getRenderingMesh()->hasThinInstances()) {
+      defines.emplace_back("#define THIN_INSTANCES");
+    }
   }
 
   // Setup textures count
@@ -360,9 +363,11 @@ void GeometryBufferRenderer::renderSubMesh(SubMesh* subMesh)
     return;
   }
 
-  auto hardwareInstancedRendering = (engine->getCaps().instancedArrays != 0)
-                                    && (stl_util::contains(batch->visibleInstances, subMesh->_id))
-                                    && (!batch->visibleInstances[subMesh->_id].empty());
+  auto hardwareInstancedRendering
+    = (engine->getCaps().instancedArrays != 0)
+      && ((stl_util::contains(batch->visibleInstances, subMesh->_id)
+           && !batch->visibleInstances[subMesh->_id].empty())
+          || mesh->hasThinInstances());
 
   if (isReady(subMesh, hardwareInstancedRendering)) {
     engine->enableEffect(_effect);
@@ -64,8 +64,9 @@ void OutlineRenderer::render(SubMesh* subMesh, const _InstancesBatchPtr& batch,
 
   bool hardwareInstancedRendering
     = engine->getCaps().instancedArrays
-      && (batch->visibleInstances.find(subMesh->_id) != batch->visibleInstances.end())
-      && (!batch->visibleInstances[subMesh->_id].empty());
+      && (((batch->visibleInstances.find(subMesh->_id) != batch->visibleInstances.end())
+           && (!batch->visibleInstances[subMesh->_id].empty()))
+          || subMesh->getRenderingMesh()->hasThinInstances());
 
   if (!isReady(subMesh, hardwareInstancedRendering)) {
     return;
@@ -184,6 +185,9 @@ bool OutlineRenderer::isReady(SubMesh* subMesh, bool useInstances)
   if (useInstances) {
     defines.emplace_back("#define INSTANCES");
     MaterialHelper::PushAttributesForInstances(attribs);
+    if (subMesh->getRenderingMesh()->hasThinInstances()) {
+      defines.emplace_back("#define THIN_INSTANCES");
+    }
   }
 
   // Get correct effect
@@ -0,0 +1,140 @@
+#include <babylon/rendering/render_queue.h>
+
+#include <algorithm>
+#include <array>
+
+namespace BABYLON {
+
+namespace {
+
+// Quantizes a depth normalized between 0 and 1 on the given number of bits
+uint64_t QuantizeDepth(float depth, unsigned int bits)
+{
+  const auto maxValue = static_cast<float>((1u << bits) - 1u);
+  const auto value    = std::min(std::max(depth, 0.f), 1.f) * maxValue;
+  return static_cast<uint64_t>(value + 0.5f);
+}
+
+} // end of anonymous namespace
+
+RenderQueue::RenderQueue() = default;
+
+RenderQueue::~RenderQueue() = default;
+
+uint64_t RenderQueue::OpaqueSortKey(uint8_t layer, size_t effectId, size_t materialId,
+                                    size_t geometryId, float depth)
+{
+  return (static_cast<uint64_t>(layer) << 56)
+         | ((static_cast<uint64_t>(effectId) & 0xFFFFu) << 40)
+         | ((static_cast<uint64_t>(materialId) & 0xFFFFu) << 24)
+         | ((static_cast<uint64_t>(geometryId) & 0xFFFu) << 12) | QuantizeDepth(depth, 12);
+}
+
+uint64_t RenderQueue::TransparentSortKey(uint8_t layer, float depth, size_t effectId,
+                                         size_t materialId)
+{
+  // Back to front: the farthest submesh gets the smallest depth field
+  return (static_cast<uint64_t>(layer) << 56) | ((0xFFFFFFu - QuantizeDepth(depth, 24)) << 32)
+         | ((static_cast<uint64_t>(effectId) & 0xFFFFu) << 16)
+         | (static_cast<uint64_t>(materialId) & 0xFFFFu);
+}
+
+size_t RenderQueue::CountStateChanges(const uint64_t* keys, size_t count)
+{
+  size_t stateChanges = 0;
+  for (size_t i = 1; i < count; ++i) {
+    const auto changes = keys[i - 1] ^ keys[i];
+    stateChanges += ((changes & EffectMask) != 0) + ((changes & MaterialMask) != 0)
+                    + ((changes & GeometryMask) != 0);
+  }
+  return stateChanges;
+}
+
+void RenderQueue::clear()
+{
+  _entries.clear();
+  _keys.clear();
+  _subMeshes.clear();
+}
+
+void RenderQueue::add(uint64_t key, SubMesh* subMesh)
+{
+  _entries.emplace_back(Entry{key, subMesh});
+  _keys.emplace_back(key);
+  _subMeshes.emplace_back(subMesh);
+}
+
+void RenderQueue::sort()
+{
+  const auto count = _entries.size();
+  if (count < 2) {
+    return;
+  }
+
+  if (count <= 64) {
+    // Insertion sort is faster than the 8 histograms on a few entries
+    for (size_t i = 1; i < count; ++i) {
+      const auto entry = _entries[i];
+      auto j           = i;
+      for (; j > 0 && _entries[j - 1].key > entry.key; --j) {
+        _entries[j] = _entries[j - 1];
+      }
+      _entries[j] = entry;
+    }
+  }
+  else {
+    // Least significant digit radix sort, one byte per pass
+    std::array<std::array<size_t, 256>, 8> histograms{};
+    for (const auto& entry : _entries) {
+      for (unsigned int pass = 0; pass < 8; ++pass) {
+        ++histograms[pass][(entry.key >> (pass * 8)) & 0xFFu];
+      }
+    }
+
+    _sortBuffer.resize(count);
+    auto* source      = &_entries;
+    auto* destination = &_sortBuffer;
+    for (unsigned int pass = 0; pass < 8; ++pass) {
+      auto& histogram = histograms[pass];
+      // All the keys share this byte (the layer for instance)
+      if (histogram[((*source)[0].key >> (pass * 8)) & 0xFFu] == count) {
+        continue;
+      }
+      size_t offset = 0;
+      for (auto& bucket : histogram) {
+        const auto bucketCount = bucket;
+        bucket                 = offset;
+        offset += bucketCount;
+      }
+      for (const auto& entry : *source) {
+        (*destination)[histogram[(entry.key >> (pass * 8)) & 0xFFu]++] = entry;
+      }
+      std::swap(source, destination);
+    }
+    if (source != &_entries) {
+      _entries.swap(_sortBuffer);
+    }
+  }
+
+  for (size_t i = 0; i < count; ++i) {
+    _keys[i]      = _entries[i].key;
+    _subMeshes[i] = _entries[i].subMesh;
+  }
+}
+
+size_t RenderQueue::size() const
+{
+  return _entries.size();
+}
+
+const std::vector<uint64_t>& RenderQueue::keys() const
+{
+  return _keys;
+}
+
+const std::vector<SubMesh*>& RenderQueue::subMeshes() const
+{
+  return _subMeshes;
+}
+
+} // end of namespace BABYLON
@@ -1,5 +1,7 @@
 #include <babylon/rendering/rendering_group.h>
 
+#include <algorithm>
+
 #include <babylon/babylon_stl_util.h>
 #include <babylon/cameras/camera.h>
 #include <babylon/culling/bounding_info.h>
@@ -8,7 +10,10 @@
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
 #include <babylon/materials/material.h>
+#include <babylon/materials/effect.h>
 #include <babylon/meshes/abstract_mesh.h>
+#include <babylon/meshes/geometry.h>
+#include <babylon/meshes/mesh.h>
 #include <babylon/meshes/sub_mesh.h>
 #include <babylon/particles/particle_system.h>
 #include <babylon/rendering/edges_renderer.h>
@@ -39,6 +44,7 @@ RenderingGroup::RenderingGroup(
     , _renderOpaque{nullptr}
     , _renderAlphaTest{nullptr}
     , _renderTransparent{nullptr}
+    , _defaultTransparentSort{true}
 {
   _opaqueSubMeshes.reserve(256);
   _transparentSubMeshes.reserve(256);
@@ -91,6 +97,7 @@ void RenderingGroup::set_alphaTestSortCompareFn(
 void RenderingGroup::set_transparentSortCompareFn(
   const std::function<bool(const SubMesh* a, const SubMesh* b)>& value)
 {
+  _defaultTransparentSort = !value;
   if (value) {
     _transparentSortCompareFn = value;
   }
@@ -122,21 +129,42 @@ void RenderingGroup::render(
 
   auto engine = _scene->getEngine();
 
+  // Sort keys replace the default orders (custom sort functions are kept)
+  const auto useQueue         = _scene->sortKeyRenderQueueEnabled;
+  const auto queueOpaque      = useQueue && !_opaqueSortCompareFn;
+  const auto queueAlphaTest   = useQueue && !_alphaTestSortCompareFn;
+  const auto queueTransparent = useQueue && _defaultTransparentSort;
+
   // Depth only
   if (!_depthOnlySubMeshes.empty()) {
     engine->setColorWrite(false);
-    _renderAlphaTest(_depthOnlySubMeshes);
+    if (queueAlphaTest) {
+      _renderQueued(_depthOnlySubMeshes, _alphaTestQueue, false);
+    }
+    else {
+      _renderAlphaTest(_depthOnlySubMeshes);
+    }
     engine->setColorWrite(true);
   }
 
   // Opaque
   if (!_opaqueSubMeshes.empty()) {
-    _renderOpaque(_opaqueSubMeshes);
+    if (queueOpaque) {
+      _renderQueued(_opaqueSubMeshes, _opaqueQueue, false);
+    }
+    else {
+      _renderOpaque(_opaqueSubMeshes);
+    }
   }
 
   // Alpha test
   if (!_alphaTestSubMeshes.empty()) {
-    _renderAlphaTest(_alphaTestSubMeshes);
+    if (queueAlphaTest) {
+      _renderQueued(_alphaTestSubMeshes, _alphaTestQueue, false);
+    }
+    else {
+      _renderAlphaTest(_alphaTestSubMeshes);
+    }
   }
 
   auto stencilState = engine->getStencilBuffer();
@@ -158,7 +186,12 @@ void RenderingGroup::render(
 
   // Transparent
   if (!_transparentSubMeshes.empty()) {
-    _renderTransparent(_transparentSubMeshes);
+    if (queueTransparent) {
+      _renderQueued(_transparentSubMeshes, _transparentQueue, true);
+    }
+    else {
+      _renderTransparent(_transparentSubMeshes);
+    }
     engine->setAlphaMode(Constants::ALPHA_DISABLE);
   }
 
@@ -219,20 +252,77 @@ void RenderingGroup::renderSorted(
   }
 
   for (auto& subMesh : sortedArray) {
+    _renderSubMesh(subMesh, transparent);
+  }
+}
+
+void RenderingGroup::_renderQueued(const std::vector<SubMesh*>& subMeshes, RenderQueue& queue,
+                                   bool transparent)
+{
+  const auto& camera         = _scene->activeCamera();
+  const auto& cameraPosition = camera ? camera->globalPosition() : RenderingGroup::_zeroVector;
+  // Depths are normalized by the far plane
+  const auto maxZ = (camera && camera->maxZ > 0.f) ? camera->maxZ : 1.f;
+
+  queue.clear();
+  for (auto& subMesh : subMeshes) {
+    const auto& mesh           = subMesh->getMesh();
+    subMesh->_alphaIndex       = mesh->alphaIndex;
+    subMesh->_distanceToCamera = Vector3::Distance(
+      subMesh->getBoundingInfo()->boundingSphere.centerWorld, cameraPosition);
+
+    const auto layer      = static_cast<uint8_t>(std::clamp(subMesh->_alphaIndex, 0, 255));
+    const auto& effect    = subMesh->effect();
+    const auto material   = subMesh->getMaterial();
+    const auto effectId   = effect ? effect->uniqueId : 0;
+    const auto materialId = material ? material->uniqueId : 0;
+    const auto depth      = subMesh->_distanceToCamera / maxZ;
     if (transparent) {
-      auto material = subMesh->getMaterial();
-
-      if (material && material->needDepthPrePass()) {
-        auto engine = material->getScene()->getEngine();
-        engine->setColorWrite(false);
-        engine->setAlphaMode(Constants::ALPHA_DISABLE);
-        subMesh->render(false);
-        engine->setColorWrite(true);
-      }
+      queue.add(RenderQueue::TransparentSortKey(layer, depth, effectId, materialId), subMesh);
+    }
+    else {
+      const auto& renderingMesh = subMesh->getRenderingMesh();
+      const auto geometry       = renderingMesh ? renderingMesh->geometry() : nullptr;
+      const auto geometryId     = geometry ? geometry->uniqueId : 0;
+      queue.add(RenderQueue::OpaqueSortKey(layer, effectId, materialId, geometryId, depth),
+                subMesh);
+    }
+  }
+
+  if (transparent) {
+    queue.sort();
+  }
+  else {
+    // Effect, material and geometry changes saved by the sort
+    const auto& keys        = queue.keys();
+    const auto stateChanges = RenderQueue::CountStateChanges(keys.data(), keys.size());
+    queue.sort();
+    const auto sortedStateChanges = RenderQueue::CountStateChanges(keys.data(), keys.size());
+    if (stateChanges > sortedStateChanges) {
+      _scene->_avoidedStateChanges.addCount(stateChanges - sortedStateChanges, false);
     }
+  }
+
+  for (auto& subMesh : queue.subMeshes()) {
+    _renderSubMesh(subMesh, transparent);
+  }
+}
 
-    subMesh->render(transparent);
+void RenderingGroup::_renderSubMesh(SubMesh* subMesh, bool transparent)
+{
+  if (transparent) {
+    auto material = subMesh->getMaterial();
+
+    if (material && material->needDepthPrePass()) {
+      auto engine = material->getScene()->getEngine();
+      engine->setColorWrite(false);
+      engine->setAlphaMode(Constants::ALPHA_DISABLE);
+      subMesh->render(false);
+      engine->setColorWrite(true);
+    }
   }
+
+  subMesh->render(transparent);
 }
 
 void RenderingGroup::renderUnsorted(const std::vector<SubMesh*>& subMeshes)
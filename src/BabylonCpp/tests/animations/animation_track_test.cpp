@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include <babylon/animations/_ianimation_state.h>
+#include <babylon/animations/animation.h>
+#include <babylon/animations/animation_track.h>
+#include <babylon/animations/ianimation_key.h>
+#include <babylon/babylon_enums.h>
+
+namespace {
+
+BABYLON::AnimationPtr CreateAnimation(unsigned int dataType,
+                                      const std::vector<BABYLON::IAnimationKey>& keys)
+{
+  using namespace BABYLON;
+
+  auto animation = Animation::CreateAnimation("property", static_cast<int>(dataType), 30);
+  animation->setKeys(keys);
+  return animation;
+}
+
+} // end of anonymous namespace
+
+TEST(TestAnimationTrack, SampleMatchesInterpolate)
+{
+  using namespace BABYLON;
+
+  IAnimationKey tangentKey(10.f, AnimationValue(Vector3(1.f, 2.f, 3.f)));
+  tangentKey.inTangent  = AnimationValue(Vector3(0.1f, 0.f, -0.1f));
+  tangentKey.outTangent = AnimationValue(Vector3(0.2f, 0.1f, 0.f));
+  IAnimationKey endKey(25.f, AnimationValue(Vector3(-1.f, 0.f, 2.f)));
+  endKey.inTangent = AnimationValue(Vector3(0.f, 0.3f, 0.1f));
+  auto vectorAnimation
+    = CreateAnimation(Animation::ANIMATIONTYPE_VECTOR3,
+                      {IAnimationKey(0.f, AnimationValue(Vector3::Zero())), tangentKey, endKey});
+  auto quaternionAnimation = CreateAnimation(
+    Animation::ANIMATIONTYPE_QUATERNION,
+    {IAnimationKey(0.f, AnimationValue(Quaternion::RotationYawPitchRoll(0.f, 0.f, 0.f))),
+     IAnimationKey(12.f, AnimationValue(Quaternion::RotationYawPitchRoll(2.f, 0.5f, 0.f))),
+     IAnimationKey(20.f, AnimationValue(Quaternion::RotationYawPitchRoll(-1.f, 0.f, 1.f)))});
+
+  for (const auto& animation : {vectorAnimation, quaternionAnimation}) {
+    const auto& track = animation->_getTrack();
+    ASSERT_TRUE(track != nullptr);
+    _IAnimationState state{};
+    state.key         = 0;
+    state.repeatCount = 0;
+    state.loopMode    = Animation::ANIMATIONLOOPMODE_CYCLE;
+    int cursor        = 0;
+    std::array<float, AnimationTrack::MaxComponentCount> value{};
+    // Forward then backward
+    for (float frame : {0.f, 3.5f, 10.f, 11.f, 17.25f, 24.9f, 25.f, 19.f, 2.f}) {
+      const auto expected = animation->_interpolate(frame, state);
+      track->sample(frame, cursor, nullptr, value.data());
+      if (animation == vectorAnimation) {
+        const auto& vector = expected.get<Vector3>();
+        EXPECT_NEAR(value[0], vector.x, 1e-5f);
+        EXPECT_NEAR(value[1], vector.y, 1e-5f);
+        EXPECT_NEAR(value[2], vector.z, 1e-5f);
+      }
+      else {
+        const auto& quaternion = expected.get<Quaternion>();
+        EXPECT_NEAR(value[0], quaternion.x, 1e-5f);
+        EXPECT_NEAR(value[1], quaternion.y, 1e-5f);
+        EXPECT_NEAR(value[2], quaternion.z, 1e-5f);
+        EXPECT_NEAR(value[3], quaternion.w, 1e-5f);
+      }
+    }
+  }
+}
+
+TEST(TestAnimationTrack, StepKeysAndBaking)
+{
+  using namespace BABYLON;
+
+  IAnimationKey stepKey(0.f, AnimationValue(1.f));
+  stepKey.interpolation = AnimationValue(static_cast<int>(AnimationKeyInterpolation::STEP));
+  auto animation        = CreateAnimation(
+    Animation::ANIMATIONTYPE_FLOAT,
+    {stepKey, IAnimationKey(10.f, AnimationValue(3.f)), IAnimationKey(20.f, AnimationValue(5.f))});
+
+  int cursor  = 0;
+  float value = 0.f;
+  animation->_getTrack()->sample(9.f, cursor, nullptr, &value);
+  EXPECT_FLOAT_EQ(value, 1.f);
+  animation->_getTrack()->sample(15.f, cursor, nullptr, &value);
+  EXPECT_FLOAT_EQ(value, 4.f);
+
+  // The linear parts of the curve are kept by the samples
+  animation->bake(2.f);
+  const auto& track = animation->_getTrack();
+  EXPECT_TRUE(track->isBaked());
+  for (float frame : {12.f, 15.25f, 19.9f}) {
+    track->sample(frame, cursor, nullptr, &value);
+    EXPECT_NEAR(value, 3.f + (frame - 10.f) * 0.2f, 1e-5f);
+  }
+  // Clamped to the keys
+  track->sample(30.f, cursor, nullptr, &value);
+  EXPECT_FLOAT_EQ(value, 5.f);
+
+  // Modifying the keys rebuilds the track
+  animation->getKeys().back().value = AnimationValue(7.f);
+  animation->_getTrack()->sample(20.f, cursor, nullptr, &value);
+  EXPECT_FLOAT_EQ(value, 7.f);
+}
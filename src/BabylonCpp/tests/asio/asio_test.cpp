@@ -95,6 +95,52 @@ TEST(async_requests, SampleApplicationLoop)
 #endif // _WIN32
 }
 
+TEST(async_requests, CancelRequest)
+{
+#ifndef _WIN32
+  int nb_success = 0;
+  int nb_error = 0;
+  auto onSuccessBinary = [&nb_success](const BABYLON::ArrayBuffer& /*data*/) { ++nb_success; };
+  auto onError = [&nb_error](const std::string& /*message*/) { ++nb_error; };
+
+  BABYLON::asio::Service_SetNbWorkerThreads(1);
+  auto cancelledId = BABYLON::asio::LoadAssetAsync_Binary_Prioritized(
+    textUrl, BABYLON::asio::RequestPriority::Low, onSuccessBinary, onError);
+  BABYLON::asio::LoadAssetAsync_Binary_Prioritized(
+    textUrl, BABYLON::asio::RequestPriority::High, onSuccessBinary, onError);
+  EXPECT_TRUE(BABYLON::asio::CancelRequest(cancelledId));
+
+  BABYLON::asio::Service_WaitAll_Sync();
+  EXPECT_FALSE(BABYLON::asio::CancelRequest(cancelledId));
+  EXPECT_EQ(nb_success, 1);
+  EXPECT_EQ(nb_error, 0);
+  BABYLON::asio::Service_Stop();
+#endif // _WIN32
+}
+
+TEST(async_requests, StopWithPendingRequests)
+{
+#ifndef _WIN32
+  const int nb_requests = 32;
+  int nb_success = 0;
+  int nb_error = 0;
+  auto onSuccessBinary = [&nb_success](const BABYLON::ArrayBuffer& /*data*/) { ++nb_success; };
+  auto onError = [&nb_error](const std::string& /*message*/) { ++nb_error; };
+
+  // A single worker cannot empty the queue before the service is stopped
+  BABYLON::asio::Service_SetNbWorkerThreads(1);
+  for (int i = 0; i < nb_requests; ++i)
+    BABYLON::asio::LoadAssetAsync_Binary_Prioritized(
+      textUrl, BABYLON::asio::RequestPriority::Normal, onSuccessBinary, onError);
+  BABYLON::asio::Service_Stop();
+
+  // The requests still queued were failed, so waiting does not block
+  BABYLON::asio::Service_WaitAll_Sync();
+  EXPECT_FALSE(BABYLON::asio::HasRemainingTasks());
+  EXPECT_EQ(nb_success + nb_error, nb_requests);
+#endif // _WIN32
+}
+
 TEST(async_requests, LoadText)
 {
 #if 0 // This code works, but features no real google test call
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "../test_utils.h"
+
+#include <babylon/bones/bone.h>
+#include <babylon/bones/skeleton.h>
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/mesh.h>
+
+namespace {
+
+BABYLON::SkeletonPtr CreateSkeleton(const std::string& name, BABYLON::Scene* scene)
+{
+  using namespace BABYLON;
+
+  // Two limbs of chained bones attached to a root bone
+  auto skeleton = Skeleton::New(name, name, scene);
+  auto root     = Bone::New("root", skeleton.get(), nullptr, Matrix::Translation(0.f, 1.f, 0.f));
+  std::vector<Bone*> limbs(2, root.get());
+  for (size_t index = 1; index < 16; ++index) {
+    auto& parent = limbs[index % limbs.size()];
+    auto bone    = Bone::New("bone" + std::to_string(index), skeleton.get(), parent,
+                          Matrix::RotationYawPitchRoll(0.1f * static_cast<float>(index), 0.05f, 0.f)
+                            .multiply(Matrix::Translation(0.f, 0.2f, 0.f)));
+    parent       = bone.get();
+  }
+  return skeleton;
+}
+
+} // end of anonymous namespace
+
+TEST(TestSkeletonEvaluation, SerialAndParallelMatricesMatch)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  auto camera = FreeCamera::New("camera", Vector3(0.f, 0.f, -20.f), scene.get());
+
+  // Characters with their own skeleton
+  std::vector<SkeletonPtr> skeletons;
+  std::vector<MeshPtr> meshes;
+  for (size_t index = 0; index < 8; ++index) {
+    const auto name = std::to_string(index);
+    skeletons.emplace_back(CreateSkeleton("skeleton" + name, scene.get()));
+    auto box      = Mesh::CreateBox("box" + name, 0.5f, scene.get());
+    box->position = Vector3(static_cast<float>(index) - 4.f, 0.f, 0.f);
+    box->skeleton = skeletons.back();
+    meshes.emplace_back(box);
+  }
+
+  // Parts of a character sharing a skeleton, the last part shares the pose of the first one and
+  // is computed after a part with another pose
+  auto sharedSkeleton                   = CreateSkeleton("shared", scene.get());
+  sharedSkeleton->needInitialSkinMatrix = true;
+  std::vector<MeshPtr> parts;
+  for (const auto& poseMatrix :
+       {Matrix::Identity(), Matrix::Translation(1.f, 0.f, 0.f), Matrix::Identity()}) {
+    auto part = Mesh::CreateBox("part" + std::to_string(parts.size()), 0.5f, scene.get());
+    part->updatePoseMatrix(poseMatrix);
+    part->skeleton = sharedSkeleton;
+    parts.emplace_back(part);
+  }
+  skeletons.emplace_back(sharedSkeleton);
+  meshes.insert(meshes.end(), parts.begin(), parts.end());
+
+  const auto transformMatrices = [&]() {
+    std::vector<Float32Array> matrices;
+    for (const auto& mesh : meshes) {
+      matrices.emplace_back(mesh->skeleton()->getTransformMatrices(mesh.get()));
+    }
+    return matrices;
+  };
+
+  scene->parallelSkeletonsEvaluation = false;
+  scene->render();
+  const auto serialMatrices = transformMatrices();
+
+  // The palette of a shared pose is the one of its first mesh
+  EXPECT_EQ(&sharedSkeleton->getTransformMatrices(parts[0].get()),
+            &sharedSkeleton->getTransformMatrices(parts[2].get()));
+  EXPECT_EQ(serialMatrices[8], serialMatrices[10]);
+  EXPECT_NE(serialMatrices[8], serialMatrices[9]);
+
+  // Recompute everything in parallel from cleared matrices
+  for (const auto& mesh : meshes) {
+    auto& matrices = mesh->skeleton()->getTransformMatrices(mesh.get());
+    std::fill(matrices.begin(), matrices.end(), 0.f);
+  }
+  for (const auto& skeleton : skeletons) {
+    skeleton->bones.front()->markAsDirty();
+  }
+  scene->parallelSkeletonsEvaluation = true;
+  scene->render();
+  const auto parallelMatrices = transformMatrices();
+
+  ASSERT_EQ(serialMatrices.size(), parallelMatrices.size());
+  for (size_t index = 0; index < serialMatrices.size(); ++index) {
+    EXPECT_EQ(serialMatrices[index], parallelMatrices[index]) << meshes[index]->name;
+  }
+}
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "../test_utils.h"
+
+#include <babylon/collisions/collider.h>
+#include <babylon/collisions/icollision_coordinator.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/mesh.h>
+
+TEST(TestCollisionCoordinator, BroadphaseAndBatchedMoves)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+
+  // A subdivided ground using a triangle BVH and a row of boxes on it
+  auto ground             = Mesh::CreateGround("ground", 20, 20, 16, scene.get());
+  ground->checkCollisions = true;
+  ground->computeWorldMatrix(true);
+  for (int i = -4; i <= 4; ++i) {
+    auto box             = Mesh::CreateBox("box" + std::to_string(i), 1.f, scene.get());
+    box->position        = Vector3(static_cast<float>(i) * 2.f, 0.5f, 0.f);
+    box->checkCollisions = true;
+    box->computeWorldMatrix(true);
+  }
+
+  // Colliders falling on the ground, some of them sliding against the boxes
+  auto& coordinator = scene->collisionCoordinator();
+  std::vector<ColliderMove> moves;
+  for (int i = 0; i < 24; ++i) {
+    ColliderMove move;
+    move.position          = Vector3(static_cast<float>(i) * 0.7f - 8.f, 3.f, -1.5f);
+    move.displacement      = Vector3(0.1f * static_cast<float>(i % 5), -5.f, 2.f);
+    move.collider          = coordinator->createCollider();
+    move.collider->_radius = Vector3(0.5f, 1.f, 0.5f);
+    moves.emplace_back(move);
+  }
+
+  const auto getNewPosition = [&](ColliderMove& move) {
+    auto position     = move.position;
+    auto displacement = move.displacement;
+    coordinator->getNewPosition(
+      position, displacement, move.collider, move.maximumRetry, nullptr,
+      [&move](size_t /*collisionIndex*/, Vector3& newPosition,
+              const AbstractMeshPtr& /*collidedMesh*/) { move.newPosition = newPosition; },
+      0);
+    return move.newPosition;
+  };
+
+  scene->collisionsBroadphaseEnabled = false;
+  std::vector<Vector3> expected;
+  for (auto& move : moves) {
+    expected.emplace_back(getNewPosition(move));
+    // The colliders stop on the ground or on the boxes
+    EXPECT_GT(expected.back().y, 0.99f);
+  }
+
+  // The broadphase finds the same collisions
+  scene->collisionsBroadphaseEnabled = true;
+  for (size_t i = 0; i < moves.size(); ++i) {
+    const auto newPosition = getNewPosition(moves[i]);
+    EXPECT_FLOAT_EQ(newPosition.x, expected[i].x);
+    EXPECT_FLOAT_EQ(newPosition.y, expected[i].y);
+    EXPECT_FLOAT_EQ(newPosition.z, expected[i].z);
+  }
+
+  // The batched moves are the same as the moves resolved one by one
+  for (auto& move : moves) {
+    move.newPosition = Vector3::Zero();
+  }
+  coordinator->getNewPositions(moves);
+  for (size_t i = 0; i < moves.size(); ++i) {
+    EXPECT_FLOAT_EQ(moves[i].newPosition.x, expected[i].x);
+    EXPECT_FLOAT_EQ(moves[i].newPosition.y, expected[i].y);
+    EXPECT_FLOAT_EQ(moves[i].newPosition.z, expected[i].z);
+  }
+}
@@ -0,0 +1,64 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <babylon/babylon_common.h>
+#include <babylon/core/array_buffer_view.h>
+#include <babylon/core/filesystem.h>
+#include <babylon/core/mapped_array_buffer.h>
+
+TEST(TestMappedArrayBuffer, FromFile)
+{
+  using namespace BABYLON;
+
+  const auto filename = assets_folder() + "fonts/fa-regular-400.ttf";
+  const auto mapped   = MappedArrayBuffer::FromFile(filename);
+  const auto expected = Filesystem::readBinaryFile(filename.c_str());
+
+  ASSERT_TRUE(static_cast<bool>(mapped));
+  EXPECT_EQ(mapped.byteLength(), expected.size());
+  EXPECT_EQ(mapped.toArrayBuffer(), expected);
+
+  EXPECT_FALSE(static_cast<bool>(MappedArrayBuffer::FromFile("non_existing_file")));
+}
+
+TEST(TestMappedArrayBuffer, slice)
+{
+  using namespace BABYLON;
+
+  MappedArrayBuffer buffer(ArrayBuffer{0, 1, 2, 3, 4, 5, 6, 7});
+  const auto slice = buffer.slice(2, 4);
+  EXPECT_EQ(slice.byteLength(), 4ull);
+  EXPECT_EQ(slice.data(), buffer.data() + 2);
+  EXPECT_EQ(slice.toArrayBuffer(), (ArrayBuffer{2, 3, 4, 5}));
+
+  // Slices of slices share the same storage
+  const auto subSlice = slice.slice(1, 2);
+  EXPECT_EQ(subSlice.data(), buffer.data() + 3);
+  EXPECT_THROW(slice.slice(2, 4), std::out_of_range);
+}
+
+TEST(TestMappedArrayBuffer, ArrayBufferView)
+{
+  using namespace BABYLON;
+
+  Float32Array floats{1.f, 2.f, 3.f, 4.f};
+  ArrayBuffer bytes(floats.size() * sizeof(float));
+  std::memcpy(bytes.data(), floats.data(), bytes.size());
+  MappedArrayBuffer buffer(std::move(bytes));
+
+  ArrayBufferView view(buffer);
+  EXPECT_TRUE(view.isMapped());
+  EXPECT_EQ(view.byteLength(), 16ull);
+  EXPECT_EQ(view.float32Array(), floats);
+
+  const auto subView = view.subView(4, 8);
+  EXPECT_TRUE(subView.isMapped());
+  EXPECT_EQ(subView.data(), buffer.data() + 4);
+  EXPECT_EQ(subView.float32Array(), (Float32Array{2.f, 3.f}));
+  EXPECT_EQ(view.typedArray<float>(8, 2), (Float32Array{3.f, 4.f}));
+
+  // Requesting a mutable Uint8Array detaches the view from the shared storage
+  view.uint8Array()[0] = 0;
+  EXPECT_FALSE(view.isMapped());
+  EXPECT_EQ(subView.float32Array(), (Float32Array{2.f, 3.f}));
+}
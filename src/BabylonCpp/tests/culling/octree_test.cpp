@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "../test_utils.h"
+
+#include <babylon/culling/octrees/octree.h>
+#include <babylon/culling/octrees/octree_block.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/mesh.h>
+
+TEST(TestOctree, SelectionAndUpdate)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+
+  // A row of boxes along the x axis, the center one overlaps all top blocks
+  std::vector<MeshPtr> boxes;
+  for (int i = -5; i <= 5; ++i) {
+    auto box      = Mesh::CreateBox("box" + std::to_string(i), 1.f, scene.get());
+    box->position = Vector3(static_cast<float>(i) * 2.f, 0.f, 0.f);
+    box->computeWorldMatrix(true);
+    boxes.emplace_back(box);
+  }
+  AbstractMesh* centerBox = boxes[5].get();
+  AbstractMesh* lastBox   = boxes.back().get();
+
+  auto octree = scene->createOrUpdateSelectionOctree(2, 3);
+
+  const auto count = [](const std::vector<AbstractMesh*>& selection, AbstractMesh* mesh) {
+    return std::count(selection.begin(), selection.end(), mesh);
+  };
+
+  // Duplicates are only removed on demand
+  EXPECT_GT(count(octree->intersects(Vector3::Zero(), 0.1f, true), centerBox), 1);
+  const auto& selection = octree->intersects(Vector3::Zero(), 0.1f, false);
+  EXPECT_EQ(count(selection, centerBox), 1);
+  for (const auto& mesh : selection) {
+    EXPECT_EQ(count(selection, mesh), 1);
+  }
+
+  // The moved box is reinserted without rebuilding the octree
+  EXPECT_EQ(count(octree->intersects(Vector3(10.f, 0.f, 0.f), 0.1f, false), lastBox), 1);
+  lastBox->position = Vector3(-9.f, 0.f, 0.f);
+  lastBox->computeWorldMatrix(true);
+  octree->updateMesh(lastBox);
+  EXPECT_EQ(count(octree->intersects(Vector3(10.f, 0.f, 0.f), 0.1f, false), lastBox), 0);
+  EXPECT_EQ(count(octree->intersects(Vector3(-9.f, 0.f, 0.f), 0.1f, false), lastBox), 1);
+
+  // A removed box is not referenced by any block
+  octree->removeMesh(lastBox);
+  for (const auto& block : octree->blocks) {
+    EXPECT_EQ(count(block.entries, lastBox), 0);
+  }
+  EXPECT_EQ(count(octree->intersects(Vector3::Zero(), 100.f, false), lastBox), 0);
+}
@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "../test_utils.h"
+
+#include <babylon/collisions/intersection_info.h>
+#include <babylon/collisions/picking_info.h>
+#include <babylon/culling/bvh/picking_bvh.h>
+#include <babylon/culling/bvh/triangle_bvh.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/mesh.h>
+
+TEST(TestPickingBVH, TriangleBVHMatchesAllTriangles)
+{
+  using namespace BABYLON;
+
+  // A grid of triangles in several overlapping layers
+  std::vector<Vector3> positions;
+  IndicesArray indices;
+  for (unsigned int layer = 0; layer < 4; ++layer) {
+    for (unsigned int x = 0; x < 16; ++x) {
+      for (unsigned int y = 0; y < 16; ++y) {
+        const auto start = static_cast<uint32_t>(positions.size());
+        const auto z     = static_cast<float>(layer) * 0.5f + static_cast<float>(x % 3) * 0.1f;
+        positions.emplace_back(Vector3(static_cast<float>(x), static_cast<float>(y), z));
+        positions.emplace_back(Vector3(static_cast<float>(x) + 1.5f, static_cast<float>(y), z));
+        positions.emplace_back(Vector3(static_cast<float>(x), static_cast<float>(y) + 1.5f, z));
+        indices.insert(indices.end(), {start, start + 1, start + 2});
+      }
+    }
+  }
+  const TriangleBVH triangleBVH(positions, indices);
+  EXPECT_EQ(triangleBVH.triangleCount(), indices.size() / 3);
+
+  // Closest triangle of a submesh, in the index order
+  const auto intersectsAll = [&](Ray& ray, size_t indexStart, size_t indexCount) {
+    std::optional<IntersectionInfo> intersectInfo = std::nullopt;
+    for (size_t index = indexStart; index < indexStart + indexCount; index += 3) {
+      auto currentIntersectInfo = ray.intersectsTriangle(
+        positions[indices[index]], positions[indices[index + 1]], positions[indices[index + 2]]);
+      if (currentIntersectInfo && currentIntersectInfo->distance >= 0.f
+          && (!intersectInfo || currentIntersectInfo->distance < intersectInfo->distance)) {
+        intersectInfo         = currentIntersectInfo;
+        intersectInfo->faceId = static_cast<unsigned int>(index / 3);
+      }
+    }
+    return intersectInfo;
+  };
+
+  const size_t subMeshStart = 3 * 100, subMeshCount = 3 * 500;
+  for (unsigned int i = 0; i < 100; ++i) {
+    Ray ray(Vector3(static_cast<float>(i % 10) * 1.7f + 0.3f, static_cast<float>(i / 10) * 1.7f,
+                    -10.f),
+            Vector3(0.01f * static_cast<float>(i % 7), 0.02f, 1.f));
+    for (const auto& [indexStart, indexCount] :
+         {std::make_pair(size_t(0), indices.size()), std::make_pair(subMeshStart, subMeshCount)}) {
+      const auto expected = intersectsAll(ray, indexStart, indexCount);
+      const auto result = triangleBVH.intersects(ray, positions, indexStart, indexCount, false);
+      ASSERT_EQ(result.has_value(), expected.has_value());
+      if (expected) {
+        EXPECT_EQ(result->faceId, expected->faceId);
+        EXPECT_FLOAT_EQ(result->distance, expected->distance);
+      }
+    }
+  }
+}
+
+TEST(TestPickingBVH, ScenePicking)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+
+  // A row of boxes along the x axis and a sphere using a triangle BVH
+  std::vector<MeshPtr> boxes;
+  for (int i = -5; i <= 5; ++i) {
+    auto box      = Mesh::CreateBox("box" + std::to_string(i), 1.f, scene.get());
+    box->position = Vector3(static_cast<float>(i) * 2.f, 0.f, 0.f);
+    box->computeWorldMatrix(true);
+    boxes.emplace_back(box);
+  }
+  auto sphere      = Mesh::CreateSphere("sphere", 16, 2.f, scene.get());
+  sphere->position = Vector3(0.f, 4.f, 0.f);
+  sphere->computeWorldMatrix(true);
+
+  std::vector<Ray> rays;
+  for (int i = -12; i <= 12; ++i) {
+    for (const auto y : {0.f, 0.25f, 3.5f, 4.f, 4.6f}) {
+      rays.emplace_back(Ray(Vector3(static_cast<float>(i) * 0.9f, y, -10.f), Vector3(0, 0, 1.f)));
+    }
+  }
+
+  // The picks with and without the BVH are the same
+  const auto pickAll = [&](bool pickingBVHEnabled) {
+    scene->pickingBVHEnabled = pickingBVHEnabled;
+    return scene->pickBatch(rays);
+  };
+  const auto expectSamePicks = [&]() {
+    const auto expected = pickAll(false);
+    const auto results  = pickAll(true);
+    ASSERT_EQ(results.size(), rays.size());
+    for (size_t i = 0; i < rays.size(); ++i) {
+      EXPECT_EQ(results[i]->hit, expected[i]->hit);
+      EXPECT_EQ(results[i]->pickedMesh, expected[i]->pickedMesh);
+      EXPECT_FLOAT_EQ(results[i]->distance, expected[i]->distance);
+      EXPECT_EQ(results[i]->faceId, expected[i]->faceId);
+    }
+  };
+  expectSamePicks();
+
+  const Ray ray(Vector3(10.f, 0.f, -10.f), Vector3(0, 0, 1.f));
+  EXPECT_EQ(scene->pickWithRay(ray)->pickedMesh, boxes.back());
+
+  // A moved box is refitted without rebuilding the hierarchy
+  const auto buildCount  = scene->_pickingBVH->buildCount();
+  boxes.back()->position = Vector3(-9.f, 0.f, 0.f);
+  boxes.back()->computeWorldMatrix(true);
+  EXPECT_FALSE(scene->pickWithRay(ray)->hit);
+  EXPECT_EQ(scene->_pickingBVH->buildCount(), buildCount);
+  expectSamePicks();
+
+  // An added box is picked before the next build, a removed one is never picked
+  auto addedBox      = Mesh::CreateBox("added", 1.f, scene.get());
+  addedBox->position = Vector3(10.f, 0.f, 0.f);
+  addedBox->computeWorldMatrix(true);
+  EXPECT_EQ(scene->pickWithRay(ray)->pickedMesh, addedBox);
+  EXPECT_EQ(scene->_pickingBVH->buildCount(), buildCount);
+
+  scene->removeMesh(addedBox);
+  EXPECT_FALSE(scene->pickWithRay(ray)->hit);
+  EXPECT_EQ(scene->_pickingBVH->buildCount(), buildCount + 1);
+  expectSamePicks();
+}
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../test_utils.h"
+
+#include <babylon/materials/effect.h>
+#include <babylon/materials/ieffect_creation_options.h>
+#include <babylon/meshes/vertex_buffer.h>
+
+namespace {
+
+BABYLON::EffectPtr CreateEffect(BABYLON::Engine* engine, const std::string& defines)
+{
+  using namespace BABYLON;
+
+  IEffectCreationOptions options;
+  options.attributes = {VertexBuffer::PositionKind, VertexBuffer::NormalKind};
+  options.defines    = defines;
+  return engine->createEffect(
+    std::unordered_map<std::string, std::string>{{"vertexSource", "void main(void) {}"},
+                                                 {"fragmentSource", "void main(void) {}"}},
+    options, engine);
+}
+
+BABYLON::VertexBufferPtr CreateVertexBuffer(BABYLON::Engine* engine, const std::string& kind)
+{
+  using namespace BABYLON;
+
+  return std::make_shared<VertexBuffer>(engine, Float32Array(4 * 3, 0.f), kind, false,
+                                        std::nullopt, 4);
+}
+
+} // end of anonymous namespace
+
+TEST(TestBindBuffers, SkipsUnchangedBindings)
+{
+  using namespace BABYLON;
+
+  auto engine      = createSubject();
+  auto nullEngine  = static_cast<NullEngine*>(engine.get());
+  auto effect      = CreateEffect(engine.get(), "#define EFFECT1");
+  auto otherEffect = CreateEffect(engine.get(), "#define EFFECT2");
+
+  std::unordered_map<std::string, VertexBufferPtr> vertexBuffers;
+  std::vector<VertexBufferPtr> vertexBuffersBySlot;
+  const auto setVertexBuffer = [&](const VertexBufferPtr& vertexBuffer) {
+    const auto slot = vertexBuffer->getKindSlot();
+    if (slot >= vertexBuffersBySlot.size()) {
+      vertexBuffersBySlot.resize(slot + 1);
+    }
+    vertexBuffersBySlot[slot]              = vertexBuffer;
+    vertexBuffers[vertexBuffer->getKind()] = vertexBuffer;
+  };
+  setVertexBuffer(CreateVertexBuffer(engine.get(), VertexBuffer::PositionKind));
+  setVertexBuffer(CreateVertexBuffer(engine.get(), VertexBuffer::NormalKind));
+
+  engine->bindBuffers(vertexBuffersBySlot, nullptr, effect);
+  EXPECT_EQ(nullEngine->_vertexBuffersBindingCount, 1u);
+
+  // Same effect and same buffers, from either overload
+  engine->bindBuffers(vertexBuffersBySlot, nullptr, effect);
+  engine->bindBuffers(vertexBuffers, nullptr, effect);
+  EXPECT_EQ(nullEngine->_vertexBuffersBindingCount, 1u);
+
+  // A buffer which is not an attribute of the effect is not bound
+  setVertexBuffer(CreateVertexBuffer(engine.get(), VertexBuffer::UVKind));
+  engine->bindBuffers(vertexBuffersBySlot, nullptr, effect);
+  EXPECT_EQ(nullEngine->_vertexBuffersBindingCount, 1u);
+
+  // The effect changed
+  engine->bindBuffers(vertexBuffersBySlot, nullptr, otherEffect);
+  EXPECT_EQ(nullEngine->_vertexBuffersBindingCount, 2u);
+  engine->bindBuffers(vertexBuffersBySlot, nullptr, otherEffect);
+  EXPECT_EQ(nullEngine->_vertexBuffersBindingCount, 2u);
+
+  // A vertex buffer changed
+  setVertexBuffer(CreateVertexBuffer(engine.get(), VertexBuffer::NormalKind));
+  engine->bindBuffers(vertexBuffersBySlot, nullptr, otherEffect);
+  EXPECT_EQ(nullEngine->_vertexBuffersBindingCount, 3u);
+  engine->bindBuffers(vertexBuffers, nullptr, otherEffect);
+  EXPECT_EQ(nullEngine->_vertexBuffersBindingCount, 3u);
+}
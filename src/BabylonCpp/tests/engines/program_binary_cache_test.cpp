@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include <babylon/core/filesystem.h>
+#include <babylon/engines/webgl/program_binary_cache.h>
+
+TEST(TestProgramBinaryCache, StoreLoadAndInvalidation)
+{
+  using namespace BABYLON;
+
+  const auto directory
+    = Filesystem::joinPath(Filesystem::getcwd(), std::string("program_binary_cache_test"));
+  ProgramBinaryCache cache(directory);
+  ASSERT_TRUE(Filesystem::isDirectory(cache.directory()));
+
+  // The key depends on the driver and on both sources
+  const auto key = ProgramBinaryCache::GetKey("vendor|renderer|1.0", "vertex", "fragment");
+  EXPECT_EQ(key, ProgramBinaryCache::GetKey("vendor|renderer|1.0", "vertex", "fragment"));
+  EXPECT_NE(key, ProgramBinaryCache::GetKey("vendor|renderer|1.1", "vertex", "fragment"));
+  EXPECT_NE(key, ProgramBinaryCache::GetKey("vendor|renderer|1.0", "vertexfragment", ""));
+
+  const Uint8Array binary{1, 2, 3, 4, 5, 6, 7, 8};
+  ASSERT_TRUE(cache.save(key, 0x8E21, binary));
+
+  unsigned int binaryFormat = 0;
+  Uint8Array loadedBinary;
+  ASSERT_TRUE(cache.load(key, binaryFormat, loadedBinary));
+  EXPECT_EQ(binaryFormat, 0x8E21u);
+  EXPECT_EQ(loadedBinary, binary);
+
+  // A truncated binary is removed
+  const auto path = cache.directory() + key + ".bin";
+  auto contents   = Filesystem::readBinaryFile(path.c_str());
+  contents.pop_back();
+  ASSERT_TRUE(Filesystem::writeBinaryFile(path.c_str(), contents));
+  EXPECT_FALSE(cache.load(key, binaryFormat, loadedBinary));
+  EXPECT_FALSE(Filesystem::exists(path));
+
+  // So is a file shorter than the header
+  ASSERT_TRUE(Filesystem::writeBinaryFile(path.c_str(), ArrayBuffer{1, 2}));
+  EXPECT_FALSE(cache.load(key, binaryFormat, loadedBinary));
+  EXPECT_FALSE(Filesystem::exists(path));
+
+  // Effects to warm up at the next start
+  const std::vector<EffectWarmUpEntry> entries{
+    {"default+default@#define DIFFUSE\n#define NUM_BONE_INFLUENCERS 4", {{"maxLights", 4}}},
+    {"pbr+pbr@", {}},
+  };
+  ASSERT_TRUE(cache.saveEffectWarmUpEntries(entries));
+  const auto loadedEntries = cache.loadEffectWarmUpEntries();
+  ASSERT_EQ(loadedEntries.size(), entries.size());
+  for (size_t i = 0; i < entries.size(); ++i) {
+    EXPECT_EQ(loadedEntries[i].key, entries[i].key);
+    EXPECT_EQ(loadedEntries[i].indexParameters, entries[i].indexParameters);
+  }
+
+  Filesystem::removeFile(cache.directory() + "effects.json");
+}
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "../test_utils.h"
+
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/mesh.h>
+
+TEST(TestSceneTransformUpdate, WorldMatricesAreComputedOncePerFrame)
+{
+  using namespace BABYLON;
+
+  for (auto parallel : {false, true}) {
+    auto engine = createSubject();
+    auto scene  = Scene::New(engine.get());
+    auto camera = FreeCamera::New("camera", Vector3(0.f, 0.f, -10.f), scene.get());
+    scene->transformUpdatePassEnabled     = true;
+    scene->parallelActiveMeshesEvaluation = parallel;
+
+    // A root with a chain of boxes
+    auto root = TransformNode::New("root", scene.get());
+    std::vector<MeshPtr> boxes;
+    Node* parent = root.get();
+    for (size_t level = 0; level < 4; ++level) {
+      auto box      = Mesh::CreateBox("box" + std::to_string(level), 0.1f, scene.get());
+      box->position = Vector3(0.f, 0.f, 0.5f);
+      box->parent   = parent;
+      parent        = box.get();
+      boxes.emplace_back(box);
+    }
+    scene->render();
+
+    const auto childUpdateIds = [&]() {
+      std::vector<int> ids{root->_childUpdateId};
+      for (const auto& box : boxes) {
+        ids.emplace_back(box->_childUpdateId);
+      }
+      return ids;
+    };
+
+    // The dirty hierarchy is recomputed once although the evaluation also calls
+    // computeWorldMatrix() on every box
+    auto previousIds = childUpdateIds();
+    root->position   = Vector3(1.f, 0.f, 0.f);
+    scene->render();
+    EXPECT_EQ(scene->getWorldMatrixUpdates(), boxes.size() + 1);
+    auto ids = childUpdateIds();
+    for (size_t i = 0; i < ids.size(); ++i) {
+      EXPECT_EQ(ids[i], previousIds[i] + 1);
+    }
+    const auto leafPosition = boxes.back()->getAbsolutePosition();
+    EXPECT_FLOAT_EQ(leafPosition.x, 1.f);
+    EXPECT_FLOAT_EQ(leafPosition.z, 2.f);
+
+    // Later calls in the same pass are cache hits, the candidates are queried after the pass
+    const auto getActiveMeshCandidates = scene->getActiveMeshCandidates;
+    size_t nbChecks                    = 0;
+
+    scene->getActiveMeshCandidates = [&]() {
+      EXPECT_EQ(scene->_transformUpdateId, scene->getRenderId());
+      for (const auto& box : boxes) {
+        box->computeWorldMatrix();
+        const auto childUpdateId = box->_childUpdateId;
+        box->computeWorldMatrix();
+        EXPECT_EQ(box->_childUpdateId, childUpdateId);
+        ++nbChecks;
+      }
+      return getActiveMeshCandidates();
+    };
+    root->position = Vector3(2.f, 0.f, 0.f);
+    scene->render();
+    scene->getActiveMeshCandidates = getActiveMeshCandidates;
+    EXPECT_EQ(nbChecks, boxes.size());
+    EXPECT_EQ(scene->getWorldMatrixUpdates(), boxes.size() + 1);
+    previousIds = childUpdateIds();
+
+    // Nothing is recomputed when nothing moved
+    scene->render();
+    EXPECT_EQ(scene->getWorldMatrixUpdates(), 0u);
+    EXPECT_EQ(childUpdateIds(), previousIds);
+  }
+}
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include <babylon/engines/processors/ishader_processor.h>
+#include <babylon/engines/processors/processing_options.h>
+#include <babylon/engines/processors/shader_processor.h>
+
+namespace {
+
+std::string Process(const std::string& sourceCode, BABYLON::ProcessingOptions& options)
+{
+  std::string processedCode;
+  BABYLON::ShaderProcessor::Process(
+    sourceCode, options, [&processedCode](const std::string& code) { processedCode = code; });
+  return processedCode;
+}
+
+} // end of anonymous namespace
+
+TEST(TestShaderProcessor, IncludesAndConditions)
+{
+  using namespace BABYLON;
+
+  ShaderProcessor::ClearCache();
+
+  ProcessingOptions options;
+  options.defines                      = {"#define LIGHTS", "#define NUM_BONES 4"};
+  options.indexParameters              = {{"maxLights", 2}};
+  options.shouldUseHighPrecisionShader = true;
+  options.processor                    = std::make_shared<IShaderProcessor>();
+  options.includesShadersStore         = {
+    {"lightFragmentDeclaration", "uniform vec4 light{X};"},
+    {"fogFragment", "gl_FragColor = color;"},
+  };
+
+  const std::string sourceCode = "#include<__decl__lightFragment>[0..maxLights]\n"
+                                 "#include<lightFragmentDeclaration>[7]\n"
+                                 "#ifdef LIGHTS\n"
+                                 "#include<fogFragment>(color,finalColor)\n"
+                                 "#else\n"
+                                 "gl_FragColor = vec4(0.);\n"
+                                 "#endif\n"
+                                 "#if defined(NO_BONES) || NUM_BONES > 2\n"
+                                 "bones(); // skinning\n"
+                                 "#elif NUM_BONES == 4\n"
+                                 "fourBones();\n"
+                                 "#endif\n"
+                                 "#ifndef LIGHTS\n"
+                                 "noLights();\n"
+                                 "#endif\n";
+
+  const auto processedCode = Process(sourceCode, options);
+  EXPECT_EQ(processedCode,
+            "precision highp float;\r\n"
+            "uniform vec4 light0;\r\n"
+            "uniform vec4 light1;\r\n"
+            "uniform vec4 light7;\r\n"
+            "gl_FragColor = finalColor;\r\n"
+            "bones();\r\n");
+
+  // The processed code is cached per source code and set of defines
+  EXPECT_EQ(ShaderProcessor::CacheSize(), 1u);
+  EXPECT_EQ(Process(sourceCode, options), processedCode);
+  EXPECT_EQ(ShaderProcessor::CacheSize(), 1u);
+
+  options.defines = {"#define NUM_BONES 4"};
+  EXPECT_EQ(Process(sourceCode, options),
+            "precision highp float;\r\n"
+            "uniform vec4 light0;\r\n"
+            "uniform vec4 light1;\r\n"
+            "uniform vec4 light7;\r\n"
+            "gl_FragColor = vec4(0.);\r\n"
+            "bones();\r\n"
+            "noLights();\r\n");
+  EXPECT_EQ(ShaderProcessor::CacheSize(), 2u);
+
+  ShaderProcessor::ClearCache();
+  EXPECT_EQ(ShaderProcessor::CacheSize(), 0u);
+}
+
+TEST(TestShaderProcessor, CacheKey)
+{
+  using namespace BABYLON;
+
+  ShaderProcessor::ClearCache();
+
+  ProcessingOptions options;
+  options.processor            = std::make_shared<IShaderProcessor>();
+  options.includesShadersStore = {{"fogFragment", "fog();"}};
+
+  const std::string sourceCode = "#include<fogFragment>\n";
+  EXPECT_EQ(Process(sourceCode, options), "precision mediump float;\r\nfog();\r\n");
+
+  // A modified include is not served from the cache
+  options.includesShadersStore["fogFragment"] = "linearFog();";
+  EXPECT_EQ(Process(sourceCode, options), "precision mediump float;\r\nlinearFog();\r\n");
+  EXPECT_EQ(ShaderProcessor::CacheSize(), 2u);
+
+  // Every processing option is part of the key
+  options.lookForClosingBracketForUniformBuffer = false;
+  Process(sourceCode, options);
+  EXPECT_EQ(ShaderProcessor::CacheSize(), 3u);
+  options.shadersRepository = "shaders/";
+  Process(sourceCode, options);
+  EXPECT_EQ(ShaderProcessor::CacheSize(), 4u);
+
+  // The oldest processed codes are evicted
+  for (size_t i = 0; i < ShaderProcessor::MaxCacheSize; ++i) {
+    Process("float value = " + std::to_string(i) + ".;\n", options);
+  }
+  EXPECT_EQ(ShaderProcessor::CacheSize(), ShaderProcessor::MaxCacheSize);
+  ShaderProcessor::ClearCache();
+}
@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include <babylon/engines/null_engine.h>
+#include <babylon/materials/effect.h>
+#include <babylon/materials/ieffect_creation_options.h>
+#include <babylon/maths/matrix.h>
+#include <babylon/maths/vector3.h>
+
+namespace {
+
+/**
+ * @brief Null engine recording the values set on the uniforms.
+ */
+class UniformRecordingEngine : public BABYLON::NullEngine {
+
+public:
+  UniformRecordingEngine() : BABYLON::NullEngine{}
+  {
+  }
+
+  void setInt(const BABYLON::WebGLUniformLocationPtr& /*uniform*/, int value) override
+  {
+    calls.emplace_back(std::vector<float>{static_cast<float>(value)});
+  }
+
+  void setFloat(const BABYLON::WebGLUniformLocationPtr& /*uniform*/, float value) override
+  {
+    calls.emplace_back(std::vector<float>{value});
+  }
+
+  void setFloat3(const BABYLON::WebGLUniformLocationPtr& /*uniform*/, float x, float y,
+                 float z) override
+  {
+    calls.emplace_back(std::vector<float>{x, y, z});
+  }
+
+  void setMatrix4x4(const BABYLON::WebGLUniformLocationPtr& /*uniform*/,
+                    const std::array<float, 16>& matrix) override
+  {
+    calls.emplace_back(std::vector<float>(matrix.begin(), matrix.end()));
+  }
+
+  void setMatrices(const BABYLON::WebGLUniformLocationPtr& /*uniform*/,
+                   const BABYLON::Float32Array& matrices) override
+  {
+    calls.emplace_back(matrices);
+  }
+
+  void setMatrix3x3(const BABYLON::WebGLUniformLocationPtr& /*uniform*/,
+                    const BABYLON::Float32Array& matrix) override
+  {
+    calls.emplace_back(matrix);
+  }
+
+  std::vector<std::vector<float>> calls;
+}; // end of class UniformRecordingEngine
+
+BABYLON::EffectPtr CreateEffect(BABYLON::ThinEngine* engine)
+{
+  using namespace BABYLON;
+
+  IEffectCreationOptions options;
+  options.uniformsNames = {"world", "alpha", "count", "vEyePosition"};
+  return Effect::New(
+    std::unordered_map<std::string, std::string>{
+      {"vertexSource", "void main(void) { gl_Position = vec4(0.); }"},
+      {"fragmentSource", "void main(void) { gl_FragColor = vec4(1.); }"}},
+    options, engine);
+}
+
+} // end of anonymous namespace
+
+TEST(TestEffectUniform, StringAndHandleSettersMatch)
+{
+  using namespace BABYLON;
+
+  UniformRecordingEngine stringEngine, handleEngine;
+  auto stringEffect = CreateEffect(&stringEngine);
+  auto handleEffect = CreateEffect(&handleEngine);
+
+  const auto world = Matrix::Translation(1.f, 2.f, 3.f);
+  stringEffect->setMatrix("world", world)
+    .setFloat("alpha", 0.5f)
+    .setInt("count", 3)
+    .setVector3("vEyePosition", Vector3(4.f, 5.f, 6.f));
+  handleEffect->setMatrix(Effect::UniformHandle("world"), world)
+    .setFloat(Effect::UniformHandle("alpha"), 0.5f)
+    .setInt(Effect::UniformHandle("count"), 3)
+    .setVector3(Effect::UniformHandle("vEyePosition"), Vector3(4.f, 5.f, 6.f));
+
+  EXPECT_EQ(stringEngine.calls.size(), 4u);
+  EXPECT_EQ(stringEngine.calls, handleEngine.calls);
+
+  // Handles are shared by all the effects and both setters resolve to the same slot
+  EXPECT_EQ(stringEffect->getUniformIndex("alpha"), 1);
+  stringEffect->setFloat(Effect::UniformHandle("alpha"), 0.5f);
+  EXPECT_EQ(stringEngine.calls.size(), 4u);
+}
+
+TEST(TestEffectUniform, UnknownHandlesAreIgnored)
+{
+  using namespace BABYLON;
+
+  UniformRecordingEngine engine;
+  auto effect = CreateEffect(&engine);
+
+  // A handle allocated for another effect, a handle past all the allocated ones and a name
+  // without handle
+  const auto otherHandle = Effect::UniformHandle("uniformOfAnotherEffect");
+  effect->setFloat(otherHandle, 1.f)
+    .setMatrix(otherHandle + 1000, Matrix::Identity())
+    .setFloat("unknownUniform", 1.f);
+  EXPECT_TRUE(engine.calls.empty());
+  EXPECT_EQ(effect->getUniformIndex("unknownUniform"), -1);
+  EXPECT_EQ(effect->getUniform(otherHandle), nullptr);
+}
+
+TEST(TestEffectUniform, ValueCache)
+{
+  using namespace BABYLON;
+
+  UniformRecordingEngine engine;
+  auto effect            = CreateEffect(&engine);
+  const auto alphaHandle = Effect::UniformHandle("alpha");
+  const auto worldHandle = Effect::UniformHandle("world");
+
+  // Redundant values are not sent again
+  effect->setFloat(alphaHandle, 0.5f).setFloat(alphaHandle, 0.5f);
+  EXPECT_EQ(engine.calls.size(), 1u);
+  effect->setFloat(alphaHandle, 0.25f);
+  EXPECT_EQ(engine.calls.size(), 2u);
+
+  // Matrices are compared by update flag
+  auto world = Matrix::Translation(1.f, 0.f, 0.f);
+  effect->setMatrix(worldHandle, world).setMatrix(worldHandle, world);
+  EXPECT_EQ(engine.calls.size(), 3u);
+  world.addAtIndex(12, 1.f);
+  effect->setMatrix(worldHandle, world);
+  EXPECT_EQ(engine.calls.size(), 4u);
+  EXPECT_FLOAT_EQ(engine.calls.back()[12], 2.f);
+
+  // Setting an array on the slot invalidates its cached value
+  effect->setMatrices(worldHandle, world.asArray());
+  effect->setMatrix(worldHandle, world);
+  EXPECT_EQ(engine.calls.size(), 6u);
+  effect->setMatrix3x3("alpha", Float32Array(9, 0.f));
+  effect->setFloat(alphaHandle, 0.25f);
+  EXPECT_EQ(engine.calls.size(), 8u);
+  effect->setFloat(alphaHandle, 0.25f);
+  EXPECT_EQ(engine.calls.size(), 8u);
+}
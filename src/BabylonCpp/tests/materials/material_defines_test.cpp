@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+
+#include <babylon/materials/material_defines.h>
+
+TEST(TestMaterialDefines, BoolDefines)
+{
+  using namespace BABYLON;
+
+  MaterialDefines defines;
+  defines.boolDef = {{"DIFFUSE", false}, {"BUMP", true}};
+  EXPECT_EQ(defines.boolDef.size(), 2u);
+  EXPECT_TRUE(defines.boolDef.contains("DIFFUSE"));
+  EXPECT_FALSE(defines["DIFFUSE"]);
+  EXPECT_TRUE(defines["BUMP"]);
+  EXPECT_FALSE(defines.boolDef.contains("FOG"));
+
+  defines.boolDef["DIFFUSE"] = true;
+  defines.boolDef["FOG"]     = defines.boolDef["BUMP"];
+  EXPECT_TRUE(defines["DIFFUSE"]);
+  EXPECT_TRUE(defines["FOG"]);
+  EXPECT_EQ(defines.boolDef.size(), 3u);
+
+  EXPECT_EQ(defines.boolDef.erase("FOG"), 1u);
+  EXPECT_EQ(defines.boolDef.erase("FOG"), 0u);
+  EXPECT_FALSE(defines.boolDef.contains("FOG"));
+  EXPECT_EQ(defines.boolDef.size(), 2u);
+}
+
+TEST(TestMaterialDefines, HashAndToString)
+{
+  using namespace BABYLON;
+
+  MaterialDefines defines;
+  defines.boolDef                        = {{"DIFFUSE", true}, {"BUMP", false}};
+  defines.intDef["NUM_BONE_INFLUENCERS"] = 4;
+  defines.stringDef["ALPHATESTVALUE"]    = "0.4";
+  EXPECT_EQ(defines.toString(),
+            "#define DIFFUSE\n#define NUM_BONE_INFLUENCERS 4\n#define ALPHATESTVALUE 0.4\n");
+
+  MaterialDefines other;
+  defines.cloneTo(other);
+  EXPECT_EQ(defines.getHash(), other.getHash());
+  EXPECT_TRUE(defines.isEqual(other));
+
+  // Setting an identical value does not change the hash, setting a different one does
+  const auto hash                        = defines.getHash();
+  defines.boolDef["BUMP"]                = false;
+  defines.intDef["NUM_BONE_INFLUENCERS"] = 4;
+  EXPECT_EQ(defines.getHash(), hash);
+  defines.boolDef["BUMP"] = true;
+  EXPECT_NE(defines.getHash(), hash);
+  EXPECT_FALSE(defines.isEqual(other));
+  EXPECT_EQ(defines.toString(), "#define DIFFUSE\n#define BUMP\n#define NUM_BONE_INFLUENCERS "
+                                "4\n#define ALPHATESTVALUE 0.4\n");
+
+  defines.boolDef["BUMP"] = false;
+  EXPECT_EQ(defines.getHash(), hash);
+  EXPECT_TRUE(defines.isEqual(other));
+}
@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include <babylon/maths/batch_math.h>
+#include <babylon/maths/matrix.h>
+#include <babylon/maths/quaternion.h>
+#include <babylon/maths/vector3.h>
+
+namespace {
+
+const std::vector<BABYLON::BatchMathBackend> AllBackends{
+  BABYLON::BatchMathBackend::Scalar, BABYLON::BatchMathBackend::SSE,
+  BABYLON::BatchMathBackend::AVX2, BABYLON::BatchMathBackend::NEON};
+
+// Runs a check with each supported backend, then restores the default one
+template <typename Check>
+void ForEachBackend(const Check& check)
+{
+  const auto defaultBackend = BABYLON::BatchMath::Backend();
+  for (const auto backend : AllBackends) {
+    if (BABYLON::BatchMath::SetBackend(backend)) {
+      check();
+    }
+  }
+  BABYLON::BatchMath::SetBackend(defaultBackend);
+}
+
+BABYLON::Matrix CreateWorldMatrix(size_t index)
+{
+  using namespace BABYLON;
+
+  const auto v = static_cast<float>(index);
+  return Matrix::Compose(Vector3(1.f + 0.1f * v, 2.f, 0.5f + 0.01f * v),
+                         Quaternion::RotationYawPitchRoll(0.3f * v, 0.2f, -0.1f * v),
+                         Vector3(v, -v, 2.f));
+}
+
+void ExpectMatrixNear(const float* actual, const BABYLON::Matrix& expected)
+{
+  for (size_t index = 0; index < 16; ++index) {
+    EXPECT_NEAR(actual[index], expected.m()[index], 1e-4f);
+  }
+}
+
+} // end of anonymous namespace
+
+TEST(TestBatchMath, MultiplyMatrices)
+{
+  using namespace BABYLON;
+
+  // 11 matrices to cover the remainders of the vectorized loops
+  const size_t count = 11;
+  std::vector<float> matrices, others;
+  for (size_t index = 0; index < count; ++index) {
+    for (const auto value : CreateWorldMatrix(index).m()) {
+      matrices.emplace_back(value);
+    }
+    for (const auto value : CreateWorldMatrix(index + 20).m()) {
+      others.emplace_back(value);
+    }
+  }
+
+  ForEachBackend([&]() {
+    std::vector<float> result(count * 16), resultByMatrix(count * 16);
+    BatchMath::MultiplyMatrices(matrices.data(), others.data(), result.data(), count);
+    BatchMath::MultiplyMatricesByMatrix(matrices.data(), others.data(), resultByMatrix.data(),
+                                        count);
+    // In place
+    auto inPlace = matrices;
+    BatchMath::MultiplyMatrices(inPlace.data(), others.data(), inPlace.data(), count);
+    for (size_t index = 0; index < count; ++index) {
+      auto matrix = CreateWorldMatrix(index);
+      ExpectMatrixNear(&result[index * 16], matrix.multiply(CreateWorldMatrix(index + 20)));
+      ExpectMatrixNear(&inPlace[index * 16], matrix.multiply(CreateWorldMatrix(index + 20)));
+      ExpectMatrixNear(&resultByMatrix[index * 16], matrix.multiply(CreateWorldMatrix(20)));
+    }
+  });
+}
+
+TEST(TestBatchMath, TransformPoints)
+{
+  using namespace BABYLON;
+
+  // 23 points: 2 blocks of 8, a block of 4 and 3 remaining points
+  const size_t count = 23;
+  std::vector<float> points;
+  for (size_t index = 0; index < count * 3; ++index) {
+    points.emplace_back(std::sin(static_cast<float>(index)) * 10.f);
+  }
+  // A projection matrix to check the division by w
+  const auto matrix = CreateWorldMatrix(3).multiply(
+    Matrix::PerspectiveFovLH(0.8f, 1.5f, 0.1f, 100.f));
+
+  ForEachBackend([&]() {
+    std::vector<float> coordinates(count * 3);
+    auto normals = points;
+    BatchMath::TransformCoordinates(points.data(), matrix.m().data(), coordinates.data(), count);
+    BatchMath::TransformNormals(normals.data(), matrix.m().data(), normals.data(), count);
+    for (size_t index = 0; index < count; ++index) {
+      const auto point      = Vector3::FromArray(points, index * 3);
+      const auto coordinate = Vector3::TransformCoordinates(point, matrix);
+      const auto normal     = Vector3::TransformNormal(point, matrix);
+      for (size_t axis = 0; axis < 3; ++axis) {
+        EXPECT_NEAR(coordinates[index * 3 + axis], coordinate.asArray()[axis], 1e-4f);
+        EXPECT_NEAR(normals[index * 3 + axis], normal.asArray()[axis], 1e-4f);
+      }
+    }
+  });
+}
+
+TEST(TestBatchMath, ComposeAndInvertAffine)
+{
+  using namespace BABYLON;
+
+  const size_t count = 5;
+  std::vector<float> scalings, rotations, translations;
+  for (size_t index = 0; index < count; ++index) {
+    const auto v = static_cast<float>(index);
+    for (const auto value : {1.f + 0.1f * v, 2.f, 0.5f + 0.01f * v}) {
+      scalings.emplace_back(value);
+    }
+    const auto rotation = Quaternion::RotationYawPitchRoll(0.3f * v, 0.2f, -0.1f * v);
+    for (const auto value : {rotation.x, rotation.y, rotation.z, rotation.w}) {
+      rotations.emplace_back(value);
+    }
+    for (const auto value : {v, -v, 2.f}) {
+      translations.emplace_back(value);
+    }
+  }
+
+  std::vector<float> matrices(count * 16), inverses(count * 16);
+  BatchMath::ComposeMatrices(scalings.data(), rotations.data(), translations.data(),
+                             matrices.data(), count);
+  BatchMath::InvertAffineMatrices(matrices.data(), inverses.data(), count);
+  for (size_t index = 0; index < count; ++index) {
+    auto matrix = CreateWorldMatrix(index);
+    ExpectMatrixNear(&matrices[index * 16], matrix);
+    matrix.invert();
+    ExpectMatrixNear(&inverses[index * 16], matrix);
+  }
+}
+
+TEST(TestBatchMath, TransformBoundingBoxes)
+{
+  using namespace BABYLON;
+
+  const size_t count = 6;
+  std::vector<float> boxes, matrices;
+  for (size_t index = 0; index < count; ++index) {
+    const auto v = static_cast<float>(index);
+    for (const auto value : {-1.f - v, -2.f, -0.5f, 1.f, 2.f + v, 3.f}) {
+      boxes.emplace_back(value);
+    }
+    for (const auto value : CreateWorldMatrix(index).m()) {
+      matrices.emplace_back(value);
+    }
+  }
+
+  ForEachBackend([&]() {
+    // In place
+    auto result = boxes;
+    BatchMath::TransformBoundingBoxes(result.data(), matrices.data(), result.data(), count);
+    for (size_t index = 0; index < count; ++index) {
+      // Bounds of the 8 transformed corners
+      const auto matrix = CreateWorldMatrix(index);
+      auto minimum      = Vector3(1e10f, 1e10f, 1e10f);
+      auto maximum      = Vector3(-1e10f, -1e10f, -1e10f);
+      for (size_t corner = 0; corner < 8; ++corner) {
+        const Vector3 point(boxes[index * 6 + ((corner & 1) ? 3 : 0)],
+                            boxes[index * 6 + ((corner & 2) ? 4 : 1)],
+                            boxes[index * 6 + ((corner & 4) ? 5 : 2)]);
+        const auto transformed = Vector3::TransformCoordinates(point, matrix);
+        minimum.minimizeInPlace(transformed);
+        maximum.maximizeInPlace(transformed);
+      }
+      for (size_t axis = 0; axis < 3; ++axis) {
+        EXPECT_NEAR(result[index * 6 + axis], minimum.asArray()[axis], 1e-4f);
+        EXPECT_NEAR(result[index * 6 + 3 + axis], maximum.asArray()[axis], 1e-4f);
+      }
+    }
+  });
+}
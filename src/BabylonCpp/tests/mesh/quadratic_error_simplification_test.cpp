@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include "../test_utils.h"
+
+#include <babylon/asio/asio.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/mesh_lod_level.h>
+#include <babylon/meshes/simplification/quadratic_error_simplification.h>
+#include <babylon/meshes/simplification/simplification_queue.h>
+#include <babylon/meshes/sub_mesh.h>
+
+namespace {
+
+// Runs the main thread callbacks until the condition is met, for 30 seconds at most
+bool WaitFor(const std::function<bool()>& condition)
+{
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+  while (!condition()) {
+    if (std::chrono::steady_clock::now() > deadline) {
+      return false;
+    }
+    BABYLON::asio::HeartBeat_Sync();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return true;
+}
+
+void ExpectValidMesh(BABYLON::Mesh& mesh)
+{
+  const auto nbVertices = mesh.getTotalVertices();
+  const auto indices    = mesh.getIndices();
+  ASSERT_FALSE(indices.empty());
+  EXPECT_EQ(indices.size() % 3, 0u);
+  for (const auto index : indices) {
+    ASSERT_LT(index, nbVertices);
+  }
+  for (const auto& subMesh : mesh.subMeshes) {
+    EXPECT_LE(subMesh->indexStart + subMesh->indexCount, indices.size());
+    EXPECT_LE(subMesh->verticesStart + subMesh->verticesCount, nbVertices);
+  }
+}
+
+} // end of anonymous namespace
+
+TEST(TestQuadraticErrorSimplification, Simplify)
+{
+  using namespace BABYLON;
+
+  auto engine            = createSubject();
+  auto scene             = Scene::New(engine.get());
+  auto sphere            = Mesh::CreateSphere("sphere", 32, 2.f, scene.get());
+  const auto nbTriangles = sphere->getTotalIndices() / 3;
+
+  MeshPtr simplifiedMesh = nullptr;
+  QuadraticErrorSimplification simplifier(sphere.get());
+  simplifier.simplify({0.5f, 10.f, false},
+                      [&simplifiedMesh](const MeshPtr& mesh) { simplifiedMesh = mesh; });
+  ASSERT_TRUE(WaitFor([&simplifiedMesh]() { return simplifiedMesh != nullptr; }));
+
+  // About half of the triangles are collapsed
+  const auto nbSimplifiedTriangles = simplifiedMesh->getTotalIndices() / 3;
+  EXPECT_GT(nbSimplifiedTriangles, nbTriangles / 4);
+  EXPECT_LT(nbSimplifiedTriangles, nbTriangles * 6 / 10);
+  ExpectValidMesh(*simplifiedMesh);
+
+  // The source mesh is untouched
+  EXPECT_EQ(sphere->getTotalIndices() / 3, nbTriangles);
+}
+
+TEST(TestQuadraticErrorSimplification, LevelsOfDetail)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+
+  for (auto parallelProcessing : {false, true}) {
+    auto sphere            = Mesh::CreateSphere("sphere", 32, 2.f, scene.get());
+    const auto nbTriangles = sphere->getTotalIndices() / 3;
+
+    auto done = false;
+    sphere->simplify({{0.5f, 10.f, false}, {0.2f, 20.f, false}}, parallelProcessing,
+                     SimplificationType::QUADRATIC, [&done]() { done = true; });
+    scene->simplificationQueue()->executeNext();
+
+    // The levels are only added by the main thread callbacks
+    EXPECT_TRUE(sphere->getLODLevels().empty());
+    ASSERT_TRUE(WaitFor([&done]() { return done; }));
+    ASSERT_EQ(sphere->getLODLevels().size(), 2u);
+
+    // The farthest level has the fewest triangles
+    auto nearLevel = sphere->getLODLevelAtDistance(10.f);
+    auto farLevel  = sphere->getLODLevelAtDistance(20.f);
+    ASSERT_TRUE(nearLevel && farLevel);
+    ExpectValidMesh(*nearLevel);
+    ExpectValidMesh(*farLevel);
+    EXPECT_LT(nearLevel->getTotalIndices() / 3, nbTriangles);
+    EXPECT_LT(farLevel->getTotalIndices(), nearLevel->getTotalIndices());
+  }
+}
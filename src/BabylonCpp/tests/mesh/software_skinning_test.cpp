@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include <babylon/maths/matrix.h>
+#include <babylon/maths/vector3.h>
+#include <babylon/meshes/software_skinning.h>
+#include <babylon/misc/job_pool.h>
+
+namespace {
+
+struct SkinnedMesh {
+  BABYLON::Float32Array boneMatrices;
+  BABYLON::Float32Array sourcePositions, sourceNormals, sourceTangents;
+  BABYLON::Float32Array indices, weights, indicesExtra, weightsExtra;
+};
+
+SkinnedMesh CreateSkinnedMesh(size_t nbVertices, size_t nbBones)
+{
+  using namespace BABYLON;
+
+  SkinnedMesh mesh;
+  for (size_t bone = 0; bone < nbBones; ++bone) {
+    const auto angle  = static_cast<float>(bone) * 0.3f;
+    const auto matrix = Matrix::RotationYawPitchRoll(angle, angle * 0.5f, 0.f)
+                          .multiply(Matrix::Translation(angle, 1.f, -angle));
+    for (const auto value : matrix.m()) {
+      mesh.boneMatrices.emplace_back(value);
+    }
+  }
+  for (size_t vertex = 0; vertex < nbVertices; ++vertex) {
+    const auto v = static_cast<float>(vertex);
+    for (const auto value : {std::sin(v), std::cos(v), v * 0.01f}) {
+      mesh.sourcePositions.emplace_back(value);
+      mesh.sourceNormals.emplace_back(value * 0.5f);
+      mesh.sourceTangents.emplace_back(-value);
+    }
+    mesh.sourceTangents.emplace_back(vertex % 2 ? 1.f : -1.f);
+    // The last influence of each group is unused
+    for (size_t inf = 0; inf < 4; ++inf) {
+      mesh.indices.emplace_back(static_cast<float>((vertex + inf) % nbBones));
+      mesh.weights.emplace_back(inf < 3 ? 0.2f : 0.f);
+      mesh.indicesExtra.emplace_back(static_cast<float>((vertex * 3 + inf) % nbBones));
+      mesh.weightsExtra.emplace_back(inf < 3 ? 0.4f / 3.f : 0.f);
+    }
+  }
+  return mesh;
+}
+
+// Skins a vertex with the Matrix and Vector3 helpers
+BABYLON::Matrix BlendedMatrix(const SkinnedMesh& mesh, size_t vertex, bool extras)
+{
+  using namespace BABYLON;
+
+  Matrix result = Matrix::FromValues(0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f,
+                                     0.f, 0.f, 0.f, 0.f);
+  Matrix bone;
+  for (size_t inf = 0; inf < 4; ++inf) {
+    Matrix::FromFloat32ArrayToRefScaled(
+      mesh.boneMatrices, static_cast<unsigned int>(mesh.indices[vertex * 4 + inf] * 16),
+      mesh.weights[vertex * 4 + inf], bone);
+    result.addToSelf(bone);
+    if (extras) {
+      Matrix::FromFloat32ArrayToRefScaled(
+        mesh.boneMatrices, static_cast<unsigned int>(mesh.indicesExtra[vertex * 4 + inf] * 16),
+        mesh.weightsExtra[vertex * 4 + inf], bone);
+      result.addToSelf(bone);
+    }
+  }
+  return result;
+}
+
+} // end of anonymous namespace
+
+TEST(TestSoftwareSkinning, MatchesMatrixSkinning)
+{
+  using namespace BABYLON;
+
+  const size_t nbVertices = 10000;
+  const auto mesh         = CreateSkinnedMesh(nbVertices, 20);
+
+  JobPool jobPool(3);
+  for (bool extras : {false, true}) {
+    Float32Array positions(nbVertices * 3), normals(nbVertices * 3), tangents(nbVertices * 4);
+    SkinnedVertexData data;
+    data.vertexCount     = nbVertices;
+    data.sourcePositions = mesh.sourcePositions.data();
+    data.sourceNormals   = mesh.sourceNormals.data();
+    data.sourceTangents  = mesh.sourceTangents.data();
+    data.positions       = positions.data();
+    data.normals         = normals.data();
+    data.tangents        = tangents.data();
+    if (extras) {
+      SoftwareSkinning::Skin8(data, mesh.boneMatrices, mesh.indices.data(), mesh.weights.data(),
+                              mesh.indicesExtra.data(), mesh.weightsExtra.data(), &jobPool);
+    }
+    else {
+      SoftwareSkinning::Skin4(data, mesh.boneMatrices, mesh.indices.data(), mesh.weights.data(),
+                              &jobPool);
+    }
+
+    for (size_t vertex = 0; vertex < nbVertices; vertex += 7) {
+      const auto matrix   = BlendedMatrix(mesh, vertex, extras);
+      const auto position = Vector3::TransformCoordinates(
+        Vector3::FromArray(mesh.sourcePositions, vertex * 3), matrix);
+      const auto normal
+        = Vector3::TransformNormal(Vector3::FromArray(mesh.sourceNormals, vertex * 3), matrix);
+      const auto tangent
+        = Vector3::TransformNormal(Vector3::FromArray(mesh.sourceTangents, vertex * 4), matrix);
+      for (size_t index = 0; index < 3; ++index) {
+        EXPECT_NEAR(positions[vertex * 3 + index], position.asArray()[index], 1e-4f);
+        EXPECT_NEAR(normals[vertex * 3 + index], normal.asArray()[index], 1e-4f);
+        EXPECT_NEAR(tangents[vertex * 4 + index], tangent.asArray()[index], 1e-4f);
+      }
+      EXPECT_EQ(tangents[vertex * 4 + 3], mesh.sourceTangents[vertex * 4 + 3]);
+    }
+  }
+}
+
+TEST(TestSoftwareSkinning, Morph)
+{
+  using namespace BABYLON;
+
+  const Float32Array source{0.f, 1.f, 2.f, 3.f, 4.f, 5.f};
+  const Float32Array target0{1.f, 1.f, 2.f, 3.f, 4.f, 6.f};
+  const Float32Array target1{0.f, 3.f, 2.f, 3.f, 0.f, 5.f};
+  const Float32Array influences{0.5f, 0.25f};
+  Float32Array result(source.size());
+
+  SoftwareSkinning::Morph(source.data(), {target0.data(), target1.data()}, influences.data(),
+                          result.data(), source.size());
+
+  const Float32Array expected{0.5f, 1.5f, 2.f, 3.f, 3.f, 5.5f};
+  for (size_t index = 0; index < source.size(); ++index) {
+    EXPECT_FLOAT_EQ(result[index], expected[index]);
+  }
+}
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include <babylon/meshes/facet_parameters.h>
+#include <babylon/meshes/tangent_space_generator.h>
+#include <babylon/meshes/vertex_data.h>
+#include <babylon/misc/job_pool.h>
+
+namespace {
+
+struct Grid {
+  BABYLON::Float32Array positions;
+  BABYLON::Float32Array uvs;
+  BABYLON::Uint32Array indices;
+};
+
+// Grid of the xz plane with bumps, u along x and v along z (or mirrored)
+Grid CreateGrid(uint32_t subdivisions, bool mirrorU = false, bool bumps = true)
+{
+  Grid grid;
+  for (uint32_t row = 0; row <= subdivisions; ++row) {
+    for (uint32_t col = 0; col <= subdivisions; ++col) {
+      const auto x = static_cast<float>(col), z = static_cast<float>(row);
+      grid.positions.insert(grid.positions.end(),
+                            {x, bumps ? std::sin(x * 0.3f) * std::cos(z * 0.2f) : 0.f, z});
+      grid.uvs.insert(grid.uvs.end(), {mirrorU ? -x : x, z});
+    }
+  }
+  for (uint32_t row = 0; row < subdivisions; ++row) {
+    for (uint32_t col = 0; col < subdivisions; ++col) {
+      const auto i = row * (subdivisions + 1) + col;
+      grid.indices.insert(grid.indices.end(), {i, i + 1, i + subdivisions + 1});
+      grid.indices.insert(grid.indices.end(),
+                          {i + 1, i + subdivisions + 2, i + subdivisions + 1});
+    }
+  }
+  return grid;
+}
+
+} // end of anonymous namespace
+
+TEST(TestTangentSpaceGenerator, NormalsMatchComputeNormals)
+{
+  using namespace BABYLON;
+
+  // Enough faces to be split over the pool
+  const auto grid = CreateGrid(100);
+
+  // The facet parameters select the face loop of ComputeNormals
+  Float32Array expected;
+  VertexData::ComputeNormals(grid.positions, grid.indices, expected, FacetParameters());
+
+  JobPool jobPool(3);
+  TangentSpaceGenerator generator(&jobPool);
+  Float32Array normals;
+  generator.computeNormals(grid.positions, grid.indices, normals);
+  EXPECT_EQ(normals, expected);
+
+  Float32Array defaultNormals;
+  VertexData::ComputeNormals(grid.positions, grid.indices, defaultNormals);
+  EXPECT_EQ(defaultNormals, expected);
+}
+
+TEST(TestTangentSpaceGenerator, IncrementalNormals)
+{
+  using namespace BABYLON;
+
+  auto grid = CreateGrid(100);
+  JobPool jobPool(3);
+  TangentSpaceGenerator generator(&jobPool);
+  Float32Array normals;
+  generator.computeNormals(grid.positions, grid.indices, normals);
+
+  // Raise a few rows of the grid
+  const size_t dirtyStart = 101 * 40, dirtyCount = 101 * 3;
+  for (auto vertex = dirtyStart; vertex < dirtyStart + dirtyCount; ++vertex) {
+    grid.positions[vertex * 3 + 1] += 0.5f + 0.01f * static_cast<float>(vertex % 7);
+  }
+  generator.updateNormals(grid.positions, grid.indices, normals, dirtyStart, dirtyCount);
+
+  Float32Array expected;
+  TangentSpaceGenerator().computeNormals(grid.positions, grid.indices, expected);
+  EXPECT_EQ(normals, expected);
+}
+
+TEST(TestTangentSpaceGenerator, Tangents)
+{
+  using namespace BABYLON;
+
+  TangentSpaceGenerator generator;
+  for (const bool mirrorU : {false, true}) {
+    const auto grid = CreateGrid(4, mirrorU, false);
+    Float32Array normals, tangents;
+    generator.computeNormals(grid.positions, grid.indices, normals);
+    generator.computeTangents(grid.positions, normals, grid.uvs, grid.indices, tangents);
+    ASSERT_EQ(tangents.size(), grid.positions.size() / 3 * 4);
+    // The tangent follows u, the w component flips with the uvs
+    for (size_t vertex = 0; vertex < tangents.size() / 4; ++vertex) {
+      EXPECT_NEAR(tangents[vertex * 4], mirrorU ? -1.f : 1.f, 1e-5f);
+      EXPECT_NEAR(tangents[vertex * 4 + 1], 0.f, 1e-5f);
+      EXPECT_NEAR(tangents[vertex * 4 + 2], 0.f, 1e-5f);
+      EXPECT_EQ(tangents[vertex * 4 + 3], mirrorU ? -1.f : 1.f);
+    }
+  }
+
+  // Tangents stay orthogonal to the normals of a curved surface
+  const auto grid = CreateGrid(20);
+  Float32Array normals, tangents;
+  generator.computeNormals(grid.positions, grid.indices, normals);
+  generator.computeTangents(grid.positions, normals, grid.uvs, grid.indices, tangents);
+  for (size_t vertex = 0; vertex < tangents.size() / 4; ++vertex) {
+    const auto t = &tangents[vertex * 4];
+    const auto n = &normals[vertex * 3];
+    EXPECT_NEAR(t[0] * n[0] + t[1] * n[1] + t[2] * n[2], 0.f, 1e-5f);
+    EXPECT_NEAR(t[0] * t[0] + t[1] * t[1] + t[2] * t[2], 1.f, 1e-5f);
+  }
+}
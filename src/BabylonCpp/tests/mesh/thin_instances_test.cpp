@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+
+#include <babylon/culling/bounding_info.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/mesh.h>
+
+TEST(TestThinInstances, AddAndCount)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  auto box    = Mesh::CreateBox("box", 1.f, scene.get());
+  EXPECT_FALSE(box->hasThinInstances());
+  EXPECT_EQ(box->thinInstanceGetBuffer("matrix"), nullptr);
+
+  // The matrix buffer starts with room for 32 instances and doubles when full
+  for (size_t i = 0; i < 32; ++i) {
+    EXPECT_EQ(box->thinInstanceAdd(Matrix::Translation(static_cast<float>(i), 0.f, 0.f), false),
+              i);
+  }
+  EXPECT_TRUE(box->hasThinInstances());
+  EXPECT_EQ(box->thinInstanceGetBuffer("matrix")->size(), 32u * 16u);
+  EXPECT_EQ(box->thinInstanceAdd({Matrix::Identity(), Matrix::Identity()}), 32u);
+  EXPECT_EQ(box->thinInstanceCount(), 34u);
+  auto matrixData = box->thinInstanceGetBuffer("matrix");
+  ASSERT_NE(matrixData, nullptr);
+  EXPECT_EQ(matrixData->size(), 64u * 16u);
+
+  // The existing matrices are kept when the buffer grows
+  EXPECT_FLOAT_EQ((*matrixData)[31 * 16 + 12], 31.f);
+  EXPECT_FLOAT_EQ((*matrixData)[32 * 16 + 12], 0.f);
+
+  // The count cannot exceed the capacity of the buffer
+  box->thinInstanceCount = 10;
+  EXPECT_EQ(box->thinInstanceCount(), 10u);
+  box->thinInstanceCount = 65;
+  EXPECT_EQ(box->thinInstanceCount(), 10u);
+  box->thinInstanceCount = 64;
+  EXPECT_EQ(box->thinInstanceCount(), 64u);
+
+  // Only the matrices of existing instances can be set
+  EXPECT_TRUE(box->thinInstanceSetMatrixAt(63, Matrix::Translation(0.f, 5.f, 0.f)));
+  box->thinInstanceCount = 34;
+  EXPECT_FALSE(box->thinInstanceSetMatrixAt(34, Matrix::Identity()));
+}
+
+TEST(TestThinInstances, PartialBufferUpdate)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  auto box    = Mesh::CreateBox("box", 1.f, scene.get());
+  box->thinInstanceAdd({Matrix::Identity(), Matrix::Identity(), Matrix::Identity()});
+
+  // The second matrix is replaced, the other ones are untouched
+  box->thinInstancePartialBufferUpdate("matrix", Matrix::Translation(1.f, 2.f, 3.f).asArray(),
+                                       16);
+  const auto& matrixData = *box->thinInstanceGetBuffer("matrix");
+  EXPECT_FLOAT_EQ(matrixData[16 + 12], 1.f);
+  EXPECT_FLOAT_EQ(matrixData[16 + 13], 2.f);
+  EXPECT_FLOAT_EQ(matrixData[16 + 14], 3.f);
+  EXPECT_FLOAT_EQ(matrixData[12], 0.f);
+  EXPECT_FLOAT_EQ(matrixData[32 + 12], 0.f);
+
+  // Out of range updates are ignored
+  const auto size = matrixData.size();
+  box->thinInstancePartialBufferUpdate("matrix", Float32Array(32, 7.f), size - 16);
+  EXPECT_EQ(matrixData.size(), size);
+  EXPECT_FLOAT_EQ(matrixData[size - 1], 0.f);
+
+  // Custom attributes are updated the same way
+  box->thinInstanceRegisterAttribute("color", 4);
+  box->thinInstancePartialBufferUpdate("color", {1.f, 0.f, 0.f, 1.f}, 4);
+  const auto& colorData = *box->thinInstanceGetBuffer("color");
+  EXPECT_FLOAT_EQ(colorData[4], 1.f);
+  EXPECT_FLOAT_EQ(colorData[7], 1.f);
+  EXPECT_FLOAT_EQ(colorData[0], 0.f);
+}
+
+TEST(TestThinInstances, BoundingInfoAndReset)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  auto box    = Mesh::CreateBox("box", 1.f, scene.get());
+
+  // The bounding box encloses the boxes of all the thin instances
+  box->thinInstanceAdd({Matrix::Translation(2.f, 0.f, 0.f), Matrix::Translation(-3.f, 1.f, 0.f),
+                        Matrix::Scaling(1.f, 1.f, 4.f)});
+  auto* boundingBox = &box->getBoundingInfo()->boundingBox;
+  EXPECT_TRUE(boundingBox->minimum.equalsWithEpsilon(Vector3(-3.5f, -0.5f, -2.f)));
+  EXPECT_TRUE(boundingBox->maximum.equalsWithEpsilon(Vector3(2.5f, 1.5f, 2.f)));
+
+  // It is computed from the bounds of the geometry, not from the previous result
+  box->thinInstanceSetMatrixAt(1, Matrix::Translation(0.f, -1.f, 0.f));
+  boundingBox = &box->getBoundingInfo()->boundingBox;
+  EXPECT_TRUE(boundingBox->minimum.equalsWithEpsilon(Vector3(-0.5f, -1.5f, -2.f)));
+  EXPECT_TRUE(boundingBox->maximum.equalsWithEpsilon(Vector3(2.5f, 0.5f, 2.f)));
+
+  // An empty matrix buffer removes the thin instances and restores the bounds of the geometry
+  box->thinInstanceSetBuffer("matrix", {});
+  EXPECT_FALSE(box->hasThinInstances());
+  EXPECT_EQ(box->thinInstanceCount(), 0u);
+  EXPECT_EQ(box->thinInstanceGetBuffer("matrix"), nullptr);
+  boundingBox = &box->getBoundingInfo()->boundingBox;
+  EXPECT_TRUE(boundingBox->minimum.equalsWithEpsilon(Vector3(-0.5f, -0.5f, -0.5f)));
+  EXPECT_TRUE(boundingBox->maximum.equalsWithEpsilon(Vector3(0.5f, 0.5f, 0.5f)));
+
+  // Thin instances can be added again afterwards
+  EXPECT_EQ(box->thinInstanceAdd(Matrix::Translation(0.f, 0.f, 10.f)), 0u);
+  EXPECT_EQ(box->thinInstanceGetBuffer("matrix")->size(), 32u * 16u);
+  boundingBox = &box->getBoundingInfo()->boundingBox;
+  EXPECT_TRUE(boundingBox->minimum.equalsWithEpsilon(Vector3(-0.5f, -0.5f, 9.5f)));
+  EXPECT_TRUE(boundingBox->maximum.equalsWithEpsilon(Vector3(0.5f, 0.5f, 10.5f)));
+}
@@ -0,0 +1,41 @@
+#include <gtest/gtest.h>
+
+#include <babylon/maths/spherical_polynomial.h>
+#include <babylon/misc/environment_texture_info.h>
+#include <babylon/misc/environment_texture_tools.h>
+
+TEST(TestEnvironmentTextureTools, CreateEnvArrayBuffer)
+{
+  using namespace BABYLON;
+
+  // 2x2 faces: 2 mipmaps of 6 images
+  std::vector<std::vector<ArrayBuffer>> imageData(2);
+  uint8_t value = 0;
+  for (auto& faces : imageData) {
+    for (size_t face = 0; face < 6; ++face) {
+      faces.emplace_back(ArrayBuffer(face + 1, value++));
+    }
+  }
+  SphericalPolynomial sphericalPolynomial;
+  sphericalPolynomial.x  = Vector3(1.f, 2.f, 3.f);
+  sphericalPolynomial.xy = Vector3(4.f, 5.f, 6.f);
+
+  const auto env
+    = EnvironmentTextureTools::CreateEnvArrayBuffer(imageData, 2, &sphericalPolynomial);
+
+  // Read back
+  const auto info = EnvironmentTextureTools::GetEnvInfo(env);
+  ASSERT_TRUE(info);
+  EXPECT_EQ(info->version, 1u);
+  EXPECT_EQ(info->width, 2);
+  ASSERT_TRUE(info->irradiance);
+  EXPECT_EQ(info->irradiance->x, Float32Array({1.f, 2.f, 3.f}));
+  EXPECT_EQ(info->irradiance->xy, Float32Array({4.f, 5.f, 6.f}));
+  ASSERT_TRUE(info->specular);
+  EXPECT_FLOAT_EQ(*info->specular->lodGenerationScale, 0.8f);
+  EXPECT_EQ(EnvironmentTextureTools::CreateImageDataArrayBufferViews(env, *info), imageData);
+
+  // Without irradiance
+  const auto specularOnly = EnvironmentTextureTools::CreateEnvArrayBuffer(imageData, 2, nullptr);
+  EXPECT_FALSE(EnvironmentTextureTools::GetEnvInfo(specularOnly)->irradiance);
+}
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include <babylon/misc/highdynamicrange/panorama_to_cube_map_tools.h>
+#include <babylon/misc/highdynamicrange/pmrem_generator.h>
+#include <babylon/misc/job_pool.h>
+
+namespace {
+
+// Cube map of size * size RGB faces, +X face set to positiveX and the others to otherFaces
+std::vector<BABYLON::Float32Array> CreateCubeMap(size_t size, float positiveX, float otherFaces)
+{
+  std::vector<BABYLON::Float32Array> faces(6,
+                                           BABYLON::Float32Array(size * size * 3, otherFaces));
+  std::fill(faces[0].begin(), faces[0].end(), positiveX);
+  return faces;
+}
+
+} // end of anonymous namespace
+
+TEST(TestPanoramaToCubeMapTools, ConvertPanoramaToCubemap)
+{
+  using namespace BABYLON;
+
+  // The rows of the panorama are stored from the bottom: red bottom half and blue top half
+  const size_t width = 64, height = 32, size = 16;
+  Float32Array panorama(width * height * 3, 0.f);
+  for (size_t y = 0; y < height; ++y) {
+    for (size_t x = 0; x < width; ++x) {
+      panorama[(y * width + x) * 3 + (y < height / 2 ? 0 : 2)] = 1.f;
+    }
+  }
+
+  JobPool jobPool(2);
+  auto cubeMap = PanoramaToCubeMapTools::ConvertPanoramaToCubemap(panorama, width, height, size,
+                                                                  &jobPool);
+  EXPECT_EQ(cubeMap.size, size);
+  const auto up   = cubeMap.up.float32Array();
+  const auto down = cubeMap.down.float32Array();
+  ASSERT_EQ(up.size(), size * size * 3);
+  ASSERT_EQ(down.size(), size * size * 3);
+  for (size_t i = 0; i < size * size; ++i) {
+    EXPECT_EQ(up[i * 3 + 0], 1.f);
+    EXPECT_EQ(down[i * 3 + 2], 1.f);
+  }
+
+  // Same faces when converted on the calling thread only
+  JobPool serialJobPool(0);
+  auto serialCubeMap = PanoramaToCubeMapTools::ConvertPanoramaToCubemap(panorama, width, height,
+                                                                        size, &serialJobPool);
+  for (const auto* face : {"front", "back", "left", "right", "up", "down"}) {
+    EXPECT_EQ(serialCubeMap[face].float32Array(), cubeMap[face].float32Array()) << face;
+  }
+
+  // Wrong input size
+  EXPECT_TRUE(PanoramaToCubeMapTools::ConvertPanoramaToCubemap(panorama, width, height + 1, size)
+                .front.float32Array()
+                .empty());
+}
+
+TEST(TestPMREMGenerator, FilterCubeMap)
+{
+  using namespace BABYLON;
+
+  // A constant cube map stays constant on every mip level
+  const size_t size = 8;
+  JobPool jobPool(2);
+  auto faces = CreateCubeMap(size, 0.5f, 0.5f);
+  PMREMGenerator<Float32Array> constantGenerator(faces, size, size, 0, 3, true, 2048.f, 0.25f,
+                                                 false, true, &jobPool);
+  const auto& constantMips = constantGenerator.filterCubeMap();
+  ASSERT_EQ(constantMips.size(), 4u);
+  for (size_t level = 0; level < constantMips.size(); ++level) {
+    const size_t mipSize = size >> level;
+    ASSERT_EQ(constantMips[level].size(), 6u);
+    for (const auto& face : constantMips[level]) {
+      ASSERT_EQ(face.size(), mipSize * mipSize * 3);
+      for (auto value : face) {
+        EXPECT_NEAR(value, 0.5f, 1e-5f);
+      }
+    }
+  }
+
+  // Light coming from +X: sharp on the first level, blurred on the next ones
+  faces = CreateCubeMap(size, 1.f, 0.f);
+  PMREMGenerator<Float32Array> generator(faces, size, size, 0, 3, true, 2048.f, 0.25f, false,
+                                         true, &jobPool);
+  const auto mips = generator.filterCubeMap();
+  const auto center
+    = [](const std::vector<Float32Array>& mip, size_t face, size_t mipSize) {
+        return mip[face][(mipSize / 2 * mipSize + mipSize / 2) * 3];
+      };
+  EXPECT_NEAR(center(mips[0], 0, size), 1.f, 1e-5f);
+  EXPECT_NEAR(center(mips[0], 1, size), 0.f, 1e-5f);
+  EXPECT_LT(center(mips[2], 0, size >> 2), 1.f);
+  // The 1x1 faces are averaged
+  EXPECT_GT(center(mips[3], 1, 1), 0.f);
+  EXPECT_EQ(center(mips[3], 0, 1), center(mips[3], 1, 1));
+
+  // Same result when filtered on the calling thread only
+  JobPool serialJobPool(0);
+  PMREMGenerator<Float32Array> serialGenerator(faces, size, size, 0, 3, true, 2048.f, 0.25f,
+                                               false, true, &serialJobPool);
+  EXPECT_EQ(serialGenerator.filterCubeMap(), mips);
+}
@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include <babylon/misc/job_pool.h>
+
+TEST(TestJobPool, ParallelFor)
+{
+  using namespace BABYLON;
+
+  JobPool jobPool(3);
+  EXPECT_EQ(jobPool.concurrency(), 4u);
+
+  // Every item is processed once, in chunks of at most grainSize items
+  std::vector<int> values(1000, 0);
+  std::atomic<size_t> nbCalls{0};
+  jobPool.parallelFor(values.size(), 64, [&](size_t begin, size_t end) {
+    EXPECT_LE(end - begin, 64u);
+    for (auto i = begin; i < end; ++i) {
+      ++values[i];
+    }
+    ++nbCalls;
+  });
+  EXPECT_EQ(std::accumulate(values.begin(), values.end(), 0), 1000);
+  EXPECT_EQ(nbCalls, 16u);
+
+  // Nested calls run on the calling thread
+  std::atomic<size_t> nbItems{0};
+  jobPool.parallelFor(8, 1, [&](size_t /*begin*/, size_t /*end*/) {
+    jobPool.parallelFor(10, 2, [&](size_t begin, size_t end) { nbItems += end - begin; });
+  });
+  EXPECT_EQ(nbItems, 80u);
+}
+
+TEST(TestJobPool, Exception)
+{
+  using namespace BABYLON;
+
+  JobPool jobPool(2);
+  EXPECT_THROW(jobPool.parallelFor(100, 10,
+                                   [](size_t begin, size_t /*end*/) {
+                                     if (begin == 50) {
+                                       throw std::runtime_error("job failure");
+                                     }
+                                   }),
+               std::runtime_error);
+
+  // The pool is still usable
+  std::atomic<size_t> nbItems{0};
+  jobPool.parallelFor(100, 10, [&](size_t begin, size_t end) { nbItems += end - begin; });
+  EXPECT_EQ(nbItems, 100u);
+}
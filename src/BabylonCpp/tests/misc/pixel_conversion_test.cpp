@@ -0,0 +1,202 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include <babylon/misc/pixel_conversion.h>
+
+namespace {
+
+uint32_t FloatBits(float value)
+{
+  uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+// Runs a conversion with the SIMD kernels and with the scalar ones
+template <typename T, typename Function>
+void ExpectSameAsScalar(size_t size, const Function& convert)
+{
+  using namespace BABYLON;
+
+  std::vector<T> simd(size), scalar(size);
+  convert(simd.data());
+  PixelConversion::SetSIMDEnabled(false);
+  convert(scalar.data());
+  PixelConversion::SetSIMDEnabled(true);
+  EXPECT_EQ(std::memcmp(simd.data(), scalar.data(), size * sizeof(T)), 0)
+    << PixelConversion::InstructionSets();
+}
+
+// Test pattern, used with sizes going through the scalar tail of the kernels
+std::vector<uint8_t> Bytes(size_t size)
+{
+  std::vector<uint8_t> bytes(size);
+  for (size_t i = 0; i < size; ++i) {
+    bytes[i] = static_cast<uint8_t>(i * 7 + i / 13);
+  }
+  return bytes;
+}
+
+} // end of anonymous namespace
+
+TEST(TestPixelConversion, HalfToFloat)
+{
+  using namespace BABYLON;
+
+  EXPECT_EQ(PixelConversion::HalfToFloat(0x3C00), 1.f);
+  EXPECT_EQ(PixelConversion::HalfToFloat(0xC000), -2.f);
+  EXPECT_EQ(PixelConversion::HalfToFloat(0x7BFF), 65504.f);
+  EXPECT_EQ(PixelConversion::HalfToFloat(0x0001), std::ldexp(1.f, -24));
+  EXPECT_EQ(PixelConversion::HalfToFloat(0x7C00), std::numeric_limits<float>::infinity());
+  EXPECT_EQ(PixelConversion::HalfToFloat(0xFC00), -std::numeric_limits<float>::infinity());
+  EXPECT_TRUE(std::isnan(PixelConversion::HalfToFloat(0x7E01)));
+
+  // Every half float, bit exact
+  std::vector<uint16_t> halves(65536 + 3);
+  for (size_t i = 0; i < halves.size(); ++i) {
+    halves[i] = static_cast<uint16_t>(i);
+  }
+  ExpectSameAsScalar<float>(halves.size(), [&](float* floats) {
+    PixelConversion::HalfToFloat(halves.data(), floats, halves.size());
+  });
+
+  // Round trip, the signaling NaNs become quiet
+  std::vector<float> floats(halves.size());
+  std::vector<uint16_t> roundTrip(halves.size());
+  PixelConversion::HalfToFloat(halves.data(), floats.data(), halves.size());
+  PixelConversion::FloatToHalf(floats.data(), roundTrip.data(), halves.size());
+  for (auto& half : halves) {
+    half = static_cast<uint16_t>(half | (((half & 0x7FFF) > 0x7C00) ? 0x200 : 0));
+  }
+  EXPECT_EQ(roundTrip, halves);
+}
+
+TEST(TestPixelConversion, FloatToHalf)
+{
+  using namespace BABYLON;
+
+  EXPECT_EQ(PixelConversion::FloatToHalf(1.f), 0x3C00);
+  EXPECT_EQ(PixelConversion::FloatToHalf(-0.f), 0x8000);
+  // Halfway cases are rounded to the nearest even
+  EXPECT_EQ(PixelConversion::FloatToHalf(1.f + std::ldexp(1.f, -11)), 0x3C00);
+  EXPECT_EQ(PixelConversion::FloatToHalf(1.f + 3.f * std::ldexp(1.f, -11)), 0x3C02);
+  EXPECT_EQ(PixelConversion::FloatToHalf(std::ldexp(1.f, -25)), 0x0000);
+  EXPECT_EQ(PixelConversion::FloatToHalf(std::ldexp(3.f, -25)), 0x0002);
+  EXPECT_EQ(PixelConversion::FloatToHalf(65519.f), 0x7BFF);
+  EXPECT_EQ(PixelConversion::FloatToHalf(65520.f), 0x7C00);
+  EXPECT_EQ(PixelConversion::FloatToHalf(-1e10f), 0xFC00);
+  EXPECT_EQ(PixelConversion::FloatToHalf(std::numeric_limits<float>::quiet_NaN()) & 0x7E00,
+            0x7E00);
+
+  // Floats spread over the whole range, bit exact
+  std::vector<float> floats;
+  for (uint32_t bits = 0; bits < 0xFFFFFFFFu - 40503u; bits += 40503u) {
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    floats.emplace_back(value);
+  }
+  ExpectSameAsScalar<uint16_t>(floats.size(), [&](uint16_t* halves) {
+    PixelConversion::FloatToHalf(floats.data(), halves, floats.size());
+  });
+}
+
+TEST(TestPixelConversion, ByteRange)
+{
+  using namespace BABYLON;
+
+  const std::vector<float> floats{-1.f, 0.f, 0.5f, 1.f, 2.f, std::nanf("")};
+  std::vector<float> result(floats.size());
+  PixelConversion::FloatToByteRange(floats.data(), result.data(), floats.size());
+  EXPECT_EQ(result, std::vector<float>({0.f, 0.f, 127.5f, 255.f, 255.f, 0.f}));
+
+  const std::vector<uint16_t> halves{0xBC00, 0x0000, 0x3800, 0x3C00, 0x4000, 0x7E00};
+  PixelConversion::HalfToByteRange(halves.data(), result.data(), halves.size());
+  EXPECT_EQ(result, std::vector<float>({0.f, 0.f, 127.5f, 255.f, 255.f, 0.f}));
+}
+
+TEST(TestPixelConversion, RGBEToFloat)
+{
+  using namespace BABYLON;
+
+  // Every exponent with various mantissas
+  const size_t count = 256 + 3;
+  auto red           = Bytes(count);
+  auto green         = Bytes(count + 1);
+  auto blue          = Bytes(count + 2);
+  std::vector<uint8_t> exponents(count);
+  for (size_t i = 0; i < count; ++i) {
+    exponents[i] = static_cast<uint8_t>(i);
+  }
+  std::vector<float> rgb(count * 3);
+  PixelConversion::RGBEToFloat(red.data(), green.data(), blue.data() + 2, exponents.data(),
+                               rgb.data(), count);
+  EXPECT_EQ(rgb[0], 0.f);
+  EXPECT_EQ(rgb[128 * 3], static_cast<float>(red[128]) / 256.f);
+  EXPECT_EQ(rgb[255 * 3 + 1], std::ldexp(static_cast<float>(green[255]), 119));
+  EXPECT_EQ(FloatBits(rgb[1 * 3 + 2]), FloatBits(std::ldexp(static_cast<float>(blue[3]), -135)));
+
+  ExpectSameAsScalar<float>(count * 3, [&](float* result) {
+    PixelConversion::RGBEToFloat(red.data(), green.data(), blue.data() + 2, exponents.data(),
+                                 result, count);
+  });
+}
+
+TEST(TestPixelConversion, FloatToRGBD)
+{
+  using namespace BABYLON;
+
+  // Colors in [0, 1] keep D = 1, brighter colors are scaled down
+  const std::vector<float> rgb{0.f, 0.f, 0.f, 1.f, 0.5f, 0.f, 4.f, 2.f, 1.f, 1000.f, 0.f, 0.f};
+  std::vector<uint8_t> rgbd(16);
+  PixelConversion::FloatToRGBD(rgb.data(), rgbd.data(), 4);
+  EXPECT_EQ(rgbd, std::vector<uint8_t>({0, 0, 0, 255,     //
+                                        255, 186, 0, 255,  //
+                                        254, 185, 135, 63, //
+                                        255, 0, 0, 1}));
+}
+
+TEST(TestPixelConversion, Swizzles)
+{
+  using namespace BABYLON;
+
+  // BGRA to RGBA
+  const std::vector<uint8_t> bgra{1, 2, 3, 4, 5, 6, 7, 8};
+  std::vector<uint8_t> rgba(8);
+  PixelConversion::SwizzleRGBA(bgra.data(), rgba.data(), 2, 2, 1, 0, 3);
+  EXPECT_EQ(rgba, std::vector<uint8_t>({3, 2, 1, 4, 7, 6, 5, 8}));
+
+  // BGR to RGBA
+  const std::vector<uint8_t> bgr{1, 2, 3, 4, 5, 6};
+  PixelConversion::RGBToRGBA(bgr.data(), rgba.data(), 2, 2, 1, 0);
+  EXPECT_EQ(rgba, std::vector<uint8_t>({3, 2, 1, 255, 6, 5, 4, 255}));
+
+  // Luminance and luminance alpha
+  const std::vector<uint8_t> luminance{9, 10};
+  PixelConversion::LuminanceToRGBA(luminance.data(), rgba.data(), 2);
+  EXPECT_EQ(rgba, std::vector<uint8_t>({9, 9, 9, 255, 10, 10, 10, 255}));
+  PixelConversion::LuminanceAlphaToRGBA(bgra.data(), rgba.data(), 2);
+  EXPECT_EQ(rgba, std::vector<uint8_t>({1, 1, 1, 2, 3, 3, 3, 4}));
+
+  // Same results as the scalar kernels
+  const size_t nbPixels = 101;
+  const auto source     = Bytes(nbPixels * 4);
+  ExpectSameAsScalar<uint8_t>(nbPixels * 4, [&](uint8_t* result) {
+    PixelConversion::SwizzleRGBA(source.data(), result, nbPixels, 3, 0, 2, 1);
+  });
+  ExpectSameAsScalar<uint8_t>(nbPixels * 3, [&](uint8_t* result) {
+    PixelConversion::SwizzleRGB(source.data(), result, nbPixels, 2, 0, 1);
+  });
+  ExpectSameAsScalar<uint8_t>(nbPixels * 4, [&](uint8_t* result) {
+    PixelConversion::RGBToRGBA(source.data(), result, nbPixels, 2, 1, 0);
+  });
+  ExpectSameAsScalar<uint8_t>(nbPixels * 4, [&](uint8_t* result) {
+    PixelConversion::LuminanceToRGBA(source.data(), result, nbPixels);
+  });
+  ExpectSameAsScalar<uint8_t>(nbPixels * 4, [&](uint8_t* result) {
+    PixelConversion::LuminanceAlphaToRGBA(source.data(), result, nbPixels);
+  });
+}
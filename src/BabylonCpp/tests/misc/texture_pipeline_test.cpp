@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+
+#include <babylon/misc/texture_pipeline.h>
+
+namespace {
+
+// Uncompressed 32 bits TGA image, rows stored from the top, pixels given as RGBA
+BABYLON::ArrayBuffer CreateTga(int width, int height, const std::vector<uint8_t>& rgba)
+{
+  BABYLON::ArrayBuffer tga(18, 0);
+  tga[2]  = 2; // uncompressed true color
+  tga[12] = static_cast<uint8_t>(width & 0xFF);
+  tga[13] = static_cast<uint8_t>(width >> 8);
+  tga[14] = static_cast<uint8_t>(height & 0xFF);
+  tga[15] = static_cast<uint8_t>(height >> 8);
+  tga[16] = 32;
+  tga[17] = 0x28; // top left origin, 8 alpha bits
+  for (size_t i = 0; i < rgba.size(); i += 4) {
+    tga.insert(tga.end(), {rgba[i + 2], rgba[i + 1], rgba[i], rgba[i + 3]});
+  }
+  return tga;
+}
+
+} // end of anonymous namespace
+
+TEST(TestTexturePipeline, DecodeAndUpload)
+{
+  using namespace BABYLON;
+
+  TexturePipeline pipeline(2);
+  pipeline.premultiplyAlpha = true;
+  pipeline.generateMipMaps  = true;
+
+  // 2x2 image: opaque red and half transparent white on the top row
+  const auto tga = CreateTga(2, 2, {255, 0, 0, 255, 255, 255, 255, 128, //
+                                    0, 0, 255, 255, 0, 0, 0, 0});
+  Image image;
+  std::vector<Image> mipMaps;
+  size_t nbErrors = 0;
+  pipeline.decodeAsync(
+    "image.tga", tga, true,
+    [&](const Image& img, const std::vector<Image>& levels) {
+      image   = img;
+      mipMaps = levels;
+    },
+    [&](const std::string& /*message*/, const std::string& /*exception*/) { ++nbErrors; });
+  std::vector<TextureLoadTiming> timings;
+  pipeline.onImageUploadedObservable.add(
+    [&](TextureLoadTiming* timing, EventState& /*es*/) { timings.emplace_back(*timing); });
+
+  pipeline.waitDecoding();
+  EXPECT_EQ(pipeline.pendingImages(), 1u);
+  // Nothing is uploaded before the engine asks for it
+  EXPECT_FALSE(image.valid());
+  EXPECT_EQ(pipeline.uploadDecodedImages(), 1u);
+  EXPECT_EQ(pipeline.pendingImages(), 0u);
+  EXPECT_EQ(nbErrors, 0u);
+
+  // Flipped vertically and premultiplied
+  ASSERT_EQ(image.width, 2);
+  ASSERT_EQ(image.height, 2);
+  const ArrayBuffer expected{0, 0, 255, 255, 0, 0, 0, 0, 255, 0, 0, 255, 128, 128, 128, 128};
+  EXPECT_EQ(image.data, expected);
+
+  // Single 1x1 level, average of the premultiplied pixels
+  ASSERT_EQ(mipMaps.size(), 1u);
+  EXPECT_EQ(mipMaps[0].width, 1);
+  EXPECT_EQ(mipMaps[0].height, 1);
+  EXPECT_EQ(mipMaps[0].data, ArrayBuffer({96, 32, 96, 160}));
+
+  ASSERT_EQ(timings.size(), 1u);
+  EXPECT_EQ(timings[0].url, "image.tga");
+  EXPECT_EQ(timings[0].width, 2);
+  EXPECT_GE(timings[0].decodeMs, 0.0);
+}
+
+TEST(TestTexturePipeline, DecodeError)
+{
+  using namespace BABYLON;
+
+  TexturePipeline pipeline(1);
+  size_t nbLoads = 0, nbErrors = 0;
+  pipeline.decodeAsync(
+    "invalid.png", ArrayBuffer(64, 7), false,
+    [&](const Image& /*img*/, const std::vector<Image>& /*levels*/) { ++nbLoads; },
+    [&](const std::string& /*message*/, const std::string& /*exception*/) { ++nbErrors; });
+  pipeline.waitDecoding();
+  pipeline.uploadDecodedImages();
+  EXPECT_EQ(nbLoads, 0u);
+  EXPECT_EQ(nbErrors, 1u);
+}
+
+TEST(TestTexturePipeline, UploadBudget)
+{
+  using namespace BABYLON;
+
+  TexturePipeline pipeline(2);
+  // At least one image is uploaded per frame, even without budget
+  pipeline.uploadBudget = 0.0;
+  size_t nbLoads        = 0;
+  const auto tga        = CreateTga(1, 1, {1, 2, 3, 4});
+  for (size_t i = 0; i < 3; ++i) {
+    pipeline.decodeAsync(
+      "image.tga", tga, false,
+      [&](const Image& /*img*/, const std::vector<Image>& /*levels*/) { ++nbLoads; }, nullptr);
+  }
+  pipeline.waitDecoding();
+  EXPECT_EQ(pipeline.uploadDecodedImages(), 1u);
+  EXPECT_EQ(pipeline.uploadDecodedImages(), 1u);
+  pipeline.uploadBudget = 1000.0;
+  EXPECT_EQ(pipeline.uploadDecodedImages(), 1u);
+  EXPECT_EQ(nbLoads, 3u);
+
+  // Cleared images are never uploaded
+  pipeline.decodeAsync("image.tga", tga, false, nullptr, nullptr);
+  pipeline.clear();
+  pipeline.waitDecoding();
+  EXPECT_EQ(pipeline.uploadDecodedImages(), 0u);
+}
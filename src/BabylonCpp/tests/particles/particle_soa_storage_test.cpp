@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "../test_utils.h"
+
+#include <babylon/engines/scene.h>
+#include <babylon/maths/color4.h>
+#include <babylon/particles/particle.h>
+#include <babylon/particles/particle_system.h>
+
+namespace {
+
+/**
+ * @brief Particle system whose particles only differ by their emission order, so that two systems
+ * with the same settings emit the same particles. The particle system is owned by the scene.
+ */
+BABYLON::ParticleSystem* CreateParticleSystem(BABYLON::Scene* scene, bool useGradients,
+                                              bool useStructureOfArrays)
+{
+  using namespace BABYLON;
+
+  auto particleSystem          = new ParticleSystem("particles", 64, scene);
+  particleSystem->emitter      = Vector3(0.f, 0.f, 0.f);
+  particleSystem->updateSpeed  = 1.f;
+  particleSystem->minLifeTime  = 10.f;
+  particleSystem->maxLifeTime  = 10.f;
+  particleSystem->minEmitPower = 1.f;
+  particleSystem->maxEmitPower = 1.f;
+  particleSystem->gravity      = Vector3(0.f, -0.01f, 0.f);
+  particleSystem->startPositionFunction
+    = [](const Matrix& /*worldMatrix*/, Vector3& positionToUpdate, Particle* /*particle*/) {
+        positionToUpdate.copyFromFloats(0.f, 1.f, 0.f);
+      };
+  particleSystem->startDirectionFunction
+    = [emitted = 0](const Matrix& /*worldMatrix*/, Vector3& directionToUpdate,
+                    Particle* /*particle*/) mutable {
+        directionToUpdate.copyFromFloats(1.f + 0.01f * static_cast<float>(emitted++), 0.5f, -0.25f);
+      };
+
+  if (useGradients) {
+    particleSystem->addColorGradient(0.f, Color4(1.f, 1.f, 1.f, 1.f));
+    particleSystem->addColorGradient(1.f, Color4(1.f, 0.f, 0.f, 0.f));
+    particleSystem->addSizeGradient(0.f, 1.f);
+    particleSystem->addSizeGradient(1.f, 0.1f);
+    particleSystem->addAngularSpeedGradient(0.f, 0.1f);
+    particleSystem->addAngularSpeedGradient(1.f, -0.1f);
+    particleSystem->addVelocityGradient(0.f, 1.f);
+    particleSystem->addVelocityGradient(1.f, 2.f);
+    particleSystem->addLimitVelocityGradient(0.f, 1.02f);
+    particleSystem->limitVelocityDamping = 0.9f;
+    particleSystem->addDragGradient(0.f, 0.f);
+    particleSystem->addDragGradient(1.f, 0.5f);
+  }
+  else {
+    particleSystem->color1          = Color4(1.f, 0.5f, 0.25f, 1.f);
+    particleSystem->color2          = Color4(1.f, 0.5f, 0.25f, 1.f);
+    particleSystem->colorDead       = Color4(0.f, 0.f, 0.2f, 0.f);
+    particleSystem->minSize         = 0.5f;
+    particleSystem->maxSize         = 0.5f;
+    particleSystem->minAngularSpeed = 0.05f;
+    particleSystem->maxAngularSpeed = 0.05f;
+  }
+  particleSystem->useStructureOfArrays = useStructureOfArrays;
+
+  return particleSystem;
+}
+
+/**
+ * @brief Emits particles for 30 frames, the first ones die after 10 frames.
+ */
+void Animate(BABYLON::ParticleSystem& particleSystem)
+{
+  particleSystem.start();
+  for (size_t frame = 0; frame < 30; ++frame) {
+    particleSystem.manualEmitCount = 4;
+    particleSystem.animate(true);
+  }
+}
+
+/**
+ * @brief Returns the particles sorted by age, then by emission order.
+ */
+std::vector<BABYLON::Particle*> SortedParticles(BABYLON::ParticleSystem& particleSystem)
+{
+  using namespace BABYLON;
+
+  auto particles = particleSystem.particles();
+  std::sort(particles.begin(), particles.end(), [](const Particle* a, const Particle* b) {
+    return a->age != b->age ? a->age < b->age : a->position.x < b->position.x;
+  });
+  return particles;
+}
+
+} // end of anonymous namespace
+
+TEST(TestParticleSoAStorage, MatchesTheDefaultUpdateFunction)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+
+  for (auto useGradients : {false, true}) {
+    auto particleSystem    = CreateParticleSystem(scene.get(), useGradients, false);
+    auto soaParticleSystem = CreateParticleSystem(scene.get(), useGradients, true);
+    Animate(*particleSystem);
+    Animate(*soaParticleSystem);
+
+    // The particle objects are only synchronized with the arrays when the storage is released
+    EXPECT_TRUE(soaParticleSystem->useStructureOfArrays());
+    soaParticleSystem->useStructureOfArrays = false;
+
+    // The dead particles are recycled the same way, only the order of the particles differs
+    const auto particles    = SortedParticles(*particleSystem);
+    const auto soaParticles = SortedParticles(*soaParticleSystem);
+    ASSERT_EQ(particles.size(), 40u);
+    ASSERT_EQ(soaParticles.size(), particles.size());
+
+    for (size_t index = 0; index < particles.size(); ++index) {
+      const auto& particle    = *particles[index];
+      const auto& soaParticle = *soaParticles[index];
+      EXPECT_LT(soaParticle.age, soaParticle.lifeTime);
+      EXPECT_FLOAT_EQ(soaParticle.age, particle.age);
+      EXPECT_TRUE(soaParticle.position.equalsWithEpsilon(particle.position, 1e-4f))
+        << "particle " << index << (useGradients ? " with gradients" : "");
+      EXPECT_TRUE(soaParticle.direction.equalsWithEpsilon(particle.direction, 1e-4f));
+      EXPECT_NEAR(soaParticle.color.r, particle.color.r, 1e-4f);
+      EXPECT_NEAR(soaParticle.color.g, particle.color.g, 1e-4f);
+      EXPECT_NEAR(soaParticle.color.b, particle.color.b, 1e-4f);
+      EXPECT_NEAR(soaParticle.color.a, particle.color.a, 1e-4f);
+      EXPECT_NEAR(soaParticle.size, particle.size, 1e-4f);
+      EXPECT_NEAR(soaParticle.angle, particle.angle, 1e-4f);
+    }
+  }
+}
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+
+#include <babylon/engines/scene.h>
+#include <babylon/materials/textures/texture.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/particles/particle.h>
+#include <babylon/particles/particle_system.h>
+
+namespace {
+
+/**
+ * @brief Particle system emitting particles moving along the x axis from the origin, owned by the
+ * scene.
+ */
+BABYLON::ParticleSystem* CreateParticleSystem(BABYLON::Scene* scene)
+{
+  using namespace BABYLON;
+
+  auto particleSystem          = new ParticleSystem("particles", 16, scene);
+  particleSystem->emitter      = Vector3(0.f, 0.f, 0.f);
+  particleSystem->updateSpeed  = 1.f;
+  particleSystem->minLifeTime  = 10.f;
+  particleSystem->maxLifeTime  = 10.f;
+  particleSystem->minEmitPower = 1.f;
+  particleSystem->maxEmitPower = 1.f;
+  particleSystem->gravity      = Vector3(0.f, 0.f, 0.f);
+  particleSystem->startPositionFunction
+    = [](const Matrix& /*worldMatrix*/, Vector3& positionToUpdate, Particle* /*particle*/) {
+        positionToUpdate.copyFromFloats(0.f, 0.f, 0.f);
+      };
+  particleSystem->startDirectionFunction
+    = [](const Matrix& /*worldMatrix*/, Vector3& directionToUpdate, Particle* /*particle*/) {
+        directionToUpdate.copyFromFloats(1.f, 0.f, 0.f);
+      };
+
+  return particleSystem;
+}
+
+} // end of anonymous namespace
+
+TEST(TestParticleSystem, SpawnWithoutGradients)
+{
+  using namespace BABYLON;
+
+  auto engine         = createSubject();
+  auto scene          = Scene::New(engine.get());
+  auto particleSystem = CreateParticleSystem(scene.get());
+
+  // The size and the angular speed are picked in their ranges
+  particleSystem->minSize         = 0.3f;
+  particleSystem->maxSize         = 0.3f;
+  particleSystem->minAngularSpeed = 0.1f;
+  particleSystem->maxAngularSpeed = 0.1f;
+  particleSystem->start();
+  particleSystem->manualEmitCount = 1;
+  particleSystem->animate(true);
+
+  ASSERT_EQ(particleSystem->particles().size(), 1u);
+  const auto& particle = *particleSystem->particles().front();
+  EXPECT_FLOAT_EQ(particle.size, 0.3f);
+  EXPECT_FLOAT_EQ(particle.angularSpeed, 0.1f);
+
+  // Without drag, the particle moves by its full direction
+  particleSystem->animate(true);
+  EXPECT_FLOAT_EQ(particle.position.x, 1.f);
+  EXPECT_FLOAT_EQ(particle.angle, 0.1f);
+}
+
+TEST(TestParticleSystem, SpawnWithGradients)
+{
+  using namespace BABYLON;
+
+  auto engine         = createSubject();
+  auto scene          = Scene::New(engine.get());
+  auto particleSystem = CreateParticleSystem(scene.get());
+
+  // The size and the angular speed start at the factor of the first gradient
+  particleSystem->minSize = 0.3f;
+  particleSystem->maxSize = 0.3f;
+  particleSystem->addSizeGradient(0.f, 2.f);
+  particleSystem->addSizeGradient(1.f, 0.5f);
+  particleSystem->addAngularSpeedGradient(0.f, 0.2f);
+  particleSystem->addDragGradient(0.f, 0.5f);
+  particleSystem->addDragGradient(1.f, 0.9f);
+  particleSystem->start();
+  particleSystem->manualEmitCount = 1;
+  particleSystem->animate(true);
+
+  ASSERT_EQ(particleSystem->particles().size(), 1u);
+  const auto& particle = *particleSystem->particles().front();
+  EXPECT_FLOAT_EQ(particle.size, 2.f);
+  EXPECT_FLOAT_EQ(particle.angularSpeed, 0.2f);
+
+  // The drag is interpolated from the first gradient
+  particleSystem->animate(true);
+  EXPECT_FLOAT_EQ(particle.position.x, 1.f - (0.5f + (0.9f - 0.5f) * 0.1f));
+  EXPECT_FLOAT_EQ(particle.angle, 0.2f);
+  EXPECT_FLOAT_EQ(particle.size, 2.f + (0.5f - 2.f) * 0.1f);
+}
+
+TEST(TestParticleSystem, IsReady)
+{
+  using namespace BABYLON;
+
+  auto engine         = createSubject();
+  auto scene          = Scene::New(engine.get());
+  auto particleSystem = CreateParticleSystem(scene.get());
+  EXPECT_FALSE(particleSystem->isReady());
+
+  particleSystem->particleTexture = Texture::New("flare.png", scene.get());
+
+  // The emitter can be a position or a mesh, but not an empty mesh
+  EXPECT_TRUE(particleSystem->isReady());
+  particleSystem->emitter = Mesh::CreateBox("box", 1.f, scene.get());
+  EXPECT_TRUE(particleSystem->isReady());
+  particleSystem->emitter = AbstractMeshPtr{nullptr};
+  EXPECT_FALSE(particleSystem->isReady());
+}
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <babylon/maths/vector3.h>
+#include <babylon/misc/job_pool.h>
+#include <babylon/physics/plugins/native_physics_world.h>
+
+namespace {
+
+std::vector<BABYLON::NativePhysicsBody*> CreateStack(BABYLON::NativePhysicsWorld& world,
+                                                     size_t height)
+{
+  using namespace BABYLON;
+
+  world.createBody(NativePhysicsShape::CreateBox(Vector3(10.f, 0.5f, 10.f)), 0.f,
+                   Vector3(0.f, -0.5f, 0.f));
+  const auto box = NativePhysicsShape::CreateBox(Vector3(0.5f, 0.5f, 0.5f));
+  std::vector<NativePhysicsBody*> stack;
+  for (size_t i = 0; i < height; ++i) {
+    stack.emplace_back(
+      world.createBody(box, 1.f, Vector3(0.f, 0.5f + static_cast<float>(i), 0.f)));
+  }
+  return stack;
+}
+
+} // end of anonymous namespace
+
+TEST(TestNativePhysicsWorld, BodiesFallAsleepOnTheGround)
+{
+  using namespace BABYLON;
+
+  JobPool jobPool(0);
+  NativePhysicsWorld world(&jobPool);
+  world.createBody(NativePhysicsShape::CreateBox(Vector3(10.f, 0.5f, 10.f)), 0.f,
+                   Vector3(0.f, -0.5f, 0.f));
+  auto sphere
+    = world.createBody(NativePhysicsShape::CreateSphere(0.5f), 1.f, Vector3(-2.f, 2.f, 0.f));
+  auto capsule = world.createBody(NativePhysicsShape::CreateCapsule(0.25f, 0.5f), 1.f,
+                                  Vector3(2.f, 2.f, 0.f));
+  auto box     = world.createBody(NativePhysicsShape::CreateBox(Vector3(0.5f, 0.5f, 0.5f)), 1.f,
+                                  Vector3(0.f, 2.f, 0.f));
+
+  for (size_t i = 0; i < 240; ++i) {
+    world.step(1.f / 60.f);
+  }
+
+  EXPECT_NEAR(sphere->position().y, 0.5f, 0.02f);
+  EXPECT_NEAR(box->position().y, 0.5f, 0.02f);
+  // Standing on one of its caps
+  EXPECT_NEAR(capsule->position().y, 0.75f, 0.02f);
+  EXPECT_EQ(world.awakeBodyCount(), 0ull);
+
+  // Moving a body wakes it up
+  box->setLinearVelocity(Vector3(0.f, 2.f, 0.f));
+  world.step(1.f / 60.f);
+  EXPECT_FALSE(box->sleeping());
+}
+
+TEST(TestNativePhysicsWorld, StableStack)
+{
+  using namespace BABYLON;
+
+  // The serial and the parallel solvers keep the stack standing
+  for (size_t nbWorkers : {0ull, 4ull}) {
+    JobPool jobPool(nbWorkers);
+    NativePhysicsWorld world(&jobPool);
+    const auto stack = CreateStack(world, 8);
+    for (size_t i = 0; i < 300; ++i) {
+      world.step(1.f / 60.f);
+    }
+    for (size_t i = 0; i < stack.size(); ++i) {
+      EXPECT_NEAR(stack[i]->position().x, 0.f, 0.05f);
+      EXPECT_NEAR(stack[i]->position().y, 0.5f + static_cast<float>(i), 0.05f);
+    }
+  }
+}
+
+TEST(TestNativePhysicsWorld, Raycast)
+{
+  using namespace BABYLON;
+
+  NativePhysicsWorld world;
+  const auto stack = CreateStack(world, 3);
+
+  auto hit = world.raycast(Vector3(-5.f, 1.5f, 0.f), Vector3(5.f, 1.5f, 0.f));
+  ASSERT_TRUE(hit.has_value());
+  EXPECT_EQ(hit->body, stack[1]);
+  EXPECT_NEAR(hit->distance, 4.5f, 1e-4f);
+  EXPECT_NEAR(hit->normal.x, -1.f, 1e-4f);
+
+  // A triangle mesh ground
+  NativePhysicsWorld meshWorld;
+  const std::vector<Vector3> positions{Vector3(-10.f, 0.f, -10.f), Vector3(10.f, 0.f, -10.f),
+                                       Vector3(10.f, 0.f, 10.f), Vector3(-10.f, 0.f, 10.f)};
+  auto ground
+    = meshWorld.createBody(NativePhysicsShape::CreateMesh(positions, {0, 2, 1, 0, 3, 2}), 0.f);
+  hit = meshWorld.raycast(Vector3(1.f, 5.f, 1.f), Vector3(1.f, -5.f, 1.f));
+  ASSERT_TRUE(hit.has_value());
+  EXPECT_EQ(hit->body, ground);
+  EXPECT_NEAR(hit->point.y, 0.f, 1e-4f);
+  EXPECT_NEAR(hit->normal.y, 1.f, 1e-4f);
+  EXPECT_FALSE(meshWorld.raycast(Vector3(11.f, 5.f, 1.f), Vector3(11.f, -5.f, 1.f)).has_value());
+
+  // A sphere falling on the mesh ground
+  auto sphere = meshWorld.createBody(NativePhysicsShape::CreateSphere(0.5f), 1.f,
+                                     Vector3(1.f, 2.f, 1.f));
+  for (size_t i = 0; i < 120; ++i) {
+    meshWorld.step(1.f / 60.f);
+  }
+  EXPECT_NEAR(sphere->position().y, 0.5f, 0.02f);
+}
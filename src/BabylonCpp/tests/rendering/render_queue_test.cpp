@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <utility>
+
+#include <babylon/rendering/render_queue.h>
+
+namespace {
+
+// Fills the queue with random keys and returns the expected (stable) order
+std::vector<std::pair<uint64_t, BABYLON::SubMesh*>>
+FillQueue(BABYLON::RenderQueue& queue, std::vector<int>& storage, size_t count)
+{
+  using namespace BABYLON;
+
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<size_t> ids(0, 7);
+  std::uniform_real_distribution<float> depths(0.f, 1.f);
+  storage.resize(count);
+  std::vector<std::pair<uint64_t, SubMesh*>> expected;
+  queue.clear();
+  for (size_t i = 0; i < count; ++i) {
+    // Few distinct states and depths, so that the keys have duplicates
+    const auto key = RenderQueue::OpaqueSortKey(static_cast<uint8_t>(ids(generator) % 2),
+                                                ids(generator), ids(generator), ids(generator),
+                                                std::floor(depths(generator) * 4.f) / 4.f);
+    auto* subMesh  = reinterpret_cast<SubMesh*>(&storage[i]);
+    queue.add(key, subMesh);
+    expected.emplace_back(key, subMesh);
+  }
+  std::stable_sort(expected.begin(), expected.end(),
+                   [](const auto& a, const auto& b) { return a.first < b.first; });
+  return expected;
+}
+
+} // end of anonymous namespace
+
+TEST(TestRenderQueue, SortIsStable)
+{
+  using namespace BABYLON;
+
+  RenderQueue queue;
+  std::vector<int> storage;
+  // Insertion sort, then radix sort, reusing the buffers
+  for (const size_t count : std::vector<size_t>{1, 10, 64, 65, 5000, 30}) {
+    const auto expected = FillQueue(queue, storage, count);
+    queue.sort();
+    ASSERT_EQ(queue.size(), count);
+    for (size_t i = 0; i < count; ++i) {
+      EXPECT_EQ(queue.keys()[i], expected[i].first);
+      EXPECT_EQ(queue.subMeshes()[i], expected[i].second);
+    }
+  }
+}
+
+TEST(TestRenderQueue, SortKeys)
+{
+  using namespace BABYLON;
+
+  // The layer comes first, then the effect, the material, the geometry and the depth
+  EXPECT_LT(RenderQueue::OpaqueSortKey(0, 9, 9, 9, 1.f),
+            RenderQueue::OpaqueSortKey(1, 0, 0, 0, 0.f));
+  EXPECT_LT(RenderQueue::OpaqueSortKey(0, 1, 9, 9, 1.f),
+            RenderQueue::OpaqueSortKey(0, 2, 0, 0, 0.f));
+  EXPECT_LT(RenderQueue::OpaqueSortKey(0, 1, 1, 9, 1.f),
+            RenderQueue::OpaqueSortKey(0, 1, 2, 0, 0.f));
+  EXPECT_LT(RenderQueue::OpaqueSortKey(0, 1, 1, 1, 1.f),
+            RenderQueue::OpaqueSortKey(0, 1, 1, 2, 0.f));
+  EXPECT_LT(RenderQueue::OpaqueSortKey(0, 1, 1, 1, 0.2f),
+            RenderQueue::OpaqueSortKey(0, 1, 1, 1, 0.8f));
+
+  // Transparent submeshes are rendered back to front in each layer
+  EXPECT_LT(RenderQueue::TransparentSortKey(0, 0.8f, 9, 9),
+            RenderQueue::TransparentSortKey(0, 0.2f, 0, 0));
+  EXPECT_LT(RenderQueue::TransparentSortKey(0, 0.2f, 9, 9),
+            RenderQueue::TransparentSortKey(1, 0.8f, 0, 0));
+}
+
+TEST(TestRenderQueue, CountStateChanges)
+{
+  using namespace BABYLON;
+
+  const std::vector<uint64_t> keys{
+    RenderQueue::OpaqueSortKey(0, 1, 1, 1, 0.1f), // first state
+    RenderQueue::OpaqueSortKey(0, 1, 1, 1, 0.5f), // depth only
+    RenderQueue::OpaqueSortKey(1, 1, 1, 1, 0.5f), // layer only
+    RenderQueue::OpaqueSortKey(1, 1, 1, 2, 0.5f), // geometry
+    RenderQueue::OpaqueSortKey(1, 1, 2, 2, 0.5f), // material
+    RenderQueue::OpaqueSortKey(1, 2, 3, 3, 0.5f), // effect, material and geometry
+  };
+  EXPECT_EQ(RenderQueue::CountStateChanges(keys.data(), keys.size()), size_t{5});
+  EXPECT_EQ(RenderQueue::CountStateChanges(keys.data(), 1), size_t{0});
+}
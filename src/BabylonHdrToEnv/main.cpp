@@ -0,0 +1,163 @@
+// Converts the Radiance .hdr panoramas of a directory to prefiltered .env environment textures.
+//
+// Usage: BabylonHdrToEnv <input directory> [output directory] [--size <face size>]
+//
+// Each panorama is projected on a cube map, the mip chain is prefiltered on the CPU by the
+// PMREMGenerator (Phong lobe, as the HDRCubeTexture used to do) and the faces are stored as RGBD
+// encoded PNG images next to the irradiance spherical polynomial.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <stb_image/stb_image_write.h>
+
+#include <babylon/core/filesystem.h>
+#include <babylon/maths/spherical_polynomial.h>
+#include <babylon/misc/environment_texture_tools.h>
+#include <babylon/misc/highdynamicrange/cube_map_to_spherical_polynomial_tools.h>
+#include <babylon/misc/highdynamicrange/hdr_tools.h>
+#include <babylon/misc/highdynamicrange/pmrem_generator.h>
+#include <babylon/misc/job_pool.h>
+#include <babylon/misc/pixel_conversion.h>
+
+namespace {
+
+using namespace BABYLON;
+
+// Cube map faces in the X+ X- Y+ Y- Z+ Z- order
+const std::vector<std::string> FacesMapping{"right", "left", "up", "down", "front", "back"};
+
+// Same parameters as the HDRCubeTexture prefiltering
+constexpr float SpecularPower         = 2048.f;
+constexpr float CosinePowerDropPerMip = 0.25f;
+
+void PrintUsage()
+{
+  std::cout << "Usage: BabylonHdrToEnv <input directory> [output directory] [--size <face size>]"
+            << std::endl
+            << "Converts every .hdr panorama of the input directory to a prefiltered .env file."
+            << std::endl
+            << "The face size must be a power of two (256 by default)." << std::endl;
+}
+
+void WritePng(void* context, void* data, int size)
+{
+  auto* png        = static_cast<ArrayBuffer*>(context);
+  const auto* file = static_cast<const uint8_t*>(data);
+  png->insert(png->end(), file, file + size);
+}
+
+ArrayBuffer ConvertHdrToEnv(const ArrayBuffer& hdr, size_t size)
+{
+  // Panorama to cube map and irradiance
+  const auto cubeMapInfo = HDRTools::GetCubeMapTextureData(hdr, size);
+  const auto sphericalPolynomial
+    = CubeMapToSphericalPolynomialTools::ConvertCubeMapToSphericalPolynomial(cubeMapInfo);
+  std::vector<Float32Array> faces;
+  for (const auto& face : FacesMapping) {
+    faces.emplace_back(cubeMapInfo[face].float32Array());
+  }
+
+  // Prefiltered mip chain, down to 1x1 faces
+  PMREMGenerator<Float32Array> generator(faces, static_cast<int>(size), static_cast<int>(size),
+                                         0, 3, true, SpecularPower, CosinePowerDropPerMip, false,
+                                         true);
+  const auto& mipmaps = generator.filterCubeMap();
+
+  // RGBD encoded PNG images
+  std::vector<std::vector<ArrayBuffer>> imageData(mipmaps.size(), std::vector<ArrayBuffer>(6));
+  JobPool::Default().parallelFor(mipmaps.size() * 6, 1, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      const auto level    = i / 6;
+      const auto face     = i % 6;
+      const auto mipSize  = static_cast<int>(size >> level);
+      const auto nbPixels = static_cast<size_t>(mipSize * mipSize);
+      ArrayBuffer rgbd(nbPixels * 4);
+      PixelConversion::FloatToRGBD(mipmaps[level][face].data(), rgbd.data(), nbPixels);
+      stbi_write_png_to_func(WritePng, &imageData[level][face], mipSize, mipSize, 4, rgbd.data(),
+                             mipSize * 4);
+    }
+  });
+
+  return EnvironmentTextureTools::CreateEnvArrayBuffer(imageData, static_cast<int>(size),
+                                                       sphericalPolynomial.get());
+}
+
+} // end of anonymous namespace
+
+int main(int argc, char** argv)
+{
+  std::vector<std::string> paths;
+  size_t size = 256;
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+    if (arg == "--size" && i + 1 < argc) {
+      size = static_cast<size_t>(std::strtoul(argv[++i], nullptr, 10));
+    }
+    else if (arg == "-h" || arg == "--help") {
+      PrintUsage();
+      return EXIT_SUCCESS;
+    }
+    else {
+      paths.emplace_back(arg);
+    }
+  }
+
+  if (paths.empty() || paths.size() > 2 || size == 0 || (size & (size - 1)) != 0) {
+    PrintUsage();
+    return EXIT_FAILURE;
+  }
+
+  namespace fs = std::filesystem;
+
+  const fs::path inputDirectory  = paths[0];
+  const fs::path outputDirectory = paths.size() > 1 ? fs::path(paths[1]) : inputDirectory;
+  std::error_code error;
+  if (!fs::is_directory(inputDirectory, error)) {
+    std::cerr << inputDirectory.string() << " is not a directory" << std::endl;
+    return EXIT_FAILURE;
+  }
+  fs::create_directories(outputDirectory, error);
+
+  // Sorted list of the panoramas
+  std::vector<fs::path> hdrFiles;
+  for (const auto& entry : fs::directory_iterator(inputDirectory, error)) {
+    auto extension = entry.path().extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+    if (entry.is_regular_file() && extension == ".hdr") {
+      hdrFiles.emplace_back(entry.path());
+    }
+  }
+  std::sort(hdrFiles.begin(), hdrFiles.end());
+
+  int nbErrors = 0;
+  for (const auto& hdrFile : hdrFiles) {
+    const auto envFile = (outputDirectory / hdrFile.stem()).string() + ".env";
+    const auto start   = std::chrono::steady_clock::now();
+    try {
+      const auto hdr = Filesystem::readBinaryFile(hdrFile.string().c_str());
+      const auto env = ConvertHdrToEnv(hdr, size);
+      if (!Filesystem::writeBinaryFile(envFile.c_str(), env)) {
+        throw std::runtime_error("cannot write " + envFile);
+      }
+    }
+    catch (const std::exception& e) {
+      std::cerr << hdrFile.string() << ": " << e.what() << std::endl;
+      ++nbErrors;
+      continue;
+    }
+    const auto ms
+      = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+          .count();
+    std::cout << hdrFile.string() << " -> " << envFile << " (" << static_cast<int>(ms) << " ms)"
+              << std::endl;
+  }
+
+  return nbErrors == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -39,6 +39,7 @@ public:
   void bufferData(GLenum target, const Int32Array& data, GLenum usage) override;
   void bufferData(GLenum target, const Uint16Array& data, GLenum usage) override;
   void bufferData(GLenum target, const Uint32Array& data, GLenum usage) override;
+  void bufferData(GLenum target, const ArrayBufferView& data, GLenum usage) override;
   void bufferSubData(GLenum target, GLintptr offset, const Uint8Array& data) override;
   void bufferSubData(GLenum target, GLintptr offset, const Float32Array& data) override;
   void bufferSubData(GLenum target, GLintptr offset, Int32Array& data) override;
@@ -127,6 +128,7 @@ public:
   const char* getErrorString(GLenum err) override;
   GLint getProgramParameter(IGLProgram* program, GLenum pname) override;
   std::string getProgramInfoLog(IGLProgram* program) override;
+  Uint8Array getProgramBinary(IGLProgram* program, GLenum& binaryFormat) override;
   GLint getRenderbufferParameter(GLenum target, GLenum pname) override;
   std::string getShaderInfoLog(IGLShader* shader) override;
   GLint getShaderParameter(IGLShader* shader, GLenum pname) override;
@@ -148,6 +150,8 @@ public:
   bool linkProgram(IGLProgram* program) override;
   void pixelStorei(GLenum pname, GLint param) override;
   void polygonOffset(GLfloat factor, GLfloat units) override;
+  bool programBinary(IGLProgram* program, GLenum binaryFormat, const Uint8Array& binary) override;
+  void programParameteri(IGLProgram* program, GLenum pname, GLint value) override;
   void readBuffer(GLenum src) override;
   void readPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type,
                   Float32Array& pixels) override;
@@ -2,6 +2,8 @@
 
 #include <array>
 
+#include <babylon/core/array_buffer_view.h>
+
 // glad
 // GLAD_DEBUG  enables to debug all the OpenGl calls (calls GlGetError at each
 // step) in order to use this, you need to replace the folder external/glad/
@@ -312,6 +314,11 @@ void GLRenderingContext::bufferData(GLenum target, const Uint32Array& data, GLen
   glBufferData(target, static_cast<GLint>(data.size() * sizeof(uint32_t)), data.data(), usage);
 }
 
+void GLRenderingContext::bufferData(GLenum target, const ArrayBufferView& data, GLenum usage)
+{
+  glBufferData(target, static_cast<GLint>(data.byteLength()), data.data(), usage);
+}
+
 void GLRenderingContext::bufferSubData(GLenum target, GLintptr offset, const Uint8Array& data)
 {
   glBufferSubData(target, offset, static_cast<GLint>(data.size() * sizeof(GLbyte)), data.data());
@@ -781,6 +788,25 @@ std::string GLRenderingContext::getProgramInfoLog(IGLProgram* program)
   return result;
 }
 
+Uint8Array GLRenderingContext::getProgramBinary(IGLProgram* program, GLenum& binaryFormat)
+{
+  Uint8Array binary;
+  if (!glGetProgramBinary) {
+    return binary;
+  }
+
+  GLint length = 0;
+  glGetProgramiv(program->value, GL_PROGRAM_BINARY_LENGTH, &length);
+  if (length > 0) {
+    binary.resize(static_cast<size_t>(length));
+    GLsizei writtenLength = 0;
+    glGetProgramBinary(program->value, length, &writtenLength, &binaryFormat, binary.data());
+    binary.resize(static_cast<size_t>(writtenLength));
+  }
+
+  return binary;
+}
+
 GLint GLRenderingContext::getRenderbufferParameter(GLenum target, GLenum pname)
 {
   GLint params;
@@ -910,6 +936,30 @@ void GLRenderingContext::polygonOffset(GLfloat factor, GLfloat units)
   glPolygonOffset(factor, units);
 }
 
+bool GLRenderingContext::programBinary(IGLProgram* program, GLenum binaryFormat,
+                                       const Uint8Array& binary)
+{
+  if (!glProgramBinary || binary.empty()) {
+    return false;
+  }
+
+  glProgramBinary(program->value, binaryFormat, binary.data(),
+                  static_cast<GLsizei>(binary.size()));
+
+  // Test linker result, the binary is rejected when the driver changed.
+  GLint linkSucceed = GL_FALSE;
+  glGetProgramiv(program->value, GL_LINK_STATUS, &linkSucceed);
+
+  return linkSucceed != GL_FALSE;
+}
+
+void GLRenderingContext::programParameteri(IGLProgram* program, GLenum pname, GLint value)
+{
+  if (glProgramParameteri) {
+    glProgramParameteri(program->value, pname, value);
+  }
+}
+
 void GLRenderingContext::readBuffer(GLenum src)
 {
   glReadBuffer(src);
@@ -245,7 +245,7 @@ private:
   void _validateAsync(Scene* scene, const std::string& json, const std::string& rootUrl,
                       const std::string& fileName = "");
   IGLTFLoaderPtr _getLoader(const IGLTFLoaderData& loaderData);
-  UnpackedBinary _unpackBinary(const ArrayBuffer& data);
+  UnpackedBinary _unpackBinary(const MappedArrayBuffer& data);
   UnpackedBinary _unpackBinaryV1(BinaryReader& binaryReader) const;
   UnpackedBinary _unpackBinaryV2(BinaryReader& binaryReader) const;
   static std::optional<Version> _parseVersion(const std::string& version);
@@ -337,6 +337,14 @@ public:
    */
   bool transparencyAsCoverage;
 
+  /**
+   * Defines if the binary asset (.glb) and the external binary buffers (.bin)
+   * referenced by the asset should be memory mapped instead of read into
+   * memory. Buffer views and static vertex buffers then reference the mapped
+   * files without copies. Defaults to false.
+   */
+  bool useMemoryMappedBuffers;
+
   /**
    * Function called before loading a url referenced by the asset.
    */
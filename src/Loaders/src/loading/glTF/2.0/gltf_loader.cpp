@@ -10,6 +10,7 @@
 #include <babylon/cameras/camera.h>
 #include <babylon/cameras/free_camera.h>
 #include <babylon/core/logging.h>
+#include <babylon/core/mapped_array_buffer.h>
 #include <babylon/core/time.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
@@ -243,9 +244,9 @@ void GLTFLoader::_loadData(const IGLTFLoaderData& data)
   _setupData();
 
   if (data.bin.has_value()) {
-    const auto& buffers = _gltf->buffers;
-    if (!buffers.empty() && !buffers[0].uri.empty()) {
-      const auto& binaryBuffer = buffers[0];
+    auto& buffers = _gltf->buffers;
+    if (!buffers.empty() && buffers[0].uri.empty()) {
+      auto& binaryBuffer = buffers[0];
       if (binaryBuffer.byteLength < data.bin->byteLength() - 3
           || binaryBuffer.byteLength > data.bin->byteLength()) {
         BABYLON_LOGF_WARN("GLTFLoader",
@@ -254,7 +255,7 @@ void GLTFLoader::_loadData(const IGLTFLoaderData& data)
                           binaryBuffer.byteLength, data.bin->byteLength())
       }
 
-      // binaryBuffer._data = data.bin;
+      binaryBuffer._data = *data.bin;
     }
     else {
       BABYLON_LOG_WARN("GLTFLoader", "Unexpected BIN chunk")
@@ -1392,13 +1393,13 @@ ArrayBufferView& GLTFLoader::loadBufferViewAsync(const std::string& context,
 
   auto& buffer = ArrayItem::Get(StringTools::printf("%s/buffer", context.c_str()), _gltf->buffers,
                                 bufferView.buffer);
-  const auto data = _loadBufferAsync(StringTools::printf("/buffers/%ld", buffer.index), buffer);
+  const auto& data = _loadBufferAsync(StringTools::printf("/buffers/%ld", buffer.index), buffer);
 
   // ASYNC_FIXME: We cannot treat the data right now, it will be otained later!
   try {
-    bufferView._data = stl_util::to_array<uint8_t>(
-      data.uint8Array(), data.byteOffset + (bufferView.byteOffset.value_or(0)),
-      bufferView.byteLength);
+    // Shares the buffer storage when it is memory mapped
+    bufferView._data = data.subView(data.byteOffset + (bufferView.byteOffset.value_or(0)),
+                                    bufferView.byteLength);
   }
   catch (const std::exception& e) {
     throw std::runtime_error(StringTools::printf("%s: %s", context.c_str(), e.what()));
@@ -1556,8 +1557,7 @@ BufferPtr GLTFLoader::_loadVertexBufferViewAsync(IBufferView& bufferView,
 
   auto data
     = loadBufferViewAsync(StringTools::printf("/bufferViews/%ld", bufferView.index), bufferView);
-  bufferView._babylonBuffer
-    = std::make_shared<Buffer>(_babylonScene->getEngine(), data.float32Array(), false);
+  bufferView._babylonBuffer = std::make_shared<Buffer>(_babylonScene->getEngine(), data, false);
 
   return bufferView._babylonBuffer;
 }
@@ -2057,8 +2057,22 @@ ArrayBufferView GLTFLoader::loadUriAsync(const std::string& context, const std::
 
   log(StringTools::printf("Loading %s", uri.c_str()));
 
-  ArrayBuffer data;
   auto url = _parent.preprocessUrlAsync(_rootUrl + uri);
+  if (_parent.useMemoryMappedBuffers) {
+    MappedArrayBuffer mappedData;
+    if (!_disposed) {
+      mappedData = MappedArrayBuffer::FromFile(FileTools::PreprocessUrl(url));
+      if (mappedData) {
+        log(StringTools::printf("Mapped %s (%ld bytes)", uri.c_str(), mappedData.byteLength()));
+      }
+      else {
+        log(StringTools::printf("%s: Failed to map (%s)", context.c_str(), uri.c_str()));
+      }
+    }
+    return mappedData;
+  }
+
+  ArrayBuffer data;
   if (!_disposed) {
     FileTools::LoadFile(
       url,
@@ -2180,23 +2194,23 @@ ArrayBufferView GLTFLoader::_GetTypedArray(const std::string& context,
                                            const ArrayBufferView& bufferView,
                                            std::optional<size_t> byteOffset, size_t length)
 {
-  const auto& buffer = bufferView.uint8Array();
-  byteOffset         = bufferView.byteOffset + byteOffset.value_or(0);
+  byteOffset = bufferView.byteOffset + byteOffset.value_or(0);
 
   try {
+    // Only the accessed range is copied, not the whole buffer view
     switch (componentType) {
       case IGLTF2::AccessorComponentType::BYTE:
-        return stl_util::to_array<int8_t>(buffer, *byteOffset, length);
+        return bufferView.typedArray<int8_t>(*byteOffset, length);
       case IGLTF2::AccessorComponentType::UNSIGNED_BYTE:
-        return stl_util::to_array<uint8_t>(buffer, *byteOffset, length);
+        return bufferView.typedArray<uint8_t>(*byteOffset, length);
       case IGLTF2::AccessorComponentType::SHORT:
-        return stl_util::to_array<uint16_t>(buffer, *byteOffset, length);
+        return bufferView.typedArray<uint16_t>(*byteOffset, length);
       case IGLTF2::AccessorComponentType::UNSIGNED_SHORT:
-        return stl_util::to_array<uint16_t>(buffer, *byteOffset, length);
+        return bufferView.typedArray<uint16_t>(*byteOffset, length);
       case IGLTF2::AccessorComponentType::UNSIGNED_INT:
-        return stl_util::to_array<uint32_t>(buffer, *byteOffset, length);
+        return bufferView.typedArray<uint32_t>(*byteOffset, length);
       case IGLTF2::AccessorComponentType::FLOAT:
-        return stl_util::to_array<float_t>(buffer, *byteOffset, length);
+        return bufferView.typedArray<float_t>(*byteOffset, length);
       default:
         throw std::runtime_error(
           StringTools::printf("Invalid component type %d", static_cast<int>(componentType)));
@@ -1,14 +1,10 @@
 #include <babylon/loading/glTF/binary_reader.h>
 
-#include <babylon/babylon_stl_util.h>
-
 namespace BABYLON {
 namespace GLTF2 {
 
-BinaryReader::BinaryReader(const ArrayBuffer& arrayBuffer)
-    : _arrayBuffer{arrayBuffer}
-    , _dataView{DataView(arrayBuffer)}
-    , _byteOffset{0}
+BinaryReader::BinaryReader(const MappedArrayBuffer& mappedArrayBuffer)
+    : _arrayBuffer{mappedArrayBuffer}, _byteOffset{0}
 {
 }
 
@@ -21,20 +17,30 @@ size_t BinaryReader::getPosition() const
 
 size_t BinaryReader::getLength() const
 {
-  return _arrayBuffer.size();
+  return _arrayBuffer.byteLength();
 }
 
 uint32_t BinaryReader::readUint32()
 {
-  const auto value = _dataView.getUint32(_byteOffset, true);
+  // Binary glTF is little endian
+  const auto bytes = _arrayBuffer.slice(_byteOffset, 4).data();
+  const auto value = static_cast<uint32_t>(bytes[0]) | (static_cast<uint32_t>(bytes[1]) << 8)
+                     | (static_cast<uint32_t>(bytes[2]) << 16)
+                     | (static_cast<uint32_t>(bytes[3]) << 24);
   _byteOffset += 4;
   return value;
 }
 
 Uint8Array BinaryReader::readUint8Array(size_t length)
 {
-  const auto value
-    = stl_util::to_array<uint8_t>(_arrayBuffer, _byteOffset, length);
+  const auto value = _arrayBuffer.toTypedArray<uint8_t>(_byteOffset, length);
+  _byteOffset += length;
+  return value;
+}
+
+MappedArrayBuffer BinaryReader::readMappedArrayBuffer(size_t length)
+{
+  const auto value = _arrayBuffer.slice(_byteOffset, length);
   _byteOffset += length;
   return value;
 }
@@ -4,6 +4,7 @@
 #include <babylon/babylon_stl_util.h>
 #include <babylon/core/json_util.h>
 #include <babylon/core/logging.h>
+#include <babylon/core/mapped_array_buffer.h>
 #include <babylon/engines/asset_container.h>
 #include <babylon/engines/scene.h>
 #include <babylon/loading/glTF/2.0/gltf_loader.h>
@@ -12,6 +13,7 @@
 #include <babylon/loading/scene_loader.h>
 #include <babylon/materials/material.h>
 #include <babylon/materials/textures/base_texture.h>
+#include <babylon/misc/file_tools.h>
 #include <babylon/misc/string_tools.h>
 #include <babylon/misc/tools.h>
 
@@ -40,6 +42,7 @@ GLTFFileLoader::GLTFFileLoader()
     , useClipPlane{false}
     , compileShadowGenerators{false}
     , transparencyAsCoverage{false}
+    , useMemoryMappedBuffers{false}
     , preprocessUrlAsync{nullptr}
     , onMeshLoaded{this, &GLTFFileLoader::set_onMeshLoaded}
     , onTextureLoaded{this, &GLTFFileLoader::set_onTextureLoaded}
@@ -332,7 +335,16 @@ IGLTFLoaderData GLTFFileLoader::_parseAsync(Scene* scene,
 {
   UnpackedBinary unpacked;
   if (std::holds_alternative<ArrayBuffer>(data)) {
-    unpacked = _unpackBinary(std::get<ArrayBuffer>(data));
+    // The chunks are read as slices of the mapped file, or of a single copy of the data
+    MappedArrayBuffer binary;
+    if (useMemoryMappedBuffers) {
+      binary = MappedArrayBuffer::FromFile(
+        FileTools::PreprocessUrl(preprocessUrlAsync(rootUrl + fileName)));
+    }
+    if (!binary) {
+      binary = MappedArrayBuffer(ArrayBuffer(std::get<ArrayBuffer>(data)));
+    }
+    unpacked = _unpackBinary(binary);
   }
   else if (std::holds_alternative<std::string>(data)) {
     unpacked.json = std::get<std::string>(data);
@@ -412,10 +424,10 @@ IGLTFLoaderPtr GLTFFileLoader::_getLoader(const IGLTFLoaderData& loaderData)
   return createLoaders[version->major](*this);
 }
 
-UnpackedBinary GLTFFileLoader::_unpackBinary(const ArrayBuffer& data)
+UnpackedBinary GLTFFileLoader::_unpackBinary(const MappedArrayBuffer& data)
 {
   _startPerformanceCounter("Unpack binary");
-  _log(StringTools::printf("Binary length: %ld", data.size()));
+  _log(StringTools::printf("Binary length: %ld", data.byteLength()));
 
   static const unsigned int Binary_Magic = 0x46546C67;
 
@@ -478,7 +490,7 @@ UnpackedBinary GLTFFileLoader::_unpackBinaryV1(BinaryReader& binaryReader) const
   }
 
   const auto bytesRemaining = binaryReader.getLength() - binaryReader.getPosition();
-  const auto body           = binaryReader.readUint8Array(bytesRemaining);
+  const auto body           = binaryReader.readMappedArrayBuffer(bytesRemaining);
 
   return UnpackedBinary{
     content, // json
@@ -508,7 +520,7 @@ UnpackedBinary GLTFFileLoader::_unpackBinaryV2(BinaryReader& binaryReader) const
   const auto json = GLTFFileLoader::_decodeBufferToText(binaryReader.readUint8Array(chunkLength));
 
   // Look for BIN chunk
-  Uint8Array bin;
+  MappedArrayBuffer bin;
   while (binaryReader.getPosition() < binaryReader.getLength()) {
     const auto chunkLength2 = binaryReader.readUint32();
     const auto chunkFormat2 = binaryReader.readUint32();
@@ -517,7 +529,7 @@ UnpackedBinary GLTFFileLoader::_unpackBinaryV2(BinaryReader& binaryReader) const
         throw std::runtime_error("Unexpected JSON chunk");
       }
       case ChunkFormat_BIN: {
-        bin = binaryReader.readUint8Array(chunkLength2);
+        bin = binaryReader.readMappedArrayBuffer(chunkLength2);
         break;
       }
       default: {